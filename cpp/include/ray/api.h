@@ -59,6 +59,16 @@ void Shutdown();
 template <typename T>
 ray::ObjectRef<T> Put(const T &obj);
 
+/// Store a batch of objects in the object store with one runtime call.
+/// Prefer this over calling Put in a loop when storing many objects: the
+/// per-call runtime overhead is paid once for the whole batch.
+///
+/// \param[in] objs The objects which should be stored.
+/// \return References to the objects in the object store, in the same order
+/// as `objs`.
+template <typename T>
+std::vector<ray::ObjectRef<T>> PutBatch(const std::vector<T> &objs);
+
 /// Get a single object from the object store.
 /// This method will be blocked until the object is ready.
 ///
@@ -109,6 +119,16 @@ WaitResult<T> Wait(const std::vector<ray::ObjectRef<T>> &objects,
                    int num_objects,
                    int timeout_ms);
 
+/// Hint that a batch of objects will be consumed soon, e.g. as arguments of
+/// tasks about to be submitted or by upcoming Get calls. Fetching the objects
+/// to the local node starts in the background, overlapping data movement with
+/// ongoing compute. This never blocks and is best effort; it does not change
+/// the visible behavior of later Get or task calls.
+///
+/// \param[in] objects The objects which will be consumed soon.
+template <typename T>
+void PrefetchObjects(const std::vector<ray::ObjectRef<T>> &objects);
+
 /// Create a `TaskCaller` for calling remote function.
 /// It is used for normal task, such as ray::Task(Plus1).Remote(1),
 /// ray::Task(Plus).Remote(1, 2).
@@ -217,6 +237,26 @@ inline ray::ObjectRef<T> Put(const T &obj) {
   return ref;
 }
 
+template <typename T>
+inline std::vector<ray::ObjectRef<T>> PutBatch(const std::vector<T> &objs) {
+  std::vector<std::shared_ptr<msgpack::sbuffer>> buffers;
+  buffers.reserve(objs.size());
+  for (const auto &obj : objs) {
+    buffers.push_back(
+        std::make_shared<msgpack::sbuffer>(ray::internal::Serializer::Serialize(obj)));
+  }
+  auto ids = ray::internal::GetRayRuntime()->PutBatch(buffers);
+  std::vector<ray::ObjectRef<T>> refs;
+  refs.reserve(ids.size());
+  for (const auto &id : ids) {
+    refs.emplace_back(ObjectRef<T>(id));
+    // See Put: drop the initial ref added by the core worker now that the
+    // frontend ObjectRef holds one.
+    ray::internal::GetRayRuntime()->RemoveLocalReference(id);
+  }
+  return refs;
+}
+
 template <typename T>
 inline std::shared_ptr<T> Get(const ray::ObjectRef<T> &object, const int &timeout_ms) {
   return GetFromRuntime(object, timeout_ms);
@@ -277,6 +317,12 @@ inline WaitResult<T> Wait(const std::vector<ray::ObjectRef<T>> &objects,
   return WaitResult<T>(std::move(readys), std::move(unreadys));
 }
 
+template <typename T>
+inline void PrefetchObjects(const std::vector<ray::ObjectRef<T>> &objects) {
+  auto object_ids = ObjectRefsToObjectIDs<T>(objects);
+  ray::internal::GetRayRuntime()->PrefetchObjects(object_ids);
+}
+
 inline ray::internal::ActorCreator<PyActorClass> Actor(PyActorClass func) {
   ray::internal::RemoteFunctionHolder remote_func_holder(func.module_name,
                                                          func.function_name,
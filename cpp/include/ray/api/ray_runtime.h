@@ -55,6 +55,10 @@ struct RemoteFunctionHolder {
 class RayRuntime {
  public:
   virtual std::string Put(std::shared_ptr<msgpack::sbuffer> data) = 0;
+
+  virtual std::vector<std::string> PutBatch(
+      const std::vector<std::shared_ptr<msgpack::sbuffer>> &data) = 0;
+
   virtual std::shared_ptr<msgpack::sbuffer> Get(const std::string &id) = 0;
 
   virtual std::vector<std::shared_ptr<msgpack::sbuffer>> Get(
@@ -70,6 +74,8 @@ class RayRuntime {
                                  int num_objects,
                                  int timeout_ms) = 0;
 
+  virtual void PrefetchObjects(const std::vector<std::string> &ids) = 0;
+
   virtual std::string Call(const RemoteFunctionHolder &remote_function_holder,
                            std::vector<TaskArg> &args,
                            const CallOptions &task_options) = 0;
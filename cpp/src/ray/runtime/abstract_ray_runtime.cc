@@ -92,6 +92,18 @@ std::string AbstractRayRuntime::Put(std::shared_ptr<msgpack::sbuffer> data) {
   return object_id.Binary();
 }
 
+std::vector<std::string> AbstractRayRuntime::PutBatch(
+    const std::vector<std::shared_ptr<msgpack::sbuffer>> &data) {
+  std::vector<ObjectID> object_ids;
+  object_store_->PutBatch(data, &object_ids);
+  std::vector<std::string> ids;
+  ids.reserve(object_ids.size());
+  for (const auto &object_id : object_ids) {
+    ids.push_back(object_id.Binary());
+  }
+  return ids;
+}
+
 std::shared_ptr<msgpack::sbuffer> AbstractRayRuntime::Get(const std::string &object_id) {
   return Get(object_id, -1);
 }
@@ -126,6 +138,10 @@ std::vector<bool> AbstractRayRuntime::Wait(const std::vector<std::string> &ids,
   return object_store_->Wait(StringIDsToObjectIDs(ids), num_objects, timeout_ms);
 }
 
+void AbstractRayRuntime::PrefetchObjects(const std::vector<std::string> &ids) {
+  object_store_->PrefetchObjects(StringIDsToObjectIDs(ids));
+}
+
 std::vector<std::unique_ptr<::ray::TaskArg>> TransformArgs(
     std::vector<ray::internal::TaskArg> &args, bool cross_lang) {
   std::vector<std::unique_ptr<::ray::TaskArg>> ray_args;
@@ -50,6 +50,9 @@ class AbstractRayRuntime : public RayRuntime {
 
   std::string Put(std::shared_ptr<msgpack::sbuffer> data);
 
+  std::vector<std::string> PutBatch(
+      const std::vector<std::shared_ptr<msgpack::sbuffer>> &data);
+
   std::shared_ptr<msgpack::sbuffer> Get(const std::string &id);
 
   std::vector<std::shared_ptr<msgpack::sbuffer>> Get(const std::vector<std::string> &ids);
@@ -64,6 +67,8 @@ class AbstractRayRuntime : public RayRuntime {
                          int num_objects,
                          int timeout_ms);
 
+  void PrefetchObjects(const std::vector<std::string> &ids);
+
   std::string Call(const RemoteFunctionHolder &remote_function_holder,
                    std::vector<ray::internal::TaskArg> &args,
                    const CallOptions &task_options);
@@ -50,6 +50,16 @@ void LocalModeObjectStore::PutRaw(std::shared_ptr<msgpack::sbuffer> data,
       /*has_reference=*/false);
 }
 
+void LocalModeObjectStore::PutBatchRaw(
+    const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+    std::vector<ObjectID> *object_ids) {
+  object_ids->resize(data.size());
+  for (size_t i = 0; i < data.size(); i++) {
+    (*object_ids)[i] = ObjectID::FromRandom();
+    PutRaw(data[i], (*object_ids)[i]);
+  }
+}
+
 std::shared_ptr<msgpack::sbuffer> LocalModeObjectStore::GetRaw(const ObjectID &object_id,
                                                                int timeout_ms) {
   std::vector<ObjectID> object_ids;
@@ -83,6 +93,10 @@ std::vector<std::shared_ptr<msgpack::sbuffer>> LocalModeObjectStore::GetRaw(
   return result_sbuffers;
 }
 
+void LocalModeObjectStore::PrefetchObjects(const std::vector<ObjectID> &ids) {
+  // No-op: local mode objects live in the in-process memory store.
+}
+
 std::vector<bool> LocalModeObjectStore::Wait(const std::vector<ObjectID> &ids,
                                              int num_objects,
                                              int timeout_ms) {
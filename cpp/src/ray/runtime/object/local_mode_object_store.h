@@ -30,6 +30,8 @@ class LocalModeObjectStore : public ObjectStore {
  public:
   explicit LocalModeObjectStore(LocalModeRayRuntime &local_mode_ray_tuntime);
 
+  void PrefetchObjects(const std::vector<ObjectID> &ids);
+
   std::vector<bool> Wait(const std::vector<ObjectID> &ids,
                          int num_objects,
                          int timeout_ms);
@@ -43,6 +45,9 @@ class LocalModeObjectStore : public ObjectStore {
 
   void PutRaw(std::shared_ptr<msgpack::sbuffer> data, const ObjectID &object_id);
 
+  void PutBatchRaw(const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+                   std::vector<ObjectID> *object_ids);
+
   std::shared_ptr<msgpack::sbuffer> GetRaw(const ObjectID &object_id, int timeout_ms);
 
   std::vector<std::shared_ptr<msgpack::sbuffer>> GetRaw(const std::vector<ObjectID> &ids,
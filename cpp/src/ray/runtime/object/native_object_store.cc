@@ -58,6 +58,24 @@ void NativeObjectStore::PutRaw(std::shared_ptr<msgpack::sbuffer> data,
   return;
 }
 
+void NativeObjectStore::PutBatchRaw(
+    const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+    std::vector<ObjectID> *object_ids) {
+  auto &core_worker = CoreWorkerProcess::GetCoreWorker();
+  object_ids->resize(data.size());
+  for (size_t i = 0; i < data.size(); i++) {
+    auto buffer = std::make_shared<::ray::LocalMemoryBuffer>(
+        reinterpret_cast<uint8_t *>(data[i]->data()), data[i]->size(), true);
+    auto status = core_worker.Put(
+        ::ray::RayObject(buffer, nullptr, std::vector<rpc::ObjectReference>()),
+        {},
+        &(*object_ids)[i]);
+    if (!status.ok()) {
+      throw RayException("Put object error");
+    }
+  }
+}
+
 std::shared_ptr<msgpack::sbuffer> NativeObjectStore::GetRaw(const ObjectID &object_id,
                                                             int timeout_ms) {
   std::vector<ObjectID> object_ids;
@@ -154,6 +172,15 @@ std::vector<std::shared_ptr<msgpack::sbuffer>> NativeObjectStore::GetRaw(
   return result_sbuffers;
 }
 
+void NativeObjectStore::PrefetchObjects(const std::vector<ObjectID> &ids) {
+  auto &core_worker = CoreWorkerProcess::GetCoreWorker();
+  ::ray::Status status = core_worker.PrefetchObjects(ids);
+  if (!status.ok()) {
+    // Prefetch is a best-effort hint; a failure only loses the overlap.
+    RAY_LOG(WARNING) << "Prefetch objects error: " << status.ToString();
+  }
+}
+
 std::vector<bool> NativeObjectStore::Wait(const std::vector<ObjectID> &ids,
                                           int num_objects,
                                           int timeout_ms) {
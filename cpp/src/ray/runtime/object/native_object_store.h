@@ -24,6 +24,8 @@ namespace internal {
 
 class NativeObjectStore : public ObjectStore {
  public:
+  void PrefetchObjects(const std::vector<ObjectID> &ids);
+
   std::vector<bool> Wait(const std::vector<ObjectID> &ids,
                          int num_objects,
                          int timeout_ms);
@@ -37,6 +39,9 @@ class NativeObjectStore : public ObjectStore {
 
   void PutRaw(std::shared_ptr<msgpack::sbuffer> data, const ObjectID &object_id);
 
+  void PutBatchRaw(const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+                   std::vector<ObjectID> *object_ids);
+
   std::shared_ptr<msgpack::sbuffer> GetRaw(const ObjectID &object_id, int timeout_ms);
 
   std::vector<std::shared_ptr<msgpack::sbuffer>> GetRaw(const std::vector<ObjectID> &ids,
@@ -33,6 +33,11 @@ void ObjectStore::Put(std::shared_ptr<msgpack::sbuffer> data, const ObjectID &ob
   PutRaw(data, object_id);
 }
 
+void ObjectStore::PutBatch(const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+                           std::vector<ObjectID> *object_ids) {
+  PutBatchRaw(data, object_ids);
+}
+
 std::shared_ptr<msgpack::sbuffer> ObjectStore::Get(const ObjectID &object_id,
                                                    int timeout_ms) {
   return GetRaw(object_id, timeout_ms);
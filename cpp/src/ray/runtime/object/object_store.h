@@ -43,6 +43,16 @@ class ObjectStore {
   /// \param[in] object_id The object which should be stored.
   void Put(std::shared_ptr<msgpack::sbuffer> data, const ObjectID &object_id);
 
+  /// Store a batch of objects in the object store with one call.
+  /// Prefer this over repeated single-object Put calls when storing many
+  /// objects: the per-call overhead is paid once for the whole batch.
+  ///
+  /// \param[in] data The serialized object data buffers to store.
+  /// \param[out] object_ids The ids which are allocated to the objects, in the
+  /// same order as `data`.
+  void PutBatch(const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+                std::vector<ObjectID> *object_ids);
+
   /// Get a single object from the object store.
   /// This method will be blocked until the object are ready or wait for timeout.
   ///
@@ -72,6 +82,14 @@ class ObjectStore {
                                  int num_objects,
                                  int timeout_ms) = 0;
 
+  /// Hint that the given objects will be consumed soon, so that fetching them
+  /// to the local node can overlap with ongoing compute. This never blocks
+  /// and is best effort; a later Get picks the objects up locally if the
+  /// fetch has finished.
+  ///
+  /// \param[in] ids The object id array which will be consumed soon.
+  virtual void PrefetchObjects(const std::vector<ObjectID> &ids) = 0;
+
   /// Increase the reference count for this object ID.
   /// Increase the local reference count for this object ID. Should be called
   /// by the language frontend when a new reference is created.
@@ -95,6 +113,9 @@ class ObjectStore {
   virtual void PutRaw(std::shared_ptr<msgpack::sbuffer> data,
                       const ObjectID &object_id) = 0;
 
+  virtual void PutBatchRaw(const std::vector<std::shared_ptr<msgpack::sbuffer>> &data,
+                           std::vector<ObjectID> *object_ids) = 0;
+
   virtual std::shared_ptr<msgpack::sbuffer> GetRaw(const ObjectID &object_id,
                                                    int timeout_ms) = 0;
 
@@ -163,6 +163,19 @@ TEST(RayApiTest, PutTest) {
   EXPECT_EQ(1, *i1);
 }
 
+TEST(RayApiTest, PutBatchTest) {
+  ray::RayConfig config;
+  config.local_mode = true;
+  ray::Init(config);
+
+  std::vector<int> values = {1, 2, 3, 4, 5};
+  auto refs = ray::PutBatch(values);
+  ASSERT_EQ(refs.size(), values.size());
+  for (size_t i = 0; i < refs.size(); i++) {
+    EXPECT_EQ(values[i], *refs[i].Get());
+  }
+}
+
 TEST(RayApiTest, StaticGetTest) {
   ray::RayConfig config;
   config.local_mode = true;
@@ -196,6 +209,22 @@ TEST(RayApiTest, WaitTest) {
   EXPECT_EQ(*getResult[2], 5);
 }
 
+TEST(RayApiTest, PrefetchObjectsTest) {
+  ray::RayConfig config;
+  config.local_mode = true;
+  ray::Init(config);
+
+  auto obj0 = ray::Put(7);
+  auto obj1 = ray::Put(8);
+  std::vector<ray::ObjectRef<int>> objects = {obj0, obj1};
+  // A prefetch hint must never change the result of a later Get.
+  ray::PrefetchObjects(objects);
+  auto results = ray::Get(objects);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(*results[0], 7);
+  EXPECT_EQ(*results[1], 8);
+}
+
 TEST(RayApiTest, ObjectRefArgsTest) {
   auto obj = ray::Put(std::string("aaa"));
   auto r = ray::Task(GetVal).Remote(obj);
@@ -0,0 +1,97 @@
+// Copyright 2020-2021 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark comparing per-object Put/Get loops against the batched
+// PutBatch/vectored Get APIs. Runs in local mode so the numbers reflect
+// API-layer overhead rather than cluster scheduling.
+//
+// Usage: object_batch_benchmark [num_objects] [num_rounds]
+
+#include <ray/api.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedUs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start)
+      .count();
+}
+
+void RunRound(int num_objects) {
+  std::vector<std::string> values;
+  values.reserve(num_objects);
+  for (int i = 0; i < num_objects; i++) {
+    values.push_back("benchmark payload " + std::to_string(i));
+  }
+
+  // Per-object Put loop.
+  auto start = Clock::now();
+  std::vector<ray::ObjectRef<std::string>> loop_refs;
+  loop_refs.reserve(num_objects);
+  for (const auto &value : values) {
+    loop_refs.push_back(ray::Put(value));
+  }
+  double put_loop_us = ElapsedUs(start);
+
+  // Batched Put.
+  start = Clock::now();
+  auto batch_refs = ray::PutBatch(values);
+  double put_batch_us = ElapsedUs(start);
+
+  // Per-object Get loop.
+  start = Clock::now();
+  for (const auto &ref : loop_refs) {
+    auto value = ref.Get();
+  }
+  double get_loop_us = ElapsedUs(start);
+
+  // Vectored Get.
+  start = Clock::now();
+  auto results = ray::Get(batch_refs);
+  double get_batch_us = ElapsedUs(start);
+
+  std::cout << "objects: " << num_objects << "\n"
+            << "  put loop:  " << put_loop_us << " us (" << put_loop_us / num_objects
+            << " us/object)\n"
+            << "  put batch: " << put_batch_us << " us (" << put_batch_us / num_objects
+            << " us/object)\n"
+            << "  get loop:  " << get_loop_us << " us (" << get_loop_us / num_objects
+            << " us/object)\n"
+            << "  get batch: " << get_batch_us << " us (" << get_batch_us / num_objects
+            << " us/object)" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int num_objects = argc > 1 ? std::stoi(argv[1]) : 1000;
+  int num_rounds = argc > 2 ? std::stoi(argv[2]) : 3;
+
+  ray::RayConfig config;
+  config.local_mode = true;
+  ray::Init(config);
+
+  for (int round = 0; round < num_rounds; round++) {
+    RunRound(num_objects);
+  }
+
+  ray::Shutdown();
+  return 0;
+}
@@ -22,7 +22,10 @@ from ray._private.inspect_util import (
     is_function_or_method,
     is_static_method,
 )
-from ray._private.ray_constants import KV_NAMESPACE_FUNCTION_TABLE
+from ray._private.ray_constants import (
+    KV_NAMESPACE_FUNCTION_TABLE,
+    RAY_FUNCTION_TABLE_CACHE_ENABLED,
+)
 from ray._private.utils import (
     check_oversized_function,
     ensure_str,
@@ -95,6 +98,11 @@ class FunctionActorManager:
         self.lock = threading.RLock()
 
         self.execution_infos = {}
+        # Node-local persistent cache directory for exported function and
+        # actor class definitions (see RAY_FUNCTION_TABLE_CACHE_ENABLED).
+        # Resolved lazily because the worker's node handle is not attached
+        # yet when this manager is constructed.
+        self._function_table_cache_dir = None
         # This is the counter to keep track of how many keys have already
         # been exported so that we can find next key quicker.
         self._num_exported = 0
@@ -243,12 +251,70 @@ class FunctionActorManager:
             key, val, True, KV_NAMESPACE_FUNCTION_TABLE
         )
 
+    def _get_function_table_cache_dir(self) -> Optional[str]:
+        """Return the node-local function table cache directory, or None if
+        the cache is disabled or the session directory is not known."""
+        if not RAY_FUNCTION_TABLE_CACHE_ENABLED:
+            return None
+        if self._function_table_cache_dir is not None:
+            return self._function_table_cache_dir
+        node = getattr(self._worker, "node", None)
+        if node is None:
+            return None
+        try:
+            cache_dir = os.path.join(
+                node.get_session_dir_path(), "function_table_cache"
+            )
+            os.makedirs(cache_dir, exist_ok=True)
+        except OSError:
+            return None
+        self._function_table_cache_dir = cache_dir
+        return cache_dir
+
+    def _function_table_cache_path(self, key) -> Optional[str]:
+        cache_dir = self._get_function_table_cache_dir()
+        if cache_dir is None:
+            return None
+        if isinstance(key, str):
+            key = key.encode()
+        # The key embeds the job id and the content-hashed function id, so a
+        # cache entry is immutable and never needs invalidation.
+        return os.path.join(cache_dir, hashlib.sha1(key).hexdigest())
+
+    def _function_table_cache_get(self, key) -> Optional[bytes]:
+        path = self._function_table_cache_path(key)
+        if path is None:
+            return None
+        try:
+            with open(path, "rb") as f:
+                return f.read()
+        except OSError:
+            return None
+
+    def _function_table_cache_put(self, key, value: bytes):
+        path = self._function_table_cache_path(key)
+        if path is None:
+            return
+        try:
+            # Write-then-rename so concurrently restarting workers never see
+            # a partially written entry.
+            tmp_path = f"{path}.{os.getpid()}.tmp"
+            with open(tmp_path, "wb") as f:
+                f.write(value)
+            os.replace(tmp_path, path)
+        except OSError:
+            logger.debug("Failed to write function table cache entry %s.", path)
+
     def fetch_registered_method(
         self, key: str, timeout: Optional[int] = None
     ) -> Optional[ImportedFunctionInfo]:
-        vals = self._worker.gcs_client.internal_kv_get(
-            key, KV_NAMESPACE_FUNCTION_TABLE, timeout=timeout
-        )
+        vals = self._function_table_cache_get(key)
+        if vals is None:
+            vals = self._worker.gcs_client.internal_kv_get(
+                key, KV_NAMESPACE_FUNCTION_TABLE, timeout=timeout
+            )
+            if vals is not None:
+                self._function_table_cache_put(key, vals)
         if vals is None:
             return None
         else:
@@ -638,8 +704,14 @@ class FunctionActorManager:
             actor_creation_function_descriptor.function_id.binary(),
         )
 
-        # Fetch raw data from GCS.
-        vals = self._worker.gcs_client.internal_kv_get(key, KV_NAMESPACE_FUNCTION_TABLE)
+        # Fetch raw data from the node-local cache, falling back to GCS.
+        vals = self._function_table_cache_get(key)
+        if vals is None:
+            vals = self._worker.gcs_client.internal_kv_get(
+                key, KV_NAMESPACE_FUNCTION_TABLE
+            )
+            if vals is not None:
+                self._function_table_cache_put(key, vals)
         fields = ["job_id", "class_name", "module", "class", "actor_method_names"]
         if vals is None:
             vals = {}
@@ -439,6 +439,12 @@ KV_HEAD_NODE_ID_KEY = b"head_node_id"
 KV_NAMESPACE_PACKAGE = None
 KV_NAMESPACE_FUNCTION_TABLE = b"fun"
 
+# If enabled, workers keep a node-local persistent cache of exported function
+# and actor class definitions under the session directory, keyed by the
+# content-hashed function table key. Restarted workers on the same node then
+# load definitions from disk instead of a GCS KV round trip.
+RAY_FUNCTION_TABLE_CACHE_ENABLED = env_bool("RAY_FUNCTION_TABLE_CACHE_ENABLED", False)
+
 LANGUAGE_WORKER_TYPES = ["python", "java", "cpp"]
 
 NEURON_CORES = "neuron_cores"
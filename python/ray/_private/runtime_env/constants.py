@@ -21,6 +21,12 @@ RAY_RUNTIME_ENV_PLUGIN_MIN_PRIORITY = 0
 # The maximum priority of runtime env plugin.
 RAY_RUNTIME_ENV_PLUGIN_MAX_PRIORITY = 100
 
+# If set to 1, the runtime env agent creates a plugin's cache-missing URIs
+# concurrently (e.g. the individual py_modules packages) instead of one after
+# another. Only plugins that declare their per-URI creates independent opt in;
+# plugin priority ordering and context activation are unchanged.
+RAY_RUNTIME_ENV_PARALLEL_URI_CREATES_ENV_VAR = "RAY_RUNTIME_ENV_PARALLEL_URI_CREATES"
+
 # The schema files or directories of plugins which should be loaded in workers.
 RAY_RUNTIME_ENV_PLUGIN_SCHEMAS_ENV_VAR = "RAY_RUNTIME_ENV_PLUGIN_SCHEMAS"
 
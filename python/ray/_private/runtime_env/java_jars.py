@@ -21,6 +21,9 @@ default_logger = logging.getLogger(__name__)
 class JavaJarsPlugin(RuntimeEnvPlugin):
 
     name = "java_jars"
+    # Each jar downloads into its own directory, so the per-URI creates may
+    # run concurrently.
+    uri_creates_are_independent = True
 
     def __init__(self, resources_dir: str, gcs_client: GcsClient):
         self._resources_dir = os.path.join(resources_dir, "java_jars_files")
@@ -1,3 +1,4 @@
+import asyncio
 import json
 import logging
 import os
@@ -7,6 +8,7 @@ from typing import Any, Dict, List, Optional, Type
 from ray._common.utils import import_attr
 from ray._private.runtime_env.constants import (
     RAY_RUNTIME_ENV_CLASS_FIELD_NAME,
+    RAY_RUNTIME_ENV_PARALLEL_URI_CREATES_ENV_VAR,
     RAY_RUNTIME_ENV_PLUGIN_DEFAULT_PRIORITY,
     RAY_RUNTIME_ENV_PLUGIN_MAX_PRIORITY,
     RAY_RUNTIME_ENV_PLUGIN_MIN_PRIORITY,
@@ -26,6 +28,11 @@ class RuntimeEnvPlugin(ABC):
 
     name: str = None
     priority: int = RAY_RUNTIME_ENV_PLUGIN_DEFAULT_PRIORITY
+    # Whether create() calls for different URIs of this plugin are independent
+    # of each other and may run concurrently. Plugins whose per-URI installs
+    # share mutable state (e.g. a conda or pip environment) must leave this
+    # False.
+    uri_creates_are_independent: bool = False
 
     @staticmethod
     def validate(runtime_env_dict: dict) -> None:
@@ -249,8 +256,32 @@ async def create_for_plugin_if_needed(
         )
         await plugin.create(None, runtime_env, context, logger=logger)
 
+    cache_miss_uris = list(dict.fromkeys(uri for uri in uris if uri not in uri_cache))
+    created_sizes = {}
+    if (
+        len(cache_miss_uris) > 1
+        and plugin.uri_creates_are_independent
+        and os.environ.get(RAY_RUNTIME_ENV_PARALLEL_URI_CREATES_ENV_VAR) == "1"
+    ):
+        # The plugin declared its per-URI creates independent, so download and
+        # install all cache misses concurrently. Concurrent creates of the same
+        # URI from other requests are already serialized by the per-package
+        # file lock in packaging.py.
+        logger.debug(
+            f"Cache miss for URIs {cache_miss_uris}; creating them concurrently."
+        )
+        size_bytes_list = await asyncio.gather(
+            *(
+                plugin.create(uri, runtime_env, context, logger=logger)
+                for uri in cache_miss_uris
+            )
+        )
+        created_sizes = dict(zip(cache_miss_uris, size_bytes_list))
+
     for uri in uris:
-        if uri not in uri_cache:
+        if uri in created_sizes:
+            uri_cache.add(uri, created_sizes.pop(uri), logger=logger)
+        elif uri not in uri_cache:
             logger.debug(f"Cache miss for URI {uri}.")
             size_bytes = await plugin.create(uri, runtime_env, context, logger=logger)
             uri_cache.add(uri, size_bytes, logger=logger)
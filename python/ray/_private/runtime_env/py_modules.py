@@ -171,6 +171,9 @@ def upload_py_modules_if_needed(
 class PyModulesPlugin(RuntimeEnvPlugin):
 
     name = "py_modules"
+    # Each module downloads and installs into its own directory, so the
+    # per-URI creates may run concurrently.
+    uri_creates_are_independent = True
 
     def __init__(self, resources_dir: str, gcs_client: GcsClient):
         self._resources_dir = os.path.join(resources_dir, "py_modules_files")
@@ -0,0 +1,98 @@
+import sys
+from types import SimpleNamespace
+
+import pytest
+
+import ray
+from ray import cloudpickle as pickle
+from ray._private import function_manager
+from ray._private.function_manager import (
+    FunctionActorManager,
+    make_function_table_key,
+)
+
+
+class FakeGcsClient:
+    """Records internal_kv_get calls and serves a fixed function table."""
+
+    def __init__(self, table):
+        self.table = table
+        self.num_gets = 0
+
+    def internal_kv_get(self, key, namespace, timeout=None):
+        self.num_gets += 1
+        return self.table.get(key)
+
+
+def make_fake_worker(session_dir, table):
+    node = SimpleNamespace(get_session_dir_path=lambda: str(session_dir))
+    return SimpleNamespace(gcs_client=FakeGcsClient(table), node=node)
+
+
+def make_registered_method_entry(job_id):
+    function = pickle.dumps(lambda: 42)
+    return pickle.dumps(
+        {
+            "job_id": job_id.binary(),
+            "function_id": ray.FunctionID.from_random().binary(),
+            "function_name": "f",
+            "function": function,
+            "module": "__main__",
+            "max_calls": 0,
+        }
+    )
+
+
+def test_cache_skips_kv_round_trip_after_restart(tmp_path, monkeypatch):
+    monkeypatch.setattr(function_manager, "RAY_FUNCTION_TABLE_CACHE_ENABLED", True)
+    job_id = ray.JobID.from_int(1)
+    key = make_function_table_key(b"RemoteFunction", job_id, b"abc")
+    table = {key: make_registered_method_entry(job_id)}
+
+    worker = make_fake_worker(tmp_path, table)
+    manager = FunctionActorManager(worker)
+    info = manager.fetch_registered_method(key)
+    assert info is not None
+    assert info.function_name == "f"
+    assert worker.gcs_client.num_gets == 1
+
+    # A fresh manager on the same node (a restarted worker) must be served
+    # from the on-disk cache without touching the KV store.
+    restarted_worker = make_fake_worker(tmp_path, table)
+    restarted_manager = FunctionActorManager(restarted_worker)
+    info = restarted_manager.fetch_registered_method(key)
+    assert info is not None
+    assert info.function_name == "f"
+    assert restarted_worker.gcs_client.num_gets == 0
+
+
+def test_cache_disabled_by_default(tmp_path):
+    job_id = ray.JobID.from_int(2)
+    key = make_function_table_key(b"RemoteFunction", job_id, b"abc")
+    table = {key: make_registered_method_entry(job_id)}
+
+    for _ in range(2):
+        worker = make_fake_worker(tmp_path, table)
+        manager = FunctionActorManager(worker)
+        assert manager.fetch_registered_method(key) is not None
+        assert worker.gcs_client.num_gets == 1
+    assert not (tmp_path / "function_table_cache").exists()
+
+
+def test_missing_key_is_not_cached(tmp_path, monkeypatch):
+    monkeypatch.setattr(function_manager, "RAY_FUNCTION_TABLE_CACHE_ENABLED", True)
+    job_id = ray.JobID.from_int(3)
+    key = make_function_table_key(b"RemoteFunction", job_id, b"missing")
+
+    worker = make_fake_worker(tmp_path, {})
+    manager = FunctionActorManager(worker)
+    assert manager.fetch_registered_method(key) is None
+    assert worker.gcs_client.num_gets == 1
+    # The export may still be in flight; the next fetch must retry the KV
+    # store instead of caching the miss.
+    assert manager.fetch_registered_method(key) is None
+    assert worker.gcs_client.num_gets == 2
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main(["-sv", __file__]))
@@ -1,3 +1,4 @@
+import asyncio
 import dataclasses
 import json
 import os
@@ -12,6 +13,14 @@ import pytest
 
 import ray
 import ray._private.ray_constants as ray_constants
+from ray._private.runtime_env.constants import (
+    RAY_RUNTIME_ENV_PARALLEL_URI_CREATES_ENV_VAR,
+)
+from ray._private.runtime_env.context import RuntimeEnvContext
+from ray._private.runtime_env.plugin import (
+    RuntimeEnvPlugin,
+    create_for_plugin_if_needed,
+)
 from ray._private.runtime_env.uri_cache import URICache
 from ray._private.runtime_env.utils import (
     SubprocessCalledProcessError,
@@ -349,6 +358,71 @@ async def test_check_output_cmd():
     assert "cmd[5]" in str(e.value)
 
 
+class _FakeMultiUriPlugin(RuntimeEnvPlugin):
+    name = "fake_multi_uri"
+    uri_creates_are_independent = True
+
+    def __init__(self, uris):
+        self._uris = uris
+        self._active_creates = 0
+        self.max_concurrent_creates = 0
+        self.created_uris = []
+
+    def get_uris(self, runtime_env):
+        return self._uris
+
+    async def create(self, uri, runtime_env, context, logger=None):
+        self._active_creates += 1
+        self.max_concurrent_creates = max(
+            self.max_concurrent_creates, self._active_creates
+        )
+        await asyncio.sleep(0.01)
+        self._active_creates -= 1
+        self.created_uris.append(uri)
+        return 1
+
+
+@pytest.mark.asyncio
+async def test_create_for_plugin_if_needed_parallel_uri_creates(monkeypatch):
+    runtime_env = {_FakeMultiUriPlugin.name: True}
+    uris = ["uri_a", "uri_b", "uri_c"]
+
+    def make_cache():
+        return URICache(
+            lambda uri, logger: 1, max_total_size_bytes=1024, debug_mode=True
+        )
+
+    # By default the URIs are created one after another.
+    plugin = _FakeMultiUriPlugin(uris)
+    await create_for_plugin_if_needed(
+        runtime_env, plugin, make_cache(), RuntimeEnvContext()
+    )
+    assert plugin.max_concurrent_creates == 1
+    assert sorted(plugin.created_uris) == uris
+
+    # With the flag set, cache misses of an opted-in plugin run concurrently.
+    monkeypatch.setenv(RAY_RUNTIME_ENV_PARALLEL_URI_CREATES_ENV_VAR, "1")
+    plugin = _FakeMultiUriPlugin(uris)
+    cache = make_cache()
+    await create_for_plugin_if_needed(runtime_env, plugin, cache, RuntimeEnvContext())
+    assert plugin.max_concurrent_creates == len(uris)
+    assert sorted(plugin.created_uris) == uris
+    for uri in uris:
+        assert uri in cache
+
+    # Cached URIs are not created again.
+    await create_for_plugin_if_needed(runtime_env, plugin, cache, RuntimeEnvContext())
+    assert sorted(plugin.created_uris) == uris
+
+    # Plugins that did not opt in stay serial even with the flag set.
+    plugin = _FakeMultiUriPlugin(uris)
+    plugin.uri_creates_are_independent = False
+    await create_for_plugin_if_needed(
+        runtime_env, plugin, make_cache(), RuntimeEnvContext()
+    )
+    assert plugin.max_concurrent_creates == 1
+
+
 @pytest.mark.parametrize(
     "option",
     ["pip_list", "pip_dict", "conda_name", "conda_dict", "container"],
@@ -71,6 +71,14 @@ class MockTaskManagerInterface : public TaskManagerInterface {
               (const TaskID &task_id, const rpc::RayErrorInfo &error_info),
               (override));
   MOCK_METHOD(void, MarkDependenciesResolved, (const TaskID &task_id), (override));
+  MOCK_METHOD(void,
+              RegisterResultForwardDestination,
+              (const ObjectID &object_id, const rpc::Address &addr),
+              (override));
+  MOCK_METHOD(std::optional<rpc::Address>,
+              GetResultForwardDestination,
+              (const ObjectID &object_id),
+              (const, override));
   MOCK_METHOD(void,
               MarkTaskWaitingForExecution,
               (const TaskID &task_id, const NodeID &node_id, const WorkerID &worker_id),
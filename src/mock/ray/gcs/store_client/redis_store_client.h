@@ -25,6 +25,12 @@ class MockStoreClient : public StoreClient {
                bool overwrite,
                Postable<void(bool)> callback),
               (override));
+  MOCK_METHOD(void,
+              AsyncMultiPut,
+              (const std::string &table_name,
+               (const std::vector<std::pair<std::string, std::string>> &key_values),
+               Postable<void(int64_t)> callback),
+              (override));
   MOCK_METHOD(void,
               AsyncGet,
               (const std::string &table_name,
@@ -36,6 +36,16 @@ class MockObjectDirectory : public IObjectDirectory {
               (const UniqueID &callback_id, const ObjectID &object_id),
               (override));
 
+  MOCK_METHOD(std::optional<CachedObjectLocations>,
+              GetCachedLocations,
+              (const ObjectID &object_id),
+              (const, override));
+
+  MOCK_METHOD(void,
+              HandleLocationHint,
+              (const ObjectID &object_id, const NodeID &node_id, size_t object_size),
+              (override));
+
   MOCK_METHOD(void,
               ReportObjectAdded,
               (const ObjectID &object_id,
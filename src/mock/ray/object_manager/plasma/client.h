@@ -78,6 +78,21 @@ class MockPlasmaClient : public PlasmaClientInterface {
                int device_num),
               (override));
 
+  MOCK_METHOD(Status,
+              CreateAndSealBatch,
+              (const std::vector<ObjectID> &object_ids,
+               const ray::rpc::Address &owner_address,
+               const std::vector<std::string> &data,
+               const std::vector<std::string> &metadata,
+               plasma::flatbuf::ObjectSource source,
+               std::vector<plasma::flatbuf::PlasmaError> *errors),
+              (override));
+
+  MOCK_METHOD(Status,
+              RestoreSpilledObject,
+              (const ObjectID &object_id, const std::string &spilled_url),
+              (override));
+
   MOCK_METHOD(Status, Delete, (const std::vector<ObjectID> &object_ids), (override));
 
   MOCK_METHOD(StatusOr<std::string>, GetMemoryUsage, (), (override));
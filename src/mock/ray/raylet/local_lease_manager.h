@@ -46,6 +46,14 @@ class MockLocalLeaseManager : public LocalLeaseManagerInterface {
               GetBackLogTracker,
               (),
               (const, override));
+  MOCK_METHOD((const absl::flat_hash_map<SchedulingClass, int64_t> &),
+              GetBacklogSizeSum,
+              (),
+              (const, override));
+  MOCK_METHOD((const absl::flat_hash_map<SchedulingClass, size_t> &),
+              GetNumLeasesWaitingForWorker,
+              (),
+              (const, override));
   MOCK_METHOD(void,
               SetWorkerBacklog,
               (SchedulingClass scheduling_class,
@@ -89,6 +89,14 @@ class MockRayletClientInterface : public RayletClientInterface {
                const ObjectID &generator_id,
                const ray::rpc::ClientCallback<ray::rpc::PinObjectIDsReply> &callback),
               (override));
+  MOCK_METHOD(
+      void,
+      HintObjectLocation,
+      (const ObjectID &object_id,
+       const NodeID &location_node_id,
+       uint64_t object_size,
+       const ray::rpc::ClientCallback<ray::rpc::HintObjectLocationReply> &callback),
+      (override));
   MOCK_METHOD(void,
               GetResourceLoad,
               (const rpc::ClientCallback<rpc::GetResourceLoadReply> &callback),
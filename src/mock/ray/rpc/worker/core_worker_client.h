@@ -135,6 +135,11 @@ class MockCoreWorkerClientInterface : public CoreWorkerClientInterface {
               (ReportGeneratorItemReturnsRequest && request,
                const ClientCallback<ReportGeneratorItemReturnsReply> &callback),
               (override));
+  MOCK_METHOD(void,
+              ForwardInlineResult,
+              (ForwardInlineResultRequest && request,
+               const ClientCallback<ForwardInlineResultReply> &callback),
+              (override));
   MOCK_METHOD(void,
               RegisterMutableObjectReader,
               (const RegisterMutableObjectReaderRequest &request,
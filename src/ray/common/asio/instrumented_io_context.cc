@@ -96,6 +96,7 @@ void instrumented_io_context::post(std::function<void()> handler,
                                    std::string name,
                                    int64_t delay_us) {
   delay_us += ray::asio::testing::GetDelayUs(name);
+  num_queued_handlers_.fetch_add(1, std::memory_order_relaxed);
   if (RayConfig::instance().event_stats()) {
     // References are only invalidated upon deletion of the corresponding item from the
     // table, which we won't do until this io_context is deleted. Provided that
@@ -104,23 +105,45 @@ void instrumented_io_context::post(std::function<void()> handler,
     // readers lock in the callback.
     auto stats_handle =
         event_stats_->RecordStart(std::move(name), emit_metrics_, 0, context_name_);
-    handler = [handler = std::move(handler),
-               event_stats = event_stats_,
-               stats_handle = std::move(stats_handle)]() mutable {
+    // Hand the instrumentation wrapper to asio as a concrete lambda instead of
+    // re-erasing it into the `handler` std::function; boost::asio::post stores
+    // it directly, saving one type erasure and heap allocation per handler.
+    auto instrumented_handler = [this,
+                                 handler = std::move(handler),
+                                 event_stats = event_stats_,
+                                 stats_handle = std::move(stats_handle)]() mutable {
+      num_queued_handlers_.fetch_sub(1, std::memory_order_relaxed);
       event_stats->RecordExecution(handler, std::move(stats_handle));
     };
+    if (delay_us == 0) {
+      boost::asio::post(*this, std::move(instrumented_handler));
+    } else {
+      execute_after(
+          *this, std::move(instrumented_handler), std::chrono::microseconds(delay_us));
+    }
+    return;
   }
 
+  auto counted_handler = [this, handler = std::move(handler)]() mutable {
+    num_queued_handlers_.fetch_sub(1, std::memory_order_relaxed);
+    handler();
+  };
   if (delay_us == 0) {
-    boost::asio::post(*this, std::move(handler));
+    boost::asio::post(*this, std::move(counted_handler));
   } else {
-    execute_after(*this, std::move(handler), std::chrono::microseconds(delay_us));
+    execute_after(*this, std::move(counted_handler), std::chrono::microseconds(delay_us));
   }
 }
 
 void instrumented_io_context::dispatch(std::function<void()> handler, std::string name) {
+  num_queued_handlers_.fetch_add(1, std::memory_order_relaxed);
   if (!RayConfig::instance().event_stats()) {
-    return boost::asio::post(*this, std::move(handler));
+    return boost::asio::post(*this,
+                             [this, handler = std::move(handler)]() mutable {
+                               num_queued_handlers_.fetch_sub(
+                                   1, std::memory_order_relaxed);
+                               handler();
+                             });
   }
   auto stats_handle =
       event_stats_->RecordStart(std::move(name), emit_metrics_, 0, context_name_);
@@ -130,9 +153,11 @@ void instrumented_io_context::dispatch(std::function<void()> handler, std::strin
   // handler stats it->second from multiple threads without acquiring a table-level
   // readers lock in the callback.
   boost::asio::dispatch(*this,
-                        [event_stats = event_stats_,
+                        [this,
+                         event_stats = event_stats_,
                          handler = std::move(handler),
                          stats_handle = std::move(stats_handle)]() mutable {
+                          num_queued_handlers_.fetch_sub(1, std::memory_order_relaxed);
                           event_stats->RecordExecution(handler, std::move(stats_handle));
                         });
 }
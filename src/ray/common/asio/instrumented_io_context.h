@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <memory>
 #include <string>
@@ -59,6 +60,14 @@ class instrumented_io_context : public boost::asio::io_context {
 
   std::shared_ptr<EventTracker> stats() const { return event_stats_; };
 
+  /// Number of handlers accepted by this proxy that have not started executing
+  /// yet, including handlers still waiting out a post delay. This is a cheap
+  /// load signal for balancing across io_contexts; work submitted behind this
+  /// proxy's back (e.g. raw asio timers) is not counted.
+  int64_t NumQueuedHandlers() const {
+    return num_queued_handlers_.load(std::memory_order_relaxed);
+  }
+
   ray::stats::Gauge io_context_event_loop_lag_ms_gauge_metric{
       ray::GetIoContextEventLoopLagMsGaugeMetric()};
 
@@ -67,4 +76,7 @@ class instrumented_io_context : public boost::asio::io_context {
   std::shared_ptr<EventTracker> event_stats_;
   bool emit_metrics_;
   std::optional<std::string> context_name_;
+  /// Incremented when a handler is posted or dispatched, decremented when it
+  /// starts executing. See NumQueuedHandlers().
+  std::atomic<int64_t> num_queued_handlers_{0};
 };
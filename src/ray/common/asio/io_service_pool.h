@@ -37,7 +37,10 @@ class IOServicePool {
 
   void Stop();
 
-  /// Select io_service by round robin.
+  /// Select an io_service with the power of two choices: pick two distinct
+  /// candidates (one round-robin, one pseudo-random) and return the one with
+  /// fewer queued handlers, so a saturated context stops accumulating new work
+  /// while its siblings idle.
   ///
   /// \return io_service
   instrumented_io_context *Get();
@@ -63,8 +66,21 @@ class IOServicePool {
 };
 
 inline instrumented_io_context *IOServicePool::Get() {
-  size_t index = ++current_index_ % io_service_num_;
-  return io_services_[index].get();
+  const size_t step = ++current_index_;
+  const size_t first = step % io_service_num_;
+  if (io_service_num_ == 1) {
+    return io_services_[first].get();
+  }
+  // Derive the second candidate by scrambling the step with a multiplicative
+  // hash (Fibonacci hashing constant), then skew away from the first.
+  size_t second = (step * 0x9e3779b97f4a7c15ULL >> 32) % io_service_num_;
+  if (second == first) {
+    second = (second + 1) % io_service_num_;
+  }
+  return io_services_[first]->NumQueuedHandlers() <=
+                 io_services_[second]->NumQueuedHandlers()
+             ? io_services_[first].get()
+             : io_services_[second].get();
 }
 
 inline instrumented_io_context *IOServicePool::Get(size_t hash) {
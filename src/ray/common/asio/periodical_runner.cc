@@ -14,6 +14,7 @@
 
 #include "ray/common/asio/periodical_runner.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -24,7 +25,15 @@
 namespace ray {
 
 PeriodicalRunner::PeriodicalRunner(instrumented_io_context &io_service)
-    : io_service_(io_service) {}
+    : io_service_(io_service) {
+  if (RayConfig::instance().periodical_runner_use_timer_wheel()) {
+    // An idle wheel doesn't tick, so creating it up front costs nothing even
+    // if no task ever lands on it.
+    wheel_ = TimerWheel::Create(io_service,
+                                RayConfig::instance().timer_wheel_resolution_ms(),
+                                RayConfig::instance().timer_wheel_num_slots());
+  }
+}
 
 PeriodicalRunner::~PeriodicalRunner() {
   absl::MutexLock lock(&mutex_);
@@ -40,6 +49,10 @@ void PeriodicalRunner::RunFnPeriodically(std::function<void()> fn,
   if (period_ms <= 0) {
     return;
   }
+  if (wheel_ != nullptr && period_ms >= RayConfig::instance().timer_wheel_resolution_ms()) {
+    RunFnPeriodicallyOnWheel(std::move(fn), period_ms, std::move(name));
+    return;
+  }
   auto timer = std::make_shared<boost::asio::deadline_timer>(io_service_);
   {
     absl::MutexLock lock(&mutex_);
@@ -68,6 +81,68 @@ void PeriodicalRunner::RunFnPeriodically(std::function<void()> fn,
       "PeriodicalRunner.RunFnPeriodically");
 }
 
+void PeriodicalRunner::RunFnPeriodicallyOnWheel(std::function<void()> fn,
+                                                uint64_t period_ms,
+                                                std::string name) {
+  auto task = std::make_shared<PeriodicTask>();
+  task->fn = std::move(fn);
+  task->period_ms = period_ms;
+  task->name = std::move(name);
+  // Phase-spread the steady-state schedule: the first wheel interval is a
+  // deterministic per-task offset within the period, so tasks that share a
+  // period don't all become due on the same tick; every later interval is
+  // exactly period_ms.
+  const uint64_t phase_ms = std::hash<std::string>{}(task->name) % period_ms + 1;
+  io_service_.post(
+      [weak_self = weak_from_this(), task = std::move(task), phase_ms]() mutable {
+        auto self = weak_self.lock();
+        if (self == nullptr) {
+          return;
+        }
+        task->fn();
+        task->next_run =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(phase_ms);
+        self->ScheduleWheelRun(std::move(task));
+      },
+      "PeriodicalRunner.RunFnPeriodically");
+}
+
+void PeriodicalRunner::ScheduleWheelRun(std::shared_ptr<PeriodicTask> task) {
+  const auto now = std::chrono::steady_clock::now();
+  // Advance past deadlines that already expired (including the run that just
+  // finished), skipping runs missed entirely rather than bursting.
+  while (task->next_run <= now) {
+    task->next_run += std::chrono::milliseconds(task->period_ms);
+  }
+  const auto delay_ms = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(task->next_run - now)
+          .count());
+  std::shared_ptr<StatsHandle> stats_handle;
+  if (RayConfig::instance().event_stats()) {
+    // Pad the queueing start time by the scheduled delay so the recorded
+    // queueing time only covers wheel and event-loop lateness, mirroring
+    // DoRunFnPeriodicallyInstrumented.
+    stats_handle = io_service_.stats()->RecordStart(
+        task->name, false, static_cast<int64_t>(delay_ms) * 1000 * 1000);
+  }
+  wheel_->ScheduleAfter(
+      [weak_self = weak_from_this(),
+       task = std::move(task),
+       stats_handle = std::move(stats_handle)]() mutable {
+        auto self = weak_self.lock();
+        if (self == nullptr) {
+          return;
+        }
+        if (stats_handle != nullptr) {
+          self->io_service_.stats()->RecordExecution(task->fn, std::move(stats_handle));
+        } else {
+          task->fn();
+        }
+        self->ScheduleWheelRun(std::move(task));
+      },
+      delay_ms);
+}
+
 void PeriodicalRunner::DoRunFnPeriodically(
     std::function<void()> fn,
     boost::posix_time::milliseconds period,
@@ -16,6 +16,7 @@
 
 #include <boost/asio.hpp>
 #include <boost/asio/deadline_timer.hpp>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/asio/timer_wheel.h"
 
 namespace ray {
 
@@ -54,6 +56,14 @@ class PeriodicalRunnerInterface {
 /// It can run functions with specified period. Each function is triggered by its timer.
 /// To run a function, call `RunFnPeriodically(fn, period_ms)`.
 /// All registered functions will stop running once this object is destructed.
+///
+/// When `periodical_runner_use_timer_wheel` is set, all tasks whose period is at
+/// least the wheel resolution share one TimerWheel (and thus one underlying asio
+/// timer) instead of one deadline timer each. Wheel tasks are phase-spread within
+/// their period so tasks sharing a period don't become due on the same tick, and
+/// are rescheduled against absolute deadlines so the wheel's tick rounding doesn't
+/// accumulate drift. Their execution time is recorded per task name through the
+/// io_context's event stats, like the per-timer path.
 //
 // Lifetime: once a PeriodicalRunner is destructed, all its timers are cancelled. The
 // scheduled asio tasks keep a weak_ptr to the PeriodicalRunner, and they won't run after
@@ -86,7 +96,30 @@ class PeriodicalRunner : public PeriodicalRunnerInterface,
                                        std::string name) override
       ABSL_LOCKS_EXCLUDED(mutex_);
 
+  /// State for a task scheduled on the shared timer wheel.
+  struct PeriodicTask {
+    std::function<void()> fn;
+    uint64_t period_ms;
+    std::string name;
+    /// Absolute deadline of the next run. Rescheduling against it corrects the
+    /// drift the wheel's tick rounding would otherwise accumulate each period.
+    std::chrono::steady_clock::time_point next_run;
+  };
+
+  /// Run `fn` immediately (via post, like the per-timer path) and then every
+  /// `period_ms` off the shared timer wheel.
+  void RunFnPeriodicallyOnWheel(std::function<void()> fn,
+                                uint64_t period_ms,
+                                std::string name);
+
+  /// Schedule the task's next run on the wheel, skipping any runs that were
+  /// missed entirely rather than bursting to catch up.
+  void ScheduleWheelRun(std::shared_ptr<PeriodicTask> task);
+
   instrumented_io_context &io_service_;
+  /// Shared wheel driving all wheel-mode tasks; nullptr unless
+  /// periodical_runner_use_timer_wheel is set.
+  std::shared_ptr<TimerWheel> wheel_;
   mutable absl::Mutex mutex_;
   std::vector<std::shared_ptr<boost::asio::deadline_timer>> timers_
       ABSL_GUARDED_BY(mutex_);
@@ -0,0 +1,116 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/common/asio/timer_wheel.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace ray {
+
+TimerWheel::TimerWheel(instrumented_io_context &io_service,
+                       uint64_t resolution_ms,
+                       size_t num_slots)
+    : io_service_(io_service),
+      resolution_ms_(resolution_ms),
+      num_slots_(num_slots),
+      tick_timer_(io_service),
+      slots_(num_slots) {
+  RAY_CHECK_GT(resolution_ms_, 0UL);
+  RAY_CHECK_GT(num_slots_, 0UL);
+}
+
+TimerWheel::~TimerWheel() {
+  absl::MutexLock lock(&mutex_);
+  tick_timer_.cancel();
+}
+
+TimerWheel::TimerID TimerWheel::ScheduleAfter(std::function<void()> fn,
+                                              uint64_t delay_ms) {
+  absl::MutexLock lock(&mutex_);
+  // Round the delay up to a whole number of ticks so that a timer never fires
+  // early. A delay of zero still waits for the next tick.
+  const uint64_t num_ticks =
+      std::max<uint64_t>((delay_ms + resolution_ms_ - 1) / resolution_ms_, 1);
+  const size_t slot = (current_slot_ + num_ticks) % num_slots_;
+  const TimerID timer_id = next_timer_id_++;
+  // The entry fires the (num_ticks - 1) / num_slots_ + 1'th time the wheel
+  // reaches its slot, i.e. after exactly num_ticks ticks.
+  slots_[slot].emplace(timer_id,
+                       TimerEntry{(num_ticks - 1) / num_slots_, std::move(fn)});
+  timer_to_slot_.emplace(timer_id, slot);
+  ScheduleTick();
+  return timer_id;
+}
+
+bool TimerWheel::Cancel(TimerID timer_id) {
+  absl::MutexLock lock(&mutex_);
+  auto it = timer_to_slot_.find(timer_id);
+  if (it == timer_to_slot_.end()) {
+    return false;
+  }
+  slots_[it->second].erase(timer_id);
+  timer_to_slot_.erase(it);
+  return true;
+}
+
+size_t TimerWheel::NumPending() const {
+  absl::MutexLock lock(&mutex_);
+  return timer_to_slot_.size();
+}
+
+void TimerWheel::ScheduleTick() {
+  if (tick_scheduled_ || timer_to_slot_.empty()) {
+    return;
+  }
+  tick_scheduled_ = true;
+  tick_timer_.expires_from_now(boost::posix_time::milliseconds(resolution_ms_));
+  tick_timer_.async_wait(
+      [weak_self = weak_from_this()](const boost::system::error_code &error) {
+        auto self = weak_self.lock();
+        if (self == nullptr || error == boost::asio::error::operation_aborted) {
+          return;
+        }
+        self->OnTick();
+      });
+}
+
+void TimerWheel::OnTick() {
+  std::vector<std::function<void()>> expired;
+  {
+    absl::MutexLock lock(&mutex_);
+    tick_scheduled_ = false;
+    current_slot_ = (current_slot_ + 1) % num_slots_;
+    auto &bucket = slots_[current_slot_];
+    for (auto it = bucket.begin(); it != bucket.end();) {
+      if (it->second.remaining_rounds > 0) {
+        it->second.remaining_rounds--;
+        ++it;
+        continue;
+      }
+      expired.push_back(std::move(it->second.fn));
+      timer_to_slot_.erase(it->first);
+      bucket.erase(it++);
+    }
+    ScheduleTick();
+  }
+  // Run the batch of due callbacks outside the lock, on the io_context's
+  // thread, so that callbacks can schedule or cancel timers on this wheel.
+  for (auto &fn : expired) {
+    fn();
+  }
+}
+
+}  // namespace ray
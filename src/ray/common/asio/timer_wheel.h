@@ -0,0 +1,136 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/asio/deadline_timer.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "ray/common/asio/asio_util.h"
+#include "ray/common/asio/instrumented_io_context.h"
+
+namespace ray {
+
+/// \class TimerWheel
+/// A hashed timer wheel attached to an io_context. All timers scheduled on the
+/// wheel share a single underlying asio deadline timer that ticks at a fixed
+/// resolution, so inserting and cancelling a timer is O(1) and does not touch
+/// the io_context timer heap. All callbacks that become due on the same tick
+/// run in one batch from the tick handler, on the io_context's thread.
+///
+/// Timers fire at the first tick at or after their deadline, so callbacks can
+/// run up to one resolution interval late. This is intended for retry and
+/// backoff timers where many timers are outstanding and millisecond-exact
+/// expiry does not matter; use a dedicated asio timer when it does.
+///
+/// The wheel stops ticking while no timers are pending, so an idle wheel costs
+/// nothing.
+///
+/// Lifetime: once a TimerWheel is destructed, all pending timers are dropped
+/// without running. The tick handler keeps a weak_ptr to the wheel, so it
+/// won't run after the wheel is destructed.
+class TimerWheel : public std::enable_shared_from_this<TimerWheel> {
+ public:
+  using TimerID = uint64_t;
+  static constexpr TimerID kInvalidTimerID = 0;
+
+  static std::shared_ptr<TimerWheel> Create(instrumented_io_context &io_service,
+                                            uint64_t resolution_ms,
+                                            size_t num_slots) {
+    // Sadly we can't use std::make_shared because the constructor is private.
+    return std::shared_ptr<TimerWheel>(
+        new TimerWheel(io_service, resolution_ms, num_slots));
+  }
+
+  ~TimerWheel();
+
+  /// Schedule `fn` to run once after `delay_ms`, rounded up to the wheel's
+  /// resolution.
+  ///
+  /// \param fn The callback to run. It runs on the io_context's thread.
+  /// \param delay_ms The minimum delay before the callback runs.
+  /// \return An id that can be passed to Cancel().
+  TimerID ScheduleAfter(std::function<void()> fn, uint64_t delay_ms)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  /// Cancel a pending timer.
+  ///
+  /// \param timer_id The id returned by ScheduleAfter().
+  /// \return True if the timer was pending and its callback will not run.
+  /// False if it already fired, was already cancelled, or never existed.
+  bool Cancel(TimerID timer_id) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  /// The number of timers that are scheduled but have not yet fired.
+  size_t NumPending() const ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  TimerWheel(instrumented_io_context &io_service,
+             uint64_t resolution_ms,
+             size_t num_slots);
+
+  /// Arm the underlying asio timer for the next tick, if it isn't armed
+  /// already. Called whenever a timer is added and at the end of each tick
+  /// while timers remain.
+  void ScheduleTick() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Advance the wheel by one slot and run all callbacks that became due.
+  void OnTick() ABSL_LOCKS_EXCLUDED(mutex_);
+
+  struct TimerEntry {
+    /// How many more full revolutions of the wheel before this entry is due.
+    uint64_t remaining_rounds;
+    std::function<void()> fn;
+  };
+
+  instrumented_io_context &io_service_;
+  const uint64_t resolution_ms_;
+  const size_t num_slots_;
+
+  mutable absl::Mutex mutex_;
+  /// The single shared timer that drives the wheel.
+  boost::asio::deadline_timer tick_timer_ ABSL_GUARDED_BY(mutex_);
+  /// Whether tick_timer_ is currently armed.
+  bool tick_scheduled_ ABSL_GUARDED_BY(mutex_) = false;
+  /// One bucket of pending timers per wheel slot.
+  std::vector<absl::flat_hash_map<TimerID, TimerEntry>> slots_ ABSL_GUARDED_BY(mutex_);
+  /// Maps a pending timer id to its slot, for O(1) cancellation.
+  absl::flat_hash_map<TimerID, size_t> timer_to_slot_ ABSL_GUARDED_BY(mutex_);
+  /// The slot that the next tick will expire.
+  size_t current_slot_ ABSL_GUARDED_BY(mutex_) = 0;
+  TimerID next_timer_id_ ABSL_GUARDED_BY(mutex_) = 1;
+};
+
+/// Schedule `fn` to run on `io_service` after `delay`. When `wheel` is
+/// non-null the timer is coalesced onto the wheel's shared tick; otherwise
+/// this falls back to a dedicated one-shot asio timer, exactly like
+/// execute_after().
+inline void execute_after_coalesced(instrumented_io_context &io_service,
+                                    const std::shared_ptr<TimerWheel> &wheel,
+                                    std::function<void()> fn,
+                                    std::chrono::milliseconds delay) {
+  if (wheel != nullptr) {
+    wheel->ScheduleAfter(std::move(fn), delay.count());
+  } else {
+    execute_after(io_service, std::move(fn), delay);
+  }
+}
+
+}  // namespace ray
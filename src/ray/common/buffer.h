@@ -170,4 +170,42 @@ class SharedMemoryBuffer : public Buffer {
   std::shared_ptr<Buffer> parent_;
 };
 
+/// Represents a byte buffer that aliases memory owned by another object, such
+/// as an RPC reply message, without copying it. The owning object is kept
+/// alive through shared ownership for the lifetime of the buffer.
+class SharedOwnerBuffer : public Buffer {
+ public:
+  /// Constructor.
+  ///
+  /// \param owner The object that owns the aliased memory. It is kept alive
+  /// for the lifetime of this buffer, so the data stays valid.
+  /// \param data The data pointer into memory owned by `owner`.
+  /// \param size The size of the buffer.
+  SharedOwnerBuffer(std::shared_ptr<const void> owner, const uint8_t *data, size_t size)
+      : owner_(std::move(owner)), data_(const_cast<uint8_t *>(data)), size_(size) {}
+
+  uint8_t *Data() const override { return data_; }
+
+  size_t Size() const override { return size_; }
+
+  /// The data is guaranteed to stay valid for the lifetime of this buffer,
+  /// which is what consumers use OwnsData to decide whether to copy.
+  bool OwnsData() const override { return true; }
+
+  bool IsPlasmaBuffer() const override { return false; }
+
+  ~SharedOwnerBuffer() override = default;
+
+  SharedOwnerBuffer &operator=(const SharedOwnerBuffer &) = delete;
+  SharedOwnerBuffer(const SharedOwnerBuffer &) = delete;
+
+ private:
+  /// Keeps the object that owns the aliased memory alive.
+  std::shared_ptr<const void> owner_;
+  /// Pointer to the data.
+  uint8_t *data_;
+  /// Size of the buffer.
+  size_t size_;
+};
+
 }  // namespace ray
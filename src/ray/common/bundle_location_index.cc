@@ -16,6 +16,10 @@
 
 namespace ray {
 
+namespace {
+constexpr size_t kBitsPerWord = 64;
+}  // namespace
+
 void BundleLocationIndex::AddBundleLocations(
     const PlacementGroupID &placement_group_id,
     std::shared_ptr<BundleLocations> bundle_locations) {
@@ -25,8 +29,19 @@ void BundleLocationIndex::AddBundleLocations(
   auto iter = placement_group_to_bundle_locations_.find(placement_group_id);
   if (iter == placement_group_to_bundle_locations_.end()) {
     placement_group_to_bundle_locations_.emplace(placement_group_id, bundle_locations);
+    for (const auto &bundle_iter : *bundle_locations) {
+      CompactAddBundle(
+          placement_group_id, bundle_iter.first.second, bundle_iter.second.first);
+    }
   } else {
-    iter->second->insert(bundle_locations->begin(), bundle_locations->end());
+    for (const auto &bundle_iter : *bundle_locations) {
+      // Like the insert above, merging never overwrites a bundle that is already
+      // placed; the compact index only records bundles that actually landed.
+      if (iter->second->emplace(bundle_iter.first, bundle_iter.second).second) {
+        CompactAddBundle(
+            placement_group_id, bundle_iter.first.second, bundle_iter.second.first);
+      }
+    }
   }
 
   // Update `node_to_leased_bundles_`.
@@ -63,6 +78,8 @@ void BundleLocationIndex::AddOrUpdateBundleLocation(
   }
   (*node_to_leased_bundles_[node_id])[bundle_id] =
       std::make_pair(node_id, bundle_specification);
+
+  CompactAddBundle(placement_group_id, bundle_id.second, node_id);
 }
 
 void BundleLocationIndex::AddOrUpdateBundleLocations(
@@ -92,6 +109,7 @@ bool BundleLocationIndex::Erase(const NodeID &node_id) {
         pg_bundle_locations->erase(pg_bundle_it);
       }
     }
+    CompactEraseBundle(placement_group_id, bundle_id.second);
   }
   node_to_leased_bundles_.erase(leased_bundles_it);
   return true;
@@ -111,6 +129,7 @@ bool BundleLocationIndex::Erase(const PlacementGroupID &placement_group_id) {
     EraseBundleInNodeMap(node_id, bundle_id);
   }
   placement_group_to_bundle_locations_.erase(it);
+  compact_locations_.erase(placement_group_id);
 
   return true;
 }
@@ -136,14 +155,48 @@ BundleLocationIndex::GetBundleLocationsOnNode(const NodeID &node_id) const {
 
 std::optional<NodeID> BundleLocationIndex::GetBundleLocation(
     const BundleID &bundle_id) const {
-  auto all_bundle_locations_opt = GetBundleLocations(bundle_id.first);
-  if (all_bundle_locations_opt) {
-    const auto &iter = (*all_bundle_locations_opt)->find(bundle_id);
-    if (iter != (*all_bundle_locations_opt)->end()) {
-      return std::make_optional(iter->second.first);
+  if (bundle_id.second < 0) {
+    // Negative bundle indexes are not representable in the dense array; fall back
+    // to the hash map lookup.
+    auto all_bundle_locations_opt = GetBundleLocations(bundle_id.first);
+    if (all_bundle_locations_opt) {
+      const auto &iter = (*all_bundle_locations_opt)->find(bundle_id);
+      if (iter != (*all_bundle_locations_opt)->end()) {
+        return std::make_optional(iter->second.first);
+      }
+    }
+    return std::nullopt;
+  }
+
+  auto it = compact_locations_.find(bundle_id.first);
+  if (it == compact_locations_.end()) {
+    return std::nullopt;
+  }
+  const auto &bundle_node_slots = it->second.bundle_node_slots;
+  const auto index = static_cast<size_t>(bundle_id.second);
+  if (index >= bundle_node_slots.size() || bundle_node_slots[index] == kNoNodeSlot) {
+    return std::nullopt;
+  }
+  return std::make_optional(interned_nodes_[bundle_node_slots[index]]);
+}
+
+void BundleLocationIndex::ForEachBundleNode(
+    const PlacementGroupID &placement_group_id,
+    const std::function<bool(const NodeID &)> &fn) const {
+  auto it = compact_locations_.find(placement_group_id);
+  if (it == compact_locations_.end()) {
+    return;
+  }
+  const auto &node_slot_bits = it->second.node_slot_bits;
+  for (size_t word_index = 0; word_index < node_slot_bits.size(); ++word_index) {
+    uint64_t word = node_slot_bits[word_index];
+    for (size_t bit = 0; word != 0; ++bit, word >>= 1) {
+      if ((word & 1) != 0 &&
+          !fn(interned_nodes_[word_index * kBitsPerWord + bit])) {
+        return;
+      }
     }
   }
-  return std::nullopt;
 }
 
 void BundleLocationIndex::AddNodes(
@@ -193,6 +246,73 @@ std::string BundleLocationIndex::DebugString() const {
   return ostr.str();
 }
 
+int32_t BundleLocationIndex::InternNode(const NodeID &node_id) {
+  auto it = node_to_slot_.find(node_id);
+  if (it != node_to_slot_.end()) {
+    return it->second;
+  }
+  const auto slot = static_cast<int32_t>(interned_nodes_.size());
+  interned_nodes_.push_back(node_id);
+  node_to_slot_.emplace(node_id, slot);
+  return slot;
+}
+
+void BundleLocationIndex::CompactAddBundle(const PlacementGroupID &placement_group_id,
+                                           int64_t bundle_index,
+                                           const NodeID &node_id) {
+  if (bundle_index < 0) {
+    return;
+  }
+  auto &compact = compact_locations_[placement_group_id];
+  const auto index = static_cast<size_t>(bundle_index);
+  if (index >= compact.bundle_node_slots.size()) {
+    compact.bundle_node_slots.resize(index + 1, kNoNodeSlot);
+  }
+  const int32_t slot = InternNode(node_id);
+  auto &placed_slot = compact.bundle_node_slots[index];
+  if (placed_slot == slot) {
+    return;
+  }
+  if (placed_slot != kNoNodeSlot) {
+    // The bundle moved; drop it from its previous node first.
+    const auto old_slot = static_cast<size_t>(placed_slot);
+    if (--compact.node_slot_bundle_counts[old_slot] == 0) {
+      compact.node_slot_bits[old_slot / kBitsPerWord] &=
+          ~(uint64_t{1} << (old_slot % kBitsPerWord));
+    }
+  }
+  placed_slot = slot;
+  const auto slot_index = static_cast<size_t>(slot);
+  if (slot_index >= compact.node_slot_bundle_counts.size()) {
+    compact.node_slot_bundle_counts.resize(slot_index + 1, 0);
+    compact.node_slot_bits.resize(slot_index / kBitsPerWord + 1, 0);
+  }
+  if (compact.node_slot_bundle_counts[slot_index]++ == 0) {
+    compact.node_slot_bits[slot_index / kBitsPerWord] |=
+        uint64_t{1} << (slot_index % kBitsPerWord);
+  }
+}
+
+void BundleLocationIndex::CompactEraseBundle(const PlacementGroupID &placement_group_id,
+                                             int64_t bundle_index) {
+  auto it = compact_locations_.find(placement_group_id);
+  if (it == compact_locations_.end() || bundle_index < 0) {
+    return;
+  }
+  auto &compact = it->second;
+  const auto index = static_cast<size_t>(bundle_index);
+  if (index >= compact.bundle_node_slots.size() ||
+      compact.bundle_node_slots[index] == kNoNodeSlot) {
+    return;
+  }
+  const auto slot = static_cast<size_t>(compact.bundle_node_slots[index]);
+  compact.bundle_node_slots[index] = kNoNodeSlot;
+  if (--compact.node_slot_bundle_counts[slot] == 0) {
+    compact.node_slot_bits[slot / kBitsPerWord] &=
+        ~(uint64_t{1} << (slot % kBitsPerWord));
+  }
+}
+
 void BundleLocationIndex::EraseBundleInNodeMap(const NodeID &node_id,
                                                const BundleID &bundle_id) {
   const auto &node_bundles_it = node_to_leased_bundles_.find(node_id);
@@ -13,6 +13,10 @@
 // limitations under the License.
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include "absl/container/flat_hash_map.h"
 #include "ray/common/id.h"
 #include "ray/common/placement_group.h"
@@ -77,6 +81,18 @@ class BundleLocationIndex {
       const NodeID &node_id) const;
 
   std::optional<NodeID> GetBundleLocation(const BundleID &bundle_id) const;
+
+  /// Iterate the distinct nodes that currently host bundles of the given placement
+  /// group, invoking `fn` for each until it returns false. This is backed by the
+  /// compact per-group index, so the scheduling hot loop scans a few contiguous
+  /// words instead of walking a per-bundle hash map (and never visits the same
+  /// node twice).
+  ///
+  /// \param placement_group_id Placement group whose nodes to visit.
+  /// \param fn Callback invoked per node; return false to stop early.
+  void ForEachBundleNode(const PlacementGroupID &placement_group_id,
+                         const std::function<bool(const NodeID &)> &fn) const;
+
   /// Update the index to contain new node information. Should be used only when new node
   /// is added to the cluster.
   ///
@@ -92,6 +108,35 @@ class BundleLocationIndex {
   std::string DebugString() const;
 
  private:
+  /// Compact, cache-friendly mirror of `placement_group_to_bundle_locations_`.
+  /// Node ids are interned into small integer slots; each placement group keeps a
+  /// dense array of node slots indexed by bundle index plus a bitset over the
+  /// slots it occupies, so point lookups and node iteration stay cache-resident.
+  struct CompactPlacementGroupLocations {
+    /// Node slot per bundle index; kNoNodeSlot when the bundle is not placed.
+    std::vector<int32_t> bundle_node_slots;
+    /// Number of placed bundles per node slot.
+    std::vector<uint32_t> node_slot_bundle_counts;
+    /// One bit per node slot that hosts at least one bundle of this group.
+    std::vector<uint64_t> node_slot_bits;
+  };
+
+  static constexpr int32_t kNoNodeSlot = -1;
+
+  /// Return the slot of `node_id`, assigning the next free one on first use.
+  /// Slots are never recycled; the table is bounded by the nodes ever seen.
+  int32_t InternNode(const NodeID &node_id);
+
+  /// Record in the compact index that the bundle is placed on `node_id`,
+  /// dropping any previous placement of the same bundle first.
+  void CompactAddBundle(const PlacementGroupID &placement_group_id,
+                        int64_t bundle_index,
+                        const NodeID &node_id);
+
+  /// Remove the bundle's placement from the compact index, if any.
+  void CompactEraseBundle(const PlacementGroupID &placement_group_id,
+                          int64_t bundle_index);
+
   /// only erase bundle in node_to_leased_bundles_
   void EraseBundleInNodeMap(const NodeID &node_id, const BundleID &bundle_id);
   /// Map from node ID to the set of bundles. This is used to lookup bundles at each node
@@ -103,6 +148,16 @@ class BundleLocationIndex {
   /// NOTE: It is a reverse index of `node_to_leased_bundles`.
   absl::flat_hash_map<PlacementGroupID, std::shared_ptr<BundleLocations>>
       placement_group_to_bundle_locations_;
+
+  /// Interned node ids, indexed by slot.
+  std::vector<NodeID> interned_nodes_;
+
+  /// Reverse map of `interned_nodes_`.
+  absl::flat_hash_map<NodeID, int32_t> node_to_slot_;
+
+  /// Per placement group compact placement state.
+  absl::flat_hash_map<PlacementGroupID, CompactPlacementGroupLocations>
+      compact_locations_;
 };
 
 }  // namespace ray
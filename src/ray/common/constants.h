@@ -83,6 +83,12 @@ constexpr char kGcsAutoscalerStateNamespace[] = "__autoscaler";
 constexpr char kGcsAutoscalerV2EnabledKey[] = "__autoscaler_v2_enabled";
 constexpr char kGcsAutoscalerClusterConfigKey[] = "__autoscaler_cluster_config";
 
+/// The internal KV namespace and key under which runtime config overrides are
+/// published to the cluster. See RayConfig::ApplyOverrides and
+/// RayConfig::dynamic_config_enabled.
+constexpr char kDynamicConfigNamespace[] = "__dynamic_config";
+constexpr char kDynamicConfigOverridesKey[] = "config_overrides";
+
 /// Name for cloud instance id env
 constexpr char kNodeCloudInstanceIdEnv[] = "RAY_CLOUD_INSTANCE_ID";
 
@@ -25,20 +25,20 @@
 
 namespace {
 
-/// A helper for creating a snapshot view of the global stats.
-/// This acquires a reader lock on the provided global stats, and creates a
-/// lockless copy of the stats.
-GlobalStats to_global_stats_view(std::shared_ptr<GuardedGlobalStats> stats) {
-  absl::MutexLock lock(&(stats->mutex));
-  return GlobalStats(stats->stats);
+/// Lower `target` to `value` if `value` is smaller, without locking.
+void AtomicFetchMin(std::atomic<int64_t> &target, int64_t value) {
+  int64_t current = target.load(std::memory_order_relaxed);
+  while (value < current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
 }
 
-/// A helper for creating a snapshot view of the stats for a event.
-/// This acquires a lock on the provided guarded event stats, and creates a
-/// lockless copy of the stats.
-EventStats to_event_stats_view(std::shared_ptr<GuardedEventStats> stats) {
-  absl::MutexLock lock(&(stats->mutex));
-  return EventStats(stats->stats);
+/// Raise `target` to `value` if `value` is larger, without locking.
+void AtomicFetchMax(std::atomic<int64_t> &target, int64_t value) {
+  int64_t current = target.load(std::memory_order_relaxed);
+  while (value > current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
 }
 
 /// Convert the duration in nanoseconds to a string of the format: X.YZms.
@@ -51,18 +51,34 @@ std::string to_ms_str(double duration_ns) {
 
 }  // namespace
 
+EventStats AtomicEventStats::ToView() const {
+  EventStats view;
+  view.cum_count = cum_count.load(std::memory_order_relaxed);
+  view.curr_count = curr_count.load(std::memory_order_relaxed);
+  view.cum_execution_time = cum_execution_time.load(std::memory_order_relaxed);
+  view.cum_queue_time = cum_queue_time.load(std::memory_order_relaxed);
+  view.min_queue_time = min_queue_time.load(std::memory_order_relaxed);
+  view.max_queue_time = max_queue_time.load(std::memory_order_relaxed);
+  view.running_count = running_count.load(std::memory_order_relaxed);
+  return view;
+}
+
+GlobalStats AtomicGlobalStats::ToView() const {
+  GlobalStats view;
+  view.cum_queue_time = cum_queue_time.load(std::memory_order_relaxed);
+  view.min_queue_time = min_queue_time.load(std::memory_order_relaxed);
+  view.max_queue_time = max_queue_time.load(std::memory_order_relaxed);
+  return view;
+}
+
 std::shared_ptr<StatsHandle> EventTracker::RecordStart(
     std::string name,
     bool emit_metrics,
     const int64_t expected_queueing_delay_ns,
     const std::optional<std::string> &event_context_name) {
   auto stats = GetOrCreate(name);
-  int64_t curr_count = 0;
-  {
-    absl::MutexLock lock(&(stats->mutex));
-    ++stats->stats.cum_count;
-    curr_count = ++stats->stats.curr_count;
-  }
+  stats->cum_count.fetch_add(1, std::memory_order_relaxed);
+  const int64_t curr_count = stats->curr_count.fetch_add(1, std::memory_order_relaxed) + 1;
 
   if (emit_metrics) {
     operation_count_metric_.Record(1, {{"Name", event_context_name.value_or(name)}});
@@ -81,10 +97,11 @@ std::shared_ptr<StatsHandle> EventTracker::RecordStart(
 
 void EventTracker::RecordEnd(std::shared_ptr<StatsHandle> handle) {
   RAY_CHECK(!handle->end_or_execution_recorded);
-  absl::MutexLock lock(&(handle->handler_stats->mutex));
-  const auto curr_count = --handle->handler_stats->stats.curr_count;
+  const auto curr_count =
+      handle->handler_stats->curr_count.fetch_sub(1, std::memory_order_relaxed) - 1;
   const auto execution_time_ns = ray::current_time_ns() - handle->start_time;
-  handle->handler_stats->stats.cum_execution_time += execution_time_ns;
+  handle->handler_stats->cum_execution_time.fetch_add(execution_time_ns,
+                                                      std::memory_order_relaxed);
 
   if (handle->emit_stats) {
     // Update event-specific stats.
@@ -103,35 +120,24 @@ void EventTracker::RecordExecution(const std::function<void()> &fn,
   RAY_CHECK(!handle->end_or_execution_recorded);
   int64_t start_execution = ray::current_time_ns();
   // Update running count
-  {
-    auto &stats = handle->handler_stats;
-    absl::MutexLock lock(&(stats->mutex));
-    stats->stats.running_count++;
-  }
+  handle->handler_stats->running_count.fetch_add(1, std::memory_order_relaxed);
   // Execute actual function.
   fn();
   int64_t end_execution = ray::current_time_ns();
   // Update execution time stats.
   const auto execution_time_ns = end_execution - start_execution;
-  int64_t curr_count;
   const auto queue_time_ns = start_execution - handle->start_time;
-  {
-    auto &stats = handle->handler_stats;
-    absl::MutexLock lock(&(stats->mutex));
-    // Event-specific execution stats.
-    stats->stats.cum_execution_time += execution_time_ns;
-    stats->stats.cum_queue_time += queue_time_ns;
-    if (stats->stats.min_queue_time > queue_time_ns) {
-      stats->stats.min_queue_time = queue_time_ns;
-    }
-    if (stats->stats.max_queue_time < queue_time_ns) {
-      stats->stats.max_queue_time = queue_time_ns;
-    }
-    // Event-specific current count.
-    curr_count = --stats->stats.curr_count;
-    // Event-specific running count.
-    stats->stats.running_count--;
-  }
+  auto &stats = *handle->handler_stats;
+  // Event-specific execution stats.
+  stats.cum_execution_time.fetch_add(execution_time_ns, std::memory_order_relaxed);
+  stats.cum_queue_time.fetch_add(queue_time_ns, std::memory_order_relaxed);
+  AtomicFetchMin(stats.min_queue_time, queue_time_ns);
+  AtomicFetchMax(stats.max_queue_time, queue_time_ns);
+  // Event-specific current count.
+  const int64_t curr_count =
+      stats.curr_count.fetch_sub(1, std::memory_order_relaxed) - 1;
+  // Event-specific running count.
+  stats.running_count.fetch_sub(1, std::memory_order_relaxed);
 
   if (handle->emit_stats) {
     // Update event-specific stats.
@@ -146,24 +152,18 @@ void EventTracker::RecordExecution(const std::function<void()> &fn,
         {{"Name", handle->context_name.value_or(handle->event_name)}});
   }
 
-  {
-    auto global_stats = handle->global_stats;
-    absl::MutexLock lock(&(global_stats->mutex));
-    // Global queue stats.
-    global_stats->stats.cum_queue_time += queue_time_ns;
-    if (global_stats->stats.min_queue_time > queue_time_ns) {
-      global_stats->stats.min_queue_time = queue_time_ns;
-    }
-    if (global_stats->stats.max_queue_time < queue_time_ns) {
-      global_stats->stats.max_queue_time = queue_time_ns;
-    }
-  }
+  // Global queue stats.
+  auto &global_stats = *handle->global_stats;
+  global_stats.cum_queue_time.fetch_add(queue_time_ns, std::memory_order_relaxed);
+  AtomicFetchMin(global_stats.min_queue_time, queue_time_ns);
+  AtomicFetchMax(global_stats.max_queue_time, queue_time_ns);
+
   handle->end_or_execution_recorded = true;
 }
 
-std::shared_ptr<GuardedEventStats> EventTracker::GetOrCreate(const std::string &name) {
+std::shared_ptr<AtomicEventStats> EventTracker::GetOrCreate(const std::string &name) {
   // Get this event's stats.
-  std::shared_ptr<GuardedEventStats> result;
+  std::shared_ptr<AtomicEventStats> result;
   mutex_.ReaderLock();
   auto it = post_handler_stats_.find(name);
   if (it == post_handler_stats_.end()) {
@@ -174,7 +174,7 @@ std::shared_ptr<GuardedEventStats> EventTracker::GetOrCreate(const std::string &
     // to only require the readers lock.
     absl::WriterMutexLock lock(&mutex_);
     const auto pair =
-        post_handler_stats_.try_emplace(name, std::make_shared<GuardedEventStats>());
+        post_handler_stats_.try_emplace(name, std::make_shared<AtomicEventStats>());
     it = pair.first;
     result = it->second;
   } else {
@@ -184,9 +184,7 @@ std::shared_ptr<GuardedEventStats> EventTracker::GetOrCreate(const std::string &
   return result;
 }
 
-GlobalStats EventTracker::get_global_stats() const {
-  return to_global_stats_view(global_stats_);
-}
+GlobalStats EventTracker::get_global_stats() const { return global_stats_->ToView(); }
 
 // Testing only method
 std::optional<EventStats> EventTracker::get_event_stats(
@@ -196,7 +194,7 @@ std::optional<EventStats> EventTracker::get_event_stats(
   if (it == post_handler_stats_.end()) {
     return {};
   }
-  return to_event_stats_view(it->second);
+  return it->second->ToView();
 }
 
 // Logging only method
@@ -208,8 +206,8 @@ std::vector<std::pair<std::string, EventStats>> EventTracker::get_event_stats()
   std::transform(post_handler_stats_.begin(),
                  post_handler_stats_.end(),
                  std::back_inserter(stats),
-                 [](const std::pair<std::string, std::shared_ptr<GuardedEventStats>> &p) {
-                   return std::make_pair(p.first, to_event_stats_view(p.second));
+                 [](const std::pair<std::string, std::shared_ptr<AtomicEventStats>> &p) {
+                   return std::make_pair(p.first, p.second->ToView());
                  });
   return stats;
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <limits>
 
 #include "absl/container/flat_hash_map.h"
@@ -22,7 +23,8 @@
 #include "ray/common/ray_config.h"
 #include "ray/util/logging.h"
 
-/// Count, queueing, and execution statistics for a given event.
+/// A snapshot view of the count, queueing, and execution statistics for a
+/// given event.
 struct EventStats {
   // Counts.
   int64_t cum_count = 0;
@@ -36,7 +38,7 @@ struct EventStats {
   int64_t running_count = 0;
 };
 
-/// Count and queueing statistics over all events.
+/// A snapshot view of the count and queueing statistics over all events.
 struct GlobalStats {
   // Queue stats.
   int64_t cum_queue_time = 0;
@@ -44,34 +46,43 @@ struct GlobalStats {
   int64_t max_queue_time = -1;
 };
 
-/// A mutex wrapper around a handler stats struct.
-struct GuardedEventStats {
-  // Stats for some handler.
-  EventStats stats ABSL_GUARDED_BY(mutex);
+/// Live stats for some handler, updated with relaxed atomic operations so the
+/// post/execute hot paths never take a lock. The individual counters are
+/// independently consistent but a snapshot is not an atomic view across
+/// fields, which is fine for the logging and metrics this feeds.
+struct AtomicEventStats {
+  // Counts.
+  std::atomic<int64_t> cum_count{0};
+  std::atomic<int64_t> curr_count{0};
 
-  // The mutex protecting the reading and writing of these stats.
-  // This mutex should be acquired with a reader lock before reading, and should be
-  // acquired with a writer lock before writing.
-  mutable absl::Mutex mutex;
+  // Execution stats.
+  std::atomic<int64_t> cum_execution_time{0};
+  std::atomic<int64_t> cum_queue_time{0};
+  std::atomic<int64_t> min_queue_time{std::numeric_limits<int64_t>::max()};
+  std::atomic<int64_t> max_queue_time{-1};
+  std::atomic<int64_t> running_count{0};
+
+  /// Create a lockless snapshot view of these stats.
+  EventStats ToView() const;
 };
 
-/// A mutex wrapper around a handler stats struct.
-struct GuardedGlobalStats {
-  // Stats over all handlers.
-  GlobalStats stats ABSL_GUARDED_BY(mutex);
+/// Live stats over all handlers, updated with relaxed atomic operations.
+struct AtomicGlobalStats {
+  // Queue stats.
+  std::atomic<int64_t> cum_queue_time{0};
+  std::atomic<int64_t> min_queue_time{std::numeric_limits<int64_t>::max()};
+  std::atomic<int64_t> max_queue_time{-1};
 
-  // The mutex protecting the reading and writing of these stats.
-  // This mutex should be acquired with a reader lock before reading, and should be
-  // acquired with a writer lock before writing.
-  mutable absl::Mutex mutex;
+  /// Create a lockless snapshot view of these stats.
+  GlobalStats ToView() const;
 };
 
 /// An opaque stats handle, used to manually instrument event handlers.
 struct StatsHandle {
   const std::string event_name;
   const int64_t start_time;
-  const std::shared_ptr<GuardedEventStats> handler_stats;
-  const std::shared_ptr<GuardedGlobalStats> global_stats;
+  const std::shared_ptr<AtomicEventStats> handler_stats;
+  const std::shared_ptr<AtomicGlobalStats> global_stats;
   // Whether RecordEnd or RecordExecution is called.
   std::atomic<bool> end_or_execution_recorded;
   // Metric emission specific configurations
@@ -80,8 +91,8 @@ struct StatsHandle {
 
   StatsHandle(std::string event_name_,
               const int64_t start_time_,
-              std::shared_ptr<GuardedEventStats> handler_stats_,
-              std::shared_ptr<GuardedGlobalStats> global_stats_,
+              std::shared_ptr<AtomicEventStats> handler_stats_,
+              std::shared_ptr<AtomicGlobalStats> global_stats_,
               const bool emit_stats_,
               const std::optional<std::string> &context_name_)
       : event_name(std::move(event_name_)),
@@ -96,8 +107,7 @@ struct StatsHandle {
     if (!end_or_execution_recorded) {
       // If handler execution was never recorded, we need to clean up some queueing
       // stats in order to prevent those stats from leaking.
-      absl::MutexLock lock(&(handler_stats->mutex));
-      handler_stats->stats.curr_count--;
+      handler_stats->curr_count.fetch_sub(1, std::memory_order_relaxed);
     }
   }
 };
@@ -105,7 +115,7 @@ struct StatsHandle {
 class EventTracker {
  public:
   /// Initializes the global stats struct after calling the base constructor.
-  EventTracker() : global_stats_(std::make_shared<GuardedGlobalStats>()) {}
+  EventTracker() : global_stats_(std::make_shared<AtomicGlobalStats>()) {}
 
   /// Sets the queueing start time, increments the current and cumulative counts and
   /// returns an opaque handle for these stats. This is used in conjunction with
@@ -172,16 +182,16 @@ class EventTracker {
 
  private:
   using EventStatsTable =
-      absl::flat_hash_map<std::string, std::shared_ptr<GuardedEventStats>>;
-  /// Get the mutex-guarded stats for this event if it exists, otherwise create the
+      absl::flat_hash_map<std::string, std::shared_ptr<AtomicEventStats>>;
+  /// Get the stats for this event if it exists, otherwise create the
   /// stats for this handler and return an iterator pointing to it.
   ///
   /// \param name A human-readable name for the handler, to be used for viewing stats
   /// for the provided handler.
-  std::shared_ptr<GuardedEventStats> GetOrCreate(const std::string &name);
+  std::shared_ptr<AtomicEventStats> GetOrCreate(const std::string &name);
 
   /// Global stats, across all handlers.
-  std::shared_ptr<GuardedGlobalStats> global_stats_;
+  std::shared_ptr<AtomicGlobalStats> global_stats_;
 
   /// Table of per-handler post stats.
   /// We use a std::shared_ptr value in order to ensure pointer stability.
@@ -14,9 +14,47 @@
 
 #include "ray/common/function_descriptor.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/util/logging.h"
 
 namespace ray {
+
+namespace {
+
+// Process-wide registry assigning a dense id to each distinct function
+// descriptor equality class. Entries are never removed; the number of
+// distinct descriptors in a process is bounded by the number of remote
+// functions and actor methods it calls.
+absl::Mutex intern_mutex;
+absl::flat_hash_map<std::string, uint64_t> &InternRegistry()
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(intern_mutex) {
+  static auto *registry = new absl::flat_hash_map<std::string, uint64_t>();
+  return *registry;
+}
+
+}  // namespace
+
+uint64_t FunctionDescriptorInterface::InternId() const {
+  uint64_t id = intern_id_.load(std::memory_order_relaxed);
+  if (id != 0) {
+    return id;
+  }
+  // The type tag disambiguates descriptors of different languages whose
+  // field encodings would otherwise collide.
+  std::string key = InternKey();
+  key += '\0';
+  key += std::to_string(static_cast<int>(Type()));
+  {
+    absl::MutexLock lock(&intern_mutex);
+    auto &registry = InternRegistry();
+    // Ids start at 1 so that 0 can mean "not resolved yet".
+    id = registry.emplace(std::move(key), registry.size() + 1).first->second;
+  }
+  intern_id_.store(id, std::memory_order_relaxed);
+  return id;
+}
+
 FunctionDescriptor FunctionDescriptorBuilder::Empty() {
   static ray::FunctionDescriptor empty =
       ray::FunctionDescriptor(new EmptyFunctionDescriptor());
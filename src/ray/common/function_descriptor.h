@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 #include "absl/strings/str_format.h"
@@ -44,6 +46,20 @@ class FunctionDescriptorInterface : public MessageWrapper<rpc::FunctionDescripto
 
   virtual size_t Hash() const = 0;
 
+  /// A process-wide id interned for this descriptor's equality class: two
+  /// descriptors carry the same id if and only if they compare equal. The id
+  /// is resolved once per descriptor object and memoized, so repeated
+  /// scheduling-class hashing and equality checks are O(1) instead of
+  /// re-hashing and re-comparing the underlying descriptor strings.
+  uint64_t InternId() const;
+
+  /// Whether InternId() has already been resolved for this object. Used to
+  /// take the O(1) equality fast path without forcing one-off comparisons to
+  /// pay the interning cost.
+  bool HasInternId() const {
+    return intern_id_.load(std::memory_order_relaxed) != 0;
+  }
+
   // DO NOT define operator==() or operator!=() in the base class.
   // Let the derived classes define and implement.
   // This is to avoid unexpected behaviors when comparing function descriptors of
@@ -68,6 +84,16 @@ class FunctionDescriptorInterface : public MessageWrapper<rpc::FunctionDescripto
   Subtype *As() {
     return reinterpret_cast<Subtype *>(this);
   }
+
+ protected:
+  /// The fields that participate in equality for this descriptor type,
+  /// encoded so that two descriptors of the same type compare equal if and
+  /// only if their keys match. Used by InternId() to resolve the registry id.
+  virtual std::string InternKey() const = 0;
+
+ private:
+  /// Lazily resolved by InternId(); 0 means not resolved yet.
+  mutable std::atomic<uint64_t> intern_id_ = 0;
 };
 
 class EmptyFunctionDescriptor : public FunctionDescriptorInterface {
@@ -94,6 +120,9 @@ class EmptyFunctionDescriptor : public FunctionDescriptorInterface {
   virtual std::string ClassName() const { return ""; }
 
   virtual std::string CallString() const { return ""; }
+
+ protected:
+  virtual std::string InternKey() const { return ""; }
 };
 
 class JavaFunctionDescriptor : public FunctionDescriptorInterface {
@@ -149,6 +178,16 @@ class JavaFunctionDescriptor : public FunctionDescriptorInterface {
 
   const std::string &Signature() const { return typed_message_->signature(); }
 
+ protected:
+  virtual std::string InternKey() const {
+    std::string key = typed_message_->class_name();
+    key += '\0';
+    key += typed_message_->function_name();
+    key += '\0';
+    key += typed_message_->signature();
+    return key;
+  }
+
  private:
   const rpc::JavaFunctionDescriptor *typed_message_;
 };
@@ -219,6 +258,18 @@ class PythonFunctionDescriptor : public FunctionDescriptorInterface {
 
   const std::string &FunctionHash() const { return typed_message_->function_hash(); }
 
+ protected:
+  virtual std::string InternKey() const {
+    std::string key = typed_message_->module_name();
+    key += '\0';
+    key += typed_message_->class_name();
+    key += '\0';
+    key += typed_message_->function_name();
+    key += '\0';
+    key += typed_message_->function_hash();
+    return key;
+  }
+
  private:
   const rpc::PythonFunctionDescriptor *typed_message_;
 };
@@ -270,6 +321,15 @@ class CppFunctionDescriptor : public FunctionDescriptorInterface {
 
   const std::string &Caller() const { return typed_message_->caller(); }
 
+ protected:
+  // `caller` is deliberately excluded, matching Hash() and operator==().
+  virtual std::string InternKey() const {
+    std::string key = typed_message_->function_name();
+    key += '\0';
+    key += typed_message_->class_name();
+    return key;
+  }
+
  private:
   const rpc::CppFunctionDescriptor *typed_message_;
 };
@@ -286,6 +346,13 @@ inline bool operator==(const FunctionDescriptor &left, const FunctionDescriptor
   if (left->Type() != right->Type()) {
     return false;
   }
+  // Interned ids give O(1) equality once both sides have been resolved (the
+  // common case on hot scheduling paths, where hashing resolves them). Fall
+  // through to the field comparisons otherwise, so one-off comparisons don't
+  // pay the interning cost.
+  if (left->HasInternId() && right->HasInternId()) {
+    return left->InternId() == right->InternId();
+  }
   switch (left->Type()) {
   case ray::FunctionDescriptorType::FUNCTION_DESCRIPTOR_NOT_SET:
     return static_cast<const EmptyFunctionDescriptor &>(*left) ==
@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <msgpack.hpp>
 #include <string>
+#include <utility>
 
 #include "ray/common/constants.h"
 #include "ray/util/logging.h"
@@ -68,6 +70,14 @@ class BaseID {
   std::string Binary() const;
   std::string Hex() const;
 
+  /// absl::Hash support. Feeds the cached hash instead of rehashing the id
+  /// bytes, so absl containers reuse the lazily computed MurmurHash the same
+  /// way std::hash-based ones do.
+  template <typename H>
+  friend H AbslHashValue(H h, const BaseID &id) {
+    return H::combine(std::move(h), id.Hash());
+  }
+
  protected:
   BaseID(const std::string &binary) {
     if (!binary.empty()) {
@@ -501,7 +511,27 @@ size_t BaseID<T>::Hash() const {
 
 template <typename T>
 bool BaseID<T>::operator==(const BaseID &rhs) const {
-  return std::memcmp(Data(), rhs.Data(), T::Size()) == 0;
+  // Compare as unaligned 64-bit words rather than calling memcmp. Size() is a
+  // compile-time constant, so the loops fully unroll and the compiler emits a
+  // few wide (SSE/NEON where profitable) loads and compares with no libcall.
+  const uint8_t *lhs_data = Data();
+  const uint8_t *rhs_data = rhs.Data();
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= T::Size(); i += sizeof(uint64_t)) {
+    uint64_t lhs_word;
+    uint64_t rhs_word;
+    std::memcpy(&lhs_word, lhs_data + i, sizeof(uint64_t));
+    std::memcpy(&rhs_word, rhs_data + i, sizeof(uint64_t));
+    if (lhs_word != rhs_word) {
+      return false;
+    }
+  }
+  for (; i < T::Size(); i++) {
+    if (lhs_data[i] != rhs_data[i]) {
+      return false;
+    }
+  }
+  return true;
 }
 
 template <typename T>
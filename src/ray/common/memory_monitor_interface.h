@@ -48,12 +48,16 @@ struct SystemMemorySnapshot {
 using ProcessesMemorySnapshot = absl::flat_hash_map<pid_t, int64_t>;
 
 /**
- * @brief Callback that runs at each monitoring interval.
+ * @brief Callback that runs when the monitor detects memory pressure.
  *
  * \param system_memory snapshot of system memory information.
+ * \param process_memory snapshot of per-process memory usage, taken on the
+ *        monitor's sampling thread so the receiver does not have to scan
+ *        /proc while the node is under memory pressure.
  */
 using KillWorkersCallback =
-    std::function<void(const SystemMemorySnapshot &system_memory)>;
+    std::function<void(const SystemMemorySnapshot &system_memory,
+                       const ProcessesMemorySnapshot &process_memory)>;
 
 /**
  * @brief implementations of this interface monitors the memory usage of the node
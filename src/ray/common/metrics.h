@@ -86,6 +86,18 @@ inline ray::stats::Histogram GetSchedulerPlacementTimeMsHistogramMetric() {
   };
 }
 
+inline ray::stats::Histogram GetGcsRpcStageTimeMsHistogramMetric() {
+  return ray::stats::Histogram{
+      /*name=*/"gcs_rpc_stage_time_ms",
+      /*description=*/
+      "Per-stage latency of sampled GCS RPCs (handler, storage, publish). "
+      "Only populated when gcs_request_trace_sample_rate > 0.",
+      /*unit=*/"ms",
+      /*boundaries=*/{1, 10, 100, 1000, 10000},
+      /*tag_keys=*/{"Method", "Stage"},
+  };
+}
+
 inline ray::stats::Gauge GetIoContextEventLoopLagMsGaugeMetric() {
   return ray::stats::Gauge{
       /*name=*/"io_context_event_loop_lag_ms",
@@ -133,4 +145,17 @@ inline ray::stats::Gauge GetOperationActiveCountGaugeMetric() {
   };
 }
 
+inline ray::stats::Gauge GetMemoryTelemetryEstimatedBytesGaugeMetric() {
+  return ray::stats::Gauge{
+      /*name=*/"memory_telemetry_estimated_bytes",
+      /*description=*/
+      "Estimated live heap bytes attributed to each subsystem memory tag, "
+      "derived from sampled allocation attribution. Only exported when "
+      "memory_telemetry_enabled is set.",
+      /*unit=*/"",
+      // Tag: the subsystem memory tag name, see ray::MemoryTag.
+      /*tag_keys=*/{"Tag"},
+  };
+}
+
 }  // namespace ray
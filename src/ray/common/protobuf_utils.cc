@@ -324,6 +324,21 @@ size_t NumProfileEvents(const rpc::TaskEvents &task_event) {
   return static_cast<size_t>(task_event.profile_events().events_size());
 }
 
+rpc::TaskStatus GetLatestTaskStatus(const rpc::TaskEvents &task_event) {
+  if (!task_event.has_state_updates()) {
+    return rpc::TaskStatus::NIL;
+  }
+
+  const auto *task_status_descriptor = rpc::TaskStatus_descriptor();
+  for (int i = task_status_descriptor->value_count() - 1; i >= 0; --i) {
+    if (task_event.state_updates().state_ts_ns().contains(
+            task_status_descriptor->value(i)->number())) {
+      return static_cast<rpc::TaskStatus>(task_status_descriptor->value(i)->number());
+    }
+  }
+  return rpc::TaskStatus::NIL;
+}
+
 TaskAttempt GetTaskAttempt(const rpc::TaskEvents &task_event) {
   return std::make_pair(TaskID::FromBinary(task_event.task_id()),
                         task_event.attempt_number());
@@ -117,6 +117,13 @@ bool IsTaskTerminated(const rpc::TaskEvents &task_event);
 
 size_t NumProfileEvents(const rpc::TaskEvents &task_event);
 
+/// Return the latest status of a task attempt, i.e. the most advanced
+/// rpc::TaskStatus that has a recorded state transition timestamp.
+///
+/// \param task_event Task event.
+/// \return rpc::TaskStatus::NIL if no state transition is recorded.
+rpc::TaskStatus GetLatestTaskStatus(const rpc::TaskEvents &task_event);
+
 TaskAttempt GetTaskAttempt(const rpc::TaskEvents &task_event);
 
 bool IsActorTask(const rpc::TaskEvents &task_event);
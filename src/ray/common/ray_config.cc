@@ -14,8 +14,12 @@
 
 #include "ray/common/ray_config.h"
 
+#include <functional>
 #include <sstream>
+#include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
@@ -76,3 +80,93 @@ void RayConfig::initialize(const std::string &config_list) {
                    << " The config string is: " << config_list;
   }
 }
+
+std::vector<std::string> RayConfig::ApplyOverrides(const std::string &config_list) {
+  std::vector<std::string> changed;
+  if (config_list.empty()) {
+    return changed;
+  }
+
+  json config_map;
+  try {
+    config_map = json::parse(config_list);
+  } catch (json::exception &ex) {
+    RAY_LOG(ERROR) << "Ignoring dynamic config overrides that failed to parse: "
+                   << ex.what() << " The config string is: " << config_list;
+    return changed;
+  }
+
+/// -----------Include ray_config_def.h to override config items.--------------
+/// A helper macro that applies an override to a config item, recording the
+/// name if the value actually changed. Unlike initialize(), an unparsable
+/// value only skips that item.
+#define RAY_CONFIG(type, name, default_value)                         \
+  if (pair.key() == #name) {                                          \
+    try {                                                             \
+      auto new_value = pair.value().get<type>();                      \
+      if (!(name##_ == new_value)) {                                  \
+        name##_ = std::move(new_value);                               \
+        changed.push_back(#name);                                     \
+      }                                                               \
+    } catch (json::exception & ex) {                                  \
+      RAY_LOG(ERROR) << "Ignoring dynamic override for config " #name \
+                     << " with invalid value: " << ex.what();         \
+    }                                                                 \
+    continue;                                                         \
+  }
+
+  for (const auto &pair : config_map.items()) {
+#include "ray/common/ray_config_def.h"
+    // "ray/common/ray_internal_flag_def.h" is intentionally not included,
+    // because it contains Ray internal settings. Unknown keys are skipped
+    // rather than fatal: overrides may be published by a cluster controller
+    // running a different version than this process.
+    RAY_LOG(ERROR) << "Ignoring unknown dynamic config parameter " << pair.key();
+  }
+
+/// ---------------------------------------------------------------------
+#undef RAY_CONFIG
+
+  for (const auto &name : changed) {
+    std::vector<std::function<void()>> callbacks;
+    {
+      absl::MutexLock lock(&callback_mu_);
+      auto it = on_change_callbacks_.find(name);
+      if (it != on_change_callbacks_.end()) {
+        for (const auto &[_, callback] : it->second) {
+          callbacks.push_back(callback);
+        }
+      }
+    }
+    // Fire outside the lock so a callback can (un)register callbacks.
+    for (const auto &callback : callbacks) {
+      callback();
+    }
+  }
+  return changed;
+}
+
+int64_t RayConfig::RegisterOnChangeCallback(const std::string &name,
+                                            std::function<void()> callback) {
+  absl::MutexLock lock(&callback_mu_);
+  const int64_t callback_id = next_callback_id_++;
+  on_change_callbacks_[name].emplace(callback_id, std::move(callback));
+  callback_names_.emplace(callback_id, name);
+  return callback_id;
+}
+
+void RayConfig::UnregisterOnChangeCallback(int64_t callback_id) {
+  absl::MutexLock lock(&callback_mu_);
+  auto name_it = callback_names_.find(callback_id);
+  if (name_it == callback_names_.end()) {
+    return;
+  }
+  auto map_it = on_change_callbacks_.find(name_it->second);
+  if (map_it != on_change_callbacks_.end()) {
+    map_it->second.erase(callback_id);
+    if (map_it->second.empty()) {
+      on_change_callbacks_.erase(map_it);
+    }
+  }
+  callback_names_.erase(name_it);
+}
@@ -16,13 +16,16 @@
 
 #include <boost/algorithm/string.hpp>
 #include <cstdint>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/util/logging.h"
 
 template <typename T>
@@ -94,9 +97,46 @@ class RayConfig {
 
   void initialize(const std::string &config_list);
 
+  /// Apply runtime config overrides on top of the current values, without
+  /// resetting other configs to their env/default values like initialize()
+  /// does. Unknown keys and unparsable values are logged and skipped instead
+  /// of being fatal, since overrides may come from a cluster controller
+  /// running a different version than this process. Registered on-change
+  /// callbacks are fired for every config whose value actually changed.
+  ///
+  /// \param config_list A JSON map from config name to new value.
+  /// \return The names of the configs whose values changed.
+  std::vector<std::string> ApplyOverrides(const std::string &config_list);
+
+  /// Register a callback to be fired after the named config's value changes
+  /// through ApplyOverrides. The callback runs on the thread that called
+  /// ApplyOverrides. Components that cache a config value at construction
+  /// should re-read it from this callback.
+  ///
+  /// \param name The config name, as spelled in ray_config_def.h.
+  /// \param callback The callback to fire on a change to the config.
+  /// \return An id that can be passed to UnregisterOnChangeCallback. The
+  /// callback must be unregistered before anything it captures is destroyed.
+  int64_t RegisterOnChangeCallback(const std::string &name,
+                                   std::function<void()> callback);
+
+  /// Unregister a callback registered with RegisterOnChangeCallback. No-op if
+  /// the id is unknown.
+  void UnregisterOnChangeCallback(int64_t callback_id);
+
  private:
   RayConfig();
 
+  /// Protects the on-change callback registry.
+  absl::Mutex callback_mu_;
+  /// The next id to hand out from RegisterOnChangeCallback.
+  int64_t next_callback_id_ ABSL_GUARDED_BY(callback_mu_) = 0;
+  /// Map from config name to the registered callbacks for it, by callback id.
+  absl::flat_hash_map<std::string, absl::flat_hash_map<int64_t, std::function<void()>>>
+      on_change_callbacks_ ABSL_GUARDED_BY(callback_mu_);
+  /// Map from callback id back to the config name it is registered under.
+  absl::flat_hash_map<int64_t, std::string> callback_names_ ABSL_GUARDED_BY(callback_mu_);
+
   template <typename T>
   T ReadEnv(const std::string &name,
             const std::string &type_string,
@@ -64,9 +64,53 @@ RAY_CONFIG(uint64_t, gcs_pull_resource_loads_period_milliseconds, 1000)
 /// The duration between reporting resources sent by the raylets.
 RAY_CONFIG(uint64_t, raylet_report_resources_period_milliseconds, 100)
 
+/// Whether the GCS assigns per-node resource report periods scaled to the
+/// cluster size at node registration. When enabled, every
+/// adaptive_resource_report_nodes_per_step alive nodes add one
+/// raylet_report_resources_period_milliseconds step to the assigned period
+/// (capped by adaptive_resource_report_max_period_milliseconds), so the
+/// aggregate report load on the GCS stays roughly constant as the cluster
+/// grows. Raylets keep checking their local load at the base cadence and
+/// broadcast immediately when a resource's availability shifts by more than
+/// adaptive_resource_report_escalation_fraction.
+RAY_CONFIG(bool, adaptive_resource_report_period_enabled, false)
+
+/// Number of alive nodes per report period step. See
+/// adaptive_resource_report_period_enabled.
+RAY_CONFIG(int64_t, adaptive_resource_report_nodes_per_step, 500)
+
+/// Upper bound for the report period the GCS may assign. See
+/// adaptive_resource_report_period_enabled.
+RAY_CONFIG(int64_t, adaptive_resource_report_max_period_milliseconds, 30000)
+
+/// Change in a resource's availability fraction (0.0 - 1.0) that triggers an
+/// immediate resource broadcast instead of waiting out an adaptive report
+/// period. See adaptive_resource_report_period_enabled.
+RAY_CONFIG(double, adaptive_resource_report_escalation_fraction, 0.2)
+
 /// The duration between raylet check memory pressure and send gc request
 RAY_CONFIG(uint64_t, raylet_check_gc_period_milliseconds, 100)
 
+/// Whether raylets poll the GCS internal KV for runtime config overrides and
+/// apply them live via RayConfig::ApplyOverrides. Overrides are published as a
+/// JSON map of config name to value under the dynamic config internal KV key
+/// (see kDynamicConfigNamespace); unknown keys are skipped, and components
+/// that cache config values re-read them through per-config change callbacks.
+RAY_CONFIG(bool, dynamic_config_enabled, false)
+
+/// How often raylets poll the GCS internal KV for runtime config overrides.
+RAY_CONFIG(int64_t, dynamic_config_poll_interval_ms, 30000)
+
+/// Whether the raylet serves GetNodeStats requests from a periodically
+/// refreshed snapshot instead of assembling the reply, including a
+/// GetCoreWorkerStats fan-out to every worker on the node, inline in the RPC
+/// handler. Replies may be up to one refresh interval stale and always
+/// include memory info.
+RAY_CONFIG(bool, node_stats_snapshot_enabled, false)
+
+/// How often the raylet refreshes the node stats snapshot.
+RAY_CONFIG(int64_t, node_stats_snapshot_interval_ms, 10000)
+
 /// Threshold when the node is beyond the memory capacity. If the memory is above the
 /// memory_usage_threshold and free space is below the min_memory_free_bytes then
 /// it will start killing processes to free up the space.
@@ -77,6 +121,20 @@ RAY_CONFIG(float, memory_usage_threshold, 0.95)
 /// Monitor is disabled when this value is 0.
 RAY_CONFIG(uint64_t, memory_monitor_refresh_ms, 250)
 
+/// If positive, the memory monitor smooths the sampled usage with an EWMA,
+/// estimates the usage growth rate, and triggers worker killing as soon as
+/// the usage projected this many milliseconds ahead crosses the threshold,
+/// instead of waiting for the raw usage to cross it. This gives the worker
+/// killing policy a head start over the kernel OOM killer when usage grows
+/// quickly. 0 keeps the trigger on raw usage only.
+RAY_CONFIG(int64_t, memory_monitor_prediction_horizon_ms, 0)
+
+/// The EWMA smoothing factor in (0, 1] applied to memory usage samples and
+/// the derived growth rate when memory_monitor_prediction_horizon_ms is
+/// positive. Higher values track the latest sample more closely; lower
+/// values suppress transient spikes.
+RAY_CONFIG(float, memory_monitor_smoothing_alpha, 0.5)
+
 /// The minimum amount of free space. If the memory is above the
 /// memory_usage_threshold and free space is below min_memory_free_bytes then it
 /// will start killing processes to free up the space. Disabled if it is -1.
@@ -132,6 +190,13 @@ RAY_CONFIG(bool, report_actor_placement_resources, true)
 /// TODO: maybe group this under RAY_DEBUG.
 RAY_CONFIG(bool, record_ref_creation_sites, false)
 
+/// Whether the core worker's ReferenceCounter takes a lock-free fast path for
+/// local ref count increments and decrements that cannot change whether the
+/// object is in use. This avoids serializing simple ObjectRef copy/delete
+/// churn on the reference counting mutex. Transitions between zero and
+/// nonzero ref counts always take the mutex-protected slow path.
+RAY_CONFIG(bool, reference_counter_local_ref_fast_path_enabled, false)
+
 /// Collects the stacktrace of the task invocation, or actor creation. The stacktrace is
 /// serialized into the TaskSpec and is viewable from the Dashboard. Default is disabled.
 RAY_CONFIG(bool, record_task_actor_creation_sites, false)
@@ -169,6 +234,55 @@ RAY_CONFIG(bool, lineage_pinning_enabled, true)
 /// inlined args.
 RAY_CONFIG(int64_t, max_lineage_bytes, 1024 * 1024 * 1024)
 
+/// Maximum number of task completion replies the owner's task manager
+/// processes per batch. When > 1, replies are queued and drained in batches:
+/// the return objects of a batch are bulk-inserted into the in-memory store
+/// and the per-task bookkeeping is done under a single lock acquisition,
+/// which reduces lock and io_context churn under high task fan-in. 1 disables
+/// batching and processes each reply inline.
+RAY_CONFIG(int64_t, task_manager_completion_batch_size, 1)
+
+/// If positive, direct (in-memory) task return objects whose data plus
+/// metadata is at most this many bytes are stored by aliasing the reply
+/// protobuf's buffers via shared ownership instead of copying them. The reply
+/// is kept alive for as long as any such return object is in the memory
+/// store. 0 disables the zero-copy path and always copies.
+RAY_CONFIG(int64_t, inline_return_zero_copy_threshold_bytes, 0)
+
+/// Maximum number of queued PushTask requests that a core worker RPC client
+/// coalesces into one PushTaskBatch RPC to the same worker. Batches only form
+/// from requests that are already queued behind the in-flight byte limit, so
+/// batching amortizes per-RPC overhead under backlog without adding latency.
+/// 1 disables batching and sends one RPC per task.
+RAY_CONFIG(int64_t, push_task_rpc_batch_max_size, 1)
+
+/// Directory for per-worker Unix domain sockets used as a same-node fast
+/// lane for core worker RPCs. When non-empty, each core worker's gRPC server
+/// also listens on `<dir>/core_worker_<port>.sock`, and core worker clients
+/// on the same node connect over that socket instead of TCP loopback,
+/// falling back to TCP when the socket file does not exist. Empty (default)
+/// disables the fast lane. Ignored when TLS is enabled.
+RAY_CONFIG(std::string, core_worker_same_node_socket_dir, "")
+
+/// If true, threaded actors run all concurrency groups on one shared thread
+/// pool, enforcing each group's max concurrency as a limit on the pool
+/// instead of a dedicated thread count. A hot group can then use the idle
+/// threads of its sibling groups.
+RAY_CONFIG(bool, enable_shared_concurrency_group_pool, false)
+
+/// Number of threads in the shared concurrency group pool. 0 sizes the pool
+/// to the sum of the groups' max concurrencies (including the default
+/// group's). Only used when `enable_shared_concurrency_group_pool` is true.
+RAY_CONFIG(int64_t, shared_concurrency_group_pool_threads, 0)
+
+/// Number of consumption credits a streaming generator owner accumulates
+/// before waking a backpressured generator executor. Larger batches let the
+/// executor stream several items per owner round trip instead of resuming
+/// one item at a time. 1 wakes the executor as soon as the stream drops
+/// below the generator's backpressure threshold. Clamped to the generator's
+/// backpressure threshold.
+RAY_CONFIG(int64_t, generator_backpressure_credit_batch_size, 1)
+
 /// Whether to re-populate plasma memory. This avoids memory allocation failures
 /// at runtime (SIGBUS errors creating new objects), however it will use more memory
 /// upfront and can slow down Ray startup.
@@ -208,6 +322,52 @@ RAY_CONFIG(float, scheduler_top_k_fraction, 0.2);
 /// scheduler guarantees k is at least equal to scheduler_top_k_absolute.
 RAY_CONFIG(int32_t, scheduler_top_k_absolute, 1);
 
+/// If non-empty, the cluster lease manager records lease arrivals,
+/// resource-view epochs and scheduling outcomes to a compact binary log at
+/// this path. The log can be replayed offline against modified scheduling
+/// policies with the scheduling_decision_replay tool to compare placement
+/// and latency without a production A/B.
+RAY_CONFIG(std::string, scheduling_decision_record_path, "")
+
+/// If positive, the placement group PACK policy searches for a placement of
+/// the whole bundle set with a scored beam of this width before falling back
+/// to greedy per-bundle placement. The greedy pass places one bundle at a
+/// time and can fragment scarce resources (e.g. GPUs) so that a group fails
+/// even though the cluster has enough total capacity; the lookahead
+/// considers candidate assignments for all bundles together and prefers
+/// fewer, fuller nodes. 0 keeps the greedy behavior.
+RAY_CONFIG(int64_t, bundle_scheduling_lookahead_beam_width, 0)
+
+/// Wall-clock budget for the bundle placement lookahead search. If the
+/// search exceeds this budget it is abandoned and the PACK policy falls back
+/// to greedy per-bundle placement. Non-positive values disable the budget.
+RAY_CONFIG(int64_t, bundle_scheduling_lookahead_time_budget_ms, 50)
+
+/// If enabled, the hybrid scheduling policy restricts its per-request node
+/// scan to the nodes whose total resources include the request's rarest
+/// explicit resource, using an index maintained by ClusterResourceManager.
+/// Nodes outside that set can never be feasible, so the scheduling decision
+/// is unchanged; on large clusters this avoids scoring every node for
+/// requests that name scarce resources (e.g. GPUs or custom resources).
+RAY_CONFIG(bool, scheduler_feasibility_index_enabled, false)
+
+/// If enabled, ClusterLeaseManager batches scheduling decisions within one
+/// scheduling class: once a lease is placed, subsequent queued leases of the
+/// same class reuse that node while it still has room for the class's
+/// resource shape, instead of rerunning the cluster-wide node scan per
+/// lease. Only applies to the default scheduling strategy. Placements can
+/// differ from the unbatched scan when the scan would have load-balanced a
+/// burst across several equally loaded nodes.
+RAY_CONFIG(bool, cluster_lease_manager_batched_scheduling, false)
+
+/// If enabled, ClusterLeaseManager speculatively prefetches the arguments of
+/// leases still waiting in its scheduling queue instead of waiting until a
+/// lease is queued on the local node. Prefetches are issued at the same pull
+/// priority as regular argument fetches, so the pull manager only activates
+/// them when object store memory headroom allows, and they are cancelled if
+/// the lease is spilled to another node or cancelled.
+RAY_CONFIG(bool, speculative_lease_arg_prefetch_enabled, false)
+
 /// Whether to only report the usage of pinned copies of objects in the
 /// object_store_memory resource. This means nodes holding secondary copies only
 /// will become eligible for removal in the autoscaler.
@@ -233,6 +393,34 @@ RAY_CONFIG(int64_t, agent_max_grpc_message_size, 20 * 1024 * 1024)
 // of retries is non zero.
 RAY_CONFIG(int64_t, grpc_server_retry_timeout_milliseconds, 1000)
 
+/// Maximum number of completion-queue events a gRPC server polling thread
+/// drains per wakeup. Events beyond the first are taken without blocking,
+/// and the drained request handlers that target the same io_context are
+/// coalesced into a single post, cutting per-call posting overhead at high
+/// RPC rates. Coalesced handlers run in arrival order, so per-call ordering
+/// is unchanged. 1 keeps one post per request.
+RAY_CONFIG(int64_t, grpc_server_request_batch_size, 1)
+
+/// Number of extra, normally-parked polling threads a gRPC server keeps per
+/// completion queue. When a polling thread drains a full batch of events in
+/// one wakeup (i.e. the queue is deeper than one wakeup can absorb), it wakes
+/// a parked poller for the same queue; an extra poller parks itself again
+/// after the queue has stayed idle for about a second. 0 keeps the static
+/// one-poller-per-queue behavior.
+RAY_CONFIG(int64_t, grpc_server_dynamic_pollers_per_cq, 0)
+
+/// Comma-separated list of CPU ids the gRPC server polling threads are
+/// pinned to, e.g. "0,1,2". Empty disables pinning. Only honored on Linux.
+RAY_CONFIG(std::string, grpc_server_poller_cpu_list, "")
+
+/// Maximum number of low-priority RPCs (e.g. bulk dashboard reads against the
+/// GCS, see RPC_SERVICE_HANDLER_LOW_PRIORITY) admitted at the same time,
+/// across all gRPC servers of the process. Further low-priority calls are
+/// rejected with an OutOfResource status instead of queueing behind the
+/// backlog, so that control-plane calls posted to the same event loop keep
+/// their latency during read storms. 0 disables load shedding.
+RAY_CONFIG(int64_t, grpc_server_low_priority_max_inflight, 0)
+
 // Whether to allow HTTP proxy on GRPC clients. Disable HTTP proxy by default since it
 // disrupts local connections. Note that this config item only controls GrpcClient in
 // `src/ray/rpc/grpc_client.h`. Python GRPC clients are not directly controlled by this.
@@ -256,6 +444,52 @@ RAY_CONFIG(int64_t, object_timeout_milliseconds, 100)
 /// for direct task submission until it must be returned to the raylet.
 RAY_CONFIG(int64_t, worker_lease_timeout_milliseconds, 500)
 
+/// How long the task submitter keeps an idle leased worker before returning
+/// it to the raylet. With the default of 0 idle workers are returned as soon
+/// as their scheduling class has no queued tasks. A positive value keeps the
+/// lease warm for that long, so recurring bursts of short tasks with the same
+/// scheduling class can reuse the worker instead of paying a lease round-trip
+/// to the raylet. Bounded by worker_lease_timeout_milliseconds either way.
+RAY_CONFIG(int64_t, normal_task_lease_keep_warm_ms, 0)
+
+/// If enabled, the task submitter hedges straggling normal tasks: once a
+/// task has been executing for longer than the normal_task_hedging_quantile
+/// runtime of recently completed tasks with the same scheduling class, a
+/// duplicate copy is submitted through the regular lease machinery. The
+/// first reply wins and the losing attempt is cancelled best-effort. Only
+/// tasks with a nonzero max_retries are hedged, since those are already
+/// required to be idempotent; generator tasks are never hedged.
+RAY_CONFIG(bool, normal_task_hedging_enabled, false)
+
+/// Runtime quantile of a scheduling class's recently completed tasks that an
+/// executing task must exceed before a hedged duplicate is submitted.
+RAY_CONFIG(float, normal_task_hedging_quantile, 0.95)
+
+/// Minimum number of completed runtime samples for a scheduling class before
+/// its tasks are considered for hedging.
+RAY_CONFIG(int64_t, normal_task_hedging_min_samples, 16)
+
+/// Maximum number of hedged duplicate attempts a single submitter keeps in
+/// flight, to bound the extra load hedging can put on the cluster.
+RAY_CONFIG(int64_t, normal_task_hedging_max_concurrent, 8)
+
+/// If enabled, an owner may register a consumer worker as the forward
+/// destination for a task's return object. The executor then sends the
+/// inlined result straight to that consumer via ForwardInlineResult, in
+/// addition to the owner-routed reply, saving the owner-to-consumer hop at
+/// pipeline stage boundaries. Forwarding is best-effort; with no registered
+/// destination the task reply path is unchanged.
+RAY_CONFIG(bool, task_result_forwarding_enabled, false)
+
+/// If enabled, the task manager keeps the lineage of finished tasks in a
+/// cold tier: the task spec is stored in protobuf-serialized form and the
+/// in-memory message is dropped, shrinking a long-running driver's resident
+/// lineage to roughly the serialized footprint already tracked against
+/// max_lineage_bytes. Specs are rehydrated transparently when a task is
+/// resubmitted to reconstruct a lost object. Generator tasks stay resident
+/// because their specs are consulted while returns are still being reported.
+RAY_CONFIG(bool, lineage_cold_storage_enabled, false)
+
 /// The interval at which the workers will check if their raylet has gone down.
 /// When this happens, they will kill themselves.
 RAY_CONFIG(uint64_t, raylet_death_check_interval_milliseconds, 1000)
@@ -265,6 +499,33 @@ RAY_CONFIG(uint64_t, raylet_death_check_interval_milliseconds, 1000)
 RAY_CONFIG(int64_t, get_check_signal_interval_milliseconds, 1000)
 RAY_CONFIG(int64_t, worker_fetch_request_size, 10000)
 
+/// If enabled, ray.get resolves the already-local objects of the whole ID
+/// list through a single plasma store round trip, instead of one round trip
+/// per worker_fetch_request_size batch. The pull requests to the raylet are
+/// still issued in batches of worker_fetch_request_size.
+RAY_CONFIG(bool, worker_fetch_vectored_plasma_get, false)
+
+/// If enabled, workers resolving object locations first query the local
+/// raylet's object directory cache over IPC and only fall back to the owner
+/// RPC for objects without a fresh cached entry. The cache is populated by
+/// the raylet's location subscriptions and kept up to date by the owners'
+/// pubsub notifications, so workers on the same node share location lookups.
+RAY_CONFIG(bool, worker_object_location_cache_enabled, false)
+
+/// Maximum number of outstanding object prefetch hints a worker keeps
+/// active. Each hint holds a raylet pull request open for the hinted
+/// objects; issuing a hint beyond this limit releases the oldest one first.
+RAY_CONFIG(int64_t, worker_max_active_object_prefetch_hints, 16)
+
+/// Number of plasma object releases to batch into a single release message.
+/// With the default of 1 every release is sent to the store immediately. With
+/// a larger value, releases of objects that are not fallback-allocated are
+/// deferred until this many are pending and then sent as one message, which
+/// collapses the per-object release IPC storm after a ray.get on a large list
+/// of objects. Deferred releases are flushed before any create, get or delete
+/// request, so the store can still evict the objects when it needs space.
+RAY_CONFIG(int64_t, plasma_client_release_batch_size, 1)
+
 /// How long to wait for a fetch to complete during ray.get before warning the
 /// user.
 RAY_CONFIG(int64_t, fetch_warn_timeout_milliseconds, 60000)
@@ -282,6 +543,22 @@ RAY_CONFIG(bool, yield_plasma_lock_workaround, true)
 RAY_CONFIG(int64_t, raylet_client_num_connect_attempts, 10)
 RAY_CONFIG(int64_t, raylet_client_connect_timeout_milliseconds, 1000)
 
+/// Max number of queued messages an IPC connection coalesces into a single
+/// vectored async write. Larger batches cut per-message syscalls under bursty
+/// traffic (e.g. worker registration storms); 1 restores the old
+/// one-message-per-write behavior.
+RAY_CONFIG(int64_t, raylet_ipc_async_write_max_messages, 32)
+
+/// If enabled, IPC connections drain the socket into a per-connection read
+/// buffer with a single read and parse messages out of it, instead of issuing
+/// two reads (header, then body) per message. Cuts read syscalls on dense
+/// nodes with chatty workers.
+RAY_CONFIG(bool, raylet_ipc_buffered_reads_enabled, false)
+
+/// Size of the per-connection read buffer used when buffered reads are
+/// enabled. The buffer grows to fit a single message larger than this.
+RAY_CONFIG(uint64_t, raylet_ipc_read_buffer_size, 64 * 1024)
+
 /// The duration that we wait after sending a worker SIGTERM before sending
 /// the worker SIGKILL.
 RAY_CONFIG(int64_t, kill_worker_timeout_milliseconds, 5000)
@@ -296,6 +573,14 @@ RAY_CONFIG(int64_t, actor_graceful_shutdown_timeout_ms, 30000)
 /// starting_worker_timeout_callback() is called.
 RAY_CONFIG(int64_t, worker_register_timeout_seconds, 60)
 
+/// If enabled, the raylet reserves a worker's gRPC port when the worker
+/// process is started instead of during the registration handshake, so
+/// registration is a single lookup-and-activate on the pre-staged process
+/// state. This keeps registration storms (e.g. after autoscaler scale-up)
+/// off the port scan. Ports reserved for processes that die before
+/// registering are returned to the pool.
+RAY_CONFIG(bool, prestage_worker_registration_enabled, false)
+
 /// The maximum workers raylet can start at the same time.
 /// 0 means it will use the default (number of CPUs).
 RAY_CONFIG(int64_t, worker_maximum_startup_concurrency, 0)
@@ -336,6 +621,27 @@ RAY_CONFIG(int64_t, redis_retry_base_ms, 100)
 RAY_CONFIG(int64_t, redis_retry_multiplier, 2)
 RAY_CONFIG(int64_t, redis_retry_max_ms, 1000)
 
+/// Pipeline Redis commands: send them on the single GCS Redis connection
+/// without waiting for the reply of the previous command on the same key.
+/// Commands on one connection are executed by Redis in submission order, so
+/// per-key ordering is preserved while the per-command round trip is
+/// removed. Must not be flipped while a GCS is running; set it at startup.
+RAY_CONFIG(bool, redis_enable_command_pipelining, false)
+
+/// Maximum number of request bytes in flight to Redis when command
+/// pipelining is enabled. Further commands are queued and sent as replies
+/// free up the budget, bounding the memory pinned by the Redis output
+/// buffer during write storms.
+RAY_CONFIG(int64_t, redis_pipeline_max_inflight_bytes, 16 * 1024 * 1024)
+
+/// Fetch whole tables with a single HGETALL command instead of walking an
+/// HSCAN cursor batch by batch. Each HSCAN batch is a serialized round trip
+/// (maximum_gcs_storage_operation_batch_size entries each), which dominates
+/// GCS failover recovery time for large tables. HGETALL trades that for one
+/// bulk reply, at the cost of occupying the Redis server while the table is
+/// serialized.
+RAY_CONFIG(bool, redis_get_all_use_hgetall, false)
+
 /// The object manager's global timer interval in milliseconds.
 RAY_CONFIG(int, object_manager_timer_freq_ms, 100)
 
@@ -356,18 +662,182 @@ RAY_CONFIG(int, object_manager_push_timeout_ms, 10000)
 /// NOTE(ekl): this has been raised to lower broadcast overheads.
 RAY_CONFIG(uint64_t, object_manager_default_chunk_size, 5 * 1024 * 1024)
 
+/// If true, the object manager picks the chunk size of each outbound transfer
+/// from the throughput observed towards the destination node, instead of
+/// always using object_manager_default_chunk_size. Fast links get larger
+/// chunks to keep the NIC busy; congested links get smaller chunks to avoid
+/// head-of-line blocking. The size is renegotiated as chunk sends complete
+/// and is clamped to the min/max bounds below.
+RAY_CONFIG(bool, object_manager_adaptive_chunk_size, false)
+
+/// Lower bound for adaptively chosen transfer chunk sizes.
+RAY_CONFIG(uint64_t, object_manager_adaptive_chunk_size_min_bytes, 1024 * 1024)
+
+/// Upper bound for adaptively chosen transfer chunk sizes.
+RAY_CONFIG(uint64_t, object_manager_adaptive_chunk_size_max_bytes, 64 * 1024 * 1024)
+
+/// Target wall-clock duration of a single chunk send when adaptive chunk
+/// sizing is enabled. The chunk size is chosen so that one chunk takes about
+/// this long at the observed per-node throughput.
+RAY_CONFIG(int64_t, object_manager_adaptive_chunk_target_ms, 50)
+
 /// The maximum number of outbound bytes to allow to be outstanding. This avoids
 /// excessive memory usage during object broadcast to many receivers.
 RAY_CONFIG(uint64_t,
            object_manager_max_bytes_in_flight,
            ((uint64_t)2) * 1024 * 1024 * 1024)
 
+/// The maximum number of outbound chunks allowed to be in flight to a single
+/// destination node, so a slow receiver cannot consume the whole in-flight
+/// budget. 0 means no per-node limit.
+RAY_CONFIG(int64_t, object_manager_max_chunks_in_flight_per_node, 0)
+
+/// Number of urgent chunks (task arguments, blocked ray.get() requests) the
+/// push manager sends for each bulk chunk (e.g. rebalancing) while both
+/// priority lanes have chunks waiting. Higher values let urgent pushes jump
+/// further ahead of bulk transfers.
+RAY_CONFIG(int64_t, object_manager_urgent_push_weight, 4)
+
+/// Whether the push manager adapts each destination's in-flight budget to
+/// congestion feedback from completed chunk sends: failed sends halve a
+/// node's budget and successful sends grow it back additively (AIMD). Useful
+/// on high bandwidth-delay-product links where the striped connections to a
+/// peer back up long before the global in-flight budget is reached.
+RAY_CONFIG(bool, object_manager_adaptive_push_budget_enabled, false)
+
+/// Whether pushed chunk payloads are handed to gRPC as slices referencing
+/// the chunk memory (plasma buffer or spill-file mmap) directly, instead of
+/// being copied into a protobuf `bytes` field and again into gRPC slices.
+/// Only applies to chunks whose reader can expose a borrowed view; others
+/// fall back to the copying path.
+RAY_CONFIG(bool, object_manager_grpc_zero_copy_push, false)
+
+/// Whether pushed object chunks carry a CRC32C of their bytes, verified by
+/// the receiver before the chunk is written into plasma. The checksum uses
+/// the hardware CRC instructions (SSE4.2 / ARMv8, selected at runtime), so
+/// the cost is a small fraction of the chunk copy itself. A chunk that fails
+/// verification is dropped and counted, and the pull manager retries the
+/// transfer. Senders with this disabled send no checksum, and such chunks
+/// are accepted unverified.
+RAY_CONFIG(bool, object_manager_chunk_integrity_checks, false)
+
+/// If true, object chunks pushed to remote nodes may be deflate-compressed on
+/// the rpc threads before they go on the wire, trading sender/receiver CPU for
+/// wire bytes on slow links. Compression is negotiated per transfer: the first
+/// chunk is sampled and, if it does not shrink by at least
+/// object_manager_push_compression_min_savings_percent, the remaining chunks
+/// of that transfer are sent uncompressed (incompressible-data bailout).
+RAY_CONFIG(bool, object_manager_push_compression_enabled, false)
+
+/// zlib compression level (1-9) used for pushed chunks. Level 1 keeps the
+/// CPU cost per chunk low and already captures most of the savings on the
+/// highly redundant payloads compression is meant for.
+RAY_CONFIG(int64_t, object_manager_push_compression_level, 1)
+
+/// Only compress transfers to nodes whose observed push throughput is below
+/// this many bytes per second; faster links typically lose more to
+/// compression CPU than they save in wire time. 0 compresses regardless of
+/// the observed throughput. Until the first chunk sends to a node have been
+/// measured, its link is assumed fast and not compressed.
+RAY_CONFIG(int64_t, object_manager_push_compression_max_bytes_per_second, 0)
+
+/// Minimum size reduction, as a percentage of the raw chunk size, for a
+/// compressed chunk to be sent compressed instead of raw.
+RAY_CONFIG(uint64_t, object_manager_push_compression_min_savings_percent, 10)
+
+/// Whether to stripe pulls of large objects across all known locations.
+/// Each source is asked for a disjoint chunk index range so the transfer is
+/// not capped by a single source's bandwidth. Striped pushes always use
+/// object_manager_default_chunk_size so that all sources agree on the chunk
+/// layout.
+RAY_CONFIG(bool, pull_manager_striped_pulls, false)
+
+/// Minimum object size for a pull to be striped across multiple locations.
+/// Smaller objects are pulled from a single (random) location.
+RAY_CONFIG(uint64_t, pull_manager_striped_pull_min_object_size, 100 * 1024 * 1024)
+
+/// Whether the pull manager chooses between pulling an object from a remote
+/// node and restoring it from local external storage based on estimated cost,
+/// rather than always preferring the remote pull. The costs are derived from
+/// the observed per-node pull bandwidth and local restore throughput.
+RAY_CONFIG(bool, pull_manager_cost_based_source_selection, false)
+
+/// Assumed pull bandwidth, in bytes per second, for a node we have not pulled
+/// from yet. Only used by cost based source selection.
+RAY_CONFIG(int64_t, pull_manager_default_pull_bytes_per_second, 128 * 1024 * 1024)
+
+/// Assumed local restore throughput, in bytes per second, before the first
+/// restore has been measured. Only used by cost based source selection.
+RAY_CONFIG(int64_t,
+           pull_manager_default_restore_bytes_per_second,
+           1024LL * 1024 * 1024)
+
+/// Whether a location update that reveals a source the pull manager did not
+/// know about yet (a new node holding the object, or a newly spilled copy)
+/// retries a backing off pull immediately instead of waiting out the
+/// exponential retry timer. Republished but unchanged location sets never
+/// reset the timer, and the retry count is preserved so the backoff resumes
+/// if the new source also fails.
+RAY_CONFIG(bool, pull_manager_retry_on_new_locations, false)
+
+/// Whether owners publish object location changes as deltas (nodes added and
+/// removed since the last published message) instead of the full node-id set.
+/// The snapshot published on subscription always carries the full set, which
+/// later deltas are applied to. All nodes in the cluster must run a version
+/// that understands delta messages before this is enabled.
+RAY_CONFIG(bool, object_location_delta_updates, false)
+
+/// Whether task owners eagerly push new return-object locations to the nodes
+/// hosting already-submitted consumer tasks, so those nodes can start pulling
+/// without waiting for the owner's location pubsub round trip. The hint is
+/// best effort and only has an effect before the pubsub snapshot arrives.
+RAY_CONFIG(bool, eager_object_location_hints_enabled, false)
+
 /// Maximum number of ids in one batch to send to GCS to delete keys.
 RAY_CONFIG(uint32_t, maximum_gcs_deletion_batch_size, 1000)
 
 /// Maximum number of items in one batch to scan/get/delete from GCS storage.
 RAY_CONFIG(uint32_t, maximum_gcs_storage_operation_batch_size, 1000)
 
+/// Maximum number of jobs in one page of the GCS job snapshot export
+/// (JobInfoGcsService.GetJobSnapshot). Clients may ask for fewer.
+RAY_CONFIG(int64_t, gcs_job_snapshot_max_batch_size, 10000)
+
+/// Number of buffered GCS table writes that triggers an immediate flush of the
+/// write-behind buffer. Buffered writes are also flushed after
+/// gcs_table_storage_write_behind_flush_interval_ms, or as soon as the previous
+/// flush completes. 0 disables write-behind: every table Put goes straight to
+/// storage. Callbacks always fire only after the write is durable.
+RAY_CONFIG(int64_t, gcs_table_storage_write_behind_batch_size, 0)
+
+/// Maximum time a buffered GCS table write waits before its batch is flushed.
+RAY_CONFIG(int64_t, gcs_table_storage_write_behind_flush_interval_ms, 10)
+
+/// Whether GCS table values are stored with a fixed-offset envelope header
+/// carrying the row's hot fields (state, timestamp, node/job id) before the
+/// serialized protobuf body. Readers that only need the hot fields (e.g.
+/// reconciliation passes over every row after a GCS failover) can then
+/// consult the header without deserializing the body; see
+/// GcsTable::GetAllEnvelopeHeaders. Rows written with and without the
+/// envelope can coexist, so the flag can be toggled across restarts.
+RAY_CONFIG(bool, gcs_storage_envelope_enabled, false)
+
+/// Number of hash shards each table of the in-memory GCS store is split into.
+/// With more than one shard, a full-table read (e.g. a dashboard GetAll scan)
+/// only blocks writes to one shard at a time. 1 keeps the single-map behavior.
+RAY_CONFIG(uint32_t, gcs_in_memory_store_table_shards, 1)
+
+/// Number of dedicated threads serving Get/GetAll reads of the in-memory GCS
+/// store, so that large scans don't occupy the thread issuing the read. 0 runs
+/// reads inline on the calling thread.
+RAY_CONFIG(uint32_t, gcs_in_memory_store_read_threads, 0)
+
+/// Fraction of GCS RPCs sampled by GcsRequestTracer, which aggregates
+/// per-stage (handler, storage, publish) latency histograms per method.
+/// Re-read on every request, so tracing can be enabled and disabled at
+/// runtime. 0 disables sampling entirely.
+RAY_CONFIG(double, gcs_request_trace_sample_rate, 0.0)
+
 /// When getting objects from object store, max number of ids to print in the warning
 /// message.
 RAY_CONFIG(uint32_t, object_store_get_max_ids_to_print_in_warning, 20)
@@ -392,12 +862,32 @@ RAY_CONFIG(uint64_t, gcs_redis_heartbeat_interval_milliseconds, 100)
 RAY_CONFIG(uint32_t, gcs_lease_worker_retry_interval_ms, 200)
 /// Duration to wait between retries for creating actor in gcs server.
 RAY_CONFIG(uint32_t, gcs_create_actor_retry_interval_ms, 200)
+/// Whether the GCS actor scheduler coalesces the worker lease requests issued
+/// within one event loop iteration. The pending actors are grouped by target
+/// node and runtime env so that each raylet receives its lease requests
+/// back-to-back in a single dispatch.
+RAY_CONFIG(bool, gcs_actor_scheduler_batch_lease_enabled, false)
+/// Max number of actor restarts triggered by a node death that the GCS keeps
+/// in flight at once; further restarts are queued until an in-flight restart's
+/// state flush is acknowledged. Paces the scheduler and runtime env agent when
+/// a node running many actors dies. 0 means unthrottled.
+RAY_CONFIG(uint32_t, gcs_actor_restart_on_node_death_max_concurrency, 0)
 /// Exponential backoff params for gcs to retry creating a placement group
 RAY_CONFIG(uint64_t, gcs_create_placement_group_retry_min_interval_ms, 100)
 RAY_CONFIG(uint64_t, gcs_create_placement_group_retry_max_interval_ms, 1000)
 RAY_CONFIG(double, gcs_create_placement_group_retry_multiplier, 1.5)
+/// If true, the GCS coalesces placement group prepare and commit requests that
+/// target the same raylet within one event-loop iteration into a single RPC,
+/// including bundles of different placement groups. The raylet still prepares
+/// each placement group atomically and replies with a per-group result.
+RAY_CONFIG(bool, gcs_placement_group_batch_prepare_commit_enabled, false)
 /// Maximum number of destroyed actors in GCS server memory cache.
 RAY_CONFIG(uint32_t, maximum_gcs_destroyed_actor_cached_count, 100000)
+/// If true, destroyed actors are kept as serialized rows plus a small index of
+/// hot fields instead of fully deserialized protos, and are only materialized
+/// when a query actually returns them. Cuts GCS memory and copy costs when a
+/// large destroyed-actor cache is retained.
+RAY_CONFIG(bool, gcs_destroyed_actor_archive_enabled, false)
 /// Maximum number of dead nodes in GCS server memory cache.
 RAY_CONFIG(uint32_t, maximum_gcs_dead_node_cached_count, 1000)
 // The storage backend to use for the GCS. It can be either 'redis' or 'memory'.
@@ -406,6 +896,121 @@ RAY_CONFIG(std::string, gcs_storage, "memory")
 /// Duration to sleep after failing to put an object in plasma because it is full.
 RAY_CONFIG(uint32_t, object_store_full_delay_ms, 10)
 
+/// Number of shards for the plasma object index. When set to a value greater
+/// than 1 (rounded up to a power of two), the object table is split across
+/// that many hash maps to keep lookups fast when the store holds millions of
+/// objects. 1 preserves the single-map index.
+RAY_CONFIG(uint32_t, object_store_index_shards, 1)
+
+/// Number of executor threads used to serve plasma store clients. When > 0,
+/// each client connection is pinned to one of that many io contexts so
+/// request parsing, fd passing and reply serialization for different clients
+/// run in parallel, while object metadata updates remain serialized by the
+/// store mutex. 0 (the default) serves all clients on the main store thread.
+RAY_CONFIG(uint32_t, plasma_store_client_executor_threads, 0)
+
+/// Huge page size in MB for the plasma arena. When set to 2 or 1024 on Linux,
+/// the main arena is backed by a hugetlb memfd of that page size and
+/// pre-faulted at startup; no hugetlbfs mount is required. If huge pages of
+/// the requested size are unavailable, the store falls back to regular 4K
+/// pages. 0 disables hugetlb backing. Fallback (filesystem) allocations are
+/// unaffected.
+RAY_CONFIG(uint64_t, plasma_hugepage_size_mb, 0)
+
+/// On Linux machines with more than one NUMA node, interleave the pages of
+/// the main plasma arena across all online nodes instead of letting them
+/// land on whichever node first touches them. Objects are read through the
+/// same shared mapping by workers on every socket, so interleaving bounds
+/// the remote-access fraction of any reader at roughly 1/num_nodes rather
+/// than letting whole objects end up remote to a socket. Fallback
+/// (filesystem) allocations are unaffected. No effect on single-node
+/// machines or other platforms.
+RAY_CONFIG(bool, plasma_numa_interleave_enabled, false)
+
+/// When > 0, plasma allocations strictly below this many bytes are served
+/// from a segregated size-class allocator layered over dlmalloc, which keeps
+/// long-running stores from fragmenting under churn of many small objects.
+/// Larger allocations and disk fallback allocations still go to dlmalloc
+/// directly. 0 disables the size-class layer.
+RAY_CONFIG(uint64_t, plasma_small_object_threshold_bytes, 0)
+
+/// Bytes carved out of the main arena per size-class slab. Only used when
+/// plasma_small_object_threshold_bytes > 0; must be at least the threshold.
+RAY_CONFIG(uint64_t, plasma_size_class_slab_bytes, 1024 * 1024)
+
+/// When true, a background thread keeps a pool of pre-created, pre-allocated
+/// files in the fallback directory, bucketed by power-of-two size. Fallback
+/// allocations take a pooled file and only pay for the mmap instead of the
+/// synchronous create/ftruncate/fallocate on the store thread. Files the pool
+/// cannot serve (too large, or the pool is drained) are created synchronously
+/// as before.
+RAY_CONFIG(bool, plasma_fallback_file_pool_enabled, false)
+
+/// Number of pre-created files the pool keeps per size bucket.
+RAY_CONFIG(uint64_t, plasma_fallback_file_pool_files_per_bucket, 2)
+
+/// Smallest and largest pool bucket, in bytes. Buckets are the powers of two
+/// in [min, max]; requests larger than the largest bucket bypass the pool.
+RAY_CONFIG(int64_t, plasma_fallback_file_pool_min_bucket_bytes, 8 * 1024 * 1024)
+RAY_CONFIG(int64_t, plasma_fallback_file_pool_max_bucket_bytes, 1024 * 1024 * 1024)
+
+/// When > 0, freeing a plasma allocation of at least this many bytes is
+/// deferred to a background reclamation thread instead of running dlmalloc
+/// coalescing on the store thread, so deleting huge objects does not stall
+/// store traffic. 0 disables deferred frees.
+RAY_CONFIG(int64_t, plasma_deferred_free_min_bytes, 0)
+
+/// When true and a plasma create request fails even though the footprint
+/// tracker reports enough free memory (i.e. the free space is fragmented),
+/// the store relocates sealed objects that no client is using so the
+/// allocator can coalesce a contiguous run for the request, instead of
+/// immediately falling back to disk or failing.
+RAY_CONFIG(bool, plasma_unreferenced_object_compaction, false)
+
+/// Maximum number of bytes relocated by one compaction pass. Bounds both the
+/// transient heap copy of the evacuated payloads and the memcpy time spent
+/// on the store thread per fragmented create.
+RAY_CONFIG(int64_t, plasma_compaction_max_bytes_per_pass, 1LL << 30)
+
+/// When true, the plasma store deduplicates sealed objects with identical
+/// content. Payloads are hashed at seal time; once the last client reference
+/// to an object is dropped, its allocation is collapsed onto another sealed
+/// object whose payload compares byte-for-byte equal, and the shared block is
+/// freed when the last sharing object is deleted. Helps workloads that
+/// broadcast the same bytes under many ObjectIDs.
+RAY_CONFIG(bool, plasma_dedup_enabled, false)
+
+/// When true, queued plasma create requests are admitted deficit-round-robin
+/// by bytes across clients instead of strictly FIFO, and while one request
+/// waits on spilling or the OOM grace period, other clients' requests that
+/// already fit in memory are served. This keeps create latency low for
+/// well-behaved workers while a neighbor bursts large objects.
+RAY_CONFIG(bool, plasma_fair_creation_admission_enabled, false)
+
+/// Admission budget added to a client's deficit each time it is considered
+/// in the fair creation round-robin. Clients whose queued creations stay
+/// under this rate are served immediately; clients that exceed it wait for
+/// their budget to accumulate.
+RAY_CONFIG(int64_t, plasma_fair_creation_quantum_bytes, 64LL * 1024 * 1024)
+
+/// When true, the plasma store records object create/delete events into a
+/// fixed-size ring drained by a background sampler thread, which maintains a
+/// breakdown of live objects by size class and by owner worker for the debug
+/// dump. Costs one ring-slot write per event on the store thread; if the
+/// sampler falls behind, events are dropped and counted rather than blocking
+/// the store.
+RAY_CONFIG(bool, object_store_detailed_stats_enabled, false)
+
+/// Capacity of the detailed stats event ring, rounded up to a power of two.
+RAY_CONFIG(uint64_t, object_store_detailed_stats_ring_size, 4096)
+
+/// Which eviction policy the plasma store uses when it needs space. "lru"
+/// evicts in least-recently-used order. "cost_aware" weighs the cost of
+/// losing each object (cross-node re-pull or storage restore vs. local
+/// recreate), its access frequency, and its size, and evicts the cheapest
+/// bytes first.
+RAY_CONFIG(std::string, plasma_eviction_policy, "lru")
+
 /// The threshold to trigger a global gc
 RAY_CONFIG(double, plasma_store_usage_trigger_gc_threshold, 0.7)
 
@@ -422,6 +1027,13 @@ RAY_CONFIG(uint64_t, global_gc_min_interval_s, 30)
 /// Duration to wait between retries for failed tasks.
 RAY_CONFIG(uint32_t, task_retry_delay_ms, 0)
 
+/// If enabled, TaskSpecBuilder allocates each task spec message on a protobuf
+/// arena drawn from a recycling pool instead of performing dozens of small
+/// heap allocations per spec. The arena is reset and reused once the last
+/// reference to the spec goes away. This mainly helps drivers that submit
+/// tasks at a very high rate.
+RAY_CONFIG(bool, task_spec_arena_allocation_enabled, false)
+
 /// The base retry delay for exponential backoff when the task fails due to OOM.
 /// No delay if this value is zero.
 RAY_CONFIG(uint32_t, task_oom_retry_delay_base_ms, 1000)
@@ -453,9 +1065,41 @@ RAY_CONFIG(int32_t, gcs_grpc_initial_reconnect_backoff_ms, 100)
 /// By default, the value if 5GB.
 RAY_CONFIG(uint64_t, gcs_grpc_max_request_queued_max_bytes, 1024UL * 1024 * 1024 * 5)
 
+/// Whether GCS clients keep a local read-through cache of internal KV
+/// entries. Repeat Gets of a key (e.g. config and function lookups at job
+/// start) are served from the cache instead of generating a GCS read per
+/// lookup. The GCS publishes a message on every KV write so caches drop
+/// stale entries; the TTL below bounds staleness if an invalidation is lost.
+RAY_CONFIG(bool, gcs_internal_kv_cache_enabled, false)
+
+/// How long a cached internal KV entry may be served before it must be
+/// re-read from the GCS. <= 0 means entries never expire and caches rely
+/// solely on the published invalidations.
+RAY_CONFIG(int64_t, gcs_internal_kv_cache_ttl_ms, 30 * 1000)
+
 /// The duration between two checks for grpc status.
 RAY_CONFIG(int32_t, grpc_client_check_connection_status_interval_milliseconds, 1000)
 
+/// Maximum number of completion-queue events a gRPC client polling thread
+/// drains per wakeup. Events beyond the first are taken without blocking and
+/// the drained reply callbacks are delivered to the main io_context in a
+/// single post, cutting per-reply posting overhead at high reply rates.
+/// Batched replies run in arrival order, so per-call ordering is unchanged.
+/// 1 keeps one post per reply.
+RAY_CONFIG(int64_t, grpc_client_reply_batch_size, 1)
+
+/// Whether clients to core worker servers share gRPC channels through a
+/// process-wide pool keyed by endpoint. HTTP/2 multiplexes all RPC streams
+/// to an endpoint over the shared channel's connection, bounding file
+/// descriptor usage in processes that talk to thousands of workers. Idle
+/// unreferenced channels are reaped from the pool periodically.
+RAY_CONFIG(bool, grpc_client_enable_channel_pool, false)
+
+/// Maximum number of channels the shared gRPC channel pool caches. When the
+/// pool is full and no cached channel can be reaped, additional endpoints
+/// get unpooled channels. 0 means no limit.
+RAY_CONFIG(int64_t, grpc_client_channel_pool_max_channels, 0)
+
 /// Due to the protocol drawback, raylet needs to refresh the message if
 /// no message is received for a while.
 /// Refer to https://tinyurl.com/n6kvsp87 for more details
@@ -466,6 +1110,17 @@ RAY_CONFIG(int64_t, ray_syncer_message_refresh_interval_ms, 3000)
 /// will be under 10Mb.
 RAY_CONFIG(int64_t, metrics_report_batch_size, 10000)
 
+/// Whether components publish scalar metric time-series into a per-process
+/// shared-memory segment that the on-node agent scrapes in place, instead of
+/// serializing every report into a ReportOCMetrics gRPC call. Histogram series,
+/// and platforms without POSIX shared memory, keep using gRPC.
+RAY_CONFIG(bool, metrics_shared_memory_export_enabled, false)
+
+/// Maximum number of metric cells (distinct metric name + tag-set series) in
+/// the shared-memory metrics segment. Series beyond this are dropped from the
+/// shared-memory lane.
+RAY_CONFIG(int64_t, metrics_shared_memory_max_cells, 1024)
+
 /// If task events (status change and profiling events) from driver should be ignored.
 /// Currently for testing only.
 RAY_CONFIG(bool, task_events_skip_driver_for_test, false)
@@ -480,6 +1135,14 @@ RAY_CONFIG(int64_t, task_events_report_interval_ms, 1000)
 /// Setting the value to 0 disables the ray event recording and reporting.
 RAY_CONFIG(int64_t, ray_events_report_interval_ms, 1000)
 
+/// Fraction of task attempts sampled by TaskStageTracer, which turns the
+/// status timestamps each worker already records into per-stage latency
+/// histograms (dependency resolution, scheduling, dispatch, execution).
+/// Sampling is deterministic on the task id, so all transitions of an
+/// attempt land in the same trace. Re-read on every transition, so tracing
+/// can be tuned at runtime. 0 disables sampling entirely.
+RAY_CONFIG(double, task_stage_trace_sample_rate, 0.01)
+
 /// The number of tasks tracked in GCS for task state events. Any additional events
 /// from new tasks will evict events of tasks reported earlier.
 /// Setting the value to -1 allows for unlimited task events stored in GCS.
@@ -508,6 +1171,13 @@ RAY_CONFIG(uint64_t,
 /// the message size, and also the processing work on GCS.
 RAY_CONFIG(uint64_t, task_events_send_batch_size, 10 * 1000)
 
+/// Approximate byte budget for the task events flushed in a single message.
+/// Events that don't fit in the budget stay buffered for the next flush
+/// interval, so one oversized flush cannot stall the io thread or overload
+/// GCS. Setting the value to 0 or below (default -1) disables the budget and
+/// limits each flush only by `task_events_send_batch_size`.
+RAY_CONFIG(int64_t, task_events_max_bytes_per_flush, -1)
+
 /// Max number of task events to be written in a single flush iteration. This
 /// caps the number of file writes per iteration.
 RAY_CONFIG(uint64_t, export_task_events_write_batch_size, 10 * 1000)
@@ -552,6 +1222,12 @@ RAY_CONFIG(std::string, metric_cardinality_level, "legacy")
 /// using OpenCensus.
 RAY_CONFIG(bool, enable_open_telemetry, true)
 
+/// Max number of distinct tag sets an OpenTelemetry gauge metric retains per
+/// export interval. Further tag sets are dropped and surfaced through an
+/// overflow series tagged ray_metric_overflow="true" whose value is the number
+/// of dropped data points. 0 means unlimited.
+RAY_CONFIG(int64_t, open_telemetry_max_series_per_gauge, 10000)
+
 /// Whether to disable the OpenTelemetry SDK logs. They are disabled by default
 /// to prevent noisy gRPC errors during shutdown.
 /// See https://github.com/ray-project/ray/issues/58256 for details.
@@ -563,6 +1239,14 @@ RAY_CONFIG(bool, enable_ray_event, false)
 
 RAY_CONFIG(uint64_t, ray_event_recorder_max_queued_events, 10000)
 
+/// Whether the ray event recorder adaptively samples task-class events (task
+/// definition/lifecycle/profile events) when its ingest queue fills up. Sampling
+/// starts at half occupancy and tightens to 1-in-8 as the queue approaches
+/// capacity; node, actor and driver job events are never sampled. The number of
+/// sampled-out events is reported to the event aggregator so consumers can
+/// rescale task counts.
+RAY_CONFIG(bool, ray_event_recorder_adaptive_task_sampling_enabled, false)
+
 /// Comma separated list of components we enable grpc metrics collection for.
 /// Only effective if `enable_metrics_collection` is also true. Will have some performance
 /// degredations.
@@ -584,9 +1268,46 @@ RAY_CONFIG(std::string, enable_grpc_metrics_collection_for, "")
 /// A probe task is only posted after a previous probe task has completed.
 RAY_CONFIG(int64_t, io_context_event_loop_lag_collection_interval_ms, 10000)
 
+/// Whether additive metrics (Count, Sum) buffer observations in thread-local
+/// pre-aggregation cells, flushed every
+/// metric_preaggregation_flush_interval_ms (and at thread exit), instead of
+/// recording each observation through the metric backend's global lock. Only
+/// takes effect with the OpenTelemetry backend (enable_open_telemetry), whose
+/// counter instruments add the recorded value. Metrics recorded through
+/// short-lived Metric instances must not enable this: buffered cells hold a
+/// pointer to the metric until the next flush.
+RAY_CONFIG(bool, metric_preaggregation_enabled, false)
+
+/// Flush interval for thread-local metric pre-aggregation cells.
+RAY_CONFIG(int64_t, metric_preaggregation_flush_interval_ms, 1000)
+
+/// Whether to sample lock wait times at ProfiledMutex call sites and export
+/// them as call-site tagged metrics. See ray/util/contention_profiler.h.
+RAY_CONFIG(bool, lock_contention_profiling_enabled, false)
+
+/// Sample every Nth lock acquisition per thread when lock contention
+/// profiling is enabled.
+RAY_CONFIG(int64_t, lock_contention_profiling_sample_every_n, 128)
+
 // Max number bytes of inlined objects in a task rpc request/response.
 RAY_CONFIG(int64_t, task_rpc_inlined_bytes_limit, 10 * 1024 * 1024)
 
+// If true, workers shrink the per-object task return inlining threshold while
+// their local memory store is under pressure, putting large returns in plasma
+// instead of duplicating them into task replies and downstream task specs.
+RAY_CONFIG(bool, adaptive_task_return_inlining, false)
+
+// Number of bytes held in a worker's local memory store above which the worker
+// is considered under memory pressure for adaptive task return inlining.
+RAY_CONFIG(int64_t,
+           adaptive_task_return_inlining_memory_pressure_bytes,
+           200 * 1024 * 1024)
+
+// Per-object inlining threshold used in place of max_direct_call_object_size
+// while a worker is under memory pressure. Returns below this size are always
+// inlined since putting them in plasma costs more than the duplication.
+RAY_CONFIG(int64_t, adaptive_task_return_inlining_min_bytes, 16 * 1024)
+
 /// Maximum number of pending lease requests per scheduling category
 /// -1 means that Ray should automatically set this to the number of nodes in
 /// the cluster.
@@ -622,6 +1343,23 @@ RAY_CONFIG(bool, enable_worker_prestart, false)
 /// TODO(clarng): reconcile with enable_worker_prestart
 RAY_CONFIG(bool, prestart_worker_first_driver, true)
 
+/// Path of the file in which the raylet periodically records the steady-state
+/// per-language/runtime-env worker counts. On restart, the recorded counts are
+/// preforked during worker pool startup so the first wave of leases schedules
+/// onto warm workers instead of paying worker cold-start latency. An empty
+/// string disables the feature.
+RAY_CONFIG(std::string, worker_prestart_profile_path, "")
+
+/// The interval at which the worker prestart profile is refreshed on disk.
+RAY_CONFIG(uint64_t, worker_prestart_profile_update_interval_ms, 60000)
+
+/// Whether non-decoupled child processes are launched with posix_spawn
+/// instead of fork+exec. posix_spawn does not duplicate the parent's page
+/// tables, so launching workers from a raylet with a large address space
+/// drops from tens of milliseconds to microseconds per process. Decoupled
+/// processes always use the fork path.
+RAY_CONFIG(bool, process_posix_spawn_enabled, false)
+
 /// The interval of periodic idle worker killing. Value of 0 means worker capping is
 /// disabled.
 RAY_CONFIG(uint64_t, kill_idle_workers_interval_ms, 200)
@@ -629,6 +1367,23 @@ RAY_CONFIG(uint64_t, kill_idle_workers_interval_ms, 200)
 /// The idle time threshold for an idle worker to be killed.
 RAY_CONFIG(int64_t, idle_worker_killing_time_threshold_ms, 1000)
 
+/// Multiplier applied to the measured runtime env setup time of a worker when
+/// computing how long it may stay idle before becoming killable. Workers whose
+/// runtime envs were expensive to build survive idle churn proportionally
+/// longer since recreating them is expensive. A value of 0 disables the
+/// extension.
+RAY_CONFIG(double, idle_worker_env_setup_cost_multiplier, 0.0)
+
+/// The number of idle workers to keep pinned per runtime env whose measured
+/// setup time is at least `expensive_runtime_env_setup_threshold_ms`. Pinned
+/// workers are not killed to enforce the idle worker pool soft limit. A value
+/// of 0 disables pinning.
+RAY_CONFIG(int64_t, min_idle_workers_per_expensive_runtime_env, 0)
+
+/// The measured runtime env setup time above which a runtime env is considered
+/// expensive for idle worker pinning.
+RAY_CONFIG(int64_t, expensive_runtime_env_setup_threshold_ms, 10000)
+
 /// The soft limit of the number of workers to keep around.
 /// We apply this limit to the idle workers instead of total workers,
 /// because the total number of workers used depends on the
@@ -638,6 +1393,20 @@ RAY_CONFIG(int64_t, num_workers_soft_limit, -1)
 // The interval where metrics are exported in milliseconds.
 RAY_CONFIG(uint64_t, metrics_report_interval_ms, 10000)
 
+/// If enabled, the raylet and GCS sample heap allocations and attribute the
+/// estimated live bytes to subsystem tags, exported periodically as the
+/// `memory_telemetry_estimated_bytes` gauge. Sampling costs roughly one
+/// side-table probe per `memory_telemetry_sample_period` allocations plus one
+/// probe per free while samples are outstanding.
+RAY_CONFIG(bool, memory_telemetry_enabled, false)
+
+/// Sample every Nth heap allocation per thread when memory telemetry is
+/// enabled.
+RAY_CONFIG(int64_t, memory_telemetry_sample_period, 1021)
+
+/// The interval at which the estimated per-tag live bytes are exported.
+RAY_CONFIG(uint64_t, memory_telemetry_report_interval_ms, 10000)
+
 /// Enable the task timeline. If this is enabled, certain events such as task
 /// execution are profiled and sent to the GCS.
 /// This requires RAY_task_events_report_interval_ms=0, so that events will
@@ -693,9 +1462,54 @@ RAY_CONFIG(int64_t, max_spilling_file_size_bytes, -1)
 /// take more than this percentage of the available memory.
 RAY_CONFIG(float, object_spilling_threshold, 0.8)
 
+/// If set to a positive number of seconds, objects that were restored from
+/// external storage within this window are only spilled again when no other
+/// pinned object is spillable. This dampens spill-restore thrash, where an
+/// object is spilled to free memory and then pulled right back for a queued
+/// lease. Set to 0 to disable.
+RAY_CONFIG(int64_t, object_spilling_restored_object_backoff_s, 0)
+
+/// If set to a non-negative value below object_spilling_threshold, the raylet
+/// starts spilling at this utilization instead whenever the pull manager has
+/// pull requests queued for lack of object store memory. Queued pulls are
+/// demand that is already known to need object store memory, so this spills
+/// ahead of it rather than waiting for the static threshold. Set to -1 to
+/// disable.
+RAY_CONFIG(float, object_spilling_queued_pull_threshold, -1)
+
 /// Maximum number of objects that can be fused into a single file.
 RAY_CONFIG(int64_t, max_fused_object_count, 2000)
 
+/// Whether the raylet writes spilled objects to local filesystem storage
+/// itself, straight from the plasma shared-memory mapping, instead of routing
+/// them through a Python IO worker. This avoids copying the object bytes into
+/// the worker's address space and the IPC round trip per spill batch. Only
+/// takes effect when the external storage type is the local filesystem.
+RAY_CONFIG(bool, object_spilling_direct_fs_write, false)
+
+/// Target number of spill batches in flight per spill directory when
+/// object_spilling_direct_fs_write is enabled. Each directory gets this many
+/// write threads, so with the spill directories on separate devices this is
+/// the per-device queue depth. Raise it to saturate devices (e.g. NVMe) that
+/// need more than one outstanding write.
+RAY_CONFIG(int64_t, object_spilling_direct_fs_queue_depth_per_directory, 1)
+
+/// If enabled, the plasma store restores spilled objects by memory-mapping
+/// the spill file region named by the spill URL and serving Get straight
+/// from the file-backed mapping, instead of reading the bytes back into a
+/// fresh shared-memory allocation through an IO worker. The mapping is
+/// dropped when the object is evicted. Only takes effect when the external
+/// storage type is the local filesystem.
+RAY_CONFIG(bool, object_spilling_mmap_restore, false)
+
+/// If enabled, the raylet keeps an append-only manifest of the spilled-object
+/// URL mapping in the first spill directory, flushed once per spill batch,
+/// and replays it on startup. After a raylet restart the objects spilled by
+/// the previous raylet remain restorable (and eventually deletable) instead
+/// of sitting on disk unreferenced until the directory is cleaned up. Only
+/// takes effect when the external storage type is the local filesystem.
+RAY_CONFIG(bool, object_spilling_manifest_enabled, false)
+
 /// Grace period until we throw the OOM error to the application in seconds.
 /// In unlimited allocation mode, this is the time delay prior to fallback allocating.
 RAY_CONFIG(int64_t, oom_grace_period_s, 2)
@@ -717,6 +1531,13 @@ RAY_CONFIG(uint64_t, local_fs_monitor_interval_ms, 100)
 /// dependency locality when choosing a worker for leasing.
 RAY_CONFIG(bool, locality_aware_leasing_enabled, true)
 
+/// The weight given to dependency bytes that are only available in spilled
+/// form on a node, relative to bytes that are in the node's object store
+/// memory. Landing on a node with a spilled copy avoids the network transfer
+/// but still pays for the restore, so spilled bytes count for less. Must be
+/// in [0, 1]; 1 restores the old behavior of treating all copies equally.
+RAY_CONFIG(float, locality_aware_leasing_spilled_bytes_weight, 0.5)
+
 /* Configuration parameters for logging */
 /// Parameters for log rotation. This value is equivalent to RotatingFileHandler's
 /// maxBytes argument.
@@ -742,6 +1563,65 @@ RAY_CONFIG(uint32_t, core_worker_rpc_server_reconnect_timeout_base_s, 1)
 /// Maximum timeout for core worker grpc server reconnection.
 RAY_CONFIG(uint32_t, core_worker_rpc_server_reconnect_timeout_max_s, 60)
 
+/// Number of shards (rounded up to a power of two) the in-process memory
+/// store is split into, each with its own lock. 1 keeps a single lock;
+/// increase for workloads like async actors with many concurrent coroutines,
+/// where every small-result Put/Get otherwise contends on one mutex.
+RAY_CONFIG(uint64_t, core_worker_memory_store_num_shards, 1)
+
+/// ray.get batches of distinct object ids up to this size skip the
+/// per-call hash set and map bookkeeping and resolve memory store results
+/// positionally. Objects promoted to plasma still go through the regular
+/// plasma fetch. 0 disables the fast path.
+RAY_CONFIG(size_t, core_worker_small_get_max_batch_size, 8)
+
+/// Task results whose data plus metadata fit in this many bytes are stored in
+/// the in-process memory store inside a single recycled arena block instead of
+/// separately heap-allocated data and metadata buffers. This avoids three
+/// allocations per small task result, which matters for workloads producing
+/// hundreds of thousands of tiny results per second. 0 disables inline
+/// storage.
+RAY_CONFIG(int64_t, core_worker_memory_store_inline_object_max_bytes, 0)
+
+/// If enabled, the core worker coalesces its retry and backoff timers (e.g.
+/// task cancellation retries and keep-warm lease returns) onto a shared timer
+/// wheel instead of scheduling one asio deadline timer each. This keeps the
+/// io_context timer heap small when many timers are outstanding, at the cost
+/// of timers firing up to timer_wheel_resolution_ms late.
+RAY_CONFIG(bool, core_worker_use_timer_wheel, false)
+
+/// Tick resolution of the shared timer wheel. Timers coalesced onto the wheel
+/// fire at the first tick at or after their deadline.
+RAY_CONFIG(uint64_t, timer_wheel_resolution_ms, 10)
+
+/// Number of slots in the shared timer wheel. Timers whose deadlines hash to
+/// the same slot expire in one batch.
+RAY_CONFIG(size_t, timer_wheel_num_slots, 512)
+
+/// If enabled, the async actor fiber runner replaces boost.fiber's default
+/// round-robin scheduler with a weighted fair scheduler that resumes runnable
+/// fibers in order of accumulated runtime divided by weight, so a CPU-heavy
+/// coroutine cannot starve latency-critical coroutines in the same
+/// concurrency group. Also starts a starvation monitor fiber that exports
+/// scheduling stats through the worker's metrics.
+RAY_CONFIG(bool, fiber_fair_scheduling_enabled, false)
+
+/// How often the starvation monitor fiber harvests the fiber scheduler
+/// counters into metrics. Only used when fiber fair scheduling is enabled.
+RAY_CONFIG(int64_t, fiber_starvation_check_interval_milliseconds, 1000)
+
+/// Log a warning when a runnable fiber waited at least this long to be
+/// resumed during one starvation check interval. 0 disables the warning.
+RAY_CONFIG(int64_t, fiber_starvation_warning_threshold_milliseconds, 5000)
+
+/// If enabled, each PeriodicalRunner schedules its periodic tasks on one
+/// shared timer wheel instead of one asio deadline timer per task, with the
+/// tasks phase-spread within their period. This cuts the number of
+/// independent event-loop wakeups in processes that run dozens of periodic
+/// tasks (e.g. the raylet). Tasks whose period is below
+/// timer_wheel_resolution_ms keep a dedicated timer.
+RAY_CONFIG(bool, periodical_runner_use_timer_wheel, false)
+
 /// Maximum amount of memory that will be used by running tasks' args.
 RAY_CONFIG(float, max_task_args_memory_fraction, 0.7)
 
@@ -757,6 +1637,20 @@ RAY_CONFIG(int, publish_batch_size, 5000)
 /// subject to this cap.
 RAY_CONFIG(int, publisher_entity_buffer_max_bytes, 1 << 30)
 
+/// If enabled, owner workers coalesce object eviction publishes fired in the
+/// same burst (e.g. freeing a large list of objects) into batched publishes, so
+/// a mass eviction flushes each subscriber's long-poll connection once per
+/// batch instead of once per object. Publishing is deferred by at most one
+/// event loop turn.
+RAY_CONFIG(bool, batch_object_eviction_publishes_enabled, false)
+
+/// Byte credit a subscriber advertises in each pubsub long polling request: the
+/// max total bytes of published messages the publisher may pack into the reply.
+/// This bounds how much a fast publisher can push to a slow subscriber per poll.
+/// 0 disables the subscriber-side limit; the publisher still applies its own
+/// max_grpc_message_size threshold.
+RAY_CONFIG(int64_t, subscriber_publish_credit_bytes, 0)
+
 /// The maximum command batch size.
 RAY_CONFIG(int64_t, max_command_batch_size, 2000)
 
@@ -922,6 +1816,25 @@ RAY_CONFIG(int64_t, health_check_period_ms, 3000)
 RAY_CONFIG(int64_t, health_check_timeout_ms, 10000)
 /// The threshold to consider a node dead.
 RAY_CONFIG(int64_t, health_check_failure_threshold, 5)
+/// Random jitter in [0, health_check_jitter_ms) added to every scheduled health
+/// check delay so that probes in a large cluster spread out instead of bunching
+/// into periodic CPU spikes. 0 keeps the fixed schedule.
+RAY_CONFIG(int64_t, health_check_jitter_ms, 0)
+/// Upper bound for adaptive health check spacing. When larger than
+/// health_check_period_ms, the probe interval of a node stretches toward this
+/// bound while its checks keep passing and snaps back to health_check_period_ms
+/// on the first failure, so stable nodes are probed less often and flapping
+/// nodes more. 0 keeps the fixed interval.
+RAY_CONFIG(int64_t, health_check_max_period_ms, 0)
+/// Maximum number of health check RPCs in flight at once. Probes beyond the
+/// limit are deferred with jitter. 0 means unlimited.
+RAY_CONFIG(int64_t, health_check_max_inflight_probes, 0)
+/// Threshold for the optional phi-accrual failure detector. When positive, a
+/// node is also marked dead once the suspicion level computed from its probe
+/// success history exceeds this value, which usually detects failures faster
+/// than waiting for health_check_failure_threshold missed probes. 0 keeps
+/// counting-only detection.
+RAY_CONFIG(double, health_check_phi_threshold, 0.0)
 
 /// Thread pool size for sending replies in grpc server (system components: raylet, GCS).
 RAY_CONFIG(int64_t,
@@ -998,6 +1911,13 @@ RAY_CONFIG(int, object_manager_client_connection_num, 4)
 // Update this to overwrite it.
 RAY_CONFIG(int, object_manager_rpc_threads_num, 0)
 
+// Number of threads serving read-mostly NodeManager RPCs (GetResourceLoad,
+// GetSystemConfig) on a separate io_context so they run in parallel with the
+// main raylet event loop. GetResourceLoad is served from a snapshot that the
+// main thread refreshes every report_resources_period_milliseconds. 0 keeps
+// the existing behavior of handling these RPCs on the main event loop.
+RAY_CONFIG(int, node_manager_read_rpc_threads_num, 0)
+
 // Write export API event of all resource types to file if enabled.
 // RAY_enable_export_api_write_config will not be considered if
 // this is enabled.
@@ -1025,6 +1945,12 @@ RAY_CONFIG(bool, enable_core_worker_ray_event_to_aggregator, false)
 // Configuration for pipe logger buffer size.
 RAY_CONFIG(uint64_t, pipe_logger_read_buf_size, 1024)
 
+// Whether stream redirection with rotation but without tee forwards bytes
+// from the pipe into the log file with splice(2) instead of a userspace
+// read/write loop (Linux only). Since bytes are never inspected, files rotate
+// at chunk rather than line granularity.
+RAY_CONFIG(bool, pipe_logger_splice_enabled, false)
+
 // Configuration to enable or disable the infeasible task early termination feature. If
 // set to true, whenever the autoscaler detects that a task is infeasible, the task will
 // be cancelled with SCHEDULING_CANCELLED_UNSCHEDULABLE state. If set to false, the task
@@ -1073,6 +1999,61 @@ RAY_CONFIG(size_t, gcs_resource_broadcast_max_batch_size, 1)
 // `gcs_resource_broadcast_max_batch_size != 1`.
 RAY_CONFIG(uint64_t, gcs_resource_broadcast_max_batch_delay_ms, 0)
 
+// Whether the ray syncer sends RESOURCE_VIEW updates as deltas carrying only
+// the resource and label entries that changed since the previous message on
+// the stream. Delta support is advertised per connection when the stream is
+// established, so peers running versions without delta support keep
+// receiving full messages.
+RAY_CONFIG(bool, syncer_resource_view_delta_updates, false)
+
+// When delta updates are enabled, send a full RESOURCE_VIEW message every
+// this many messages per node on a stream so that a receiver whose
+// reconstructed state was lost or corrupted recovers.
+RAY_CONFIG(int64_t, syncer_resource_view_delta_anchor_interval, 100)
+
+// Whether a node joining the cluster bootstraps its view through a single
+// compressed unary fetch of the upstream's cluster view instead of receiving
+// it message by message through the sync stream. The joiner advertises the
+// snapshot id when opening the stream, so the upstream only replays the
+// messages that arrived after the snapshot was taken.
+RAY_CONFIG(bool, syncer_bootstrap_snapshot, false)
+
+// How many recently served bootstrap snapshots the upstream remembers. A
+// joiner presenting an id that has been evicted simply gets the full
+// initial push.
+RAY_CONFIG(int64_t, syncer_bootstrap_snapshot_cache_size, 8)
+
+// When set to "host:port", this raylet connects its syncer to the given
+// aggregator raylet instead of directly to the GCS, forming an aggregation
+// tree: the aggregator merges and forwards sync messages between its
+// downstream raylets and its own upstream. This keeps the GCS reactor from
+// being the broadcast bottleneck at large node counts. Empty (the default)
+// keeps the star topology.
+RAY_CONFIG(std::string, syncer_aggregator_address, "")
+
+// Number of consecutive short-lived connection attempts to the aggregator
+// before the raylet gives up on it and re-parents to the GCS directly
+// (tree repair). Only used when syncer_aggregator_address is set.
+RAY_CONFIG(int64_t, syncer_aggregator_fallback_attempts, 5)
+
+// Whether the local resource manager suppresses RESOURCE_VIEW sync messages
+// whose content is identical to the previously reported one. The resource
+// version counter is bumped on every resource acquisition and release, so a
+// busy node whose load returns to the same level between reports would
+// otherwise rebroadcast an identical view to the whole cluster.
+RAY_CONFIG(bool, syncer_suppress_unchanged_resource_view, false)
+
 // Whether to enable/disable multiple gRPC connections to improve object transfer
 // throughput.
 RAY_CONFIG(bool, experimental_object_manager_enable_multiple_connections, false)
+
+// Number of buffered versions per experimental mutable object channel. With
+// the default of 1, each write blocks until every reader has read and
+// released the previous version. A value > 1 divides the channel buffer into
+// that many version slots so fast readers proceed without waiting for slow
+// ones, slow readers skip to the latest version, and the writer only blocks
+// while a reader still holds the oldest buffered version. Must be the same
+// for all workers of a cluster and at most PlasmaObjectHeader::kMaxRingSlots.
+// Note that each version can then only be as large as the allocated channel
+// buffer size divided by this value.
+RAY_CONFIG(int64_t, experimental_mutable_object_ring_slots, 1)
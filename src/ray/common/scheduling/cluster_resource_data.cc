@@ -129,14 +129,17 @@ bool NodeResources::NodeLabelMatchesConstraint(const LabelConstraint &constraint
   const auto &values = constraint.GetLabelValues();
 
   const auto &node_labels = this->labels;
+  auto label_it = node_labels.find(key);
+  const bool label_in_values =
+      label_it != node_labels.end() && values.contains(label_it->second);
   if (match_operator == LabelSelectorOperator::LABEL_IN) {
     // Check for equals or in() labels
-    if (node_labels.contains(key) && values.contains(node_labels.at(key))) {
+    if (label_in_values) {
       return true;
     }
   } else if (match_operator == LabelSelectorOperator::LABEL_NOT_IN) {
     // Check for not equals (!) or not in (!in()) labels
-    if (!(node_labels.contains(key) && values.contains(node_labels.at(key)))) {
+    if (!label_in_values) {
       return true;
     }
   } else {
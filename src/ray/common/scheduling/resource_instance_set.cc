@@ -119,6 +119,29 @@ NodeResourceInstanceSet &NodeResourceInstanceSet::Set(ResourceID resource_id,
   return *this;
 }
 
+std::vector<FixedPoint> *NodeResourceInstanceSet::GetMutable(ResourceID resource_id) {
+  auto it = resources_.find(resource_id);
+  if (it != resources_.end()) {
+    return &it->second;
+  }
+  if (resource_id.IsImplicitResource()) {
+    // Materialize the default single full instance so the caller can mutate it.
+    return &resources_.emplace(resource_id, std::vector<FixedPoint>({FixedPoint(1)}))
+                .first->second;
+  }
+  return nullptr;
+}
+
+void NodeResourceInstanceSet::TrimDefaultImplicitResource(ResourceID resource_id) {
+  if (!resource_id.IsImplicitResource()) {
+    return;
+  }
+  auto it = resources_.find(resource_id);
+  if (it != resources_.end() && it->second[0] == FixedPoint(1)) {
+    resources_.erase(it);
+  }
+}
+
 FixedPoint NodeResourceInstanceSet::Sum(ResourceID resource_id) const {
   auto it = resources_.find(resource_id);
   if (it == resources_.end()) {
@@ -294,10 +317,13 @@ NodeResourceInstanceSet::TryAllocate(const ResourceSet &resource_demands) {
 
 std::optional<std::vector<FixedPoint>> NodeResourceInstanceSet::TryAllocate(
     ResourceID resource_id, FixedPoint demand) {
-  std::vector<FixedPoint> available = Get(resource_id);
-  if (available.empty()) {
+  std::vector<FixedPoint> *available_ptr = GetMutable(resource_id);
+  if (available_ptr == nullptr || available_ptr->empty()) {
     return std::nullopt;
   }
+  // The available instances are updated in place; any partial updates made on
+  // a path that fails the allocation are rolled back before returning.
+  std::vector<FixedPoint> &available = *available_ptr;
 
   std::vector<FixedPoint> allocation(available.size());
   FixedPoint remaining_demand = demand;
@@ -307,10 +333,11 @@ std::optional<std::vector<FixedPoint>> NodeResourceInstanceSet::TryAllocate(
     if (available[0] >= remaining_demand) {
       available[0] -= remaining_demand;
       allocation[0] = remaining_demand;
-      Set(resource_id, std::move(available));
+      TrimDefaultImplicitResource(resource_id);
       return std::make_optional<std::vector<FixedPoint>>(std::move(allocation));
     } else {
       // Not enough capacity.
+      TrimDefaultImplicitResource(resource_id);
       return std::nullopt;
     }
   }
@@ -337,7 +364,11 @@ std::optional<std::vector<FixedPoint>> NodeResourceInstanceSet::TryAllocate(
   }
 
   if (remaining_demand >= 1.) {
-    // Cannot satisfy a demand greater than one if no unit capacity resource is available.
+    // Cannot satisfy a demand greater than one if no unit capacity resource is
+    // available. Return the full instances taken above.
+    for (size_t i = 0; i < available.size(); i++) {
+      available[i] += allocation[i];
+    }
     return std::nullopt;
   }
 
@@ -355,6 +386,10 @@ std::optional<std::vector<FixedPoint>> NodeResourceInstanceSet::TryAllocate(
       }
     }
     if (idx_best_fit == -1) {
+      // Return the full instances taken above.
+      for (size_t i = 0; i < available.size(); i++) {
+        available[i] += allocation[i];
+      }
       return std::nullopt;
     } else {
       allocation[idx_best_fit] = remaining_demand;
@@ -362,14 +397,14 @@ std::optional<std::vector<FixedPoint>> NodeResourceInstanceSet::TryAllocate(
     }
   }
 
-  Set(resource_id, std::move(available));
   return std::make_optional<std::vector<FixedPoint>>(std::move(allocation));
 }
 
 void NodeResourceInstanceSet::AllocateWithReference(
     const std::vector<FixedPoint> &ref_allocation, ResourceID resource_id) {
-  std::vector<FixedPoint> available = Get(resource_id);
-  RAY_CHECK(!available.empty());
+  std::vector<FixedPoint> *available_ptr = GetMutable(resource_id);
+  RAY_CHECK(available_ptr != nullptr && !available_ptr->empty());
+  std::vector<FixedPoint> &available = *available_ptr;
   RAY_CHECK_EQ(available.size(), ref_allocation.size());
 
   for (size_t i = 0; i < ref_allocation.size(); i++) {
@@ -384,19 +419,18 @@ void NodeResourceInstanceSet::AllocateWithReference(
     }
     available[i] -= ref_allocation[i];
   }
-
-  Set(resource_id, std::move(available));
 }
 
 void NodeResourceInstanceSet::Free(ResourceID resource_id,
                                    const std::vector<FixedPoint> &allocation) {
-  std::vector<FixedPoint> available = Get(resource_id);
+  std::vector<FixedPoint> *available_ptr = GetMutable(resource_id);
+  RAY_CHECK(available_ptr != nullptr);
+  std::vector<FixedPoint> &available = *available_ptr;
   RAY_CHECK_EQ(allocation.size(), available.size());
   for (size_t i = 0; i < available.size(); i++) {
     available[i] += allocation[i];
   }
-
-  Set(resource_id, std::move(available));
+  TrimDefaultImplicitResource(resource_id);
 }
 
 void NodeResourceInstanceSet::Add(ResourceID resource_id,
@@ -420,7 +454,9 @@ std::vector<FixedPoint> NodeResourceInstanceSet::Subtract(
     ResourceID resource_id,
     const std::vector<FixedPoint> &instances,
     bool allow_going_negative) {
-  std::vector<FixedPoint> available = Get(resource_id);
+  std::vector<FixedPoint> *available_ptr = GetMutable(resource_id);
+  RAY_CHECK(available_ptr != nullptr);
+  std::vector<FixedPoint> &available = *available_ptr;
   RAY_CHECK_EQ(available.size(), instances.size());
 
   std::vector<FixedPoint> underflow(available.size(), 0.);
@@ -440,7 +476,7 @@ std::vector<FixedPoint> NodeResourceInstanceSet::Subtract(
     }
   }
 
-  Set(resource_id, std::move(available));
+  TrimDefaultImplicitResource(resource_id);
   return underflow;
 }
 
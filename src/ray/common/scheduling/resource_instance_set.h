@@ -163,6 +163,18 @@ class NodeResourceInstanceSet {
   void AllocateWithReference(const std::vector<FixedPoint> &ref_allocation,
                              ResourceID resource_id);
 
+  /// Return a mutable pointer to the stored instance vector so the
+  /// allocate/free hot paths can update values in place instead of copying the
+  /// vector out and Set()-ing it back (which re-parses pg-formatted resource
+  /// names every time). Implicit resources are materialized at their default
+  /// value on first use. Returns nullptr if the resource doesn't exist and
+  /// isn't implicit.
+  std::vector<FixedPoint> *GetMutable(ResourceID resource_id);
+
+  /// Drop an implicit resource entry that is back at its default single full
+  /// instance, preserving the invariant that default values are not stored.
+  void TrimDefaultImplicitResource(ResourceID resource_id);
+
   /// Map from the resource IDs to the resource instance values.
   absl::flat_hash_map<ResourceID, std::vector<FixedPoint>> resources_;
 
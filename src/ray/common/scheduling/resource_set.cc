@@ -48,6 +48,10 @@ ResourceSet::ResourceSet(const absl::flat_hash_map<std::string, double> &resourc
 }
 
 bool ResourceSet::operator==(const ResourceSet &other) const {
+  if (custom_count_ == 0 && other.custom_count_ == 0) {
+    // Both sets are fully described by their fixed predefined-resource slots.
+    return predefined_values_ == other.predefined_values_;
+  }
   return this->resources_ == other.resources_;
 }
 
@@ -64,36 +68,89 @@ ResourceSet ResourceSet::operator-(const ResourceSet &other) const {
 }
 
 ResourceSet &ResourceSet::operator+=(const ResourceSet &other) {
+  if (other.custom_count_ == 0) {
+    // `other` only holds predefined resources, so apply its fixed slots
+    // directly instead of walking its map.
+    for (size_t i = 0; i < PredefinedResourcesEnum_MAX; i++) {
+      if (other.predefined_values_[i] != 0) {
+        Set(ResourceID(i), predefined_values_[i] + other.predefined_values_[i]);
+      }
+    }
+    return *this;
+  }
   for (auto &entry : other.resources_) {
+    FixedPoint new_value;
     auto it = resources_.find(entry.first);
     if (it != resources_.end()) {
       it->second += entry.second;
+      new_value = it->second;
       if (it->second == 0) {
         resources_.erase(it);
+        if (!entry.first.IsPredefinedResource()) {
+          custom_count_--;
+        }
       }
     } else {
       resources_.emplace(entry.first, entry.second);
+      new_value = entry.second;
+      if (!entry.first.IsPredefinedResource()) {
+        custom_count_++;
+      }
+    }
+    if (entry.first.IsPredefinedResource()) {
+      predefined_values_[entry.first.ToInt()] = new_value;
     }
   }
   return *this;
 }
 
 ResourceSet &ResourceSet::operator-=(const ResourceSet &other) {
+  if (other.custom_count_ == 0) {
+    // See operator+=.
+    for (size_t i = 0; i < PredefinedResourcesEnum_MAX; i++) {
+      if (other.predefined_values_[i] != 0) {
+        Set(ResourceID(i), predefined_values_[i] - other.predefined_values_[i]);
+      }
+    }
+    return *this;
+  }
   for (auto &entry : other.resources_) {
+    FixedPoint new_value;
     auto it = resources_.find(entry.first);
     if (it != resources_.end()) {
       it->second -= entry.second;
+      new_value = it->second;
       if (it->second == 0) {
         resources_.erase(it);
+        if (!entry.first.IsPredefinedResource()) {
+          custom_count_--;
+        }
       }
     } else {
       resources_.emplace(entry.first, -entry.second);
+      new_value = -entry.second;
+      if (!entry.first.IsPredefinedResource()) {
+        custom_count_++;
+      }
+    }
+    if (entry.first.IsPredefinedResource()) {
+      predefined_values_[entry.first.ToInt()] = new_value;
     }
   }
   return *this;
 }
 
 bool ResourceSet::operator<=(const ResourceSet &other) const {
+  if (custom_count_ == 0 && other.custom_count_ == 0) {
+    // Both sets only hold predefined resources: compare the fixed slots in a
+    // fixed-length, branch-free loop with no hashing or map iteration. This
+    // covers the dominant {CPU: n} request shape.
+    bool is_subset = true;
+    for (size_t i = 0; i < PredefinedResourcesEnum_MAX; i++) {
+      is_subset &= predefined_values_[i] <= other.predefined_values_[i];
+    }
+    return is_subset;
+  }
   // Check all resources that exist in this.
   for (auto &entry : resources_) {
     auto &this_value = entry.second;
@@ -120,6 +177,9 @@ bool ResourceSet::operator<=(const ResourceSet &other) const {
 bool ResourceSet::IsEmpty() const { return resources_.empty(); }
 
 FixedPoint ResourceSet::Get(ResourceID resource_id) const {
+  if (resource_id.IsPredefinedResource()) {
+    return predefined_values_[resource_id.ToInt()];
+  }
   auto it = resources_.find(resource_id);
   if (it == resources_.end()) {
     return FixedPoint(0);
@@ -130,9 +190,17 @@ FixedPoint ResourceSet::Get(ResourceID resource_id) const {
 
 ResourceSet &ResourceSet::Set(ResourceID resource_id, FixedPoint value) {
   if (value == 0) {
-    resources_.erase(resource_id);
+    if (resources_.erase(resource_id) > 0 && !resource_id.IsPredefinedResource()) {
+      custom_count_--;
+    }
   } else {
-    resources_[resource_id] = value;
+    bool inserted = resources_.insert_or_assign(resource_id, value).second;
+    if (inserted && !resource_id.IsPredefinedResource()) {
+      custom_count_++;
+    }
+  }
+  if (resource_id.IsPredefinedResource()) {
+    predefined_values_[resource_id.ToInt()] = value;
   }
   return *this;
 }
@@ -195,10 +263,16 @@ NodeResourceSet &NodeResourceSet::Set(ResourceID resource_id, FixedPoint value)
   } else {
     resources_[resource_id] = value;
   }
+  if (resource_id.IsPredefinedResource()) {
+    predefined_values_[resource_id.ToInt()] = value;
+  }
   return *this;
 }
 
 FixedPoint NodeResourceSet::Get(ResourceID resource_id) const {
+  if (resource_id.IsPredefinedResource()) {
+    return predefined_values_[resource_id.ToInt()];
+  }
   auto it = resources_.find(resource_id);
   if (it == resources_.end()) {
     return ResourceDefaultValue(resource_id);
@@ -217,7 +291,23 @@ NodeResourceSet &NodeResourceSet::operator-=(const ResourceSet &other) {
 }
 
 bool NodeResourceSet::operator>=(const ResourceSet &other) const {
+  // Compare the fixed predefined-resource slots first. This is a fixed-length
+  // loop over contiguous values with no hashing or branching, which covers
+  // the common case of requests that only demand CPU/GPU/memory/object store
+  // memory.
+  const auto &other_predefined = other.PredefinedResourceValues();
+  bool predefined_feasible = true;
+  for (size_t i = 0; i < PredefinedResourcesEnum_MAX; i++) {
+    predefined_feasible &= predefined_values_[i] >= other_predefined[i];
+  }
+  if (!predefined_feasible) {
+    return false;
+  }
+  // Fall back to the map for custom and implicit resources.
   for (auto &entry : other.Resources()) {
+    if (entry.first.IsPredefinedResource()) {
+      continue;
+    }
     if (Get(entry.first) < entry.second) {
       return false;
     }
@@ -248,6 +338,9 @@ absl::flat_hash_map<std::string, double> NodeResourceSet::GetResourceMap() const
 void NodeResourceSet::RemoveNegative() {
   for (auto it = resources_.begin(); it != resources_.end();) {
     if (it->second < 0) {
+      if (it->first.IsPredefinedResource()) {
+        predefined_values_[it->first.ToInt()] = FixedPoint(0);
+      }
       resources_.erase(it++);
     } else {
       it++;
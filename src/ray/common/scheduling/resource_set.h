@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/range/adaptor/map.hpp>
 #include <memory>
 #include <set>
@@ -103,7 +104,16 @@ class ResourceSet {
   size_t Size() const { return resources_.size(); }
 
   /// Clear the whole set.
-  void Clear() { resources_.clear(); }
+  void Clear() {
+    resources_.clear();
+    predefined_values_.fill(FixedPoint(0));
+    custom_count_ = 0;
+  }
+
+  /// Whether this set only contains predefined resources. Such a set is fully
+  /// described by the fixed predefined-resource slots, which enables the
+  /// comparison and arithmetic fast paths below.
+  bool IsPredefinedOnly() const { return custom_count_ == 0; }
 
   /// Return true if the resource set is empty. False otherwise.
   bool IsEmpty() const;
@@ -131,9 +141,26 @@ class ResourceSet {
 
   const std::string DebugString() const;
 
+  /// Return the values of the predefined resources (indexed by
+  /// PredefinedResourcesEnum), zero for the ones this set doesn't have.
+  const std::array<FixedPoint, PredefinedResourcesEnum_MAX> &PredefinedResourceValues()
+      const {
+    return predefined_values_;
+  }
+
  private:
   /// Map from the resource IDs to the resource values.
   absl::flat_hash_map<ResourceID, FixedPoint> resources_;
+  /// Fixed-slot mirror of the predefined resource values in `resources_`,
+  /// indexed by PredefinedResourcesEnum. Since most resource sets contain
+  /// only predefined resources, this lets the hot feasibility comparisons
+  /// read them without hashing into the map.
+  std::array<FixedPoint, PredefinedResourcesEnum_MAX> predefined_values_ = {};
+  /// Number of entries in `resources_` that are not predefined resources.
+  /// When both operands of a comparison or arithmetic operator are
+  /// predefined-only (the {CPU: n} shape of almost every task request), the
+  /// operator runs over the fixed slots and never touches the map.
+  size_t custom_count_ = 0;
 };
 
 /// Represents a set of node resources and their values.
@@ -197,6 +224,11 @@ class NodeResourceSet {
   /// If the resource value is the default value for the resource
   /// it will be removed from the map.
   absl::flat_hash_map<ResourceID, FixedPoint> resources_;
+  /// Fixed-slot mirror of the predefined resource values in `resources_`,
+  /// indexed by PredefinedResourcesEnum (predefined resources are explicit,
+  /// so their default value is 0). This lets the hot feasibility
+  /// comparisons read them without hashing into the map.
+  std::array<FixedPoint, PredefinedResourcesEnum_MAX> predefined_values_ = {};
 };
 
 }  // namespace ray
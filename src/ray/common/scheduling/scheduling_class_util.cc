@@ -160,36 +160,74 @@ std::string SchedulingClassDescriptor::ResourceSetStr() const {
 absl::Mutex SchedulingClassToIds::mutex_;
 absl::flat_hash_map<SchedulingClassDescriptor, SchedulingClass>
     SchedulingClassToIds::sched_cls_to_id_;
-absl::flat_hash_map<SchedulingClass, SchedulingClassDescriptor>
+absl::node_hash_map<SchedulingClass, SchedulingClassDescriptor>
     SchedulingClassToIds::sched_id_to_cls_;
 int SchedulingClassToIds::next_sched_id_;
 
+namespace {
+
+// Per-thread memo of the global interning tables. Descriptor <-> id mappings
+// are immutable once interned, so a cached entry can never go stale; the
+// caches are only cleared to bound their size. A cache hit answers the common
+// resubmit-same-shape case without touching the global mutex.
+constexpr size_t kSchedulingClassCacheMaxSize = 512;
+thread_local absl::flat_hash_map<SchedulingClassDescriptor, SchedulingClass>
+    tls_sched_cls_to_id_cache;
+// Values point into sched_id_to_cls_, which is a node map whose entries are
+// never erased, so the pointers stay valid for the process lifetime.
+thread_local absl::flat_hash_map<SchedulingClass, SchedulingClassDescriptor *>
+    tls_sched_id_to_cls_cache;
+
+}  // namespace
+
 SchedulingClassDescriptor &SchedulingClassToIds::GetSchedulingClassDescriptor(
     SchedulingClass id) {
-  absl::MutexLock lock(&mutex_);
-  auto it = sched_id_to_cls_.find(id);
-  RAY_CHECK(it != sched_id_to_cls_.end()) << "invalid id: " << id;
-  return it->second;
+  auto cache_it = tls_sched_id_to_cls_cache.find(id);
+  if (cache_it != tls_sched_id_to_cls_cache.end()) {
+    return *cache_it->second;
+  }
+  SchedulingClassDescriptor *descriptor = nullptr;
+  {
+    absl::MutexLock lock(&mutex_);
+    auto it = sched_id_to_cls_.find(id);
+    RAY_CHECK(it != sched_id_to_cls_.end()) << "invalid id: " << id;
+    descriptor = &it->second;
+  }
+  if (tls_sched_id_to_cls_cache.size() >= kSchedulingClassCacheMaxSize) {
+    tls_sched_id_to_cls_cache.clear();
+  }
+  tls_sched_id_to_cls_cache.emplace(id, descriptor);
+  return *descriptor;
 }
 
 SchedulingClass SchedulingClassToIds::GetSchedulingClass(
     const SchedulingClassDescriptor &sched_cls) {
+  auto cache_it = tls_sched_cls_to_id_cache.find(sched_cls);
+  if (cache_it != tls_sched_cls_to_id_cache.end()) {
+    return cache_it->second;
+  }
   SchedulingClass sched_cls_id = 0;
-  absl::MutexLock lock(&mutex_);
-  auto it = sched_cls_to_id_.find(sched_cls);
-  if (it == sched_cls_to_id_.end()) {
-    sched_cls_id = ++next_sched_id_;
-    // TODO(ekl) we might want to try cleaning up task types in these cases
-    if (sched_cls_id > 100) {
-      RAY_LOG_EVERY_MS(WARNING, 1000)
-          << "More than " << sched_cls_id
-          << " types of tasks seen, this may reduce performance.";
+  {
+    absl::MutexLock lock(&mutex_);
+    auto it = sched_cls_to_id_.find(sched_cls);
+    if (it == sched_cls_to_id_.end()) {
+      sched_cls_id = ++next_sched_id_;
+      // TODO(ekl) we might want to try cleaning up task types in these cases
+      if (sched_cls_id > 100) {
+        RAY_LOG_EVERY_MS(WARNING, 1000)
+            << "More than " << sched_cls_id
+            << " types of tasks seen, this may reduce performance.";
+      }
+      sched_cls_to_id_[sched_cls] = sched_cls_id;
+      sched_id_to_cls_.emplace(sched_cls_id, sched_cls);
+    } else {
+      sched_cls_id = it->second;
     }
-    sched_cls_to_id_[sched_cls] = sched_cls_id;
-    sched_id_to_cls_.emplace(sched_cls_id, sched_cls);
-  } else {
-    sched_cls_id = it->second;
   }
+  if (tls_sched_cls_to_id_cache.size() >= kSchedulingClassCacheMaxSize) {
+    tls_sched_cls_to_id_cache.clear();
+  }
+  tls_sched_cls_to_id_cache.emplace(sched_cls, sched_cls_id);
   return sched_cls_id;
 }
 
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/node_hash_map.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/function_descriptor.h"
 #include "ray/common/scheduling/fallback_strategy.h"
@@ -53,9 +54,12 @@ struct SchedulingClassDescriptor {
 
 template <typename H>
 H AbslHashValue(H h, const SchedulingClassDescriptor &sched_cls) {
+  // The interned id stands in for the function descriptor: it is resolved
+  // once per descriptor and equal across descriptors that compare equal, so
+  // hashing here is O(1) instead of re-hashing the descriptor strings.
   return H::combine(std::move(h),
                     sched_cls.resource_set,
-                    sched_cls.function_descriptor->Hash(),
+                    sched_cls.function_descriptor->InternId(),
                     sched_cls.depth,
                     sched_cls.scheduling_strategy,
                     sched_cls.label_selector,
@@ -71,11 +75,19 @@ struct SchedulingClassToIds {
   /// Keep global static id mappings for SchedulingClass for performance.
   static absl::flat_hash_map<SchedulingClassDescriptor, SchedulingClass> sched_cls_to_id_
       ABSL_GUARDED_BY(mutex_);
-  static absl::flat_hash_map<SchedulingClass, SchedulingClassDescriptor> sched_id_to_cls_
-      ABSL_GUARDED_BY(mutex_);
+  /// A node map so descriptors stay at a stable address across rehashes;
+  /// entries are never erased, so references handed out below and pointers in
+  /// the per-thread caches stay valid for the process lifetime.
+  static absl::node_hash_map<SchedulingClass, SchedulingClassDescriptor>
+      sched_id_to_cls_ ABSL_GUARDED_BY(mutex_);
   static int next_sched_id_ ABSL_GUARDED_BY(mutex_);
 
   /// Gets the scheduling class descriptor for the given id.
+  ///
+  /// Both lookups memoize their results in per-thread caches, so repeat
+  /// queries for an already-interned mapping (the common resubmit-same-shape
+  /// case) don't take the mutex. The mappings are immutable once created, so
+  /// the caches can never go stale.
   static SchedulingClassDescriptor &GetSchedulingClassDescriptor(SchedulingClass id);
 
   /// Gets or creates a scheduling class id for the given descriptor.
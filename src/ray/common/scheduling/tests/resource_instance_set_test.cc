@@ -978,6 +978,26 @@ TEST_F(NodeResourceInstanceSetTest, TestSubtract) {
   ASSERT_EQ(underflow, std::vector<FixedPoint>({FixedPoint(0), FixedPoint(0)}));
 }
 
+TEST_F(NodeResourceInstanceSetTest, TestImplicitResourceNotStoredAtDefault) {
+  // Allocation paths mutate the stored instance vectors in place, so an
+  // implicit resource that passes through its default value (a single full
+  // instance) must still end up unstored.
+  NodeResourceInstanceSet r1;
+  const std::string implicit_a = std::string(kImplicitResourcePrefix) + "a";
+
+  // A failed allocation must not leave the implicit resource materialized.
+  auto allocations = r1.TryAllocate(ResourceSet({{implicit_a, FixedPoint(2)}}));
+  ASSERT_FALSE(allocations);
+  ASSERT_TRUE(r1.Resources().empty());
+
+  // Allocate and free a fraction; the entry appears and then disappears.
+  allocations = r1.TryAllocate(ResourceSet({{implicit_a, FixedPoint(0.5)}}));
+  ASSERT_TRUE(allocations);
+  ASSERT_EQ(r1.Resources().size(), 1);
+  r1.Free(ResourceID(implicit_a), std::vector<FixedPoint>({FixedPoint(0.5)}));
+  ASSERT_TRUE(r1.Resources().empty());
+}
+
 TEST_F(NodeResourceInstanceSetTest, TestToNodeResourceSet) {
   NodeResourceInstanceSet r1 =
       NodeResourceInstanceSet(NodeResourceSet({{"CPU", 2}, {"GPU", 2}}));
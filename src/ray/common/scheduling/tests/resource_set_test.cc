@@ -82,6 +82,63 @@ TEST_F(NodeResourceSetTest, TestOperator) {
   ASSERT_FALSE(r3 >= r5);
 }
 
+TEST_F(NodeResourceSetTest, TestPredefinedResourceValuesStayInSync) {
+  // The fixed predefined-resource slots must mirror the map through every
+  // mutation path since the feasibility comparison reads them directly.
+  ResourceSet r1 = ResourceSet({{"CPU", FixedPoint(2)}, {"custom1", FixedPoint(1)}});
+  ASSERT_EQ(r1.PredefinedResourceValues()[PredefinedResourcesEnum::CPU], 2);
+  r1 += ResourceSet({{"CPU", FixedPoint(1)}, {"GPU", FixedPoint(1)}});
+  ASSERT_EQ(r1.PredefinedResourceValues()[PredefinedResourcesEnum::CPU], 3);
+  ASSERT_EQ(r1.PredefinedResourceValues()[PredefinedResourcesEnum::GPU], 1);
+  r1 -= ResourceSet({{"CPU", FixedPoint(3)}});
+  ASSERT_EQ(r1.PredefinedResourceValues()[PredefinedResourcesEnum::CPU], 0);
+  ASSERT_FALSE(r1.Has(ResourceID::CPU()));
+  r1.Clear();
+  ASSERT_EQ(r1.PredefinedResourceValues()[PredefinedResourcesEnum::GPU], 0);
+
+  NodeResourceSet n1 = NodeResourceSet({{"CPU", 4}, {"GPU", 1}, {"custom1", 1}});
+  ASSERT_TRUE(n1 >= ResourceSet({{"CPU", FixedPoint(4)}, {"GPU", FixedPoint(1)}}));
+  ASSERT_FALSE(n1 >= ResourceSet({{"CPU", FixedPoint(5)}}));
+  ASSERT_FALSE(n1 >= ResourceSet({{"custom1", FixedPoint(2)}}));
+  n1.Set(ResourceID::CPU(), -1);
+  n1.RemoveNegative();
+  ASSERT_EQ(n1.Get(ResourceID::CPU()), 0);
+  ASSERT_TRUE(n1 >= ResourceSet({{"GPU", FixedPoint(1)}}));
+  ASSERT_FALSE(n1 >= ResourceSet({{"CPU", FixedPoint(1)}}));
+}
+
+TEST_F(NodeResourceSetTest, TestPredefinedOnlyFastPaths) {
+  // Predefined-only sets take fixed-slot fast paths in <=, ==, += and -=;
+  // they must agree with the map-based general path through every transition
+  // in and out of predefined-only shape.
+  ResourceSet cpu1 = ResourceSet({{"CPU", FixedPoint(1)}});
+  ResourceSet cpu2 = ResourceSet({{"CPU", FixedPoint(2)}});
+  ASSERT_TRUE(cpu1.IsPredefinedOnly());
+  ASSERT_TRUE(cpu1 <= cpu2);
+  ASSERT_FALSE(cpu2 <= cpu1);
+  ASSERT_EQ(cpu1 + cpu1, cpu2);
+  ASSERT_EQ(cpu2 - cpu1, cpu1);
+  ASSERT_TRUE((cpu1 - cpu1).IsEmpty());
+
+  // Adding and removing a custom resource toggles the shape.
+  ResourceSet mixed = cpu1;
+  mixed.Set(ResourceID("custom1"), FixedPoint(1));
+  ASSERT_FALSE(mixed.IsPredefinedOnly());
+  ASSERT_FALSE(mixed <= cpu2);
+  ASSERT_TRUE(cpu1 <= mixed);
+  ASSERT_NE(mixed, cpu1);
+  mixed.Set(ResourceID("custom1"), FixedPoint(0));
+  ASSERT_TRUE(mixed.IsPredefinedOnly());
+  ASSERT_EQ(mixed, cpu1);
+
+  // The general +=/-= path also maintains the shape tracking.
+  mixed += ResourceSet({{"custom1", FixedPoint(1)}, {"GPU", FixedPoint(1)}});
+  ASSERT_FALSE(mixed.IsPredefinedOnly());
+  mixed -= ResourceSet({{"custom1", FixedPoint(1)}});
+  ASSERT_TRUE(mixed.IsPredefinedOnly());
+  ASSERT_EQ(mixed, ResourceSet({{"CPU", FixedPoint(1)}, {"GPU", FixedPoint(1)}}));
+}
+
 TEST_F(NodeResourceSetTest, TestExplicitResourceIds) {
   NodeResourceSet r1 = NodeResourceSet(
       {{"CPU", 1}, {"custom1", 2}, {std::string(kImplicitResourcePrefix) + "a", 0.5}});
@@ -56,6 +56,11 @@ bool TaskSpecification::PlacementGroupCaptureChildTasks() const {
 }
 
 void TaskSpecification::ComputeResources() {
+  // Build the function descriptor once; the accessor returns this cached copy
+  // so the scheduler and task event paths don't re-parse the proto per call.
+  function_descriptor_ =
+      ray::FunctionDescriptorBuilder::FromProto(message_->function_descriptor());
+
   auto &required_resources = message_->required_resources();
 
   if (required_resources.empty()) {
@@ -173,7 +178,7 @@ TaskID TaskSpecification::SubmitterTaskId() const {
 size_t TaskSpecification::ParentCounter() const { return message_->parent_counter(); }
 
 ray::FunctionDescriptor TaskSpecification::FunctionDescriptor() const {
-  return ray::FunctionDescriptorBuilder::FromProto(message_->function_descriptor());
+  return function_descriptor_;
 }
 
 const rpc::RuntimeEnvInfo &TaskSpecification::RuntimeEnvInfo() const {
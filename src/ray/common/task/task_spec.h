@@ -386,6 +386,9 @@ class TaskSpecification : public MessageWrapper<rpc::TaskSpec> {
   /// Cached scheduling class of this task.
   SchedulingClass sched_cls_id_ = 0;
   int runtime_env_hash_ = 0;
+  /// Cached function descriptor, built once from the proto in the constructor
+  /// so scheduler and event paths don't re-parse it on every access.
+  ray::FunctionDescriptor function_descriptor_;
 
   // Field storing label selector for scheduling Task on a node. Initialized in constuctor
   // in ComputeResources() call.
@@ -0,0 +1,61 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/common/task/task_util.h"
+
+#include <memory>
+#include <utility>
+
+namespace ray {
+
+namespace {
+
+/// Upper bound on the number of idle arenas the pool keeps around. Arenas
+/// beyond this are simply destroyed when their task spec dies.
+constexpr size_t kMaxIdleTaskSpecArenas = 256;
+
+}  // namespace
+
+TaskSpecArenaPool &TaskSpecArenaPool::Instance() {
+  static auto *pool = new TaskSpecArenaPool();
+  return *pool;
+}
+
+std::shared_ptr<rpc::TaskSpec> TaskSpecArenaPool::Allocate() {
+  std::shared_ptr<google::protobuf::Arena> arena;
+  {
+    absl::MutexLock lock(&mutex_);
+    if (!idle_arenas_.empty()) {
+      arena = std::move(idle_arenas_.back());
+      idle_arenas_.pop_back();
+    }
+  }
+  if (arena == nullptr) {
+    arena = std::make_shared<google::protobuf::Arena>();
+  }
+  auto *message = google::protobuf::Arena::CreateMessage<rpc::TaskSpec>(arena.get());
+  // The deleter owns the arena, so the arena outlives every reference to the
+  // message. The message itself is arena-managed and must not be deleted;
+  // resetting the arena reclaims it while keeping the allocated blocks for
+  // the next task spec.
+  return std::shared_ptr<rpc::TaskSpec>(message, [this, arena](rpc::TaskSpec *) {
+    arena->Reset();
+    absl::MutexLock lock(&mutex_);
+    if (idle_arenas_.size() < kMaxIdleTaskSpecArenas) {
+      idle_arenas_.push_back(arena);
+    }
+  });
+}
+
+}  // namespace ray
@@ -14,13 +14,18 @@
 
 #pragma once
 
+#include <google/protobuf/arena.h>
+
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/common/buffer.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/ray_object.h"
 #include "ray/common/scheduling/fallback_strategy.h"
 #include "ray/common/scheduling/label_selector.h"
@@ -111,10 +116,40 @@ class TaskArgByValue : public TaskArg {
   const std::shared_ptr<RayObject> value_;
 };
 
+/// A recycling pool of protobuf arenas that back task spec messages.
+///
+/// Building an `rpc::TaskSpec` performs dozens of small heap allocations for
+/// its submessages and strings. When task_spec_arena_allocation_enabled is
+/// set, TaskSpecBuilder instead allocates the message on an arena drawn from
+/// this pool, so a recycled arena serves each spec from already-allocated
+/// blocks. The arena stays checked out for as long as any
+/// `TaskSpecification` references the message and is reset and returned to
+/// the pool when the last reference goes away.
+class TaskSpecArenaPool {
+ public:
+  /// Returns a task spec message allocated on a pooled arena. The returned
+  /// shared_ptr keeps the backing arena checked out until it is destroyed.
+  std::shared_ptr<rpc::TaskSpec> Allocate();
+
+  /// The process-wide pool.
+  static TaskSpecArenaPool &Instance();
+
+ private:
+  /// Arenas with no live task spec, kept for reuse. Bounded so that a burst
+  /// of in-flight tasks doesn't permanently hold on to the memory.
+  std::vector<std::shared_ptr<google::protobuf::Arena>> idle_arenas_
+      ABSL_GUARDED_BY(mutex_);
+
+  absl::Mutex mutex_;
+};
+
 /// Helper class for building a `TaskSpecification` object.
 class TaskSpecBuilder {
  public:
-  TaskSpecBuilder() : message_(std::make_shared<rpc::TaskSpec>()) {}
+  TaskSpecBuilder()
+      : message_(RayConfig::instance().task_spec_arena_allocation_enabled()
+                     ? TaskSpecArenaPool::Instance().Allocate()
+                     : std::make_shared<rpc::TaskSpec>()) {}
 
   /// Consume the `message_` data member and construct `TaskSpecification`.
   /// NOTICE: Builder is invalidated after this function.
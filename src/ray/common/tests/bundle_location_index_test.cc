@@ -15,8 +15,10 @@
 
 #include "ray/common/bundle_location_index.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -93,4 +95,57 @@ TEST_F(BundleLocationIndexTest, BesicTest) {
   ASSERT_EQ(*(pg_location_index.GetBundleLocation(bundle_1)), node_1);
 }
 
+TEST_F(BundleLocationIndexTest, ForEachBundleNodeTest) {
+  BundleLocationIndex pg_location_index;
+
+  auto collect_nodes = [&](const PlacementGroupID &pg_id) {
+    std::vector<NodeID> nodes;
+    pg_location_index.ForEachBundleNode(pg_id, [&](const NodeID &node_id) {
+      nodes.push_back(node_id);
+      return true;
+    });
+    return nodes;
+  };
+
+  // Unknown placement group visits nothing.
+  ASSERT_TRUE(collect_nodes(pg_1).empty());
+
+  // Two bundles on node_0, one on node_1: each node is visited exactly once.
+  auto bundle_locations = std::make_shared<BundleLocations>();
+  (*bundle_locations)[bundle_0] = std::make_pair(node_0, nullptr);
+  (*bundle_locations)[bundle_1] = std::make_pair(node_0, nullptr);
+  (*bundle_locations)[bundle_2] = std::make_pair(node_1, nullptr);
+  pg_location_index.AddOrUpdateBundleLocations(bundle_locations);
+  auto nodes = collect_nodes(pg_1);
+  ASSERT_EQ(nodes.size(), 2);
+  ASSERT_EQ(std::count(nodes.begin(), nodes.end(), node_0), 1);
+  ASSERT_EQ(std::count(nodes.begin(), nodes.end(), node_1), 1);
+
+  // Iteration stops as soon as the callback returns false.
+  int visited = 0;
+  pg_location_index.ForEachBundleNode(pg_1, [&](const NodeID &) {
+    visited++;
+    return false;
+  });
+  ASSERT_EQ(visited, 1);
+
+  // Relocating a bundle moves its node membership.
+  pg_location_index.AddOrUpdateBundleLocation(bundle_2, node_2);
+  nodes = collect_nodes(pg_1);
+  ASSERT_EQ(nodes.size(), 2);
+  ASSERT_EQ(std::count(nodes.begin(), nodes.end(), node_1), 0);
+  ASSERT_EQ(std::count(nodes.begin(), nodes.end(), node_2), 1);
+  ASSERT_EQ(*(pg_location_index.GetBundleLocation(bundle_2)), node_2);
+
+  // Erasing a node drops it once its last bundle is gone.
+  pg_location_index.Erase(node_0);
+  nodes = collect_nodes(pg_1);
+  ASSERT_EQ(nodes.size(), 1);
+  ASSERT_EQ(nodes[0], node_2);
+
+  // Erasing the placement group clears the compact index too.
+  pg_location_index.Erase(pg_1);
+  ASSERT_TRUE(collect_nodes(pg_1).empty());
+}
+
 }  // namespace ray
@@ -15,7 +15,9 @@
 #include "ray/common/event_stats.h"
 
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -56,3 +58,29 @@ TEST(EventStatsTest, TestRecordExecution) {
   ASSERT_GE(event_stats.cum_execution_time, 200000000);
   ASSERT_GE(event_stats.cum_queue_time, 100000000);
 }
+
+TEST(EventStatsTest, TestConcurrentRecording) {
+  // The counters are updated with atomics rather than per-event locks; the
+  // totals must still come out exact under concurrent recording.
+  EventTracker event_tracker;
+  constexpr int kNumThreads = 8;
+  constexpr int kNumIterations = 1000;
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&event_tracker] {
+      for (int i = 0; i < kNumIterations; i++) {
+        event_tracker.RecordExecution([] {}, event_tracker.RecordStart("method"));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto event_stats = event_tracker.get_event_stats("method").value();
+  ASSERT_EQ(event_stats.cum_count, kNumThreads * kNumIterations);
+  ASSERT_EQ(event_stats.curr_count, 0);
+  ASSERT_EQ(event_stats.running_count, 0);
+  ASSERT_GE(event_stats.min_queue_time, 0);
+  ASSERT_GE(event_stats.max_queue_time, event_stats.min_queue_time);
+}
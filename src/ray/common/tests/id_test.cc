@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
 
 namespace ray {
 
@@ -155,6 +156,28 @@ TEST(HashTest, TestIdHash) {
   EXPECT_FALSE(is_new);
 }
 
+TEST(HashTest, TestEqualityDetectsEveryByte) {
+  // operator== compares the id as unaligned 64-bit words plus a byte tail;
+  // flipping any single byte must break equality, including bytes in the tail
+  // that a word-sized compare could miss (ObjectID is 28 bytes).
+  const ObjectID id = ObjectID::FromRandom();
+  for (size_t i = 0; i < ObjectID::Size(); i++) {
+    std::string corrupted = id.Binary();
+    corrupted[i] ^= 0x1;
+    ASSERT_NE(id, ObjectID::FromBinary(corrupted));
+  }
+  ASSERT_EQ(id, ObjectID::FromBinary(id.Binary()));
+}
+
+TEST(HashTest, TestAbslHashValue) {
+  // AbslHashValue feeds the cached Hash(), so two ids with the same bytes must
+  // hash identically whether or not either has computed its cache yet.
+  const ObjectID id1 = ObjectID::FromRandom();
+  const ObjectID id2 = ObjectID::FromBinary(id1.Binary());
+  ASSERT_EQ(absl::HashOf(id1), absl::HashOf(id2));
+  ASSERT_NE(absl::HashOf(id1), absl::HashOf(ObjectID::FromRandom()));
+}
+
 TEST(PlacementGroupIDTest, TestPlacementGroup) {
   {
     // test from binary
@@ -0,0 +1,64 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/common/asio/io_service_pool.h"
+
+#include <future>
+
+#include "gtest/gtest.h"
+
+namespace ray {
+
+TEST(IOServicePoolTest, GetByHashIsStable) {
+  IOServicePool pool(3);
+  pool.Run();
+  for (size_t hash = 0; hash < 10; hash++) {
+    ASSERT_EQ(pool.Get(hash), pool.Get(hash));
+  }
+  pool.Stop();
+}
+
+TEST(IOServicePoolTest, GetPrefersLessLoadedContext) {
+  IOServicePool pool(2);
+  pool.Run();
+  auto io_services = pool.GetAll();
+  ASSERT_EQ(io_services.size(), 2UL);
+
+  // Saturate the first context: block its thread and queue work behind it.
+  std::promise<void> started;
+  std::promise<void> release;
+  std::future<void> release_future = release.get_future();
+  io_services[0]->post(
+      [&started, &release_future] {
+        started.set_value();
+        release_future.wait();
+      },
+      "block");
+  started.get_future().wait();
+  for (int i = 0; i < 16; i++) {
+    io_services[0]->post([] {}, "noop");
+  }
+  ASSERT_GT(io_services[0]->NumQueuedHandlers(), 0);
+
+  // With one context saturated and the other idle, both pick-two candidates
+  // resolve to the idle context every time.
+  for (int i = 0; i < 8; i++) {
+    ASSERT_EQ(pool.Get(), io_services[1]);
+  }
+
+  release.set_value();
+  pool.Stop();
+}
+
+}  // namespace ray
@@ -31,4 +31,56 @@ TEST_F(RayConfigTest, ConvertValueTrimsVectorElements) {
   ASSERT_EQ(output, expected_output);
 }
 
+TEST_F(RayConfigTest, ApplyOverridesChangesOnlyNamedConfigs) {
+  auto &config = RayConfig::instance();
+  const auto original_batch_size = config.maximum_gcs_deletion_batch_size();
+  const auto original_lineage_bytes = config.max_lineage_bytes();
+  ASSERT_NE(original_batch_size, 123u);
+
+  auto changed = config.ApplyOverrides(R"({"maximum_gcs_deletion_batch_size": 123})");
+  ASSERT_EQ(changed, std::vector<std::string>({"maximum_gcs_deletion_batch_size"}));
+  ASSERT_EQ(config.maximum_gcs_deletion_batch_size(), 123u);
+  ASSERT_NE(config.maximum_gcs_deletion_batch_size(), original_batch_size);
+  // Other configs keep their current values rather than being reset.
+  ASSERT_EQ(config.max_lineage_bytes(), original_lineage_bytes);
+
+  // Re-applying the same value reports no change.
+  changed = config.ApplyOverrides(R"({"maximum_gcs_deletion_batch_size": 123})");
+  ASSERT_TRUE(changed.empty());
+
+  // Unknown keys and unparsable input are skipped, not fatal.
+  changed = config.ApplyOverrides(R"({"no_such_config": 1})");
+  ASSERT_TRUE(changed.empty());
+  changed = config.ApplyOverrides("not json");
+  ASSERT_TRUE(changed.empty());
+
+  config.maximum_gcs_deletion_batch_size() = original_batch_size;
+}
+
+TEST_F(RayConfigTest, OnChangeCallbacksFireOnActualChanges) {
+  auto &config = RayConfig::instance();
+  const auto original_deletion_batch_size = config.maximum_gcs_deletion_batch_size();
+  const auto original_storage_batch_size =
+      config.maximum_gcs_storage_operation_batch_size();
+  int num_calls = 0;
+  const auto callback_id = config.RegisterOnChangeCallback(
+      "maximum_gcs_deletion_batch_size", [&num_calls]() { num_calls++; });
+
+  config.ApplyOverrides(R"({"maximum_gcs_deletion_batch_size": 42})");
+  ASSERT_EQ(num_calls, 1);
+  // An unchanged value does not fire the callback.
+  config.ApplyOverrides(R"({"maximum_gcs_deletion_batch_size": 42})");
+  ASSERT_EQ(num_calls, 1);
+  // A change to a different config does not fire the callback.
+  config.ApplyOverrides(R"({"maximum_gcs_storage_operation_batch_size": 42})");
+  ASSERT_EQ(num_calls, 1);
+
+  config.UnregisterOnChangeCallback(callback_id);
+  config.ApplyOverrides(R"({"maximum_gcs_deletion_batch_size": 43})");
+  ASSERT_EQ(num_calls, 1);
+
+  config.maximum_gcs_deletion_batch_size() = original_deletion_batch_size;
+  config.maximum_gcs_storage_operation_batch_size() = original_storage_batch_size;
+}
+
 }  // namespace ray
@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/task/task_util.h"
 
 namespace ray {
@@ -164,6 +165,31 @@ TEST(TaskSpecTest, TestSchedulingClassDescriptor) {
               SchedulingClassToIds::GetSchedulingClass(descriptor9));
 }
 
+TEST(TaskSpecTest, TestFunctionDescriptorInternId) {
+  // Separately built descriptors with the same fields intern to the same id;
+  // any field difference or language difference gets a different id.
+  FunctionDescriptor python1 = FunctionDescriptorBuilder::BuildPython("m", "c", "f", "h");
+  FunctionDescriptor python2 = FunctionDescriptorBuilder::BuildPython("m", "c", "f", "h");
+  FunctionDescriptor python3 = FunctionDescriptorBuilder::BuildPython("m", "c", "g", "h");
+  ASSERT_EQ(python1->InternId(), python2->InternId());
+  ASSERT_NE(python1->InternId(), python3->InternId());
+
+  FunctionDescriptor java = FunctionDescriptorBuilder::BuildJava("c", "f", "s");
+  ASSERT_NE(python1->InternId(), java->InternId());
+
+  // The `caller` field does not participate in equality, so it must not
+  // affect the interned id either.
+  FunctionDescriptor cpp1 = FunctionDescriptorBuilder::BuildCpp("f", "caller1", "c");
+  FunctionDescriptor cpp2 = FunctionDescriptorBuilder::BuildCpp("f", "caller2", "c");
+  ASSERT_TRUE(cpp1 == cpp2);
+  ASSERT_EQ(cpp1->InternId(), cpp2->InternId());
+
+  // Once both sides are resolved, equality takes the O(1) id fast path and
+  // must agree with the field-by-field comparison.
+  ASSERT_TRUE(python1 == python2);
+  ASSERT_FALSE(python1 == python3);
+}
+
 TEST(TaskSpecTest, TestActorSchedulingClass) {
   // This test ensures that an actor's lease request's scheduling class is
   // determined by the placement resources, not the regular resources.
@@ -309,6 +335,55 @@ TEST(TaskSpecTest, TestCallerAddress) {
   ASSERT_EQ(task_spec.CallerWorkerId(), caller_worker_id);
 }
 
+TEST(TaskSpecTest, TestArenaBackedTaskSpecBuilder) {
+  RayConfig::instance().initialize(R"({"task_spec_arena_allocation_enabled": true})");
+
+  rpc::Address caller_address;
+  NodeID caller_node_id = NodeID::FromRandom();
+  caller_address.set_node_id(caller_node_id.Binary());
+  TaskSpecification task_spec;
+  {
+    TaskSpecBuilder task_spec_builder;
+    task_spec_builder.SetCommonTaskSpec(
+        TaskID::Nil(),
+        "dummy_task",
+        Language::PYTHON,
+        FunctionDescriptorBuilder::BuildPython("", "", "", ""),
+        JobID::Nil(),
+        rpc::JobConfig(),
+        TaskID::Nil(),
+        0,
+        TaskID::Nil(),
+        caller_address,
+        1,
+        false,
+        false,
+        -1,
+        {},
+        {},
+        "",
+        0,
+        TaskID::Nil(),
+        "");
+    task_spec_builder.SetNormalTaskSpec(
+        0, false, "", rpc::SchedulingStrategy(), ActorID::Nil());
+    task_spec = std::move(task_spec_builder).ConsumeAndBuild();
+  }
+  // The arena-backed message outlives the builder.
+  ASSERT_EQ(task_spec.CallerNodeId(), caller_node_id);
+  ASSERT_EQ(task_spec.GetName(), "dummy_task");
+
+  // Dropping the last reference returns the arena to the pool; a new builder
+  // that reuses it must start from a pristine message.
+  task_spec = TaskSpecification();
+  TaskSpecBuilder reuse_builder;
+  ASSERT_EQ(reuse_builder.GetMessage().ByteSizeLong(), 0u);
+  TaskSpecification reused_spec = std::move(reuse_builder).ConsumeAndBuild();
+  ASSERT_TRUE(reused_spec.TaskId().IsNil());
+
+  RayConfig::instance().initialize(R"({"task_spec_arena_allocation_enabled": false})");
+}
+
 TEST(TaskSpecTest, TestNodeLabelSchedulingStrategy) {
   rpc::SchedulingStrategy scheduling_strategy_1;
   auto expr_1 = scheduling_strategy_1.mutable_node_label_scheduling_strategy()
@@ -17,6 +17,7 @@
 #include <atomic>
 #include <boost/thread/latch.hpp>
 #include <chrono>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <thread>
@@ -25,6 +26,7 @@
 #include "gtest/gtest.h"
 #include "ray/common/memory_monitor_interface.h"
 #include "ray/common/memory_monitor_test_fixture.h"
+#include "ray/common/ray_config.h"
 
 namespace ray {
 
@@ -55,7 +57,8 @@ TEST_F(ThresholdMemoryMonitorTest, TestMonitorTriggerCanDetectMemoryUsage) {
       0.0 /*usage_threshold*/,
       -1 /*min_memory_free_bytes*/,
       1 /*refresh_interval_ms*/,
-      [has_checked_once](const SystemMemorySnapshot &system_memory) {
+      [has_checked_once](const SystemMemorySnapshot &system_memory,
+                         const ProcessesMemorySnapshot &process_memory) {
         ASSERT_GT(system_memory.total_bytes, 0)
             << "Reported total bytes from cgroup is <= 0. Is the system memory snapshot "
                "taken correctly?";
@@ -85,7 +88,8 @@ TEST_F(ThresholdMemoryMonitorTest,
       0.7 /*usage_threshold (70%)*/,
       -1 /*min_memory_free_bytes*/,
       1 /*refresh_interval_ms*/,
-      [has_checked_once, cgroup_total_bytes](const SystemMemorySnapshot &system_memory) {
+      [has_checked_once, cgroup_total_bytes](const SystemMemorySnapshot &system_memory,
+                                             const ProcessesMemorySnapshot &process_memory) {
         ASSERT_EQ(system_memory.total_bytes, cgroup_total_bytes)
             << "Unexpected total bytes read from cgroup. Are we correctly reading memory "
                "from the cgroup?";
@@ -114,7 +118,8 @@ TEST_F(ThresholdMemoryMonitorTest,
       0.7 /*usage_threshold (70%)*/,
       -1 /*min_memory_free_bytes*/,
       1 /*refresh_interval_ms*/,
-      [callback_triggered](const SystemMemorySnapshot &system_memory) {
+      [callback_triggered](const SystemMemorySnapshot &system_memory,
+                           const ProcessesMemorySnapshot &process_memory) {
         callback_triggered->store(true);
       },
       cgroup_dir /*root_cgroup_path*/);
@@ -126,4 +131,41 @@ TEST_F(ThresholdMemoryMonitorTest,
          "Are is the memory monitor correctly reading memory from the system?";
 }
 
+TEST_F(ThresholdMemoryMonitorTest, TestMonitorPredictionTriggersOnGrowingUsage) {
+  int64_t cgroup_total_bytes = 1024 * 1024 * 1024;   // 1 GB
+  int64_t cgroup_current_bytes = 400 * 1024 * 1024;  // 400 MB current usage
+  int64_t inactive_file_bytes = 30 * 1024 * 1024;    // 30 MB inactive file cache
+  int64_t active_file_bytes = 20 * 1024 * 1024;      // 20 MB active file cache
+  // Working set = 400 - 30 - 20 = 350 MB (35% of 1GB, below 70% threshold)
+
+  std::string cgroup_dir = MockCgroupMemoryUsage(
+      cgroup_total_bytes, cgroup_current_bytes, inactive_file_bytes, active_file_bytes);
+
+  // Project an hour ahead so any sustained growth crosses the threshold,
+  // even though the raw usage stays well below it.
+  RayConfig::instance().memory_monitor_prediction_horizon_ms() = 60 * 60 * 1000;
+
+  std::shared_ptr<boost::latch> has_checked_once = std::make_shared<boost::latch>(1);
+
+  MakeThresholdMemoryMonitor(
+      0.7 /*usage_threshold (70%)*/,
+      -1 /*min_memory_free_bytes*/,
+      1 /*refresh_interval_ms*/,
+      [has_checked_once](const SystemMemorySnapshot &system_memory,
+                         const ProcessesMemorySnapshot &process_memory) {
+        has_checked_once->count_down();
+      },
+      cgroup_dir /*root_cgroup_path*/);
+
+  // Grow the mocked usage to 450 MB. The working set (400 MB) is still below
+  // the threshold, but the growth rate projects above it.
+  {
+    std::ofstream usage_file(cgroup_dir + "/memory.current", std::ofstream::trunc);
+    usage_file << 450 * 1024 * 1024;
+  }
+
+  has_checked_once->wait();
+  RayConfig::instance().memory_monitor_prediction_horizon_ms() = 0;
+}
+
 }  // namespace ray
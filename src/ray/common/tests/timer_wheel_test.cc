@@ -0,0 +1,124 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/common/asio/timer_wheel.h"
+
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ray/common/asio/periodical_runner.h"
+
+namespace ray {
+
+TEST(TimerWheelTest, TimersFireInOrder) {
+  instrumented_io_context io_service;
+  auto wheel = TimerWheel::Create(io_service, /*resolution_ms=*/1, /*num_slots=*/4);
+
+  std::vector<int> fired;
+  wheel->ScheduleAfter([&fired] { fired.push_back(2); }, 20);
+  wheel->ScheduleAfter([&fired] { fired.push_back(1); }, 5);
+  ASSERT_EQ(wheel->NumPending(), 2UL);
+
+  while (fired.size() < 2) {
+    io_service.run_one();
+  }
+  ASSERT_EQ(fired, (std::vector<int>{1, 2}));
+  ASSERT_EQ(wheel->NumPending(), 0UL);
+}
+
+TEST(TimerWheelTest, DelaysLongerThanOneRevolution) {
+  instrumented_io_context io_service;
+  // 4 slots at 1ms resolution, so a 10ms delay needs multiple revolutions.
+  auto wheel = TimerWheel::Create(io_service, /*resolution_ms=*/1, /*num_slots=*/4);
+
+  bool fired = false;
+  wheel->ScheduleAfter([&fired] { fired = true; }, 10);
+  while (!fired) {
+    io_service.run_one();
+  }
+  ASSERT_EQ(wheel->NumPending(), 0UL);
+}
+
+TEST(TimerWheelTest, CancelPreventsCallback) {
+  instrumented_io_context io_service;
+  auto wheel = TimerWheel::Create(io_service, /*resolution_ms=*/1, /*num_slots=*/4);
+
+  bool cancelled_fired = false;
+  bool other_fired = false;
+  auto timer_id = wheel->ScheduleAfter([&cancelled_fired] { cancelled_fired = true; }, 5);
+  wheel->ScheduleAfter([&other_fired] { other_fired = true; }, 10);
+
+  ASSERT_TRUE(wheel->Cancel(timer_id));
+  // Cancelling again, or cancelling an unknown id, is a no-op.
+  ASSERT_FALSE(wheel->Cancel(timer_id));
+  ASSERT_FALSE(wheel->Cancel(TimerWheel::kInvalidTimerID));
+
+  while (!other_fired) {
+    io_service.run_one();
+  }
+  ASSERT_FALSE(cancelled_fired);
+}
+
+TEST(TimerWheelTest, DestructionDropsPendingTimers) {
+  instrumented_io_context io_service;
+  auto wheel = TimerWheel::Create(io_service, /*resolution_ms=*/1, /*num_slots=*/4);
+
+  bool fired = false;
+  wheel->ScheduleAfter([&fired] { fired = true; }, 5);
+  wheel.reset();
+
+  // Drain everything the wheel left behind; the callback must not run.
+  io_service.run();
+  ASSERT_FALSE(fired);
+}
+
+TEST(TimerWheelTest, PeriodicalRunnerRunsTasksOffTheWheel) {
+  RayConfig::instance().initialize(R"({"periodical_runner_use_timer_wheel": true})");
+  instrumented_io_context io_service;
+  auto runner = PeriodicalRunner::Create(io_service);
+
+  int fast_runs = 0;
+  int slow_runs = 0;
+  runner->RunFnPeriodically([&fast_runs] { ++fast_runs; }, 10, "fast_task");
+  runner->RunFnPeriodically([&slow_runs] { ++slow_runs; }, 20, "slow_task");
+
+  // Both tasks run immediately and then repeatedly off the shared wheel.
+  while (fast_runs < 3 || slow_runs < 2) {
+    io_service.run_one();
+  }
+
+  // Destroying the runner drops its wheel, so no further runs happen.
+  runner.reset();
+  const int fast_runs_after_destruction = fast_runs;
+  io_service.restart();
+  io_service.run();
+  ASSERT_EQ(fast_runs, fast_runs_after_destruction);
+  RayConfig::instance().initialize(R"({"periodical_runner_use_timer_wheel": false})");
+}
+
+TEST(TimerWheelTest, ExecuteAfterCoalescedFallsBackWithoutWheel) {
+  instrumented_io_context io_service;
+
+  bool fired = false;
+  execute_after_coalesced(io_service,
+                          /*wheel=*/nullptr,
+                          [&fired] { fired = true; },
+                          std::chrono::milliseconds(1));
+  while (!fired) {
+    io_service.run_one();
+  }
+}
+
+}  // namespace ray
@@ -15,7 +15,9 @@
 #include "ray/common/threshold_memory_monitor.h"
 
 #include "absl/strings/str_format.h"
+#include "absl/time/clock.h"
 #include "ray/common/memory_monitor_utils.h"
+#include "ray/common/ray_config.h"
 #include "ray/util/logging.h"
 #include "ray/util/thread_utils.h"
 
@@ -65,9 +67,20 @@ ThresholdMemoryMonitor::ThresholdMemoryMonitor(KillWorkersCallback kill_workers_
         bool is_usage_above_threshold =
             IsUsageAboveThreshold(cur_memory_snapshot, computed_threshold_bytes_);
 
+        const int64_t prediction_horizon_ms =
+            RayConfig::instance().memory_monitor_prediction_horizon_ms();
+        if (prediction_horizon_ms > 0) {
+          is_usage_above_threshold |= IsProjectedUsageAboveThreshold(
+              cur_memory_snapshot, prediction_horizon_ms, computed_threshold_bytes_);
+        }
+
         if (is_usage_above_threshold && IsEnabled()) {
           Disable();
-          kill_workers_callback_(cur_memory_snapshot);
+          // Take the per-process snapshot here on the monitor thread so the
+          // receiver does not have to scan /proc while the node is under
+          // memory pressure.
+          kill_workers_callback_(cur_memory_snapshot,
+                                 MemoryMonitorUtils::TakePerProcessMemorySnapshot());
         }
       },
       monitor_interval_ms,
@@ -112,4 +125,54 @@ bool ThresholdMemoryMonitor::IsUsageAboveThreshold(
   return is_usage_above_threshold;
 }
 
+bool ThresholdMemoryMonitor::IsProjectedUsageAboveThreshold(
+    const SystemMemorySnapshot &system_memory,
+    int64_t horizon_ms,
+    int64_t threshold_bytes) {
+  if (system_memory.used_bytes == MemoryMonitorInterface::kNull) {
+    return false;
+  }
+  const int64_t now_ns = absl::GetCurrentTimeNanos();
+  const double used_bytes = static_cast<double>(system_memory.used_bytes);
+  if (smoothed_used_bytes_ < 0) {
+    // First sample; no growth rate to project yet.
+    smoothed_used_bytes_ = used_bytes;
+    last_sample_time_ns_ = now_ns;
+    return false;
+  }
+  const double interval_s = static_cast<double>(now_ns - last_sample_time_ns_) / 1e9;
+  if (interval_s <= 0) {
+    return false;
+  }
+  last_sample_time_ns_ = now_ns;
+
+  const double alpha = RayConfig::instance().memory_monitor_smoothing_alpha();
+  const double prev_smoothed_used_bytes = smoothed_used_bytes_;
+  smoothed_used_bytes_ += alpha * (used_bytes - smoothed_used_bytes_);
+  const double sampled_growth_bytes_per_sec =
+      (smoothed_used_bytes_ - prev_smoothed_used_bytes) / interval_s;
+  growth_bytes_per_sec_ +=
+      alpha * (sampled_growth_bytes_per_sec - growth_bytes_per_sec_);
+
+  if (growth_bytes_per_sec_ <= 0) {
+    return false;
+  }
+  const double projected_used_bytes =
+      smoothed_used_bytes_ +
+      growth_bytes_per_sec_ * (static_cast<double>(horizon_ms) / 1000.);
+  const bool is_projected_above_threshold =
+      projected_used_bytes > static_cast<double>(threshold_bytes);
+  if (is_projected_above_threshold) {
+    RAY_LOG_EVERY_MS(INFO, MemoryMonitorInterface::kLogIntervalMs) << absl::StrFormat(
+        "Node memory usage projected above threshold, used: %d, smoothed: %f, "
+        "growth bytes/s: %f, horizon ms: %d, threshold_bytes: %d",
+        system_memory.used_bytes,
+        smoothed_used_bytes_,
+        growth_bytes_per_sec_,
+        horizon_ms,
+        threshold_bytes);
+  }
+  return is_projected_above_threshold;
+}
+
 }  // namespace ray
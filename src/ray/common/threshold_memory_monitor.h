@@ -77,6 +77,20 @@ class ThresholdMemoryMonitor : public MemoryMonitorInterface {
   bool IsUsageAboveThreshold(const SystemMemorySnapshot &system_memory,
                              int64_t threshold_bytes);
 
+  /**
+   * @brief Updates the EWMA-smoothed usage and growth rate with the latest
+   * sample and checks whether the usage projected horizon_ms ahead crosses
+   * the threshold. Only called on the monitor thread.
+   *
+   * @param system_memory The snapshot of system memory usage.
+   * @param horizon_ms How far ahead to project the smoothed usage.
+   * @param threshold_bytes The threshold to compare the projection against.
+   * @return True if the projected memory usage is above the threshold.
+   */
+  bool IsProjectedUsageAboveThreshold(const SystemMemorySnapshot &system_memory,
+                                      int64_t horizon_ms,
+                                      int64_t threshold_bytes);
+
   /// Callback function that executes at each monitoring interval,
   /// on a dedicated thread managed by this class.
   KillWorkersCallback kill_workers_callback_;
@@ -93,6 +107,18 @@ class ThresholdMemoryMonitor : public MemoryMonitorInterface {
   /// use to monitor the system memory usage.
   std::string root_cgroup_path_;
 
+  /// EWMA-smoothed used bytes, kNull until the first sample is taken.
+  /// Only accessed on the monitor thread.
+  double smoothed_used_bytes_ = kNull;
+
+  /// EWMA-smoothed usage growth rate in bytes per second.
+  /// Only accessed on the monitor thread.
+  double growth_bytes_per_sec_ = 0;
+
+  /// The time the last sample was folded into the EWMA.
+  /// Only accessed on the monitor thread.
+  int64_t last_sample_time_ns_ = 0;
+
   /// IO service for running the memory monitoring event loop.
   instrumented_io_context io_service_;
 
@@ -49,10 +49,15 @@ ActorID ActorManager::RegisterActorHandle(std::unique_ptr<ActorHandle> actor_han
   return actor_id;
 }
 
+std::shared_ptr<const ActorManager::ActorHandleMap>
+ActorManager::GetActorHandlesSnapshot() const {
+  return std::atomic_load(&actor_handles_snapshot_);
+}
+
 std::shared_ptr<ActorHandle> ActorManager::GetActorHandle(const ActorID &actor_id) const {
-  absl::MutexLock lock(&mutex_);
-  auto it = actor_handles_.find(actor_id);
-  RAY_CHECK(it != actor_handles_.end())
+  const auto snapshot = GetActorHandlesSnapshot();
+  auto it = snapshot->find(actor_id);
+  RAY_CHECK(it != snapshot->end())
       << "Cannot find an actor handle of id, " << actor_id
       << ". This method should be called only when you ensure actor handles exists.";
   return it->second;
@@ -115,15 +120,15 @@ std::pair<std::shared_ptr<const ActorHandle>, Status> ActorManager::GetNamedActo
 }
 
 bool ActorManager::CheckActorHandleExists(const ActorID &actor_id) {
-  absl::MutexLock lock(&mutex_);
-  return actor_handles_.find(actor_id) != actor_handles_.end();
+  const auto snapshot = GetActorHandlesSnapshot();
+  return snapshot->find(actor_id) != snapshot->end();
 }
 
 std::shared_ptr<ActorHandle> ActorManager::GetActorHandleIfExists(
     const ActorID &actor_id) {
-  absl::MutexLock lock(&mutex_);
-  auto it = actor_handles_.find(actor_id);
-  if (it != actor_handles_.end()) {
+  const auto snapshot = GetActorHandlesSnapshot();
+  auto it = snapshot->find(actor_id);
+  if (it != snapshot->end()) {
     return it->second;
   }
   return nullptr;
@@ -136,11 +141,8 @@ bool ActorManager::EmplaceNewActorHandle(std::unique_ptr<ActorHandle> actor_hand
   const auto &actor_id = actor_handle->GetActorID();
   const auto actor_creation_return_id = ObjectID::ForActorHandle(actor_id);
 
-  {
-    absl::MutexLock lock(&mutex_);
-    if (actor_handles_.contains(actor_id)) {
-      return false;
-    }
+  if (GetActorHandlesSnapshot()->contains(actor_id)) {
+    return false;
   }
 
   // Detached actor doesn't need ref counting.
@@ -185,6 +187,14 @@ bool ActorManager::AddActorHandle(std::unique_ptr<ActorHandle> actor_handle,
   {
     absl::MutexLock lock(&mutex_);
     inserted = actor_handles_.emplace(actor_id, std::move(actor_handle)).second;
+    if (inserted) {
+      // Publish a fresh snapshot for lock-free readers. Handle registration is
+      // rare compared to submit-path lookups, so the full copy is cheap.
+      std::atomic_store(
+          &actor_handles_snapshot_,
+          std::shared_ptr<const ActorHandleMap>(
+              std::make_shared<ActorHandleMap>(actor_handles_)));
+    }
   }
 
   if (is_self) {
@@ -268,9 +278,9 @@ void ActorManager::HandleActorStateNotification(const ActorID &actor_id,
 }
 
 std::vector<ObjectID> ActorManager::GetActorHandleIDsFromHandles() {
-  absl::MutexLock lock(&mutex_);
+  const auto snapshot = GetActorHandlesSnapshot();
   std::vector<ObjectID> actor_handle_ids;
-  for (const auto &handle : actor_handles_) {
+  for (const auto &handle : *snapshot) {
     auto actor_id = handle.first;
     auto actor_handle_id = ObjectID::ForActorHandle(actor_id);
     actor_handle_ids.push_back(actor_handle_id);
@@ -283,9 +293,7 @@ ActorID ActorManager::GetCachedNamedActorID(const std::string &actor_name) {
     absl::MutexLock cache_lock(&cache_mutex_);
     auto it = cached_actor_name_to_ids_.find(actor_name);
     if (it != cached_actor_name_to_ids_.end()) {
-      absl::MutexLock lock(&mutex_);
-      auto handle_it = actor_handles_.find(it->second);
-      RAY_CHECK(handle_it != actor_handles_.end());
+      RAY_CHECK(GetActorHandlesSnapshot()->contains(it->second));
       return it->second;
     }
   }
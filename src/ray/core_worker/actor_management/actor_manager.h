@@ -149,6 +149,16 @@ class ActorManager {
   std::shared_ptr<ActorHandle> GetActorHandleIfExists(const ActorID &actor_id);
 
  private:
+  /// Map from actor ID to a handle to that actor.
+  using ActorHandleMap = absl::flat_hash_map<ActorID, std::shared_ptr<ActorHandle>>;
+
+  /// Load the current immutable snapshot of the actor handle table.
+  ///
+  /// Lookups on the task submission path go through this snapshot instead of
+  /// taking `mutex_`, so concurrent submit threads do not contend with each
+  /// other or with handle registration.
+  std::shared_ptr<const ActorHandleMap> GetActorHandlesSnapshot() const;
+
   /// Give this worker a handle to an actor.
   ///
   /// This handle will remain as long as the current actor or task is
@@ -209,8 +219,17 @@ class ActorManager {
 
   /// Map from actor ID to a handle to that actor.
   /// Actor handle is a logical abstraction that holds actor handle's states.
-  absl::flat_hash_map<ActorID, std::shared_ptr<ActorHandle>> actor_handles_
-      ABSL_GUARDED_BY(mutex_);
+  /// Mutated only under `mutex_`; after every mutation a fresh copy is
+  /// published to `actor_handles_snapshot_`.
+  ActorHandleMap actor_handles_ ABSL_GUARDED_BY(mutex_);
+
+  /// Read-mostly snapshot of `actor_handles_`, swapped atomically (copy on
+  /// write) under `mutex_` and read lock-free via std::atomic_load. Handles
+  /// are only ever inserted, never erased, so a reader that loads a slightly
+  /// stale snapshot can only miss a handle added concurrently, which is the
+  /// same race as a mutex-protected lookup.
+  std::shared_ptr<const ActorHandleMap> actor_handles_snapshot_ =
+      std::make_shared<const ActorHandleMap>();
 
   /// Protects access `cached_actor_name_to_ids_` and `subscribed_actors_`.
   mutable absl::Mutex cache_mutex_;
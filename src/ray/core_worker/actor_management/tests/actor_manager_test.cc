@@ -232,6 +232,45 @@ TEST_F(ActorManagerTest, TestCheckActorHandleDoesntExists) {
   ASSERT_FALSE(actor_manager_->CheckActorHandleExists(actor_id));
 }
 
+TEST_F(ActorManagerTest, TestSnapshotReflectsAllInsertedHandles) {
+  // Handle lookups go through a lock-free snapshot of the handle table that
+  // is republished on every insert. Make sure every registered handle stays
+  // visible through the snapshot-backed accessors as the table grows.
+  const auto caller_address = rpc::Address();
+  RayFunction function(Language::PYTHON,
+                       FunctionDescriptorBuilder::BuildPython("", "", "", ""));
+  std::vector<ActorID> actor_ids;
+  for (int i = 1; i <= 3; i++) {
+    JobID job_id = JobID::FromInt(i);
+    const TaskID task_id = TaskID::ForDriverTask(job_id);
+    ActorID actor_id = ActorID::Of(job_id, task_id, 1);
+    auto actor_handle = absl::make_unique<ActorHandle>(actor_id,
+                                                       TaskID::Nil(),
+                                                       rpc::Address(),
+                                                       job_id,
+                                                       ObjectID::FromRandom(),
+                                                       function.GetLanguage(),
+                                                       function.GetFunctionDescriptor(),
+                                                       "",
+                                                       0,
+                                                       "",
+                                                       "",
+                                                       -1,
+                                                       false);
+    ASSERT_TRUE(actor_manager_->EmplaceNewActorHandle(
+        std::move(actor_handle), "", caller_address, /*owned=*/true));
+    actor_ids.push_back(actor_id);
+  }
+
+  for (const auto &actor_id : actor_ids) {
+    ASSERT_TRUE(actor_manager_->CheckActorHandleExists(actor_id));
+    const auto handle = actor_manager_->GetActorHandleIfExists(actor_id);
+    ASSERT_NE(handle, nullptr);
+    ASSERT_EQ(handle->GetActorID(), actor_id);
+  }
+  ASSERT_EQ(actor_manager_->GetActorHandleIDsFromHandles().size(), actor_ids.size());
+}
+
 TEST_F(ActorManagerTest, RegisterActorHandles) {
   JobID job_id = JobID::FromInt(1);
   const TaskID task_id = TaskID::ForDriverTask(job_id);
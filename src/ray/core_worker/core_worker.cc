@@ -317,7 +317,9 @@ CoreWorker::CoreWorker(
     std::unique_ptr<worker::TaskEventBuffer> task_event_buffer,
     uint32_t pid,
     ray::observability::MetricInterface &task_by_state_gauge,
-    ray::observability::MetricInterface &actor_by_state_gauge)
+    ray::observability::MetricInterface &actor_by_state_gauge,
+    ray::observability::MetricInterface &actor_task_queue_depth_gauge,
+    ray::observability::MetricInterface &actor_task_queue_head_wait_gauge)
     : options_(std::move(options)),
       get_call_site_(RayConfig::instance().record_ref_creation_sites()
                          ? options_.get_lang_stack
@@ -389,11 +391,31 @@ CoreWorker::CoreWorker(
           RAY_CHECK_OK(raylet_ipc_client_->WaitForActorCallArgs(args, tag))
               << "WaitForActorCallArgs IPC failed unexpectedly";
         });
-    task_receiver_ = std::make_unique<TaskReceiver>(task_execution_service_,
-                                                    *task_event_buffer_,
-                                                    execute_task,
-                                                    *actor_task_execution_arg_waiter_,
-                                                    options_.initialize_thread_callback);
+    task_receiver_ = std::make_unique<TaskReceiver>(
+        task_execution_service_,
+        *task_event_buffer_,
+        execute_task,
+        *actor_task_execution_arg_waiter_,
+        options_.initialize_thread_callback,
+        [this](const rpc::Address &addr, const rpc::ReturnObject &result) {
+          rpc::ForwardInlineResultRequest request;
+          request.set_intended_worker_id(addr.worker_id());
+          request.mutable_result()->CopyFrom(result);
+          core_worker_client_pool_->GetOrConnect(addr)->ForwardInlineResult(
+              std::move(request),
+              [object_id = ObjectID::FromBinary(result.object_id())](
+                  const Status &status, const rpc::ForwardInlineResultReply &reply) {
+                if (!status.ok()) {
+                  // Best-effort: the owner-routed reply path remains
+                  // authoritative, so a dropped forward only costs the saved
+                  // hop.
+                  RAY_LOG(DEBUG).WithField(object_id)
+                      << "Failed to forward inline result to consumer: " << status;
+                }
+              });
+        },
+        actor_task_queue_depth_gauge,
+        actor_task_queue_head_wait_gauge);
   }
 
   RegisterToGcs(options_.worker_launch_time_ms, options_.worker_launched_time_ms);
@@ -845,6 +867,12 @@ void CoreWorker::RecordMetrics() {
   // Record worker heap memory metrics.
   memory_store_->RecordMetrics();
   reference_counter_->RecordMetrics();
+  // The actor task execution queues are owned by the task execution service
+  // thread, so record their metrics from there.
+  if (task_receiver_ != nullptr) {
+    task_execution_service_.post([this] { task_receiver_->RecordMetrics(); },
+                                 "CoreWorker.RecordTaskReceiverMetrics");
+  }
 }
 
 std::unordered_map<ObjectID, std::pair<size_t, size_t>>
@@ -987,6 +1015,76 @@ Status CoreWorker::Put(const RayObject &object,
   return status;
 }
 
+void CoreWorker::PinObjectAtLocalRaylet(
+    const rpc::Address &owner_address,
+    const ObjectID &object_id,
+    const ObjectID &generator_id,
+    std::function<void(const Status &status, bool success)> callback) {
+  const auto batch_key = std::make_pair(WorkerID::FromBinary(owner_address.worker_id()),
+                                        generator_id);
+  {
+    absl::MutexLock lock(&local_pin_batch_mutex_);
+    auto &batch = local_pin_batches_[batch_key];
+    batch.owner_address = owner_address;
+    batch.queued.push_back(PendingObjectPin{object_id, std::move(callback)});
+    if (batch.rpc_in_flight) {
+      // Will be sent together with any other queued requests when the
+      // in-flight RPC replies.
+      return;
+    }
+    batch.rpc_in_flight = true;
+  }
+  SendLocalPinBatch(batch_key);
+}
+
+void CoreWorker::SendLocalPinBatch(const std::pair<WorkerID, ObjectID> &batch_key) {
+  rpc::Address owner_address;
+  std::vector<PendingObjectPin> pins;
+  {
+    absl::MutexLock lock(&local_pin_batch_mutex_);
+    auto it = local_pin_batches_.find(batch_key);
+    RAY_CHECK(it != local_pin_batches_.end());
+    owner_address = it->second.owner_address;
+    pins.swap(it->second.queued);
+  }
+
+  std::vector<ObjectID> object_ids;
+  object_ids.reserve(pins.size());
+  for (const auto &pin : pins) {
+    object_ids.push_back(pin.object_id);
+  }
+  RAY_LOG(DEBUG) << "Pinning batch of " << object_ids.size()
+                 << " objects at the local raylet";
+
+  local_raylet_rpc_client_->PinObjectIDs(
+      owner_address,
+      object_ids,
+      /*generator_id=*/batch_key.second,
+      [this, batch_key, pins = std::move(pins)](
+          const Status &status, const rpc::PinObjectIDsReply &reply) mutable {
+        for (size_t i = 0; i < pins.size(); i++) {
+          const bool success = status.ok() &&
+                               static_cast<int>(i) < reply.successes_size() &&
+                               reply.successes(i);
+          pins[i].callback(status, success);
+        }
+        bool send_next_batch = false;
+        {
+          absl::MutexLock lock(&local_pin_batch_mutex_);
+          auto it = local_pin_batches_.find(batch_key);
+          RAY_CHECK(it != local_pin_batches_.end());
+          if (it->second.queued.empty()) {
+            local_pin_batches_.erase(it);
+          } else {
+            send_next_batch = true;
+          }
+        }
+        if (send_next_batch) {
+          SendLocalPinBatch(batch_key);
+        }
+      });
+}
+
 Status CoreWorker::PutInLocalPlasmaStore(const RayObject &object,
                                          const ObjectID &object_id,
                                          bool pin_object) {
@@ -997,11 +1095,11 @@ Status CoreWorker::PutInLocalPlasmaStore(const RayObject &object,
     if (pin_object) {
       // Tell the raylet to pin the object **after** it is created.
       RAY_LOG(DEBUG).WithField(object_id) << "Pinning put object";
-      local_raylet_rpc_client_->PinObjectIDs(
+      PinObjectAtLocalRaylet(
           rpc_address_,
-          {object_id},
+          object_id,
           /*generator_id=*/ObjectID::Nil(),
-          [this, object_id](const Status &status, const rpc::PinObjectIDsReply &reply) {
+          [this, object_id](const Status &status, bool success) {
             // RPC to the local raylet should never fail.
             if (!status.ok()) {
               RAY_LOG(ERROR) << "Request to local raylet to pin object failed: "
@@ -1193,11 +1291,11 @@ Status CoreWorker::SealExisting(const ObjectID &object_id,
   if (pin_object) {
     // Tell the raylet to pin the object **after** it is created.
     RAY_LOG(DEBUG).WithField(object_id) << "Pinning sealed object";
-    local_raylet_rpc_client_->PinObjectIDs(
+    PinObjectAtLocalRaylet(
         owner_address != nullptr ? *owner_address : rpc_address_,
-        {object_id},
+        object_id,
         generator_id,
-        [this, object_id](const Status &status, const rpc::PinObjectIDsReply &reply) {
+        [this, object_id](const Status &status, bool success) {
           // RPC to the local raylet should never fail.
           if (!status.ok()) {
             RAY_LOG(ERROR) << "Request to local raylet to pin object failed: "
@@ -1338,14 +1436,27 @@ Status CoreWorker::GetExperimentalMutableObjects(
   return Status::OK();
 }
 
+namespace {
+
+/// Whether all the ids in a batch are distinct. Only called for batches up to
+/// `core_worker_small_get_max_batch_size`, so the quadratic scan is cheap.
+bool ObjectIdsAreDistinct(const std::vector<ObjectID> &ids) {
+  for (size_t i = 1; i < ids.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      if (ids[i] == ids[j]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 Status CoreWorker::GetObjects(const std::vector<ObjectID> &ids,
                               const int64_t timeout_ms,
                               std::vector<std::shared_ptr<RayObject>> &results) {
   // Normal ray.get path for immutable in-memory and shared memory objects.
-  absl::flat_hash_set<ObjectID> plasma_object_ids;
-  absl::flat_hash_set<ObjectID> memory_object_ids(ids.begin(), ids.end());
-
-  absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> result_map;
   auto start_time = current_time_ms();
 
   StatusSet<StatusT::NotFound> objects_have_owners = reference_counter_->HasOwner(ids);
@@ -1367,6 +1478,19 @@ Status CoreWorker::GetObjects(const std::vector<ObjectID> &ids,
         objects_have_owners.error());
   }
 
+  // Small batches of distinct ids are resolved positionally, without the
+  // per-call hash sets and maps below.
+  const size_t small_get_max_batch_size =
+      RayConfig::instance().core_worker_small_get_max_batch_size();
+  if (ids.size() <= small_get_max_batch_size && ObjectIdsAreDistinct(ids)) {
+    return GetObjectsSmall(ids, timeout_ms, start_time, results);
+  }
+
+  absl::flat_hash_set<ObjectID> plasma_object_ids;
+  absl::flat_hash_set<ObjectID> memory_object_ids(ids.begin(), ids.end());
+
+  absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> result_map;
+
   bool got_exception = false;
 
   if (!memory_object_ids.empty()) {
@@ -1435,6 +1559,82 @@ Status CoreWorker::GetObjects(const std::vector<ObjectID> &ids,
   return Status::OK();
 }
 
+Status CoreWorker::GetObjectsSmall(const std::vector<ObjectID> &ids,
+                                   const int64_t timeout_ms,
+                                   int64_t start_time,
+                                   std::vector<std::shared_ptr<RayObject>> &results) {
+  // The memory store fills `results` in the order of `ids`, so no result map
+  // is needed. This is the same underlying get as the regular path uses,
+  // including returning early once a fetched object holds an exception.
+  RAY_RETURN_NOT_OK(
+      memory_store_->Get(ids, ids.size(), timeout_ms, *worker_context_, &results));
+
+  bool got_exception = false;
+  std::vector<size_t> plasma_indices;
+  for (size_t i = 0; i < ids.size(); i++) {
+    if (results[i] == nullptr) {
+      continue;
+    }
+    if (results[i]->IsInPlasmaError()) {
+      RAY_LOG(DEBUG) << ids[i] << " in plasma, doing fetch-and-get";
+      results[i] = nullptr;
+      plasma_indices.push_back(i);
+    } else if (results[i]->IsException()) {
+      got_exception = true;
+    }
+  }
+
+  if (!got_exception && !plasma_indices.empty()) {
+    // Some of the objects were promoted to plasma; retry their gets at the
+    // plasma store with the remaining timeout, as in the regular path.
+    std::vector<ObjectID> plasma_object_ids;
+    plasma_object_ids.reserve(plasma_indices.size());
+    for (const size_t i : plasma_indices) {
+      plasma_object_ids.push_back(ids[i]);
+    }
+    auto owner_addresses = reference_counter_->GetOwnerAddresses(plasma_object_ids);
+
+    int64_t local_timeout_ms = timeout_ms;
+    if (timeout_ms >= 0) {
+      local_timeout_ms = std::max(static_cast<int64_t>(0),
+                                  timeout_ms - (current_time_ms() - start_time));
+    }
+    RAY_LOG(DEBUG) << "Plasma GET timeout " << local_timeout_ms;
+    absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> plasma_result_map;
+    RAY_RETURN_NOT_OK(plasma_store_provider_->Get(
+        plasma_object_ids, owner_addresses, local_timeout_ms, &plasma_result_map));
+    for (const size_t i : plasma_indices) {
+      auto pair = plasma_result_map.find(ids[i]);
+      if (pair != plasma_result_map.end()) {
+        results[i] = pair->second;
+      }
+    }
+  }
+
+  bool missing_result = false;
+  bool will_throw_exception = false;
+  for (size_t i = 0; i < ids.size(); i++) {
+    if (results[i] == nullptr) {
+      missing_result = true;
+    } else {
+      RAY_CHECK(!results[i]->IsInPlasmaError());
+      if (results[i]->IsException()) {
+        // The language bindings should throw an exception if they see this
+        // object.
+        will_throw_exception = true;
+      }
+    }
+  }
+
+  // If no timeout was set and none of the results will throw an exception,
+  // then check that we fetched all results before returning.
+  if (timeout_ms < 0 && !will_throw_exception) {
+    RAY_CHECK(!missing_result);
+  }
+
+  return Status::OK();
+}
+
 Status CoreWorker::GetIfLocal(const std::vector<ObjectID> &ids,
                               std::vector<std::shared_ptr<RayObject>> *results) {
   results->resize(ids.size(), nullptr);
@@ -1452,6 +1652,21 @@ Status CoreWorker::GetIfLocal(const std::vector<ObjectID> &ids,
   return Status::OK();
 }
 
+Status CoreWorker::PrefetchObjects(const std::vector<ObjectID> &ids) {
+  std::vector<ObjectID> prefetch_ids;
+  prefetch_ids.reserve(ids.size());
+  for (const auto &id : ids) {
+    if (HasOwner(id)) {
+      prefetch_ids.push_back(id);
+    }
+  }
+  if (prefetch_ids.empty()) {
+    return Status::OK();
+  }
+  auto owner_addresses = reference_counter_->GetOwnerAddresses(prefetch_ids);
+  return plasma_store_provider_->Prefetch(prefetch_ids, owner_addresses);
+}
+
 Status CoreWorker::Contains(const ObjectID &object_id,
                             bool *has_object,
                             bool *is_in_plasma) {
@@ -1632,8 +1847,31 @@ Status CoreWorker::GetLocationFromOwner(
     return Status::OK();
   }
 
+  auto location_by_id =
+      std::make_shared<absl::flat_hash_map<ObjectID, std::shared_ptr<ObjectLocation>>>();
+
+  if (RayConfig::instance().worker_object_location_cache_enabled()) {
+    // Resolve as many objects as possible from the local raylet's location
+    // cache, which is shared by all workers on this node and invalidated by
+    // the owners' pubsub notifications. Only the misses need an owner RPC.
+    auto cached_locations = raylet_ipc_client_->GetCachedObjectLocations(object_ids);
+    if (cached_locations.ok()) {
+      for (auto &[object_id, object_info] : *cached_locations) {
+        location_by_id->emplace(
+            object_id, std::make_shared<ObjectLocation>(CreateObjectLocation(object_info)));
+      }
+    } else {
+      RAY_LOG(WARNING) << "Failed to query the local raylet's object location cache, "
+                          "falling back to owner RPCs: "
+                       << cached_locations.status();
+    }
+  }
+
   absl::flat_hash_map<rpc::Address, std::vector<ObjectID>> objects_by_owner;
   for (const auto &object_id : object_ids) {
+    if (location_by_id->contains(object_id)) {
+      continue;
+    }
     rpc::Address owner_address;
     RAY_RETURN_NOT_OK(GetOwnerAddress(object_id, &owner_address));
     objects_by_owner[owner_address].push_back(object_id);
@@ -1642,8 +1880,6 @@ Status CoreWorker::GetLocationFromOwner(
   auto mutex = std::make_shared<absl::Mutex>();
   auto num_remaining = std::make_shared<size_t>(0);  // Will be incremented per batch
   auto ready_promise = std::make_shared<std::promise<void>>();
-  auto location_by_id =
-      std::make_shared<absl::flat_hash_map<ObjectID, std::shared_ptr<ObjectLocation>>>();
 
   for (const auto &owner_and_objects : objects_by_owner) {
     const auto &owner_address = owner_and_objects.first;
@@ -1700,15 +1936,19 @@ Status CoreWorker::GetLocationFromOwner(
     }
   }
 
-  // Wait for all batches to be processed or timeout
-  if (timeout_ms < 0) {
-    ready_promise->get_future().wait();
-  } else if (ready_promise->get_future().wait_for(
-                 std::chrono::microseconds(timeout_ms)) != std::future_status::ready) {
-    std::ostringstream stream;
-    stream << "Failed querying object locations within " << timeout_ms
-           << " milliseconds.";
-    return Status::TimedOut(stream.str());
+  // Wait for all batches to be processed or timeout. If every object was
+  // resolved from the local raylet's cache, no batch was sent and the promise
+  // would never be fulfilled.
+  if (!objects_by_owner.empty()) {
+    if (timeout_ms < 0) {
+      ready_promise->get_future().wait();
+    } else if (ready_promise->get_future().wait_for(
+                   std::chrono::microseconds(timeout_ms)) != std::future_status::ready) {
+      std::ostringstream stream;
+      stream << "Failed querying object locations within " << timeout_ms
+             << " milliseconds.";
+      return Status::TimedOut(stream.str());
+    }
   }
 
   // Fill in the results vector
@@ -2723,8 +2963,21 @@ Status CoreWorker::AllocateReturnObject(const ObjectID &object_id,
           object_id, contained_object_ids, owner_address);
     }
 
+    int64_t max_inline_size = max_direct_call_object_size_;
+    if (RayConfig::instance().adaptive_task_return_inlining() &&
+        static_cast<int64_t>(data_size) >=
+            RayConfig::instance().adaptive_task_return_inlining_min_bytes() &&
+        static_cast<int64_t>(memory_store_->UsedMemory()) >
+            RayConfig::instance()
+                .adaptive_task_return_inlining_memory_pressure_bytes()) {
+      // The local memory store is under pressure, typically because callers
+      // are submitting faster than they consume returns. Send large returns
+      // through plasma instead of inlining them so the bytes aren't duplicated
+      // into the reply and into every downstream task spec that borrows them.
+      max_inline_size = RayConfig::instance().adaptive_task_return_inlining_min_bytes();
+    }
     // Allocate a buffer for the return object.
-    if (static_cast<int64_t>(data_size) < max_direct_call_object_size_ &&
+    if (static_cast<int64_t>(data_size) < max_inline_size &&
         // ensure we don't exceed the limit if we allocate this object inline.
         (*task_output_inlined_bytes + static_cast<int64_t>(data_size) <=
          RayConfig::instance().task_rpc_inlined_bytes_limit())) {
@@ -3107,19 +3360,18 @@ bool CoreWorker::PinExistingReturnObject(const ObjectID &return_id,
     // Asynchronously ask the raylet to pin the object. Note that this can fail
     // if the raylet fails. We expect the owner of the object to handle that
     // case (e.g., by detecting the raylet failure and storing an error).
-    local_raylet_rpc_client_->PinObjectIDs(
+    PinObjectAtLocalRaylet(
         owner_address,
-        {return_id},
+        return_id,
         generator_id,
-        [return_id, pinned_return_object](const Status &pin_object_status,
-                                          const rpc::PinObjectIDsReply &reply) {
+        [return_id, pinned_return_object](const Status &pin_object_status, bool success) {
           // RPC to the local raylet should never fail.
           if (!pin_object_status.ok()) {
             RAY_LOG(ERROR) << "Request to local raylet to pin object failed: "
                            << pin_object_status.ToString();
             return;
           }
-          if (!reply.successes(0)) {
+          if (!success) {
             RAY_LOG(INFO).WithField(return_id)
                 << "Failed to pin existing copy of the task return object. "
                    "This object may get evicted while there are still "
@@ -3236,6 +3488,50 @@ void CoreWorker::HandleReportGeneratorItemReturns(
       });
 }
 
+void CoreWorker::HandleForwardInlineResult(rpc::ForwardInlineResultRequest request,
+                                           rpc::ForwardInlineResultReply *reply,
+                                           rpc::SendReplyCallback send_reply_callback) {
+  if (HandleWrongRecipient(WorkerID::FromBinary(request.intended_worker_id()),
+                           send_reply_callback)) {
+    return;
+  }
+  const auto object_id = ObjectID::FromBinary(request.result().object_id());
+  RAY_LOG(DEBUG).WithField(object_id) << "Received forwarded inline result";
+  // Only accept the forwarded value if this worker already holds a reference
+  // to the object; otherwise the put could outlive all local users and leak.
+  if (!reference_counter_->HasReference(object_id)) {
+    send_reply_callback(Status::OK(), nullptr, nullptr);
+    return;
+  }
+  bool in_plasma = false;
+  if (memory_store_->Contains(object_id, &in_plasma)) {
+    // The value already arrived through the owner-routed path.
+    send_reply_callback(Status::OK(), nullptr, nullptr);
+    return;
+  }
+  const auto &result = request.result();
+  std::shared_ptr<Buffer> data_buffer;
+  if (!result.data().empty()) {
+    data_buffer = std::make_shared<LocalMemoryBuffer>(
+        const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(result.data().data())),
+        result.data().size());
+  }
+  std::shared_ptr<Buffer> metadata_buffer;
+  if (!result.metadata().empty()) {
+    metadata_buffer = std::make_shared<LocalMemoryBuffer>(
+        const_cast<uint8_t *>(
+            reinterpret_cast<const uint8_t *>(result.metadata().data())),
+        result.metadata().size());
+  }
+  const auto nested_refs =
+      VectorFromProtobuf<rpc::ObjectReference>(result.nested_inlined_refs());
+  // The request's buffers die with this handler, so copy the value into the
+  // in-memory store.
+  RayObject object(data_buffer, metadata_buffer, nested_refs, /*copy_data=*/true);
+  memory_store_->Put(object, object_id, /*has_reference=*/true);
+  send_reply_callback(Status::OK(), nullptr, nullptr);
+}
+
 Status CoreWorker::GetAndPinArgsForExecutor(const TaskSpecification &task,
                                             std::vector<std::shared_ptr<RayObject>> *args,
                                             std::vector<rpc::ObjectReference> *arg_refs,
@@ -3409,6 +3705,79 @@ void CoreWorker::HandlePushTask(rpc::PushTaskRequest request,
   }
 }
 
+void CoreWorker::HandlePushTaskBatch(rpc::PushTaskBatchRequest request,
+                                     rpc::PushTaskBatchReply *reply,
+                                     rpc::SendReplyCallback send_reply_callback) {
+  if (request.tasks_size() == 0) {
+    send_reply_callback(Status::OK(), nullptr, nullptr);
+    return;
+  }
+  // Preallocate one reply slot per task up front so the slot addresses stay
+  // stable while the tasks complete asynchronously.
+  for (int i = 0; i < request.tasks_size(); i++) {
+    reply->add_task_replies();
+  }
+
+  // Fan-in state shared by the per-task reply callbacks. The batch reply is
+  // sent once every task has replied; the batch shares one status, which is
+  // the first non-OK status any task replied with.
+  struct BatchReplyState {
+    BatchReplyState(int num_pending, rpc::SendReplyCallback callback)
+        : num_pending_(num_pending), send_reply_callback_(std::move(callback)) {}
+    absl::Mutex mu_;
+    int num_pending_ ABSL_GUARDED_BY(mu_);
+    Status status_ ABSL_GUARDED_BY(mu_) = Status::OK();
+    std::vector<std::function<void()>> success_callbacks_ ABSL_GUARDED_BY(mu_);
+    std::vector<std::function<void()>> failure_callbacks_ ABSL_GUARDED_BY(mu_);
+    rpc::SendReplyCallback send_reply_callback_;
+  };
+  auto state = std::make_shared<BatchReplyState>(request.tasks_size(),
+                                                 std::move(send_reply_callback));
+
+  for (int i = 0; i < request.tasks_size(); i++) {
+    HandlePushTask(
+        std::move(*request.mutable_tasks(i)),
+        reply->mutable_task_replies(i),
+        [state](Status status,
+                std::function<void()> success,
+                std::function<void()> failure) {
+          Status batch_status;
+          std::vector<std::function<void()>> success_callbacks;
+          std::vector<std::function<void()>> failure_callbacks;
+          {
+            absl::MutexLock lock(&state->mu_);
+            if (state->status_.ok() && !status.ok()) {
+              state->status_ = status;
+            }
+            if (success != nullptr) {
+              state->success_callbacks_.push_back(std::move(success));
+            }
+            if (failure != nullptr) {
+              state->failure_callbacks_.push_back(std::move(failure));
+            }
+            if (--state->num_pending_ > 0) {
+              return;
+            }
+            batch_status = state->status_;
+            success_callbacks = std::move(state->success_callbacks_);
+            failure_callbacks = std::move(state->failure_callbacks_);
+          }
+          state->send_reply_callback_(
+              batch_status,
+              [success_callbacks = std::move(success_callbacks)]() {
+                for (const auto &callback : success_callbacks) {
+                  callback();
+                }
+              },
+              [failure_callbacks = std::move(failure_callbacks)]() {
+                for (const auto &callback : failure_callbacks) {
+                  callback();
+                }
+              });
+        });
+  }
+}
+
 void CoreWorker::HandleActorCallArgWaitComplete(
     rpc::ActorCallArgWaitCompleteRequest request,
     rpc::ActorCallArgWaitCompleteReply *reply,
@@ -3560,7 +3929,7 @@ void CoreWorker::ProcessSubscribeForObjectEviction(
     pub_message.mutable_worker_object_eviction_message()->set_object_id(
         object_id.Binary());
 
-    object_info_publisher_->Publish(std::move(pub_message));
+    PublishObjectEviction(std::move(pub_message));
   };
 
   const auto object_id = ObjectID::FromBinary(message.object_id());
@@ -3602,6 +3971,37 @@ void CoreWorker::ProcessSubscribeForObjectEviction(
   }
 }
 
+void CoreWorker::PublishObjectEviction(rpc::PubMessage pub_message) {
+  if (!RayConfig::instance().batch_object_eviction_publishes_enabled()) {
+    object_info_publisher_->Publish(std::move(pub_message));
+    return;
+  }
+  bool schedule_flush = false;
+  {
+    absl::MutexLock lock(&object_eviction_publish_mutex_);
+    buffered_object_eviction_publishes_.push_back(std::move(pub_message));
+    schedule_flush = !object_eviction_flush_scheduled_;
+    object_eviction_flush_scheduled_ = true;
+  }
+  if (schedule_flush) {
+    // Evictions fired in the same burst (e.g. FreePlasmaObjects over a large
+    // object list) land in the buffer before the flush runs, so the whole burst
+    // goes out as one batched publish.
+    io_service_.post([this] { FlushObjectEvictionPublishes(); },
+                     "CoreWorker.FlushObjectEvictionPublishes");
+  }
+}
+
+void CoreWorker::FlushObjectEvictionPublishes() {
+  std::vector<rpc::PubMessage> to_publish;
+  {
+    absl::MutexLock lock(&object_eviction_publish_mutex_);
+    to_publish.swap(buffered_object_eviction_publishes_);
+    object_eviction_flush_scheduled_ = false;
+  }
+  object_info_publisher_->PublishBatch(std::move(to_publish));
+}
+
 StatusSet<StatusT::InvalidArgument> CoreWorker::ProcessSubscribeMessage(
     const rpc::SubMessage &sub_message,
     rpc::ChannelType channel_type,
@@ -201,7 +201,9 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
              std::unique_ptr<worker::TaskEventBuffer> task_event_buffer,
              uint32_t pid,
              ray::observability::MetricInterface &task_by_state_counter,
-             ray::observability::MetricInterface &actor_by_state_counter);
+             ray::observability::MetricInterface &actor_by_state_counter,
+             ray::observability::MetricInterface &actor_task_queue_depth_gauge,
+             ray::observability::MetricInterface &actor_task_queue_head_wait_gauge);
 
   CoreWorker(CoreWorker const &) = delete;
 
@@ -677,6 +679,17 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
   Status GetIfLocal(const std::vector<ObjectID> &ids,
                     std::vector<std::shared_ptr<RayObject>> *results);
 
+  /// Hint that the given objects will be consumed soon, so that fetching them
+  /// to the local node can overlap with ongoing compute. This starts pulling
+  /// the objects into the local plasma store without blocking; a later Get
+  /// picks them up locally if the pull has finished. Objects whose owner is
+  /// unknown are skipped. Hints are best-effort and bounded: see
+  /// `worker_max_active_object_prefetch_hints`.
+  ///
+  /// \param[in] ids IDs of the objects expected to be consumed soon.
+  /// \return Status.
+  Status PrefetchObjects(const std::vector<ObjectID> &ids);
+
   /// Return whether or not the object store contains the given object.
   ///
   /// \param[in] object_id ID of the objects to check for.
@@ -804,6 +817,14 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
                                         rpc::ReportGeneratorItemReturnsReply *reply,
                                         rpc::SendReplyCallback send_reply_callback);
 
+  /// Implements gRPC server handler.
+  /// An executor invokes this endpoint to deliver an inlined task return
+  /// directly to this worker, when the owner registered this worker as the
+  /// result's forward destination.
+  void HandleForwardInlineResult(rpc::ForwardInlineResultRequest request,
+                                 rpc::ForwardInlineResultReply *reply,
+                                 rpc::SendReplyCallback send_reply_callback);
+
   ///
   /// Public methods related to task submission.
   ///
@@ -1177,6 +1198,13 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
                       rpc::PushTaskReply *reply,
                       rpc::SendReplyCallback send_reply_callback);
 
+  /// Implements gRPC server handler. Unpacks the batch in order and handles
+  /// each entry like a PushTask request; the reply is sent once every entry
+  /// has completed.
+  void HandlePushTaskBatch(rpc::PushTaskBatchRequest request,
+                           rpc::PushTaskBatchReply *reply,
+                           rpc::SendReplyCallback send_reply_callback);
+
   /// Implements gRPC server handler.
   void HandleActorCallArgWaitComplete(rpc::ActorCallArgWaitCompleteRequest request,
                                       rpc::ActorCallArgWaitCompleteReply *reply,
@@ -1528,6 +1556,31 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
                                const ObjectID &object_id,
                                bool pin_object);
 
+  /// Ask the local raylet to pin a plasma object, coalescing requests into
+  /// batched PinObjectIDs RPCs. While an RPC is in flight, further requests
+  /// with the same owner and generator queue up and go out together in the
+  /// next RPC, so a task producing many return objects issues O(batches)
+  /// RPCs instead of one per object. The caller must hold a local plasma
+  /// reference to the object until the callback fires, to prevent eviction
+  /// before the raylet has pinned it.
+  ///
+  /// \param[in] owner_address The owner to record for the pinned object.
+  /// \param[in] object_id The object to pin.
+  /// \param[in] generator_id If the object is a dynamic return, the ID of the
+  /// generator task that produced it, else Nil.
+  /// \param[in] callback Invoked with the RPC status and this object's pin
+  /// result from the group ack.
+  void PinObjectAtLocalRaylet(const rpc::Address &owner_address,
+                              const ObjectID &object_id,
+                              const ObjectID &generator_id,
+                              std::function<void(const Status &status, bool success)>
+                                  callback) ABSL_LOCKS_EXCLUDED(local_pin_batch_mutex_);
+
+  /// Send all queued pin requests for the given batch key in one PinObjectIDs
+  /// RPC to the local raylet.
+  void SendLocalPinBatch(const std::pair<WorkerID, ObjectID> &batch_key)
+      ABSL_LOCKS_EXCLUDED(local_pin_batch_mutex_);
+
   /// Get the values of the task arguments for the executor. Values are
   /// retrieved from the local plasma store or, if the value is inlined, from
   /// the task spec.
@@ -1566,6 +1619,15 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
   void ProcessSubscribeForObjectEviction(
       const rpc::WorkerObjectEvictionSubMessage &message);
 
+  /// Publish an object eviction message. When
+  /// `batch_object_eviction_publishes_enabled` is set, publishes fired in the
+  /// same burst (e.g. freeing a large list of objects) are coalesced and
+  /// published as one batch from the event loop.
+  void PublishObjectEviction(rpc::PubMessage pub_message);
+
+  /// Publish the eviction messages buffered by PublishObjectEviction.
+  void FlushObjectEvictionPublishes();
+
   /// Process a subscribe message for wait for ref removed.
   /// It is used for the ref counting protocol. When the borrower
   /// stops using the reference, the message will be published to the owner.
@@ -1686,6 +1748,23 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
                     const int64_t timeout_ms,
                     std::vector<std::shared_ptr<RayObject>> &results);
 
+  /// Fast path of GetObjects() for small batches of distinct object ids (up
+  /// to `core_worker_small_get_max_batch_size`). Memory store results are
+  /// resolved positionally, without the per-call hash sets and maps that
+  /// dominate sub-millisecond gets of a single object. Objects promoted to
+  /// plasma still go through the regular plasma fetch.
+  ///
+  /// \param[in] ids IDs of the objects to get. Must be distinct.
+  /// \param[in] timeout_ms Timeout in milliseconds, wait infinitely if it's negative.
+  /// \param[in] start_time The time when the get started, used to adjust the
+  /// timeout for the plasma fetch.
+  /// \param[out] results Result list of objects data.
+  /// \return Status.
+  Status GetObjectsSmall(const std::vector<ObjectID> &ids,
+                         const int64_t timeout_ms,
+                         int64_t start_time,
+                         std::vector<std::shared_ptr<RayObject>> &results);
+
   /// Helper to compute idleness from precomputed counters.
   ///
   /// We consider the worker to be idle if it doesn't have object references and it
@@ -1800,6 +1879,15 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
   // A class to publish object status from other raylets/workers.
   std::unique_ptr<pubsub::PublisherInterface> object_info_publisher_;
 
+  // Buffers object eviction publishes so eviction bursts go out as batches.
+  // Guarded by its own mutex because out-of-scope and freed callbacks can fire
+  // from any thread.
+  absl::Mutex object_eviction_publish_mutex_;
+  std::vector<rpc::PubMessage> buffered_object_eviction_publishes_
+      ABSL_GUARDED_BY(object_eviction_publish_mutex_);
+  bool object_eviction_flush_scheduled_ ABSL_GUARDED_BY(object_eviction_publish_mutex_) =
+      false;
+
   // A class to subscribe object status from other raylets/workers.
   std::unique_ptr<pubsub::SubscriberInterface> object_info_subscriber_;
 
@@ -1917,6 +2005,31 @@ class CoreWorker : public std::enable_shared_from_this<CoreWorker> {
   /// Callback to cleanup actor instance before shutdown
   std::function<void()> actor_shutdown_callback_;
 
+  // Guards local_pin_batches_.
+  absl::Mutex local_pin_batch_mutex_;
+
+  // A pin request to the local raylet that is waiting to be sent, together
+  // with the callback to invoke with its result from the group ack.
+  struct PendingObjectPin {
+    ObjectID object_id;
+    std::function<void(const Status &status, bool success)> callback;
+  };
+
+  // Queued pin requests for one (owner worker, generator) pair, which are the
+  // per-request fields of the PinObjectIDs RPC. Requests queue up here while
+  // an RPC for the same key is in flight and are flushed in one batch when it
+  // replies.
+  struct LocalPinBatch {
+    rpc::Address owner_address;
+    std::vector<PendingObjectPin> queued;
+    bool rpc_in_flight = false;
+  };
+
+  // Pending batched pin requests to the local raylet, keyed by owner worker
+  // ID and generator ID.
+  absl::flat_hash_map<std::pair<WorkerID, ObjectID>, LocalPinBatch> local_pin_batches_
+      ABSL_GUARDED_BY(local_pin_batch_mutex_);
+
   // Guards generator_ids_pending_deletion_.
   absl::Mutex generator_ids_pending_deletion_mutex_;
 
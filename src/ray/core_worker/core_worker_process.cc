@@ -249,6 +249,14 @@ std::shared_ptr<CoreWorker> CoreWorkerProcessImpl::CreateCoreWorker(
       std::make_unique<rpc::GrpcServer>(WorkerTypeString(options.worker_type),
                                         assigned_port,
                                         options.node_ip_address == "127.0.0.1");
+  const auto &same_node_socket_dir =
+      RayConfig::instance().core_worker_same_node_socket_dir();
+  if (!same_node_socket_dir.empty() && assigned_port > 0) {
+    // Core worker clients on this node derive the same path from our
+    // announced port and connect over it instead of TCP loopback.
+    core_worker_server->SetUnixSocketPath(
+        rpc::CoreWorkerSameNodeSocketPath(same_node_socket_dir, assigned_port));
+  }
   // Start RPC server after all the task receivers are properly initialized and we have
   // our assigned port from the raylet.
   core_worker_server->RegisterService(
@@ -494,6 +502,30 @@ std::shared_ptr<CoreWorker> CoreWorkerProcessImpl::CreateCoreWorker(
               set_direct_transport_metadata(object_id, direct_transport_metadata);
             },
             "CoreWorker.SetDirectTransportMetadata");
+      },
+      /*push_object_location_hint_callback=*/
+      [this](const NodeID &consumer_node_id,
+             const ObjectID &object_id,
+             const NodeID &location_node_id,
+             uint64_t object_size) {
+        auto core_worker = GetCoreWorker();
+        auto node_info =
+            core_worker->gcs_client_->Nodes().GetNodeAddressAndLiveness(consumer_node_id);
+        if (!node_info.has_value()) {
+          // The consumer's node is dead or unknown; nothing to hint.
+          return;
+        }
+        auto addr = rpc::RayletClientPool::GenerateRayletAddress(
+            consumer_node_id,
+            node_info->node_manager_address(),
+            node_info->node_manager_port());
+        core_worker->raylet_client_pool_->GetOrConnectByAddress(addr)->HintObjectLocation(
+            object_id,
+            location_node_id,
+            object_size,
+            [](const Status &status, const rpc::HintObjectLocationReply &reply) {
+              // Best effort; the location pubsub is the reliable path.
+            });
       });
 
   auto on_excess_queueing = [this](const ActorID &actor_id,
@@ -704,7 +736,9 @@ std::shared_ptr<CoreWorker> CoreWorkerProcessImpl::CreateCoreWorker(
                                    std::move(task_event_buffer),
                                    pid,
                                    *task_by_state_gauge_,
-                                   *actor_by_state_gauge_);
+                                   *actor_by_state_gauge_,
+                                   *actor_task_queue_depth_gauge_,
+                                   *actor_task_queue_head_wait_gauge_);
 
   core_worker->InitializeShutdownExecutor();
 
@@ -820,6 +854,10 @@ CoreWorkerProcessImpl::CoreWorkerProcessImpl(const CoreWorkerOptions &options)
       new ray::stats::Gauge(GetTaskByStateGaugeMetric()));
   actor_by_state_gauge_ = std::unique_ptr<ray::stats::Gauge>(
       new ray::stats::Gauge(GetActorByStateGaugeMetric()));
+  actor_task_queue_depth_gauge_ = std::unique_ptr<ray::stats::Gauge>(
+      new ray::stats::Gauge(GetActorTaskQueueDepthGaugeMetric()));
+  actor_task_queue_head_wait_gauge_ = std::unique_ptr<ray::stats::Gauge>(
+      new ray::stats::Gauge(GetActorTaskQueueHeadWaitGaugeMetric()));
   total_lineage_bytes_gauge_ = std::unique_ptr<ray::stats::Gauge>(
       new ray::stats::Gauge(GetTotalLineageBytesGaugeMetric()));
   owned_objects_counter_ = std::unique_ptr<ray::stats::Gauge>(
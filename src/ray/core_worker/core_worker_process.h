@@ -191,6 +191,8 @@ class CoreWorkerProcessImpl {
 
   std::unique_ptr<ray::stats::Gauge> task_by_state_gauge_;
   std::unique_ptr<ray::stats::Gauge> actor_by_state_gauge_;
+  std::unique_ptr<ray::stats::Gauge> actor_task_queue_depth_gauge_;
+  std::unique_ptr<ray::stats::Gauge> actor_task_queue_head_wait_gauge_;
   std::unique_ptr<ray::stats::Gauge> total_lineage_bytes_gauge_;
   std::unique_ptr<ray::stats::Gauge> owned_objects_counter_;
   std::unique_ptr<ray::stats::Gauge> owned_objects_size_counter_;
@@ -47,6 +47,7 @@ namespace core {
 class CoreWorkerServiceHandlerProxy : public rpc::CoreWorkerServiceHandler {
  public:
   RAY_CORE_WORKER_RPC_PROXY(PushTask)
+  RAY_CORE_WORKER_RPC_PROXY(PushTaskBatch)
   RAY_CORE_WORKER_RPC_PROXY(ActorCallArgWaitComplete)
   RAY_CORE_WORKER_RPC_PROXY(RayletNotifyGCSRestart)
   RAY_CORE_WORKER_RPC_PROXY(GetObjectStatus)
@@ -56,6 +57,7 @@ class CoreWorkerServiceHandlerProxy : public rpc::CoreWorkerServiceHandler {
   RAY_CORE_WORKER_RPC_PROXY(UpdateObjectLocationBatch)
   RAY_CORE_WORKER_RPC_PROXY(GetObjectLocationsOwner)
   RAY_CORE_WORKER_RPC_PROXY(ReportGeneratorItemReturns)
+  RAY_CORE_WORKER_RPC_PROXY(ForwardInlineResult)
   RAY_CORE_WORKER_RPC_PROXY(KillActor)
   RAY_CORE_WORKER_RPC_PROXY(CancelTask)
   RAY_CORE_WORKER_RPC_PROXY(RequestOwnerToCancelTask)
@@ -16,6 +16,7 @@
 
 #include <fcntl.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -225,14 +226,20 @@ Status MutableObjectManager::WriteAcquire(const ObjectID &object_id,
   }
 
   std::unique_ptr<plasma::MutableObject> &object = channel->mutable_object;
+  // In ring mode the buffer is divided into `ring_slots` version slots, so a
+  // single version can only be as large as one slot.
+  const int64_t ring_slots = std::max<int64_t>(
+      RayConfig::instance().experimental_mutable_object_ring_slots(), 1);
+  const int64_t slot_size = object->allocated_size / ring_slots;
   int64_t total_size = data_size + metadata_size;
-  if (total_size > object->allocated_size) {
+  if (total_size > slot_size) {
     return Status::InvalidArgument(
         absl::StrFormat("Serialized size of mutable data (%ld) + metadata size (%ld) "
-                        "is larger than allocated buffer size (%ld)",
+                        "is larger than %s size (%ld)",
                         data_size,
                         metadata_size,
-                        object->allocated_size));
+                        ring_slots > 1 ? "ring slot" : "allocated buffer",
+                        slot_size));
   }
 
   PlasmaObjectHeader::Semaphores sem{};
@@ -247,9 +254,19 @@ Status MutableObjectManager::WriteAcquire(const ObjectID &object_id,
   RAY_CHECK(!channel->written) << "You must call WriteRelease() before WriteAcquire()";
 
   auto timeout_point = ToTimeoutPoint(timeout_ms);
-  RAY_RETURN_NOT_OK(object->header->WriteAcquire(
-      sem, data_size, metadata_size, num_readers, timeout_point));
-  data = SharedMemoryBuffer::Slice(object->buffer, 0, data_size);
+  int64_t data_offset = 0;
+  if (ring_slots > 1) {
+    int64_t slot_index = 0;
+    RAY_RETURN_NOT_OK(object->header->WriteAcquireRing(
+        sem, data_size, metadata_size, ring_slots, slot_index, timeout_point));
+    channel->write_slot = slot_index;
+    data_offset = slot_index * slot_size;
+  } else {
+    RAY_RETURN_NOT_OK(object->header->WriteAcquire(
+        sem, data_size, metadata_size, num_readers, timeout_point));
+  }
+  channel->ring_slots = ring_slots;
+  data = SharedMemoryBuffer::Slice(object->buffer, data_offset, data_size);
   if (metadata != nullptr) {
     // Copy the metadata to the buffer.
     memcpy(data->Data() + data_size, metadata, metadata_size);
@@ -273,7 +290,11 @@ Status MutableObjectManager::GetObjectBackingStore(const ObjectID &object_id,
 
   std::unique_ptr<plasma::MutableObject> &object = channel->mutable_object;
   int64_t total_size = data_size + metadata_size;
-  data = SharedMemoryBuffer::Slice(object->buffer, 0, total_size);
+  int64_t data_offset = 0;
+  if (channel->ring_slots > 1) {
+    data_offset = channel->write_slot * (object->allocated_size / channel->ring_slots);
+  }
+  data = SharedMemoryBuffer::Slice(object->buffer, data_offset, total_size);
   return Status::OK();
 }
 
@@ -297,7 +318,11 @@ Status MutableObjectManager::WriteRelease(const ObjectID &object_id) {
   RAY_RETURN_NOT_OK(object->header->CheckHasError());
   RAY_CHECK(channel->written) << "You must call WriteAcquire() before WriteRelease()";
 
-  RAY_RETURN_NOT_OK(object->header->WriteRelease(sem));
+  if (channel->ring_slots > 1) {
+    RAY_RETURN_NOT_OK(object->header->WriteReleaseRing(sem));
+  } else {
+    RAY_RETURN_NOT_OK(object->header->WriteRelease(sem));
+  }
   channel->written = false;
   return Status::OK();
 }
@@ -350,12 +375,37 @@ Status MutableObjectManager::ReadAcquire(const ObjectID &object_id,
 
   channel->reading = true;
   int64_t version_read = 0;
-  Status s = object->header->ReadAcquire(object_id,
-                                         sem,
-                                         channel->next_version_to_read,
-                                         version_read,
-                                         check_signals_,
-                                         timeout_point);
+  const int64_t ring_slots = std::max<int64_t>(
+      RayConfig::instance().experimental_mutable_object_ring_slots(), 1);
+  int64_t data_offset = 0;
+  uint64_t read_data_size = 0;
+  uint64_t read_metadata_size = 0;
+  Status s;
+  if (ring_slots > 1) {
+    int64_t slot_index = 0;
+    s = object->header->ReadAcquireRing(sem,
+                                        channel->next_version_to_read,
+                                        version_read,
+                                        slot_index,
+                                        read_data_size,
+                                        read_metadata_size,
+                                        check_signals_,
+                                        timeout_point);
+    if (s.ok()) {
+      data_offset = slot_index * (object->allocated_size / ring_slots);
+    }
+  } else {
+    s = object->header->ReadAcquire(object_id,
+                                    sem,
+                                    channel->next_version_to_read,
+                                    version_read,
+                                    check_signals_,
+                                    timeout_point);
+    if (s.ok()) {
+      read_data_size = object->header->data_size;
+      read_metadata_size = object->header->metadata_size;
+    }
+  }
   if (!s.ok()) {
     RAY_LOG(DEBUG).WithField(object_id) << "ReadAcquire error was set, returning";
     // Failed because the error bit was set on the mutable object.
@@ -365,20 +415,22 @@ Status MutableObjectManager::ReadAcquire(const ObjectID &object_id,
   }
   RAY_CHECK_GT(version_read, 0);
   channel->next_version_to_read = version_read;
+  channel->ring_slots = ring_slots;
 
-  size_t total_size = object->header->data_size + object->header->metadata_size;
-  RAY_CHECK_LE(static_cast<int64_t>(total_size), channel->mutable_object->allocated_size);
+  size_t total_size = read_data_size + read_metadata_size;
+  RAY_CHECK_LE(static_cast<int64_t>(data_offset + total_size),
+               channel->mutable_object->allocated_size);
   std::shared_ptr<MutableObjectBuffer> channel_buffer =
       std::make_shared<MutableObjectBuffer>(
           shared_from_this(), channel->mutable_object->buffer, object_id);
   std::shared_ptr<SharedMemoryBuffer> data_buf =
       SharedMemoryBuffer::Slice(channel_buffer,
-                                /*offset=*/0,
-                                /*size=*/object->header->data_size);
+                                /*offset=*/data_offset,
+                                /*size=*/read_data_size);
   std::shared_ptr<SharedMemoryBuffer> metadata_buf =
       SharedMemoryBuffer::Slice(channel_buffer,
-                                /*offset=*/object->header->data_size,
-                                /*size=*/object->header->metadata_size);
+                                /*offset=*/data_offset + read_data_size,
+                                /*size=*/read_metadata_size);
 
   result = std::make_shared<RayObject>(
       std::move(data_buf), std::move(metadata_buf), std::vector<rpc::ObjectReference>());
@@ -390,13 +442,13 @@ Status MutableObjectManager::ReadAcquire(const ObjectID &object_id,
     // copy of the buffer here so that the MutableObjectBuffer can be
     // immediately released.
     std::shared_ptr<LocalMemoryBuffer> data_copy = std::make_shared<LocalMemoryBuffer>(
-        channel_buffer->Data(),
-        /*size=*/channel->mutable_object->header->data_size,
+        channel_buffer->Data() + data_offset,
+        /*size=*/read_data_size,
         /*copy_data=*/true);
     std::shared_ptr<LocalMemoryBuffer> metadata_copy =
         std::make_shared<LocalMemoryBuffer>(
-            channel_buffer->Data() + channel->mutable_object->header->data_size,
-            /*size=*/channel->mutable_object->header->metadata_size,
+            channel_buffer->Data() + data_offset + read_data_size,
+            /*size=*/read_metadata_size,
             /*copy_data=*/true);
     result = std::make_shared<RayObject>(std::move(data_copy),
                                          std::move(metadata_copy),
@@ -430,7 +482,9 @@ Status MutableObjectManager::ReadRelease(const ObjectID &object_id)
         "Must call ReadAcquire() on the channel before ReadRelease()");
   }
 
-  Status s = object->header->ReadRelease(sem, channel->next_version_to_read);
+  Status s = channel->ring_slots > 1
+                 ? object->header->ReadReleaseRing(sem, channel->next_version_to_read)
+                 : object->header->ReadRelease(sem, channel->next_version_to_read);
   if (!s.ok()) {
     RAY_LOG(DEBUG).WithField(object_id) << "ReadRelease error was set, returning";
     // Failed because the error bit was set on the mutable object.
@@ -91,6 +91,14 @@ class MutableObjectManager : public std::enable_shared_from_this<MutableObjectMa
     bool reader_registered = false;
     bool writer_registered = false;
 
+    // The number of ring slots of the channel, cached on the first acquire.
+    // 0 until then; 1 for the default blocking mode (see
+    // `RAY_experimental_mutable_object_ring_slots`).
+    int64_t ring_slots = 0;
+    // In ring mode, the slot that WriteAcquire() wrote into. Valid between
+    // WriteAcquire() and WriteRelease().
+    int64_t write_slot = 0;
+
     std::unique_ptr<plasma::MutableObject> mutable_object;
   } ABSL_CACHELINE_ALIGNED;
 
@@ -247,6 +255,7 @@ class MutableObjectManager : public std::enable_shared_from_this<MutableObjectMa
       ABSL_SHARED_LOCKS_REQUIRED(destructor_lock_);
 
   FRIEND_TEST(MutableObjectTest, TestBasic);
+  FRIEND_TEST(MutableObjectTest, TestRingSlots);
   FRIEND_TEST(MutableObjectTest, TestMultipleReaders);
   FRIEND_TEST(MutableObjectTest, TestWriterFails);
   FRIEND_TEST(MutableObjectTest, TestWriterFailsAfterAcquire);
@@ -32,6 +32,10 @@ void CoreWorkerGrpcService::InitServerCallFactories(
                                                           PushTask,
                                                           max_active_rpcs_per_handler_,
                                                           ClusterIdAuthType::NO_AUTH);
+  RPC_SERVICE_HANDLER_CUSTOM_AUTH_SERVER_METRICS_DISABLED(CoreWorkerService,
+                                                          PushTaskBatch,
+                                                          max_active_rpcs_per_handler_,
+                                                          ClusterIdAuthType::NO_AUTH);
   RPC_SERVICE_HANDLER_CUSTOM_AUTH_SERVER_METRICS_DISABLED(CoreWorkerService,
                                                           ActorCallArgWaitComplete,
                                                           max_active_rpcs_per_handler_,
@@ -68,6 +72,10 @@ void CoreWorkerGrpcService::InitServerCallFactories(
                                                           ReportGeneratorItemReturns,
                                                           max_active_rpcs_per_handler_,
                                                           ClusterIdAuthType::NO_AUTH);
+  RPC_SERVICE_HANDLER_CUSTOM_AUTH_SERVER_METRICS_DISABLED(CoreWorkerService,
+                                                          ForwardInlineResult,
+                                                          max_active_rpcs_per_handler_,
+                                                          ClusterIdAuthType::NO_AUTH);
   RPC_SERVICE_HANDLER_CUSTOM_AUTH_SERVER_METRICS_DISABLED(CoreWorkerService,
                                                           KillActor,
                                                           max_active_rpcs_per_handler_,
@@ -52,6 +52,10 @@ class CoreWorkerServiceHandler : public DelayedServiceHandler {
                               PushTaskReply *reply,
                               SendReplyCallback send_reply_callback) = 0;
 
+  virtual void HandlePushTaskBatch(PushTaskBatchRequest request,
+                                   PushTaskBatchReply *reply,
+                                   SendReplyCallback send_reply_callback) = 0;
+
   virtual void HandleActorCallArgWaitComplete(ActorCallArgWaitCompleteRequest request,
                                               ActorCallArgWaitCompleteReply *reply,
                                               SendReplyCallback send_reply_callback) = 0;
@@ -88,6 +92,10 @@ class CoreWorkerServiceHandler : public DelayedServiceHandler {
       ReportGeneratorItemReturnsReply *reply,
       SendReplyCallback send_reply_callback) = 0;
 
+  virtual void HandleForwardInlineResult(ForwardInlineResultRequest request,
+                                         ForwardInlineResultReply *reply,
+                                         SendReplyCallback send_reply_callback) = 0;
+
   virtual void HandleKillActor(KillActorRequest request,
                                KillActorReply *reply,
                                SendReplyCallback send_reply_callback) = 0;
@@ -14,9 +14,11 @@
 
 #include "ray/core_worker/lease_policy.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "absl/container/flat_hash_map.h"
+#include "ray/common/ray_config.h"
 
 namespace ray {
 namespace core {
@@ -59,20 +61,27 @@ std::pair<rpc::Address, bool> LocalityAwareLeasePolicy::GetBestNodeForLease(
   return std::make_pair(fallback_rpc_address_, false);
 }
 
-/// Criteria for "best" node: The node with the most object bytes (from object_ids) local.
+/// Criteria for "best" node: The node with the most object bytes (from object_ids)
+/// local. Bytes that a node only holds on external storage are discounted, since
+/// using that copy still pays for a restore; an in-memory copy of the same bytes
+/// on another node always scores higher.
 std::optional<NodeID> LocalityAwareLeasePolicy::GetBestNodeIdForLease(
     const LeaseSpecification &spec) {
   const auto object_ids = spec.GetDependencyIds();
-  // Number of object bytes (from object_ids) that a given node has local.
-  absl::flat_hash_map<NodeID, uint64_t> bytes_local_table;
-  uint64_t max_bytes = 0;
+  const double spilled_weight = std::clamp<double>(
+      RayConfig::instance().locality_aware_leasing_spilled_bytes_weight(), 0., 1.);
+  // Weighted number of object bytes (from object_ids) that a given node has local.
+  absl::flat_hash_map<NodeID, double> bytes_local_table;
+  double max_bytes = 0;
   std::optional<NodeID> max_bytes_node;
   // Finds the node with the maximum number of object bytes local.
   for (const ObjectID &object_id : object_ids) {
     if (auto locality_data = locality_data_provider_.GetLocalityData(object_id)) {
       for (const NodeID &node_id : locality_data->nodes_containing_object) {
+        const bool spilled_only =
+            locality_data->nodes_with_spilled_copy.contains(node_id);
         auto &bytes = bytes_local_table[node_id];
-        bytes += locality_data->object_size;
+        bytes += locality_data->object_size * (spilled_only ? spilled_weight : 1.);
         // Update max, if needed.
         if (bytes > max_bytes) {
           max_bytes = bytes;
@@ -27,6 +27,9 @@ namespace core {
 struct LocalityData {
   uint64_t object_size{};
   absl::flat_hash_set<NodeID> nodes_containing_object;
+  /// The subset of nodes_containing_object that only hold the object on
+  /// external storage, i.e. using the copy there requires a restore first.
+  absl::flat_hash_set<NodeID> nodes_with_spilled_copy;
 };
 
 /// Interface for providers of locality data to the lease policy.
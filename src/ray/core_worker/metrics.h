@@ -62,6 +62,45 @@ inline ray::stats::Gauge GetSizeOfOwnedObjectsByStateGaugeMetric() {
   };
 }
 
+inline ray::stats::Gauge GetActorTaskQueueDepthGaugeMetric() {
+  return ray::stats::Gauge{
+      /*name=*/"actor_task_execution_queue_depth",
+      /*description=*/
+      "Current number of actor tasks queued on this worker waiting to execute.",
+      /*unit=*/"count",
+      /*tag_keys=*/{},
+  };
+}
+
+inline ray::stats::Gauge GetActorTaskQueueHeadWaitGaugeMetric() {
+  return ray::stats::Gauge{
+      /*name=*/"actor_task_execution_queue_head_wait_ms",
+      /*description=*/
+      "How long the actor task at the head of the execution queue has been blocked, "
+      "waiting either for its dependencies or for an earlier sequence number to "
+      "arrive. Reports the maximum across this worker's per-caller queues.",
+      /*unit=*/"ms",
+      /*tag_keys=*/{},
+  };
+}
+
+inline ray::stats::Histogram GetTaskStageTimeMsHistogramMetric() {
+  return ray::stats::Histogram{
+      /*name=*/"task_stage_time_ms",
+      /*description=*/
+      "Per-stage latency of sampled task attempts, derived from the status "
+      "transitions each worker records. Only populated when "
+      "task_stage_trace_sample_rate > 0.",
+      /*unit=*/"ms",
+      /*boundaries=*/{1, 10, 100, 1000, 10000},
+      // Expected tags:
+      // - Stage: the pair of task statuses the duration spans, e.g.
+      // "PENDING_NODE_ASSIGNMENT-SUBMITTED_TO_WORKER"
+      // - Type: "ACTOR_TASK" or "NORMAL_TASK"
+      /*tag_keys=*/{"Stage", "Type"},
+  };
+}
+
 inline ray::stats::Gauge GetTotalLineageBytesGaugeMetric() {
   return ray::stats::Gauge{
       /*name=*/"total_lineage_bytes",
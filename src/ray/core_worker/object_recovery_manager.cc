@@ -111,28 +111,85 @@ void ObjectRecoveryManager::PinExistingObjectCopy(
     const rpc::Address &raylet_address,
     std::vector<rpc::Address> other_locations) {
   // If a copy still exists, pin the object by sending a
-  // PinObjectIDs RPC.
+  // PinObjectIDs RPC. Requests to the same raylet are coalesced: while an RPC
+  // is in flight, further requests queue up and go out together in the next
+  // RPC.
   const auto node_id = NodeID::FromBinary(raylet_address.node_id());
   RAY_LOG(DEBUG).WithField(object_id).WithField(node_id)
       << "Trying to pin copy of lost object at node";
 
+  {
+    absl::MutexLock lock(&pin_batch_mu_);
+    auto &batch = pin_batches_[node_id];
+    batch.raylet_address = raylet_address;
+    batch.queued.push_back(PendingPin{object_id, std::move(other_locations)});
+    if (batch.rpc_in_flight) {
+      // Will be sent together with any other queued requests when the
+      // in-flight RPC replies.
+      return;
+    }
+    batch.rpc_in_flight = true;
+  }
+  SendPinBatch(node_id);
+}
+
+void ObjectRecoveryManager::SendPinBatch(const NodeID &node_id) {
+  rpc::Address raylet_address;
+  std::vector<PendingPin> pins;
+  {
+    absl::MutexLock lock(&pin_batch_mu_);
+    auto it = pin_batches_.find(node_id);
+    RAY_CHECK(it != pin_batches_.end());
+    raylet_address = it->second.raylet_address;
+    pins.swap(it->second.queued);
+  }
+
+  std::vector<ObjectID> object_ids;
+  object_ids.reserve(pins.size());
+  for (const auto &pin : pins) {
+    object_ids.push_back(pin.object_id);
+  }
+  RAY_LOG(DEBUG).WithField(node_id)
+      << "Pinning batch of " << object_ids.size() << " lost objects at node";
+
   raylet_client_pool_->GetOrConnectByAddress(raylet_address)
       ->PinObjectIDs(
           rpc_address_,
-          {object_id},
+          object_ids,
           /*generator_id=*/ObjectID::Nil(),
-          [this, object_id, other_locations = std::move(other_locations), node_id](
+          [this, node_id, pins = std::move(pins)](
               const Status &status, const rpc::PinObjectIDsReply &reply) mutable {
-            if (status.ok() && reply.successes(0)) {
-              in_memory_store_.Put(RayObject(rpc::ErrorType::OBJECT_IN_PLASMA),
-                                   object_id,
-                                   reference_counter_.HasReference(object_id));
-              reference_counter_.UpdateObjectPinnedAtRaylet(object_id, node_id);
-            } else {
-              RAY_LOG(INFO).WithField(object_id)
-                  << "Error pinning secondary copy of lost object due to " << status
-                  << ", trying again with other locations";
-              PinOrReconstructObject(object_id, std::move(other_locations));
+            for (size_t i = 0; i < pins.size(); i++) {
+              auto &pin = pins[i];
+              const bool pinned = status.ok() &&
+                                  static_cast<int>(i) < reply.successes_size() &&
+                                  reply.successes(i);
+              if (pinned) {
+                in_memory_store_.Put(RayObject(rpc::ErrorType::OBJECT_IN_PLASMA),
+                                     pin.object_id,
+                                     reference_counter_.HasReference(pin.object_id));
+                reference_counter_.UpdateObjectPinnedAtRaylet(pin.object_id, node_id);
+              } else {
+                RAY_LOG(INFO).WithField(pin.object_id)
+                    << "Error pinning secondary copy of lost object due to " << status
+                    << ", trying again with other locations";
+                PinOrReconstructObject(pin.object_id, std::move(pin.other_locations));
+              }
+            }
+
+            bool send_next = false;
+            {
+              absl::MutexLock lock(&pin_batch_mu_);
+              auto it = pin_batches_.find(node_id);
+              RAY_CHECK(it != pin_batches_.end());
+              if (it->second.queued.empty()) {
+                pin_batches_.erase(it);
+              } else {
+                send_next = true;
+              }
+            }
+            if (send_next) {
+              SendPinBatch(node_id);
             }
           });
 }
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/id.h"
 #include "ray/core_worker/reference_counter_interface.h"
@@ -99,11 +100,18 @@ class ObjectRecoveryManager {
                               std::vector<rpc::Address> locations);
 
   /// Pin a new copy for the object at the given location. If that fails, then
-  /// try one of the other locations.
+  /// try one of the other locations. Pin requests to the same raylet are
+  /// batched: while a PinObjectIDs RPC is in flight to a raylet, further
+  /// requests queue up and are sent together in the next RPC, so recovering
+  /// many objects from one node costs a few RPCs instead of one per object.
   void PinExistingObjectCopy(const ObjectID &object_id,
                              const rpc::Address &raylet_address,
                              std::vector<rpc::Address> other_locations);
 
+  /// Send one PinObjectIDs RPC carrying all queued pin requests for the given
+  /// node. The caller must have marked the node's batch as in flight.
+  void SendPinBatch(const NodeID &node_id);
+
   /// Reconstruct an object by resubmitting the task that created it.
   void ReconstructObject(const ObjectID &object_id);
 
@@ -134,6 +142,27 @@ class ObjectRecoveryManager {
   absl::Mutex objects_pending_recovery_mu_;
   absl::flat_hash_set<ObjectID> objects_pending_recovery_
       ABSL_GUARDED_BY(objects_pending_recovery_mu_);
+
+  /// A pin request that has been queued behind an in-flight PinObjectIDs RPC.
+  struct PendingPin {
+    ObjectID object_id;
+    /// Locations to fall back to if this pin fails.
+    std::vector<rpc::Address> other_locations;
+  };
+
+  /// Queued pin requests for one raylet.
+  struct PinBatch {
+    rpc::Address raylet_address;
+    std::vector<PendingPin> queued;
+    /// Whether a PinObjectIDs RPC is in flight to this raylet. Queued
+    /// requests are sent in one batch when the in-flight RPC replies.
+    bool rpc_in_flight = false;
+  };
+
+  absl::Mutex pin_batch_mu_;
+  /// Pending pin batches keyed by the raylet's node ID. An entry exists only
+  /// while requests are queued or an RPC is in flight for that raylet.
+  absl::flat_hash_map<NodeID, PinBatch> pin_batches_ ABSL_GUARDED_BY(pin_batch_mu_);
 };
 
 }  // namespace core
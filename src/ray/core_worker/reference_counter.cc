@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "ray/common/ray_config.h"
 #include "ray/util/logging.h"
 #include "ray/util/network_util.h"
 
@@ -31,12 +32,12 @@ namespace ray {
 namespace core {
 
 size_t ReferenceCounter::Size() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return object_id_refs_.size();
 }
 
 bool ReferenceCounter::OwnedByUs(const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it != object_id_refs_.end()) {
     return it->second.owned_by_us_;
@@ -127,7 +128,7 @@ bool ReferenceCounter::AddBorrowedObjectInternal(const ObjectID &object_id,
                                                  bool foreign_owner_already_monitoring) {
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
-    it = object_id_refs_.emplace(object_id, Reference()).first;
+    it = EmplaceReference(object_id, Reference());
   }
 
   RAY_LOG(DEBUG) << "Adding borrowed object " << object_id;
@@ -160,7 +161,7 @@ void ReferenceCounter::AddObjectRefStats(
     const absl::flat_hash_map<ObjectID, std::pair<int64_t, std::string>> &pinned_objects,
     rpc::CoreWorkerStats *stats,
     const int64_t limit) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto total = object_id_refs_.size();
   auto count = 0;
 
@@ -174,7 +175,7 @@ void ReferenceCounter::AddObjectRefStats(
     ref_proto->set_object_id(ref.first.Binary());
     ref_proto->set_call_site(ref.second.call_site_);
     ref_proto->set_object_size(ref.second.object_size_);
-    ref_proto->set_local_ref_count(ref.second.local_ref_count);
+    ref_proto->set_local_ref_count(ref.second.LocalRefCount());
     ref_proto->set_submitted_task_ref_count(ref.second.submitted_task_ref_count);
     auto it = pinned_objects.find(ref.first);
     if (it != pinned_objects.end()) {
@@ -315,7 +316,7 @@ void ReferenceCounter::TryReleaseLocalRefs(const std::vector<ObjectID> &object_i
       continue;
     }
 
-    if (it->second.local_ref_count == 0) {
+    if (it->second.LocalRefCount() == 0) {
       // Unconsumed ref has already been released.
       continue;
     }
@@ -367,15 +368,13 @@ bool ReferenceCounter::AddOwnedObjectInternal(
   // in the frontend language, incrementing the reference count.
   // TODO(swang): Objects that are not reconstructable should not increment
   // their arguments' lineage ref counts.
-  auto it = object_id_refs_
-                .emplace(object_id,
-                         Reference(owner_address,
-                                   call_site,
-                                   object_size,
-                                   lineage_eligibility,
-                                   pinned_at_node_id,
-                                   tensor_transport))
-                .first;
+  auto it = EmplaceReference(object_id,
+                             Reference(owner_address,
+                                       call_site,
+                                       object_size,
+                                       lineage_eligibility,
+                                       pinned_at_node_id,
+                                       tensor_transport));
   if (!inner_ids.empty()) {
     // Mark that this object ID contains other inner IDs. Then, we will not GC
     // the inner objects until the outer object ID goes out of scope.
@@ -392,7 +391,7 @@ bool ReferenceCounter::AddOwnedObjectInternal(
   RAY_CHECK(reconstructable_owned_objects_index_.emplace(object_id, back_it).second);
 
   if (add_local_ref) {
-    it->second.local_ref_count++;
+    it->second.IncrementLocalRefCount();
   }
 
   // Update the owned object counters for the new reference
@@ -415,19 +414,61 @@ void ReferenceCounter::UpdateObjectSize(const ObjectID &object_id, int64_t objec
   }
 }
 
+ReferenceCounter::ReferenceTable::iterator ReferenceCounter::EmplaceReference(
+    const ObjectID &object_id, Reference ref) {
+  auto [it, inserted] = object_id_refs_.emplace(object_id, std::move(ref));
+  if (inserted && local_ref_fast_path_enabled_) {
+    auto &stripe = GetLocalRefStripe(object_id);
+    absl::MutexLock lock(&stripe.mu);
+    stripe.counters.emplace(object_id, it->second.local_ref_count);
+  }
+  return it;
+}
+
+bool ReferenceCounter::TryUpdateLocalRefFastPath(const ObjectID &object_id,
+                                                 bool increment) {
+  auto &stripe = GetLocalRefStripe(object_id);
+  absl::MutexLock lock(&stripe.mu);
+  auto it = stripe.counters.find(object_id);
+  if (it == stripe.counters.end()) {
+    return false;
+  }
+  auto &counter = *it->second;
+  // Increments from 0 and decrements to 0 must take the slow path, so the
+  // CAS only succeeds above a floor. This guarantees that the slow path's
+  // decisions to create, delete, or mark a reference in use (all made while
+  // holding mutex_) cannot be invalidated by a concurrent fast-path update.
+  const size_t floor = increment ? 1 : 2;
+  size_t count = counter.load(std::memory_order_relaxed);
+  while (count >= floor) {
+    if (counter.compare_exchange_weak(count,
+                                      increment ? count + 1 : count - 1,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void ReferenceCounter::AddLocalReference(const ObjectID &object_id,
                                          const std::string &call_site) {
   if (object_id.IsNil()) {
     return;
   }
+  if (local_ref_fast_path_enabled_ &&
+      TryUpdateLocalRefFastPath(object_id, /*increment=*/true)) {
+    RAY_LOG(DEBUG) << "Add local reference " << object_id;
+    return;
+  }
   absl::MutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
     // NOTE: ownership info for these objects must be added later via AddBorrowedObject.
-    it = object_id_refs_.emplace(object_id, Reference(call_site, -1)).first;
+    it = EmplaceReference(object_id, Reference(call_site, -1));
   }
   bool was_in_use = it->second.RefCount() > 0;
-  it->second.local_ref_count++;
+  it->second.IncrementLocalRefCount();
   RAY_LOG(DEBUG) << "Add local reference " << object_id;
   PRINT_REF_COUNT(it);
   if (!was_in_use && it->second.RefCount() > 0) {
@@ -451,7 +492,7 @@ void ReferenceCounter::ReleaseAllLocalReferences() {
   absl::MutexLock lock(&mutex_);
   std::vector<ObjectID> refs_to_remove;
   for (auto &ref : object_id_refs_) {
-    for (int i = ref.second.local_ref_count; i > 0; --i) {
+    for (size_t i = ref.second.LocalRefCount(); i > 0; --i) {
       refs_to_remove.push_back(ref.first);
     }
   }
@@ -465,6 +506,13 @@ void ReferenceCounter::RemoveLocalReference(const ObjectID &object_id,
   if (object_id.IsNil()) {
     return;
   }
+  // The fast path only succeeds when the count stays above zero, so a
+  // successful fast-path decrement can never trigger a deletion.
+  if (local_ref_fast_path_enabled_ &&
+      TryUpdateLocalRefFastPath(object_id, /*increment=*/false)) {
+    RAY_LOG(DEBUG) << "Remove local reference " << object_id;
+    return;
+  }
   absl::MutexLock lock(&mutex_);
   RemoveLocalReferenceInternal(object_id, deleted);
 }
@@ -478,13 +526,13 @@ void ReferenceCounter::RemoveLocalReferenceInternal(const ObjectID &object_id,
         << "Tried to decrease ref count for nonexistent object ID: " << object_id;
     return;
   }
-  if (it->second.local_ref_count == 0) {
+  if (it->second.LocalRefCount() == 0) {
     RAY_LOG_EVERY_MS(WARNING, 5000)
         << "Tried to decrease ref count for object ID that has count 0 " << object_id
         << ". This should only happen if ray.internal.free was called earlier.";
     return;
   }
-  it->second.local_ref_count--;
+  it->second.DecrementLocalRefCount();
   RAY_LOG(DEBUG) << "Remove local reference " << object_id;
   PRINT_REF_COUNT(it);
   if (it->second.RefCount() == 0) {
@@ -509,7 +557,7 @@ void ReferenceCounter::UpdateSubmittedTaskReferences(
     if (it == object_id_refs_.end()) {
       // This happens if a large argument is transparently passed by reference
       // because we don't hold a Python reference to its ObjectID.
-      it = object_id_refs_.emplace(argument_id, Reference()).first;
+      it = EmplaceReference(argument_id, Reference());
     }
     bool was_in_use = it->second.RefCount() > 0;
     it->second.submitted_task_ref_count++;
@@ -632,13 +680,13 @@ void ReferenceCounter::RemoveSubmittedTaskReferences(
 }
 
 bool ReferenceCounter::HasOwner(const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return object_id_refs_.find(object_id) != object_id_refs_.end();
 }
 
 StatusSet<StatusT::NotFound> ReferenceCounter::HasOwner(
     const std::vector<ObjectID> &object_ids) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   std::ostringstream objects_missing_owners;
   bool missing_owner = false;
   for (const auto &object_id : object_ids) {
@@ -656,7 +704,7 @@ StatusSet<StatusT::NotFound> ReferenceCounter::HasOwner(
 
 bool ReferenceCounter::GetOwner(const ObjectID &object_id,
                                 rpc::Address *owner_address) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return GetOwnerInternal(object_id, owner_address);
 }
 
@@ -677,7 +725,7 @@ bool ReferenceCounter::GetOwnerInternal(const ObjectID &object_id,
 
 std::vector<rpc::Address> ReferenceCounter::GetOwnerAddresses(
     const std::vector<ObjectID> &object_ids) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   std::vector<rpc::Address> owner_addresses;
   for (const auto &object_id : object_ids) {
     rpc::Address owner_addr;
@@ -701,7 +749,7 @@ std::vector<rpc::Address> ReferenceCounter::GetOwnerAddresses(
 }
 
 bool ReferenceCounter::IsPlasmaObjectFreed(const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return freed_objects_.contains(object_id);
 }
 
@@ -816,6 +864,11 @@ void ReferenceCounter::EraseReference(ReferenceTable::iterator it) {
     callback(it->first);
   }
 
+  if (local_ref_fast_path_enabled_) {
+    auto &stripe = GetLocalRefStripe(it->first);
+    absl::MutexLock lock(&stripe.mu);
+    stripe.counters.erase(it->first);
+  }
   object_id_refs_.erase(it);
   ShutdownIfNeeded();
 }
@@ -953,7 +1006,7 @@ bool ReferenceCounter::IsPlasmaObjectPinnedOrSpilled(const ObjectID &object_id,
                                                      bool *owned_by_us,
                                                      NodeID *pinned_at,
                                                      bool *spilled) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it != object_id_refs_.end()) {
     if (it->second.owned_by_us_) {
@@ -967,22 +1020,22 @@ bool ReferenceCounter::IsPlasmaObjectPinnedOrSpilled(const ObjectID &object_id,
 }
 
 bool ReferenceCounter::HasReference(const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return object_id_refs_.find(object_id) != object_id_refs_.end();
 }
 
 size_t ReferenceCounter::NumObjectIDsInScope() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return object_id_refs_.size();
 }
 
 size_t ReferenceCounter::NumObjectsOwnedByUs() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return num_objects_owned_by_us_;
 }
 
 size_t ReferenceCounter::NumActorsOwnedByUs() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   return num_actors_owned_by_us_;
 }
 
@@ -1004,7 +1057,7 @@ void ReferenceCounter::RecordMetrics() {
 }
 
 std::unordered_set<ObjectID> ReferenceCounter::GetAllInScopeObjectIDs() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   std::unordered_set<ObjectID> in_scope_object_ids;
   in_scope_object_ids.reserve(object_id_refs_.size());
   for (const auto &[id, ref] : object_id_refs_) {
@@ -1015,12 +1068,13 @@ std::unordered_set<ObjectID> ReferenceCounter::GetAllInScopeObjectIDs() const {
 
 std::unordered_map<ObjectID, std::pair<size_t, size_t>>
 ReferenceCounter::GetAllReferenceCounts() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   std::unordered_map<ObjectID, std::pair<size_t, size_t>> all_ref_counts;
   all_ref_counts.reserve(object_id_refs_.size());
   for (const auto &[id, ref] : object_id_refs_) {
     all_ref_counts.emplace(
-        id, std::pair<size_t, size_t>(ref.local_ref_count, ref.submitted_task_ref_count));
+        id,
+        std::pair<size_t, size_t>(ref.LocalRefCount(), ref.submitted_task_ref_count));
   }
   return all_ref_counts;
 }
@@ -1053,12 +1107,12 @@ void ReferenceCounter::PopAndClearLocalBorrowers(
           << "Tried to decrease ref count for nonexistent object.";
       continue;
     }
-    if (it->second.local_ref_count == 0) {
+    if (it->second.LocalRefCount() == 0) {
       RAY_LOG(WARNING).WithField(borrowed_id)
           << "Tried to decrease ref count for object ID that has count 0. This should "
              "only happen if ray.internal.free was called earlier.";
     } else {
-      it->second.local_ref_count--;
+      it->second.DecrementLocalRefCount();
     }
     PRINT_REF_COUNT(it);
     if (it->second.RefCount() == 0) {
@@ -1147,14 +1201,14 @@ void ReferenceCounter::MergeRemoteBorrowers(const ObjectID &object_id,
   const auto &borrower_ref = borrower_it->second;
   RAY_LOG(DEBUG).WithField(object_id)
       << "Borrower ref has " << borrower_ref.borrow().borrowers.size() << " borrowers"
-      << ", local: " << borrower_ref.local_ref_count
+      << ", local: " << borrower_ref.LocalRefCount()
       << ", submitted: " << borrower_ref.submitted_task_ref_count
       << ", contained_in_owned: " << borrower_ref.nested().contained_in_owned.size()
       << ", stored_in_objects: " << borrower_ref.borrow().stored_in_objects.size();
 
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
-    it = object_id_refs_.emplace(object_id, Reference()).first;
+    it = EmplaceReference(object_id, Reference());
   }
   std::vector<rpc::Address> new_borrowers;
 
@@ -1321,7 +1375,7 @@ void ReferenceCounter::AddNestedObjectIdsInternal(const ObjectID &object_id,
       // WARNING: Following loop could invalidate `it` iterator on insertion.
       // That's why we use two loops, and we should avoid using `it` hearafter.
       for (const auto &inner_id : inner_ids) {
-        auto inner_it = object_id_refs_.emplace(inner_id, Reference()).first;
+        auto inner_it = EmplaceReference(inner_id, Reference());
         bool was_in_use = inner_it->second.RefCount() > 0;
         inner_it->second.mutable_nested()->contained_in_owned.insert(object_id);
         if (!was_in_use && inner_it->second.RefCount() > 0) {
@@ -1339,7 +1393,7 @@ void ReferenceCounter::AddNestedObjectIdsInternal(const ObjectID &object_id,
           << " to object, borrower owns outer ID " << object_id;
       auto inner_it = object_id_refs_.find(inner_id);
       if (inner_it == object_id_refs_.end()) {
-        inner_it = object_id_refs_.emplace(inner_id, Reference()).first;
+        inner_it = EmplaceReference(inner_id, Reference());
       }
       // Add the task's caller as a borrower.
       if (inner_it->second.owned_by_us_) {
@@ -1397,7 +1451,7 @@ void ReferenceCounter::SubscribeRefRemoved(const ObjectID &object_id,
 
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
-    it = object_id_refs_.emplace(object_id, Reference()).first;
+    it = EmplaceReference(object_id, Reference());
   }
 
   auto &reference = it->second;
@@ -1506,7 +1560,7 @@ void ReferenceCounter::UpdateObjectPendingCreationInternal(const ObjectID &objec
 
 std::optional<absl::flat_hash_set<NodeID>> ReferenceCounter::GetObjectLocations(
     const ObjectID &object_id) {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
     RAY_LOG(DEBUG).WithField(object_id)
@@ -1566,7 +1620,7 @@ bool ReferenceCounter::HandleObjectSpilled(const ObjectID &object_id,
 
 std::optional<LocalityData> ReferenceCounter::GetLocalityData(
     const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   // Uses the reference table to return locality data for an object.
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
@@ -1599,9 +1653,20 @@ std::optional<LocalityData> ReferenceCounter::GetLocalityData(
     node_ids.emplace(it->second.pinned_at_node_id_.value());
   }
 
+  // Report which nodes only hold the object on external storage, so the lease
+  // policy can discount them: landing there still pays for a restore. If the
+  // spill node also has an in-memory copy, it is not discounted.
+  absl::flat_hash_set<NodeID> spilled_only_node_ids;
+  if (it->second.spilled && !it->second.spilled_node_id.IsNil() &&
+      !it->second.locations.contains(it->second.spilled_node_id)) {
+    node_ids.emplace(it->second.spilled_node_id);
+    spilled_only_node_ids.emplace(it->second.spilled_node_id);
+  }
+
   // We should only reach here if we have valid locality data to return.
-  std::optional<LocalityData> locality_data(
-      {static_cast<uint64_t>(object_size), std::move(node_ids)});
+  std::optional<LocalityData> locality_data({static_cast<uint64_t>(object_size),
+                                             std::move(node_ids),
+                                             std::move(spilled_only_node_ids)});
   return locality_data;
 }
 
@@ -1652,7 +1717,7 @@ LineageReconstructionEligibility ReferenceCounter::GetLineageReconstructionEligi
   if (!lineage_pinning_enabled_) {
     return LineageReconstructionEligibility::INELIGIBLE_LINEAGE_DISABLED;
   }
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
     return LineageReconstructionEligibility::INELIGIBLE_REF_NOT_FOUND;
@@ -1667,7 +1732,7 @@ void ReferenceCounter::UpdateObjectPendingCreation(const ObjectID &object_id,
 }
 
 bool ReferenceCounter::IsObjectPendingCreation(const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
     return false;
@@ -1675,7 +1740,8 @@ bool ReferenceCounter::IsObjectPendingCreation(const ObjectID &object_id) const
   return it->second.pending_creation_;
 }
 
-void ReferenceCounter::PushToLocationSubscribers(ReferenceTable::iterator it) {
+void ReferenceCounter::PushToLocationSubscribers(ReferenceTable::iterator it,
+                                                 bool force_full) {
   const auto &object_id = it->first;
   const auto &locations = it->second.locations;
   auto object_size = it->second.object_size_;
@@ -1692,7 +1758,35 @@ void ReferenceCounter::PushToLocationSubscribers(ReferenceTable::iterator it) {
   pub_message.set_key_id(object_id.Binary());
   pub_message.set_channel_type(rpc::ChannelType::WORKER_OBJECT_LOCATIONS_CHANNEL);
   auto object_locations_msg = pub_message.mutable_worker_object_locations_message();
-  FillObjectInformationInternal(it, object_locations_msg);
+  const bool delta_updates = RayConfig::instance().object_location_delta_updates();
+  if (delta_updates && !force_full && it->second.locations_published) {
+    // Publish only the nodes added and removed since the last published
+    // message; subscribers apply the delta to their last received set.
+    object_locations_msg->set_is_delta(true);
+    for (const auto &node_id : locations) {
+      if (!it->second.published_locations.contains(node_id)) {
+        object_locations_msg->add_node_ids_added(node_id.Binary());
+      }
+    }
+    for (const auto &node_id : it->second.published_locations) {
+      if (!locations.contains(node_id)) {
+        object_locations_msg->add_node_ids_removed(node_id.Binary());
+      }
+    }
+    if (object_size > 0) {
+      object_locations_msg->set_object_size(object_size);
+    }
+    object_locations_msg->set_spilled_url(spilled_url);
+    object_locations_msg->set_spilled_node_id(spilled_node_id.Binary());
+    object_locations_msg->set_pending_creation(it->second.pending_creation_);
+    object_locations_msg->set_did_spill(it->second.did_spill);
+  } else {
+    FillObjectInformationInternal(it, object_locations_msg);
+  }
+  if (delta_updates) {
+    it->second.published_locations = locations;
+  }
+  it->second.locations_published = true;
 
   object_info_publisher_->Publish(std::move(pub_message));
 }
@@ -1750,12 +1844,13 @@ void ReferenceCounter::PublishObjectLocationSnapshot(const ObjectID &object_id)
 
   // Always publish the location when subscribed for the first time.
   // This will ensure that the subscriber will get the first snapshot of the
-  // object location.
-  PushToLocationSubscribers(it);
+  // object location. The snapshot must carry the full location set so later
+  // delta messages have a base to apply to.
+  PushToLocationSubscribers(it, /*force_full=*/true);
 }
 
 std::string ReferenceCounter::DebugString() const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   std::stringstream ss;
   ss << "ReferenceTable{size: " << object_id_refs_.size();
   if (!object_id_refs_.empty()) {
@@ -1769,7 +1864,7 @@ std::string ReferenceCounter::DebugString() const {
 std::string ReferenceCounter::Reference::DebugString() const {
   std::stringstream ss;
   ss << "Reference{borrowers: " << borrow().borrowers.size()
-     << " local_ref_count: " << local_ref_count
+     << " local_ref_count: " << LocalRefCount()
      << " submitted_count: " << submitted_task_ref_count
      << " contained_on_owned: " << nested().contained_in_owned.size()
      << " contained_in_borrowed: " << nested().contained_in_borrowed_ids.size()
@@ -1783,7 +1878,8 @@ ReferenceCounter::Reference ReferenceCounter::Reference::FromProto(
     const rpc::ObjectReferenceCount &ref_count) {
   Reference ref;
   ref.owner_address_ = ref_count.reference().owner_address();
-  ref.local_ref_count = ref_count.has_local_ref() ? 1 : 0;
+  ref.local_ref_count->store(ref_count.has_local_ref() ? 1 : 0,
+                             std::memory_order_release);
 
   for (const auto &borrower : ref_count.borrowers()) {
     ref.mutable_borrow()->borrowers.insert(borrower);
@@ -1828,7 +1924,7 @@ void ReferenceCounter::Reference::ToProto(rpc::ObjectReferenceCount *ref,
 
 std::optional<std::string> ReferenceCounter::GetTensorTransport(
     const ObjectID &object_id) const {
-  absl::MutexLock lock(&mutex_);
+  absl::ReaderMutexLock lock(&mutex_);
   auto it = object_id_refs_.find(object_id);
   if (it == object_id_refs_.end()) {
     return std::nullopt;
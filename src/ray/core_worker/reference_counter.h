@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -27,6 +29,7 @@
 #include "absl/container/flat_hash_set.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/core_worker/lease_policy.h"
 #include "ray/core_worker/reference_counter_interface.h"
@@ -344,10 +347,25 @@ class ReferenceCounter : public ReferenceCounterInterface,
     /// - ObjectIDs containing this ObjectID that we own and that are still in
     /// scope.
     size_t RefCount() const {
-      return local_ref_count + submitted_task_ref_count +
+      return LocalRefCount() + submitted_task_ref_count +
              nested().contained_in_owned.size();
     }
 
+    /// The local ref count. Reads and writes go through the atomic because
+    /// the fast path in TryUpdateLocalRefFastPath may update the counter
+    /// without holding mutex_.
+    size_t LocalRefCount() const {
+      return local_ref_count->load(std::memory_order_acquire);
+    }
+
+    void IncrementLocalRefCount() {
+      local_ref_count->fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    void DecrementLocalRefCount() {
+      local_ref_count->fetch_sub(1, std::memory_order_acq_rel);
+    }
+
     /// Whether this reference is no longer in scope. A reference is in scope
     /// if any of the following are true:
     /// - The reference is still being used by this process.
@@ -430,6 +448,13 @@ class ReferenceCounter : public ReferenceCounterInterface,
     /// If this object is owned by us and stored in plasma, this contains all
     /// object locations.
     absl::flat_hash_set<NodeID> locations;
+    /// The location set as of the last message published to location
+    /// subscribers, used to compute delta updates. Only maintained when
+    /// object_location_delta_updates is enabled.
+    absl::flat_hash_set<NodeID> published_locations;
+    /// Whether any location message has been published for this object yet.
+    /// Deltas may only be published once a full message has gone out.
+    bool locations_published = false;
     /// The object's owner's address, if we know it. If this process is the
     /// owner, then this is added during creation of the Reference. If this is
     /// process is a borrower, the borrower must add the owner's address before
@@ -459,8 +484,12 @@ class ReferenceCounter : public ReferenceCounterInterface,
     /// because any dependent task will already have the value of the object.
     size_t lineage_ref_count = 0;
 
-    /// The local ref count for the ObjectID in the language frontend.
-    size_t local_ref_count = 0;
+    /// The local ref count for the ObjectID in the language frontend. Stored
+    /// behind a shared pointer so that the striped fast-path index can hold
+    /// the same counter and update it without holding mutex_ (see
+    /// local_ref_count_stripes_).
+    std::shared_ptr<std::atomic<size_t>> local_ref_count =
+        std::make_shared<std::atomic<size_t>>(0);
     /// The ref count for submitted tasks that depend on the ObjectID.
     size_t submitted_task_ref_count = 0;
 
@@ -533,7 +562,7 @@ class ReferenceCounter : public ReferenceCounterInterface,
 
   bool GetOwnerInternal(const ObjectID &object_id,
                         rpc::Address *owner_address = nullptr) const
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+      ABSL_SHARED_LOCKS_REQUIRED(mutex_);
 
   /// Unsets the raylet address
   /// that the object was pinned at or spilled at, if the address was set.
@@ -711,7 +740,10 @@ class ReferenceCounter : public ReferenceCounterInterface,
   /// Publish object locations to all subscribers.
   ///
   /// \param[in] it The reference iterator for the object.
-  void PushToLocationSubscribers(ReferenceTable::iterator it)
+  /// \param[in] force_full If true, publish the full location set even when
+  /// delta updates are enabled, e.g. for the snapshot a new subscriber
+  /// receives.
+  void PushToLocationSubscribers(ReferenceTable::iterator it, bool force_full = false)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
   /// Fill up the object information for the given iterator.
@@ -732,6 +764,26 @@ class ReferenceCounter : public ReferenceCounterInterface,
                                     std::vector<ObjectID> *deleted)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  /// Insert a new Reference into object_id_refs_, or return the existing
+  /// entry. All insertions must go through this helper so that the local ref
+  /// counter is registered in the fast-path stripe index.
+  ReferenceTable::iterator EmplaceReference(const ObjectID &object_id, Reference ref)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Try to adjust the local ref count for the object without taking mutex_.
+  /// This only succeeds when the update cannot change whether the object is in
+  /// use: increments require a current count of at least 1 and decrements a
+  /// current count of at least 2. Any 0 <-> 1 transition (which may create or
+  /// delete the Reference and update nested ref state) must go through the
+  /// mutex_-protected slow path instead.
+  ///
+  /// \param[in] object_id The object whose local ref count to update.
+  /// \param[in] increment Whether to increment or decrement the count.
+  /// \return Whether the count was updated. If false, the caller must fall
+  /// back to the slow path.
+  bool TryUpdateLocalRefFastPath(const ObjectID &object_id, bool increment)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
   /// Address of our RPC server. This is used to determine whether we own a
   /// given object or not, by comparing our WorkerID with the WorkerID of the
   /// object's owner.
@@ -743,12 +795,42 @@ class ReferenceCounter : public ReferenceCounterInterface,
   /// tasks that depend on that object that may be retried in the future.
   const bool lineage_pinning_enabled_;
 
-  /// Protects access to the reference counting state.
+  /// Protects access to the reference counting state. Read-only accessors
+  /// take this as a shared (reader) lock so that frontend threads querying
+  /// ownership or ref counts do not serialize against each other; any method
+  /// that may mutate the table takes it exclusively.
   mutable absl::Mutex mutex_;
 
   /// Holds all reference counts and dependency information for tracked ObjectIDs.
   ReferenceTable object_id_refs_ ABSL_GUARDED_BY(mutex_);
 
+  /// One shard of the fast-path index from ObjectID to its local ref counter.
+  /// The counters are shared with the corresponding References in
+  /// object_id_refs_. Entries are inserted and erased while holding both
+  /// mutex_ and the stripe lock, so the fast path (which only takes the stripe
+  /// lock) never observes a counter for an entry that does not exist.
+  struct LocalRefCountStripe {
+    absl::Mutex mu;
+    absl::flat_hash_map<ObjectID, std::shared_ptr<std::atomic<size_t>>> counters
+        ABSL_GUARDED_BY(mu);
+  };
+
+  /// Number of stripes in the fast-path index. Striping bounds contention
+  /// between threads updating the local ref counts of different objects.
+  static constexpr size_t kLocalRefCountStripes = 32;
+
+  LocalRefCountStripe &GetLocalRefStripe(const ObjectID &object_id) {
+    return local_ref_count_stripes_[object_id.Hash() % kLocalRefCountStripes];
+  }
+
+  std::array<LocalRefCountStripe, kLocalRefCountStripes> local_ref_count_stripes_;
+
+  /// Feature flag for the AddLocalReference/RemoveLocalReference fast path.
+  /// Cached at construction so the stripe index is either maintained for the
+  /// whole lifetime of this counter or not at all.
+  const bool local_ref_fast_path_enabled_ =
+      RayConfig::instance().reference_counter_local_ref_fast_path_enabled();
+
   /// Objects whose values have been freed by the language frontend.
   /// The values in plasma will not be pinned. An object ID is
   /// removed from this set once its Reference has been deleted
@@ -16,10 +16,12 @@
 
 #include <algorithm>
 #include <condition_variable>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "ray/common/buffer.h"
 #include "ray/common/ray_config.h"
 #include "ray/raylet_ipc_client/raylet_ipc_client_interface.h"
 #include "ray/stats/tag_defs.h"
@@ -124,6 +126,82 @@ std::shared_ptr<RayObject> GetRequest::Get(const ObjectID &object_id) const {
   return nullptr;
 }
 
+/// A pool of fixed-size memory blocks that back inline small-object entries.
+/// Each block holds one object's data and metadata back to back, so a small
+/// task result costs one (usually recycled) payload allocation instead of one
+/// aligned heap allocation per buffer.
+class InlineObjectBlockPool {
+ public:
+  explicit InlineObjectBlockPool(size_t block_size) : block_size_(block_size) {}
+
+  ~InlineObjectBlockPool() {
+    absl::MutexLock lock(&mu_);
+    for (uint8_t *block : free_blocks_) {
+      aligned_free(block);
+    }
+  }
+
+  size_t BlockSize() const { return block_size_; }
+
+  /// Get a block, reusing a previously released one when available.
+  uint8_t *Acquire() {
+    {
+      absl::MutexLock lock(&mu_);
+      if (!free_blocks_.empty()) {
+        uint8_t *block = free_blocks_.back();
+        free_blocks_.pop_back();
+        return block;
+      }
+    }
+    return reinterpret_cast<uint8_t *>(aligned_malloc(block_size_, BUFFER_ALIGNMENT));
+  }
+
+  /// Return a block to the pool for reuse.
+  void Release(uint8_t *block) {
+    {
+      absl::MutexLock lock(&mu_);
+      if (free_blocks_.size() < kMaxFreeBlocks) {
+        free_blocks_.push_back(block);
+        return;
+      }
+    }
+    aligned_free(block);
+  }
+
+ private:
+  /// Cap on the number of recycled blocks kept around, so a burst of small
+  /// objects doesn't pin the peak footprint forever.
+  static constexpr size_t kMaxFreeBlocks = 1024;
+
+  const size_t block_size_;
+  absl::Mutex mu_;
+  std::vector<uint8_t *> free_blocks_ ABSL_GUARDED_BY(mu_);
+};
+
+namespace {
+
+/// Owns one pool block for the lifetime of an inline object entry. The data
+/// and metadata buffers of the entry alias into the block and keep this holder
+/// alive; returning the block on destruction is what makes blocks recyclable.
+class InlineObjectBlock {
+ public:
+  InlineObjectBlock(std::shared_ptr<InlineObjectBlockPool> pool, uint8_t *block)
+      : pool_(std::move(pool)), block_(block) {}
+
+  ~InlineObjectBlock() { pool_->Release(block_); }
+
+  InlineObjectBlock(const InlineObjectBlock &) = delete;
+  InlineObjectBlock &operator=(const InlineObjectBlock &) = delete;
+
+  uint8_t *Data() const { return block_; }
+
+ private:
+  std::shared_ptr<InlineObjectBlockPool> pool_;
+  uint8_t *block_;
+};
+
+}  // namespace
+
 CoreWorkerMemoryStore::CoreWorkerMemoryStore(
     instrumented_io_context &io_context,
     bool reference_counting_enabled,
@@ -135,16 +213,39 @@ CoreWorkerMemoryStore::CoreWorkerMemoryStore(
     : io_context_(io_context),
       reference_counting_enabled_(reference_counting_enabled),
       raylet_ipc_client_(std::move(raylet_ipc_client)),
+      shards_(MakeShards()),
       check_signals_(std::move(check_signals)),
       unhandled_exception_handler_(std::move(unhandled_exception_handler)),
-      object_allocator_(std::move(object_allocator)) {}
+      object_allocator_(std::move(object_allocator)) {
+  const int64_t inline_max_bytes =
+      RayConfig::instance().core_worker_memory_store_inline_object_max_bytes();
+  if (inline_max_bytes > 0) {
+    inline_block_pool_ =
+        std::make_shared<InlineObjectBlockPool>(static_cast<size_t>(inline_max_bytes));
+  }
+}
+
+std::vector<std::unique_ptr<CoreWorkerMemoryStore::Shard>>
+CoreWorkerMemoryStore::MakeShards() {
+  size_t num_shards = 1;
+  while (num_shards < RayConfig::instance().core_worker_memory_store_num_shards()) {
+    num_shards *= 2;
+  }
+  std::vector<std::unique_ptr<Shard>> shards;
+  shards.reserve(num_shards);
+  for (size_t i = 0; i < num_shards; i++) {
+    shards.push_back(std::make_unique<Shard>());
+  }
+  return shards;
+}
 
 void CoreWorkerMemoryStore::GetAsync(
     const ObjectID &object_id, std::function<void(std::shared_ptr<RayObject>)> callback) {
-  absl::MutexLock lock(&mu_);
-  auto iter = objects_.find(object_id);
-  if (iter == objects_.end()) {
-    object_async_get_requests_[object_id].push_back(std::move(callback));
+  auto &shard = GetShard(object_id);
+  absl::MutexLock lock(&shard.mu);
+  auto iter = shard.objects.find(object_id);
+  if (iter == shard.objects.end()) {
+    shard.object_async_get_requests[object_id].push_back(std::move(callback));
     return;
   }
   auto &object_ptr = iter->second;
@@ -157,9 +258,10 @@ void CoreWorkerMemoryStore::GetAsync(
 std::shared_ptr<RayObject> CoreWorkerMemoryStore::GetIfExists(const ObjectID &object_id) {
   std::shared_ptr<RayObject> ptr;
   {
-    absl::MutexLock lock(&mu_);
-    auto iter = objects_.find(object_id);
-    if (iter != objects_.end()) {
+    auto &shard = GetShard(object_id);
+    absl::MutexLock lock(&shard.mu);
+    auto iter = shard.objects.find(object_id);
+    if (iter != shard.objects.end()) {
       ptr = iter->second;
     }
     if (ptr != nullptr) {
@@ -169,79 +271,166 @@ std::shared_ptr<RayObject> CoreWorkerMemoryStore::GetIfExists(const ObjectID &ob
   return ptr;
 }
 
-void CoreWorkerMemoryStore::Put(const RayObject &object,
-                                const ObjectID &object_id,
-                                const bool has_reference) {
-  std::vector<std::function<void(std::shared_ptr<RayObject>)>> async_callbacks;
-  RAY_LOG(DEBUG).WithField(object_id) << "Putting object into memory store.";
-  std::shared_ptr<RayObject> object_entry = nullptr;
+std::shared_ptr<RayObject> CoreWorkerMemoryStore::MakeObjectEntry(
+    const RayObject &object, const ObjectID &object_id) {
   if (object_allocator_ != nullptr) {
-    object_entry = object_allocator_(object, object_id);
-  } else {
-    object_entry = std::make_shared<RayObject>(object.GetData(),
-                                               object.GetMetadata(),
-                                               object.GetNestedRefs(),
-                                               true,
-                                               object.GetTensorTransport());
+    return object_allocator_(object, object_id);
+  }
+  if (auto inline_entry = TryMakeInlineObjectEntry(object)) {
+    return inline_entry;
   }
+  return std::make_shared<RayObject>(object.GetData(),
+                                     object.GetMetadata(),
+                                     object.GetNestedRefs(),
+                                     true,
+                                     object.GetTensorTransport());
+}
 
-  // TODO(edoakes): we should instead return a flag to the caller to put the object in
-  // plasma.
-  {
-    absl::MutexLock lock(&mu_);
+std::shared_ptr<RayObject> CoreWorkerMemoryStore::TryMakeInlineObjectEntry(
+    const RayObject &object) {
+  if (inline_block_pool_ == nullptr) {
+    return nullptr;
+  }
+  auto data = object.GetData();
+  const auto &metadata = object.GetMetadata();
+  const size_t data_size = data != nullptr ? data->Size() : 0;
+  const size_t metadata_size = metadata != nullptr ? metadata->Size() : 0;
+  if (data_size + metadata_size > inline_block_pool_->BlockSize()) {
+    return nullptr;
+  }
 
-    auto iter = objects_.find(object_id);
-    if (iter != objects_.end()) {
-      return;  // Object already exists in the store, which is fine.
+  auto block = std::make_shared<InlineObjectBlock>(inline_block_pool_,
+                                                   inline_block_pool_->Acquire());
+  uint8_t *payload = block->Data();
+  std::shared_ptr<Buffer> data_view;
+  if (data != nullptr) {
+    if (data_size > 0) {
+      std::memcpy(payload, data->Data(), data_size);
     }
-
-    auto async_callback_it = object_async_get_requests_.find(object_id);
-    if (async_callback_it != object_async_get_requests_.end()) {
-      auto &callbacks = async_callback_it->second;
-      async_callbacks = std::move(callbacks);
-      object_async_get_requests_.erase(async_callback_it);
+    data_view = std::make_shared<SharedOwnerBuffer>(block, payload, data_size);
+  }
+  std::shared_ptr<Buffer> metadata_view;
+  if (metadata != nullptr) {
+    if (metadata_size > 0) {
+      std::memcpy(payload + data_size, metadata->Data(), metadata_size);
     }
+    metadata_view =
+        std::make_shared<SharedOwnerBuffer>(block, payload + data_size, metadata_size);
+  }
+  // The views own their data (through the block holder), so the RayObject
+  // constructor won't make another copy despite copy_data=true.
+  return std::make_shared<RayObject>(data_view,
+                                     metadata_view,
+                                     object.GetNestedRefs(),
+                                     /*copy_data=*/true,
+                                     object.GetTensorTransport());
+}
 
-    auto object_request_iter = object_get_requests_.find(object_id);
-    if (object_request_iter != object_get_requests_.end()) {
-      auto &get_requests = object_request_iter->second;
-      for (auto &get_request : get_requests) {
-        get_request->Set(object_id, object_entry);
-      }
-    }
+void CoreWorkerMemoryStore::PutInternal(const ObjectID &object_id,
+                                        std::shared_ptr<RayObject> object_entry,
+                                        bool has_reference,
+                                        Shard &shard,
+                                        ReadyAsyncCallbacks *ready_callbacks) {
+  auto iter = shard.objects.find(object_id);
+  if (iter != shard.objects.end()) {
+    return;  // Object already exists in the store, which is fine.
+  }
 
-    // Don't put it in the store, if we can't get a callback for deletion.
-    // The exception here is if we are in local mode, put should still put the object in
-    // the store.
-    if (!reference_counting_enabled_ || has_reference) {
-      // If there is no existing get request, then add the `RayObject` to map.
-      EmplaceObjectAndUpdateStats(object_id, object_entry);
-    } else {
-      // It is equivalent to the object being added and immediately deleted from the
-      // store.
-      OnDelete(object_entry);
+  auto async_callback_it = shard.object_async_get_requests.find(object_id);
+  if (async_callback_it != shard.object_async_get_requests.end()) {
+    for (auto &callback : async_callback_it->second) {
+      ready_callbacks->emplace_back(std::move(callback), object_entry);
     }
+    shard.object_async_get_requests.erase(async_callback_it);
+    object_entry->SetAccessed();
+  }
 
-    if (!async_callbacks.empty()) {
-      object_entry->SetAccessed();
-    } else {
-      return;
+  auto object_request_iter = shard.object_get_requests.find(object_id);
+  if (object_request_iter != shard.object_get_requests.end()) {
+    auto &get_requests = object_request_iter->second;
+    for (auto &get_request : get_requests) {
+      get_request->Set(object_id, object_entry);
     }
   }
 
+  // Don't put it in the store, if we can't get a callback for deletion.
+  // The exception here is if we are in local mode, put should still put the object in
+  // the store.
+  if (!reference_counting_enabled_ || has_reference) {
+    // If there is no existing get request, then add the `RayObject` to map.
+    EmplaceObjectAndUpdateStats(object_id, object_entry, shard);
+  } else {
+    // It is equivalent to the object being added and immediately deleted from the
+    // store.
+    OnDelete(object_entry);
+  }
+}
+
+void CoreWorkerMemoryStore::PostReadyCallbacks(ReadyAsyncCallbacks ready_callbacks) {
+  if (ready_callbacks.empty()) {
+    return;
+  }
   // It's important for performance to run the callbacks outside the lock.
   // Posting the callbacks to the io_context_ ensures that the callbacks are run without
   // any locks held from the caller of Put(). See
   // https://github.com/ray-project/ray/issues/47649 for more details.
   io_context_.post(
-      [async_callbacks = std::move(async_callbacks), object_entry]() {
-        for (const auto &cb : async_callbacks) {
-          cb(object_entry);
+      [ready_callbacks = std::move(ready_callbacks)]() {
+        for (const auto &[callback, object_entry] : ready_callbacks) {
+          callback(object_entry);
         }
       },
       "CoreWorkerMemoryStore.Put.get_async_callbacks");
 }
 
+void CoreWorkerMemoryStore::Put(const RayObject &object,
+                                const ObjectID &object_id,
+                                const bool has_reference) {
+  RAY_LOG(DEBUG).WithField(object_id) << "Putting object into memory store.";
+  auto object_entry = MakeObjectEntry(object, object_id);
+
+  // TODO(edoakes): we should instead return a flag to the caller to put the object in
+  // plasma.
+  ReadyAsyncCallbacks ready_callbacks;
+  {
+    auto &shard = GetShard(object_id);
+    absl::MutexLock lock(&shard.mu);
+    PutInternal(
+        object_id, std::move(object_entry), has_reference, shard, &ready_callbacks);
+  }
+  PostReadyCallbacks(std::move(ready_callbacks));
+}
+
+void CoreWorkerMemoryStore::BatchPut(std::vector<PutRequest> puts) {
+  // Create the store-owned entries outside any shard lock, then group the
+  // insertions by shard so that each shard lock is taken at most once.
+  std::vector<std::shared_ptr<RayObject>> object_entries;
+  object_entries.reserve(puts.size());
+  std::vector<std::vector<size_t>> indices_per_shard(shards_.size());
+  for (size_t i = 0; i < puts.size(); i++) {
+    RAY_LOG(DEBUG).WithField(puts[i].object_id) << "Putting object into memory store.";
+    object_entries.push_back(MakeObjectEntry(puts[i].object, puts[i].object_id));
+    indices_per_shard[ShardIndex(puts[i].object_id)].push_back(i);
+  }
+
+  ReadyAsyncCallbacks ready_callbacks;
+  for (size_t shard_index = 0; shard_index < shards_.size(); shard_index++) {
+    if (indices_per_shard[shard_index].empty()) {
+      continue;
+    }
+    auto &shard = *shards_[shard_index];
+    absl::MutexLock lock(&shard.mu);
+    for (size_t i : indices_per_shard[shard_index]) {
+      PutInternal(puts[i].object_id,
+                  std::move(object_entries[i]),
+                  puts[i].has_reference,
+                  shard,
+                  &ready_callbacks);
+    }
+  }
+  PostReadyCallbacks(std::move(ready_callbacks));
+}
+
 Status CoreWorkerMemoryStore::Get(const std::vector<ObjectID> &object_ids,
                                   int num_objects,
                                   int64_t timeout_ms,
@@ -272,12 +461,13 @@ Status CoreWorkerMemoryStore::GetImpl(const std::vector<ObjectID> &object_ids,
     absl::flat_hash_set<ObjectID> remaining_ids;
     bool existing_objects_has_exception = false;
 
-    absl::MutexLock lock(&mu_);
     // Check for existing objects and see if this get request can be fullfilled.
     for (size_t i = 0; i < object_ids.size(); i++) {
       const auto &object_id = object_ids[i];
-      auto iter = objects_.find(object_id);
-      if (iter != objects_.end()) {
+      auto &shard = GetShard(object_id);
+      absl::MutexLock lock(&shard.mu);
+      auto iter = shard.objects.find(object_id);
+      if (iter != shard.objects.end()) {
         iter->second->SetAccessed();
         (*results)[i] = iter->second;
         num_found += 1;
@@ -307,7 +497,16 @@ Status CoreWorkerMemoryStore::GetImpl(const std::vector<ObjectID> &object_ids,
     get_request = std::make_shared<GetRequest>(
         std::move(remaining_ids), required_objects, abort_if_any_object_is_exception);
     for (const auto &object_id : get_request->ObjectIds()) {
-      object_get_requests_[object_id].push_back(get_request);
+      auto &shard = GetShard(object_id);
+      absl::MutexLock lock(&shard.mu);
+      auto iter = shard.objects.find(object_id);
+      if (iter != shard.objects.end()) {
+        // The object was put between the scan above and registering the
+        // request; feed it to the request directly so it isn't missed.
+        get_request->Set(object_id, iter->second);
+      } else {
+        shard.object_get_requests[object_id].push_back(get_request);
+      }
     }
   }
 
@@ -350,28 +549,27 @@ Status CoreWorkerMemoryStore::GetImpl(const std::vector<ObjectID> &object_ids,
     RAY_CHECK_OK(raylet_ipc_client_->NotifyWorkerUnblocked());
   }
 
-  {
-    absl::MutexLock lock(&mu_);
-    // Populate results.
-    for (size_t i = 0; i < object_ids.size(); i++) {
-      const auto &object_id = object_ids[i];
-      if ((*results)[i] == nullptr) {
-        (*results)[i] = get_request->Get(object_id);
-      }
+  // Populate results.
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    const auto &object_id = object_ids[i];
+    if ((*results)[i] == nullptr) {
+      (*results)[i] = get_request->Get(object_id);
     }
+  }
 
-    // Remove get request.
-    for (const auto &object_id : get_request->ObjectIds()) {
-      auto object_request_iter = object_get_requests_.find(object_id);
-      if (object_request_iter != object_get_requests_.end()) {
-        auto &get_requests = object_request_iter->second;
-        get_requests.erase(
-            std::remove(get_requests.begin(), get_requests.end(), get_request),
-            get_requests.end());
-
-        if (get_requests.empty()) {
-          object_get_requests_.erase(object_request_iter);
-        }
+  // Remove get request.
+  for (const auto &object_id : get_request->ObjectIds()) {
+    auto &shard = GetShard(object_id);
+    absl::MutexLock lock(&shard.mu);
+    auto object_request_iter = shard.object_get_requests.find(object_id);
+    if (object_request_iter != shard.object_get_requests.end()) {
+      auto &get_requests = object_request_iter->second;
+      get_requests.erase(
+          std::remove(get_requests.begin(), get_requests.end(), get_request),
+          get_requests.end());
+
+      if (get_requests.empty()) {
+        shard.object_get_requests.erase(object_request_iter);
       }
     }
   }
@@ -443,37 +641,40 @@ Status CoreWorkerMemoryStore::Wait(const absl::flat_hash_set<ObjectID> &object_i
 
 void CoreWorkerMemoryStore::Delete(const absl::flat_hash_set<ObjectID> &object_ids,
                                    absl::flat_hash_set<ObjectID> *plasma_ids_to_delete) {
-  absl::MutexLock lock(&mu_);
   for (const auto &object_id : object_ids) {
     RAY_LOG(DEBUG) << "Delete an object from a memory store. ObjectId: " << object_id;
-    auto it = objects_.find(object_id);
-    if (it != objects_.end()) {
+    auto &shard = GetShard(object_id);
+    absl::MutexLock lock(&shard.mu);
+    auto it = shard.objects.find(object_id);
+    if (it != shard.objects.end()) {
       if (it->second->IsInPlasmaError()) {
         plasma_ids_to_delete->insert(object_id);
       } else {
         OnDelete(it->second);
-        EraseObjectAndUpdateStats(object_id);
+        EraseObjectAndUpdateStats(object_id, shard);
       }
     }
   }
 }
 
 void CoreWorkerMemoryStore::Delete(const std::vector<ObjectID> &object_ids) {
-  absl::MutexLock lock(&mu_);
   for (const auto &object_id : object_ids) {
     RAY_LOG(DEBUG) << "Delete an object from a memory store. ObjectId: " << object_id;
-    auto it = objects_.find(object_id);
-    if (it != objects_.end()) {
+    auto &shard = GetShard(object_id);
+    absl::MutexLock lock(&shard.mu);
+    auto it = shard.objects.find(object_id);
+    if (it != shard.objects.end()) {
       OnDelete(it->second);
-      EraseObjectAndUpdateStats(object_id);
+      EraseObjectAndUpdateStats(object_id, shard);
     }
   }
 }
 
 bool CoreWorkerMemoryStore::Contains(const ObjectID &object_id, bool *in_plasma) {
-  absl::MutexLock lock(&mu_);
-  auto it = objects_.find(object_id);
-  if (it != objects_.end()) {
+  auto &shard = GetShard(object_id);
+  absl::MutexLock lock(&shard.mu);
+  auto it = shard.objects.find(object_id);
+  if (it != shard.objects.end()) {
     if (it->second->IsInPlasmaError()) {
       *in_plasma = true;
     }
@@ -499,66 +700,84 @@ void CoreWorkerMemoryStore::OnDelete(std::shared_ptr<RayObject> obj) {
 }
 
 void CoreWorkerMemoryStore::NotifyUnhandledErrors() {
-  absl::MutexLock lock(&mu_);
   int64_t threshold = absl::GetCurrentTimeNanos() - kUnhandledErrorGracePeriodNanos;
-  auto it = objects_.begin();
   int count = 0;
-  while (it != objects_.end() && count < kMaxUnhandledErrorScanItems) {
-    const auto &obj = it->second;
-    if (IsUnhandledError(obj) && obj->CreationTimeNanos() < threshold &&
-        unhandled_exception_handler_ != nullptr) {
-      obj->SetAccessed();
-      unhandled_exception_handler_(*obj);
+  for (const auto &shard : shards_) {
+    absl::MutexLock lock(&shard->mu);
+    auto it = shard->objects.begin();
+    while (it != shard->objects.end() && count < kMaxUnhandledErrorScanItems) {
+      const auto &obj = it->second;
+      if (IsUnhandledError(obj) && obj->CreationTimeNanos() < threshold &&
+          unhandled_exception_handler_ != nullptr) {
+        obj->SetAccessed();
+        unhandled_exception_handler_(*obj);
+      }
+      it++;
+      count++;
     }
-    it++;
-    count++;
   }
 }
 
-inline void CoreWorkerMemoryStore::EraseObjectAndUpdateStats(const ObjectID &object_id) {
-  auto it = objects_.find(object_id);
-  if (it == objects_.end()) {
+inline void CoreWorkerMemoryStore::EraseObjectAndUpdateStats(const ObjectID &object_id,
+                                                             Shard &shard) {
+  auto it = shard.objects.find(object_id);
+  if (it == shard.objects.end()) {
     return;
   }
 
   if (it->second->IsInPlasmaError()) {
-    num_in_plasma_ -= 1;
+    shard.num_in_plasma -= 1;
   } else {
-    num_local_objects_ -= 1;
-    num_local_objects_bytes_ -= it->second->GetSize();
+    shard.num_local_objects -= 1;
+    shard.num_local_objects_bytes -= it->second->GetSize();
   }
-  RAY_CHECK(num_in_plasma_ >= 0 && num_local_objects_ >= 0 &&
-            num_local_objects_bytes_ >= 0);
-  objects_.erase(it);
+  RAY_CHECK(shard.num_in_plasma >= 0 && shard.num_local_objects >= 0 &&
+            shard.num_local_objects_bytes >= 0);
+  shard.objects.erase(it);
 }
 
 inline void CoreWorkerMemoryStore::EmplaceObjectAndUpdateStats(
-    const ObjectID &object_id, std::shared_ptr<RayObject> &object_entry) {
-  auto inserted = objects_.emplace(object_id, object_entry).second;
+    const ObjectID &object_id, std::shared_ptr<RayObject> &object_entry, Shard &shard) {
+  auto inserted = shard.objects.emplace(object_id, object_entry).second;
   if (inserted) {
     if (object_entry->IsInPlasmaError()) {
-      num_in_plasma_ += 1;
+      shard.num_in_plasma += 1;
     } else {
-      num_local_objects_ += 1;
-      num_local_objects_bytes_ += object_entry->GetSize();
+      shard.num_local_objects += 1;
+      shard.num_local_objects_bytes += object_entry->GetSize();
     }
   }
-  RAY_CHECK(num_in_plasma_ >= 0 && num_local_objects_ >= 0 &&
-            num_local_objects_bytes_ >= 0);
+  RAY_CHECK(shard.num_in_plasma >= 0 && shard.num_local_objects >= 0 &&
+            shard.num_local_objects_bytes >= 0);
 }
 
 MemoryStoreStats CoreWorkerMemoryStore::GetMemoryStoreStatisticalData() {
-  absl::MutexLock lock(&mu_);
   MemoryStoreStats item;
-  item.num_in_plasma = num_in_plasma_;
-  item.num_local_objects = num_local_objects_;
-  item.num_local_objects_bytes = num_local_objects_bytes_;
+  for (const auto &shard : shards_) {
+    absl::MutexLock lock(&shard->mu);
+    item.num_in_plasma += shard->num_in_plasma;
+    item.num_local_objects += shard->num_local_objects;
+    item.num_local_objects_bytes += shard->num_local_objects_bytes;
+  }
   return item;
 }
 
+uint64_t CoreWorkerMemoryStore::UsedMemory() {
+  int64_t num_local_objects_bytes = 0;
+  for (const auto &shard : shards_) {
+    absl::MutexLock lock(&shard->mu);
+    num_local_objects_bytes += shard->num_local_objects_bytes;
+  }
+  return static_cast<uint64_t>(num_local_objects_bytes);
+}
+
 void CoreWorkerMemoryStore::RecordMetrics() {
-  absl::MutexLock lock(&mu_);
-  object_store_memory_gauge_.Record(num_local_objects_bytes_,
+  int64_t num_local_objects_bytes = 0;
+  for (const auto &shard : shards_) {
+    absl::MutexLock lock(&shard->mu);
+    num_local_objects_bytes += shard->num_local_objects_bytes;
+  }
+  object_store_memory_gauge_.Record(num_local_objects_bytes,
                                     {{stats::LocationKey, "WORKER_HEAP"}});
 }
 
@@ -40,6 +40,7 @@ struct MemoryStoreStats {
 };
 
 class GetRequest;
+class InlineObjectBlockPool;
 
 /// The class provides implementations for local process memory store.
 /// An example usage for this is to retrieve the returned objects from direct
@@ -70,6 +71,21 @@ class CoreWorkerMemoryStore {
   /// counter.
   void Put(const RayObject &object, const ObjectID &object_id, const bool has_reference);
 
+  /// A single object insertion for BatchPut. Fields mirror the arguments of
+  /// Put().
+  struct PutRequest {
+    ObjectID object_id;
+    RayObject object;
+    bool has_reference;
+  };
+
+  /// Put a batch of objects into the object store. Objects that map to the
+  /// same shard are inserted under a single lock acquisition, and the ready
+  /// GetAsync callbacks for the whole batch are posted onto the io_context in
+  /// one event. This is cheaper than repeated Put() calls when many task
+  /// replies are completed at once.
+  void BatchPut(std::vector<PutRequest> puts);
+
   /// Get a list of objects from the object store.
   ///
   /// \param[in] object_ids IDs of the objects to get. Duplicates are not allowed.
@@ -147,8 +163,12 @@ class CoreWorkerMemoryStore {
   ///
   /// \return Count of objects in the store.
   int Size() {
-    absl::MutexLock lock(&mu_);
-    return objects_.size();
+    int size = 0;
+    for (const auto &shard : shards_) {
+      absl::MutexLock lock(&shard->mu);
+      size += shard->objects.size();
+    }
+    return size;
   }
 
   /// Returns stats data of memory usage.
@@ -190,15 +210,91 @@ class CoreWorkerMemoryStore {
   /// Called when an object is deleted from the store.
   void OnDelete(std::shared_ptr<RayObject> obj);
 
-  /// Emplace the given object entry to the in-memory-store and update stats properly.
+  /// Callbacks from pending GetAsync requests that became ready during a put,
+  /// each paired with the object entry to deliver.
+  using ReadyAsyncCallbacks =
+      std::vector<std::pair<std::function<void(std::shared_ptr<RayObject>)>,
+                            std::shared_ptr<RayObject>>>;
+
+  /// Create the store-owned object entry (which owns a copy of the data) for a
+  /// put.
+  std::shared_ptr<RayObject> MakeObjectEntry(const RayObject &object,
+                                             const ObjectID &object_id);
+
+  /// Try to create the store-owned entry for a small object by copying its
+  /// data and metadata into a single recycled pool block, instead of one heap
+  /// allocation per buffer. Returns nullptr if inline storage is disabled or
+  /// the object doesn't fit; the caller falls back to per-buffer copies.
+  std::shared_ptr<RayObject> TryMakeInlineObjectEntry(const RayObject &object);
+
+  /// Insert a single object into the given shard. Ready GetAsync callbacks
+  /// are appended to ready_callbacks instead of being posted directly so that
+  /// callers can post them for a whole batch at once, outside the shard lock.
+  void PutInternal(const ObjectID &object_id,
+                   std::shared_ptr<RayObject> object_entry,
+                   bool has_reference,
+                   Shard &shard,
+                   ReadyAsyncCallbacks *ready_callbacks)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+
+  /// Post the ready GetAsync callbacks onto the io_context in one event.
+  void PostReadyCallbacks(ReadyAsyncCallbacks ready_callbacks);
+
+  /// State sharded by ObjectID hash. Each shard is guarded by its own mutex,
+  /// so Put/Get traffic on different objects (e.g. from many concurrent async
+  /// actor coroutines) doesn't contend on one global lock. All state for a
+  /// given object lives in exactly one shard.
+  struct Shard {
+    mutable absl::Mutex mu;
+
+    /// Map from object ID to `RayObject`.
+    /// NOTE: This map should be modified by EmplaceObjectAndUpdateStats and
+    /// EraseObjectAndUpdateStats.
+    absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> objects
+        ABSL_GUARDED_BY(mu);
+
+    /// Map from object ID to its get requests.
+    absl::flat_hash_map<ObjectID, std::vector<std::shared_ptr<GetRequest>>>
+        object_get_requests ABSL_GUARDED_BY(mu);
+
+    /// Map from object ID to its async get requests.
+    absl::flat_hash_map<ObjectID,
+                        std::vector<std::function<void(std::shared_ptr<RayObject>)>>>
+        object_async_get_requests ABSL_GUARDED_BY(mu);
+
+    ///
+    /// Below information is stats.
+    ///
+    /// Number of objects in the plasma store for this shard.
+    int32_t num_in_plasma ABSL_GUARDED_BY(mu) = 0;
+    /// Number of objects that don't exist in the plasma store.
+    int32_t num_local_objects ABSL_GUARDED_BY(mu) = 0;
+    /// Number of bytes used by this shard on heap, including both
+    /// placeholder values for objects in plasma and inlined small returned
+    /// objects from task.
+    int64_t num_local_objects_bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  /// Build the shards at construction time; the count comes from
+  /// core_worker_memory_store_num_shards, rounded up to a power of two.
+  static std::vector<std::unique_ptr<Shard>> MakeShards();
+
+  size_t ShardIndex(const ObjectID &object_id) const {
+    return object_id.Hash() & (shards_.size() - 1);
+  }
+
+  Shard &GetShard(const ObjectID &object_id) { return *shards_[ShardIndex(object_id)]; }
+
+  /// Emplace the given object entry to the shard and update stats properly.
   void EmplaceObjectAndUpdateStats(const ObjectID &object_id,
-                                   std::shared_ptr<RayObject> &object_entry)
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+                                   std::shared_ptr<RayObject> &object_entry,
+                                   Shard &shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
 
-  /// Erase the object of the object id from the in memory store and update stats
+  /// Erase the object of the object id from the shard and update stats
   /// properly.
-  void EraseObjectAndUpdateStats(const ObjectID &object_id)
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void EraseObjectAndUpdateStats(const ObjectID &object_id, Shard &shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
 
   instrumented_io_context &io_context_;
 
@@ -208,22 +304,8 @@ class CoreWorkerMemoryStore {
   // If set, this will be used to notify worker blocked / unblocked on get calls.
   std::shared_ptr<ipc::RayletIpcClientInterface> raylet_ipc_client_;
 
-  /// Protects the data structures below.
-  mutable absl::Mutex mu_;
-
-  /// Map from object ID to `RayObject`.
-  /// NOTE: This map should be modified by EmplaceObjectAndUpdateStats and
-  /// EraseObjectAndUpdateStats.
-  absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> objects_ ABSL_GUARDED_BY(mu_);
-
-  /// Map from object ID to its get requests.
-  absl::flat_hash_map<ObjectID, std::vector<std::shared_ptr<GetRequest>>>
-      object_get_requests_ ABSL_GUARDED_BY(mu_);
-
-  /// Map from object ID to its async get requests.
-  absl::flat_hash_map<ObjectID,
-                      std::vector<std::function<void(std::shared_ptr<RayObject>)>>>
-      object_async_get_requests_ ABSL_GUARDED_BY(mu_);
+  /// The shards; the count is a power of two fixed at construction.
+  const std::vector<std::unique_ptr<Shard>> shards_;
 
   /// Function passed in to be called to check for signals (e.g., Ctrl-C).
   std::function<Status()> check_signals_;
@@ -231,24 +313,16 @@ class CoreWorkerMemoryStore {
   /// Function called to report unhandled exceptions.
   std::function<void(const RayObject &)> unhandled_exception_handler_;
 
-  ///
-  /// Below information is stats.
-  ///
-  /// Number of objects in the plasma store for this memory store.
-  int32_t num_in_plasma_ ABSL_GUARDED_BY(mu_) = 0;
-  /// Number of objects that don't exist in the plasma store.
-  int32_t num_local_objects_ ABSL_GUARDED_BY(mu_) = 0;
-  /// Number of bytes used by this memory store on heap, including both
-  /// placeholder values for objects in plasma and inlined small returned
-  /// objects from task.
-  int64_t num_local_objects_bytes_ ABSL_GUARDED_BY(mu_) = 0;
-
   /// This lambda is used to allow language frontend to allocate the objects
   /// in the memory store.
   std::function<std::shared_ptr<RayObject>(const RayObject &object,
                                            const ObjectID &object_id)>
       object_allocator_;
 
+  /// Backs the inline small-object representation. Null unless
+  /// core_worker_memory_store_inline_object_max_bytes is positive.
+  std::shared_ptr<InlineObjectBlockPool> inline_block_pool_;
+
   ray::stats::Gauge object_store_memory_gauge_{ray::GetObjectStoreMemoryGaugeMetric()};
 };
 
@@ -261,6 +261,7 @@ Status CoreWorkerPlasmaStoreProvider::Get(
   // TODO(57923): Need to understand if batching is necessary. If it's necessary,
   // then the reason needs to be documented.
   bool got_exception = false;
+  const bool vectored_get = RayConfig::instance().worker_fetch_vectored_plasma_get();
   int64_t num_total_objects = static_cast<int64_t>(object_ids.size());
   for (int64_t start = 0; start < num_total_objects; start += fetch_batch_size_) {
     std::vector<ObjectID> batch_ids;
@@ -279,13 +280,25 @@ Status CoreWorkerPlasmaStoreProvider::Get(
     get_request_cleanup_handlers.emplace_back(std::move(status_or_cleanup.value()));
 
     // 2. Try to Get all objects that are already local from the plasma store.
-    RAY_RETURN_NOT_OK(
-        GetObjectsFromPlasmaStore(remaining_object_id_to_idx,
-                                  batch_ids,
-                                  /*timeout_ms=*/0,
-                                  // Mutable objects must be local before ray.get.
-                                  results,
-                                  &got_exception));
+    if (!vectored_get) {
+      RAY_RETURN_NOT_OK(
+          GetObjectsFromPlasmaStore(remaining_object_id_to_idx,
+                                    batch_ids,
+                                    /*timeout_ms=*/0,
+                                    // Mutable objects must be local before ray.get.
+                                    results,
+                                    &got_exception));
+    }
+  }
+
+  if (vectored_get) {
+    // Resolve the already-local objects of the entire ID list through a
+    // single plasma round trip, now that every pull request has been issued.
+    RAY_RETURN_NOT_OK(GetObjectsFromPlasmaStore(remaining_object_id_to_idx,
+                                                object_ids,
+                                                /*timeout_ms=*/0,
+                                                results,
+                                                &got_exception));
   }
 
   if (remaining_object_id_to_idx.empty() || got_exception) {
@@ -354,6 +367,35 @@ Status CoreWorkerPlasmaStoreProvider::Get(
   return Status::OK();
 }
 
+Status CoreWorkerPlasmaStoreProvider::Prefetch(
+    const std::vector<ObjectID> &object_ids,
+    const std::vector<rpc::Address> &owner_addresses) {
+  if (object_ids.empty()) {
+    return Status::OK();
+  }
+  const auto max_hints = static_cast<size_t>(std::max<int64_t>(
+      1, RayConfig::instance().worker_max_active_object_prefetch_hints()));
+  int64_t num_total_objects = static_cast<int64_t>(object_ids.size());
+  for (int64_t start = 0; start < num_total_objects; start += fetch_batch_size_) {
+    std::vector<ObjectID> batch_ids;
+    std::vector<rpc::Address> batch_owner_addresses;
+    for (int64_t i = start; i < start + fetch_batch_size_ && i < num_total_objects; i++) {
+      batch_ids.push_back(object_ids[i]);
+      batch_owner_addresses.push_back(owner_addresses[i]);
+    }
+    StatusOr<ipc::ScopedResponse> status_or_cleanup = raylet_ipc_client_->AsyncGetObjects(
+        batch_ids, batch_owner_addresses, get_request_counter_.fetch_add(1));
+    RAY_RETURN_NOT_OK(status_or_cleanup.status());
+    absl::MutexLock lock(&prefetch_mutex_);
+    active_prefetch_requests_.emplace_back(std::move(status_or_cleanup.value()));
+    while (active_prefetch_requests_.size() > max_hints) {
+      // Releasing the cleanup handler cancels the oldest hint's pull request.
+      active_prefetch_requests_.pop_front();
+    }
+  }
+  return Status::OK();
+}
+
 Status CoreWorkerPlasmaStoreProvider::Contains(const ObjectID &object_id,
                                                bool *has_object) {
   return store_client_->Contains(object_id, has_object);
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -21,6 +22,7 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/common/buffer.h"
 #include "ray/common/id.h"
 #include "ray/common/status.h"
@@ -173,6 +175,19 @@ class CoreWorkerPlasmaStoreProvider {
              int64_t timeout_ms,
              absl::flat_hash_map<ObjectID, std::shared_ptr<RayObject>> *results);
 
+  /// Hint that the given objects will be read soon. Issues the same pull
+  /// request to the raylet as Get() but does not block on the objects
+  /// becoming local; the pull stays active until the hint is displaced. At
+  /// most `worker_max_active_object_prefetch_hints` hints are kept open, and
+  /// issuing more releases the oldest hint first, so stale hints cannot pin
+  /// pull bandwidth indefinitely.
+  ///
+  /// \param[in] object_ids Objects expected to be read soon.
+  /// \param[in] owner_addresses Owner addresses of the objects.
+  /// \return Status::IOError if there's an error communicating with the raylet.
+  Status Prefetch(const std::vector<ObjectID> &object_ids,
+                  const std::vector<rpc::Address> &owner_addresses);
+
   /// Get objects directly from the local plasma store, without waiting for the
   /// objects to be fetched from another node. This should only be used
   /// internally, never by user code.
@@ -258,6 +273,13 @@ class CoreWorkerPlasmaStoreProvider {
   std::shared_ptr<BufferTracker> buffer_tracker_;
   int64_t fetch_batch_size_ = 0;
   std::atomic<int64_t> get_request_counter_;
+
+  /// Guards the outstanding prefetch hints.
+  absl::Mutex prefetch_mutex_;
+  /// Outstanding prefetch pull requests, oldest first. Holding the cleanup
+  /// handler keeps the corresponding raylet pull request active.
+  std::deque<ipc::ScopedResponse> active_prefetch_requests_
+      ABSL_GUARDED_BY(prefetch_mutex_);
 };
 
 }  // namespace core
@@ -31,6 +31,10 @@ namespace worker {
 
 namespace {
 
+/// Approximation of the serialized size of a task event's fixed fields (ids,
+/// status, timestamps), used by TaskEvent::ApproximateByteSize.
+constexpr size_t kTaskEventBytesOverhead = 64;
+
 rpc::events::TaskLifecycleEvent::TaskLogInfo TaskLogInfoToLifecycleEvent(
     const rpc::TaskLogInfo &src) {
   rpc::events::TaskLifecycleEvent::TaskLogInfo dest;
@@ -378,6 +382,19 @@ void TaskStatusEvent::ToRpcRayEvents(RayEventsTuple &ray_events_tuple) {
   PopulateRpcRayTaskLifecycleEvent(*task_lifecycle_event, timestamp);
 }
 
+size_t TaskStatusEvent::ApproximateByteSize() const {
+  // The task spec dominates the serialized size when one is attached; the
+  // fixed fields are approximated by a constant.
+  size_t num_bytes = kTaskEventBytesOverhead + session_name_.size();
+  if (task_spec_ != nullptr) {
+    num_bytes += task_spec_->GetMessage().ByteSizeLong();
+  }
+  if (state_update_.has_value() && state_update_->error_info_.has_value()) {
+    num_bytes += state_update_->error_info_->ByteSizeLong();
+  }
+  return num_bytes;
+}
+
 void TaskProfileEvent::ToRpcTaskEvents(rpc::TaskEvents *rpc_task_events) {
   // Rate limit on the number of profiling events from the task. This is especially the
   // case if a driver has many profiling events when submitting tasks
@@ -450,6 +467,12 @@ void TaskProfileEvent::ToRpcRayEvents(RayEventsTuple &ray_events_tuple) {
   event_entry->set_extra_data(std::move(extra_data_));
 }
 
+size_t TaskProfileEvent::ApproximateByteSize() const {
+  return kTaskEventBytesOverhead + component_type_.size() + component_id_.size() +
+         node_ip_address_.size() + event_name_.size() + extra_data_.size() +
+         session_name_.size();
+}
+
 bool TaskEventBufferImpl::RecordTaskStatusEventIfNeeded(
     const TaskID &task_id,
     const JobID &job_id,
@@ -465,12 +488,16 @@ bool TaskEventBufferImpl::RecordTaskStatusEventIfNeeded(
     return false;
   }
 
+  const int64_t timestamp = absl::GetCurrentTimeNanos();
+  task_stage_tracer_.RecordStatusChange(
+      task_id, attempt_number, spec.IsActorTask(), status, timestamp);
+
   auto task_event = std::make_unique<TaskStatusEvent>(
       task_id,
       job_id,
       attempt_number,
       status,
-      /* timestamp */ absl::GetCurrentTimeNanos(),
+      timestamp,
       /*is_actor_task_event=*/spec.IsActorTask(),
       session_name_,
       node_id_,
@@ -622,7 +649,8 @@ bool TaskEventBufferImpl::Enabled() const { return enabled_; }
 void TaskEventBufferImpl::GetTaskStatusEventsToSend(
     std::vector<std::shared_ptr<TaskEvent>> *status_events_to_send,
     std::vector<std::shared_ptr<TaskEvent>> *status_events_to_write_for_export,
-    absl::flat_hash_set<TaskAttempt> *dropped_task_attempts_to_send) {
+    absl::flat_hash_set<TaskAttempt> *dropped_task_attempts_to_send,
+    int64_t *send_bytes_remaining) {
   absl::MutexLock lock(&mutex_);
 
   // Get the export events data to write.
@@ -666,6 +694,18 @@ void TaskEventBufferImpl::GetTaskStatusEventsToSend(
   size_t num_to_send =
       std::min(static_cast<size_t>(RayConfig::instance().task_events_send_batch_size()),
                static_cast<size_t>(status_events_.size()));
+  // Stop the batch early once the byte budget for this flush is used up.
+  // Events left over stay buffered for the next flush interval.
+  if (*send_bytes_remaining >= 0) {
+    size_t num_within_budget = 0;
+    while (num_within_budget < num_to_send && *send_bytes_remaining > 0) {
+      const auto num_bytes =
+          static_cast<int64_t>(status_events_[num_within_budget]->ApproximateByteSize());
+      *send_bytes_remaining = std::max<int64_t>(0, *send_bytes_remaining - num_bytes);
+      num_within_budget++;
+    }
+    num_to_send = num_within_budget;
+  }
   status_events_to_send->insert(
       status_events_to_send->end(),
       std::make_move_iterator(status_events_.begin()),
@@ -679,7 +719,8 @@ void TaskEventBufferImpl::GetTaskStatusEventsToSend(
 }
 
 void TaskEventBufferImpl::GetTaskProfileEventsToSend(
-    std::vector<std::shared_ptr<TaskEvent>> *profile_events_to_send) {
+    std::vector<std::shared_ptr<TaskEvent>> *profile_events_to_send,
+    int64_t *send_bytes_remaining) {
   absl::MutexLock lock(&profile_mutex_);
 
   auto batch_size =
@@ -688,6 +729,21 @@ void TaskEventBufferImpl::GetTaskProfileEventsToSend(
     auto itr = profile_events_.begin();
     auto num_to_send =
         std::min(batch_size - profile_events_to_send->size(), itr->second.size());
+    // Stop the batch early once the byte budget for this flush is used up.
+    // Events left over stay buffered for the next flush interval.
+    if (*send_bytes_remaining >= 0) {
+      size_t num_within_budget = 0;
+      while (num_within_budget < num_to_send && *send_bytes_remaining > 0) {
+        const auto num_bytes =
+            static_cast<int64_t>(itr->second[num_within_budget]->ApproximateByteSize());
+        *send_bytes_remaining = std::max<int64_t>(0, *send_bytes_remaining - num_bytes);
+        num_within_budget++;
+      }
+      num_to_send = num_within_budget;
+      if (num_to_send == 0) {
+        break;
+      }
+    }
 
     profile_events_to_send->insert(
         profile_events_to_send->end(),
@@ -970,6 +1026,13 @@ void TaskEventBufferImpl::FlushEvents(bool forced) {
     return;
   }
 
+  // Approximate byte budget shared by the status and profile events flushed in
+  // this message. A negative value disables the budget.
+  int64_t send_bytes_remaining = RayConfig::instance().task_events_max_bytes_per_flush();
+  if (send_bytes_remaining <= 0) {
+    send_bytes_remaining = -1;
+  }
+
   // Take out status events from the buffer.
   std::vector<std::shared_ptr<TaskEvent>> status_events_to_send;
   std::vector<std::shared_ptr<TaskEvent>> status_events_to_write_for_export;
@@ -977,12 +1040,13 @@ void TaskEventBufferImpl::FlushEvents(bool forced) {
   status_events_to_send.reserve(RayConfig::instance().task_events_send_batch_size());
   GetTaskStatusEventsToSend(&status_events_to_send,
                             &status_events_to_write_for_export,
-                            &dropped_task_attempts_to_send);
+                            &dropped_task_attempts_to_send,
+                            &send_bytes_remaining);
 
   // Take profile events from the status events.
   std::vector<std::shared_ptr<TaskEvent>> profile_events_to_send;
   profile_events_to_send.reserve(RayConfig::instance().task_events_send_batch_size());
-  GetTaskProfileEventsToSend(&profile_events_to_send);
+  GetTaskProfileEventsToSend(&profile_events_to_send, &send_bytes_remaining);
 
   // Aggregate and prepare the data to send.
   TaskEventBuffer::TaskEventDataToSend data = CreateDataToSend(
@@ -1176,6 +1240,11 @@ std::string TaskEventBufferImpl::DebugString() {
      << "\n\tnum of failed requests to aggregator: "
      << stats[TaskEventBufferCounter::kTotalNumFailedRequestsToAggregator];
 
+  const auto stage_stats = task_stage_tracer_.StatsString();
+  if (!stage_stats.empty()) {
+    ss << "\n" << stage_stats;
+  }
+
   return ss.str();
 }
 
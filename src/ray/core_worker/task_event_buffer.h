@@ -29,6 +29,7 @@
 #include "ray/common/id.h"
 #include "ray/common/protobuf_utils.h"
 #include "ray/common/task/task_spec.h"
+#include "ray/core_worker/task_stage_tracer.h"
 #include "ray/gcs_rpc_client/gcs_client.h"
 #include "ray/rpc/event_aggregator_client.h"
 #include "ray/util/counter_map.h"
@@ -100,6 +101,13 @@ class TaskEvent {
   /// If it is a profile event.
   virtual bool IsProfileEvent() const = 0;
 
+  /// Approximate serialized size of this event in bytes.
+  ///
+  /// Used to keep the size of a flushed message under
+  /// `RAY_task_events_max_bytes_per_flush` without serializing the event
+  /// twice, so this is an estimate rather than an exact protobuf size.
+  virtual size_t ApproximateByteSize() const = 0;
+
   virtual TaskAttempt GetTaskAttempt() const {
     return std::make_pair(task_id_, attempt_number_);
   }
@@ -189,6 +197,8 @@ class TaskStatusEvent : public TaskEvent {
 
   bool IsProfileEvent() const override { return false; }
 
+  size_t ApproximateByteSize() const override;
+
  private:
   // Helper functions to populate the task definition event of rpc::events::RayEvent
   // This function assumes task_spec_ is not null.
@@ -243,6 +253,8 @@ class TaskProfileEvent : public TaskEvent {
 
   bool IsProfileEvent() const override { return true; }
 
+  size_t ApproximateByteSize() const override;
+
   void SetEndTime(int64_t end_time) { end_time_ = end_time; }
 
   void SetExtraData(const std::string &extra_data) { extra_data_ = extra_data; }
@@ -454,18 +466,24 @@ class TaskEventBufferImpl : public TaskEventBuffer {
   ///              fit in the buffer.
   /// \param[out] dropped_task_attempts_to_send Task attempts that were dropped due to
   ///             status events being dropped.
+  /// \param[in,out] send_bytes_remaining Approximate byte budget left for this
+  ///             flush, decremented by the size of the selected events. A
+  ///             negative value disables the budget.
   void GetTaskStatusEventsToSend(
       std::vector<std::shared_ptr<TaskEvent>> *status_events_to_send,
       std::vector<std::shared_ptr<TaskEvent>> *status_events_to_write_for_export,
-      absl::flat_hash_set<TaskAttempt> *dropped_task_attempts_to_send)
-      ABSL_LOCKS_EXCLUDED(mutex_);
+      absl::flat_hash_set<TaskAttempt> *dropped_task_attempts_to_send,
+      int64_t *send_bytes_remaining) ABSL_LOCKS_EXCLUDED(mutex_);
 
   /// Get data related to task profile events to be send to GCS.
   ///
   /// \param[out] profile_events_to_send Task profile events to be sent.
+  /// \param[in,out] send_bytes_remaining Approximate byte budget left for this
+  ///             flush, decremented by the size of the selected events. A
+  ///             negative value disables the budget.
   void GetTaskProfileEventsToSend(
-      std::vector<std::shared_ptr<TaskEvent>> *profile_events_to_send)
-      ABSL_LOCKS_EXCLUDED(profile_mutex_);
+      std::vector<std::shared_ptr<TaskEvent>> *profile_events_to_send,
+      int64_t *send_bytes_remaining) ABSL_LOCKS_EXCLUDED(profile_mutex_);
 
   /// Create the task event data to send.
   ///
@@ -626,6 +644,10 @@ class TaskEventBufferImpl : public TaskEventBuffer {
   /// The node id of the worker.
   const NodeID node_id_;
 
+  /// Samples task attempts and turns their status transition timestamps into
+  /// per-stage latency histograms.
+  TaskStageTracer task_stage_tracer_;
+
   FRIEND_TEST(TaskEventBufferTestManualStart, TestGcsClientFail);
   FRIEND_TEST(TaskEventBufferTestBatchSendDifferentDestination, TestBatchedSend);
   FRIEND_TEST(TaskEventBufferTest, TestAddEvents);
@@ -646,6 +668,7 @@ class TaskEventBufferImpl : public TaskEventBuffer {
               TestStopWaitsForInflightThenFlushes);
   FRIEND_TEST(TaskEventBufferTestDroppedAttemptsOnly,
               TestFlushSendsDroppedAttemptsWithoutEvents);
+  FRIEND_TEST(TaskEventBufferTestByteLimit, TestFlushByteBudget);
 };
 
 }  // namespace worker
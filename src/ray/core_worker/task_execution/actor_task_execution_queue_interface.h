@@ -29,6 +29,16 @@ class ActorTaskExecutionQueueInterface {
                            TaskToExecute task) = 0;
   virtual void Stop() = 0;
   virtual bool CancelTaskIfFound(TaskID task_id) = 0;
+
+  /// Number of tasks queued waiting to execute.
+  /// Must be called on the thread that constructed the queue.
+  virtual size_t NumPendingTasks() = 0;
+
+  /// How long the task at the head of the queue has been blocked from executing,
+  /// in milliseconds, either waiting for its dependencies or for an earlier
+  /// sequence number to arrive. Returns 0 if nothing is blocked or the queue does
+  /// not order tasks. Must be called on the thread that constructed the queue.
+  virtual int64_t HeadOfLineBlockedTimeMs(int64_t now_ms) = 0;
 };
 
 }  // namespace core
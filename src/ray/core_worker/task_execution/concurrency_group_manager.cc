@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -31,11 +32,35 @@ ConcurrencyGroupManager<ExecutorType>::ConcurrencyGroupManager(
     const int32_t max_concurrency_for_default_concurrency_group,
     std::function<std::function<void()>()> initialize_thread_callback)
     : initialize_thread_callback_(std::move(initialize_thread_callback)) {
+  // For thread-based executors, optionally run all concurrency groups on one
+  // shared pool, with each group's max concurrency enforced as a limit on the
+  // pool instead of a dedicated thread count. This lets a hot group use the
+  // idle threads of its sibling groups.
+  if constexpr (std::is_same_v<ExecutorType, BoundedExecutor>) {
+    if (RayConfig::instance().enable_shared_concurrency_group_pool() &&
+        !concurrency_groups.empty()) {
+      int64_t pool_threads =
+          RayConfig::instance().shared_concurrency_group_pool_threads();
+      if (pool_threads <= 0) {
+        pool_threads = 0;
+        for (const auto &group : concurrency_groups) {
+          pool_threads += group.max_concurrency_;
+        }
+        if (ExecutorType::NeedDefaultExecutor(
+                max_concurrency_for_default_concurrency_group,
+                /*has_other_concurrency_groups=*/true)) {
+          pool_threads += max_concurrency_for_default_concurrency_group;
+        }
+      }
+      shared_pool_ =
+          std::make_shared<ExecutorType>(pool_threads, initialize_thread_callback_);
+    }
+  }
+
   for (auto &group : concurrency_groups) {
     const auto name = group.name_;
     const auto max_concurrency = group.max_concurrency_;
-    auto executor =
-        std::make_shared<ExecutorType>(max_concurrency, initialize_thread_callback_);
+    auto executor = MakeExecutor(max_concurrency);
     auto &fds = group.function_descriptors_;
     for (auto fd : fds) {
       functions_to_executor_index_[fd->ToString()] = executor;
@@ -49,9 +74,19 @@ ConcurrencyGroupManager<ExecutorType>::ConcurrencyGroupManager(
   // the thread pools instead of main thread.
   if (ExecutorType::NeedDefaultExecutor(max_concurrency_for_default_concurrency_group,
                                         !concurrency_groups.empty())) {
-    default_executor_ = std::make_shared<ExecutorType>(
-        max_concurrency_for_default_concurrency_group, initialize_thread_callback_);
+    default_executor_ = MakeExecutor(max_concurrency_for_default_concurrency_group);
+  }
+}
+
+template <typename ExecutorType>
+std::shared_ptr<ExecutorType> ConcurrencyGroupManager<ExecutorType>::MakeExecutor(
+    int32_t max_concurrency) {
+  if constexpr (std::is_same_v<ExecutorType, BoundedExecutor>) {
+    if (shared_pool_ != nullptr) {
+      return std::make_shared<ExecutorType>(max_concurrency, shared_pool_);
+    }
   }
+  return std::make_shared<ExecutorType>(max_concurrency, initialize_thread_callback_);
 }
 
 template <typename ExecutorType>
@@ -60,7 +95,7 @@ std::shared_ptr<ExecutorType> ConcurrencyGroupManager<ExecutorType>::GetExecutor
   if (concurrency_group_name == RayConfig::instance().system_concurrency_group_name() &&
       name_to_executor_index_.find(concurrency_group_name) ==
           name_to_executor_index_.end()) {
-    auto executor = std::make_shared<ExecutorType>(1, initialize_thread_callback_);
+    auto executor = MakeExecutor(1);
     name_to_executor_index_[concurrency_group_name] = executor;
   }
 
@@ -108,6 +143,14 @@ void ConcurrencyGroupManager<ExecutorType>::Stop() {
   for (const auto &it : name_to_executor_index_) {
     it.second->Join();
   }
+
+  // Group executors backed by the shared pool are no-ops to stop and join;
+  // the pool itself is stopped last, after no executor can post to it.
+  if (shared_pool_ != nullptr) {
+    RAY_LOG(DEBUG) << "Shared concurrency group pool is stopping.";
+    shared_pool_->Stop();
+    shared_pool_->Join();
+  }
 }
 
 template class ConcurrencyGroupManager<FiberState>;
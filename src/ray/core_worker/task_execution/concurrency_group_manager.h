@@ -63,6 +63,11 @@ class ConcurrencyGroupManager final {
   void Stop();
 
  private:
+  /// Create an executor with the given max concurrency. When the shared pool
+  /// is enabled, the executor is a view that runs its tasks on the pool with
+  /// max concurrency as a limit; otherwise it owns dedicated threads.
+  std::shared_ptr<ExecutorType> MakeExecutor(int32_t max_concurrency);
+
   // Map from the name to their corresponding concurrency group executor.
   absl::flat_hash_map<std::string, std::shared_ptr<ExecutorType>> name_to_executor_index_;
 
@@ -73,6 +78,11 @@ class ConcurrencyGroupManager final {
   // The default concurrency group executor. It's nullptr if its max concurrency is 1.
   std::shared_ptr<ExecutorType> default_executor_ = nullptr;
 
+  // The pool shared across all concurrency group executors when
+  // `enable_shared_concurrency_group_pool` is set. nullptr otherwise, and
+  // always nullptr for fiber-based executors.
+  std::shared_ptr<ExecutorType> shared_pool_ = nullptr;
+
   // The language-specific callback function that initializes threads.
   std::function<std::function<void()>()> initialize_thread_callback_;
 
@@ -14,11 +14,18 @@
 
 #pragma once
 
+#include <atomic>
 #include <boost/fiber/all.hpp>
+#include <boost/intrusive_ptr.hpp>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <utility>
 
+#include "ray/common/ray_config.h"
+#include "ray/stats/metric.h"
 #include "ray/util/logging.h"
 #include "ray/util/macros.h"
 
@@ -91,6 +98,196 @@ class FiberRateLimiter {
 
 using FiberChannel = boost::fibers::unbuffered_channel<std::function<void()>>;
 
+inline ray::stats::Gauge GetFiberMaxReadyWaitGaugeMetric() {
+  return ray::stats::Gauge{
+      /*name=*/"async_actor_fiber_max_ready_wait_ms",
+      /*description=*/
+      "Longest time a runnable async actor fiber waited to be resumed during "
+      "the last starvation check interval.",
+      /*unit=*/"ms",
+      /*tag_keys=*/{},
+  };
+}
+
+inline ray::stats::Gauge GetFiberTotalRuntimeGaugeMetric() {
+  return ray::stats::Gauge{
+      /*name=*/"async_actor_fiber_total_runtime_ms",
+      /*description=*/
+      "Cumulative time the async actor fiber runner thread spent executing "
+      "fibers since the worker started.",
+      /*unit=*/"ms",
+      /*tag_keys=*/{},
+  };
+}
+
+/// Scheduling counters shared between the fiber scheduler (which runs on the
+/// fiber runner thread) and the starvation monitor fiber. Held through a
+/// shared_ptr because the fiber runner thread is detached and may outlive the
+/// owning FiberState; see the comment on fiber_stopped_event_.
+struct FiberSchedulerStats {
+  /// Cumulative time spent executing fibers on the runner thread.
+  std::atomic<uint64_t> total_runtime_ns{0};
+  /// Longest ready-to-resumed wait observed since the monitor last harvested.
+  std::atomic<uint64_t> max_ready_wait_ns{0};
+  /// Set by FiberState::Stop() to terminate the starvation monitor fiber.
+  std::atomic<bool> stopped{false};
+};
+
+/// Per-fiber scheduling state tracked by FairFiberScheduler: the runtime the
+/// fiber has accumulated so far and the weight dividing it for queue ordering.
+class FiberSchedulingProps : public boost::fibers::fiber_properties {
+ public:
+  explicit FiberSchedulingProps(boost::fibers::context *ctx)
+      : boost::fibers::fiber_properties(ctx) {}
+
+  /// The accumulated runtime scaled down by the fiber's weight. The scheduler
+  /// resumes the runnable fiber with the smallest virtual runtime first.
+  uint64_t VirtualRuntimeNs() const { return runtime_ns_ / weight_; }
+
+  uint32_t Weight() const { return weight_; }
+
+  /// Set the scheduling weight of the current fiber. A fiber with weight N
+  /// receives N times the share of a weight-1 fiber. Callable from inside a
+  /// fiber via boost::this_fiber::properties<FiberSchedulingProps>().
+  void SetWeight(uint32_t weight) {
+    if (weight >= 1 && weight != weight_) {
+      weight_ = weight;
+      // Reorders this fiber in the ready queue if it is currently runnable.
+      notify();
+    }
+  }
+
+ private:
+  friend class FairFiberScheduler;
+
+  /// Total time this fiber has spent running, charged slice by slice.
+  uint64_t runtime_ns_ = 0;
+  /// Scheduling weight; larger weights earn a larger runtime share.
+  uint32_t weight_ = 1;
+  /// Whether the fiber has ever been resumed; fresh fibers inherit the
+  /// smallest virtual runtime in the ready queue instead of starting at zero.
+  bool ever_run_ = false;
+  /// When the fiber was last resumed and last became runnable.
+  std::chrono::steady_clock::time_point resume_time_;
+  std::chrono::steady_clock::time_point ready_since_;
+};
+
+/// A weighted fair replacement for boost.fiber's default round-robin
+/// scheduler. Runnable fibers are resumed in order of accumulated runtime
+/// divided by weight, so a CPU-heavy coroutine that keeps yielding moves to
+/// the back of the queue and cannot starve short latency-critical coroutines
+/// in the same concurrency group. Only ever used by the single fiber runner
+/// thread, so the ready queue needs no locking; suspend_until/notify follow
+/// boost::fibers::algo::round_robin so cross-thread wakeups keep working.
+class FairFiberScheduler final
+    : public boost::fibers::algo::algorithm_with_properties<FiberSchedulingProps> {
+ public:
+  explicit FairFiberScheduler(std::shared_ptr<FiberSchedulerStats> stats)
+      : stats_(std::move(stats)) {}
+
+  void awakened(boost::fibers::context *ctx,
+                FiberSchedulingProps &props) noexcept override {
+    props.ready_since_ = std::chrono::steady_clock::now();
+    if (!props.ever_run_ && !rqueue_.empty()) {
+      // Let a fresh fiber start at the smallest virtual runtime currently
+      // queued so it neither waits behind long runners nor, by starting at
+      // zero, monopolizes the thread until it catches up.
+      auto &front_props = properties(&rqueue_.front());
+      props.runtime_ns_ = front_props.VirtualRuntimeNs() * props.weight_;
+    }
+    const uint64_t virtual_runtime_ns = props.VirtualRuntimeNs();
+    auto it = rqueue_.begin();
+    while (it != rqueue_.end() &&
+           properties(&*it).VirtualRuntimeNs() <= virtual_runtime_ns) {
+      ++it;
+    }
+    rqueue_.insert(it, *ctx);
+  }
+
+  boost::fibers::context *pick_next() noexcept override {
+    const auto now = std::chrono::steady_clock::now();
+    ChargePreviousSlice(now);
+    if (rqueue_.empty()) {
+      return nullptr;
+    }
+    boost::fibers::context *ctx = &rqueue_.front();
+    rqueue_.pop_front();
+    auto &props = properties(ctx);
+    RecordReadyWait(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        now - props.ready_since_)
+                        .count());
+    props.resume_time_ = now;
+    props.ever_run_ = true;
+    // Keep the context alive until the slice is charged at the next
+    // pick_next(), even if the fiber terminates in between.
+    running_ = ctx;
+    return ctx;
+  }
+
+  bool has_ready_fibers() const noexcept override { return !rqueue_.empty(); }
+
+  void property_change(boost::fibers::context *ctx,
+                       FiberSchedulingProps &props) noexcept override {
+    if (!ctx->ready_is_linked()) {
+      return;
+    }
+    ctx->ready_unlink();
+    awakened(ctx, props);
+  }
+
+  void suspend_until(
+      const std::chrono::steady_clock::time_point &time_point) noexcept override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait_until(lock, time_point, [this]() { return flag_; });
+    flag_ = false;
+  }
+
+  void notify() noexcept override {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      flag_ = true;
+    }
+    cond_.notify_all();
+  }
+
+ private:
+  /// Charge the slice that just ended to the fiber picked last time. Runs at
+  /// the top of every pick_next(), which on a single runner thread is the
+  /// first scheduling point after any fiber yields, blocks, or terminates.
+  void ChargePreviousSlice(const std::chrono::steady_clock::time_point &now) {
+    if (!running_) {
+      return;
+    }
+    auto *props = static_cast<FiberSchedulingProps *>(running_->get_properties());
+    if (props != nullptr) {
+      const uint64_t slice_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    now - props->resume_time_)
+                                    .count();
+      props->runtime_ns_ += slice_ns;
+      stats_->total_runtime_ns.fetch_add(slice_ns, std::memory_order_relaxed);
+    }
+    running_.reset();
+  }
+
+  void RecordReadyWait(uint64_t waited_ns) {
+    uint64_t prev = stats_->max_ready_wait_ns.load(std::memory_order_relaxed);
+    while (waited_ns > prev &&
+           !stats_->max_ready_wait_ns.compare_exchange_weak(prev, waited_ns)) {
+    }
+  }
+
+  /// Runnable fibers ordered by ascending virtual runtime.
+  boost::fibers::scheduler::ready_queue_type rqueue_;
+  /// The fiber currently holding the thread, pinned so its properties stay
+  /// valid until its slice is charged.
+  boost::intrusive_ptr<boost::fibers::context> running_;
+  std::shared_ptr<FiberSchedulerStats> stats_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  bool flag_ = false;
+};
+
 class FiberState {
  public:
   static bool NeedDefaultExecutor(int32_t max_concurrency_in_default_group,
@@ -108,9 +305,21 @@ class FiberState {
       std::function<std::function<void()>()> initialize_thread_callback = nullptr)
       : allocator_(kStackSize),
         rate_limiter_(max_concurrency),
-        fiber_stopped_event_(std::make_shared<StdEvent>()) {
+        fiber_stopped_event_(std::make_shared<StdEvent>()),
+        scheduler_stats_(RayConfig::instance().fiber_fair_scheduling_enabled()
+                             ? std::make_shared<FiberSchedulerStats>()
+                             : nullptr) {
     std::shared_ptr<StdEvent> fiber_stopped_event = fiber_stopped_event_;
-    auto fiber_runner_thread = std::thread([&, fiber_stopped_event]() {
+    std::shared_ptr<FiberSchedulerStats> scheduler_stats = scheduler_stats_;
+    auto fiber_runner_thread = std::thread([&, fiber_stopped_event, scheduler_stats]() {
+      if (scheduler_stats != nullptr) {
+        boost::fibers::use_scheduling_algorithm<FairFiberScheduler>(scheduler_stats);
+        boost::fibers::fiber(boost::fibers::launch::post,
+                             std::allocator_arg,
+                             allocator_,
+                             [scheduler_stats]() { RunStarvationMonitor(scheduler_stats); })
+            .detach();
+      }
       while (!channel_.is_closed()) {
         std::function<void()> func;
         auto op_status = channel_.pop(func);
@@ -161,11 +370,45 @@ class FiberState {
     RAY_CHECK(op_status == boost::fibers::channel_op_status::success);
   }
 
-  void Stop() { channel_.close(); }
+  void Stop() {
+    if (scheduler_stats_ != nullptr) {
+      scheduler_stats_->stopped = true;
+    }
+    channel_.close();
+  }
 
   void Join() { fiber_stopped_event_->Wait(); }
 
  private:
+  /// Body of the starvation monitor fiber. Periodically harvests the
+  /// scheduler counters into the worker's metrics and warns when a runnable
+  /// fiber waited long enough to suggest a CPU-heavy coroutine is hogging the
+  /// runner thread. Only started when fair fiber scheduling is enabled.
+  static void RunStarvationMonitor(std::shared_ptr<FiberSchedulerStats> stats) {
+    auto max_ready_wait_gauge = GetFiberMaxReadyWaitGaugeMetric();
+    auto total_runtime_gauge = GetFiberTotalRuntimeGaugeMetric();
+    const auto check_interval = std::chrono::milliseconds(
+        RayConfig::instance().fiber_starvation_check_interval_milliseconds());
+    const int64_t warn_threshold_ns =
+        RayConfig::instance().fiber_starvation_warning_threshold_milliseconds() *
+        1000 * 1000;
+    while (!stats->stopped) {
+      boost::this_fiber::sleep_for(check_interval);
+      const uint64_t max_ready_wait_ns = stats->max_ready_wait_ns.exchange(0);
+      max_ready_wait_gauge.Record(max_ready_wait_ns / 1e6);
+      total_runtime_gauge.Record(
+          stats->total_runtime_ns.load(std::memory_order_relaxed) / 1e6);
+      if (warn_threshold_ns > 0 &&
+          max_ready_wait_ns >= static_cast<uint64_t>(warn_threshold_ns)) {
+        RAY_LOG(WARNING) << "An async actor coroutine was runnable for "
+                         << max_ready_wait_ns / (1000 * 1000)
+                         << " ms before it was resumed. A CPU-heavy coroutine is "
+                         << "likely monopolizing the fiber runner thread; consider "
+                         << "offloading blocking work to a thread pool.";
+      }
+    }
+  }
+
   static constexpr size_t kStackSize = 1024 * 256;
 
   // The fiber stack allocator.
@@ -183,6 +426,10 @@ class FiberState {
   /// deallocated in the main thread. As a result, we use a shared_ptr here to make sure
   /// it's not deallocated if `fiber_runner_thread_` still has a reference to it.
   std::shared_ptr<StdEvent> fiber_stopped_event_;
+  /// Counters shared with the fair fiber scheduler and the starvation monitor
+  /// fiber; nullptr when fair fiber scheduling is disabled. Shared for the
+  /// same lifetime reason as `fiber_stopped_event_`.
+  std::shared_ptr<FiberSchedulerStats> scheduler_stats_;
 };
 
 }  // namespace core
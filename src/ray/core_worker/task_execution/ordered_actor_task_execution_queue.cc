@@ -19,6 +19,8 @@
 #include <string>
 #include <utility>
 
+#include "ray/util/time.h"
+
 namespace ray {
 namespace core {
 
@@ -109,6 +111,13 @@ void OrderedActorTaskExecutionQueue::EnqueueTask(int64_t seq_no,
         /* include_task_info */ false));
     waiter_.AsyncWait(dependencies, [this, seq_no, is_retry, retry_task]() mutable {
       TaskToExecute *ready_task = nullptr;
+      // Whether this resolution can change what is runnable. Retries run as soon as
+      // their dependencies are ready, and a resolution at (or before) the head of
+      // the line can unblock the in-order queue. Resolutions deeper in the queue
+      // cannot make any task runnable yet; their readiness is recorded below and
+      // picked up in one batch by the pass that drains the head, so we skip the
+      // full queue scan for them.
+      bool may_unblock_execution = is_retry;
       if (is_retry) {
         // retry_task is guaranteed to be a valid pointer for retries because it
         // won't be erased from the retry list until its dependencies are fetched and
@@ -119,6 +128,8 @@ void OrderedActorTaskExecutionQueue::EnqueueTask(int64_t seq_no,
         // For non-retry tasks, we need to check if the task is still in the map because
         // it can be erased due to being canceled via a higher `client_processed_up_to_`.
         ready_task = &it->second;
+        may_unblock_execution =
+            seq_no <= next_seq_no_ || it == pending_actor_tasks_.begin();
       }
 
       if (ready_task != nullptr) {
@@ -131,7 +142,9 @@ void OrderedActorTaskExecutionQueue::EnqueueTask(int64_t seq_no,
             rpc::TaskStatus::PENDING_ACTOR_TASK_ORDERING_OR_CONCURRENCY,
             /* include_task_info */ false));
         ready_task->MarkDependenciesResolved();
-        ExecuteQueuedTasks();
+        if (may_unblock_execution) {
+          ExecuteQueuedTasks();
+        }
       }
     });
   } else {
@@ -159,6 +172,20 @@ bool OrderedActorTaskExecutionQueue::CancelTaskIfFound(TaskID task_id) {
   }
 }
 
+size_t OrderedActorTaskExecutionQueue::NumPendingTasks() {
+  RAY_CHECK(std::this_thread::get_id() == main_thread_id_);
+  return pending_actor_tasks_.size() + pending_retry_actor_tasks_.size();
+}
+
+int64_t OrderedActorTaskExecutionQueue::HeadOfLineBlockedTimeMs(int64_t now_ms) {
+  RAY_CHECK(std::this_thread::get_id() == main_thread_id_);
+  if (pending_actor_tasks_.empty() || head_blocked_since_ms_ == 0 ||
+      head_blocked_seq_no_ != pending_actor_tasks_.begin()->first) {
+    return 0;
+  }
+  return now_ms - head_blocked_since_ms_;
+}
+
 void OrderedActorTaskExecutionQueue::ExecuteQueuedTasks() {
   // Cancel any stale requests that the client doesn't need any longer.
   // This happens when the client sends an RPC with the client_processed_up_to
@@ -214,6 +241,17 @@ void OrderedActorTaskExecutionQueue::ExecuteQueuedTasks() {
     }
   }
 
+  // Track how long the head of the line has been blocked, either waiting for its
+  // dependencies or for an earlier seq_no to arrive from the client. The clock
+  // restarts whenever the head of the line changes.
+  if (pending_actor_tasks_.empty()) {
+    head_blocked_seq_no_ = -1;
+    head_blocked_since_ms_ = 0;
+  } else if (head_blocked_seq_no_ != pending_actor_tasks_.begin()->first) {
+    head_blocked_seq_no_ = pending_actor_tasks_.begin()->first;
+    head_blocked_since_ms_ = current_time_ms();
+  }
+
   if (pending_actor_tasks_.empty() ||
       !pending_actor_tasks_.begin()->second.DependenciesResolved()) {
     // Either there are no tasks to execute, or the head of the line is blocked waiting
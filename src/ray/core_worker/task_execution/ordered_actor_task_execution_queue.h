@@ -61,6 +61,10 @@ class OrderedActorTaskExecutionQueue : public ActorTaskExecutionQueueInterface {
   /// This method has to be THREAD-SAFE.
   bool CancelTaskIfFound(TaskID task_id) override;
 
+  size_t NumPendingTasks() override;
+
+  int64_t HeadOfLineBlockedTimeMs(int64_t now_ms) override;
+
  private:
   /// Cancel all tasks queued for execution.
   void CancelAllQueuedTasks(const std::string &msg);
@@ -85,6 +89,14 @@ class OrderedActorTaskExecutionQueue : public ActorTaskExecutionQueueInterface {
   absl::flat_hash_set<int64_t> seq_no_to_skip_;
   /// The next sequence number we are waiting for to arrive.
   int64_t next_seq_no_ = 0;
+  /// The sequence number at the head of the line the last time ExecuteQueuedTasks
+  /// could not make progress, or -1 if the queue was drained. Used together with
+  /// head_blocked_since_ms_ to report how long the head of the line has been
+  /// blocked.
+  int64_t head_blocked_seq_no_ = -1;
+  /// The time at which the current head of the line became blocked, or 0 if the
+  /// head is not blocked.
+  int64_t head_blocked_since_ms_ = 0;
   /// Timer for waiting on dependencies. Note that this is set on the task main
   /// io service, which is fine since it only ever fires if no tasks are running.
   boost::asio::deadline_timer wait_timer_;
@@ -14,6 +14,7 @@
 
 #include "ray/core_worker/task_execution/task_receiver.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "ray/core_worker/task_execution/common.h"
 #include "ray/core_worker/task_execution/ordered_actor_task_execution_queue.h"
 #include "ray/core_worker/task_execution/unordered_actor_task_execution_queue.h"
+#include "ray/util/time.h"
 
 namespace ray {
 namespace core {
@@ -31,6 +33,8 @@ void TaskReceiver::HandleTaskExecutionResult(
     Status status,
     const TaskSpecification &task_spec,
     const TaskExecutionResult &result,
+    const google::protobuf::RepeatedPtrField<rpc::ResultForwardDestination>
+        &forward_destinations,
     const rpc::SendReplyCallback &send_reply_callback,
     rpc::PushTaskReply *reply) {
   reply->set_is_retryable_error(result.is_retryable_error);
@@ -94,6 +98,20 @@ void TaskReceiver::HandleTaskExecutionResult(
           return_object.first, return_object.second, return_object_proto);
     }
 
+    // Forward inlined returns straight to any consumer workers registered by
+    // the owner, saving the owner-to-consumer hop. Plasma-backed returns are
+    // skipped; consumers fetch those peer-to-peer via the object store.
+    if (!forward_destinations.empty() && forward_inline_result_ != nullptr) {
+      for (const auto &destination : forward_destinations) {
+        for (const auto &return_object_proto : reply->return_objects()) {
+          if (return_object_proto.object_id() == destination.object_id() &&
+              !return_object_proto.in_plasma()) {
+            forward_inline_result_(destination.address(), return_object_proto);
+          }
+        }
+      }
+    }
+
     if (task_spec.IsActorCreationTask()) {
       concurrency_groups_ = task_spec.ConcurrencyGroups();
       if (is_asyncio_) {
@@ -171,7 +189,12 @@ void TaskReceiver::QueueTaskForExecution(rpc::PushTaskRequest request,
   }
 
   auto execute_callback =
-      [this, reply, send_reply_callback, resource_ids = std::move(resource_ids)](
+      [this,
+       reply,
+       send_reply_callback,
+       resource_ids = std::move(resource_ids),
+       forward_destinations =
+           std::move(*request.mutable_result_forward_destinations())](
           const TaskSpecification &t) mutable {
         TaskExecutionResult result;
         auto status = task_handler_(t,
@@ -184,7 +207,8 @@ void TaskReceiver::QueueTaskForExecution(rpc::PushTaskRequest request,
                                     &result.actor_repr_name,
                                     &result.application_error);
 
-        HandleTaskExecutionResult(status, t, result, send_reply_callback, reply);
+        HandleTaskExecutionResult(
+            status, t, result, forward_destinations, send_reply_callback, reply);
       };
 
   auto cancel_callback = [this, reply, send_reply_callback](const TaskSpecification &t,
@@ -286,6 +310,19 @@ void TaskReceiver::SetupActor(bool is_asyncio,
   allow_out_of_order_execution_ = allow_out_of_order_execution;
 }
 
+void TaskReceiver::RecordMetrics() {
+  size_t num_pending_tasks = 0;
+  int64_t max_head_wait_ms = 0;
+  const int64_t now_ms = current_time_ms();
+  for (const auto &[_, scheduling_queue] : actor_task_execution_queues_) {
+    num_pending_tasks += scheduling_queue->NumPendingTasks();
+    max_head_wait_ms =
+        std::max(max_head_wait_ms, scheduling_queue->HeadOfLineBlockedTimeMs(now_ms));
+  }
+  actor_task_queue_depth_gauge_.Record(num_pending_tasks);
+  actor_task_queue_head_wait_gauge_.Record(max_head_wait_ms);
+}
+
 void TaskReceiver::Stop() {
   if (stopping_.exchange(true)) {
     return;
@@ -30,6 +30,7 @@
 #include "ray/core_worker/task_execution/fiber.h"
 #include "ray/core_worker/task_execution/normal_task_execution_queue.h"
 #include "ray/core_worker/task_execution/thread_pool.h"
+#include "ray/observability/metric_interface.h"
 #include "ray/raylet_rpc_client/raylet_client_interface.h"
 #include "ray/rpc/rpc_callback_types.h"
 #include "src/ray/protobuf/core_worker.pb.h"
@@ -54,16 +55,28 @@ class TaskReceiver {
       std::string *actor_repr_name,
       std::string *application_error)>;
 
+  /// Callback used to forward an inlined return object directly to a consumer
+  /// worker registered by the owner. Forwarding is best-effort; the
+  /// owner-routed reply path remains authoritative.
+  using InlineResultForwarder =
+      std::function<void(const rpc::Address &addr, const rpc::ReturnObject &result)>;
+
   TaskReceiver(instrumented_io_context &task_execution_service,
                worker::TaskEventBuffer &task_event_buffer,
                TaskHandler task_handler,
                ActorTaskExecutionArgWaiter &actor_task_execution_arg_waiter,
-               std::function<std::function<void()>()> initialize_thread_callback)
+               std::function<std::function<void()>()> initialize_thread_callback,
+               InlineResultForwarder forward_inline_result,
+               ray::observability::MetricInterface &actor_task_queue_depth_gauge,
+               ray::observability::MetricInterface &actor_task_queue_head_wait_gauge)
       : task_handler_(std::move(task_handler)),
         task_execution_service_(task_execution_service),
         task_event_buffer_(task_event_buffer),
         waiter_(actor_task_execution_arg_waiter),
         initialize_thread_callback_(std::move(initialize_thread_callback)),
+        forward_inline_result_(std::move(forward_inline_result)),
+        actor_task_queue_depth_gauge_(actor_task_queue_depth_gauge),
+        actor_task_queue_head_wait_gauge_(actor_task_queue_head_wait_gauge),
         normal_task_execution_queue_(std::make_unique<NormalTaskExecutionQueue>()),
         pool_manager_(std::make_shared<ConcurrencyGroupManager<BoundedExecutor>>()),
         fiber_state_manager_(nullptr) {}
@@ -98,6 +111,11 @@ class TaskReceiver {
 
   void Stop();
 
+  /// Record queue depth and head-of-line wait metrics aggregated across the
+  /// per-caller actor task execution queues. Must be called on the task execution
+  /// service thread, which owns the queues.
+  void RecordMetrics();
+
  private:
   /// Set up the configs for an actor.
   /// This should be called once for the actor creation task.
@@ -105,11 +123,14 @@ class TaskReceiver {
                   int fiber_max_concurrency,
                   bool allow_out_of_order_execution);
 
-  void HandleTaskExecutionResult(Status status,
-                                 const TaskSpecification &task_spec,
-                                 const TaskExecutionResult &result,
-                                 const rpc::SendReplyCallback &send_reply_callback,
-                                 rpc::PushTaskReply *reply);
+  void HandleTaskExecutionResult(
+      Status status,
+      const TaskSpecification &task_spec,
+      const TaskExecutionResult &result,
+      const google::protobuf::RepeatedPtrField<rpc::ResultForwardDestination>
+          &forward_destinations,
+      const rpc::SendReplyCallback &send_reply_callback,
+      rpc::PushTaskReply *reply);
 
   // True once shutdown begins. Requests to execute new tasks will be rejected.
   std::atomic<bool> stopping_ = false;
@@ -128,6 +149,15 @@ class TaskReceiver {
   /// The language-specific callback function that initializes threads.
   std::function<std::function<void()>()> initialize_thread_callback_;
 
+  /// Sends an inlined return object to a registered consumer worker.
+  InlineResultForwarder forward_inline_result_;
+
+  /// Gauge for the total number of queued actor tasks on this worker.
+  ray::observability::MetricInterface &actor_task_queue_depth_gauge_;
+
+  /// Gauge for the longest time the head of any per-caller queue has been blocked.
+  ray::observability::MetricInterface &actor_task_queue_head_wait_gauge_;
+
   /// Queue of actor tasks waiting to execute, keyed on the ID of the worker that
   /// submitted the task.
   /// TODO(ekl) GC these queues once the handle is no longer active.
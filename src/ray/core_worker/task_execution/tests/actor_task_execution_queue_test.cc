@@ -26,6 +26,7 @@
 #include "ray/core_worker/task_event_buffer.h"
 #include "ray/core_worker/task_execution/ordered_actor_task_execution_queue.h"
 #include "ray/core_worker/task_execution/unordered_actor_task_execution_queue.h"
+#include "ray/util/time.h"
 
 // using namespace std::chrono_literals;
 using std::chrono_literals::operator""s;
@@ -301,6 +302,59 @@ TEST(OrderedActorTaskExecutionQueueTest, TestWaitForObjects) {
   queue.Stop();
 }
 
+TEST(OrderedActorTaskExecutionQueueTest, TestQueueDepthAndHeadOfLineWaitMetrics) {
+  ObjectID obj = ObjectID::FromRandom();
+  instrumented_io_context io_service;
+  MockWaiter waiter;
+  MockTaskEventBuffer task_event_buffer;
+
+  std::vector<ConcurrencyGroup> concurrency_groups{ConcurrencyGroup{"io", 1, {}}};
+  auto pool_manager =
+      std::make_shared<ConcurrencyGroupManager<BoundedExecutor>>(concurrency_groups);
+
+  OrderedActorTaskExecutionQueue queue(
+      io_service, waiter, task_event_buffer, pool_manager, 1);
+  std::atomic<int> n_ok(0);
+  std::atomic<int> n_rej(0);
+
+  auto fn_ok = [&n_ok](const TaskSpecification &task_spec) { n_ok++; };
+  auto fn_rej = [&n_rej](const TaskSpecification &task_spec, const Status &status) {
+    n_rej++;
+  };
+  TaskSpecification task_spec_without_dependency;
+  task_spec_without_dependency.GetMutableMessage().set_type(TaskType::ACTOR_TASK);
+  TaskSpecification task_spec_with_dependency;
+  task_spec_with_dependency.GetMutableMessage().set_type(TaskType::ACTOR_TASK);
+  task_spec_with_dependency.GetMutableMessage()
+      .add_args()
+      ->mutable_object_ref()
+      ->set_object_id(obj.Binary());
+
+  ASSERT_EQ(queue.NumPendingTasks(), 0UL);
+  ASSERT_EQ(queue.HeadOfLineBlockedTimeMs(current_time_ms()), 0);
+
+  // seq_no 0 executes immediately; seq_no 1 blocks at the head of the line waiting
+  // for its dependency.
+  queue.EnqueueTask(0, -1, TaskToExecute(fn_ok, fn_rej, task_spec_without_dependency));
+  queue.EnqueueTask(1, -1, TaskToExecute(fn_ok, fn_rej, task_spec_with_dependency));
+  ASSERT_TRUE(WaitForCondition([&n_ok]() { return n_ok == 1; }, 1000));
+  ASSERT_EQ(queue.NumPendingTasks(), 1UL);
+  ASSERT_GE(queue.HeadOfLineBlockedTimeMs(current_time_ms() + 10), 10);
+
+  waiter.Complete(0);
+  ASSERT_TRUE(WaitForCondition([&n_ok]() { return n_ok == 2; }, 1000));
+  ASSERT_EQ(queue.NumPendingTasks(), 0UL);
+  ASSERT_EQ(queue.HeadOfLineBlockedTimeMs(current_time_ms()), 0);
+
+  // Wait for all tasks to finish.
+  auto default_executor = pool_manager->GetDefaultExecutor();
+  default_executor->Join();
+
+  ASSERT_EQ(n_rej, 0);
+
+  queue.Stop();
+}
+
 TEST(OrderedActorTaskExecutionQueueTest, TestWaitForObjectsNotSubjectToSeqTimeout) {
   ObjectID obj = ObjectID::FromRandom();
   instrumented_io_context io_service;
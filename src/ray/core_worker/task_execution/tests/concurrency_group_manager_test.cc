@@ -14,11 +14,15 @@
 
 #include "ray/core_worker/task_execution/concurrency_group_manager.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/test_utils.h"
 #include "ray/core_worker/task_execution/fiber.h"
 #include "ray/core_worker/task_execution/thread_pool.h"
@@ -81,6 +85,61 @@ TEST(ConcurrencyGroupManagerTest, TestInitializeThreadCallback) {
   ASSERT_EQ(release_count, 2);
 }
 
+TEST(ConcurrencyGroupManagerTest, TestSharedConcurrencyGroupPool) {
+  /*
+  This test enables the shared pool mode and verifies that group executors
+  still run tasks and respect per-group max concurrency, that the thread
+  initialization callbacks run once per pool thread rather than once per
+  group thread, and that Stop joins the pool cleanly.
+  */
+  RayConfig::instance().initialize(R"({"enable_shared_concurrency_group_pool": true})");
+
+  std::vector<ConcurrencyGroup> concurrency_groups{ConcurrencyGroup{"io", 1, {}},
+                                                   ConcurrencyGroup{"compute", 2, {}}};
+  int init_count = 0;
+  int release_count = 0;
+
+  ConcurrencyGroupManager<BoundedExecutor> manager(
+      /* concurrency_groups= */ concurrency_groups,
+      /* max_concurrency_for_default_concurrency_group= */ 1,
+      /* initialize_thread_callback= */ [&init_count, &release_count]() {
+        init_count++;
+        return [&release_count]() { release_count++; };
+      });
+
+  // The pool is sized to the sum of the group max concurrencies plus the
+  // default group's, and only the pool threads run the initializer.
+  ASSERT_EQ(init_count, 4);
+
+  std::atomic<int> io_running{0};
+  std::atomic<int> io_max_running{0};
+  std::atomic<int> done{0};
+  constexpr int kNumTasks = 6;
+  auto io_executor = manager.GetExecutor("io", {});
+  for (int i = 0; i < kNumTasks; i++) {
+    io_executor->Post([&]() {
+      int cur = ++io_running;
+      int prev = io_max_running.load();
+      while (prev < cur && !io_max_running.compare_exchange_weak(prev, cur)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      --io_running;
+      ++done;
+    });
+  }
+  while (done.load() < kNumTasks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  // The io group never exceeded its max concurrency of 1 even though the
+  // shared pool has more threads available.
+  ASSERT_EQ(io_max_running.load(), 1);
+
+  manager.Stop();
+  ASSERT_EQ(release_count, 4);
+
+  RayConfig::instance().initialize(R"({"enable_shared_concurrency_group_pool": false})");
+}
+
 }  // namespace core
 }  // namespace ray
 
@@ -16,6 +16,7 @@
 #include <atomic>
 
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/core_worker/task_execution/fiber.h"
 #include "ray/util/logging.h"
 
@@ -95,6 +96,59 @@ TEST(FiberStateTest, RespectsConcurrencyLimit) {
   fiber_state.Join();
 }
 
+TEST(FiberStateTest, FairSchedulingRespectsConcurrencyLimit) {
+  RayConfig::instance().fiber_fair_scheduling_enabled() = true;
+  {
+    FiberState fiber_state(2);
+    TotalCounter total_counter;
+
+    ConcurrencyCounter counter;
+
+    for (int i = 0; i < 100; ++i) {
+      fiber_state.EnqueueFiber([&]() {
+        counter.inc_yield_dec();
+        total_counter.increment();
+      });
+    }
+
+    total_counter.wait_for(100);
+    EXPECT_EQ(counter.max_concurrency_, 2);
+
+    fiber_state.Stop();
+    fiber_state.Join();
+  }
+  RayConfig::instance().fiber_fair_scheduling_enabled() = false;
+}
+
+TEST(FiberStateTest, FairSchedulingRunsMixedWorkload) {
+  RayConfig::instance().fiber_fair_scheduling_enabled() = true;
+  {
+    FiberState fiber_state(8);
+    TotalCounter total_counter;
+    std::atomic<bool> stop{false};
+
+    // A CPU-heavy coroutine that keeps yielding back to the scheduler. Under
+    // fair scheduling its accumulated runtime pushes it behind the short
+    // coroutines, so they all complete while it is still spinning.
+    fiber_state.EnqueueFiber([&]() {
+      while (!stop) {
+        boost::this_fiber::yield();
+      }
+    });
+
+    for (int i = 0; i < 50; ++i) {
+      fiber_state.EnqueueFiber([&]() { total_counter.increment(); });
+    }
+
+    total_counter.wait_for(50);
+    stop = true;
+
+    fiber_state.Stop();
+    fiber_state.Join();
+  }
+  RayConfig::instance().fiber_fair_scheduling_enabled() = false;
+}
+
 TEST(FiberStateTest, DoubleStopJoin) {
   FiberState fiber_state(2);
   fiber_state.Stop();
@@ -23,6 +23,7 @@
 #include "ray/common/task/task_spec.h"
 #include "ray/common/test_utils.h"
 #include "ray/core_worker_rpc_client/core_worker_client_interface.h"
+#include "ray/observability/fake_metric.h"
 #include "ray/util/time.h"
 
 namespace ray {
@@ -140,7 +141,10 @@ class TaskReceiverTest : public ::testing::Test {
         task_event_buffer_,
         execute_task,
         *actor_task_execution_arg_waiter_,
-        /* initialize_thread_callback= */ []() { return []() { return; }; });
+        /* initialize_thread_callback= */ []() { return []() { return; }; },
+        /* forward_inline_result= */ nullptr,
+        fake_actor_task_queue_depth_gauge_,
+        fake_actor_task_queue_head_wait_gauge_);
   }
 
   Status MockExecuteTask(
@@ -168,6 +172,8 @@ class TaskReceiverTest : public ::testing::Test {
   instrumented_io_context task_execution_service_;
   MockTaskEventBuffer task_event_buffer_;
   std::unique_ptr<ActorTaskExecutionArgWaiter> actor_task_execution_arg_waiter_;
+  ray::observability::FakeGauge fake_actor_task_queue_depth_gauge_;
+  ray::observability::FakeGauge fake_actor_task_queue_head_wait_gauge_;
 };
 
 TEST_F(TaskReceiverTest, TestNewTaskFromDifferentWorker) {
@@ -28,7 +28,9 @@ BoundedExecutor::BoundedExecutor(
     std::function<std::function<void()>()> initialize_thread_callback,
     boost::chrono::milliseconds timeout_ms)
     : work_guard_(boost::asio::make_work_guard(io_context_)),
-      initialize_thread_callback_(initialize_thread_callback) {
+      initialize_thread_callback_(initialize_thread_callback),
+      max_concurrency_(max_concurrency),
+      shared_pool_(nullptr) {
   RAY_CHECK(max_concurrency > 0) << "max_concurrency must be greater than 0";
 
   boost::latch init_latch(max_concurrency);
@@ -55,18 +57,67 @@ BoundedExecutor::BoundedExecutor(
                                std::to_string(timeout_ms.count()) + " milliseconds";
 }
 
+BoundedExecutor::BoundedExecutor(int max_concurrency,
+                                 std::shared_ptr<BoundedExecutor> shared_pool)
+    : work_guard_(boost::asio::make_work_guard(io_context_)),
+      max_concurrency_(max_concurrency),
+      shared_pool_(std::move(shared_pool)) {
+  RAY_CHECK(max_concurrency > 0) << "max_concurrency must be greater than 0";
+  RAY_CHECK(shared_pool_ != nullptr) << "shared_pool must not be null";
+}
+
 void BoundedExecutor::Post(std::function<void()> fn) {
+  if (shared_pool_ != nullptr) {
+    {
+      absl::MutexLock lock(&limit_mu_);
+      if (num_running_ >= max_concurrency_) {
+        pending_.push_back(std::move(fn));
+        return;
+      }
+      num_running_++;
+    }
+    shared_pool_->Post(WrapForSharedPool(std::move(fn)));
+    return;
+  }
   boost::asio::post(io_context_, std::move(fn));
 }
 
+std::function<void()> BoundedExecutor::WrapForSharedPool(std::function<void()> fn) {
+  return [this, fn = std::move(fn)]() {
+    fn();
+    std::function<void()> next;
+    {
+      absl::MutexLock lock(&limit_mu_);
+      if (pending_.empty()) {
+        num_running_--;
+      } else {
+        // Hand the concurrency slot over to the next queued task, so
+        // num_running_ stays unchanged.
+        next = std::move(pending_.front());
+        pending_.pop_front();
+      }
+    }
+    if (next != nullptr) {
+      shared_pool_->Post(WrapForSharedPool(std::move(next)));
+    }
+  };
+}
+
 /// Stop the thread pool.
 void BoundedExecutor::Stop() {
+  if (shared_pool_ != nullptr) {
+    // The shared pool is stopped and joined by its owner.
+    return;
+  }
   work_guard_.reset();
   io_context_.stop();
 }
 
 /// Join the thread pool.
 void BoundedExecutor::Join() {
+  if (shared_pool_ != nullptr) {
+    return;
+  }
   work_guard_.reset();
   for (auto &thread : threads_) {
     if (thread.joinable()) {
@@ -17,12 +17,15 @@
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/chrono.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/util/logging.h"
 
 namespace ray {
@@ -52,6 +55,17 @@ class BoundedExecutor {
       std::function<std::function<void()>()> initialize_thread_callback = nullptr,
       boost::chrono::milliseconds timeout_ms = boost::chrono::milliseconds(10000));
 
+  /// Create an executor that runs at most `max_concurrency` tasks at a time
+  /// on `shared_pool` instead of owning dedicated threads. Tasks posted past
+  /// the limit are queued and started as running tasks finish, so sibling
+  /// executors sharing the pool can use its idle threads. The shared pool is
+  /// stopped and joined by its owner, not by this executor.
+  ///
+  /// \param max_concurrency The maximum number of tasks this executor runs
+  /// concurrently on the shared pool.
+  /// \param shared_pool The pool that actually runs the tasks.
+  BoundedExecutor(int max_concurrency, std::shared_ptr<BoundedExecutor> shared_pool);
+
   /// Posts work to the pool. This is a non-blocking call. In addition, the execution
   /// order of the tasks is not guaranteed if there are multiple threads in the pool.
   void Post(std::function<void()> fn);
@@ -63,11 +77,33 @@ class BoundedExecutor {
   void Join();
 
  private:
+  /// Wrap a task so that when it finishes it either starts the next queued
+  /// task on the shared pool, handing its concurrency slot over, or releases
+  /// the slot.
+  std::function<void()> WrapForSharedPool(std::function<void()> fn);
+
   boost::asio::io_context io_context_;
   boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
   std::vector<std::thread> threads_;
   std::function<std::function<void()>()> initialize_thread_callback_;
 
+  /// The maximum number of tasks running concurrently on the shared pool.
+  /// Only used when shared_pool_ is set.
+  const int max_concurrency_;
+
+  /// The pool that runs this executor's tasks, if this executor does not own
+  /// dedicated threads.
+  const std::shared_ptr<BoundedExecutor> shared_pool_;
+
+  /// Protects the concurrency accounting for the shared pool mode.
+  absl::Mutex limit_mu_;
+
+  /// The number of tasks currently running on the shared pool.
+  int num_running_ ABSL_GUARDED_BY(limit_mu_) = 0;
+
+  /// Tasks waiting for a concurrency slot on the shared pool.
+  std::deque<std::function<void()>> pending_ ABSL_GUARDED_BY(limit_mu_);
+
   /// A wrapper function that calls the `initialize_thread_callback_` and returns
   /// the releaser function. This should be called on each thread.
   std::function<void()> InitializeThread();
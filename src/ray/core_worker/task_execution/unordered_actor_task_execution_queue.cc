@@ -141,6 +141,15 @@ bool UnorderedActorTaskExecutionQueue::CancelTaskIfFound(TaskID task_id) {
   }
 }
 
+size_t UnorderedActorTaskExecutionQueue::NumPendingTasks() {
+  absl::MutexLock lock(&mu_);
+  return queued_actor_tasks_.size();
+}
+
+int64_t UnorderedActorTaskExecutionQueue::HeadOfLineBlockedTimeMs(int64_t /*now_ms*/) {
+  return 0;
+}
+
 void UnorderedActorTaskExecutionQueue::RunRequestWithResolvedDependencies(
     TaskToExecute request) {
   RAY_CHECK(request.DependenciesResolved());
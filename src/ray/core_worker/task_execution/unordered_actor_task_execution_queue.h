@@ -61,6 +61,12 @@ class UnorderedActorTaskExecutionQueue : public ActorTaskExecutionQueueInterface
   /// This method has to be THREAD-SAFE.
   bool CancelTaskIfFound(TaskID task_id) override;
 
+  size_t NumPendingTasks() override;
+
+  /// Always returns 0; this queue imposes no ordering, so tasks are never blocked
+  /// behind a head of line.
+  int64_t HeadOfLineBlockedTimeMs(int64_t now_ms) override;
+
  private:
   void CancelAllQueuedTasks(const std::string &msg);
 
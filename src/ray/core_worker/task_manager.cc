@@ -369,6 +369,9 @@ std::optional<rpc::ErrorType> TaskManager::ResubmitTask(
       return rpc::ErrorType::OBJECT_UNRECONSTRUCTABLE_TASK_CANCELLED;
     }
 
+    // Rehydrate the spec if it was demoted to the cold lineage tier.
+    task_entry.PromoteSpecFromColdLineage();
+
     if (task_entry.spec_.IsStreamingGenerator() &&
         task_entry.GetStatus() == rpc::TaskStatus::SUBMITTED_TO_WORKER) {
       if (task_entry.num_retries_left_ == 0) {
@@ -548,10 +551,26 @@ size_t TaskManager::NumPendingTasks() const {
   return num_pending_tasks_;
 }
 
-StatusOr<bool> TaskManager::HandleTaskReturn(const ObjectID &object_id,
-                                             const rpc::ReturnObject &return_object,
-                                             const NodeID &worker_node_id,
-                                             bool store_in_plasma) {
+void TaskManager::PutOrDeferTaskReturn(
+    const RayObject &object,
+    const ObjectID &object_id,
+    std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts) {
+  const bool has_reference = reference_counter_.HasReference(object_id);
+  if (deferred_puts != nullptr) {
+    deferred_puts->push_back(
+        CoreWorkerMemoryStore::PutRequest{object_id, object, has_reference});
+  } else {
+    in_memory_store_.Put(object, object_id, has_reference);
+  }
+}
+
+StatusOr<bool> TaskManager::HandleTaskReturn(
+    const ObjectID &object_id,
+    const rpc::ReturnObject &return_object,
+    const NodeID &worker_node_id,
+    bool store_in_plasma,
+    const std::shared_ptr<const rpc::PushTaskReply> &reply_owner,
+    std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts) {
   bool direct_return = false;
   reference_counter_.UpdateObjectSize(object_id, return_object.size());
   RAY_LOG(DEBUG) << "Task return object " << object_id << " has size "
@@ -564,29 +583,54 @@ StatusOr<bool> TaskManager::HandleTaskReturn(const ObjectID &object_id,
     // it as local in the in-memory store so that the data locality policy
     // will choose the right raylet for any queued dependent tasks.
     reference_counter_.UpdateObjectPinnedAtRaylet(object_id, worker_node_id);
+    if (::RayConfig::instance().eager_object_location_hints_enabled() &&
+        push_object_location_hint_callback_ != nullptr) {
+      PushObjectLocationHints(object_id, worker_node_id, return_object.size());
+    }
     // Mark it as in plasma with a dummy object.
-    in_memory_store_.Put(RayObject(rpc::ErrorType::OBJECT_IN_PLASMA),
-                         object_id,
-                         reference_counter_.HasReference(object_id));
+    PutOrDeferTaskReturn(
+        RayObject(rpc::ErrorType::OBJECT_IN_PLASMA), object_id, deferred_puts);
   } else {
     // NOTE(swang): If a direct object was promoted to plasma, then we do not
     // record the node ID that it was pinned at, which means that we will not
     // be able to reconstruct it if the plasma object copy is lost. However,
     // this is okay because the pinned copy is on the local node, so we will
     // fate-share with the object if the local node fails.
-    std::shared_ptr<LocalMemoryBuffer> data_buffer;
+    // Small direct returns can alias the reply's buffers via shared
+    // ownership, so the memory store keeps the reply alive instead of
+    // copying the data.
+    const bool zero_copy =
+        reply_owner != nullptr && !store_in_plasma &&
+        static_cast<int64_t>(return_object.data().size() +
+                             return_object.metadata().size()) <=
+            inline_return_zero_copy_threshold_;
+    std::shared_ptr<Buffer> data_buffer;
     if (!return_object.data().empty()) {
-      data_buffer = std::make_shared<LocalMemoryBuffer>(
-          const_cast<uint8_t *>(
-              reinterpret_cast<const uint8_t *>(return_object.data().data())),
-          return_object.data().size());
+      if (zero_copy) {
+        data_buffer = std::make_shared<SharedOwnerBuffer>(
+            reply_owner,
+            reinterpret_cast<const uint8_t *>(return_object.data().data()),
+            return_object.data().size());
+      } else {
+        data_buffer = std::make_shared<LocalMemoryBuffer>(
+            const_cast<uint8_t *>(
+                reinterpret_cast<const uint8_t *>(return_object.data().data())),
+            return_object.data().size());
+      }
     }
-    std::shared_ptr<LocalMemoryBuffer> metadata_buffer;
+    std::shared_ptr<Buffer> metadata_buffer;
     if (!return_object.metadata().empty()) {
-      metadata_buffer = std::make_shared<LocalMemoryBuffer>(
-          const_cast<uint8_t *>(
-              reinterpret_cast<const uint8_t *>(return_object.metadata().data())),
-          return_object.metadata().size());
+      if (zero_copy) {
+        metadata_buffer = std::make_shared<SharedOwnerBuffer>(
+            reply_owner,
+            reinterpret_cast<const uint8_t *>(return_object.metadata().data()),
+            return_object.metadata().size());
+      } else {
+        metadata_buffer = std::make_shared<LocalMemoryBuffer>(
+            const_cast<uint8_t *>(
+                reinterpret_cast<const uint8_t *>(return_object.metadata().data())),
+            return_object.metadata().size());
+      }
     }
 
     RayObject object(data_buffer,
@@ -600,7 +644,7 @@ StatusOr<bool> TaskManager::HandleTaskReturn(const ObjectID &object_id,
         return s;
       }
     } else {
-      in_memory_store_.Put(object, object_id, reference_counter_.HasReference(object_id));
+      PutOrDeferTaskReturn(object, object_id, deferred_puts);
       direct_return = true;
     }
   }
@@ -660,7 +704,15 @@ Status TaskManager::TryReadObjectRefStream(const ObjectID &generator_id,
     auto total_generated = stream_it->second.TotalNumObjectWritten();
     auto total_consumed = stream_it->second.TotalNumObjectConsumed();
     auto total_unconsumed = total_generated - total_consumed;
-    if (backpressure_threshold != -1 && total_unconsumed < backpressure_threshold) {
+    // Grant consumption credits in batches: wait until the executor would
+    // have at least `credit_batch` items of headroom before waking it, so a
+    // backpressured generator streams a batch of items per owner round trip
+    // instead of one. A batch of 1 wakes the executor as soon as the stream
+    // drops below the threshold.
+    const int64_t credit_batch = std::max<int64_t>(
+        1, std::min<int64_t>(generator_credit_batch_size_, backpressure_threshold));
+    if (backpressure_threshold != -1 &&
+        total_unconsumed + credit_batch <= backpressure_threshold) {
       auto it = ref_stream_execution_signal_callbacks_.find(generator_id);
       if (it != ref_stream_execution_signal_callbacks_.end()) {
         for (const auto &execution_signal : it->second) {
@@ -840,7 +892,9 @@ bool TaskManager::HandleReportGeneratorItemReturns(
         HandleTaskReturn(object_id,
                          returned_object,
                          NodeID::FromBinary(request.worker_addr().node_id()),
-                         /*store_in_plasma=*/store_in_plasma_ids.contains(object_id));
+                         /*store_in_plasma=*/store_in_plasma_ids.contains(object_id),
+                         /*reply_owner=*/nullptr,
+                         /*deferred_puts=*/nullptr);
     if (!put_res.ok()) {
       RAY_LOG(WARNING).WithField(object_id)
           << "Failed to handle streaming dynamic return: " << put_res.status();
@@ -910,14 +964,133 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
                                       const rpc::PushTaskReply &reply,
                                       const rpc::Address &worker_addr,
                                       bool is_application_error) {
+  if (completion_batch_size_ <= 1) {
+    // The reply is only borrowed, so the zero-copy path cannot be used.
+    CompletePendingTaskInternal(
+        task_id, reply, worker_addr, is_application_error, /*reply_owner=*/nullptr);
+    return;
+  }
+  CompletePendingTask(task_id,
+                      std::make_shared<rpc::PushTaskReply>(reply),
+                      worker_addr,
+                      is_application_error);
+}
+
+void TaskManager::CompletePendingTask(const TaskID &task_id,
+                                      std::shared_ptr<rpc::PushTaskReply> reply,
+                                      const rpc::Address &worker_addr,
+                                      bool is_application_error) {
+  if (completion_batch_size_ <= 1) {
+    CompletePendingTaskInternal(
+        task_id, *reply, worker_addr, is_application_error, reply);
+    return;
+  }
+
+  {
+    absl::MutexLock lock(&completion_queue_mu_);
+    completion_queue_.push_back(
+        TaskCompletion{task_id, std::move(reply), worker_addr, is_application_error});
+    if (draining_completion_queue_) {
+      // Another thread is draining the queue and will pick this entry up.
+      return;
+    }
+    draining_completion_queue_ = true;
+  }
+  DrainCompletionQueue();
+}
+
+void TaskManager::DrainCompletionQueue() {
+  while (true) {
+    std::vector<TaskCompletion> batch;
+    {
+      absl::MutexLock lock(&completion_queue_mu_);
+      if (completion_queue_.empty()) {
+        draining_completion_queue_ = false;
+        return;
+      }
+      const size_t batch_size = std::min(completion_queue_.size(),
+                                         static_cast<size_t>(completion_batch_size_));
+      batch.insert(batch.end(),
+                   std::make_move_iterator(completion_queue_.begin()),
+                   std::make_move_iterator(completion_queue_.begin() + batch_size));
+      completion_queue_.erase(completion_queue_.begin(),
+                              completion_queue_.begin() + batch_size);
+    }
+
+    std::vector<CompletionState> states(batch.size());
+    std::vector<CoreWorkerMemoryStore::PutRequest> deferred_puts;
+    for (size_t i = 0; i < batch.size(); i++) {
+      const auto &completion = batch[i];
+      states[i].failed = !HandleCompletedTaskReturns(completion.task_id,
+                                                     *completion.reply,
+                                                     completion.worker_addr,
+                                                     completion.reply,
+                                                     &deferred_puts,
+                                                     &states[i]);
+    }
+    // Bulk-insert the batch's return objects into the memory store. This must
+    // happen while the batch, which owns the replies the deferred objects
+    // borrow their data from, is still alive. (Zero-copy entries share
+    // ownership of their reply and do not depend on the batch's lifetime.)
+    in_memory_store_.BatchPut(std::move(deferred_puts));
+
+    {
+      absl::MutexLock lock(&mu_);
+      for (size_t i = 0; i < batch.size(); i++) {
+        if (!states[i].failed) {
+          FinalizeCompletedTaskLocked(batch[i].task_id,
+                                      *batch[i].reply,
+                                      batch[i].is_application_error,
+                                      &states[i]);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < batch.size(); i++) {
+      if (!states[i].failed) {
+        PostProcessCompletedTask(*batch[i].reply,
+                                 batch[i].worker_addr,
+                                 batch[i].is_application_error,
+                                 &states[i]);
+      }
+    }
+  }
+}
+
+void TaskManager::CompletePendingTaskInternal(
+    const TaskID &task_id,
+    const rpc::PushTaskReply &reply,
+    const rpc::Address &worker_addr,
+    bool is_application_error,
+    const std::shared_ptr<const rpc::PushTaskReply> &reply_owner) {
+  CompletionState state;
+  if (!HandleCompletedTaskReturns(
+          task_id, reply, worker_addr, reply_owner, /*deferred_puts=*/nullptr, &state)) {
+    return;
+  }
+  {
+    absl::MutexLock lock(&mu_);
+    FinalizeCompletedTaskLocked(task_id, reply, is_application_error, &state);
+  }
+  PostProcessCompletedTask(reply, worker_addr, is_application_error, &state);
+}
+
+bool TaskManager::HandleCompletedTaskReturns(
+    const TaskID &task_id,
+    const rpc::PushTaskReply &reply,
+    const rpc::Address &worker_addr,
+    const std::shared_ptr<const rpc::PushTaskReply> &reply_owner,
+    std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts,
+    CompletionState *state) {
   RAY_LOG(DEBUG) << "Completing task " << task_id;
 
-  bool first_execution = false;
-  const auto store_in_plasma_ids =
-      GetTaskReturnObjectsToStoreInPlasma(task_id, &first_execution);
-  std::vector<ObjectID> dynamic_return_ids;
-  std::vector<ObjectID> dynamic_returns_in_plasma;
-  std::vector<ObjectID> direct_return_ids;
+  state->store_in_plasma_ids =
+      GetTaskReturnObjectsToStoreInPlasma(task_id, &state->first_execution);
+  const bool first_execution = state->first_execution;
+  const auto &store_in_plasma_ids = state->store_in_plasma_ids;
+  auto &dynamic_return_ids = state->dynamic_return_ids;
+  auto &dynamic_returns_in_plasma = state->dynamic_returns_in_plasma;
+  auto &direct_return_ids = state->direct_return_ids;
   if (reply.dynamic_return_objects_size() > 0) {
     RAY_CHECK(reply.return_objects_size() == 1)
         << "Dynamic generators only supported for num_returns=1";
@@ -932,7 +1105,9 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
           HandleTaskReturn(object_id,
                            return_object,
                            NodeID::FromBinary(worker_addr.node_id()),
-                           store_in_plasma_ids.contains(object_id));
+                           store_in_plasma_ids.contains(object_id),
+                           reply_owner,
+                           deferred_puts);
       if (!direct_or.ok()) {
         RAY_LOG(WARNING).WithField(object_id)
             << "Failed to handle dynamic task return: " << direct_or.status();
@@ -946,7 +1121,7 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
                                /*ray_error_info=*/&err_info,
                                /*mark_task_object_failed=*/true,
                                /*fail_immediately=*/true);
-        return;
+        return false;
       } else if (!direct_or.value() && first_execution) {
         dynamic_returns_in_plasma.push_back(object_id);
       }
@@ -958,7 +1133,9 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
     StatusOr<bool> direct_or = HandleTaskReturn(object_id,
                                                 return_object,
                                                 NodeID::FromBinary(worker_addr.node_id()),
-                                                store_in_plasma_ids.contains(object_id));
+                                                store_in_plasma_ids.contains(object_id),
+                                                reply_owner,
+                                                deferred_puts);
     if (!direct_or.ok()) {
       RAY_LOG(WARNING).WithField(object_id)
           << "Failed to handle task return: " << direct_or.status();
@@ -974,21 +1151,31 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
                              /*ray_error_info=*/&err_info,
                              /*mark_task_object_failed=*/true,
                              /*fail_immediately=*/true);
-      return;
+      return false;
     } else if (direct_or.value()) {
       direct_return_ids.push_back(object_id);
     }
   }
+  return true;
+}
 
-  TaskSpecification spec;
-  bool release_lineage = true;
-  int64_t min_lineage_bytes_to_evict = 0;
+void TaskManager::FinalizeCompletedTaskLocked(const TaskID &task_id,
+                                              const rpc::PushTaskReply &reply,
+                                              bool is_application_error,
+                                              CompletionState *state) {
+  const bool first_execution = state->first_execution;
+  const auto &dynamic_return_ids = state->dynamic_return_ids;
+  const auto &dynamic_returns_in_plasma = state->dynamic_returns_in_plasma;
+  const auto &direct_return_ids = state->direct_return_ids;
+  TaskSpecification &spec = state->spec;
+  bool &release_lineage = state->release_lineage;
+  int64_t &min_lineage_bytes_to_evict = state->min_lineage_bytes_to_evict;
   {
-    absl::MutexLock lock(&mu_);
     auto it = submissible_tasks_.find(task_id);
     RAY_CHECK(it != submissible_tasks_.end())
         << "Tried to complete task that was not pending " << task_id;
     spec = it->second.spec_;
+    EraseResultForwardDestinations(spec);
 
     // Record any dynamically returned objects. We need to store these with the
     // task spec so that the worker will recreate them if the task gets
@@ -1064,6 +1251,12 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
       release_lineage = false;
       it->second.lineage_footprint_bytes_ = it->second.spec_.GetMessage().ByteSizeLong();
       total_lineage_footprint_bytes_ += it->second.lineage_footprint_bytes_;
+      if (RayConfig::instance().lineage_cold_storage_enabled() &&
+          !spec.IsStreamingGenerator() && !spec.ReturnsDynamic()) {
+        // The spec is only needed again if the task is resubmitted for
+        // reconstruction, so keep just its serialized form resident.
+        it->second.DemoteSpecToColdLineage();
+      }
       if (total_lineage_footprint_bytes_ > max_lineage_bytes_) {
         RAY_LOG(INFO) << "Total lineage size is " << total_lineage_footprint_bytes_ / 1e6
                       << "MB, which exceeds the limit of " << max_lineage_bytes_ / 1e6
@@ -1075,6 +1268,15 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
       submissible_tasks_.erase(it);
     }
   }
+}
+
+void TaskManager::PostProcessCompletedTask(const rpc::PushTaskReply &reply,
+                                           const rpc::Address &worker_addr,
+                                           bool is_application_error,
+                                           CompletionState *state) {
+  const bool first_execution = state->first_execution;
+  const auto &store_in_plasma_ids = state->store_in_plasma_ids;
+  TaskSpecification &spec = state->spec;
 
   // If it is a streaming generator, mark the end of stream since the task is finished.
   // We handle this logic here because the lock shouldn't be held while calling
@@ -1103,7 +1305,9 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
               HandleTaskReturn(generator_return_id,
                                return_object,
                                NodeID::FromBinary(worker_addr.node_id()),
-                               store_in_plasma_ids.contains(generator_return_id));
+                               store_in_plasma_ids.contains(generator_return_id),
+                               /*reply_owner=*/nullptr,
+                               /*deferred_puts=*/nullptr);
           if (!res.ok()) {
             RAY_LOG(WARNING).WithField(generator_return_id)
                 << "Failed to handle generator return during app error propagation: "
@@ -1125,10 +1329,12 @@ void TaskManager::CompletePendingTask(const TaskID &task_id,
     }
   }
 
-  RemoveFinishedTaskReferences(spec, release_lineage, worker_addr, reply.borrowed_refs());
-  if (min_lineage_bytes_to_evict > 0) {
+  RemoveFinishedTaskReferences(
+      spec, state->release_lineage, worker_addr, reply.borrowed_refs());
+  if (state->min_lineage_bytes_to_evict > 0) {
     // Evict at least half of the current lineage.
-    auto bytes_evicted = reference_counter_.EvictLineage(min_lineage_bytes_to_evict);
+    auto bytes_evicted =
+        reference_counter_.EvictLineage(state->min_lineage_bytes_to_evict);
     RAY_LOG(INFO) << "Evicted " << bytes_evicted / 1e6 << "MB of task lineage.";
   }
 
@@ -1291,6 +1497,7 @@ void TaskManager::FailPendingTask(const TaskID &task_id,
     RAY_CHECK(it->second.IsPending())
         << "Tried to fail task that was not pending " << task_id;
     spec = it->second.spec_;
+    EraseResultForwardDestinations(spec);
     if (it->second.is_canceled_ && error_type != rpc::ErrorType::TASK_CANCELLED) {
       // If the task is marked as cancelled before reaching FailPendingTask (which is
       // essentially the final state of the task lifecycle), that failure reason takes
@@ -1346,6 +1553,10 @@ void TaskManager::FailPendingTask(const TaskID &task_id,
 
   MarkTaskReturnObjectsFailed(spec, error_type, ray_error_info, store_in_plasma_ids);
 
+  // The task's returns will never be created, so any recorded location hint
+  // consumers are stale.
+  ClearObjectLocationHints(spec);
+
   ShutdownIfNeeded();
 }
 
@@ -1466,6 +1677,9 @@ int64_t TaskManager::RemoveLineageReference(const ObjectID &object_id,
                  << " plasma returns in scope";
 
   if (it->second.reconstructable_return_ids_.empty() && !it->second.IsPending()) {
+    // Rehydrate a cold spec so the task's argument references can be walked
+    // before the entry is erased.
+    it->second.PromoteSpecFromColdLineage();
     // If the task can no longer be retried, decrement the lineage ref count
     // for each of the task's args.
     for (size_t i = 0; i < it->second.spec_.NumArgs(); i++) {
@@ -1639,7 +1853,7 @@ std::optional<TaskSpecification> TaskManager::GetTaskSpec(const TaskID &task_id)
   if (it == submissible_tasks_.end()) {
     return std::optional<TaskSpecification>();
   }
-  return it->second.spec_;
+  return it->second.RehydratedSpec();
 }
 
 std::vector<TaskID> TaskManager::GetPendingChildrenTasks(
@@ -1665,7 +1879,7 @@ void TaskManager::AddTaskStatusInfo(rpc::CoreWorkerStats *stats) const {
       continue;
     }
     ref->set_task_status(it->second.GetStatus());
-    ref->set_attempt_number(it->second.spec_.AttemptNumber());
+    ref->set_attempt_number(it->second.GetAttemptNumber());
   }
 }
 
@@ -1682,6 +1896,34 @@ void TaskManager::MarkDependenciesResolved(const TaskID &task_id) {
   SetTaskStatus(it->second, rpc::TaskStatus::PENDING_NODE_ASSIGNMENT);
 }
 
+void TaskManager::RegisterResultForwardDestination(const ObjectID &object_id,
+                                                   const rpc::Address &addr) {
+  if (!RayConfig::instance().task_result_forwarding_enabled()) {
+    return;
+  }
+  absl::MutexLock lock(&mu_);
+  result_forward_destinations_[object_id] = addr;
+}
+
+std::optional<rpc::Address> TaskManager::GetResultForwardDestination(
+    const ObjectID &object_id) const {
+  absl::MutexLock lock(&mu_);
+  auto it = result_forward_destinations_.find(object_id);
+  if (it == result_forward_destinations_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void TaskManager::EraseResultForwardDestinations(const TaskSpecification &spec) {
+  if (result_forward_destinations_.empty()) {
+    return;
+  }
+  for (size_t i = 0; i < spec.NumReturns(); i++) {
+    result_forward_destinations_.erase(spec.ReturnId(i));
+  }
+}
+
 void TaskManager::MarkTaskWaitingForExecution(const TaskID &task_id,
                                               const NodeID &node_id,
                                               const WorkerID &worker_id) {
@@ -1697,6 +1939,57 @@ void TaskManager::MarkTaskWaitingForExecution(const TaskID &task_id,
   SetTaskStatus(it->second,
                 rpc::TaskStatus::SUBMITTED_TO_WORKER,
                 worker::TaskStatusEvent::TaskStateUpdate(node_id, worker_id));
+  if (::RayConfig::instance().eager_object_location_hints_enabled() &&
+      push_object_location_hint_callback_ != nullptr) {
+    RecordConsumerNodeForDependencies(it->second.spec_, node_id);
+  }
+}
+
+void TaskManager::RecordConsumerNodeForDependencies(const TaskSpecification &spec,
+                                                    const NodeID &node_id) {
+  for (const auto &dep_id : spec.GetDependencyIds()) {
+    // Only track dependencies whose producing task we own and that have not
+    // been created yet; for anything else the normal location subscription
+    // already has the data.
+    auto producer_it = submissible_tasks_.find(dep_id.TaskId());
+    if (producer_it == submissible_tasks_.end() || !producer_it->second.IsPending()) {
+      continue;
+    }
+    absl::MutexLock lock(&object_consumer_nodes_mu_);
+    object_consumer_nodes_[dep_id].insert(node_id);
+  }
+}
+
+void TaskManager::PushObjectLocationHints(const ObjectID &object_id,
+                                          const NodeID &location_node_id,
+                                          uint64_t object_size) {
+  absl::flat_hash_set<NodeID> consumer_nodes;
+  {
+    absl::MutexLock lock(&object_consumer_nodes_mu_);
+    auto it = object_consumer_nodes_.find(object_id);
+    if (it == object_consumer_nodes_.end()) {
+      return;
+    }
+    consumer_nodes = std::move(it->second);
+    object_consumer_nodes_.erase(it);
+  }
+  for (const auto &consumer_node_id : consumer_nodes) {
+    if (consumer_node_id == location_node_id) {
+      // The object is already local to the consumer's node.
+      continue;
+    }
+    RAY_LOG(DEBUG).WithField(object_id).WithField(consumer_node_id)
+        << "Pushing eager object location hint, location node " << location_node_id;
+    push_object_location_hint_callback_(
+        consumer_node_id, object_id, location_node_id, object_size);
+  }
+}
+
+void TaskManager::ClearObjectLocationHints(const TaskSpecification &spec) {
+  absl::MutexLock lock(&object_consumer_nodes_mu_);
+  for (size_t i = 0; i < spec.NumReturns(); i++) {
+    object_consumer_nodes_.erase(spec.ReturnId(i));
+  }
 }
 
 void TaskManager::SetTaskStatus(
@@ -1775,7 +2068,9 @@ void TaskManager::FillTaskInfo(rpc::GetCoreWorkerStatsReply *reply,
 
     const auto &task_entry = task_it.second;
     auto entry = reply->add_owned_task_info_entries();
-    const auto &task_spec = task_entry.spec_;
+    // Rehydrates a copy if the spec is in the cold lineage tier; a cheap
+    // shared_ptr copy otherwise.
+    const TaskSpecification task_spec = task_entry.RehydratedSpec();
     const auto &task_state = task_entry.GetStatus();
     const auto &node_id = task_entry.GetNodeId();
     rpc::TaskType type;
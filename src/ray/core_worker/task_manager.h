@@ -24,8 +24,10 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/core_worker/core_worker_options.h"
 #include "ray/core_worker/reference_counter_interface.h"
@@ -56,6 +58,14 @@ using PushErrorCallback = std::function<Status(const JobID &job_id,
                                                const std::string &error_message,
                                                double timestamp)>;
 using ExecutionSignalCallback = std::function<void(Status, int64_t)>;
+/// Pushes the newly known location of a return object to a node hosting an
+/// already-submitted consumer task. See
+/// RayConfig::eager_object_location_hints_enabled.
+using PushObjectLocationHintCallback =
+    std::function<void(const NodeID &consumer_node_id,
+                       const ObjectID &object_id,
+                       const NodeID &location_node_id,
+                       uint64_t object_size)>;
 
 /// When the streaming generator tasks are submitted,
 /// the intermediate return objects are streamed
@@ -189,7 +199,8 @@ class TaskManager : public TaskManagerInterface {
       ray::observability::MetricInterface &task_by_state_counter,
       ray::observability::MetricInterface &total_lineage_bytes_gauge,
       FreeActorObjectCallback free_actor_object_callback,
-      SetDirectTransportMetadata set_direct_transport_metadata)
+      SetDirectTransportMetadata set_direct_transport_metadata,
+      PushObjectLocationHintCallback push_object_location_hint_callback = nullptr)
       : in_memory_store_(in_memory_store),
         reference_counter_(reference_counter),
         put_in_local_plasma_callback_(std::move(put_in_local_plasma_callback)),
@@ -203,7 +214,9 @@ class TaskManager : public TaskManagerInterface {
         task_by_state_counter_(task_by_state_counter),
         total_lineage_bytes_gauge_(total_lineage_bytes_gauge),
         free_actor_object_callback_(std::move(free_actor_object_callback)),
-        set_direct_transport_metadata_(std::move(set_direct_transport_metadata)) {
+        set_direct_transport_metadata_(std::move(set_direct_transport_metadata)),
+        push_object_location_hint_callback_(
+            std::move(push_object_location_hint_callback)) {
     task_counter_.SetOnChangeCallback(
         [this](const std::tuple<std::string, rpc::TaskStatus, bool> &key)
             ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_) {
@@ -239,6 +252,15 @@ class TaskManager : public TaskManagerInterface {
                            const rpc::Address &worker_addr,
                            bool is_application_error) override;
 
+  /// Overload taking shared ownership of the reply. When
+  /// `inline_return_zero_copy_threshold_bytes` is positive, direct returns no
+  /// larger than the threshold are stored by aliasing the reply's buffers,
+  /// with the reply kept alive by the stored objects, instead of copying.
+  void CompletePendingTask(const TaskID &task_id,
+                           std::shared_ptr<rpc::PushTaskReply> reply,
+                           const rpc::Address &worker_addr,
+                           bool is_application_error) override;
+
   /**
    * The below APIs support streaming generator.
    *
@@ -487,6 +509,12 @@ class TaskManager : public TaskManagerInterface {
 
   void MarkDependenciesResolved(const TaskID &task_id) override;
 
+  void RegisterResultForwardDestination(const ObjectID &object_id,
+                                        const rpc::Address &addr) override;
+
+  std::optional<rpc::Address> GetResultForwardDestination(
+      const ObjectID &object_id) const override;
+
   void MarkTaskWaitingForExecution(const TaskID &task_id,
                                    const NodeID &node_id,
                                    const WorkerID &worker_id) override;
@@ -566,6 +594,46 @@ class TaskManager : public TaskManagerInterface {
       return GetStatus() == rpc::TaskStatus::SUBMITTED_TO_WORKER;
     }
 
+    /// Whether the task spec currently lives in the cold lineage tier, i.e.
+    /// only its serialized form is resident.
+    bool IsSpecCold() const { return !cold_spec_.empty(); }
+
+    /// Demote the task spec to the cold lineage tier: keep only the
+    /// protobuf-serialized bytes and drop the in-memory message, shrinking
+    /// the entry's resident footprint to roughly its serialized size. Only
+    /// valid for entries that are no longer pending, since pending-task code
+    /// paths read the spec directly.
+    void DemoteSpecToColdLineage() {
+      RAY_CHECK(!IsPending());
+      if (IsSpecCold()) {
+        return;
+      }
+      cold_spec_ = spec_.Serialize();
+      cold_attempt_number_ = spec_.AttemptNumber();
+      spec_ = TaskSpecification();
+    }
+
+    /// Restore the in-memory task spec from the cold tier, if demoted.
+    void PromoteSpecFromColdLineage() {
+      if (!IsSpecCold()) {
+        return;
+      }
+      spec_ = TaskSpecification(cold_spec_);
+      cold_spec_.clear();
+      cold_spec_.shrink_to_fit();
+    }
+
+    /// Return a usable copy of the task spec without promoting the entry out
+    /// of the cold tier.
+    TaskSpecification RehydratedSpec() const {
+      return IsSpecCold() ? TaskSpecification(cold_spec_) : spec_;
+    }
+
+    /// The task's attempt number, readable while the spec is cold.
+    int32_t GetAttemptNumber() const {
+      return IsSpecCold() ? cold_attempt_number_ : spec_.AttemptNumber();
+    }
+
     /// The task spec. This is pinned as long as the following are true:
     /// - The task is still pending execution. This means that the task may
     /// fail and so it may be retried in the future.
@@ -615,6 +683,12 @@ class TaskManager : public TaskManagerInterface {
     NodeID node_id_;
     // Whether this is a task retry due to task failure.
     bool is_retry_ = false;
+    // Serialized form of spec_ while the entry is demoted to the cold lineage
+    // tier. Empty while the in-memory spec is resident.
+    std::string cold_spec_;
+    // The attempt number at demotion time, so observability paths can report
+    // it without rehydrating the spec.
+    int32_t cold_attempt_number_ = 0;
   };
 
   /// Set the task retry number to 0. If canceled is true, mark the task as
@@ -625,10 +699,124 @@ class TaskManager : public TaskManagerInterface {
   /// Update nested ref count info and store the task's return object.
   /// Returns StatusOr<bool> where the bool indicates the object was returned
   /// directly in-memory (not stored in plasma) when true.
-  StatusOr<bool> HandleTaskReturn(const ObjectID &object_id,
-                                  const rpc::ReturnObject &return_object,
-                                  const NodeID &worker_node_id,
-                                  bool store_in_plasma) ABSL_LOCKS_EXCLUDED(mu_);
+  ///
+  /// If deferred_puts is not null, memory store insertions are appended to it
+  /// instead of being applied immediately. The caller must flush them with
+  /// BatchPut before the reply that backs the return object is destroyed,
+  /// since the deferred objects borrow the reply's data.
+  ///
+  /// If reply_owner is not null and the return object is a direct return no
+  /// larger than inline_return_zero_copy_threshold_, the stored object
+  /// aliases the reply's buffers and shares ownership of the reply instead
+  /// of copying the data.
+  StatusOr<bool> HandleTaskReturn(
+      const ObjectID &object_id,
+      const rpc::ReturnObject &return_object,
+      const NodeID &worker_node_id,
+      bool store_in_plasma,
+      const std::shared_ptr<const rpc::PushTaskReply> &reply_owner,
+      std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Store a task return object in the memory store, or append it to
+  /// deferred_puts for a later BatchPut if deferred_puts is not null.
+  void PutOrDeferTaskReturn(
+      const RayObject &object,
+      const ObjectID &object_id,
+      std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts);
+
+  /// A task completion reply queued for batched processing.
+  struct TaskCompletion {
+    TaskID task_id;
+    std::shared_ptr<rpc::PushTaskReply> reply;
+    rpc::Address worker_addr;
+    bool is_application_error;
+  };
+
+  /// Intermediate state produced while completing one task, passed between
+  /// the phases of completion processing.
+  struct CompletionState {
+    /// Set if handling a return object failed. The task has already been
+    /// failed or retried in that case and the remaining phases must be
+    /// skipped.
+    bool failed = false;
+    bool first_execution = false;
+    absl::flat_hash_set<ObjectID> store_in_plasma_ids;
+    std::vector<ObjectID> dynamic_return_ids;
+    std::vector<ObjectID> dynamic_returns_in_plasma;
+    std::vector<ObjectID> direct_return_ids;
+    /// Outputs of FinalizeCompletedTaskLocked, consumed by
+    /// PostProcessCompletedTask.
+    TaskSpecification spec;
+    bool release_lineage = true;
+    int64_t min_lineage_bytes_to_evict = 0;
+  };
+
+  /// Record that a task submitted to `node_id` consumes the given spec's
+  /// dependencies, for deps whose producing task is still pending. Once the
+  /// producing task reports an in-plasma return, the return object's location
+  /// is pushed to the recorded nodes via push_object_location_hint_callback_.
+  void RecordConsumerNodeForDependencies(const TaskSpecification &spec,
+                                         const NodeID &node_id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// Push the newly known location of a return object to the consumer nodes
+  /// recorded for it, then drop the hint state. Best effort; no-op if no
+  /// consumer nodes were recorded.
+  void PushObjectLocationHints(const ObjectID &object_id,
+                               const NodeID &location_node_id,
+                               uint64_t object_size) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Drop hint state for the given task's return objects. Called when the
+  /// task fails and its returns will never be created.
+  void ClearObjectLocationHints(const TaskSpecification &spec)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Process a single completion reply end to end (all three phases below).
+  /// reply_owner may be null; see HandleTaskReturn.
+  void CompletePendingTaskInternal(
+      const TaskID &task_id,
+      const rpc::PushTaskReply &reply,
+      const rpc::Address &worker_addr,
+      bool is_application_error,
+      const std::shared_ptr<const rpc::PushTaskReply> &reply_owner)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// First phase of completing a task: handle all return objects in the
+  /// reply. See HandleTaskReturn for the semantics of reply_owner and
+  /// deferred_puts.
+  ///
+  /// \return false if handling a return object failed. The task has already
+  /// been failed or retried in that case and completion must not proceed.
+  bool HandleCompletedTaskReturns(
+      const TaskID &task_id,
+      const rpc::PushTaskReply &reply,
+      const rpc::Address &worker_addr,
+      const std::shared_ptr<const rpc::PushTaskReply> &reply_owner,
+      std::vector<CoreWorkerMemoryStore::PutRequest> *deferred_puts,
+      CompletionState *state) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Second phase of completing a task: task entry bookkeeping. Callers may
+  /// finalize several tasks under one mu_ acquisition.
+  void FinalizeCompletedTaskLocked(const TaskID &task_id,
+                                   const rpc::PushTaskReply &reply,
+                                   bool is_application_error,
+                                   CompletionState *state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// Third phase of completing a task: end-of-stream handling for streaming
+  /// generators, removal of finished task references, and lineage eviction.
+  void PostProcessCompletedTask(const rpc::PushTaskReply &reply,
+                                const rpc::Address &worker_addr,
+                                bool is_application_error,
+                                CompletionState *state) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Drain the completion queue, processing up to completion_batch_size_
+  /// replies per iteration: the return objects of each batch are bulk
+  /// inserted into the memory store and the bookkeeping for the whole batch
+  /// is done under a single mu_ acquisition. Only one thread drains at a
+  /// time; see CompletePendingTask.
+  void DrainCompletionQueue() ABSL_LOCKS_EXCLUDED(completion_queue_mu_, mu_);
 
   /// Remove a lineage reference to this object ID. This should be called
   /// whenever a task that depended on this object ID can no longer be retried.
@@ -671,6 +859,11 @@ class TaskManager : public TaskManagerInterface {
   /// Shutdown if all tasks are finished and shutdown is scheduled.
   void ShutdownIfNeeded() ABSL_LOCKS_EXCLUDED(mu_);
 
+  /// Drop any result forward destinations registered for the given task's
+  /// return objects. Called once the task completes or fails.
+  void EraseResultForwardDestinations(const TaskSpecification &spec)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   /// Updates the task entry state (e.g. status, is_retry, lineage_footprint_bytes_,
   /// num_retries_left) + related global task manager state.
   void SetupTaskEntryForResubmit(TaskEntry &task_entry)
@@ -779,6 +972,37 @@ class TaskManager : public TaskManagerInterface {
   /// using object ref stream APIs
   mutable absl::Mutex object_ref_stream_ops_mu_;
 
+  /// Maximum number of completion replies processed per batch. Completion
+  /// batching is enabled when this is > 1. Cached at construction.
+  const int64_t completion_batch_size_ =
+      RayConfig::instance().task_manager_completion_batch_size();
+
+  /// Maximum data + metadata size of a direct return object that may alias
+  /// the reply's buffers via shared ownership instead of being copied into
+  /// the memory store. 0 disables the zero-copy path. Cached at construction.
+  const int64_t inline_return_zero_copy_threshold_ =
+      RayConfig::instance().inline_return_zero_copy_threshold_bytes();
+
+  /// Number of consumption credits to accumulate before waking a
+  /// backpressured streaming generator, so the generator streams a batch of
+  /// items per owner round trip. 1 wakes the generator as soon as the stream
+  /// drops below the backpressure threshold. Cached at construction.
+  const int64_t generator_credit_batch_size_ =
+      RayConfig::instance().generator_backpressure_credit_batch_size();
+
+  /// Protects the completion queue below.
+  mutable absl::Mutex completion_queue_mu_;
+
+  /// Task completion replies waiting to be processed when completion batching
+  /// is enabled. The queue shares ownership of the replies; the draining
+  /// thread keeps them alive until the whole batch has been processed.
+  std::vector<TaskCompletion> completion_queue_ ABSL_GUARDED_BY(completion_queue_mu_);
+
+  /// Whether some thread is currently draining the completion queue. New
+  /// completions enqueued while a drain is in progress are picked up by the
+  /// draining thread.
+  bool draining_completion_queue_ ABSL_GUARDED_BY(completion_queue_mu_) = false;
+
   /// Tracks per-task-state counters for metric purposes.
   TaskStatusCounter task_counter_ ABSL_GUARDED_BY(mu_);
 
@@ -788,6 +1012,12 @@ class TaskManager : public TaskManagerInterface {
   /// future.
   absl::flat_hash_map<TaskID, TaskEntry> submissible_tasks_ ABSL_GUARDED_BY(mu_);
 
+  /// Consumer workers registered to receive inlined task returns directly
+  /// from the executor. Keyed by return object ID; entries are dropped when
+  /// the producing task completes or fails.
+  absl::flat_hash_map<ObjectID, rpc::Address> result_forward_destinations_
+      ABSL_GUARDED_BY(mu_);
+
   /// Number of tasks that are pending. This is a count of all tasks in
   /// submissible_tasks_ that have been submitted and are currently pending
   /// execution.
@@ -828,6 +1058,22 @@ class TaskManager : public TaskManagerInterface {
   /// Callback to set the direct transport metadata for a object.
   SetDirectTransportMetadata set_direct_transport_metadata_;
 
+  /// Callback to push an eager object location hint to a consumer node's
+  /// raylet. May be nullptr, in which case no hints are pushed.
+  PushObjectLocationHintCallback push_object_location_hint_callback_;
+
+  /// Protects object_consumer_nodes_. Kept separate from mu_ because hints
+  /// are pushed from HandleTaskReturn, which can run while other TaskManager
+  /// locks are held; lock order is mu_ -> object_consumer_nodes_mu_.
+  mutable absl::Mutex object_consumer_nodes_mu_;
+
+  /// Map from a pending return object to the nodes hosting already-submitted
+  /// tasks that consume it. Entries are dropped once the hint is pushed or
+  /// the producing task fails. Only populated when
+  /// RayConfig::eager_object_location_hints_enabled is set.
+  absl::flat_hash_map<ObjectID, absl::flat_hash_set<NodeID>> object_consumer_nodes_
+      ABSL_GUARDED_BY(object_consumer_nodes_mu_);
+
   friend class TaskManagerTest;
 };
 
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -61,6 +63,16 @@ class TaskManagerInterface {
                                    const rpc::Address &actor_addr,
                                    bool is_application_error) = 0;
 
+  /// Same as above, but the caller transfers shared ownership of the reply.
+  /// Implementations may alias the reply's return object buffers instead of
+  /// copying them, keeping the reply alive via `reply` for as long as needed.
+  virtual void CompletePendingTask(const TaskID &task_id,
+                                   std::shared_ptr<rpc::PushTaskReply> reply,
+                                   const rpc::Address &actor_addr,
+                                   bool is_application_error) {
+    CompletePendingTask(task_id, *reply, actor_addr, is_application_error);
+  }
+
   /// Returns true if task can be retried.
   ///
   /// \param[in] task_id ID of the task to be retried.
@@ -149,6 +161,21 @@ class TaskManagerInterface {
   /// \param[in] task_id The task that is now scheduled.
   virtual void MarkDependenciesResolved(const TaskID &task_id) = 0;
 
+  /// Register a consumer worker that should receive the inlined value of the
+  /// given task return object directly from the executor, in addition to the
+  /// owner-routed reply path. The registration is dropped once the task
+  /// completes or fails. No-op unless task_result_forwarding_enabled.
+  ///
+  /// \param[in] object_id The task return object to forward.
+  /// \param[in] addr The address of the consumer worker.
+  virtual void RegisterResultForwardDestination(const ObjectID &object_id,
+                                                const rpc::Address &addr) = 0;
+
+  /// Return the forward destination registered for the given return object,
+  /// if any.
+  virtual std::optional<rpc::Address> GetResultForwardDestination(
+      const ObjectID &object_id) const = 0;
+
   /// Sets the task state to no-retry. This is used when Ray overrides the user-specified
   /// retry count for a task (e.g., a task belonging to a dead actor).
   /// Unlike `MarkTaskCanceled`, this does not mark the task as canceled—`ray.get()` will
@@ -0,0 +1,129 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/core_worker/task_stage_tracer.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "ray/common/ray_config.h"
+
+namespace ray {
+namespace core {
+namespace worker {
+
+namespace {
+
+/// Modulus of the task id hash compared against the sample rate. Large enough
+/// that small rates still resolve to a non-empty sample.
+constexpr uint64_t kSampleModulus = 1 << 20;
+
+std::string StageName(uint8_t from, uint8_t to) {
+  return rpc::TaskStatus_Name(static_cast<rpc::TaskStatus>(from)) + "-" +
+         rpc::TaskStatus_Name(static_cast<rpc::TaskStatus>(to));
+}
+
+}  // namespace
+
+void TaskStageTracer::RecordStatusChange(const TaskID &task_id,
+                                         int32_t attempt_number,
+                                         bool is_actor_task,
+                                         rpc::TaskStatus status,
+                                         int64_t timestamp_ns) {
+  const double sample_rate = RayConfig::instance().task_stage_trace_sample_rate();
+  if (sample_rate <= 0.0) {
+    return;
+  }
+  // Deterministic per-task sampling: every transition of a sampled attempt
+  // must land in the same trace, so select by task id rather than counting
+  // transitions.
+  const auto threshold =
+      static_cast<uint64_t>(std::min(sample_rate, 1.0) * kSampleModulus);
+  if (task_id.Hash() % kSampleModulus >= threshold) {
+    return;
+  }
+
+  const bool is_terminal =
+      status == rpc::TaskStatus::FINISHED || status == rpc::TaskStatus::FAILED;
+  AttemptTrace finished_trace;
+  bool flush = false;
+  {
+    absl::MutexLock lock(&mutex_);
+    auto it = pending_traces_.find({task_id, attempt_number});
+    if (it == pending_traces_.end()) {
+      if (pending_traces_.size() >= kMaxPendingTraces) {
+        return;
+      }
+      it = pending_traces_
+               .emplace(std::make_pair(task_id, attempt_number), AttemptTrace())
+               .first;
+      it->second.is_actor_task = is_actor_task;
+    }
+    auto &trace = it->second;
+    if (trace.num_transitions < AttemptTrace::kMaxTransitions) {
+      trace.status[trace.num_transitions] = static_cast<uint8_t>(status);
+      trace.timestamp_ns[trace.num_transitions] = timestamp_ns;
+      ++trace.num_transitions;
+    }
+    if (is_terminal) {
+      finished_trace = trace;
+      pending_traces_.erase(it);
+      flush = true;
+    }
+  }
+  if (flush) {
+    Flush(finished_trace);
+  }
+}
+
+void TaskStageTracer::Flush(const AttemptTrace &trace) {
+  const char *type = trace.is_actor_task ? "ACTOR_TASK" : "NORMAL_TASK";
+  for (size_t i = 1; i < trace.num_transitions; ++i) {
+    const int64_t duration_ns = trace.timestamp_ns[i] - trace.timestamp_ns[i - 1];
+    if (duration_ns < 0) {
+      // Transitions recorded from different threads can race by a few
+      // microseconds; skip rather than export a negative duration.
+      continue;
+    }
+    std::string stage = StageName(trace.status[i - 1], trace.status[i]);
+    stage_time_ms_histogram_metric_.Record(
+        static_cast<double>(duration_ns) / 1e6,
+        {{"Stage", stage}, {"Type", std::string(type)}});
+    absl::MutexLock lock(&mutex_);
+    auto &stage_stats = stats_[std::move(stage)];
+    ++stage_stats.count;
+    stage_stats.sum_ns += duration_ns;
+    stage_stats.max_ns = std::max(stage_stats.max_ns, duration_ns);
+  }
+}
+
+std::string TaskStageTracer::StatsString() const {
+  absl::MutexLock lock(&mutex_);
+  if (stats_.empty()) {
+    return "";
+  }
+  std::stringstream out;
+  out << "TaskStageTracer sampled stage latencies (ms):";
+  for (const auto &[stage, stage_stats] : stats_) {
+    out << "\n  " << stage << ": count=" << stage_stats.count << ", mean="
+        << (static_cast<double>(stage_stats.sum_ns) / stage_stats.count) / 1e6
+        << ", max=" << static_cast<double>(stage_stats.max_ns) / 1e6;
+  }
+  return out.str();
+}
+
+}  // namespace worker
+}  // namespace core
+}  // namespace ray
@@ -0,0 +1,111 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "ray/common/id.h"
+#include "ray/core_worker/metrics.h"
+#include "src/ray/protobuf/common.pb.h"
+
+namespace ray {
+namespace core {
+namespace worker {
+
+/// Samples a fraction of task attempts and turns the status timestamps this
+/// worker already records into per-stage latency histograms, so that a P99
+/// task latency regression can be attributed to dependency resolution,
+/// scheduling, dispatch, or execution without attaching an external tracer.
+///
+/// Each sampled attempt keeps a fixed-size trace record of the status
+/// transitions observed on this worker: the owner sees submission through
+/// scheduling and the terminal reply, while the executor sees receipt through
+/// execution, so each process exports the stages it is authoritative for.
+/// When the attempt reaches a terminal status, the durations between
+/// consecutive transitions are recorded into the exported histogram, tagged
+/// with the pair of statuses they span.
+///
+/// The sample rate is re-read from `task_stage_trace_sample_rate` on every
+/// transition, so tracing can be tuned, or disabled at runtime. Sampling is
+/// deterministic on the task id so all transitions of an attempt land in the
+/// same trace. An unsampled transition costs one config read and one hash.
+///
+/// Thread-safe.
+class TaskStageTracer {
+ public:
+  TaskStageTracer() = default;
+
+  /// Record one status transition for a task attempt. For sampled attempts,
+  /// appends to the attempt's trace record and, on a terminal status, flushes
+  /// the stage durations to the histogram.
+  void RecordStatusChange(const TaskID &task_id,
+                          int32_t attempt_number,
+                          bool is_actor_task,
+                          rpc::TaskStatus status,
+                          int64_t timestamp_ns);
+
+  /// A per-stage latency summary suitable for inclusion in the task event
+  /// buffer debug string. Empty when nothing has been sampled.
+  std::string StatsString() const ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  /// Trace record of one sampled attempt: the statuses seen on this worker
+  /// and when they were reached. Fixed size, so tracing a task costs one
+  /// cache line and no allocations.
+  struct AttemptTrace {
+    static constexpr size_t kMaxTransitions = 6;
+    std::array<int64_t, kMaxTransitions> timestamp_ns;
+    std::array<uint8_t, kMaxTransitions> status;
+    uint8_t num_transitions = 0;
+    bool is_actor_task = false;
+  };
+
+  struct StageStats {
+    int64_t count = 0;
+    int64_t sum_ns = 0;
+    int64_t max_ns = 0;
+  };
+
+  /// Upper bound on concurrently traced attempts. New samples are dropped
+  /// beyond this, so tasks that never reach a terminal status on this worker
+  /// cannot grow the map without bound.
+  static constexpr size_t kMaxPendingTraces = 4096;
+
+  /// Fold one finished trace into the aggregates and the exported metric.
+  void Flush(const AttemptTrace &trace) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  mutable absl::Mutex mutex_;
+
+  /// Trace records of sampled attempts that have not reached a terminal
+  /// status yet, keyed by (task id, attempt number).
+  absl::flat_hash_map<std::pair<TaskID, int32_t>, AttemptTrace> pending_traces_
+      ABSL_GUARDED_BY(mutex_);
+
+  /// Aggregated stage latencies keyed by the stage name, for StatsString().
+  absl::flat_hash_map<std::string, StageStats> stats_ ABSL_GUARDED_BY(mutex_);
+
+  ray::stats::Histogram stage_time_ms_histogram_metric_{
+      GetTaskStageTimeMsHistogramMetric()};
+};
+
+}  // namespace worker
+}  // namespace core
+}  // namespace ray
@@ -135,7 +135,7 @@ void ActorTaskSubmitter::SubmitActorCreationTask(TaskSpecification task_spec) {
             // task so just marking the task fails.
             task_manager_.CompletePendingTask(
                 task_id,
-                push_task_reply,
+                std::make_shared<rpc::PushTaskReply>(std::move(push_task_reply)),
                 reply.actor_address(),
                 /*is_application_error=*/create_actor_status.IsCreationTaskError());
           } else {
@@ -554,8 +554,10 @@ void ActorTaskSubmitter::SendPendingTasks(const ActorID &actor_id) {
             [this, task_spec = std::move(task.value().first)] {
               rpc::PushTaskReply reply;
               rpc::Address addr;
-              HandlePushTaskReply(
-                  Status::IOError("The actor is restarting."), reply, addr, task_spec);
+              HandlePushTaskReply(Status::IOError("The actor is restarting."),
+                                  std::move(reply),
+                                  addr,
+                                  task_spec);
             },
             "ActorTaskSubmitter::SendPendingTasks_ForceFail");
       }
@@ -602,8 +604,8 @@ void ActorTaskSubmitter::PushActorTask(ClientQueue &queue,
 
   auto &addr = queue.client_address_.value();
   rpc::ClientCallback<rpc::PushTaskReply> reply_callback =
-      [this, addr, task_spec](const Status &status, const rpc::PushTaskReply &reply) {
-        HandlePushTaskReply(status, reply, addr, task_spec);
+      [this, addr, task_spec](const Status &status, rpc::PushTaskReply &&reply) {
+        HandlePushTaskReply(status, std::move(reply), addr, task_spec);
       };
 
   const TaskAttempt task_attempt = std::make_pair(task_id, task_spec.AttemptNumber());
@@ -636,7 +638,7 @@ void ActorTaskSubmitter::PushActorTask(ClientQueue &queue,
 }
 
 void ActorTaskSubmitter::HandlePushTaskReply(const Status &status,
-                                             const rpc::PushTaskReply &reply,
+                                             rpc::PushTaskReply &&reply,
                                              const rpc::Address &addr,
                                              const TaskSpecification &task_spec) {
   const auto task_id = task_spec.TaskId();
@@ -688,8 +690,12 @@ void ActorTaskSubmitter::HandlePushTaskReply(const Status &status,
       task_manager_.FailPendingTask(
           task_id, rpc::ErrorType::TASK_CANCELLED, nullptr, &error_info);
     } else {
+      const bool is_application_error = reply.is_application_error();
       task_manager_.CompletePendingTask(
-          task_id, reply, addr, reply.is_application_error());
+          task_id,
+          std::make_shared<rpc::PushTaskReply>(std::move(reply)),
+          addr,
+          is_application_error);
     }
   } else {
     bool is_actor_dead = false;
@@ -749,8 +755,12 @@ void ActorTaskSubmitter::HandlePushTaskReply(const Status &status,
         // last failure = user exception, just complete it with failure.
         RAY_CHECK(reply.is_retryable_error());
 
+        const bool is_application_error = reply.is_application_error();
         task_manager_.CompletePendingTask(
-            task_id, reply, addr, reply.is_application_error());
+            task_id,
+            std::make_shared<rpc::PushTaskReply>(std::move(reply)),
+            addr,
+            is_application_error);
 
       } else if (RayConfig::instance().timeout_ms_task_wait_for_death_info() != 0) {
         // last failure = Actor death, but we still see the actor "alive" so we
@@ -937,8 +947,9 @@ void ActorTaskSubmitter::RetryCancelTask(TaskSpecification task_spec, bool recur
   auto delay_ms = RayConfig::instance().cancellation_retry_ms();
   RAY_LOG(DEBUG).WithField(task_spec.TaskId())
       << "Task cancelation will be retried in " << delay_ms << " ms";
-  execute_after(
+  execute_after_coalesced(
       io_service_,
+      timer_wheel_,
       [this, task_spec = std::move(task_spec), recursive] {
         CancelTask(task_spec, recursive);
       },
@@ -24,6 +24,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/synchronization/mutex.h"
+#include "ray/common/asio/timer_wheel.h"
 #include "ray/common/id.h"
 #include "ray/core_worker/actor_management/actor_creator.h"
 #include "ray/core_worker/reference_counter_interface.h"
@@ -88,6 +89,12 @@ class ActorTaskSubmitter : public ActorTaskSubmitterInterface {
         next_queueing_warn_threshold_(
             ::RayConfig::instance().actor_excess_queueing_warn_threshold()),
         io_service_(io_service),
+        timer_wheel_(RayConfig::instance().core_worker_use_timer_wheel()
+                         ? TimerWheel::Create(
+                               io_service,
+                               RayConfig::instance().timer_wheel_resolution_ms(),
+                               RayConfig::instance().timer_wheel_num_slots())
+                         : nullptr),
         reference_counter_(std::move(reference_counter)) {}
 
   void SetPreempted(const ActorID &actor_id) override {
@@ -383,8 +390,10 @@ class ActorTaskSubmitter : public ActorTaskSubmitterInterface {
                      const TaskSpecification &task_spec,
                      bool skip_queue) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  /// Takes ownership of the reply so it can be handed off to the task manager
+  /// without copying when the task completes successfully.
   void HandlePushTaskReply(const Status &status,
-                           const rpc::PushTaskReply &reply,
+                           rpc::PushTaskReply &&reply,
                            const rpc::Address &addr,
                            const TaskSpecification &task_spec) ABSL_LOCKS_EXCLUDED(mu_);
 
@@ -455,6 +464,11 @@ class ActorTaskSubmitter : public ActorTaskSubmitterInterface {
   /// The event loop where the actor task events are handled.
   instrumented_io_context &io_service_;
 
+  /// Shared timer wheel that coalesces cancellation retry timers. Created
+  /// only when core_worker_use_timer_wheel is enabled; nullptr otherwise, in
+  /// which case each timer gets its own asio deadline timer.
+  std::shared_ptr<TimerWheel> timer_wheel_;
+
   std::shared_ptr<ReferenceCounterInterface> reference_counter_;
 };
 
@@ -118,6 +118,8 @@ void LocalDependencyResolver::ResolveDependencies(
   }
 
   const auto &task_id = task.TaskId();
+  // Objects with no fetch in flight yet; only these need a GetAsync call.
+  std::vector<ObjectID> objects_to_fetch;
   {
     absl::MutexLock lock(&mu_);
     // This is deleted when the last dependency fetch callback finishes.
@@ -128,47 +130,59 @@ void LocalDependencyResolver::ResolveDependencies(
                                     actor_dependency_ids,
                                     std::move(on_dependencies_resolved)));
     RAY_CHECK(inserted.second);
+    for (const auto &obj_id : local_dependency_ids) {
+      auto &waiters = pending_object_waiters_[obj_id];
+      if (waiters.empty()) {
+        objects_to_fetch.push_back(obj_id);
+      }
+      waiters.push_back(task_id);
+    }
   }
 
-  for (const auto &obj_id : local_dependency_ids) {
-    in_memory_store_.GetAsync(
-        obj_id, [this, task_id, obj_id](std::shared_ptr<RayObject> obj) {
-          RAY_CHECK(obj != nullptr);
-
-          std::unique_ptr<TaskState> resolved_task_state = nullptr;
-          std::vector<ObjectID> inlined_dependency_ids;
-          std::vector<ObjectID> contained_ids;
-          {
-            absl::MutexLock lock(&mu_);
-
-            auto it = pending_tasks_.find(task_id);
-            // The dependency resolution for the task has been cancelled.
-            if (it == pending_tasks_.end()) {
-              return;
-            }
-            auto &state = it->second;
-            state->local_dependencies[obj_id] = std::move(obj);
-            if (--state->obj_dependencies_remaining == 0) {
-              InlineDependencies(state->local_dependencies,
-                                 state->task,
-                                 &inlined_dependency_ids,
-                                 &contained_ids,
-                                 tensor_transport_getter_);
-              if (state->actor_dependencies_remaining == 0) {
-                resolved_task_state = std::move(state);
-                pending_tasks_.erase(it);
-              }
+  for (const auto &obj_id : objects_to_fetch) {
+    in_memory_store_.GetAsync(obj_id, [this, obj_id](std::shared_ptr<RayObject> obj) {
+      RAY_CHECK(obj != nullptr);
+
+      std::vector<std::unique_ptr<TaskState>> resolved_task_states;
+      std::vector<ObjectID> inlined_dependency_ids;
+      std::vector<ObjectID> contained_ids;
+      {
+        absl::MutexLock lock(&mu_);
+
+        auto waiter_it = pending_object_waiters_.find(obj_id);
+        RAY_CHECK(waiter_it != pending_object_waiters_.end());
+        auto waiting_tasks = std::move(waiter_it->second);
+        pending_object_waiters_.erase(waiter_it);
+
+        for (const auto &waiting_task_id : waiting_tasks) {
+          auto it = pending_tasks_.find(waiting_task_id);
+          // The dependency resolution for the task has been cancelled.
+          if (it == pending_tasks_.end()) {
+            continue;
+          }
+          auto &state = it->second;
+          state->local_dependencies[obj_id] = obj;
+          if (--state->obj_dependencies_remaining == 0) {
+            InlineDependencies(state->local_dependencies,
+                               state->task,
+                               &inlined_dependency_ids,
+                               &contained_ids,
+                               tensor_transport_getter_);
+            if (state->actor_dependencies_remaining == 0) {
+              resolved_task_states.push_back(std::move(state));
+              pending_tasks_.erase(it);
             }
           }
+        }
+      }
 
-          if (!inlined_dependency_ids.empty()) {
-            task_manager_.OnTaskDependenciesInlined(inlined_dependency_ids,
-                                                    contained_ids);
-          }
-          if (resolved_task_state) {
-            resolved_task_state->on_dependencies_resolved_(resolved_task_state->status);
-          }
-        });
+      if (!inlined_dependency_ids.empty()) {
+        task_manager_.OnTaskDependenciesInlined(inlined_dependency_ids, contained_ids);
+      }
+      for (const auto &resolved_task_state : resolved_task_states) {
+        resolved_task_state->on_dependencies_resolved_(resolved_task_state->status);
+      }
+    });
   }
 
   for (const auto &actor_id : actor_dependency_ids) {
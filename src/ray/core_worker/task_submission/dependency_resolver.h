@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
@@ -120,6 +121,12 @@ class LocalDependencyResolver {
   absl::flat_hash_map<TaskID, std::unique_ptr<TaskState>> pending_tasks_
       ABSL_GUARDED_BY(mu_);
 
+  /// Tasks waiting on an in-flight memory store fetch, keyed by the object
+  /// fetched. Only one GetAsync is issued per object no matter how many tasks
+  /// depend on it; the fetch callback fans out to all waiting tasks.
+  absl::flat_hash_map<ObjectID, std::vector<TaskID>> pending_object_waiters_
+      ABSL_GUARDED_BY(mu_);
+
   /// Protects against concurrent access to internal state.
   mutable absl::Mutex mu_;
 };
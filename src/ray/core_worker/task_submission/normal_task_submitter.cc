@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +33,14 @@
 namespace ray {
 namespace core {
 
+namespace {
+
+// Number of completed-task runtimes kept per scheduling class for the hedge
+// delay quantile.
+constexpr size_t kHedgeSampleWindowSize = 64;
+
+}  // namespace
+
 void NormalTaskSubmitter::SubmitTask(TaskSpecification task_spec) {
   RAY_CHECK(task_spec.IsNormalTask());
   RAY_LOG(DEBUG) << "Submit task " << task_spec.TaskId();
@@ -163,7 +172,17 @@ void NormalTaskSubmitter::OnWorkerIdle(
 
     // Return the worker only if there are no tasks to do.
     if (!lease_entry.is_busy) {
-      ReturnWorkerLease(addr, was_error, error_detail, worker_exiting, scheduling_key);
+      const bool can_keep_warm = lease_keep_warm_ms_ > 0 && !was_error &&
+                                 !worker_exiting &&
+                                 current_time_ms() <= lease_entry.lease_expiration_time;
+      if (can_keep_warm) {
+        // The worker is healthy and only idle because the queue drained. Hold
+        // on to the lease for a while in case more tasks with this scheduling
+        // class arrive.
+        ScheduleKeepWarmLeaseReturn(addr);
+      } else {
+        ReturnWorkerLease(addr, was_error, error_detail, worker_exiting, scheduling_key);
+      }
     }
   } else {
     auto client = core_worker_client_pool_->GetOrConnect(addr);
@@ -182,9 +201,31 @@ void NormalTaskSubmitter::OnWorkerIdle(
       task_spec.GetMutableMessage().set_lease_grant_timestamp_ms(current_sys_time_ms());
       task_spec.EmitTaskMetrics(scheduler_placement_time_ms_histogram_);
 
-      executing_tasks_.emplace(task_spec.TaskId(), addr);
-      PushNormalTask(
-          addr, client, scheduling_key, std::move(task_spec), assigned_resources);
+      bool is_hedged_attempt = false;
+      auto hedge_it = hedged_tasks_.find(task_spec.TaskId());
+      if (hedge_it != hedged_tasks_.end() && !hedge_it->second.duplicate_dispatched) {
+        // This is the duplicate copy of a hedged straggler. The primary
+        // attempt keeps the executing_tasks_ entry.
+        auto &hedge = hedge_it->second;
+        hedge.duplicate_dispatched = true;
+        hedge.duplicate_inflight = true;
+        hedge.duplicate_addr = addr;
+        is_hedged_attempt = true;
+      } else {
+        executing_tasks_.emplace(task_spec.TaskId(), addr);
+      }
+      int64_t hedge_delay_ms = -1;
+      if (hedging_enabled_ && !is_hedged_attempt && task_spec.MaxRetries() != 0 &&
+          !task_spec.ReturnsDynamic() && !task_spec.IsStreamingGenerator()) {
+        hedge_delay_ms = HedgeDelayMs(std::get<0>(scheduling_key));
+      }
+      PushNormalTask(addr,
+                     client,
+                     scheduling_key,
+                     std::move(task_spec),
+                     assigned_resources,
+                     is_hedged_attempt,
+                     hedge_delay_ms);
     }
 
     CancelWorkerLeaseIfNeeded(scheduling_key);
@@ -192,6 +233,53 @@ void NormalTaskSubmitter::OnWorkerIdle(
   RequestNewWorkerIfNeeded(scheduling_key);
 }
 
+void NormalTaskSubmitter::ScheduleKeepWarmLeaseReturn(const rpc::Address &addr) {
+  auto &lease_entry = worker_to_lease_entry_[addr];
+  if (lease_entry.keep_warm_return_scheduled) {
+    return;
+  }
+  lease_entry.keep_warm_return_scheduled = true;
+  RAY_LOG(DEBUG) << "Keeping idle worker " << WorkerID::FromBinary(addr.worker_id())
+                 << " warm for " << lease_keep_warm_ms_ << "ms";
+  execute_after_coalesced(
+      io_service_,
+      timer_wheel_,
+      [this, addr] {
+        absl::MutexLock lock(&mu_);
+        auto it = worker_to_lease_entry_.find(addr);
+        if (it == worker_to_lease_entry_.end()) {
+          // The lease was already returned (e.g. due to an error on another
+          // code path).
+          return;
+        }
+        auto &entry = it->second;
+        entry.keep_warm_return_scheduled = false;
+        if (entry.is_busy) {
+          // The worker picked up a task while it was kept warm. A new
+          // keep-warm period starts when it next becomes idle.
+          return;
+        }
+        const SchedulingKey scheduling_key = entry.scheduling_key;
+        if (!scheduling_key_entries_[scheduling_key].task_queue.empty()) {
+          // More work arrived for this scheduling class; dispatch it to the
+          // warm worker instead of returning the lease.
+          OnWorkerIdle(addr,
+                       scheduling_key,
+                       /*was_error=*/false,
+                       /*error_detail=*/"",
+                       /*worker_exiting=*/false,
+                       entry.assigned_resources);
+          return;
+        }
+        ReturnWorkerLease(addr,
+                          /*was_error=*/false,
+                          /*error_detail=*/"",
+                          /*worker_exiting=*/false,
+                          scheduling_key);
+      },
+      std::chrono::milliseconds(lease_keep_warm_ms_));
+}
+
 void NormalTaskSubmitter::CancelWorkerLeaseIfNeeded(const SchedulingKey &scheduling_key) {
   auto &scheduling_key_entry = scheduling_key_entries_[scheduling_key];
   auto &task_queue = scheduling_key_entry.task_queue;
@@ -504,11 +592,14 @@ void NormalTaskSubmitter::PushNormalTask(
     std::shared_ptr<rpc::CoreWorkerClientInterface> client,
     const SchedulingKey &scheduling_key,
     TaskSpecification task_spec,
-    const google::protobuf::RepeatedPtrField<rpc::ResourceMapEntry> &assigned_resources) {
+    const google::protobuf::RepeatedPtrField<rpc::ResourceMapEntry> &assigned_resources,
+    bool is_hedged_attempt,
+    int64_t hedge_delay_ms) {
   RAY_LOG(DEBUG) << "Pushing task " << task_spec.TaskId() << " to worker "
                  << WorkerID::FromBinary(addr.worker_id()) << " of raylet "
                  << NodeID::FromBinary(addr.node_id());
   auto task_id = task_spec.TaskId();
+  const int64_t dispatch_time_ms = current_time_ms();
   auto request = std::make_unique<rpc::PushTaskRequest>();
   // NOTE(swang): CopyFrom is needed because if we use Swap here and the task
   // fails, then the task data will be gone when the TaskManager attempts to
@@ -516,9 +607,29 @@ void NormalTaskSubmitter::PushNormalTask(
   request->mutable_task_spec()->CopyFrom(task_spec.GetMessage());
   request->mutable_resource_mapping()->CopyFrom(assigned_resources);
   request->set_intended_worker_id(addr.worker_id());
-  task_manager_.MarkTaskWaitingForExecution(task_id,
-                                            NodeID::FromBinary(addr.node_id()),
-                                            WorkerID::FromBinary(addr.worker_id()));
+  for (size_t i = 0; i < task_spec.NumReturns(); i++) {
+    const auto return_id = task_spec.ReturnId(i);
+    auto forward_dest = task_manager_.GetResultForwardDestination(return_id);
+    if (forward_dest.has_value()) {
+      auto *dest = request->add_result_forward_destinations();
+      dest->set_object_id(return_id.Binary());
+      dest->mutable_address()->CopyFrom(*forward_dest);
+    }
+  }
+  if (!is_hedged_attempt) {
+    task_manager_.MarkTaskWaitingForExecution(task_id,
+                                              NodeID::FromBinary(addr.node_id()),
+                                              WorkerID::FromBinary(addr.worker_id()));
+  }
+  if (hedge_delay_ms >= 0) {
+    execute_after_coalesced(
+        io_service_,
+        timer_wheel_,
+        [this, task_spec, scheduling_key, addr] {
+          MaybeHedgeTask(task_spec, scheduling_key, addr);
+        },
+        std::chrono::milliseconds(hedge_delay_ms));
+  }
   client->PushNormalTask(
       std::move(request),
       [this,
@@ -526,14 +637,24 @@ void NormalTaskSubmitter::PushNormalTask(
        task_id,
        scheduling_key,
        addr,
-       assigned_resources](Status status, const rpc::PushTaskReply &reply) {
+       assigned_resources,
+       is_hedged_attempt,
+       dispatch_time_ms](Status status, rpc::PushTaskReply &&reply) {
         bool resubmit_generator = false;
+        // Whether to hand this reply to the task manager. Only false for a
+        // hedged task whose other attempt already delivered, or whose other
+        // attempt is still in flight and could still win after this one
+        // failed.
+        bool deliver_reply = true;
+        std::optional<rpc::Address> hedge_loser_addr;
         {
           RAY_LOG(DEBUG) << "Task " << task_id << " finished from worker "
                          << WorkerID::FromBinary(addr.worker_id()) << " of raylet "
                          << NodeID::FromBinary(addr.node_id());
           absl::MutexLock lock(&mu_);
-          executing_tasks_.erase(task_id);
+          if (!is_hedged_attempt) {
+            executing_tasks_.erase(task_id);
+          }
 
           resubmit_generator = generators_to_resubmit_.erase(task_id) > 0;
 
@@ -549,7 +670,41 @@ void NormalTaskSubmitter::PushNormalTask(
           RAY_CHECK_GE(scheduling_key_entry.num_busy_workers, 1u);
           scheduling_key_entry.num_busy_workers--;
 
-          if (!status.ok()) {
+          auto hedge_it = hedged_tasks_.find(task_id);
+          if (hedge_it != hedged_tasks_.end()) {
+            auto &hedge = hedge_it->second;
+            if (is_hedged_attempt) {
+              hedge.duplicate_inflight = false;
+            } else {
+              hedge.primary_inflight = false;
+            }
+            const bool other_inflight =
+                is_hedged_attempt ? hedge.primary_inflight : hedge.duplicate_inflight;
+            deliver_reply = !hedge.completed && (status.ok() || !other_inflight);
+            if (deliver_reply) {
+              hedge.completed = true;
+              if (!hedge.duplicate_dispatched) {
+                // The duplicate never left the queue; drop it so it isn't
+                // executed after the task already finished.
+                RemoveQueuedHedgeDuplicate(scheduling_key, task_id);
+              } else if (other_inflight) {
+                auto exec_it = executing_tasks_.find(task_id);
+                hedge_loser_addr = is_hedged_attempt && exec_it != executing_tasks_.end()
+                                       ? exec_it->second
+                                       : hedge.duplicate_addr;
+              }
+            }
+            if (!hedge.primary_inflight && !hedge.duplicate_inflight) {
+              hedged_tasks_.erase(hedge_it);
+            }
+          }
+
+          if (hedging_enabled_ && status.ok() && deliver_reply) {
+            RecordTaskDuration(std::get<0>(scheduling_key),
+                               current_time_ms() - dispatch_time_ms);
+          }
+
+          if (!status.ok() && deliver_reply) {
             failed_tasks_pending_failure_cause_.insert(task_id);
             RAY_LOG(DEBUG) << "Getting error from raylet for task " << task_id;
             const ray::rpc::ClientCallback<ray::rpc::GetWorkerFailureCauseReply>
@@ -585,7 +740,10 @@ void NormalTaskSubmitter::PushNormalTask(
                        /*worker_exiting=*/reply.worker_exiting(),
                        assigned_resources);
         }
-        if (status.ok()) {
+        if (hedge_loser_addr.has_value()) {
+          CancelHedgedAttempt(task_spec, *hedge_loser_addr);
+        }
+        if (status.ok() && deliver_reply) {
           if (reply.was_cancelled_before_running()) {
             RAY_LOG(DEBUG) << "Task " << task_id
                            << " was cancelled before it started running.";
@@ -600,13 +758,130 @@ void NormalTaskSubmitter::PushNormalTask(
                          task_id,
                          gcs::GetRayErrorInfo(rpc::ErrorType::TASK_EXECUTION_EXCEPTION,
                                               reply.task_execution_error()))) {
+            const bool is_application_error = reply.is_application_error();
             task_manager_.CompletePendingTask(
-                task_id, reply, addr, reply.is_application_error());
+                task_id,
+                std::make_shared<rpc::PushTaskReply>(std::move(reply)),
+                addr,
+                is_application_error);
           }
         }
       });
 }
 
+void NormalTaskSubmitter::MaybeHedgeTask(const TaskSpecification &task_spec,
+                                         const SchedulingKey &scheduling_key,
+                                         const rpc::Address &addr) {
+  absl::MutexLock lock(&mu_);
+  const auto task_id = task_spec.TaskId();
+  auto executing_it = executing_tasks_.find(task_id);
+  if (executing_it == executing_tasks_.end() ||
+      executing_it->second.worker_id() != addr.worker_id()) {
+    // The attempt we timed already finished.
+    return;
+  }
+  if (hedged_tasks_.contains(task_id) || cancelled_tasks_.contains(task_id) ||
+      failed_tasks_pending_failure_cause_.contains(task_id)) {
+    return;
+  }
+  if (hedged_tasks_.size() >=
+      static_cast<size_t>(RayConfig::instance().normal_task_hedging_max_concurrent())) {
+    return;
+  }
+  RAY_LOG(DEBUG) << "Submitting hedged duplicate for straggling task " << task_id
+                 << " executing on raylet " << NodeID::FromBinary(addr.node_id());
+  hedged_tasks_.emplace(task_id, HedgeState());
+  auto &scheduling_key_entry = scheduling_key_entries_[scheduling_key];
+  scheduling_key_entry.task_queue.push_back(task_spec);
+  // Prefer dispatching the duplicate to an idle worker on a different node
+  // than the straggling attempt; otherwise fall through to a fresh lease
+  // request, which the raylet places with an up-to-date view of the cluster.
+  for (const auto &active_worker_addr : scheduling_key_entry.active_workers) {
+    if (active_worker_addr.node_id() == addr.node_id()) {
+      continue;
+    }
+    auto iter = worker_to_lease_entry_.find(active_worker_addr);
+    RAY_CHECK(iter != worker_to_lease_entry_.end());
+    if (!iter->second.is_busy) {
+      OnWorkerIdle(active_worker_addr,
+                   scheduling_key,
+                   /*was_error=*/false,
+                   /*error_detail=*/"",
+                   /*worker_exiting=*/false,
+                   iter->second.assigned_resources);
+      return;
+    }
+  }
+  RequestNewWorkerIfNeeded(scheduling_key);
+}
+
+void NormalTaskSubmitter::CancelHedgedAttempt(TaskSpecification task_spec,
+                                              const rpc::Address &addr) {
+  RAY_LOG(DEBUG) << "Cancelling losing hedged attempt of task " << task_spec.TaskId()
+                 << " on worker " << WorkerID::FromBinary(addr.worker_id());
+  const auto node_id = NodeID::FromBinary(addr.node_id());
+  const std::string executor_worker_id = addr.worker_id();
+  auto do_cancel = [this, task_spec = std::move(task_spec), executor_worker_id](
+                       const rpc::Address &raylet_address) {
+    rpc::CancelLocalTaskRequest request;
+    request.set_intended_task_id(task_spec.TaskIdBinary());
+    request.set_force_kill(false);
+    request.set_recursive(false);
+    request.set_caller_worker_id(task_spec.CallerWorkerIdBinary());
+    request.set_executor_worker_id(executor_worker_id);
+    auto raylet_client = raylet_client_pool_->GetOrConnectByAddress(raylet_address);
+    raylet_client->CancelLocalTask(
+        request, [](const Status &status, const rpc::CancelLocalTaskReply &reply) {
+          // Best effort: if the cancel misses, the losing attempt runs to
+          // completion and its reply is dropped.
+        });
+  };
+  SendCancelLocalTask(gcs_client_, node_id, std::move(do_cancel), []() {});
+}
+
+void NormalTaskSubmitter::RemoveQueuedHedgeDuplicate(const SchedulingKey &scheduling_key,
+                                                     const TaskID &task_id) {
+  auto it = scheduling_key_entries_.find(scheduling_key);
+  if (it == scheduling_key_entries_.end()) {
+    return;
+  }
+  auto &task_queue = it->second.task_queue;
+  for (auto spec = task_queue.begin(); spec != task_queue.end(); spec++) {
+    if (spec->TaskId() == task_id) {
+      task_queue.erase(spec);
+      CancelWorkerLeaseIfNeeded(scheduling_key);
+      return;
+    }
+  }
+}
+
+int64_t NormalTaskSubmitter::HedgeDelayMs(SchedulingClass scheduling_class) const {
+  auto it = task_durations_.find(scheduling_class);
+  if (it == task_durations_.end() ||
+      it->second.samples_ms.size() <
+          static_cast<size_t>(RayConfig::instance().normal_task_hedging_min_samples())) {
+    return -1;
+  }
+  auto samples = it->second.samples_ms;
+  const double quantile =
+      std::clamp<double>(RayConfig::instance().normal_task_hedging_quantile(), 0., 1.);
+  const size_t rank =
+      std::min(samples.size() - 1, static_cast<size_t>(quantile * samples.size()));
+  std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+  return samples[rank];
+}
+
+void NormalTaskSubmitter::RecordTaskDuration(SchedulingClass scheduling_class,
+                                             int64_t duration_ms) {
+  auto &window = task_durations_[scheduling_class];
+  if (window.samples_ms.size() < kHedgeSampleWindowSize) {
+    window.samples_ms.push_back(duration_ms);
+  } else {
+    window.samples_ms[window.next_slot] = duration_ms;
+    window.next_slot = (window.next_slot + 1) % kHedgeSampleWindowSize;
+  }
+}
+
 bool NormalTaskSubmitter::HandleGetWorkerFailureCause(
     const Status &task_execution_status,
     const TaskID &task_id,
@@ -694,6 +969,12 @@ void NormalTaskSubmitter::CancelTask(TaskSpecification task_spec,
     if (!scheduling_tasks.empty()) {
       for (auto spec = scheduling_tasks.begin(); spec != scheduling_tasks.end(); spec++) {
         if (spec->TaskId() == task_id) {
+          if (hedged_tasks_.contains(task_id)) {
+            // The queued copy is the hedged duplicate of an executing task;
+            // drop it and fall through to cancel the executing attempt.
+            scheduling_tasks.erase(spec);
+            break;
+          }
           scheduling_tasks.erase(spec);
           CancelWorkerLeaseIfNeeded(scheduling_key);
           task_manager_.FailPendingTask(task_id, rpc::ErrorType::TASK_CANCELLED);
@@ -767,8 +1048,9 @@ void NormalTaskSubmitter::CancelTask(TaskSpecification task_spec,
           }
           if (!reply.attempt_succeeded()) {
             if (reply.requested_task_running()) {
-              execute_after(
+              execute_after_coalesced(
                   io_service_,
+                  timer_wheel_,
                   [this, task_spec = std::move(task_spec), force_kill, recursive] {
                     CancelTask(task_spec, force_kill, recursive);
                   },
@@ -24,7 +24,9 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "ray/common/asio/timer_wheel.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/core_worker/lease_policy.h"
 #include "ray/core_worker/store_provider/memory_store/memory_store.h"
 #include "ray/core_worker/task_manager_interface.h"
@@ -118,6 +120,12 @@ class NormalTaskSubmitter {
         job_id_(job_id),
         lease_request_rate_limiter_(std::move(lease_request_rate_limiter)),
         io_service_(io_service),
+        timer_wheel_(RayConfig::instance().core_worker_use_timer_wheel()
+                         ? TimerWheel::Create(
+                               io_service,
+                               RayConfig::instance().timer_wheel_resolution_ms(),
+                               RayConfig::instance().timer_wheel_num_slots())
+                         : nullptr),
         scheduler_placement_time_ms_histogram_(scheduler_placement_time_ms_histogram) {}
 
   /// Schedule a task for direct submission to a worker.
@@ -199,6 +207,13 @@ class NormalTaskSubmitter {
   void CancelWorkerLeaseIfNeeded(const SchedulingKey &scheduling_key)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  /// Keep an idle leased worker warm instead of returning it right away:
+  /// schedule a delayed return that only fires if the worker is still idle
+  /// and its scheduling class still has no queued tasks when the keep-warm
+  /// period expires. Only used when normal_task_lease_keep_warm_ms > 0.
+  void ScheduleKeepWarmLeaseReturn(const rpc::Address &addr)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   /// Set up client state for newly granted worker lease.
   void AddWorkerLeaseClient(
       const rpc::Address &worker_address,
@@ -226,12 +241,48 @@ class NormalTaskSubmitter {
   }
 
   /// Push a task to a specific worker.
+  ///
+  /// \param[in] is_hedged_attempt Whether this push is the duplicate copy of
+  /// a hedged straggler. Duplicate attempts skip the task manager state
+  /// transitions owned by the primary attempt.
+  /// \param[in] hedge_delay_ms If nonnegative, schedule a hedge timer that
+  /// submits a duplicate copy if the task is still executing after this many
+  /// milliseconds.
   void PushNormalTask(const rpc::Address &addr,
                       std::shared_ptr<rpc::CoreWorkerClientInterface> client,
                       const SchedulingKey &task_queue_key,
                       TaskSpecification task_spec,
                       const google::protobuf::RepeatedPtrField<rpc::ResourceMapEntry>
-                          &assigned_resources);
+                          &assigned_resources,
+                      bool is_hedged_attempt = false,
+                      int64_t hedge_delay_ms = -1);
+
+  /// Submit a duplicate copy of a straggling task through the regular lease
+  /// machinery if the primary attempt is still executing. Called when a hedge
+  /// timer scheduled by PushNormalTask fires.
+  void MaybeHedgeTask(const TaskSpecification &task_spec,
+                      const SchedulingKey &scheduling_key,
+                      const rpc::Address &addr) ABSL_LOCKS_EXCLUDED(mu_);
+
+  /// Best-effort cancellation of the losing attempt of a hedged task after
+  /// the winning attempt's reply was handed to the task manager.
+  void CancelHedgedAttempt(TaskSpecification task_spec, const rpc::Address &addr);
+
+  /// Remove a queued, not yet dispatched duplicate of a hedged task from its
+  /// scheduling queue.
+  void RemoveQueuedHedgeDuplicate(const SchedulingKey &scheduling_key,
+                                  const TaskID &task_id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// The hedge delay for a scheduling class: the configured runtime quantile
+  /// over the window of recently completed tasks, or -1 if there are not
+  /// enough samples yet.
+  int64_t HedgeDelayMs(SchedulingClass scheduling_class) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// Record the runtime of a completed attempt for hedging decisions.
+  void RecordTaskDuration(SchedulingClass scheduling_class, int64_t duration_ms)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   /// Handles result from GetWorkerFailureCause.
   /// \return true if the task executing on the worker should be retried, false otherwise.
@@ -300,6 +351,9 @@ class NormalTaskSubmitter {
     SchedulingKey scheduling_key;
     LeaseID lease_id;
     bool is_busy = false;
+    // Whether a delayed keep-warm return is already scheduled for this
+    // worker, to avoid stacking timers while it sits idle.
+    bool keep_warm_return_scheduled = false;
   };
 
   // Map from worker address to a LeaseEntry struct containing the lease's metadata.
@@ -369,12 +423,57 @@ class NormalTaskSubmitter {
   // should be retried or permanently failed.
   absl::flat_hash_set<TaskID> failed_tasks_pending_failure_cause_ ABSL_GUARDED_BY(mu_);
 
+  /// State of a task with a hedged duplicate attempt. Created when the hedge
+  /// timer fires and erased once neither attempt has a push RPC in flight.
+  /// Only the first reply is handed to the task manager; the losing attempt's
+  /// reply is dropped and its worker simply returned.
+  struct HedgeState {
+    // The primary attempt's push RPC is still in flight.
+    bool primary_inflight = true;
+    // The duplicate was popped from the task queue and pushed to a worker.
+    bool duplicate_dispatched = false;
+    // The duplicate attempt's push RPC is still in flight.
+    bool duplicate_inflight = false;
+    // A reply for this task was already handed to the task manager.
+    bool completed = false;
+    // Where the duplicate attempt is executing, if dispatched.
+    rpc::Address duplicate_addr;
+  };
+
+  // Tasks that currently have a hedged duplicate queued or in flight.
+  absl::flat_hash_map<TaskID, HedgeState> hedged_tasks_ ABSL_GUARDED_BY(mu_);
+
+  /// Sliding window of recently completed task runtimes for one scheduling
+  /// class, used to compute the hedge delay quantile.
+  struct TaskDurationWindow {
+    std::vector<int64_t> samples_ms;
+    size_t next_slot = 0;
+  };
+
+  // Completed-task runtime windows, keyed by scheduling class. Only populated
+  // when hedging is enabled.
+  absl::flat_hash_map<SchedulingClass, TaskDurationWindow> task_durations_
+      ABSL_GUARDED_BY(mu_);
+
+  // Whether hedged execution of straggling tasks is enabled.
+  const bool hedging_enabled_ = RayConfig::instance().normal_task_hedging_enabled();
+
   // Ratelimiter controls the num of pending lease requests.
   std::shared_ptr<LeaseRequestRateLimiter> lease_request_rate_limiter_;
 
+  // How long to keep an idle leased worker before returning it to the raylet.
+  // 0 disables keep-warm and returns idle workers immediately.
+  const int64_t lease_keep_warm_ms_ =
+      RayConfig::instance().normal_task_lease_keep_warm_ms();
+
   // Retries cancelation requests if they were not successful.
   instrumented_io_context &io_service_;
 
+  /// Shared timer wheel that coalesces retry and keep-warm timers. Created
+  /// only when core_worker_use_timer_wheel is enabled; nullptr otherwise, in
+  /// which case each timer gets its own asio deadline timer.
+  std::shared_ptr<TimerWheel> timer_wheel_;
+
   ray::observability::MetricInterface &scheduler_placement_time_ms_histogram_;
 };
 
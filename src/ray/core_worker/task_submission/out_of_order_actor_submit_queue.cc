@@ -14,81 +14,144 @@
 
 #include "ray/core_worker/task_submission/out_of_order_actor_submit_queue.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 namespace ray {
 namespace core {
 
+namespace {
+// Initial ring capacity; grows geometrically when the live window outgrows it.
+constexpr size_t kInitialSlotCapacity = 64;
+}  // namespace
+
 OutofOrderActorSubmitQueue::OutofOrderActorSubmitQueue() {}
 
+OutofOrderActorSubmitQueue::Slot &OutofOrderActorSubmitQueue::SlotAt(
+    uint64_t position) {
+  return slots_[position & (slots_.size() - 1)];
+}
+
+const OutofOrderActorSubmitQueue::Slot &OutofOrderActorSubmitQueue::SlotAt(
+    uint64_t position) const {
+  return slots_[position & (slots_.size() - 1)];
+}
+
+void OutofOrderActorSubmitQueue::EnsureWindow(uint64_t position) {
+  const uint64_t new_base = std::min(base_position_, position);
+  const uint64_t new_end = std::max(end_position_, position + 1);
+  const uint64_t needed = new_end - new_base;
+  if (needed > slots_.size()) {
+    size_t new_capacity = std::max(kInitialSlotCapacity, slots_.size());
+    while (new_capacity < needed) {
+      new_capacity *= 2;
+    }
+    std::vector<Slot> new_slots(new_capacity);
+    for (uint64_t pos = base_position_; pos < end_position_; pos++) {
+      auto &slot = SlotAt(pos);
+      if (slot.state != SlotState::kEmpty) {
+        new_slots[pos & (new_capacity - 1)] = std::move(slot);
+      }
+    }
+    slots_ = std::move(new_slots);
+  }
+  base_position_ = new_base;
+  end_position_ = new_end;
+}
+
+void OutofOrderActorSubmitQueue::ReleaseSlot(uint64_t position) {
+  auto &slot = SlotAt(position);
+  if (slot.state == SlotState::kSending) {
+    num_sending_--;
+  }
+  slot.state = SlotState::kEmpty;
+  slot.spec = TaskSpecification();
+  num_tasks_--;
+  while (base_position_ < end_position_ &&
+         SlotAt(base_position_).state == SlotState::kEmpty) {
+    base_position_++;
+  }
+}
+
 void OutofOrderActorSubmitQueue::Emplace(uint64_t position,
                                          const TaskSpecification &spec) {
-  RAY_CHECK(!sending_queue_.contains(position));
-  RAY_CHECK(pending_queue_
-                .emplace(position, std::make_pair(spec, /*dependency_resolved*/ false))
-                .second);
+  if (num_tasks_ == 0) {
+    base_position_ = position;
+    end_position_ = position;
+    next_send_position_ = position;
+  }
+  EnsureWindow(position);
+  auto &slot = SlotAt(position);
+  RAY_CHECK(slot.state == SlotState::kEmpty);
+  slot.state = SlotState::kPending;
+  slot.spec = spec;
+  num_tasks_++;
 }
 
 bool OutofOrderActorSubmitQueue::Contains(uint64_t position) const {
-  return pending_queue_.contains(position) || sending_queue_.contains(position);
+  return position >= base_position_ && position < end_position_ &&
+         SlotAt(position).state != SlotState::kEmpty;
 }
 
 bool OutofOrderActorSubmitQueue::DependenciesResolved(uint64_t position) const {
-  auto it = pending_queue_.find(position);
-  if (it != pending_queue_.end()) {
-    return it->second.second;
-  }
-  auto rit = sending_queue_.find(position);
-  RAY_CHECK(rit != sending_queue_.end());
-  return rit->second.second;
+  RAY_CHECK(Contains(position));
+  return SlotAt(position).state == SlotState::kSending;
 }
 
 void OutofOrderActorSubmitQueue::MarkDependencyFailed(uint64_t position) {
-  pending_queue_.erase(position);
+  if (Contains(position) && SlotAt(position).state == SlotState::kPending) {
+    ReleaseSlot(position);
+  }
 }
 
 void OutofOrderActorSubmitQueue::MarkTaskCanceled(uint64_t position) {
-  pending_queue_.erase(position);
-  sending_queue_.erase(position);
+  if (Contains(position)) {
+    ReleaseSlot(position);
+  }
 }
 
-bool OutofOrderActorSubmitQueue::Empty() {
-  return pending_queue_.empty() && sending_queue_.empty();
-}
+bool OutofOrderActorSubmitQueue::Empty() { return num_tasks_ == 0; }
 
 void OutofOrderActorSubmitQueue::MarkDependencyResolved(uint64_t position) {
-  // move the task from pending_requests queue to sending_requests queue.
-  auto it = pending_queue_.find(position);
-  RAY_CHECK(it != pending_queue_.end());
-  auto spec = std::move(it->second.first);
-  pending_queue_.erase(it);
-
-  sending_queue_.emplace(position,
-                         std::make_pair(std::move(spec), /*dependency_resolved*/ true));
+  RAY_CHECK(Contains(position));
+  auto &slot = SlotAt(position);
+  RAY_CHECK(slot.state == SlotState::kPending);
+  slot.state = SlotState::kSending;
+  num_sending_++;
+  next_send_position_ = std::min(next_send_position_, position);
 }
 
 std::vector<TaskID> OutofOrderActorSubmitQueue::ClearAllTasks() {
   std::vector<TaskID> task_ids;
-  for (auto &[pos, spec] : pending_queue_) {
-    task_ids.push_back(spec.first.TaskId());
+  task_ids.reserve(num_tasks_);
+  for (uint64_t pos = base_position_; pos < end_position_; pos++) {
+    auto &slot = SlotAt(pos);
+    if (slot.state != SlotState::kEmpty) {
+      task_ids.push_back(slot.spec.TaskId());
+      slot.state = SlotState::kEmpty;
+      slot.spec = TaskSpecification();
+    }
   }
-  pending_queue_.clear();
-  for (auto &[pos, spec] : sending_queue_) {
-    task_ids.push_back(spec.first.TaskId());
-  }
-  sending_queue_.clear();
+  base_position_ = end_position_;
+  next_send_position_ = end_position_;
+  num_tasks_ = 0;
+  num_sending_ = 0;
   return task_ids;
 }
 
 std::optional<std::pair<TaskSpecification, bool>>
 OutofOrderActorSubmitQueue::PopNextTaskToSend() {
-  auto it = sending_queue_.begin();
-  if (it == sending_queue_.end()) {
-    return absl::nullopt;
+  if (num_sending_ == 0) {
+    return std::nullopt;
+  }
+  uint64_t position = std::max(next_send_position_, base_position_);
+  while (SlotAt(position).state != SlotState::kSending) {
+    position++;
   }
-  auto task_spec = std::move(it->second.first);
-  sending_queue_.erase(it);
+  auto task_spec = std::move(SlotAt(position).spec);
+  ReleaseSlot(position);
+  next_send_position_ = position + 1;
   return std::make_pair(std::move(task_spec), /*skip_queue*/ true);
 }
 
@@ -14,11 +14,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <utility>
 #include <vector>
 
-#include "absl/container/btree_map.h"
-#include "absl/types/optional.h"
 #include "ray/common/id.h"
 #include "ray/core_worker/task_submission/actor_submit_queue.h"
 
@@ -28,9 +28,12 @@ namespace core {
 /**
  * OutofOrderActorSubmitQueue sends request as soon as the dependencies are resolved.
  *
- * Under the hood, it keeps requests in two queues: pending queue and sending queue.
- * Emplaced request is inserted into pending queue; once the request's dependency
- * is resolved it's moved from pending queue into sending queue.
+ * Under the hood, it keeps requests in a ring buffer of slots indexed by the
+ * task's sequence number. Emplaced requests start in the pending state; once a
+ * request's dependencies are resolved its slot moves to the sending state and
+ * the request is eligible for PopNextTaskToSend. Sequence numbers increase
+ * monotonically and retire roughly in order, so the live window stays small
+ * and all operations are O(1) amortized with no steady-state allocation.
  */
 class OutofOrderActorSubmitQueue : public IActorSubmitQueue {
  public:
@@ -60,8 +63,44 @@ class OutofOrderActorSubmitQueue : public IActorSubmitQueue {
   bool Empty() override;
 
  private:
-  absl::btree_map<uint64_t, std::pair<TaskSpecification, bool>> pending_queue_;
-  absl::btree_map<uint64_t, std::pair<TaskSpecification, bool>> sending_queue_;
+  enum class SlotState : uint8_t {
+    // No task occupies the slot.
+    kEmpty,
+    // The task is waiting for its dependencies to be resolved.
+    kPending,
+    // The task's dependencies are resolved and it's ready to send.
+    kSending,
+  };
+
+  struct Slot {
+    SlotState state = SlotState::kEmpty;
+    TaskSpecification spec;
+  };
+
+  Slot &SlotAt(uint64_t position);
+  const Slot &SlotAt(uint64_t position) const;
+
+  /// Grow the ring (if needed) so the live window covers `position`, and
+  /// update the window bounds.
+  void EnsureWindow(uint64_t position);
+
+  /// Free the slot at `position` and advance the window base past any
+  /// leading empty slots.
+  void ReleaseSlot(uint64_t position);
+
+  /// Fixed ring of slots; the capacity is always a power of two and a slot is
+  /// addressed by its position modulo the capacity.
+  std::vector<Slot> slots_;
+  /// The lowest position that may be occupied (inclusive).
+  uint64_t base_position_ = 0;
+  /// One past the highest position that may be occupied.
+  uint64_t end_position_ = 0;
+  /// Scan hint for PopNextTaskToSend; no sending slot exists below it.
+  uint64_t next_send_position_ = 0;
+  /// Number of occupied slots.
+  size_t num_tasks_ = 0;
+  /// Number of slots in the sending state.
+  size_t num_sending_ = 0;
 };
 }  // namespace core
 }  // namespace ray
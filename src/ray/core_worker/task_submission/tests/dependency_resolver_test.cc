@@ -119,6 +119,14 @@ class MockTaskManager : public MockTaskManagerInterface {
 
   void MarkDependenciesResolved(const TaskID &task_id) override {}
 
+  void RegisterResultForwardDestination(const ObjectID &object_id,
+                                        const rpc::Address &addr) override {}
+
+  std::optional<rpc::Address> GetResultForwardDestination(
+      const ObjectID &object_id) const override {
+    return std::nullopt;
+  }
+
   void MarkTaskWaitingForExecution(const TaskID &task_id,
                                    const NodeID &node_id,
                                    const WorkerID &worker_id) override {}
@@ -342,6 +350,41 @@ TEST(LocalDependencyResolverTest, TestInlinePendingDependencies) {
   ASSERT_EQ(task_manager->num_contained_ids, 0);
 }
 
+TEST(LocalDependencyResolverTest, TestSharedPendingDependency) {
+  auto store = DefaultCoreWorkerMemoryStoreWithThread::Create();
+  auto task_manager = std::make_shared<MockTaskManager>();
+  FakeActorCreator actor_creator;
+  LocalDependencyResolver resolver(
+      *store, *task_manager, actor_creator, [](const ObjectID &object_id) {
+        return std::nullopt;
+      });
+  // Multiple tasks depending on the same pending object share one fetch; the
+  // fetch callback fans out to all of them.
+  ObjectID obj1 = ObjectID::FromRandom();
+  auto data = GenerateRandomObject();
+  constexpr int kNumTasks = 3;
+  std::vector<TaskSpecification> tasks(kNumTasks);
+  std::vector<std::promise<bool>> dependencies_resolved(kNumTasks);
+  for (int i = 0; i < kNumTasks; i++) {
+    auto &task = tasks[i];
+    task.GetMutableMessage().set_task_id(TaskID::FromRandom(JobID()).Binary());
+    task.GetMutableMessage().add_args()->mutable_object_ref()->set_object_id(
+        obj1.Binary());
+    resolver.ResolveDependencies(
+        task, [&, i](Status) { dependencies_resolved[i].set_value(true); });
+  }
+  ASSERT_EQ(resolver.NumPendingTasks(), kNumTasks);
+  store->Put(*data, obj1, /*has_reference=*/true);
+
+  for (int i = 0; i < kNumTasks; i++) {
+    ASSERT_TRUE(dependencies_resolved[i].get_future().get());
+    ASSERT_FALSE(tasks[i].ArgByRef(0));
+    ASSERT_NE(tasks[i].ArgData(0), nullptr);
+  }
+  ASSERT_EQ(resolver.NumPendingTasks(), 0);
+  ASSERT_EQ(task_manager->num_inlined_dependencies, kNumTasks);
+}
+
 TEST(LocalDependencyResolverTest, TestInlinedObjectIds) {
   auto store = DefaultCoreWorkerMemoryStoreWithThread::Create();
   auto task_manager = std::make_shared<MockTaskManager>();
@@ -200,6 +200,20 @@ class MockTaskManager : public MockTaskManagerInterface {
 
   void MarkDependenciesResolved(const TaskID &task_id) override {}
 
+  void RegisterResultForwardDestination(const ObjectID &object_id,
+                                        const rpc::Address &addr) override {
+    result_forward_destinations[object_id] = addr;
+  }
+
+  std::optional<rpc::Address> GetResultForwardDestination(
+      const ObjectID &object_id) const override {
+    auto it = result_forward_destinations.find(object_id);
+    if (it == result_forward_destinations.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
   void MarkTaskWaitingForExecution(const TaskID &task_id,
                                    const NodeID &node_id,
                                    const WorkerID &worker_id) override {}
@@ -217,6 +231,7 @@ class MockTaskManager : public MockTaskManagerInterface {
   int num_task_retries_attempted = 0;
   int num_fail_pending_task_calls = 0;
   int num_generator_failed_and_resubmitted = 0;
+  absl::flat_hash_map<ObjectID, rpc::Address> result_forward_destinations;
 };
 
 class MockRayletClient : public rpc::FakeRayletClient {
@@ -1754,6 +1769,111 @@ TEST_F(NormalTaskSubmitterTest, TestWorkerLeaseTimeout) {
   ASSERT_TRUE(submitter.CheckNoSchedulingKeyEntriesPublic());
 }
 
+TEST_F(NormalTaskSubmitterTest, TestLeaseKeepWarm) {
+  // The keep-warm duration is cached at construction, so set it before
+  // building the submitter.
+  RayConfig::instance().initialize(R"({"normal_task_lease_keep_warm_ms": 5})");
+  auto submitter =
+      CreateNormalTaskSubmitter(std::make_shared<StaticLeaseRequestRateLimiter>(1));
+  TaskSpecification task = BuildEmptyTaskSpec();
+
+  submitter.SubmitTask(task);
+  ASSERT_EQ(raylet_client->num_workers_requested, 1);
+  ASSERT_TRUE(raylet_client->GrantWorkerLease("localhost", 1234, local_node_id));
+  ASSERT_TRUE(worker_client->ReplyPushTask());
+  // The worker is kept warm instead of being returned immediately.
+  ASSERT_EQ(raylet_client->num_workers_returned, 0);
+
+  // A second task with the same scheduling class reuses the warm worker
+  // without a new lease request.
+  submitter.SubmitTask(WithRandomTaskId(task));
+  ASSERT_EQ(raylet_client->num_workers_requested, 1);
+  ASSERT_EQ(worker_client->callbacks.size(), 1);
+  ASSERT_TRUE(worker_client->ReplyPushTask());
+  ASSERT_EQ(task_manager->num_tasks_complete, 2);
+  ASSERT_EQ(raylet_client->num_workers_returned, 0);
+
+  // Once the keep-warm period expires with no more queued tasks, the delayed
+  // return fires and the worker goes back to the raylet.
+  for (int i = 0; i < 100 && raylet_client->num_workers_returned == 0; i++) {
+    io_context.run_one_for(std::chrono::milliseconds(100));
+  }
+  ASSERT_EQ(raylet_client->num_workers_returned, 1);
+  ASSERT_EQ(raylet_client->num_workers_disconnected, 0);
+
+  // Check that there are no entries left in the scheduling_key_entries_ hashmap. These
+  // would otherwise cause a memory leak.
+  ASSERT_TRUE(submitter.CheckNoSchedulingKeyEntriesPublic());
+  RayConfig::instance().initialize(R"({"normal_task_lease_keep_warm_ms": 0})");
+}
+
+TEST_F(NormalTaskSubmitterTest, TestHedgedTaskFirstReplyWins) {
+  // Hedging enablement is cached at construction, so set it before building
+  // the submitter. A single completed sample is enough to arm the hedge
+  // timer in this test.
+  RayConfig::instance().initialize(
+      R"({"normal_task_hedging_enabled": true, "normal_task_hedging_min_samples": 1})");
+  NodeID remote_node_id = NodeID::FromRandom();
+
+  // Node info lookup for cancelling the losing hedged attempt.
+  rpc::GcsNodeAddressAndLiveness node_info;
+  node_info.set_node_id(remote_node_id.Binary());
+  node_info.set_node_manager_address("127.0.0.1");
+  node_info.set_node_manager_port(9999);
+  node_info.set_state(rpc::GcsNodeInfo::ALIVE);
+  EXPECT_CALL(*mock_gcs_client_->mock_node_accessor,
+              GetNodeAddressAndLiveness(remote_node_id, false))
+      .WillOnce(testing::Return(std::make_optional(node_info)));
+
+  auto submitter =
+      CreateNormalTaskSubmitter(std::make_shared<StaticLeaseRequestRateLimiter>(1));
+
+  // Complete one task to seed the runtime window for the scheduling class.
+  TaskSpecification warmup = BuildEmptyTaskSpec();
+  warmup.GetMutableMessage().set_max_retries(3);
+  submitter.SubmitTask(warmup);
+  ASSERT_TRUE(raylet_client->GrantWorkerLease("localhost", 1000, local_node_id));
+  ASSERT_TRUE(worker_client->ReplyPushTask());
+  ASSERT_EQ(task_manager->num_tasks_complete, 1);
+
+  // The straggler: once its runtime exceeds the quantile of the window, a
+  // duplicate lease request goes out.
+  TaskSpecification task = WithRandomTaskId(warmup);
+  submitter.SubmitTask(task);
+  ASSERT_TRUE(raylet_client->GrantWorkerLease("localhost", 1001, local_node_id));
+  ASSERT_EQ(worker_client->callbacks.size(), 1);
+  for (int i = 0; i < 100 && raylet_client->num_workers_requested < 3; i++) {
+    io_context.run_one_for(std::chrono::milliseconds(100));
+  }
+  ASSERT_EQ(raylet_client->num_workers_requested, 3);
+
+  // The duplicate is dispatched to a worker on another node.
+  ASSERT_TRUE(raylet_client->GrantWorkerLease("localhost", 1002, remote_node_id));
+  ASSERT_EQ(worker_client->callbacks.size(), 2);
+
+  // The primary attempt replies first: the task completes exactly once and
+  // the losing attempt is cancelled.
+  ASSERT_TRUE(worker_client->ReplyPushTask());
+  ASSERT_EQ(task_manager->num_tasks_complete, 2);
+  ASSERT_EQ(raylet_client->cancel_local_task_requests.size(), 1);
+  ASSERT_EQ(raylet_client->cancel_local_task_requests.back().intended_task_id(),
+            task.TaskIdBinary());
+  raylet_client->ReplyCancelLocalTask(Status::OK(),
+                                      /*attempt_succeeded=*/true,
+                                      /*requested_task_running=*/false);
+
+  // The losing attempt's reply is dropped; its worker is simply returned.
+  ASSERT_TRUE(worker_client->ReplyPushTask());
+  ASSERT_EQ(task_manager->num_tasks_complete, 2);
+  ASSERT_EQ(task_manager->num_tasks_failed, 0);
+  ASSERT_EQ(raylet_client->num_workers_returned, 3);
+
+  // Check that there are no entries left in the scheduling_key_entries_ hashmap. These
+  // would otherwise cause a memory leak.
+  ASSERT_TRUE(submitter.CheckNoSchedulingKeyEntriesPublic());
+  RayConfig::instance().initialize(R"({"normal_task_hedging_enabled": false})");
+}
+
 TEST_F(NormalTaskSubmitterTest, TestKillExecutingTask) {
   rpc::GcsNodeAddressAndLiveness node_info;
   node_info.set_node_id(local_node_id.Binary());
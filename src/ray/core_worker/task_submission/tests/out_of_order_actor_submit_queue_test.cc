@@ -99,6 +99,36 @@ TEST(OutofOrderActorSubmitQueueTest, PassThroughTest) {
   }
 }
 
+TEST(OutofOrderActorSubmitQueueTest, RingWindowGrowthAndRetryTest) {
+  OutofOrderActorSubmitQueue queue;
+  // Insert enough in-flight requests to force the ring to grow past its
+  // initial capacity.
+  constexpr uint64_t kNumTasks = 1000;
+  for (uint64_t i = 0; i < kNumTasks; i++) {
+    queue.Emplace(i, BuildTaskSpec(i));
+  }
+  // Resolve and pop out of order; tasks come out in sequence order.
+  for (uint64_t i = 0; i < kNumTasks; i++) {
+    queue.MarkDependencyResolved(kNumTasks - 1 - i);
+  }
+  for (uint64_t i = 0; i < kNumTasks; i++) {
+    EXPECT_EQ(queue.PopNextTaskToSend()->first.SequenceNumber(), i);
+  }
+  EXPECT_FALSE(queue.PopNextTaskToSend().has_value());
+  EXPECT_TRUE(queue.Empty());
+
+  // A retried task reuses its original sequence number even after later
+  // positions have been emplaced.
+  queue.Emplace(kNumTasks + 10, BuildTaskSpec(kNumTasks + 10));
+  queue.Emplace(5, BuildTaskSpec(5));
+  EXPECT_TRUE(queue.Contains(5));
+  EXPECT_TRUE(queue.Contains(kNumTasks + 10));
+  queue.MarkDependencyResolved(5);
+  EXPECT_EQ(queue.PopNextTaskToSend()->first.SequenceNumber(), 5);
+  queue.MarkTaskCanceled(kNumTasks + 10);
+  EXPECT_TRUE(queue.Empty());
+}
+
 }  // namespace core
 }  // namespace ray
 
@@ -218,6 +218,54 @@ TEST(LocalityAwareLeasePolicyTest, TestBestLocalityBetterNode) {
   ASSERT_TRUE(is_selected_based_on_locality);
 }
 
+TEST(LocalityAwareLeasePolicyTest, TestBestLocalityInMemoryBeatsSpilled) {
+  absl::flat_hash_map<ObjectID, LocalityData> locality_data;
+  NodeID fallback_node = NodeID::FromRandom();
+  rpc::Address fallback_rpc_address = MockNodeAddrFactory(fallback_node).value();
+  NodeID in_memory_node = NodeID::FromRandom();
+  NodeID spilled_node = NodeID::FromRandom();
+  ObjectID obj1 = ObjectID::FromRandom();
+  // The object is in memory on in_memory_node and only on external storage on
+  // spilled_node; the spilled copy is discounted, so the in-memory copy wins.
+  locality_data.emplace(
+      obj1, LocalityData{16, {in_memory_node, spilled_node}, {spilled_node}});
+  auto mock_locality_data_provider =
+      std::make_shared<MockLocalityDataProvider>(locality_data);
+  LocalityAwareLeasePolicy locality_lease_policy(
+      *mock_locality_data_provider, MockNodeAddrFactory, fallback_rpc_address);
+  std::vector<ObjectID> deps{obj1};
+  auto lease_spec = CreateFakeLease(deps);
+  auto [best_node_address, is_selected_based_on_locality] =
+      locality_lease_policy.GetBestNodeForLease(lease_spec);
+  ASSERT_EQ(mock_locality_data_provider->num_locality_data_fetches, deps.size());
+  // Test that the node with the in-memory copy was chosen.
+  ASSERT_EQ(NodeID::FromBinary(best_node_address.node_id()), in_memory_node);
+  ASSERT_TRUE(is_selected_based_on_locality);
+}
+
+TEST(LocalityAwareLeasePolicyTest, TestBestLocalitySpilledBeatsNoLocality) {
+  absl::flat_hash_map<ObjectID, LocalityData> locality_data;
+  NodeID fallback_node = NodeID::FromRandom();
+  rpc::Address fallback_rpc_address = MockNodeAddrFactory(fallback_node).value();
+  NodeID spilled_node = NodeID::FromRandom();
+  ObjectID obj1 = ObjectID::FromRandom();
+  // The only copy of the object is spilled; discounted locality is still
+  // better than no locality, so the spill node wins over the fallback.
+  locality_data.emplace(obj1, LocalityData{16, {spilled_node}, {spilled_node}});
+  auto mock_locality_data_provider =
+      std::make_shared<MockLocalityDataProvider>(locality_data);
+  LocalityAwareLeasePolicy locality_lease_policy(
+      *mock_locality_data_provider, MockNodeAddrFactory, fallback_rpc_address);
+  std::vector<ObjectID> deps{obj1};
+  auto lease_spec = CreateFakeLease(deps);
+  auto [best_node_address, is_selected_based_on_locality] =
+      locality_lease_policy.GetBestNodeForLease(lease_spec);
+  ASSERT_EQ(mock_locality_data_provider->num_locality_data_fetches, deps.size());
+  // Test that the node with the spilled copy was chosen.
+  ASSERT_EQ(NodeID::FromBinary(best_node_address.node_id()), spilled_node);
+  ASSERT_TRUE(is_selected_based_on_locality);
+}
+
 TEST(LocalityAwareLeasePolicyTest, TestBestLocalityFallbackNoLocations) {
   absl::flat_hash_map<ObjectID, LocalityData> locality_data;
   NodeID fallback_node = NodeID::FromRandom();
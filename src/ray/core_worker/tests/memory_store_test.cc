@@ -24,6 +24,7 @@
 #include "absl/container/flat_hash_set.h"
 #include "absl/synchronization/mutex.h"
 #include "mock/ray/core_worker/memory_store.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/common/status_or.h"
 #include "ray/common/test_utils.h"
@@ -99,9 +100,9 @@ TEST(TestMemoryStore, TestMemoryStoreStats) {
   // Iterate through the memory store and compare the values that are obtained by
   // GetMemoryStoreStatisticalData.
   auto fill_expected_memory_stats = [&](MemoryStoreStats &expected_item) {
-    {
-      absl::MutexLock lock(&memory_store->mu_);
-      for (const auto &it : memory_store->objects_) {
+    for (const auto &shard : memory_store->shards_) {
+      absl::MutexLock lock(&shard->mu);
+      for (const auto &it : shard->objects) {
         if (it.second->IsInPlasmaError()) {
           expected_item.num_in_plasma += 1;
         } else {
@@ -150,6 +151,93 @@ TEST(TestMemoryStore, TestMemoryStoreStats) {
   ASSERT_EQ(item.num_in_plasma, expected_item3.num_in_plasma);
   ASSERT_EQ(item.num_local_objects, expected_item3.num_local_objects);
   ASSERT_EQ(item.num_local_objects_bytes, expected_item3.num_local_objects_bytes);
+
+  // UsedMemory is the same byte count without the per-object counters.
+  ASSERT_EQ(memory_store->UsedMemory(),
+            static_cast<uint64_t>(expected_item3.num_local_objects_bytes));
+}
+
+TEST(TestMemoryStore, TestShardedPutGet) {
+  // Exercise the same put/get/delete flows with the store split into multiple
+  // shards.
+  RayConfig::instance().initialize(R"({"core_worker_memory_store_num_shards": 8})");
+  auto memory_store = DefaultCoreWorkerMemoryStoreWithThread::Create();
+  WorkerContext context(WorkerType::WORKER, WorkerID::FromRandom(), JobID::FromInt(0));
+
+  std::vector<ObjectID> ids;
+  RayObject obj(rpc::ErrorType::TASK_EXECUTION_EXCEPTION);
+  for (int i = 0; i < 100; i++) {
+    auto id = ObjectID::FromRandom();
+    ids.push_back(id);
+    ASSERT_TRUE(memory_store->GetIfExists(id) == nullptr);
+    memory_store->Put(obj, id, /*has_reference=*/true);
+    ASSERT_TRUE(memory_store->GetIfExists(id) != nullptr);
+  }
+  ASSERT_EQ(memory_store->Size(), 100);
+
+  std::vector<std::shared_ptr<RayObject>> results;
+  RAY_UNUSED(memory_store->Get(ids, ids.size(), 100, context, &results));
+  for (const auto &result : results) {
+    ASSERT_TRUE(result != nullptr);
+  }
+
+  memory_store->Delete(ids);
+  ASSERT_EQ(memory_store->Size(), 0);
+
+  RayConfig::instance().initialize(R"({"core_worker_memory_store_num_shards": 1})");
+}
+
+TEST(TestMemoryStore, TestInlineSmallObjects) {
+  // With inline storage enabled, a small object's data and metadata are
+  // copied back to back into one pool block, and the block is recycled once
+  // the entry is released. Objects over the threshold fall back to the
+  // regular per-buffer representation.
+  RayConfig::instance().initialize(
+      R"({"core_worker_memory_store_inline_object_max_bytes": 64})");
+  auto memory_store = DefaultCoreWorkerMemoryStoreWithThread::Create();
+
+  std::string data_str = "hello";
+  auto data_buf = std::make_shared<LocalMemoryBuffer>(
+      const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(data_str.data())),
+      data_str.size());
+  auto metadata_buf = MakeLocalMemoryBufferFromString("meta");
+  RayObject small(data_buf, metadata_buf, {});
+
+  auto id1 = ObjectID::FromRandom();
+  memory_store->Put(small, id1, /*has_reference=*/true);
+  auto entry = memory_store->GetIfExists(id1);
+  ASSERT_TRUE(entry != nullptr);
+  ASSERT_TRUE(*entry->GetData() == *data_buf);
+  ASSERT_TRUE(*entry->GetMetadata() == *metadata_buf);
+  // Data and metadata share one block, with metadata right after the data.
+  ASSERT_EQ(entry->GetMetadata()->Data(), entry->GetData()->Data() + data_str.size());
+
+  // Releasing the entry returns its block to the pool, and the next small
+  // put reuses it.
+  const uint8_t *block_ptr = entry->GetData()->Data();
+  memory_store->Delete({id1});
+  entry.reset();
+  auto id2 = ObjectID::FromRandom();
+  memory_store->Put(small, id2, /*has_reference=*/true);
+  auto entry2 = memory_store->GetIfExists(id2);
+  ASSERT_TRUE(entry2 != nullptr);
+  ASSERT_EQ(entry2->GetData()->Data(), block_ptr);
+
+  // An object over the threshold takes the regular path and still round
+  // trips.
+  std::string large_str(128, 'x');
+  auto large_buf = std::make_shared<LocalMemoryBuffer>(
+      const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(large_str.data())),
+      large_str.size());
+  RayObject large(large_buf, metadata_buf, {});
+  auto id3 = ObjectID::FromRandom();
+  memory_store->Put(large, id3, /*has_reference=*/true);
+  auto entry3 = memory_store->GetIfExists(id3);
+  ASSERT_TRUE(entry3 != nullptr);
+  ASSERT_TRUE(*entry3->GetData() == *large_buf);
+
+  RayConfig::instance().initialize(
+      R"({"core_worker_memory_store_inline_object_max_bytes": 0})");
 }
 
 /// A mock manager that manages all test buffers. This mocks
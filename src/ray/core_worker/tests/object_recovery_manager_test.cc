@@ -80,22 +80,26 @@ class MockRayletClient : public rpc::FakeRayletClient {
       const ObjectID &generator_id,
       const rpc::ClientCallback<rpc::PinObjectIDsReply> &callback) override {
     RAY_LOG(INFO) << "PinObjectIDs " << object_ids.size();
-    callbacks.push_back(callback);
+    callbacks.push_back({object_ids, callback});
   }
 
   size_t Flush(bool success = true) {
-    std::list<rpc::ClientCallback<rpc::PinObjectIDsReply>> callbacks_snapshot;
+    std::list<std::pair<std::vector<ObjectID>, rpc::ClientCallback<rpc::PinObjectIDsReply>>>
+        callbacks_snapshot;
     std::swap(callbacks_snapshot, callbacks);
     size_t flushed = callbacks_snapshot.size();
-    for (const auto &callback : callbacks_snapshot) {
+    for (const auto &[object_ids, callback] : callbacks_snapshot) {
       rpc::PinObjectIDsReply reply;
-      reply.add_successes(success);
+      for (size_t i = 0; i < object_ids.size(); i++) {
+        reply.add_successes(success);
+      }
       callback(Status::OK(), std::move(reply));
     }
     return flushed;
   }
 
-  std::list<rpc::ClientCallback<rpc::PinObjectIDsReply>> callbacks = {};
+  std::list<std::pair<std::vector<ObjectID>, rpc::ClientCallback<rpc::PinObjectIDsReply>>>
+      callbacks = {};
 };
 
 class MockObjectDirectory {
@@ -284,6 +288,41 @@ TEST_F(ObjectRecoveryManagerTest, TestPinNewCopy) {
   ASSERT_EQ(task_manager_->num_tasks_resubmitted, 0);
 }
 
+TEST_F(ObjectRecoveryManagerTest, TestPinBatchedPerNode) {
+  // Multiple lost objects with copies on the same node are pinned with
+  // batched PinObjectIDs RPCs: requests made while an RPC is in flight are
+  // coalesced into the next one.
+  rpc::Address address;
+  address.set_node_id(NodeID::FromRandom().Binary());
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 3; i++) {
+    ObjectID object_id = ObjectID::FromRandom();
+    ref_counter_->AddOwnedObject(object_id,
+                                 {},
+                                 rpc::Address(),
+                                 "",
+                                 0,
+                                 LineageReconstructionEligibility::ELIGIBLE,
+                                 /*add_local_ref=*/true);
+    object_directory_->SetLocations(object_id, {address});
+    object_ids.push_back(object_id);
+    ASSERT_FALSE(manager_.RecoverObject(object_id).has_value());
+  }
+  ASSERT_EQ(object_directory_->Flush(), 3);
+
+  // The first lookup triggers an immediate RPC; the other two queue behind
+  // it and are sent together once it replies.
+  ASSERT_EQ(raylet_client_->callbacks.size(), 1);
+  ASSERT_EQ(raylet_client_->callbacks.front().first.size(), 1);
+  ASSERT_EQ(raylet_client_->Flush(), 1);
+  ASSERT_EQ(raylet_client_->callbacks.size(), 1);
+  ASSERT_EQ(raylet_client_->callbacks.front().first.size(), 2);
+  ASSERT_EQ(raylet_client_->Flush(), 1);
+
+  ASSERT_TRUE(failed_reconstructions_.empty());
+  ASSERT_EQ(task_manager_->num_tasks_resubmitted, 0);
+}
+
 TEST_F(ObjectRecoveryManagerTest, TestReconstruction) {
   ObjectID object_id = ObjectID::FromRandom();
   ref_counter_->AddOwnedObject(object_id,
@@ -25,6 +25,7 @@
 #include "mock/ray/pubsub/publisher.h"
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/asio/periodical_runner.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/ray_object.h"
 #include "ray/core_worker/reference_counter_interface.h"
 #include "ray/core_worker/store_provider/memory_store/memory_store.h"
@@ -75,6 +76,23 @@ class ReferenceCountTest : public ::testing::Test {
   std::shared_ptr<pubsub::FakeSubscriber> subscriber_;
 };
 
+class ReferenceCountLocalRefFastPathTest : public ReferenceCountTest {
+ protected:
+  void SetUp() override {
+    // The fast path flag is cached when the ReferenceCounter is constructed,
+    // so it must be set before the base fixture creates the counter.
+    RayConfig::instance().initialize(
+        R"({"reference_counter_local_ref_fast_path_enabled": true})");
+    ReferenceCountTest::SetUp();
+  }
+
+  void TearDown() override {
+    ReferenceCountTest::TearDown();
+    RayConfig::instance().initialize(
+        R"({"reference_counter_local_ref_fast_path_enabled": false})");
+  }
+};
+
 class ReferenceCountLineageEnabledTest : public ::testing::Test {
  protected:
   std::unique_ptr<ReferenceCounterInterface> rc;
@@ -591,6 +609,43 @@ TEST_F(ReferenceCountTest, TestBasic) {
   out.clear();
 }
 
+// Tests that local reference counting behaves identically when the lock-free
+// fast path is enabled. Increments and decrements that keep the count above
+// zero take the fast path, while 0 <-> 1 transitions (which create and delete
+// entries) fall back to the mutex-protected path.
+TEST_F(ReferenceCountLocalRefFastPathTest, TestBasic) {
+  std::vector<ObjectID> out;
+  ObjectID id = ObjectID::FromRandom();
+
+  // The first increment creates the entry on the slow path; the rest take the
+  // fast path.
+  rc->AddLocalReference(id, "");
+  rc->AddLocalReference(id, "");
+  rc->AddLocalReference(id, "");
+  ASSERT_EQ(rc->NumObjectIDsInScope(), 1);
+  auto counts = rc->GetAllReferenceCounts();
+  ASSERT_EQ(counts[id].first, 3);
+
+  // Decrements that keep the count above zero never delete the entry.
+  rc->RemoveLocalReference(id, &out);
+  rc->RemoveLocalReference(id, &out);
+  ASSERT_EQ(rc->NumObjectIDsInScope(), 1);
+  ASSERT_EQ(out.size(), 0);
+
+  // The final decrement reaches zero and deletes the entry.
+  rc->RemoveLocalReference(id, &out);
+  ASSERT_EQ(rc->NumObjectIDsInScope(), 0);
+  ASSERT_EQ(out.size(), 1);
+  out.clear();
+
+  // The entry can be recreated after deletion.
+  rc->AddLocalReference(id, "");
+  ASSERT_EQ(rc->NumObjectIDsInScope(), 1);
+  rc->RemoveLocalReference(id, &out);
+  ASSERT_EQ(rc->NumObjectIDsInScope(), 0);
+  ASSERT_EQ(out.size(), 1);
+}
+
 TEST_F(ReferenceCountTest, TestUnreconstructableObjectOutOfScope) {
   ObjectID id = ObjectID::FromRandom();
   rpc::Address address;
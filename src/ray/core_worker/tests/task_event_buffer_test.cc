@@ -404,6 +404,22 @@ class TaskEventBufferTestDroppedAttemptsOnly
   }
 };
 
+class TaskEventBufferTestByteLimit : public TaskEventBufferTest {
+ public:
+  TaskEventBufferTestByteLimit() : TaskEventBufferTest() {
+    RayConfig::instance().initialize(
+        R"(
+{
+  "task_events_report_interval_ms": 1000,
+  "task_events_max_num_status_events_buffer_on_worker": 100,
+  "task_events_send_batch_size": 100,
+  "task_events_max_bytes_per_flush": 1,
+  "task_events_shutdown_flush_timeout_ms": 100
+}
+  )");
+  }
+};
+
 void ReadContentFromFile(std::vector<std::string> &vc,
                          std::string log_file,
                          std::string filter = "") {
@@ -753,6 +769,38 @@ TEST_P(TaskEventBufferTestBatchSendDifferentDestination, TestBatchedSend) {
   EXPECT_EQ(task_event_buffer_->GetNumTaskEventsStored(), 0);
 }
 
+TEST_F(TaskEventBufferTestByteLimit, TestFlushByteBudget) {
+  // With a 1 byte budget per flush, each flush should send exactly one event
+  // even though the batch size allows many more. Status events are drained
+  // before profile events since they are selected first.
+  size_t num_status_events = 3;
+  size_t num_profile_events = 2;
+  size_t num_events = num_status_events + num_profile_events;
+  for (size_t i = 0; i < num_status_events; ++i) {
+    task_event_buffer_->AddTaskEvent(GenStatusTaskEvent(RandomTaskId(), 0));
+  }
+  for (size_t i = 0; i < num_profile_events; ++i) {
+    task_event_buffer_->AddTaskEvent(GenProfileTaskEvent(RandomTaskId(), 0));
+  }
+
+  auto task_gcs_accessor =
+      static_cast<ray::gcs::MockGcsClient *>(task_event_buffer_->GetGcsClient())
+          ->mock_task_accessor;
+  EXPECT_CALL(*task_gcs_accessor, AsyncAddTaskEventData)
+      .Times(num_events)
+      .WillRepeatedly([](std::unique_ptr<rpc::TaskEventData> actual_data,
+                         ray::rpc::StatusCallback callback) {
+        EXPECT_EQ(actual_data->events_by_task_size(), 1);
+        callback(Status::OK());
+        return Status::OK();
+      });
+
+  for (size_t i = 0; i < num_events; i++) {
+    task_event_buffer_->FlushEvents(true);
+    EXPECT_EQ(task_event_buffer_->GetNumTaskEventsStored(), num_events - i - 1);
+  }
+}
+
 TEST_P(TaskEventBufferTestLimitBufferDifferentDestination,
        TestBufferSizeLimitStatusEvents) {
   const auto [to_gcs, to_aggregator] = GetParam();
@@ -14,8 +14,12 @@
 
 #include "ray/core_worker/task_manager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -24,6 +28,7 @@
 #include "gtest/gtest.h"
 #include "mock/ray/gcs_client/gcs_client.h"
 #include "mock/ray/pubsub/publisher.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/task/task_spec.h"
 #include "ray/common/task/task_util.h"
 #include "ray/common/test_utils.h"
@@ -187,7 +192,15 @@ class TaskManagerTest : public ::testing::Test {
             fake_total_lineage_bytes_gauge_,
             /*free_actor_object_callback=*/[](const ObjectID &object_id) {},
             /*set_direct_transport_metadata=*/
-            [](const ObjectID &, const std::string &) {}) {}
+            [](const ObjectID &, const std::string &) {},
+            /*push_object_location_hint_callback=*/
+            [this](const NodeID &consumer_node_id,
+                   const ObjectID &object_id,
+                   const NodeID &location_node_id,
+                   uint64_t object_size) {
+              pushed_location_hints.emplace_back(
+                  consumer_node_id, object_id, location_node_id);
+            }) {}
 
   virtual void TearDown() { AssertNoLeaks(); }
 
@@ -196,6 +209,12 @@ class TaskManagerTest : public ::testing::Test {
     ASSERT_EQ(manager_.submissible_tasks_.size(), 0);
     ASSERT_EQ(manager_.num_pending_tasks_, 0);
     ASSERT_EQ(manager_.total_lineage_footprint_bytes_, 0);
+    ASSERT_EQ(manager_.result_forward_destinations_.size(), 0);
+  }
+
+  bool TaskSpecIsCold(const TaskID &task_id) {
+    absl::MutexLock lock(&manager_.mu_);
+    return manager_.submissible_tasks_.at(task_id).IsSpecCold();
   }
 
   void CompletePendingStreamingTask(const TaskSpecification &spec,
@@ -233,6 +252,7 @@ class TaskManagerTest : public ::testing::Test {
   int num_retries_ = 0;
   uint32_t last_delay_ms_ = 0;
   std::unordered_set<ObjectID> stored_in_plasma;
+  std::vector<std::tuple<NodeID, ObjectID, NodeID>> pushed_location_hints;
   ray::observability::FakeGauge fake_task_by_state_counter_;
   ray::observability::FakeGauge fake_total_lineage_bytes_gauge_;
 };
@@ -301,6 +321,93 @@ TEST_F(TaskManagerTest, TestTaskSuccess) {
   ASSERT_EQ(reference_counter_->NumObjectIDsInScope(), 0);
 }
 
+TEST_F(TaskManagerTest, TestEagerObjectLocationHints) {
+  RayConfig::instance().initialize(R"({"eager_object_location_hints_enabled": true})");
+  rpc::Address caller_address;
+
+  // A producer task with one return object and a consumer task depending on
+  // that return.
+  auto producer = CreateTaskHelper(1, {});
+  manager_.AddPendingTask(caller_address, producer, "");
+  auto return_id = producer.ReturnId(0);
+  auto consumer = CreateTaskHelper(1, {return_id});
+  manager_.AddPendingTask(caller_address, consumer, "");
+  auto consumer_return_id = consumer.ReturnId(0);
+
+  // Submitting the consumer records its node against the pending return.
+  const auto consumer_node_id = NodeID::FromRandom();
+  manager_.MarkDependenciesResolved(consumer.TaskId());
+  manager_.MarkTaskWaitingForExecution(
+      consumer.TaskId(), consumer_node_id, WorkerID::FromRandom());
+  ASSERT_TRUE(pushed_location_hints.empty());
+
+  // The producer finishing with an in-plasma return on another node pushes
+  // the new location to the consumer's node.
+  const auto producer_node_id = NodeID::FromRandom();
+  manager_.MarkDependenciesResolved(producer.TaskId());
+  manager_.MarkTaskWaitingForExecution(
+      producer.TaskId(), producer_node_id, WorkerID::FromRandom());
+  rpc::PushTaskReply reply;
+  auto return_object = reply.add_return_objects();
+  return_object->set_object_id(return_id.Binary());
+  return_object->set_in_plasma(true);
+  rpc::Address producer_worker_addr;
+  producer_worker_addr.set_node_id(producer_node_id.Binary());
+  manager_.CompletePendingTask(producer.TaskId(), reply, producer_worker_addr, false);
+  ASSERT_EQ(pushed_location_hints.size(), 1);
+  ASSERT_EQ(pushed_location_hints[0],
+            std::make_tuple(consumer_node_id, return_id, producer_node_id));
+
+  // The hint state is one-shot; completing the consumer pushes nothing since
+  // no node was recorded for its return.
+  rpc::PushTaskReply consumer_reply;
+  auto consumer_return_object = consumer_reply.add_return_objects();
+  consumer_return_object->set_object_id(consumer_return_id.Binary());
+  auto data = GenerateRandomBuffer();
+  consumer_return_object->set_data(data->Data(), data->Size());
+  manager_.CompletePendingTask(consumer.TaskId(), consumer_reply, rpc::Address(), false);
+  ASSERT_EQ(pushed_location_hints.size(), 1);
+
+  std::vector<ObjectID> removed;
+  reference_counter_->RemoveLocalReference(return_id, &removed);
+  reference_counter_->RemoveLocalReference(consumer_return_id, &removed);
+  RayConfig::instance().initialize(R"({"eager_object_location_hints_enabled": false})");
+}
+
+TEST_F(TaskManagerTest, TestResultForwardDestinationLifecycle) {
+  rpc::Address caller_address;
+  auto spec = CreateTaskHelper(1, {});
+  manager_.AddPendingTask(caller_address, spec, "");
+  auto return_id = spec.ReturnId(0);
+
+  rpc::Address consumer;
+  consumer.set_worker_id(WorkerID::FromRandom().Binary());
+
+  // Registration is a no-op while task_result_forwarding_enabled is off.
+  manager_.RegisterResultForwardDestination(return_id, consumer);
+  ASSERT_FALSE(manager_.GetResultForwardDestination(return_id).has_value());
+
+  RayConfig::instance().initialize(R"({"task_result_forwarding_enabled": true})");
+  manager_.RegisterResultForwardDestination(return_id, consumer);
+  auto dest = manager_.GetResultForwardDestination(return_id);
+  ASSERT_TRUE(dest.has_value());
+  ASSERT_EQ(dest->worker_id(), consumer.worker_id());
+
+  // The registration is dropped once the task completes.
+  rpc::PushTaskReply reply;
+  auto return_object = reply.add_return_objects();
+  return_object->set_object_id(return_id.Binary());
+  auto data = GenerateRandomBuffer();
+  return_object->set_data(data->Data(), data->Size());
+  manager_.CompletePendingTask(spec.TaskId(), reply, rpc::Address(), false);
+  ASSERT_FALSE(manager_.GetResultForwardDestination(return_id).has_value());
+
+  std::vector<ObjectID> removed;
+  reference_counter_->RemoveLocalReference(return_id, &removed);
+  ASSERT_EQ(removed[0], return_id);
+  RayConfig::instance().initialize(R"({"task_result_forwarding_enabled": false})");
+}
+
 TEST_F(TaskManagerTest, TestTaskFailure) {
   rpc::Address caller_address;
   ObjectID dep1 = ObjectID::FromRandom();
@@ -869,6 +976,59 @@ TEST_F(TaskManagerLineageTest, TestLineagePinned) {
   ASSERT_FALSE(reference_counter_->HasReference(return_id));
 }
 
+// Test that with cold lineage storage enabled, a finished task's spec is
+// demoted to its serialized form, stays readable, and is rehydrated
+// transparently when the task is resubmitted or its lineage is released.
+TEST_F(TaskManagerLineageTest, TestColdLineageDemotedAndRehydrated) {
+  RayConfig::instance().initialize(R"({"lineage_cold_storage_enabled": true})");
+  rpc::Address caller_address;
+  ObjectID dep1 = ObjectID::FromRandom();
+  ObjectID dep2 = ObjectID::FromRandom();
+  auto spec = CreateTaskHelper(1, {dep1, dep2});
+  int num_retries = 3;
+  manager_.AddPendingTask(caller_address, spec, "", num_retries);
+  auto return_id = spec.ReturnId(0);
+
+  // The task completes with its return stored in plasma, so the lineage is
+  // pinned and the entry's spec goes cold.
+  manager_.MarkDependenciesResolved(spec.TaskId());
+  manager_.MarkTaskWaitingForExecution(
+      spec.TaskId(), NodeID::FromRandom(), WorkerID::FromRandom());
+  rpc::PushTaskReply reply;
+  auto return_object = reply.add_return_objects();
+  return_object->set_object_id(return_id.Binary());
+  auto data = GenerateRandomBuffer();
+  return_object->set_data(data->Data(), data->Size());
+  return_object->set_in_plasma(true);
+  manager_.CompletePendingTask(spec.TaskId(), reply, rpc::Address(), false);
+  ASSERT_TRUE(manager_.IsTaskSubmissible(spec.TaskId()));
+  ASSERT_TRUE(TaskSpecIsCold(spec.TaskId()));
+
+  // The cold spec is still readable through the usual accessors.
+  auto rehydrated = manager_.GetTaskSpec(spec.TaskId());
+  ASSERT_TRUE(rehydrated.has_value());
+  ASSERT_EQ(rehydrated->TaskId(), spec.TaskId());
+  ASSERT_EQ(rehydrated->GetDependencyIds(), spec.GetDependencyIds());
+
+  // Resubmission promotes the spec back to the hot tier.
+  std::vector<ObjectID> resubmitted_task_deps;
+  ASSERT_EQ(manager_.ResubmitTask(spec.TaskId(), &resubmitted_task_deps), std::nullopt);
+  ASSERT_EQ(resubmitted_task_deps, spec.GetDependencyIds());
+  ASSERT_EQ(num_retries_, 1);
+  ASSERT_FALSE(TaskSpecIsCold(spec.TaskId()));
+
+  // The resubmitted task finishes and the spec goes cold again; releasing the
+  // return reference walks the cold spec's args and erases the lineage.
+  manager_.CompletePendingTask(spec.TaskId(), reply, rpc::Address(), false);
+  ASSERT_TRUE(TaskSpecIsCold(spec.TaskId()));
+  reference_counter_->RemoveLocalReference(return_id, nullptr);
+  ASSERT_FALSE(manager_.IsTaskSubmissible(spec.TaskId()));
+  ASSERT_FALSE(reference_counter_->HasReference(dep1));
+  ASSERT_FALSE(reference_counter_->HasReference(dep2));
+  ASSERT_FALSE(reference_counter_->HasReference(return_id));
+  RayConfig::instance().initialize(R"({"lineage_cold_storage_enabled": false})");
+}
+
 // Test to make sure that the task spec and dependencies for an object are
 // evicted if the object is returned by value, instead of stored in plasma.
 TEST_F(TaskManagerLineageTest, TestDirectObjectNoLineage) {
@@ -1437,6 +1597,178 @@ TEST_F(TaskManagerTest, PlasmaPut_ObjectStoreFull_FailsTaskAndWritesError) {
   ASSERT_TRUE(results[0]->IsException());
 }
 
+// Benchmark-style test for batched completion processing. Many replies arrive
+// concurrently and the completion queue drains them in batches: one memory
+// store bulk insert and one task lock acquisition per batch.
+TEST_F(TaskManagerTest, CompletionBatching_HighFanInThroughput) {
+  // The batch size is cached at construction, so set it before building the
+  // manager.
+  RayConfig::instance().initialize(R"({"task_manager_completion_batch_size": 64})");
+  auto local_ref_counter = std::make_shared<ReferenceCounter>(
+      addr_,
+      publisher_.get(),
+      subscriber_.get(),
+      /*is_node_dead=*/[this](const NodeID &) { return node_died_; },
+      *std::make_shared<ray::observability::FakeGauge>(),
+      *std::make_shared<ray::observability::FakeGauge>(),
+      lineage_pinning_enabled_);
+  auto local_store = std::make_shared<CoreWorkerMemoryStore>(io_context_.GetIoService());
+  TaskManager batching_mgr(
+      *local_store,
+      *local_ref_counter,
+      /*put_in_local_plasma_callback=*/
+      [](const RayObject &, const ObjectID &) { return Status::OK(); },
+      [this](TaskSpecification &spec, uint32_t delay_ms) {
+        num_retries_++;
+        last_delay_ms_ = delay_ms;
+      },
+      [this](const TaskSpecification &spec) {
+        return this->did_queue_generator_resubmit_;
+      },
+      [](const JobID &, const std::string &, const std::string &, double) {
+        return Status::OK();
+      },
+      /*max_lineage_bytes*/ 1024 * 1024,
+      *task_event_buffer_mock_.get(),
+      [](const ActorID &) -> std::shared_ptr<ray::rpc::CoreWorkerClientInterface> {
+        return nullptr;
+      },
+      mock_gcs_client_,
+      fake_task_by_state_counter_,
+      fake_total_lineage_bytes_gauge_,
+      /*free_actor_object_callback=*/[](const ObjectID &object_id) {},
+      /*set_direct_transport_metadata=*/[](const ObjectID &, const std::string &) {});
+
+  constexpr int kNumTasks = 2000;
+  constexpr int kNumReplyThreads = 4;
+  rpc::Address caller_address;
+  std::vector<TaskSpecification> specs;
+  specs.reserve(kNumTasks);
+  for (int i = 0; i < kNumTasks; i++) {
+    auto spec = CreateTaskHelper(1, {});
+    batching_mgr.AddPendingTask(caller_address, spec, "");
+    batching_mgr.MarkDependenciesResolved(spec.TaskId());
+    batching_mgr.MarkTaskWaitingForExecution(
+        spec.TaskId(), NodeID::FromRandom(), WorkerID::FromRandom());
+    specs.push_back(spec);
+  }
+
+  // Complete all tasks from several threads at once to simulate high fan-in
+  // and exercise the combining drain.
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> reply_threads;
+  reply_threads.reserve(kNumReplyThreads);
+  for (int t = 0; t < kNumReplyThreads; t++) {
+    reply_threads.emplace_back([t, &specs, &batching_mgr]() {
+      for (int i = t; i < kNumTasks; i += kNumReplyThreads) {
+        const auto &spec = specs[i];
+        rpc::PushTaskReply reply;
+        auto return_object = reply.add_return_objects();
+        return_object->set_object_id(spec.ReturnId(0).Binary());
+        auto data = GenerateRandomBuffer();
+        return_object->set_data(data->Data(), data->Size());
+        batching_mgr.CompletePendingTask(spec.TaskId(), reply, rpc::Address(), false);
+      }
+    });
+  }
+  for (auto &reply_thread : reply_threads) {
+    reply_thread.join();
+  }
+  const double elapsed_s =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  RAY_LOG(INFO) << "Completed " << kNumTasks << " tasks in " << elapsed_s << "s ("
+                << static_cast<int64_t>(kNumTasks / std::max(elapsed_s, 1e-9))
+                << " completions/sec) with batch size "
+                << RayConfig::instance().task_manager_completion_batch_size();
+
+  // Every task completed and every return object is retrievable.
+  WorkerContext ctx(WorkerType::WORKER, WorkerID::FromRandom(), JobID::FromInt(0));
+  for (const auto &spec : specs) {
+    ASSERT_FALSE(batching_mgr.IsTaskPending(spec.TaskId()));
+    std::vector<std::shared_ptr<RayObject>> results;
+    RAY_CHECK_OK(local_store->Get({spec.ReturnId(0)}, 1, -1, ctx, &results));
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_FALSE(results[0]->IsException());
+  }
+
+  RayConfig::instance().initialize(R"({"task_manager_completion_batch_size": 1})");
+}
+
+TEST_F(TaskManagerTest, ZeroCopyInlineReturn_AliasesReplyBuffer) {
+  // The threshold is cached at construction, so set it before building the
+  // manager.
+  RayConfig::instance().initialize(
+      R"({"inline_return_zero_copy_threshold_bytes": 1024})");
+  auto local_ref_counter = std::make_shared<ReferenceCounter>(
+      addr_,
+      publisher_.get(),
+      subscriber_.get(),
+      /*is_node_dead=*/[this](const NodeID &) { return node_died_; },
+      *std::make_shared<ray::observability::FakeGauge>(),
+      *std::make_shared<ray::observability::FakeGauge>(),
+      lineage_pinning_enabled_);
+  auto local_store = std::make_shared<CoreWorkerMemoryStore>(io_context_.GetIoService());
+  TaskManager zero_copy_mgr(
+      *local_store,
+      *local_ref_counter,
+      /*put_in_local_plasma_callback=*/
+      [](const RayObject &, const ObjectID &) { return Status::OK(); },
+      [this](TaskSpecification &spec, uint32_t delay_ms) {
+        num_retries_++;
+        last_delay_ms_ = delay_ms;
+      },
+      [this](const TaskSpecification &spec) {
+        return this->did_queue_generator_resubmit_;
+      },
+      [](const JobID &, const std::string &, const std::string &, double) {
+        return Status::OK();
+      },
+      /*max_lineage_bytes*/ 1024 * 1024,
+      *task_event_buffer_mock_.get(),
+      [](const ActorID &) -> std::shared_ptr<ray::rpc::CoreWorkerClientInterface> {
+        return nullptr;
+      },
+      mock_gcs_client_,
+      fake_task_by_state_counter_,
+      fake_total_lineage_bytes_gauge_,
+      /*free_actor_object_callback=*/[](const ObjectID &object_id) {},
+      /*set_direct_transport_metadata=*/[](const ObjectID &, const std::string &) {});
+
+  rpc::Address caller_address;
+  auto spec = CreateTaskHelper(1, {});
+  zero_copy_mgr.AddPendingTask(caller_address, spec, "");
+  zero_copy_mgr.MarkDependenciesResolved(spec.TaskId());
+  zero_copy_mgr.MarkTaskWaitingForExecution(
+      spec.TaskId(), NodeID::FromRandom(), WorkerID::FromRandom());
+
+  auto reply = std::make_shared<rpc::PushTaskReply>();
+  auto return_object = reply->add_return_objects();
+  return_object->set_object_id(spec.ReturnId(0).Binary());
+  const std::string payload = "small inline return";
+  return_object->set_data(payload);
+  const uint8_t *reply_data =
+      reinterpret_cast<const uint8_t *>(reply->return_objects(0).data().data());
+  zero_copy_mgr.CompletePendingTask(spec.TaskId(), reply, rpc::Address(), false);
+  ASSERT_FALSE(zero_copy_mgr.IsTaskPending(spec.TaskId()));
+
+  // The stored object aliases the reply's buffer instead of copying it.
+  WorkerContext ctx(WorkerType::WORKER, WorkerID::FromRandom(), JobID::FromInt(0));
+  std::vector<std::shared_ptr<RayObject>> results;
+  RAY_CHECK_OK(local_store->Get({spec.ReturnId(0)}, 1, -1, ctx, &results));
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(results[0]->GetData()->Data(), reply_data);
+
+  // The stored object keeps the reply alive after the caller drops its
+  // reference.
+  reply.reset();
+  ASSERT_EQ(std::string(reinterpret_cast<const char *>(results[0]->GetData()->Data()),
+                        results[0]->GetData()->Size()),
+            payload);
+
+  RayConfig::instance().initialize(
+      R"({"inline_return_zero_copy_threshold_bytes": 0})");
+}
+
 TEST_F(TaskManagerTest, PlasmaPut_TransientFull_RetriesThenSucceeds) {
   std::shared_ptr<std::atomic<int>> attempts = std::make_shared<std::atomic<int>>(0);
   auto local_ref_counter = std::make_shared<ReferenceCounter>(
@@ -2647,6 +2979,120 @@ TEST_F(TaskManagerTest, TestObjectRefStreamBackpressure) {
   /// No need to test out of order case. It won't be different.
 }
 
+TEST_F(TaskManagerTest, TestObjectRefStreamBackpressureCreditBatch) {
+  /**
+   * With a credit batch size of 2, a backpressured generator is not woken on
+   * the first consumption; the owner accumulates two credits and then wakes
+   * the generator once, granting the whole batch.
+   */
+  // The batch size is cached at construction, so set it before building the
+  // manager.
+  RayConfig::instance().initialize(
+      R"({"generator_backpressure_credit_batch_size": 2})");
+  auto local_ref_counter = std::make_shared<ReferenceCounter>(
+      addr_,
+      publisher_.get(),
+      subscriber_.get(),
+      /*is_node_dead=*/[this](const NodeID &) { return node_died_; },
+      *std::make_shared<ray::observability::FakeGauge>(),
+      *std::make_shared<ray::observability::FakeGauge>(),
+      lineage_pinning_enabled_);
+  auto local_store = std::make_shared<CoreWorkerMemoryStore>(io_context_.GetIoService());
+  TaskManager credit_mgr(
+      *local_store,
+      *local_ref_counter,
+      /*put_in_local_plasma_callback=*/
+      [](const RayObject &, const ObjectID &) { return Status::OK(); },
+      [this](TaskSpecification &spec, uint32_t delay_ms) {
+        num_retries_++;
+        last_delay_ms_ = delay_ms;
+      },
+      [this](const TaskSpecification &spec) {
+        return this->did_queue_generator_resubmit_;
+      },
+      [](const JobID &, const std::string &, const std::string &, double) {
+        return Status::OK();
+      },
+      /*max_lineage_bytes*/ 1024 * 1024,
+      *task_event_buffer_mock_.get(),
+      [](const ActorID &) -> std::shared_ptr<ray::rpc::CoreWorkerClientInterface> {
+        return nullptr;
+      },
+      mock_gcs_client_,
+      fake_task_by_state_counter_,
+      fake_total_lineage_bytes_gauge_,
+      /*free_actor_object_callback=*/[](const ObjectID &object_id) {},
+      /*set_direct_transport_metadata=*/[](const ObjectID &, const std::string &) {});
+
+  auto spec = CreateTaskHelper(1,
+                               {},
+                               /*dynamic_returns=*/true,
+                               /*is_streaming_generator=*/true,
+                               /*generator_backpressure_num_objects*/ 3);
+  auto generator_id = spec.ReturnId(0);
+  rpc::Address caller_address;
+  credit_mgr.AddPendingTask(caller_address, spec, "", 0);
+
+  // Items 0 and 1 are under the threshold and signaled immediately; item 2
+  // hits the threshold and its signal is deferred.
+  bool signal_called = false;
+  int64_t consumed_at_signal = -1;
+  for (int64_t idx = 0; idx < 3; idx++) {
+    auto dynamic_return_id = ObjectID::FromIndex(spec.TaskId(), idx + 2);
+    auto data = GenerateRandomBuffer();
+    auto req = GetIntermediateTaskReturn(
+        /*idx*/ idx,
+        /*finished*/ false,
+        generator_id,
+        /*dynamic_return_id*/ dynamic_return_id,
+        /*data*/ data,
+        /*set_in_plasma*/ false);
+    signal_called = false;
+    ASSERT_TRUE(credit_mgr.HandleReportGeneratorItemReturns(
+        req,
+        /*execution_signal_callback*/
+        [&signal_called, &consumed_at_signal](Status callback_status,
+                                              int64_t num_objects_consumed) {
+          signal_called = true;
+          consumed_at_signal = num_objects_consumed;
+          ASSERT_TRUE(callback_status.ok());
+        }));
+    ASSERT_EQ(signal_called, idx < 2);
+  }
+
+  // One consumption frees only one credit; with a batch of 2 the generator is
+  // not woken yet.
+  ObjectID obj_id;
+  RAY_CHECK_OK(credit_mgr.TryReadObjectRefStream(generator_id, &obj_id));
+  local_ref_counter->RemoveLocalReference(obj_id, nullptr);
+  ASSERT_FALSE(signal_called);
+
+  // The second consumption completes the credit batch and wakes the
+  // generator with both credits at once.
+  RAY_CHECK_OK(credit_mgr.TryReadObjectRefStream(generator_id, &obj_id));
+  local_ref_counter->RemoveLocalReference(obj_id, nullptr);
+  ASSERT_TRUE(signal_called);
+  ASSERT_EQ(consumed_at_signal, 2);
+
+  // Finish the task and clean up the stream.
+  rpc::PushTaskReply reply;
+  auto return_object = reply.add_return_objects();
+  return_object->set_object_id(generator_id.Binary());
+  auto data = GenerateRandomBuffer();
+  return_object->set_data(data->Data(), data->Size());
+  for (int64_t i = 0; i < 3; i++) {
+    auto return_id_proto = reply.add_streaming_generator_return_ids();
+    return_id_proto->set_object_id(spec.ReturnId(i + 1).Binary());
+    return_id_proto->set_is_plasma_object(false);
+  }
+  credit_mgr.CompletePendingTask(spec.TaskId(), reply, caller_address, false);
+  local_ref_counter->RemoveLocalReference(generator_id, nullptr);
+  ASSERT_TRUE(credit_mgr.TryDelObjectRefStream(generator_id));
+
+  RayConfig::instance().initialize(
+      R"({"generator_backpressure_credit_batch_size": 1})");
+}
+
 TEST_F(TaskManagerTest, TestBackpressureAfterReconstruction) {
   // Consumed objects should be signaled immediately.
   // Unconsumed objects should not be.
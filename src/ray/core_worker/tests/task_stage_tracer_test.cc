@@ -0,0 +1,125 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/core_worker/task_stage_tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ray/common/ray_config.h"
+
+namespace ray {
+namespace core {
+namespace worker {
+
+class TaskStageTracerTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    RayConfig::instance().task_stage_trace_sample_rate() = 0.01;
+  }
+
+  TaskID GenTaskID() { return TaskID::FromRandom(JobID::FromInt(1)); }
+};
+
+TEST_F(TaskStageTracerTest, DisabledRecordsNothing) {
+  RayConfig::instance().task_stage_trace_sample_rate() = 0.0;
+  TaskStageTracer tracer;
+  const auto task_id = GenTaskID();
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::FINISHED, 1'000'000);
+  ASSERT_TRUE(tracer.StatsString().empty());
+}
+
+TEST_F(TaskStageTracerTest, AggregatesStageDurations) {
+  RayConfig::instance().task_stage_trace_sample_rate() = 1.0;
+  TaskStageTracer tracer;
+  const auto task_id = GenTaskID();
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  tracer.RecordStatusChange(task_id,
+                            0,
+                            /*is_actor_task=*/false,
+                            rpc::TaskStatus::PENDING_NODE_ASSIGNMENT,
+                            2'000'000);
+  tracer.RecordStatusChange(task_id,
+                            0,
+                            /*is_actor_task=*/false,
+                            rpc::TaskStatus::SUBMITTED_TO_WORKER,
+                            5'000'000);
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::FINISHED, 6'000'000);
+  const std::string stats = tracer.StatsString();
+  ASSERT_NE(
+      stats.find("PENDING_ARGS_AVAIL-PENDING_NODE_ASSIGNMENT: count=1, mean=2"),
+      std::string::npos);
+  ASSERT_NE(
+      stats.find("PENDING_NODE_ASSIGNMENT-SUBMITTED_TO_WORKER: count=1, mean=3"),
+      std::string::npos);
+  ASSERT_NE(stats.find("SUBMITTED_TO_WORKER-FINISHED: count=1, mean=1"),
+            std::string::npos);
+}
+
+TEST_F(TaskStageTracerTest, StatsEmptyUntilTerminalStatus) {
+  RayConfig::instance().task_stage_trace_sample_rate() = 1.0;
+  TaskStageTracer tracer;
+  const auto task_id = GenTaskID();
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  tracer.RecordStatusChange(task_id,
+                            0,
+                            /*is_actor_task=*/false,
+                            rpc::TaskStatus::PENDING_NODE_ASSIGNMENT,
+                            1'000'000);
+  ASSERT_TRUE(tracer.StatsString().empty());
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::FAILED, 2'000'000);
+  ASSERT_FALSE(tracer.StatsString().empty());
+}
+
+TEST_F(TaskStageTracerTest, RuntimeDisableStopsSampling) {
+  RayConfig::instance().task_stage_trace_sample_rate() = 1.0;
+  TaskStageTracer tracer;
+  const auto task_id = GenTaskID();
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  RayConfig::instance().task_stage_trace_sample_rate() = 0.0;
+  // The terminal transition is dropped once sampling is off, so the attempt
+  // never flushes.
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::FINISHED, 1'000'000);
+  ASSERT_TRUE(tracer.StatsString().empty());
+}
+
+TEST_F(TaskStageTracerTest, AttemptsAreTracedIndependently) {
+  RayConfig::instance().task_stage_trace_sample_rate() = 1.0;
+  TaskStageTracer tracer;
+  const auto task_id = GenTaskID();
+  tracer.RecordStatusChange(
+      task_id, 0, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  // A retry starts its own trace; finishing it must not flush attempt 0.
+  tracer.RecordStatusChange(
+      task_id, 1, /*is_actor_task=*/false, rpc::TaskStatus::PENDING_ARGS_AVAIL, 0);
+  tracer.RecordStatusChange(
+      task_id, 1, /*is_actor_task=*/false, rpc::TaskStatus::FINISHED, 4'000'000);
+  const std::string stats = tracer.StatsString();
+  ASSERT_NE(stats.find("PENDING_ARGS_AVAIL-FINISHED: count=1, mean=4"),
+            std::string::npos);
+}
+
+}  // namespace worker
+}  // namespace core
+}  // namespace ray
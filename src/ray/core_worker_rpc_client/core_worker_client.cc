@@ -14,22 +14,69 @@
 
 #include "ray/core_worker_rpc_client/core_worker_client.h"
 
+#include <filesystem>
 #include <limits>
 #include <memory>
+#include <string>
 #include <utility>
 
+#include "ray/rpc/channel_pool.h"
 #include "ray/util/logging.h"
+#include "ray/util/network_util.h"
 
 namespace ray {
 namespace rpc {
 
+namespace {
+
+/// Connect over the same-node Unix domain socket fast lane when it is enabled
+/// and the target worker is on this node, otherwise over TCP. The socket file
+/// is created by the target's gRPC server before it starts serving, so a
+/// missing file means the lane is unavailable and we fall back to TCP.
+///
+/// When the shared channel pool is enabled, the channel is fetched from the
+/// process-wide pool keyed by the endpoint, so all clients to the same worker
+/// multiplex their streams over one channel.
+std::shared_ptr<grpc::Channel> BuildCoreWorkerChannel(
+    const rpc::Address &addr, ClientCallManager &client_call_manager) {
+  const bool use_channel_pool =
+      ::RayConfig::instance().grpc_client_enable_channel_pool();
+  const auto &socket_dir = ::RayConfig::instance().core_worker_same_node_socket_dir();
+  if (!socket_dir.empty() && !::RayConfig::instance().USE_TLS() &&
+      IsLocalHost(addr.ip_address(), client_call_manager.GetLocalAddress())) {
+    auto socket_path = CoreWorkerSameNodeSocketPath(socket_dir, addr.port());
+    if (std::filesystem::exists(socket_path)) {
+      if (use_channel_pool) {
+        return ChannelPool::Instance().GetOrCreateChannel(
+            "unix:" + socket_path,
+            [&socket_path]() { return BuildUnixSocketChannel(socket_path); });
+      }
+      return BuildUnixSocketChannel(socket_path);
+    }
+  }
+  if (use_channel_pool) {
+    return ChannelPool::Instance().GetOrCreateChannel(
+        BuildAddress(addr.ip_address(), addr.port()),
+        [&addr]() { return BuildChannel(addr.ip_address(), addr.port()); });
+  }
+  return BuildChannel(addr.ip_address(), addr.port());
+}
+
+}  // namespace
+
+std::string CoreWorkerSameNodeSocketPath(const std::string &socket_dir, int port) {
+  return socket_dir + "/core_worker_" + std::to_string(port) + ".sock";
+}
+
 CoreWorkerClient::CoreWorkerClient(
     rpc::Address address,
     ClientCallManager &client_call_manager,
     std::function<void()> core_worker_unavailable_timeout_callback)
     : addr_(std::move(address)),
       grpc_client_(std::make_shared<GrpcClient<CoreWorkerService>>(
-          addr_.ip_address(), addr_.port(), client_call_manager)),
+          BuildCoreWorkerChannel(addr_, client_call_manager),
+          client_call_manager,
+          addr_.ip_address())),
       retryable_grpc_client_(RetryableGrpcClient::Create(
           grpc_client_->Channel(),
           client_call_manager.GetMainService(),
@@ -101,6 +148,13 @@ void CoreWorkerClient::SendRequests() {
   auto this_ptr = this->shared_from_this();
 
   while (!send_queue_.empty() && rpc_bytes_in_flight_ < kMaxBytesInFlight) {
+    // Coalesce consecutive queued requests into one batch RPC when there is a
+    // backlog; a batch only forms from requests that are already waiting, so
+    // this adds no latency.
+    if (push_task_batch_max_size_ > 1 && send_queue_.size() > 1) {
+      SendBatchRequest(push_task_batch_max_size_);
+      continue;
+    }
     auto pair = std::move(*send_queue_.begin());
     send_queue_.pop_front();
 
@@ -138,5 +192,65 @@ void CoreWorkerClient::SendRequests() {
   }
 }
 
+void CoreWorkerClient::SendBatchRequest(int64_t batch_max_size) {
+  auto this_ptr = this->shared_from_this();
+
+  PushTaskBatchRequest batch_request;
+  std::vector<ClientCallback<PushTaskReply>> callbacks;
+  int64_t batch_size_bytes = 0;
+  int64_t last_seq_no = -1;
+  while (!send_queue_.empty() &&
+         static_cast<int64_t>(callbacks.size()) < batch_max_size &&
+         rpc_bytes_in_flight_ + batch_size_bytes < kMaxBytesInFlight) {
+    auto pair = std::move(*send_queue_.begin());
+    send_queue_.pop_front();
+
+    auto request = std::move(pair.first);
+    batch_size_bytes += RequestSizeInBytes(*request);
+    last_seq_no = request->sequence_number();
+    request->set_client_processed_up_to(max_finished_seq_no_.value());
+    if (batch_request.intended_worker_id().empty()) {
+      batch_request.set_intended_worker_id(request->intended_worker_id());
+    }
+    *batch_request.add_tasks() = std::move(*request);
+    callbacks.push_back(std::move(pair.second));
+  }
+  rpc_bytes_in_flight_ += batch_size_bytes;
+
+  auto rpc_callback = [this,
+                       this_ptr,
+                       last_seq_no,
+                       batch_size_bytes,
+                       callbacks = std::move(callbacks)](
+                          Status status, rpc::PushTaskBatchReply &&reply) {
+    {
+      absl::MutexLock lk(&mutex_);
+      if (last_seq_no > max_finished_seq_no_) {
+        max_finished_seq_no_ = last_seq_no;
+      }
+      rpc_bytes_in_flight_ -= batch_size_bytes;
+      RAY_CHECK(rpc_bytes_in_flight_ >= 0);
+    }
+    SendRequests();
+    // Unpack the per-task replies in order. On RPC failure the reply may be
+    // empty; every task then sees the same error status, as it would have
+    // with individual PushTask RPCs.
+    for (size_t i = 0; i < callbacks.size(); i++) {
+      rpc::PushTaskReply task_reply;
+      if (static_cast<int>(i) < reply.task_replies_size()) {
+        task_reply = std::move(*reply.mutable_task_replies(i));
+      }
+      callbacks[i](status, std::move(task_reply));
+    }
+  };
+
+  RAY_UNUSED(INVOKE_RPC_CALL(CoreWorkerService,
+                             PushTaskBatch,
+                             batch_request,
+                             std::move(rpc_callback),
+                             grpc_client_,
+                             /*method_timeout_ms*/ -1));
+}
+
 }  // namespace rpc
 }  // namespace ray
@@ -22,6 +22,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
+#include "ray/common/ray_config.h"
 #include "ray/core_worker_rpc_client/core_worker_client_interface.h"
 #include "ray/rpc/retryable_grpc_client.h"
 #include "ray/rpc/rpc_callback_types.h"
@@ -37,6 +38,12 @@ inline constexpr int64_t kMaxBytesInFlight = 16L * 1024 * 1024;
 /// The base size in bytes per request.
 inline constexpr int64_t kBaseRequestSize = 1024;
 
+/// Path of the Unix domain socket a core worker's gRPC server listens on when
+/// the same-node socket fast lane is enabled (see
+/// `RAY_core_worker_same_node_socket_dir`). Shared by the server setup and
+/// clients so both sides derive the same path from the worker's port.
+std::string CoreWorkerSameNodeSocketPath(const std::string &socket_dir, int port);
+
 /// Client used for communicating with a remote worker server.
 class CoreWorkerClient : public std::enable_shared_from_this<CoreWorkerClient>,
                          public CoreWorkerClientInterface {
@@ -132,6 +139,12 @@ class CoreWorkerClient : public std::enable_shared_from_this<CoreWorkerClient>,
                                    /*method_timeout_ms*/ -1,
                                    override)
 
+  VOID_RPC_CLIENT_METHOD(CoreWorkerService,
+                         ForwardInlineResult,
+                         grpc_client_,
+                         /*method_timeout_ms*/ -1,
+                         override)
+
   VOID_RPC_CLIENT_METHOD(CoreWorkerService,
                          RegisterMutableObjectReader,
                          grpc_client_,
@@ -216,9 +229,17 @@ class CoreWorkerClient : public std::enable_shared_from_this<CoreWorkerClient>,
   /// The client will guarantee no more than kMaxBytesInFlight bytes of RPCs are being
   /// sent at once. This prevents the server scheduling queue from being overwhelmed.
   /// See direct_actor.proto for a description of the ordering protocol.
+  ///
+  /// When `push_task_rpc_batch_max_size` is > 1 and several requests are
+  /// queued, consecutive requests are coalesced into one PushTaskBatch RPC
+  /// (up to the configured size), which the server unpacks in order.
   void SendRequests();
 
  private:
+  /// Coalesce up to batch_max_size queued requests into one PushTaskBatch
+  /// RPC. Must only be called with at least two requests queued.
+  void SendBatchRequest(int64_t batch_max_size) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   /// Protects against unsafe concurrent access from the callback thread.
   absl::Mutex mutex_;
 
@@ -239,6 +260,11 @@ class CoreWorkerClient : public std::enable_shared_from_this<CoreWorkerClient>,
 
   /// The max sequence number we have processed responses for.
   std::optional<int64_t> max_finished_seq_no_ ABSL_GUARDED_BY(mutex_);
+
+  /// Maximum number of queued requests coalesced into one PushTaskBatch RPC.
+  /// Batching is enabled when this is > 1. Cached at construction.
+  const int64_t push_task_batch_max_size_ =
+      ::RayConfig::instance().push_task_rpc_batch_max_size();
 };
 
 }  // namespace rpc
@@ -0,0 +1,120 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "rust/cxx.h"
+
+// Include the generated CXX bridge headers
+#include "src/ray/ffi/callbacks_bridge_gen.h"
+#include "src/ray/ffi/status_bridge_gen.h"
+
+namespace ray {
+
+/// A batch of async operation completions drained from a RustCompletionRing.
+///
+/// The batch is read-only. Returning it to the ring it came from via
+/// RustCompletionRing::Recycle puts the pooled entry storage (including
+/// message allocations) back for reuse; a batch that is simply destroyed
+/// frees its entries instead, which is safe but defeats the pooling.
+class RustCompletionBatch {
+ public:
+  /// Number of completions in the batch.
+  size_t Size() const { return ffi::completion_batch_len(*impl_); }
+
+  /// Caller-assigned id of the operation at `index`.
+  uint64_t OperationId(size_t index) const {
+    return ffi::completion_batch_operation_id(*impl_, index);
+  }
+
+  /// Status code of the operation at `index`.
+  ffi::StatusCode Code(size_t index) const {
+    return static_cast<ffi::StatusCode>(ffi::completion_batch_code(*impl_, index));
+  }
+
+  /// Whether the operation at `index` completed successfully.
+  bool IsOk(size_t index) const { return Code(index) == ffi::StatusCode::Ok; }
+
+  /// Error message of the operation at `index`; empty for OK completions.
+  std::string Message(size_t index) const {
+    return static_cast<std::string>(ffi::completion_batch_message(*impl_, index));
+  }
+
+ private:
+  friend class RustCompletionRing;
+
+  explicit RustCompletionBatch(rust::Box<ffi::RustCompletionBatch> impl)
+      : impl_(std::move(impl)) {}
+
+  rust::Box<ffi::RustCompletionBatch> impl_;
+};
+
+/// Batched completion ring backed by the Rust implementation.
+///
+/// Replaces one C++->Rust callback invocation per completed async operation
+/// with a ring the producer fills via Push and the consumer empties with a
+/// single Drain call, amortizing the FFI boundary-crossing cost across the
+/// whole batch. Entry storage is pooled on the Rust side, so a warmed-up
+/// ring allocates nothing on the push path.
+///
+/// The ring is not internally synchronized; callers serialize access the
+/// same way they would around the per-operation callbacks this replaces.
+class RustCompletionRing {
+ public:
+  /// Create a ring holding at most `capacity` pending completions.
+  explicit RustCompletionRing(size_t capacity)
+      : impl_(ffi::completion_ring_new(capacity)) {}
+
+  /// Record a completed operation. Returns false (and counts a drop) if the
+  /// ring is full; the producer should drain before retrying.
+  bool Push(uint64_t operation_id,
+            ffi::StatusCode code,
+            const std::string &message) {
+    return ffi::completion_ring_push(
+        *impl_, operation_id, static_cast<int8_t>(code), message);
+  }
+
+  /// Record a successful completion without a message.
+  bool PushOk(uint64_t operation_id) {
+    return Push(operation_id, ffi::StatusCode::Ok, "");
+  }
+
+  /// Number of pending completions.
+  size_t Size() const { return ffi::completion_ring_len(*impl_); }
+
+  /// Maximum number of pending completions.
+  size_t Capacity() const { return ffi::completion_ring_capacity(*impl_); }
+
+  /// Number of completions rejected because the ring was full.
+  uint64_t Dropped() const { return ffi::completion_ring_dropped(*impl_); }
+
+  /// Take all pending completions as one batch, leaving the ring empty.
+  RustCompletionBatch Drain() {
+    return RustCompletionBatch(ffi::completion_ring_drain(*impl_));
+  }
+
+  /// Return a drained batch's entry storage to the ring's pool.
+  void Recycle(RustCompletionBatch &&batch) {
+    ffi::completion_ring_recycle(*impl_, std::move(batch.impl_));
+  }
+
+ private:
+  rust::Box<ffi::RustCompletionRing> impl_;
+};
+
+}  // namespace ray
@@ -100,6 +100,67 @@ class RustObjectStoreStats {
   rust::Box<ffi::RustObjectStoreStats> impl_;
 };
 
+/// Borrowed, zero-copy view of an object's memory in a RustObjectStore.
+///
+/// Holds a pin on the object for its lifetime, so the object cannot be
+/// deleted underneath it; the data and metadata pointers reference the
+/// store's allocation directly and no bytes cross the FFI boundary. The
+/// object's sections are contiguous: metadata starts right after the data.
+/// Move-only, and must not outlive the store it was pinned from.
+class RustPlasmaBufferView {
+ public:
+  RustPlasmaBufferView(ffi::RustObjectStore &store,
+                       rust::Box<ffi::RustPinnedObjectView> impl)
+      : store_(&store), impl_(std::move(impl)) {}
+
+  RustPlasmaBufferView(RustPlasmaBufferView &&other) noexcept
+      : store_(other.store_), impl_(std::move(other.impl_)) {
+    other.store_ = nullptr;
+  }
+
+  RustPlasmaBufferView(const RustPlasmaBufferView &) = delete;
+  RustPlasmaBufferView &operator=(const RustPlasmaBufferView &) = delete;
+  RustPlasmaBufferView &operator=(RustPlasmaBufferView &&) = delete;
+
+  ~RustPlasmaBufferView() {
+    if (store_ != nullptr && ok()) {
+      ffi::object_store_unpin_object(*store_, ffi::pinned_view_token(*impl_));
+    }
+  }
+
+  bool ok() const { return ffi::pinned_view_success(*impl_); }
+
+  RustPlasmaErrorCode error_code() const {
+    return static_cast<RustPlasmaErrorCode>(ffi::pinned_view_error_code(*impl_));
+  }
+
+  std::string error_message() const {
+    return std::string(ffi::pinned_view_error_message(*impl_));
+  }
+
+  /// Pin token backing this view; released when the view is destroyed.
+  uint64_t token() const { return ffi::pinned_view_token(*impl_); }
+
+  const uint8_t *data() const {
+    return reinterpret_cast<const uint8_t *>(ffi::pinned_view_address(*impl_));
+  }
+
+  /// Writable pointer to the data section; valid until the object is sealed.
+  uint8_t *mutable_data() {
+    return reinterpret_cast<uint8_t *>(ffi::pinned_view_address(*impl_));
+  }
+
+  size_t data_size() const { return ffi::pinned_view_data_size(*impl_); }
+
+  const uint8_t *metadata() const { return data() + data_size(); }
+
+  size_t metadata_size() const { return ffi::pinned_view_metadata_size(*impl_); }
+
+ private:
+  ffi::RustObjectStore *store_;
+  rust::Box<ffi::RustPinnedObjectView> impl_;
+};
+
 /// Drop-in replacement for plasma ObjectStore backed by Rust implementation.
 class RustObjectStore {
  public:
@@ -202,6 +263,16 @@ class RustObjectStore {
     return ffi::object_store_evict(*impl_, bytes_needed);
   }
 
+  /// Pin an object and borrow a zero-copy view of its memory. The object is
+  /// pinned (and undeletable) until the returned view is destroyed. Unsealed
+  /// objects may be pinned to write their data in place before sealing.
+  RustPlasmaBufferView PinObjectView(const std::string &object_id_binary) {
+    rust::Slice<const uint8_t> id_slice(
+        reinterpret_cast<const uint8_t *>(object_id_binary.data()),
+        object_id_binary.size());
+    return RustPlasmaBufferView(*impl_, ffi::object_store_pin_object(*impl_, id_slice));
+  }
+
   /// Get statistics snapshot.
   RustObjectStoreStats GetStats() const {
     return RustObjectStoreStats(ffi::object_store_get_stats(*impl_));
@@ -0,0 +1,106 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust FFI tests for the batched completion ring.
+
+#include "gtest/gtest.h"
+#include "ray/ffi/rust_callbacks.h"
+
+namespace ray {
+
+class RustCompletionRingTest : public ::testing::Test {};
+
+TEST_F(RustCompletionRingTest, PushAndDrainBatch) {
+  RustCompletionRing ring(/*capacity=*/16);
+  EXPECT_EQ(ring.Size(), 0u);
+  EXPECT_EQ(ring.Capacity(), 16u);
+
+  EXPECT_TRUE(ring.PushOk(1));
+  EXPECT_TRUE(ring.Push(2, ffi::StatusCode::ObjectNotFound, "object not found"));
+  EXPECT_TRUE(ring.Push(3, ffi::StatusCode::IOError, "io failed"));
+  EXPECT_EQ(ring.Size(), 3u);
+
+  RustCompletionBatch batch = ring.Drain();
+  EXPECT_EQ(ring.Size(), 0u);
+  ASSERT_EQ(batch.Size(), 3u);
+
+  EXPECT_EQ(batch.OperationId(0), 1u);
+  EXPECT_TRUE(batch.IsOk(0));
+  EXPECT_EQ(batch.Message(0), "");
+
+  EXPECT_EQ(batch.OperationId(1), 2u);
+  EXPECT_FALSE(batch.IsOk(1));
+  EXPECT_EQ(batch.Code(1), ffi::StatusCode::ObjectNotFound);
+  EXPECT_EQ(batch.Message(1), "object not found");
+
+  EXPECT_EQ(batch.OperationId(2), 3u);
+  EXPECT_EQ(batch.Code(2), ffi::StatusCode::IOError);
+
+  ring.Recycle(std::move(batch));
+}
+
+TEST_F(RustCompletionRingTest, FullRingCountsDrops) {
+  RustCompletionRing ring(/*capacity=*/2);
+  EXPECT_TRUE(ring.PushOk(1));
+  EXPECT_TRUE(ring.PushOk(2));
+  EXPECT_FALSE(ring.PushOk(3));
+  EXPECT_EQ(ring.Dropped(), 1u);
+
+  // Draining makes room again.
+  ring.Recycle(ring.Drain());
+  EXPECT_TRUE(ring.PushOk(3));
+  EXPECT_EQ(ring.Dropped(), 1u);
+}
+
+TEST_F(RustCompletionRingTest, RecycledEntriesAreReused) {
+  RustCompletionRing ring(/*capacity=*/4);
+  EXPECT_TRUE(ring.Push(1, ffi::StatusCode::IOError, "first error message"));
+  ring.Recycle(ring.Drain());
+
+  // Pooled entries must be fully overwritten by the next push.
+  EXPECT_TRUE(ring.PushOk(2));
+  RustCompletionBatch batch = ring.Drain();
+  ASSERT_EQ(batch.Size(), 1u);
+  EXPECT_EQ(batch.OperationId(0), 2u);
+  EXPECT_TRUE(batch.IsOk(0));
+  EXPECT_EQ(batch.Message(0), "");
+  ring.Recycle(std::move(batch));
+}
+
+TEST_F(RustCompletionRingTest, ManyCompletionsAcrossBatches) {
+  RustCompletionRing ring(/*capacity=*/256);
+  uint64_t next_id = 0;
+  uint64_t drained = 0;
+  for (int round = 0; round < 4; round++) {
+    for (int i = 0; i < 256; i++) {
+      ASSERT_TRUE(ring.PushOk(next_id++));
+    }
+    RustCompletionBatch batch = ring.Drain();
+    ASSERT_EQ(batch.Size(), 256u);
+    for (size_t i = 0; i < batch.Size(); i++) {
+      EXPECT_EQ(batch.OperationId(i), drained++);
+      EXPECT_TRUE(batch.IsOk(i));
+    }
+    ring.Recycle(std::move(batch));
+  }
+  EXPECT_EQ(ring.Dropped(), 0u);
+  EXPECT_EQ(drained, 1024u);
+}
+
+}  // namespace ray
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
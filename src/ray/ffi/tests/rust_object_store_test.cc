@@ -424,6 +424,63 @@ TEST_F(RustObjectStorePassThroughTest, MultipleObjects) {
   EXPECT_TRUE(store.IsEmpty());
 }
 
+// ============================================================================
+// Borrowed-Buffer (Pin/Unpin) Tests
+// ============================================================================
+
+TEST_F(RustObjectStoreTest, PinnedViewZeroCopyWriteAndRead) {
+  std::string object_id = RandomObjectIdBinary();
+  ASSERT_TRUE(store_
+                  ->CreateObject(
+                      object_id, 64, 16, RustObjectSourceEnum::CreatedByWorker, {})
+                  .ok());
+
+  // Write through a pinned view of the unsealed object.
+  auto write_view = store_->PinObjectView(object_id);
+  ASSERT_TRUE(write_view.ok());
+  EXPECT_EQ(write_view.data_size(), 64u);
+  EXPECT_EQ(write_view.metadata_size(), 16u);
+  for (size_t i = 0; i < write_view.data_size(); i++) {
+    write_view.mutable_data()[i] = static_cast<uint8_t>(i);
+  }
+  ASSERT_TRUE(store_->SealObject(object_id).ok());
+
+  // A second view aliases the same memory: the written bytes are visible
+  // without any copy across the FFI boundary.
+  auto read_view = store_->PinObjectView(object_id);
+  ASSERT_TRUE(read_view.ok());
+  EXPECT_EQ(read_view.data(), write_view.data());
+  EXPECT_NE(read_view.token(), write_view.token());
+  for (size_t i = 0; i < read_view.data_size(); i++) {
+    EXPECT_EQ(read_view.data()[i], static_cast<uint8_t>(i));
+  }
+  EXPECT_EQ(read_view.metadata(), read_view.data() + read_view.data_size());
+}
+
+TEST_F(RustObjectStoreTest, PinnedObjectCannotBeDeleted) {
+  std::string object_id = RandomObjectIdBinary();
+  ASSERT_TRUE(store_
+                  ->CreateObject(
+                      object_id, 100, 0, RustObjectSourceEnum::CreatedByWorker, {})
+                  .ok());
+  ASSERT_TRUE(store_->SealObject(object_id).ok());
+
+  {
+    auto view = store_->PinObjectView(object_id);
+    ASSERT_TRUE(view.ok());
+    // The pin holds a reference, so deletion fails while the view is alive.
+    EXPECT_FALSE(store_->DeleteObject(object_id).ok());
+  }
+  // The view's destructor released the pin.
+  EXPECT_TRUE(store_->DeleteObject(object_id).ok());
+}
+
+TEST_F(RustObjectStoreTest, PinMissingObjectFails) {
+  auto view = store_->PinObjectView(RandomObjectIdBinary());
+  EXPECT_FALSE(view.ok());
+  EXPECT_EQ(view.error_code(), RustPlasmaErrorCode::ObjectNotFound);
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/strings/match.h"
 #include "ray/common/protobuf_utils.h"
 #include "ray/common/ray_config.h"
 #include "ray/common/task/task_spec.h"
@@ -477,6 +478,8 @@ void GcsActorManager::HandleGetActorInfo(rpc::GetActorInfoRequest request,
 
   if (ptr != nullptr) {
     *reply->mutable_actor_table_data() = ptr->GetActorTableData();
+  } else if (auto archived = destroyed_actor_archive_.Get(actor_id)) {
+    *reply->mutable_actor_table_data() = *std::move(archived);
   }
 
   RAY_LOG(DEBUG).WithField(actor_id.JobId()).WithField(actor_id)
@@ -506,11 +509,89 @@ void GcsActorManager::HandleGetAllActorInfo(rpc::GetAllActorInfoRequest request,
     if (filters.has_state() && filters.state() != data.state()) {
       return false;
     }
+    if (filters.has_name_prefix() &&
+        !absl::StartsWith(data.name(), filters.name_prefix())) {
+      return false;
+    }
     return true;
   };
 
+  if (request.show_dead_jobs() == false && request.has_start_after_actor_id()) {
+    reply->set_total(registered_actors_.size() + destroyed_actors_.size() +
+                     destroyed_actor_archive_.size());
+    // Cursor-paginated path: collect the IDs of the matching actors that sort
+    // after the cursor, then materialize only the page that is actually
+    // returned, so each poll costs O(page) serialization instead of O(table).
+    const std::string &start_after = request.start_after_actor_id();
+    size_t num_filtered = 0;
+    std::vector<ActorID> page;
+    auto consider = [&](const ActorID &actor_id, bool matches) {
+      if (actor_id.Binary() <= start_after) {
+        return;
+      }
+      if (!matches) {
+        ++num_filtered;
+        return;
+      }
+      page.push_back(actor_id);
+    };
+    for (const auto &iter : registered_actors_) {
+      consider(iter.first,
+               !request.has_filters() ||
+                   filter_fn(request.filters(), iter.second->GetActorTableData()));
+    }
+    for (const auto &iter : destroyed_actors_) {
+      consider(iter.first,
+               !request.has_filters() ||
+                   filter_fn(request.filters(), iter.second->GetActorTableData()));
+    }
+    for (const auto &iter : destroyed_actor_archive_.GetAll()) {
+      bool matches = true;
+      if (request.has_filters()) {
+        const auto &filters = request.filters();
+        // All archived actors are DEAD; match on the indexed hot fields so the
+        // rows that fail the filters are never deserialized.
+        matches = (!filters.has_actor_id() ||
+                   ActorID::FromBinary(filters.actor_id()) == iter.first) &&
+                  (!filters.has_job_id() ||
+                   JobID::FromBinary(filters.job_id()) == iter.second.GetJobID()) &&
+                  (!filters.has_state() ||
+                   filters.state() == rpc::ActorTableData::DEAD) &&
+                  (!filters.has_name_prefix() ||
+                   absl::StartsWith(iter.second.GetName(), filters.name_prefix()));
+      }
+      consider(iter.first, matches);
+    }
+    std::sort(page.begin(), page.end(), [](const ActorID &left, const ActorID &right) {
+      return left.Binary() < right.Binary();
+    });
+    if (page.size() > limit) {
+      page.resize(limit);
+      reply->set_next_start_after_actor_id(page.back().Binary());
+    }
+    for (const auto &actor_id : page) {
+      auto registered_iter = registered_actors_.find(actor_id);
+      if (registered_iter != registered_actors_.end()) {
+        *reply->add_actor_table_data() = registered_iter->second->GetActorTableData();
+        continue;
+      }
+      auto destroyed_iter = destroyed_actors_.find(actor_id);
+      if (destroyed_iter != destroyed_actors_.end()) {
+        *reply->add_actor_table_data() = destroyed_iter->second->GetActorTableData();
+        continue;
+      }
+      RAY_CHECK(destroyed_actor_archive_.GetAll().at(actor_id).MaterializeTo(
+          reply->add_actor_table_data()));
+    }
+    reply->set_num_filtered(num_filtered);
+    RAY_LOG(DEBUG) << "Finished getting a page of actor info.";
+    GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
+    return;
+  }
+
   if (request.show_dead_jobs() == false) {
-    size_t total_actors = registered_actors_.size() + destroyed_actors_.size();
+    size_t total_actors = registered_actors_.size() + destroyed_actors_.size() +
+                          destroyed_actor_archive_.size();
     reply->set_total(total_actors);
 
     size_t count = 0;
@@ -545,6 +626,31 @@ void GcsActorManager::HandleGetAllActorInfo(rpc::GetAllActorInfoRequest request,
       count += 1;
       *reply->add_actor_table_data() = iter.second->GetActorTableData();
     }
+
+    // Archived actors are filtered on the indexed hot fields and only
+    // materialized from their serialized rows once they are actually returned.
+    for (const auto &iter : destroyed_actor_archive_.GetAll()) {
+      if (count >= limit) {
+        break;
+      }
+      if (request.has_filters()) {
+        const auto &filters = request.filters();
+        // All archived actors are DEAD.
+        if ((filters.has_actor_id() &&
+             ActorID::FromBinary(filters.actor_id()) != iter.first) ||
+            (filters.has_job_id() &&
+             JobID::FromBinary(filters.job_id()) != iter.second.GetJobID()) ||
+            (filters.has_state() && filters.state() != rpc::ActorTableData::DEAD) ||
+            (filters.has_name_prefix() &&
+             !absl::StartsWith(iter.second.GetName(), filters.name_prefix()))) {
+          ++num_filtered;
+          continue;
+        }
+      }
+
+      count += 1;
+      RAY_CHECK(iter.second.MaterializeTo(reply->add_actor_table_data()));
+    }
     reply->set_num_filtered(num_filtered);
     RAY_LOG(DEBUG) << "Finished getting all actor info.";
     GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
@@ -1342,9 +1448,7 @@ void GcsActorManager::OnNodeDead(std::shared_ptr<const rpc::GcsNodeInfo> node,
   }
 
   for (auto &actor_id : scheduling_actor_ids) {
-    RestartActor(actor_id,
-                 /*need_reschedule=*/true,
-                 GenNodeDiedCause(GetActor(actor_id), node));
+    RestartActorOnNodeDeath(actor_id, GenNodeDiedCause(GetActor(actor_id), node));
   }
 
   // Try reconstructing all workers created on the node.
@@ -1369,9 +1473,8 @@ void GcsActorManager::OnNodeDead(std::shared_ptr<const rpc::GcsNodeInfo> node,
 
     for (auto &entry : created_actors) {
       // Reconstruct the removed actor.
-      RestartActor(entry.second,
-                   /*need_reschedule=*/true,
-                   GenNodeDiedCause(GetActor(entry.second), node));
+      RestartActorOnNodeDeath(entry.second,
+                              GenNodeDiedCause(GetActor(entry.second), node));
     }
   }
 
@@ -1414,6 +1517,40 @@ void GcsActorManager::OnNodeDead(std::shared_ptr<const rpc::GcsNodeInfo> node,
   }
 }
 
+void GcsActorManager::RestartActorOnNodeDeath(const ActorID &actor_id,
+                                              const rpc::ActorDeathCause &death_cause) {
+  if (RayConfig::instance().gcs_actor_restart_on_node_death_max_concurrency() == 0) {
+    RestartActor(actor_id, /*need_reschedule=*/true, death_cause);
+    return;
+  }
+  pending_node_death_restarts_.emplace_back(actor_id, death_cause);
+  DrainNodeDeathRestartQueue();
+}
+
+void GcsActorManager::DrainNodeDeathRestartQueue() {
+  if (draining_node_death_restarts_) {
+    return;
+  }
+  draining_node_death_restarts_ = true;
+  const size_t max_concurrency =
+      RayConfig::instance().gcs_actor_restart_on_node_death_max_concurrency();
+  while (!pending_node_death_restarts_.empty() &&
+         (max_concurrency == 0 || inflight_node_death_restarts_ < max_concurrency)) {
+    auto [actor_id, death_cause] = std::move(pending_node_death_restarts_.front());
+    pending_node_death_restarts_.pop_front();
+    inflight_node_death_restarts_++;
+    RestartActor(actor_id,
+                 /*need_reschedule=*/true,
+                 death_cause,
+                 /*done_callback=*/[this]() {
+                   RAY_CHECK(inflight_node_death_restarts_ > 0);
+                   inflight_node_death_restarts_--;
+                   DrainNodeDeathRestartQueue();
+                 });
+  }
+  draining_node_death_restarts_ = false;
+}
+
 void GcsActorManager::SetPreemptedAndPublish(const NodeID &node_id) {
   // The node has received a drain request, so we mark all of its actors
   // preempted. This state will be published to the raylets so that the
@@ -1750,11 +1887,19 @@ void GcsActorManager::Initialize(const GcsInitData &gcs_init_data) {
       }
     } else {
       dead_actors.push_back(actor_id);
-      auto actor = std::make_shared<GcsActor>(
-          actor_table_data, actor_state_counter_, ray_event_recorder_, session_name_);
-      destroyed_actors_.emplace(actor_id, actor);
-      sorted_destroyed_actor_list_.emplace_back(
-          actor_id, static_cast<int64_t>(actor_table_data.timestamp()));
+      if (RayConfig::instance().gcs_destroyed_actor_archive_enabled()) {
+        destroyed_actor_archive_.Add(actor_table_data);
+        // Keep the DEAD count that constructing a GcsActor would have
+        // contributed to the state counter.
+        actor_state_counter_->Increment(
+            std::make_pair(rpc::ActorTableData::DEAD, actor_table_data.class_name()));
+      } else {
+        auto actor = std::make_shared<GcsActor>(
+            actor_table_data, actor_state_counter_, ray_event_recorder_, session_name_);
+        destroyed_actors_.emplace(actor_id, actor);
+        sorted_destroyed_actor_list_.emplace_back(
+            actor_id, static_cast<int64_t>(actor_table_data.timestamp()));
+      }
     }
   }
   if (!dead_actors.empty()) {
@@ -1765,6 +1910,7 @@ void GcsActorManager::Initialize(const GcsInitData &gcs_init_data) {
                                        const std::pair<ActorID, int64_t> &right) {
     return left.second < right.second;
   });
+  destroyed_actor_archive_.SortByTimestamp();
 
   // Notify raylets to release unused workers.
   gcs_actor_scheduler_->ReleaseUnusedActorWorkers(node_to_workers);
@@ -1910,6 +2056,20 @@ void GcsActorManager::KillActor(const ActorID &actor_id, bool force_kill) {
 }
 
 void GcsActorManager::AddDestroyedActorToCache(const std::shared_ptr<GcsActor> &actor) {
+  if (RayConfig::instance().gcs_destroyed_actor_archive_enabled()) {
+    // Keep only the serialized row; the GcsActor and its deserialized proto
+    // are released once the caller drops its reference.
+    if (destroyed_actor_archive_.size() >=
+        RayConfig::instance().maximum_gcs_destroyed_actor_cached_count()) {
+      if (auto evicted_actor_id = destroyed_actor_archive_.EvictOldest()) {
+        gcs_table_storage_->ActorTable().Delete(*evicted_actor_id,
+                                                {[](auto) {}, io_context_});
+      }
+    }
+    destroyed_actor_archive_.Add(actor->GetActorTableData());
+    return;
+  }
+
   if (destroyed_actors_.size() >=
       RayConfig::instance().maximum_gcs_destroyed_actor_cached_count()) {
     const auto &actor_id = sorted_destroyed_actor_list_.front().first;
@@ -2017,7 +2177,8 @@ std::string GcsActorManager::DebugString() const {
          << "\n- ListNamedActors request count: "
          << counts_[CountType::LIST_NAMED_ACTORS_REQUEST]
          << "\n- Registered actors count: " << registered_actors_.size()
-         << "\n- Destroyed actors count: " << destroyed_actors_.size()
+         << "\n- Destroyed actors count: "
+         << destroyed_actors_.size() + destroyed_actor_archive_.size()
          << "\n- Named actors count: " << num_named_actors
          << "\n- Unresolved actors count: " << unresolved_actors_.size()
          << "\n- Pending actors count: " << GetPendingActorsCount()
@@ -2034,7 +2195,9 @@ std::string GcsActorManager::DebugString() const {
 void GcsActorManager::RecordMetrics() const {
   gcs_actor_by_state_gauge_.Record(registered_actors_.size(), {{"State", "Registered"}});
   gcs_actor_by_state_gauge_.Record(created_actors_.size(), {{"State", "Created"}});
-  gcs_actor_by_state_gauge_.Record(destroyed_actors_.size(), {{"State", "Destroyed"}});
+  gcs_actor_by_state_gauge_.Record(destroyed_actors_.size() +
+                                       destroyed_actor_archive_.size(),
+                                   {{"State", "Destroyed"}});
   gcs_actor_by_state_gauge_.Record(unresolved_actors_.size(), {{"State", "Unresolved"}});
   gcs_actor_by_state_gauge_.Record(GetPendingActorsCount(), {{"State", "Pending"}});
   if (usage_stats_client_ != nullptr) {
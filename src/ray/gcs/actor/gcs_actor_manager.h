@@ -16,6 +16,7 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <deque>
 #include <list>
 #include <memory>
 #include <optional>
@@ -31,6 +32,7 @@
 #include "ray/core_worker_rpc_client/core_worker_client_pool.h"
 #include "ray/gcs/actor/gcs_actor.h"
 #include "ray/gcs/actor/gcs_actor_scheduler.h"
+#include "ray/gcs/actor/gcs_destroyed_actor_archive.h"
 #include "ray/gcs/gcs_function_manager.h"
 #include "ray/gcs/gcs_init_data.h"
 #include "ray/gcs/gcs_table_storage.h"
@@ -327,6 +329,16 @@ class GcsActorManager : public rpc::ActorInfoGcsServiceHandler,
                     std::optional<rpc::events::ActorLifecycleEvent::RestartReason>
                         restart_reason = std::nullopt);
 
+  /// Restart an actor that was killed by a node death. When
+  /// gcs_actor_restart_on_node_death_max_concurrency is set, restarts beyond
+  /// the limit are queued and started as in-flight restarts finish, so a
+  /// large node loss does not flood the scheduler and runtime env agent.
+  void RestartActorOnNodeDeath(const ActorID &actor_id,
+                               const rpc::ActorDeathCause &death_cause);
+
+  /// Start queued node-death restarts while below the configured concurrency.
+  void DrainNodeDeathRestartQueue();
+
   /// Remove the specified actor from `unresolved_actors_`.
   ///
   /// \param actor The actor to be removed.
@@ -449,11 +461,18 @@ class GcsActorManager : public rpc::ActorInfoGcsServiceHandler,
   /// All registered actors (unresolved and pending actors are also included).
   /// TODO(swang): Use unique_ptr instead of shared_ptr.
   absl::flat_hash_map<ActorID, std::shared_ptr<GcsActor>> registered_actors_;
-  /// All destroyed actors.
+  /// All destroyed actors. Unused when `gcs_destroyed_actor_archive_enabled` is
+  /// set; destroyed actors then live in `destroyed_actor_archive_` instead.
   absl::flat_hash_map<ActorID, std::shared_ptr<GcsActor>> destroyed_actors_;
   /// The actors are sorted according to the timestamp, and the oldest is at the head of
   /// the list.
   std::list<std::pair<ActorID, int64_t>> sorted_destroyed_actor_list_;
+  /// Compact storage for destroyed actors when
+  /// `gcs_destroyed_actor_archive_enabled` is set: serialized rows plus a small
+  /// index of hot fields, materialized lazily when a query returns them.
+  /// Archived actors are no longer reachable via `GetActor()`; they are only
+  /// served to info queries.
+  GcsDestroyedActorArchive destroyed_actor_archive_;
   /// Maps actor names to their actor ID for lookups by name, first keyed by their
   /// namespace.
   absl::flat_hash_map<std::string, absl::flat_hash_map<std::string, ActorID>>
@@ -466,6 +485,15 @@ class GcsActorManager : public rpc::ActorInfoGcsServiceHandler,
       unresolved_actors_;
   /// The pending actors which will not be scheduled until there's a resource change.
   std::vector<std::shared_ptr<GcsActor>> pending_actors_;
+  /// Node-death restarts waiting for an in-flight restart to finish, used when
+  /// gcs_actor_restart_on_node_death_max_concurrency is set.
+  std::deque<std::pair<ActorID, rpc::ActorDeathCause>> pending_node_death_restarts_;
+  /// Number of node-death restarts issued but whose state flush has not been
+  /// acknowledged yet.
+  size_t inflight_node_death_restarts_ = 0;
+  /// Guards DrainNodeDeathRestartQueue against re-entrant draining when a
+  /// restart completes synchronously.
+  bool draining_node_death_restarts_ = false;
   /// Map contains the relationship of node and created actors. Each node ID
   /// maps to a map from worker ID to the actor created on that worker.
   absl::flat_hash_map<NodeID, absl::flat_hash_map<WorkerID, ActorID>> created_actors_;
@@ -14,6 +14,7 @@
 
 #include "ray/gcs/actor/gcs_actor_scheduler.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -77,7 +78,11 @@ void GcsActorScheduler::Schedule(std::shared_ptr<GcsActor> actor) {
 
   // Lease worker directly from the node.
   actor->SetGrantOrReject(false);
-  LeaseWorkerFromNode(actor, node.value());
+  if (RayConfig::instance().gcs_actor_scheduler_batch_lease_enabled()) {
+    EnqueueLeaseRequest(std::move(actor), node.value());
+  } else {
+    LeaseWorkerFromNode(actor, node.value());
+  }
 }
 
 NodeID GcsActorScheduler::SelectForwardingNode(std::shared_ptr<GcsActor> actor) {
@@ -270,6 +275,47 @@ void GcsActorScheduler::LeaseWorkerFromNode(
       0);
 }
 
+void GcsActorScheduler::EnqueueLeaseRequest(
+    std::shared_ptr<GcsActor> actor, std::shared_ptr<const rpc::GcsNodeInfo> node) {
+  auto node_id = NodeID::FromBinary(node->node_id());
+  auto &batch = pending_lease_requests_[node_id];
+  batch.node = std::move(node);
+  batch.actors.emplace_back(std::move(actor));
+  if (!lease_flush_scheduled_) {
+    lease_flush_scheduled_ = true;
+    io_context_.post([this] { FlushLeaseRequestBatches(); },
+                     "GcsActorScheduler.FlushLeaseRequestBatches");
+  }
+}
+
+void GcsActorScheduler::FlushLeaseRequestBatches() {
+  lease_flush_scheduled_ = false;
+  auto pending_lease_requests = std::move(pending_lease_requests_);
+  pending_lease_requests_.clear();
+  for (auto &[node_id, batch] : pending_lease_requests) {
+    // Group the batch by runtime env so that the raylet receives the lease requests
+    // of actors sharing a runtime env back-to-back.
+    std::stable_sort(
+        batch.actors.begin(),
+        batch.actors.end(),
+        [](const std::shared_ptr<GcsActor> &lhs, const std::shared_ptr<GcsActor> &rhs) {
+          return lhs->GetCreationTaskSpecification().SerializedRuntimeEnv() <
+                 rhs->GetCreationTaskSpecification().SerializedRuntimeEnv();
+        });
+    for (auto &actor : batch.actors) {
+      // The actor may have been canceled (e.g. on node death) after it was enqueued.
+      // In that case it has already been removed from the leasing map and will be
+      // rescheduled by the actor manager, so just skip it.
+      auto iter = node_to_actors_when_leasing_.find(node_id);
+      if (iter == node_to_actors_when_leasing_.end() ||
+          iter->second.count(actor->GetActorID()) == 0) {
+        continue;
+      }
+      LeaseWorkerFromNode(actor, batch.node);
+    }
+  }
+}
+
 void GcsActorScheduler::RetryLeasingWorkerFromNode(
     std::shared_ptr<GcsActor> actor, std::shared_ptr<const rpc::GcsNodeInfo> node) {
   RAY_UNUSED(execute_after(
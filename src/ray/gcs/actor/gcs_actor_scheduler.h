@@ -236,6 +236,21 @@ class GcsActorScheduler : public GcsActorSchedulerInterface {
   void LeaseWorkerFromNode(std::shared_ptr<GcsActor> actor,
                            std::shared_ptr<const rpc::GcsNodeInfo> node);
 
+  /// Enqueue a worker lease request so that it is dispatched together with the
+  /// other lease requests issued in the same event loop iteration. Only used when
+  /// `gcs_actor_scheduler_batch_lease_enabled` is true.
+  ///
+  /// \param actor A description of the actor to create.
+  /// \param node The node that the worker will be leased from.
+  void EnqueueLeaseRequest(std::shared_ptr<GcsActor> actor,
+                           std::shared_ptr<const rpc::GcsNodeInfo> node);
+
+  /// Dispatch all enqueued lease requests. The pending actors of each node are
+  /// grouped by runtime env and their lease requests are sent to the raylet
+  /// back-to-back, so the creation task dispatch of early grants interleaves with
+  /// the remaining lease replies.
+  void FlushLeaseRequestBatches();
+
   /// Handler to process a worker lease reply.
   ///
   /// \param actor The actor to be scheduled.
@@ -350,6 +365,17 @@ class GcsActorScheduler : public GcsActorSchedulerInterface {
   GcsActorSchedulerFailureCallback schedule_failure_handler_;
   /// The handler to handle the successful scheduling.
   GcsActorSchedulerSuccessCallback schedule_success_handler_;
+  /// A batch of lease requests that have been enqueued for one node but not yet
+  /// dispatched. Only used when `gcs_actor_scheduler_batch_lease_enabled` is true.
+  struct PendingLeaseBatch {
+    std::shared_ptr<const rpc::GcsNodeInfo> node;
+    std::vector<std::shared_ptr<GcsActor>> actors;
+  };
+  /// The enqueued lease requests, keyed by the ID of the target node.
+  absl::flat_hash_map<NodeID, PendingLeaseBatch> pending_lease_requests_;
+  /// Whether a flush of `pending_lease_requests_` has already been posted to the
+  /// event loop.
+  bool lease_flush_scheduled_ = false;
   /// The nodes which are releasing unused workers.
   absl::flat_hash_set<NodeID> nodes_of_releasing_unused_workers_;
   /// The cached raylet clients used to communicate with raylet.
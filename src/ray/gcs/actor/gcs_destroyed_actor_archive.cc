@@ -0,0 +1,70 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/actor/gcs_destroyed_actor_archive.h"
+
+#include <string>
+#include <utility>
+
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace gcs {
+
+void GcsDestroyedActorArchive::Add(const rpc::ActorTableData &actor_table_data) {
+  const auto actor_id = ActorID::FromBinary(actor_table_data.actor_id());
+  if (actors_.contains(actor_id)) {
+    return;
+  }
+  std::string serialized_row;
+  RAY_CHECK(actor_table_data.SerializeToString(&serialized_row));
+  const auto timestamp = static_cast<int64_t>(actor_table_data.timestamp());
+  actors_.emplace(actor_id,
+                  ArchivedActor(std::move(serialized_row),
+                                JobID::FromBinary(actor_table_data.job_id()),
+                                actor_table_data.name(),
+                                timestamp));
+  eviction_order_.emplace_back(actor_id, timestamp);
+}
+
+std::optional<rpc::ActorTableData> GcsDestroyedActorArchive::Get(
+    const ActorID &actor_id) const {
+  auto it = actors_.find(actor_id);
+  if (it == actors_.end()) {
+    return std::nullopt;
+  }
+  rpc::ActorTableData actor_table_data;
+  RAY_CHECK(it->second.MaterializeTo(&actor_table_data));
+  return actor_table_data;
+}
+
+std::optional<ActorID> GcsDestroyedActorArchive::EvictOldest() {
+  if (eviction_order_.empty()) {
+    return std::nullopt;
+  }
+  const auto actor_id = eviction_order_.front().first;
+  eviction_order_.pop_front();
+  actors_.erase(actor_id);
+  return actor_id;
+}
+
+void GcsDestroyedActorArchive::SortByTimestamp() {
+  eviction_order_.sort([](const std::pair<ActorID, int64_t> &left,
+                          const std::pair<ActorID, int64_t> &right) {
+    return left.second < right.second;
+  });
+}
+
+}  // namespace gcs
+}  // namespace ray
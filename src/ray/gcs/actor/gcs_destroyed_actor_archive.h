@@ -0,0 +1,105 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "ray/common/id.h"
+#include "src/ray/protobuf/gcs.pb.h"
+
+namespace ray {
+namespace gcs {
+
+/// A compact store for destroyed actors. Each actor is kept as a serialized
+/// `ActorTableData` row plus a small index of the fields that queries filter
+/// on, instead of a fully deserialized proto wrapped in a `GcsActor`. Rows are
+/// materialized back into protos lazily, only when a query actually returns
+/// the actor, so a large retained cache of finished actors costs one string
+/// per actor rather than a proto tree.
+///
+/// All archived actors are DEAD; callers can rely on that for state filters.
+/// This class is not thread-safe.
+class GcsDestroyedActorArchive {
+ public:
+  /// One archived actor: the serialized row and the hot fields queries need
+  /// without deserializing it.
+  class ArchivedActor {
+   public:
+    ArchivedActor(std::string serialized_row,
+                  JobID job_id,
+                  std::string name,
+                  int64_t timestamp)
+        : serialized_row_(std::move(serialized_row)),
+          job_id_(job_id),
+          name_(std::move(name)),
+          timestamp_(timestamp) {}
+
+    const JobID &GetJobID() const { return job_id_; }
+    const std::string &GetName() const { return name_; }
+    int64_t GetTimestamp() const { return timestamp_; }
+
+    /// Deserialize the row into `out`. Returns false if the row is corrupt,
+    /// which cannot happen for rows this process serialized.
+    bool MaterializeTo(rpc::ActorTableData *out) const {
+      return out->ParseFromString(serialized_row_);
+    }
+
+   private:
+    std::string serialized_row_;
+    JobID job_id_;
+    std::string name_;
+    int64_t timestamp_;
+  };
+
+  /// Archive a destroyed actor. If the actor is already archived, this is a
+  /// no-op.
+  void Add(const rpc::ActorTableData &actor_table_data);
+
+  /// Materialize the archived actor, or nullopt if it is not archived.
+  std::optional<rpc::ActorTableData> Get(const ActorID &actor_id) const;
+
+  bool Contains(const ActorID &actor_id) const { return actors_.contains(actor_id); }
+
+  /// All archived actors, for queries that scan and filter. Materialize rows
+  /// only after they pass the filters.
+  const absl::flat_hash_map<ActorID, ArchivedActor> &GetAll() const { return actors_; }
+
+  /// Evict the actor with the oldest timestamp. Returns its ID so the caller
+  /// can also delete it from table storage, or nullopt if the archive is
+  /// empty.
+  std::optional<ActorID> EvictOldest();
+
+  /// Re-sort the eviction order by timestamp. Needed after bulk-loading rows
+  /// in storage order on GCS restart; incremental `Add` calls already arrive
+  /// in death order.
+  void SortByTimestamp();
+
+  size_t size() const { return actors_.size(); }
+
+ private:
+  /// Archived rows keyed by actor ID.
+  absl::flat_hash_map<ActorID, ArchivedActor> actors_;
+  /// Eviction order: oldest timestamp at the head, mirroring
+  /// `sorted_destroyed_actor_list_` in `GcsActorManager`.
+  std::list<std::pair<ActorID, int64_t>> eviction_order_;
+};
+
+}  // namespace gcs
+}  // namespace ray
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <string>
@@ -606,6 +607,52 @@ TEST_F(GcsActorManagerTest, TestActorReconstruction) {
   ASSERT_TRUE(worker_client_->Reply());
 }
 
+TEST_F(GcsActorManagerTest, TestThrottledNodeDeathRestarts) {
+  RayConfig::instance().initialize(
+      R"({"gcs_actor_restart_on_node_death_max_concurrency": 1})");
+  auto job_id = JobID::FromInt(1);
+  auto node_id = NodeID::FromRandom();
+
+  // Create three alive actors on the same node.
+  std::vector<std::shared_ptr<gcs::GcsActor>> actors;
+  for (int i = 0; i < 3; i++) {
+    auto registered_actor = RegisterActor(job_id, /*max_restarts=*/1);
+    rpc::CreateActorRequest create_actor_request;
+    create_actor_request.mutable_task_spec()->CopyFrom(
+        registered_actor->GetCreationTaskSpecification().GetMessage());
+    RAY_CHECK_OK(gcs_actor_manager_->CreateActor(
+        create_actor_request,
+        [](const std::shared_ptr<gcs::GcsActor> &,
+           const rpc::PushTaskReply &,
+           const Status &) {}));
+    auto actor = mock_actor_scheduler_->actors.back();
+    mock_actor_scheduler_->actors.pop_back();
+    auto address = RandomAddress();
+    address.set_node_id(node_id.Binary());
+    actor->UpdateAddress(address);
+    gcs_actor_manager_->OnActorCreationSuccess(actor, rpc::PushTaskReply());
+    actors.push_back(actor);
+  }
+  drain_io_context();
+
+  // On node death, only one restart may be in flight at a time; the others
+  // wait until the in-flight restart's state flush is acknowledged.
+  EXPECT_CALL(*mock_actor_scheduler_, CancelOnNode(node_id));
+  OnNodeDead(node_id);
+  ASSERT_EQ(mock_actor_scheduler_->actors.size(), 1);
+
+  // Draining the io context acknowledges each restart's writes, releasing the
+  // queued restarts one by one.
+  drain_io_context();
+  ASSERT_EQ(mock_actor_scheduler_->actors.size(), 3);
+  for (const auto &actor : actors) {
+    ASSERT_EQ(actor->GetState(), rpc::ActorTableData::RESTARTING);
+  }
+
+  RayConfig::instance().initialize(
+      R"({"gcs_actor_restart_on_node_death_max_concurrency": 0})");
+}
+
 TEST_F(GcsActorManagerTest, TestActorRestartWhenOwnerDead) {
   auto job_id = JobID::FromInt(1);
   auto registered_actor = RegisterActor(job_id,
@@ -1417,6 +1464,57 @@ TEST_F(GcsActorManagerTest, TestGetAllActorInfoLimit) {
   }
 }
 
+TEST_F(GcsActorManagerTest, TestGetAllActorInfoPagination) {
+  google::protobuf::Arena arena;
+  auto job_id = JobID::FromInt(1);
+  auto num_actors = 5;
+  for (int i = 0; i < num_actors; i++) {
+    auto request1 = GenRegisterActorRequest(job_id,
+                                            /*max_restarts=*/0,
+                                            /*detached=*/true,
+                                            /*name=*/"actor_" + std::to_string(i));
+    Status status = gcs_actor_manager_->RegisterActor(request1, [](const Status &) {});
+    ASSERT_TRUE(status.ok());
+    io_service_.run_one();
+  }
+
+  auto callback = [](Status, std::function<void()>, std::function<void()>) {};
+  // Page through the actor table in actor ID order.
+  std::vector<std::string> paged_actor_ids;
+  std::string cursor;
+  for (int page = 0; page < 10; ++page) {
+    rpc::GetAllActorInfoRequest request;
+    request.set_limit(2);
+    request.set_start_after_actor_id(cursor);
+    auto &reply =
+        *google::protobuf::Arena::CreateMessage<rpc::GetAllActorInfoReply>(&arena);
+    gcs_actor_manager_->HandleGetAllActorInfo(request, &reply, callback);
+    ASSERT_LE(reply.actor_table_data().size(), 2);
+    ASSERT_EQ(reply.total(), num_actors);
+    for (const auto &data : reply.actor_table_data()) {
+      paged_actor_ids.push_back(data.actor_id());
+    }
+    if (!reply.has_next_start_after_actor_id()) {
+      break;
+    }
+    cursor = reply.next_start_after_actor_id();
+  }
+  // Every actor is returned exactly once, in actor ID order.
+  ASSERT_EQ(paged_actor_ids.size(), num_actors);
+  ASSERT_TRUE(std::is_sorted(paged_actor_ids.begin(), paged_actor_ids.end()));
+
+  // The name prefix filter is evaluated on the GCS.
+  {
+    rpc::GetAllActorInfoRequest request;
+    request.mutable_filters()->set_name_prefix("actor_1");
+    auto &reply =
+        *google::protobuf::Arena::CreateMessage<rpc::GetAllActorInfoReply>(&arena);
+    gcs_actor_manager_->HandleGetAllActorInfo(request, &reply, callback);
+    ASSERT_EQ(reply.actor_table_data().size(), 1);
+    ASSERT_EQ(reply.num_filtered(), num_actors - 1);
+  }
+}
+
 TEST_F(GcsActorManagerTest, TestKillActorWhenActorIsCreating) {
   auto job_id = JobID::FromInt(1);
   auto registered_actor = RegisterActor(job_id, /*max_restarts*/ -1);
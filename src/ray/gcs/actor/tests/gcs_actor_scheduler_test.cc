@@ -23,6 +23,7 @@
 
 #include "mock/ray/pubsub/publisher.h"
 #include "ray/common/asio/asio_util.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/test_utils.h"
 #include "ray/core_worker_rpc_client/core_worker_client_pool.h"
 #include "ray/core_worker_rpc_client/fake_core_worker_client.h"
@@ -141,7 +142,10 @@ class GcsActorSchedulerTest : public ::testing::Test {
         fake_scheduler_placement_time_ms_histogram_);
   }
 
-  void TearDown() override { io_context_->Stop(); }
+  void TearDown() override {
+    io_context_->Stop();
+    RayConfig::instance().gcs_actor_scheduler_batch_lease_enabled() = false;
+  }
 
   std::shared_ptr<gcs::GcsActor> NewGcsActor(
       const std::unordered_map<std::string, double> &required_placement_resources) {
@@ -271,6 +275,111 @@ TEST_F(GcsActorSchedulerTest, TestScheduleActorSuccess) {
   ASSERT_EQ(actor->GetWorkerID(), worker_id);
 }
 
+TEST_F(GcsActorSchedulerTest, TestBatchedLeaseDispatch) {
+  RayConfig::instance().gcs_actor_scheduler_batch_lease_enabled() = true;
+  auto node = GenNodeInfo();
+  auto node_id = NodeID::FromBinary(node->node_id());
+  gcs_node_manager_->AddNode(node);
+  ASSERT_EQ(1, gcs_node_manager_->GetAllAliveNodes().size());
+
+  auto job_id = JobID::FromInt(1);
+  auto actor1 = std::make_shared<gcs::GcsActor>(GenCreateActorRequest(job_id).task_spec(),
+                                                "",
+                                                counter,
+                                                fake_ray_event_recorder_,
+                                                "");
+  auto actor2 = std::make_shared<gcs::GcsActor>(GenCreateActorRequest(job_id).task_spec(),
+                                                "",
+                                                counter,
+                                                fake_ray_event_recorder_,
+                                                "");
+
+  // Schedule both actors within one event loop iteration, then their lease requests
+  // should be dispatched to the node in a single flush.
+  io_context_->GetIoService().post(
+      [this, actor1, actor2] {
+        gcs_actor_scheduler_->Schedule(actor1);
+        gcs_actor_scheduler_->Schedule(actor2);
+      },
+      "test");
+  WaitForCondition([&]() { return raylet_client_->num_workers_requested == 2; }, 1000);
+  ASSERT_EQ(2, raylet_client_->callbacks.size());
+
+  // Grant the first lease. The creation task dispatch of the granted worker should
+  // interleave with the outstanding lease reply.
+  ASSERT_TRUE(raylet_client_->GrantWorkerLease(node->node_manager_address(),
+                                               node->node_manager_port(),
+                                               WorkerID::FromRandom(),
+                                               node_id,
+                                               NodeID::Nil()));
+  ASSERT_EQ(1, raylet_client_->callbacks.size());
+  WaitForCondition([&]() { return worker_client_->GetNumCallbacks() == 1; }, 1000);
+  ASSERT_TRUE(worker_client_->ReplyPushTask());
+
+  // Grant the second lease and finish the creation of the second actor.
+  ASSERT_TRUE(raylet_client_->GrantWorkerLease(node->node_manager_address(),
+                                               node->node_manager_port(),
+                                               WorkerID::FromRandom(),
+                                               node_id,
+                                               NodeID::Nil()));
+  ASSERT_EQ(0, raylet_client_->callbacks.size());
+  WaitForCondition([&]() { return worker_client_->GetNumCallbacks() == 1; }, 1000);
+  ASSERT_TRUE(worker_client_->ReplyPushTask());
+
+  ASSERT_EQ(0, failure_actors_.size());
+  ASSERT_EQ(2, success_actors_.size());
+}
+
+TEST_F(GcsActorSchedulerTest, TestBatchedLeaseDispatchThroughput) {
+  RayConfig::instance().gcs_actor_scheduler_batch_lease_enabled() = true;
+  auto node = GenNodeInfo();
+  auto node_id = NodeID::FromBinary(node->node_id());
+  gcs_node_manager_->AddNode(node);
+
+  // Schedule a fleet of actors within one event loop iteration and drive all of them
+  // to creation. This exercises the creation throughput of the batched dispatch path.
+  const size_t num_actors = 32;
+  auto job_id = JobID::FromInt(1);
+  std::vector<std::shared_ptr<gcs::GcsActor>> actors;
+  for (size_t i = 0; i < num_actors; ++i) {
+    actors.emplace_back(
+        std::make_shared<gcs::GcsActor>(GenCreateActorRequest(job_id).task_spec(),
+                                        "",
+                                        counter,
+                                        fake_ray_event_recorder_,
+                                        ""));
+  }
+  io_context_->GetIoService().post(
+      [this, actors] {
+        for (const auto &actor : actors) {
+          gcs_actor_scheduler_->Schedule(actor);
+        }
+      },
+      "test");
+  WaitForCondition(
+      [&]() {
+        return raylet_client_->num_workers_requested == static_cast<int>(num_actors);
+      },
+      1000);
+  ASSERT_EQ(num_actors, raylet_client_->callbacks.size());
+
+  // Grant all the leases, then every actor creation task should be dispatched.
+  for (size_t i = 0; i < num_actors; ++i) {
+    ASSERT_TRUE(raylet_client_->GrantWorkerLease(node->node_manager_address(),
+                                                 node->node_manager_port(),
+                                                 WorkerID::FromRandom(),
+                                                 node_id,
+                                                 NodeID::Nil()));
+  }
+  WaitForCondition(
+      [&]() { return worker_client_->GetNumCallbacks() == num_actors; }, 1000);
+  for (size_t i = 0; i < num_actors; ++i) {
+    ASSERT_TRUE(worker_client_->ReplyPushTask());
+  }
+  ASSERT_EQ(0, failure_actors_.size());
+  ASSERT_EQ(num_actors, success_actors_.size());
+}
+
 TEST_F(GcsActorSchedulerTest, TestScheduleRetryWhenLeasing) {
   auto node = GenNodeInfo();
   auto node_id = NodeID::FromBinary(node->node_id());
@@ -0,0 +1,103 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/actor/gcs_destroyed_actor_archive.h"
+
+#include <gtest/gtest.h>
+
+#include "ray/common/test_utils.h"
+
+namespace ray {
+namespace gcs {
+
+namespace {
+
+rpc::ActorTableData GenActorTableData(const JobID &job_id, int64_t timestamp) {
+  rpc::ActorTableData actor_table_data;
+  const auto actor_id = ActorID::Of(job_id, RandomTaskId(), 0);
+  actor_table_data.set_actor_id(actor_id.Binary());
+  actor_table_data.set_job_id(job_id.Binary());
+  actor_table_data.set_state(rpc::ActorTableData::DEAD);
+  actor_table_data.set_class_name("ArchivedActorClass");
+  actor_table_data.set_timestamp(timestamp);
+  return actor_table_data;
+}
+
+}  // namespace
+
+TEST(GcsDestroyedActorArchiveTest, AddGetRoundTrip) {
+  GcsDestroyedActorArchive archive;
+  const auto job_id = JobID::FromInt(1);
+  const auto actor_table_data = GenActorTableData(job_id, /*timestamp=*/100);
+  const auto actor_id = ActorID::FromBinary(actor_table_data.actor_id());
+
+  archive.Add(actor_table_data);
+  ASSERT_EQ(archive.size(), 1);
+  ASSERT_TRUE(archive.Contains(actor_id));
+
+  auto materialized = archive.Get(actor_id);
+  ASSERT_TRUE(materialized.has_value());
+  ASSERT_EQ(materialized->actor_id(), actor_table_data.actor_id());
+  ASSERT_EQ(materialized->job_id(), actor_table_data.job_id());
+  ASSERT_EQ(materialized->state(), rpc::ActorTableData::DEAD);
+  ASSERT_EQ(materialized->class_name(), "ArchivedActorClass");
+
+  // Adding the same actor again is a no-op.
+  archive.Add(actor_table_data);
+  ASSERT_EQ(archive.size(), 1);
+
+  ASSERT_FALSE(archive.Get(ActorID::Of(job_id, RandomTaskId(), 0)).has_value());
+}
+
+TEST(GcsDestroyedActorArchiveTest, IndexExposesHotFields) {
+  GcsDestroyedActorArchive archive;
+  const auto job_id = JobID::FromInt(2);
+  const auto actor_table_data = GenActorTableData(job_id, /*timestamp=*/42);
+  archive.Add(actor_table_data);
+
+  const auto &all = archive.GetAll();
+  ASSERT_EQ(all.size(), 1);
+  const auto &archived = all.begin()->second;
+  ASSERT_EQ(archived.GetJobID(), job_id);
+  ASSERT_EQ(archived.GetTimestamp(), 42);
+
+  rpc::ActorTableData materialized;
+  ASSERT_TRUE(archived.MaterializeTo(&materialized));
+  ASSERT_EQ(materialized.actor_id(), actor_table_data.actor_id());
+}
+
+TEST(GcsDestroyedActorArchiveTest, EvictsOldestByTimestamp) {
+  GcsDestroyedActorArchive archive;
+  const auto job_id = JobID::FromInt(3);
+  // Add out of timestamp order, as on GCS restart.
+  const auto newer = GenActorTableData(job_id, /*timestamp=*/200);
+  const auto older = GenActorTableData(job_id, /*timestamp=*/100);
+  archive.Add(newer);
+  archive.Add(older);
+  archive.SortByTimestamp();
+
+  auto evicted = archive.EvictOldest();
+  ASSERT_TRUE(evicted.has_value());
+  ASSERT_EQ(*evicted, ActorID::FromBinary(older.actor_id()));
+  ASSERT_EQ(archive.size(), 1);
+  ASSERT_TRUE(archive.Contains(ActorID::FromBinary(newer.actor_id())));
+
+  evicted = archive.EvictOldest();
+  ASSERT_TRUE(evicted.has_value());
+  ASSERT_EQ(*evicted, ActorID::FromBinary(newer.actor_id()));
+  ASSERT_FALSE(archive.EvictOldest().has_value());
+}
+
+}  // namespace gcs
+}  // namespace ray
@@ -14,6 +14,8 @@
 
 #include "ray/gcs/gcs_health_check_manager.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -24,6 +26,20 @@
 
 namespace ray::gcs {
 
+namespace {
+
+/// Delay before retrying a probe that was deferred by the fan-out limit.
+constexpr int64_t kDeferredProbeDelayMs = 10;
+
+/// Number of inter-success intervals to observe before the phi-accrual
+/// detector starts producing suspicion levels.
+constexpr int64_t kMinPhiIntervalSamples = 3;
+
+/// Smoothing factor for the exponentially weighted interval statistics.
+constexpr double kPhiIntervalAlpha = 0.1;
+
+}  // namespace
+
 /*static*/ std::shared_ptr<GcsHealthCheckManager> GcsHealthCheckManager::Create(
     instrumented_io_context &io_service,
     std::function<void(const NodeID &)> on_node_death_callback,
@@ -31,7 +47,11 @@ namespace ray::gcs {
     int64_t initial_delay_ms,
     int64_t timeout_ms,
     int64_t period_ms,
-    int64_t failure_threshold) {
+    int64_t failure_threshold,
+    int64_t jitter_ms,
+    int64_t max_period_ms,
+    int64_t max_inflight_probes,
+    double phi_threshold) {
   return std::shared_ptr<GcsHealthCheckManager>(
       new GcsHealthCheckManager(io_service,
                                 std::move(on_node_death_callback),
@@ -39,7 +59,11 @@ namespace ray::gcs {
                                 initial_delay_ms,
                                 timeout_ms,
                                 period_ms,
-                                failure_threshold));
+                                failure_threshold,
+                                jitter_ms,
+                                max_period_ms,
+                                max_inflight_probes,
+                                phi_threshold));
 }
 
 GcsHealthCheckManager::GcsHealthCheckManager(
@@ -49,19 +73,37 @@ GcsHealthCheckManager::GcsHealthCheckManager(
     int64_t initial_delay_ms,
     int64_t timeout_ms,
     int64_t period_ms,
-    int64_t failure_threshold)
+    int64_t failure_threshold,
+    int64_t jitter_ms,
+    int64_t max_period_ms,
+    int64_t max_inflight_probes,
+    double phi_threshold)
     : io_service_(io_service),
       on_node_death_callback_(on_node_death_callback),
       initial_delay_ms_(initial_delay_ms),
       timeout_ms_(timeout_ms),
       period_ms_(period_ms),
       failure_threshold_(failure_threshold),
+      jitter_ms_(jitter_ms),
+      max_period_ms_(max_period_ms),
+      max_inflight_probes_(max_inflight_probes),
+      phi_threshold_(phi_threshold),
       health_check_rpc_latency_ms_histogram_(health_check_rpc_latency_ms_histogram) {
   RAY_CHECK(on_node_death_callback != nullptr);
   RAY_CHECK_GE(initial_delay_ms, 0);
   RAY_CHECK_GE(timeout_ms, 0);
   RAY_CHECK_GE(period_ms, 0);
   RAY_CHECK_GE(failure_threshold, 0);
+  RAY_CHECK_GE(jitter_ms, 0);
+  RAY_CHECK_GE(max_period_ms, 0);
+  RAY_CHECK_GE(max_inflight_probes, 0);
+}
+
+int64_t GcsHealthCheckManager::GetProbeJitterMs() {
+  if (jitter_ms_ <= 0) {
+    return 0;
+  }
+  return absl::Uniform<int64_t>(jitter_gen_, 0, jitter_ms_);
 }
 
 GcsHealthCheckManager::~GcsHealthCheckManager() = default;
@@ -143,10 +185,22 @@ void GcsHealthCheckManager::HealthCheckContext::StartHealthCheck() {
   if (now <= next_check_time) {
     // Update message is fresh enough, skip current check and schedule later.
     int64_t next_schedule_millisec = (next_check_time - now) / absl::Milliseconds(1);
-    timer_.expires_from_now(boost::posix_time::milliseconds(next_schedule_millisec));
+    timer_.expires_from_now(boost::posix_time::milliseconds(
+        next_schedule_millisec + manager->GetProbeJitterMs()));
+    timer_.async_wait([this](auto) { StartHealthCheck(); });
+    return;
+  }
+
+  if (manager->max_inflight_probes_ > 0 &&
+      manager->inflight_probes_ >= manager->max_inflight_probes_) {
+    // Fan-out limit reached; defer this probe with jitter so that deferred
+    // probes don't bunch up again when capacity frees.
+    timer_.expires_from_now(boost::posix_time::milliseconds(
+        kDeferredProbeDelayMs + manager->GetProbeJitterMs()));
     timer_.async_wait([this](auto) { StartHealthCheck(); });
     return;
   }
+  ++manager->inflight_probes_;
 
   // grpc context and health check response are dedicated to one single async request.
   auto context = std::make_shared<grpc::ClientContext>();
@@ -183,12 +237,11 @@ void GcsHealthCheckManager::HealthCheckContext::StartHealthCheck() {
 
         gcs_health_check_manager->io_service_.post(
             [this, status, response = std::move(response)]() {
-              if (stopped_) {
-                delete this;
-                return;
-              }
               auto mgr = manager_.lock();
-              if (mgr == nullptr) {
+              if (mgr != nullptr) {
+                --mgr->inflight_probes_;
+              }
+              if (stopped_ || mgr == nullptr) {
                 delete this;
                 return;
               }
@@ -197,17 +250,38 @@ void GcsHealthCheckManager::HealthCheckContext::StartHealthCheck() {
                              << HealthCheckResponse_ServingStatus_Name(
                                     response->status());
 
+              const auto check_done_time = absl::Now();
               if (status.ok() && response->status() == HealthCheckResponse::SERVING) {
                 // Health check passed.
                 health_check_remaining_ = mgr->failure_threshold_;
+                ObserveProbeSuccess(check_done_time);
+                if (mgr->max_period_ms_ > mgr->period_ms_) {
+                  // The node is stable; stretch its probe interval toward the
+                  // configured ceiling.
+                  current_period_ms_ =
+                      std::min(mgr->max_period_ms_, current_period_ms_ * 3 / 2);
+                }
               } else {
                 --health_check_remaining_;
+                // Probe a suspicious node at the base cadence again.
+                current_period_ms_ = mgr->period_ms_;
                 RAY_LOG(WARNING)
                     << "Health check failed for node " << node_id_
                     << ", remaining checks " << health_check_remaining_ << ", status "
                     << status.error_code() << ", response status " << response->status()
                     << ", status message " << status.error_message()
                     << ", status details " << status.error_details();
+                if (mgr->phi_threshold_ > 0 && health_check_remaining_ > 0) {
+                  const double phi = ComputePhi(check_done_time);
+                  if (phi >= mgr->phi_threshold_) {
+                    RAY_LOG(WARNING)
+                        << "Phi-accrual detector marked node " << node_id_
+                        << " as dead, phi " << phi << " exceeds threshold "
+                        << mgr->phi_threshold_ << " with " << health_check_remaining_
+                        << " counting checks remaining.";
+                    health_check_remaining_ = 0;
+                  }
+                }
               }
 
               if (health_check_remaining_ == 0) {
@@ -218,7 +292,8 @@ void GcsHealthCheckManager::HealthCheckContext::StartHealthCheck() {
                 //
                 // TODO(hjiang): Able to reduce a few health check based on know resource
                 // usage communication between GCS and raylet.
-                timer_.expires_from_now(boost::posix_time::milliseconds(mgr->period_ms_));
+                timer_.expires_from_now(boost::posix_time::milliseconds(
+                    current_period_ms_ + mgr->GetProbeJitterMs()));
                 timer_.async_wait([this](auto) { StartHealthCheck(); });
               }
             },
@@ -226,6 +301,42 @@ void GcsHealthCheckManager::HealthCheckContext::StartHealthCheck() {
       });
 }
 
+void GcsHealthCheckManager::HealthCheckContext::ObserveProbeSuccess(absl::Time now) {
+  if (last_probe_success_time_ != absl::InfinitePast()) {
+    const double interval_ms =
+        absl::ToDoubleMilliseconds(now - last_probe_success_time_);
+    if (num_interval_samples_ == 0) {
+      interval_mean_ms_ = interval_ms;
+      interval_var_ms2_ = 0.0;
+    } else {
+      const double delta = interval_ms - interval_mean_ms_;
+      interval_mean_ms_ += kPhiIntervalAlpha * delta;
+      interval_var_ms2_ =
+          (1.0 - kPhiIntervalAlpha) * (interval_var_ms2_ + kPhiIntervalAlpha * delta * delta);
+    }
+    ++num_interval_samples_;
+  }
+  last_probe_success_time_ = now;
+}
+
+double GcsHealthCheckManager::HealthCheckContext::ComputePhi(absl::Time now) const {
+  if (num_interval_samples_ < kMinPhiIntervalSamples) {
+    return 0.0;
+  }
+  const double elapsed_ms = absl::ToDoubleMilliseconds(now - last_probe_success_time_);
+  // Floor the standard deviation so a perfectly regular probe cadence doesn't
+  // make the detector hair-triggered.
+  const double stddev_ms =
+      std::max({std::sqrt(interval_var_ms2_), interval_mean_ms_ / 10.0, 1.0});
+  const double y = (elapsed_ms - interval_mean_ms_) / stddev_ms;
+  // Logistic approximation of the normal CDF tail, as used by phi-accrual
+  // failure detector implementations (Hayashibara et al.).
+  const double e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+  double p_later = y > 0 ? e / (1.0 + e) : 1.0 - 1.0 / (1.0 + e);
+  p_later = std::max(p_later, 1e-12);
+  return -std::log10(p_later);
+}
+
 void GcsHealthCheckManager::HealthCheckContext::Stop() { stopped_ = true; }
 
 void GcsHealthCheckManager::AddNode(const NodeID &node_id,
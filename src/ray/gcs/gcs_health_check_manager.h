@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/random/random.h"
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/id.h"
 #include "ray/common/ray_config.h"
@@ -53,6 +54,17 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
   /// \param period_ms The interval between two health checks for the same node.
   /// \param failure_threshold The threshold before a node will be marked as dead due to
   /// health check failure.
+  /// \param jitter_ms Random jitter in [0, jitter_ms) added to every scheduled probe
+  /// delay so probes spread out instead of bunching. 0 keeps the fixed schedule.
+  /// \param max_period_ms Upper bound for adaptive probe spacing. When larger than
+  /// period_ms, the interval of a node stretches toward this bound while its checks
+  /// keep passing and snaps back to period_ms on the first failure. 0 keeps the fixed
+  /// interval.
+  /// \param max_inflight_probes Maximum number of health check RPCs in flight at once;
+  /// probes beyond the limit are deferred. 0 means unlimited.
+  /// \param phi_threshold When positive, a node is also failed once the phi-accrual
+  /// suspicion level computed from its probe success history exceeds this value. 0
+  /// keeps counting-only detection.
   static std::shared_ptr<GcsHealthCheckManager> Create(
       instrumented_io_context &io_service,
       std::function<void(const NodeID &)> on_node_death_callback,
@@ -60,7 +72,12 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
       int64_t initial_delay_ms = RayConfig::instance().health_check_initial_delay_ms(),
       int64_t timeout_ms = RayConfig::instance().health_check_timeout_ms(),
       int64_t period_ms = RayConfig::instance().health_check_period_ms(),
-      int64_t failure_threshold = RayConfig::instance().health_check_failure_threshold());
+      int64_t failure_threshold = RayConfig::instance().health_check_failure_threshold(),
+      int64_t jitter_ms = RayConfig::instance().health_check_jitter_ms(),
+      int64_t max_period_ms = RayConfig::instance().health_check_max_period_ms(),
+      int64_t max_inflight_probes =
+          RayConfig::instance().health_check_max_inflight_probes(),
+      double phi_threshold = RayConfig::instance().health_check_phi_threshold());
 
   ~GcsHealthCheckManager();
 
@@ -97,7 +114,15 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
       int64_t initial_delay_ms,
       int64_t timeout_ms,
       int64_t period_ms,
-      int64_t failure_threshold);
+      int64_t failure_threshold,
+      int64_t jitter_ms,
+      int64_t max_period_ms,
+      int64_t max_inflight_probes,
+      double phi_threshold);
+
+  /// Draw a random probe delay jitter in [0, jitter_ms_), or 0 when jitter is
+  /// disabled. Must be called on the io-context thread.
+  int64_t GetProbeJitterMs();
 
   /// Fail a node when health check failed. It'll stop the health checking and
   /// call `on_node_death_callback_`.
@@ -117,11 +142,12 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
         : manager_(manager),
           node_id_(node_id),
           timer_(manager->io_service_),
-          health_check_remaining_(manager->failure_threshold_) {
+          health_check_remaining_(manager->failure_threshold_),
+          current_period_ms_(manager->period_ms_) {
       request_.set_service(node_id.Hex());
       stub_ = grpc::health::v1::Health::NewStub(std::move(channel));
-      timer_.expires_from_now(
-          boost::posix_time::milliseconds(manager->initial_delay_ms_));
+      timer_.expires_from_now(boost::posix_time::milliseconds(
+          manager->initial_delay_ms_ + manager->GetProbeJitterMs()));
       timer_.async_wait([this](auto) { StartHealthCheck(); });
     }
 
@@ -132,6 +158,15 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
    private:
     void StartHealthCheck();
 
+    /// Fold a successful probe at `now` into the inter-success interval
+    /// statistics used by the phi-accrual detector.
+    void ObserveProbeSuccess(absl::Time now);
+
+    /// Suspicion level of this node at `now` given its probe success history.
+    /// 0 until enough intervals have been observed; grows without bound the
+    /// longer the node stays silent past its usual response cadence.
+    double ComputePhi(absl::Time now) const;
+
     std::weak_ptr<GcsHealthCheckManager> manager_;
 
     NodeID node_id_;
@@ -152,6 +187,19 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
 
     /// The remaining check left. If it reaches 0, the node will be marked as dead.
     int64_t health_check_remaining_;
+
+    /// Current probe interval. Equals the base period unless adaptive spacing
+    /// is enabled, in which case it stretches toward `max_period_ms_` while
+    /// checks pass and resets to the base period on the first failure.
+    int64_t current_period_ms_;
+
+    /// Phi-accrual detector state: the time of the last successful probe and
+    /// exponentially weighted mean/variance of the intervals between
+    /// successes, in milliseconds.
+    absl::Time last_probe_success_time_ = absl::InfinitePast();
+    double interval_mean_ms_ = 0.0;
+    double interval_var_ms2_ = 0.0;
+    int64_t num_interval_samples_ = 0;
   };
 
   /// The main service. All method needs to run on this thread.
@@ -175,6 +223,19 @@ class GcsHealthCheckManager : public std::enable_shared_from_this<GcsHealthCheck
   const int64_t period_ms_;
   /// The number of failures before the node is considered as dead.
   const int64_t failure_threshold_;
+  /// Random jitter added to every scheduled probe delay. 0 disables jitter.
+  const int64_t jitter_ms_;
+  /// Ceiling for adaptive probe spacing; <= period_ms_ keeps a fixed interval.
+  const int64_t max_period_ms_;
+  /// Maximum number of health check RPCs in flight; 0 means unlimited.
+  const int64_t max_inflight_probes_;
+  /// Phi-accrual suspicion threshold; <= 0 keeps counting-only detection.
+  const double phi_threshold_;
+  /// Number of health check RPCs currently in flight. Only touched on the
+  /// io-context thread.
+  int64_t inflight_probes_ = 0;
+  /// Source of probe delay jitter. Only used on the io-context thread.
+  absl::BitGen jitter_gen_;
   ray::observability::MetricInterface &health_check_rpc_latency_ms_histogram_;
 };
 
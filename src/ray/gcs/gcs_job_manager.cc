@@ -14,6 +14,7 @@
 
 #include "ray/gcs/gcs_job_manager.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
@@ -460,6 +461,71 @@ void GcsJobManager::HandleGetAllJobInfo(rpc::GetAllJobInfoRequest request,
   gcs_table_storage_.JobTable().GetAll({std::move(on_done), io_context_});
 }
 
+void GcsJobManager::HandleGetJobSnapshot(rpc::GetJobSnapshotRequest request,
+                                         rpc::GetJobSnapshotReply *reply,
+                                         rpc::SendReplyCallback send_reply_callback) {
+  // Archival export of the job table. Unlike GetAllJobInfo, this emits only
+  // the compact columnar fields and never contacts drivers or the internal
+  // KV, so a page costs a bounded slice of the table rather than a full
+  // materialization of every JobTableData.
+  RAY_LOG(DEBUG) << "Getting job snapshot page.";
+
+  int64_t batch_size = RayConfig::instance().gcs_job_snapshot_max_batch_size();
+  if (request.has_batch_size()) {
+    if (request.batch_size() <= 0) {
+      RAY_LOG(ERROR) << "Invalid batch size " << request.batch_size()
+                     << " specified in GetJobSnapshotRequest, must be positive.";
+      GCS_RPC_SEND_REPLY(
+          send_reply_callback, reply, Status::Invalid("Invalid batch size"));
+      return;
+    }
+    batch_size = std::min<int64_t>(batch_size, request.batch_size());
+  }
+
+  std::optional<JobID> start_after;
+  if (request.has_start_after_job_id()) {
+    start_after = JobID::FromBinary(request.start_after_job_id());
+  }
+
+  auto on_done = [this, start_after, batch_size, reply, send_reply_callback](
+                     const absl::flat_hash_map<JobID, rpc::JobTableData> &&result) {
+    RAY_CHECK(thread_checker_.IsOnSameThread());
+
+    // Pages must be stable across requests, so order the scan by job ID
+    // binary representation.
+    std::vector<JobID> job_ids;
+    job_ids.reserve(result.size());
+    for (const auto &entry : result) {
+      if (!start_after.has_value() || start_after->Binary() < entry.first.Binary()) {
+        job_ids.push_back(entry.first);
+      }
+    }
+    std::sort(job_ids.begin(), job_ids.end(), [](const JobID &lhs, const JobID &rhs) {
+      return lhs.Binary() < rhs.Binary();
+    });
+
+    const size_t page_size =
+        std::min<size_t>(job_ids.size(), static_cast<size_t>(batch_size));
+    reply->mutable_job_ids()->Reserve(page_size);
+    reply->mutable_is_dead()->Reserve(page_size);
+    reply->mutable_start_times()->Reserve(page_size);
+    reply->mutable_end_times()->Reserve(page_size);
+    for (size_t i = 0; i < page_size; i++) {
+      const auto &data = result.at(job_ids[i]);
+      reply->add_job_ids(job_ids[i].Binary());
+      reply->add_is_dead(data.is_dead());
+      reply->add_start_times(data.start_time());
+      reply->add_end_times(data.end_time());
+    }
+    if (page_size < job_ids.size()) {
+      reply->set_next_start_after_job_id(job_ids[page_size - 1].Binary());
+    }
+    RAY_LOG(DEBUG) << "Finished getting job snapshot page of " << page_size << " jobs.";
+    GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
+  };
+  gcs_table_storage_.JobTable().GetAll({std::move(on_done), io_context_});
+}
+
 void GcsJobManager::HandleReportJobError(rpc::ReportJobErrorRequest request,
                                          rpc::ReportJobErrorReply *reply,
                                          rpc::SendReplyCallback send_reply_callback) {
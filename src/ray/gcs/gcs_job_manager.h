@@ -90,6 +90,10 @@ class GcsJobManager : public rpc::JobInfoGcsServiceHandler {
                            rpc::GetAllJobInfoReply *reply,
                            rpc::SendReplyCallback send_reply_callback) override;
 
+  void HandleGetJobSnapshot(rpc::GetJobSnapshotRequest request,
+                            rpc::GetJobSnapshotReply *reply,
+                            rpc::SendReplyCallback send_reply_callback) override;
+
   void HandleReportJobError(rpc::ReportJobErrorRequest request,
                             rpc::ReportJobErrorReply *reply,
                             rpc::SendReplyCallback send_reply_callback) override;
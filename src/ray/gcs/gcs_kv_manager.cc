@@ -21,6 +21,8 @@
 
 #include "absl/strings/match.h"
 #include "absl/strings/str_split.h"
+#include "ray/common/ray_config.h"
+#include "ray/pubsub/gcs_publisher.h"
 
 namespace ray {
 namespace gcs {
@@ -79,11 +81,20 @@ void GcsInternalKVManager::HandleInternalKVPut(
   if (!status.ok()) {
     GCS_RPC_SEND_REPLY(send_reply_callback, reply, status);
   } else {
-    auto callback =
-        [reply, send_reply_callback = std::move(send_reply_callback)](bool newly_added) {
-          reply->set_added(newly_added);
-          GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
-        };
+    auto callback = [this,
+                     reply,
+                     send_reply_callback = std::move(send_reply_callback),
+                     ns = request.namespace_(),
+                     key = request.key(),
+                     overwrite = request.overwrite()](bool newly_added) {
+      if (newly_added || overwrite) {
+        // The value changed (an overwrite of an existing key reports
+        // newly_added == false but still wrote).
+        PublishKVUpdate(ns, key, /*del_by_prefix=*/false);
+      }
+      reply->set_added(newly_added);
+      GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
+    };
     kv_instance_->Put(request.namespace_(),
                       request.key(),
                       std::move(*request.mutable_value()),
@@ -100,7 +111,15 @@ void GcsInternalKVManager::HandleInternalKVDel(
   if (!status.ok()) {
     GCS_RPC_SEND_REPLY(send_reply_callback, reply, status);
   } else {
-    auto callback = [reply, send_reply_callback](int64_t del_num) {
+    auto callback = [this,
+                     reply,
+                     send_reply_callback,
+                     ns = request.namespace_(),
+                     key = request.key(),
+                     del_by_prefix = request.del_by_prefix()](int64_t del_num) {
+      if (del_num > 0) {
+        PublishKVUpdate(ns, key, del_by_prefix);
+      }
       reply->set_deleted_num(del_num);
       GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
     };
@@ -156,6 +175,20 @@ void GcsInternalKVManager::HandleGetInternalConfig(
   GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
 }
 
+void GcsInternalKVManager::PublishKVUpdate(const std::string &ns,
+                                           const std::string &key,
+                                           bool del_by_prefix) const {
+  if (gcs_publisher_ == nullptr ||
+      !RayConfig::instance().gcs_internal_kv_cache_enabled()) {
+    return;
+  }
+  rpc::InternalKVUpdateMessage message;
+  message.set_namespace_(ns);
+  message.set_key(key);
+  message.set_del_by_prefix(del_by_prefix);
+  gcs_publisher_->PublishInternalKVUpdate(key, std::move(message));
+}
+
 Status GcsInternalKVManager::ValidateKey(const std::string &key) const {
   constexpr std::string_view kNamespacePrefix = "@namespace_";
   if (absl::StartsWith(key, kNamespacePrefix)) {
@@ -25,6 +25,11 @@
 #include "ray/gcs/postable/postable.h"
 
 namespace ray {
+
+namespace pubsub {
+class GcsPublisher;
+}
+
 namespace gcs {
 
 /// \class InternalKVInterface
@@ -102,12 +107,16 @@ class InternalKVInterface {
 
 class GcsInternalKVManager : public rpc::InternalKVGcsServiceHandler {
  public:
+  /// \param gcs_publisher If non-null, every write is published on the
+  /// internal KV channel so client-side caches can invalidate the key.
   explicit GcsInternalKVManager(std::unique_ptr<InternalKVInterface> kv_instance,
                                 std::string raylet_config_list,
-                                instrumented_io_context &io_context)
+                                instrumented_io_context &io_context,
+                                pubsub::GcsPublisher *gcs_publisher = nullptr)
       : kv_instance_(std::move(kv_instance)),
         raylet_config_list_(std::move(raylet_config_list)),
-        io_context_(io_context) {}
+        io_context_(io_context),
+        gcs_publisher_(gcs_publisher) {}
 
   void HandleInternalKVGet(rpc::InternalKVGetRequest request,
                            rpc::InternalKVGetReply *reply,
@@ -144,7 +153,15 @@ class GcsInternalKVManager : public rpc::InternalKVGcsServiceHandler {
   std::unique_ptr<InternalKVInterface> kv_instance_;
   const std::string raylet_config_list_;
   instrumented_io_context &io_context_;
+  pubsub::GcsPublisher *gcs_publisher_;
   Status ValidateKey(const std::string &key) const;
+
+  /// Publish that `key` (or the prefix `key` when del_by_prefix) changed in
+  /// `ns`, so client-side caches drop the stale entries. No-op when caching
+  /// is disabled or no publisher was provided.
+  void PublishKVUpdate(const std::string &ns,
+                       const std::string &key,
+                       bool del_by_prefix) const;
 };
 
 }  // namespace gcs
@@ -14,6 +14,7 @@
 
 #include "ray/gcs/gcs_node_manager.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -22,6 +23,7 @@
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/time/clock.h"
 #include "ray/common/protobuf_utils.h"
 #include "ray/observability/ray_node_definition_event.h"
 #include "ray/observability/ray_node_lifecycle_event.h"
@@ -39,7 +41,8 @@ GcsNodeManager::GcsNodeManager(
     rpc::RayletClientPool *raylet_client_pool,
     const ClusterID &cluster_id,
     observability::RayEventRecorderInterface &ray_event_recorder,
-    const std::string &session_name)
+    const std::string &session_name,
+    GcsRequestTracer *request_tracer)
     : gcs_publisher_(gcs_publisher),
       gcs_table_storage_(gcs_table_storage),
       io_context_(io_context),
@@ -47,6 +50,7 @@ GcsNodeManager::GcsNodeManager(
       cluster_id_(cluster_id),
       ray_event_recorder_(ray_event_recorder),
       session_name_(session_name),
+      request_tracer_(request_tracer),
       export_event_write_enabled_(IsExportAPIEnabledNode()) {}
 
 void GcsNodeManager::WriteNodeExportEvent(const rpc::GcsNodeInfo &node_info,
@@ -96,6 +100,20 @@ void GcsNodeManager::HandleGetClusterId(rpc::GetClusterIdRequest request,
   GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
 }
 
+int64_t GcsNodeManager::RecommendedResourceReportPeriodMs(size_t num_alive_nodes) {
+  const auto base_period_ms = static_cast<int64_t>(
+      RayConfig::instance().raylet_report_resources_period_milliseconds());
+  const int64_t nodes_per_step =
+      std::max<int64_t>(1, RayConfig::instance().adaptive_resource_report_nodes_per_step());
+  const int64_t max_period_ms =
+      RayConfig::instance().adaptive_resource_report_max_period_milliseconds();
+  // One base period step per nodes_per_step alive nodes, so the aggregate
+  // report rate stays roughly constant as the cluster grows.
+  const int64_t period_ms =
+      base_period_ms * (1 + static_cast<int64_t>(num_alive_nodes) / nodes_per_step);
+  return std::min(period_ms, std::max(base_period_ms, max_period_ms));
+}
+
 void GcsNodeManager::HandleRegisterNode(rpc::RegisterNodeRequest request,
                                         rpc::RegisterNodeReply *reply,
                                         rpc::SendReplyCallback send_reply_callback) {
@@ -109,14 +127,41 @@ void GcsNodeManager::HandleRegisterNode(rpc::RegisterNodeRequest request,
           .WithField("node_address", node_info.node_manager_address())
       << "Registering new node.";
 
-  auto on_done = [this, node_id, node_info_copy = node_info, reply, send_reply_callback](
-                     const Status &status) mutable {
+  // Sampled stage tracing: the trace lives until the reply is sent, so its
+  // destruction closes the handler span.
+  auto trace = request_tracer_ != nullptr
+                   ? request_tracer_->MaybeStartTrace("NodeInfoGcsService.RegisterNode")
+                   : nullptr;
+  // Stamped again right before the storage put on the head-node path, which
+  // first marks the old head node as dead.
+  auto storage_start_ns = std::make_shared<int64_t>(absl::GetCurrentTimeNanos());
+
+  auto on_done = [this,
+                  node_id,
+                  node_info_copy = node_info,
+                  reply,
+                  send_reply_callback,
+                  trace,
+                  storage_start_ns](const Status &status) mutable {
     RAY_CHECK_OK(status) << "Failed to register node '" << node_id << "'.";
+    if (trace != nullptr) {
+      trace->RecordStage(GcsRequestStage::kStorage,
+                         absl::GetCurrentTimeNanos() - *storage_start_ns);
+    }
     absl::MutexLock lock_(&mutex_);
     RAY_LOG(DEBUG).WithField(node_id) << "Finished registering node.";
     AddNodeToCache(std::make_shared<rpc::GcsNodeInfo>(node_info_copy));
+    if (RayConfig::instance().adaptive_resource_report_period_enabled()) {
+      reply->set_recommended_resource_report_period_ms(
+          RecommendedResourceReportPeriodMs(alive_nodes_.size()));
+    }
     WriteNodeExportEvent(node_info_copy, /*is_register_event*/ true);
+    const int64_t publish_start_ns = absl::GetCurrentTimeNanos();
     PublishNodeInfoToPubsub(node_id, node_info_copy);
+    if (trace != nullptr) {
+      trace->RecordStage(GcsRequestStage::kPublish,
+                         absl::GetCurrentTimeNanos() - publish_start_ns);
+    }
     GCS_RPC_SEND_REPLY(send_reply_callback, reply, status);
   };
 
@@ -136,11 +181,13 @@ void GcsNodeManager::HandleRegisterNode(rpc::RegisterNodeRequest request,
 
     RAY_CHECK_LE(head_nodes.size(), 1UL);
     if (head_nodes.size() == 1) {
-      OnNodeFailure(head_nodes[0],
-                    [this, node_id, node_info, on_done = std::move(on_done)]() {
-                      gcs_table_storage_->NodeTable().Put(
-                          node_id, node_info, {on_done, io_context_});
-                    });
+      OnNodeFailure(
+          head_nodes[0],
+          [this, node_id, node_info, on_done = std::move(on_done), storage_start_ns]() {
+            *storage_start_ns = absl::GetCurrentTimeNanos();
+            gcs_table_storage_->NodeTable().Put(
+                node_id, node_info, {on_done, io_context_});
+          });
     } else {
       gcs_table_storage_->NodeTable().Put(
           node_id, node_info, {std::move(on_done), io_context_});
@@ -267,6 +314,59 @@ void GcsNodeManager::HandleGetAllNodeInfo(rpc::GetAllNodeInfoRequest request,
   const size_t total_num_nodes = alive_nodes_.size() + dead_nodes_.size();
   int64_t num_added = 0;
 
+  if (request.has_start_after_node_id()) {
+    // Cursor-paginated path: collect the matching nodes that sort after the
+    // cursor, then copy only the page that is actually returned.
+    const std::string &start_after = request.start_after_node_id();
+    const bool has_selectors = request.node_selectors_size() > 0;
+    std::vector<std::pair<NodeID, const rpc::GcsNodeInfo *>> page;
+    auto collect =
+        [&](const absl::flat_hash_map<NodeID, std::shared_ptr<const rpc::GcsNodeInfo>>
+                &nodes) {
+          for (const auto &[node_id, node_info_ptr] : nodes) {
+            if (node_id.Binary() <= start_after) {
+              continue;
+            }
+            if (has_selectors && !(node_ids.contains(node_id) ||
+                                   node_names.contains(node_info_ptr->node_name()) ||
+                                   node_ip_addresses.contains(
+                                       node_info_ptr->node_manager_address()) ||
+                                   (is_head_node_filter.has_value() &&
+                                    node_info_ptr->is_head_node() ==
+                                        is_head_node_filter.value()))) {
+              continue;
+            }
+            page.emplace_back(node_id, node_info_ptr.get());
+          }
+        };
+    if (!request.has_state_filter() ||
+        request.state_filter() == rpc::GcsNodeInfo::ALIVE) {
+      collect(alive_nodes_);
+    }
+    if (!request.has_state_filter() ||
+        request.state_filter() == rpc::GcsNodeInfo::DEAD) {
+      collect(dead_nodes_);
+    }
+    std::sort(page.begin(),
+              page.end(),
+              [](const std::pair<NodeID, const rpc::GcsNodeInfo *> &left,
+                 const std::pair<NodeID, const rpc::GcsNodeInfo *> &right) {
+                return left.first.Binary() < right.first.Binary();
+              });
+    if (page.size() > static_cast<size_t>(limit)) {
+      page.resize(limit);
+      reply->set_next_start_after_node_id(page.back().first.Binary());
+    }
+    for (const auto &[node_id, node_info_ptr] : page) {
+      *reply->add_node_info_list() = *node_info_ptr;
+    }
+    reply->set_total(total_num_nodes);
+    reply->set_num_filtered(total_num_nodes - reply->node_info_list_size());
+    GCS_RPC_SEND_REPLY(send_reply_callback, reply, Status::OK());
+    ++counts_[CountType::GET_ALL_NODE_INFO_REQUEST];
+    return;
+  }
+
   if (request.node_selectors_size() > 0 && only_node_id_filters) {
     // optimized path if request only wants specific node ids
     for (const auto &node_id : node_ids) {
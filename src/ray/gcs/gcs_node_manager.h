@@ -24,6 +24,7 @@
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/id.h"
 #include "ray/gcs/gcs_init_data.h"
+#include "ray/gcs/gcs_request_tracer.h"
 #include "ray/gcs/gcs_table_storage.h"
 #include "ray/gcs/grpc_service_interfaces.h"
 #include "ray/observability/ray_event_recorder_interface.h"
@@ -49,13 +50,15 @@ class GcsNodeManager : public rpc::NodeInfoGcsServiceHandler {
   ///
   /// \param gcs_publisher GCS message publisher.
   /// \param gcs_table_storage GCS table external storage accessor.
+  /// \param request_tracer Sampled per-stage request tracer, may be nullptr.
   GcsNodeManager(pubsub::GcsPublisher *gcs_publisher,
                  GcsTableStorage *gcs_table_storage,
                  instrumented_io_context &io_context,
                  rpc::RayletClientPool *raylet_client_pool,
                  const ClusterID &cluster_id,
                  observability::RayEventRecorderInterface &ray_event_recorder,
-                 const std::string &session_name);
+                 const std::string &session_name,
+                 GcsRequestTracer *request_tracer = nullptr);
 
   /// Handle register rpc request come from raylet.
   void HandleGetClusterId(rpc::GetClusterIdRequest request,
@@ -299,6 +302,15 @@ class GcsNodeManager : public rpc::NodeInfoGcsServiceHandler {
   rpc::NodeDeathInfo InferDeathInfo(const NodeID &node_id)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  /// Compute the resource report period to assign to a registering node,
+  /// scaled to the current number of alive nodes. See
+  /// adaptive_resource_report_period_enabled.
+  ///
+  /// \param num_alive_nodes The number of alive nodes including the
+  /// registering one.
+  /// \return The assigned report period in milliseconds.
+  static int64_t RecommendedResourceReportPeriodMs(size_t num_alive_nodes);
+
   void WriteNodeExportEvent(const rpc::GcsNodeInfo &node_info,
                             bool is_register_event) const;
 
@@ -397,6 +409,8 @@ class GcsNodeManager : public rpc::NodeInfoGcsServiceHandler {
 
   observability::RayEventRecorderInterface &ray_event_recorder_;
   std::string session_name_;
+  /// Sampled per-stage request tracer, may be nullptr.
+  GcsRequestTracer *request_tracer_;
 
   // Debug info.
   enum CountType {
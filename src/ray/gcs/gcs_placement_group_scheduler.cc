@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "ray/common/asio/asio_util.h"
+#include "ray/common/ray_config.h"
 
 namespace ray {
 namespace gcs {
@@ -129,26 +130,31 @@ void GcsPlacementGroupScheduler::ScheduleUnplacedBundles(
       lease_status_tracker->MarkPreparePhaseStarted(node_id, bundle);
     }
 
+    auto prepare_callback = [this,
+                             bundles_per_node,
+                             node_id,
+                             lease_status_tracker,
+                             failure_callback,
+                             success_callback](const Status &status) {
+      for (const auto &bundle : bundles_per_node) {
+        lease_status_tracker->MarkPrepareRequestReturned(node_id, bundle, status);
+      }
+
+      if (lease_status_tracker->AllPrepareRequestsReturned()) {
+        OnAllBundlePrepareRequestReturned(
+            lease_status_tracker, failure_callback, success_callback);
+      }
+    };
+
     // TODO(sang): The callback might not be called at all if nodes are dead. We should
     // handle this case properly.
-    PrepareResources(bundles_per_node,
-                     gcs_node_manager_.GetAliveNode(node_id),
-                     [this,
-                      bundles_per_node,
-                      node_id,
-                      lease_status_tracker,
-                      failure_callback,
-                      success_callback](const Status &status) {
-                       for (const auto &bundle : bundles_per_node) {
-                         lease_status_tracker->MarkPrepareRequestReturned(
-                             node_id, bundle, status);
-                       }
-
-                       if (lease_status_tracker->AllPrepareRequestsReturned()) {
-                         OnAllBundlePrepareRequestReturned(
-                             lease_status_tracker, failure_callback, success_callback);
-                       }
-                     });
+    if (RayConfig::instance().gcs_placement_group_batch_prepare_commit_enabled()) {
+      EnqueuePrepareResources(node_id, bundles_per_node, std::move(prepare_callback));
+    } else {
+      PrepareResources(bundles_per_node,
+                       gcs_node_manager_.GetAliveNode(node_id),
+                       std::move(prepare_callback));
+    }
   }
 }
 
@@ -232,6 +238,134 @@ void GcsPlacementGroupScheduler::CommitResources(
       });
 }
 
+void GcsPlacementGroupScheduler::EnqueuePrepareResources(
+    const NodeID &node_id,
+    std::vector<std::shared_ptr<const BundleSpecification>> bundles,
+    rpc::StatusCallback callback) {
+  pending_prepare_requests_[node_id].push_back(
+      PendingBundleRpc{std::move(bundles), std::move(callback)});
+  ScheduleBundleRpcFlush();
+}
+
+void GcsPlacementGroupScheduler::EnqueueCommitResources(
+    const NodeID &node_id,
+    std::vector<std::shared_ptr<const BundleSpecification>> bundles,
+    rpc::StatusCallback callback) {
+  pending_commit_requests_[node_id].push_back(
+      PendingBundleRpc{std::move(bundles), std::move(callback)});
+  ScheduleBundleRpcFlush();
+}
+
+void GcsPlacementGroupScheduler::ScheduleBundleRpcFlush() {
+  if (batch_flush_scheduled_) {
+    return;
+  }
+  batch_flush_scheduled_ = true;
+  io_context_.post([this] { FlushBundleRpcBatches(); },
+                   "GcsPlacementGroupScheduler.FlushBundleRpcBatches");
+}
+
+void GcsPlacementGroupScheduler::FlushBundleRpcBatches() {
+  batch_flush_scheduled_ = false;
+  auto prepare_batches = std::move(pending_prepare_requests_);
+  pending_prepare_requests_.clear();
+  auto commit_batches = std::move(pending_commit_requests_);
+  pending_commit_requests_.clear();
+
+  for (auto &node_batch : prepare_batches) {
+    const auto &node_id = node_batch.first;
+    const auto &node = gcs_node_manager_.GetAliveNode(node_id);
+    if (!node.has_value()) {
+      for (const auto &request : node_batch.second) {
+        request.callback(Status::NotFound("Node is already dead."));
+      }
+      continue;
+    }
+
+    auto requests =
+        std::make_shared<std::vector<PendingBundleRpc>>(std::move(node_batch.second));
+    std::vector<std::shared_ptr<const BundleSpecification>> bundles;
+    for (const auto &request : *requests) {
+      bundles.insert(bundles.end(), request.bundles.begin(), request.bundles.end());
+    }
+    RAY_LOG(INFO) << "Preparing resource from node " << node_id << " for "
+                  << requests->size()
+                  << " placement groups, bundles: " << GetDebugStringForBundles(bundles);
+
+    GetRayletClientFromNode(node.value())
+        ->PrepareBundleResources(
+            bundles,
+            [node_id, requests](const Status &status,
+                                const rpc::PrepareBundleResourcesReply &reply) {
+              // Raylets that fill per-group results let each placement group
+              // succeed or fail on its own; otherwise fall back to the
+              // all-or-nothing flag.
+              absl::flat_hash_map<PlacementGroupID, bool> group_success;
+              for (const auto &group_result : reply.group_results()) {
+                group_success[PlacementGroupID::FromBinary(
+                    group_result.placement_group_id())] = group_result.success();
+              }
+              for (const auto &request : *requests) {
+                auto it =
+                    group_success.find(request.bundles.front()->PlacementGroupId());
+                const bool prepared =
+                    it != group_success.end() ? it->second : reply.success();
+                auto result = prepared ? Status::OK()
+                                       : Status::IOError("Failed to reserve resource");
+                if (result.ok()) {
+                  RAY_LOG(INFO)
+                      << "Finished leasing resource from " << node_id
+                      << " for bundles: " << GetDebugStringForBundles(request.bundles);
+                } else {
+                  RAY_LOG(INFO)
+                      << "Failed to lease resource from " << node_id
+                      << " for bundles: " << GetDebugStringForBundles(request.bundles);
+                }
+                request.callback(result);
+              }
+            });
+  }
+
+  for (auto &node_batch : commit_batches) {
+    const auto &node_id = node_batch.first;
+    const auto &node = gcs_node_manager_.GetAliveNode(node_id);
+    if (!node.has_value()) {
+      RAY_LOG(INFO) << "Failed to commit resources because the node is dead, node id = "
+                    << node_id;
+      for (const auto &request : node_batch.second) {
+        request.callback(Status::Interrupted("Node is dead"));
+      }
+      continue;
+    }
+
+    auto requests =
+        std::make_shared<std::vector<PendingBundleRpc>>(std::move(node_batch.second));
+    std::vector<std::shared_ptr<const BundleSpecification>> bundles;
+    for (const auto &request : *requests) {
+      bundles.insert(bundles.end(), request.bundles.begin(), request.bundles.end());
+    }
+    RAY_LOG(INFO) << "Committing resource to a node " << node_id << " for "
+                  << requests->size()
+                  << " placement groups, bundles: " << GetDebugStringForBundles(bundles);
+
+    GetRayletClientFromNode(node.value())
+        ->CommitBundleResources(
+            bundles,
+            [node_id, requests](const Status &status,
+                                const rpc::CommitBundleResourcesReply &reply) {
+              if (status.ok()) {
+                RAY_LOG(INFO) << "Finished committing resource to " << node_id;
+              } else {
+                RAY_LOG(INFO) << "Failed to commit resource to " << node_id;
+              }
+              for (const auto &request : *requests) {
+                RAY_CHECK(request.callback);
+                request.callback(status);
+              }
+            });
+  }
+}
+
 void GcsPlacementGroupScheduler::CancelResourceReserve(
     const std::shared_ptr<const BundleSpecification> &bundle_spec,
     const std::optional<std::shared_ptr<const ray::rpc::GcsNodeInfo>> &node,
@@ -353,7 +487,11 @@ void GcsPlacementGroupScheduler::CommitAllBundles(
       }
     };
 
-    if (node.has_value()) {
+    if (RayConfig::instance().gcs_placement_group_batch_prepare_commit_enabled()) {
+      // Liveness of the node is re-checked when the batch is flushed.
+      EnqueueCommitResources(
+          node_id, bundles_per_node, std::move(commit_resources_callback));
+    } else if (node.has_value()) {
       CommitResources(bundles_per_node, node, commit_resources_callback);
     } else {
       RAY_LOG(INFO) << "Failed to commit resources because the node is dead, node id = "
@@ -387,6 +387,37 @@ class GcsPlacementGroupScheduler : public GcsPlacementGroupSchedulerInterface {
       const std::optional<std::shared_ptr<const ray::rpc::GcsNodeInfo>> &node,
       const rpc::StatusCallback callback);
 
+  /// Queue a PREPARE request for a node so it can be coalesced with other
+  /// prepare requests targeting the same node in the same event-loop
+  /// iteration, including requests of other placement groups. The queued
+  /// requests are sent by `FlushBundleRpcBatches`. Only used when
+  /// `gcs_placement_group_batch_prepare_commit_enabled` is set.
+  ///
+  /// \param node_id The node to prepare resources on.
+  /// \param bundles Bundles of one placement group to be prepared on the node.
+  /// \param callback Invoked with the per-placement-group prepare result.
+  void EnqueuePrepareResources(
+      const NodeID &node_id,
+      std::vector<std::shared_ptr<const BundleSpecification>> bundles,
+      rpc::StatusCallback callback);
+
+  /// Queue a COMMIT request for a node so it can be coalesced like
+  /// `EnqueuePrepareResources`. Only used when
+  /// `gcs_placement_group_batch_prepare_commit_enabled` is set.
+  ///
+  /// \param node_id The node to commit resources on.
+  /// \param bundles Bundles of one placement group to be committed on the node.
+  /// \param callback Invoked with the commit RPC status.
+  void EnqueueCommitResources(
+      const NodeID &node_id,
+      std::vector<std::shared_ptr<const BundleSpecification>> bundles,
+      rpc::StatusCallback callback);
+
+  /// Send one PREPARE and one COMMIT RPC per destination node for all requests
+  /// queued since the last flush and demultiplex the vectorized replies back
+  /// to the per-placement-group callbacks.
+  void FlushBundleRpcBatches();
+
   /// Cacnel prepared or committed resources from a node.
   /// Nodes will be in charge of tracking state of a bundle.
   /// This method is supposed to be idempotent.
@@ -476,6 +507,17 @@ class GcsPlacementGroupScheduler : public GcsPlacementGroupSchedulerInterface {
   /// wildcard resource.
   bool IsPlacementGroupWildcardResource(const std::string &resource_name);
 
+  /// A prepare or commit request of one placement group waiting to be
+  /// coalesced into a per-node RPC.
+  struct PendingBundleRpc {
+    std::vector<std::shared_ptr<const BundleSpecification>> bundles;
+    rpc::StatusCallback callback;
+  };
+
+  /// Post a `FlushBundleRpcBatches` call to the event loop if one is not
+  /// already pending.
+  void ScheduleBundleRpcFlush();
+
   instrumented_io_context &io_context_;
 
   /// A timer that ticks every cancel resource failure milliseconds.
@@ -510,6 +552,14 @@ class GcsPlacementGroupScheduler : public GcsPlacementGroupSchedulerInterface {
   std::list<std::pair<NodeID, std::shared_ptr<const BundleSpecification>>>
       waiting_removed_bundles_;
 
+  /// Prepare and commit requests queued for per-node coalescing, keyed by the
+  /// destination node. Drained by `FlushBundleRpcBatches`.
+  absl::flat_hash_map<NodeID, std::vector<PendingBundleRpc>> pending_prepare_requests_;
+  absl::flat_hash_map<NodeID, std::vector<PendingBundleRpc>> pending_commit_requests_;
+
+  /// Whether a `FlushBundleRpcBatches` call has been posted and not yet run.
+  bool batch_flush_scheduled_ = false;
+
   friend class GcsPlacementGroupSchedulerTest;
   FRIEND_TEST(GcsPlacementGroupSchedulerTest, TestCheckingWildcardResource);
   FRIEND_TEST(GcsPlacementGroupSchedulerTest, TestWaitingRemovedBundles);
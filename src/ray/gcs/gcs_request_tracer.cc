@@ -0,0 +1,129 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/gcs_request_tracer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <utility>
+
+#include "absl/time/clock.h"
+#include "ray/common/ray_config.h"
+
+namespace ray {
+namespace gcs {
+
+namespace {
+
+constexpr std::array<const char *, kNumGcsRequestStages> kStageNames = {
+    "handler", "storage", "publish"};
+
+}  // namespace
+
+GcsRequestTracer::RequestTrace::RequestTrace(GcsRequestTracer *tracer,
+                                             std::string method)
+    : tracer_(tracer),
+      method_(std::move(method)),
+      start_time_ns_(absl::GetCurrentTimeNanos()) {}
+
+GcsRequestTracer::RequestTrace::~RequestTrace() {
+  stage_duration_ns_[static_cast<size_t>(GcsRequestStage::kHandler)] =
+      absl::GetCurrentTimeNanos() - start_time_ns_;
+  tracer_->Flush(method_, stage_duration_ns_);
+}
+
+void GcsRequestTracer::RequestTrace::RecordStage(GcsRequestStage stage,
+                                                 int64_t duration_ns) {
+  stage_duration_ns_[static_cast<size_t>(stage)] += std::max<int64_t>(0, duration_ns);
+}
+
+std::shared_ptr<GcsRequestTracer::RequestTrace> GcsRequestTracer::MaybeStartTrace(
+    const std::string &method) {
+  const double sample_rate = RayConfig::instance().gcs_request_trace_sample_rate();
+  if (sample_rate <= 0.0) {
+    return nullptr;
+  }
+  const auto period =
+      std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(1.0 / sample_rate)));
+  if (request_count_.fetch_add(1) % period != 0) {
+    return nullptr;
+  }
+  return std::make_shared<RequestTrace>(this, method);
+}
+
+void GcsRequestTracer::Flush(
+    const std::string &method,
+    const std::array<int64_t, kNumGcsRequestStages> &stage_duration_ns) {
+  for (size_t stage = 0; stage < kNumGcsRequestStages; ++stage) {
+    const int64_t duration_ns = stage_duration_ns[stage];
+    // The handler stage is always measured; storage and publish are only
+    // reported when the handler recorded a span.
+    if (stage != static_cast<size_t>(GcsRequestStage::kHandler) && duration_ns == 0) {
+      continue;
+    }
+    const double duration_ms = static_cast<double>(duration_ns) / 1e6;
+    stage_time_ms_histogram_metric_.Record(
+        duration_ms, {{"Method", method}, {"Stage", kStageNames[stage]}});
+    absl::MutexLock lock(&mutex_);
+    auto &stage_stats = stats_[method][stage];
+    size_t bucket = 0;
+    while (bucket < kBucketBoundsMs.size() &&
+           duration_ms > static_cast<double>(kBucketBoundsMs[bucket])) {
+      ++bucket;
+    }
+    ++stage_stats.buckets[bucket];
+    ++stage_stats.count;
+    stage_stats.sum_ns += duration_ns;
+    stage_stats.max_ns = std::max(stage_stats.max_ns, duration_ns);
+  }
+}
+
+std::string GcsRequestTracer::StatsString() const {
+  absl::MutexLock lock(&mutex_);
+  if (stats_.empty()) {
+    return "";
+  }
+  std::stringstream out;
+  out << "GcsRequestTracer sampled stage latencies (ms):";
+  for (const auto &[method, stages] : stats_) {
+    out << "\n" << method << ":";
+    for (size_t stage = 0; stage < kNumGcsRequestStages; ++stage) {
+      const auto &stage_stats = stages[stage];
+      if (stage_stats.count == 0) {
+        continue;
+      }
+      out << "\n  " << kStageNames[stage] << ": count=" << stage_stats.count
+          << ", mean=" << (static_cast<double>(stage_stats.sum_ns) / stage_stats.count) /
+                              1e6
+          << ", max=" << static_cast<double>(stage_stats.max_ns) / 1e6 << ", buckets=[";
+      for (size_t bucket = 0; bucket < stage_stats.buckets.size(); ++bucket) {
+        if (bucket > 0) {
+          out << " ";
+        }
+        if (bucket < kBucketBoundsMs.size()) {
+          out << "<=" << kBucketBoundsMs[bucket] << ":";
+        } else {
+          out << ">" << kBucketBoundsMs.back() << ":";
+        }
+        out << stage_stats.buckets[bucket];
+      }
+      out << "]";
+    }
+  }
+  return out.str();
+}
+
+}  // namespace gcs
+}  // namespace ray
@@ -0,0 +1,125 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "ray/common/metrics.h"
+
+namespace ray {
+namespace gcs {
+
+/// Stage of a sampled GCS request whose duration is aggregated separately.
+/// The queueing delay before the handler runs is already tracked per method
+/// by the `instrumented_io_context` event stats, so the tracer covers the
+/// stages the event loop cannot tell apart: time spent in the handler
+/// itself, waiting on table storage, and publishing to subscribers.
+enum class GcsRequestStage : size_t {
+  kHandler = 0,
+  kStorage = 1,
+  kPublish = 2,
+};
+
+inline constexpr size_t kNumGcsRequestStages = 3;
+
+/// Samples a fraction of GCS RPCs and aggregates per-stage latency
+/// histograms per method, so that a registration latency spike can be
+/// attributed to the handler, the storage backend, or pubsub without
+/// attaching a profiler.
+///
+/// The sample rate is re-read from `gcs_request_trace_sample_rate` on every
+/// request, so tracing can be enabled, tuned, or disabled at runtime without
+/// restarting the GCS. A rate of 0 (the default) samples nothing and costs
+/// one config read per request.
+///
+/// Thread-safe. Traces may be created and flushed from any thread.
+class GcsRequestTracer {
+ public:
+  /// A sampled request. Handlers record the storage and publish spans they
+  /// observe with RecordStage(); the handler span is measured from
+  /// construction to destruction, so keeping the trace captured in the reply
+  /// callback measures the full handler lifetime. Flushes into the owning
+  /// tracer on destruction.
+  class RequestTrace {
+   public:
+    RequestTrace(GcsRequestTracer *tracer, std::string method);
+    ~RequestTrace();
+
+    RequestTrace(const RequestTrace &) = delete;
+    RequestTrace &operator=(const RequestTrace &) = delete;
+
+    /// Record an explicit stage span of `duration_ns` nanoseconds. Repeated
+    /// spans for the same stage within one request are summed.
+    void RecordStage(GcsRequestStage stage, int64_t duration_ns);
+
+   private:
+    GcsRequestTracer *tracer_;
+    const std::string method_;
+    const int64_t start_time_ns_;
+    std::array<int64_t, kNumGcsRequestStages> stage_duration_ns_ = {0};
+  };
+
+  GcsRequestTracer() = default;
+
+  /// Return a trace if this request is sampled, otherwise nullptr. Sampling
+  /// is deterministic: with a sample rate r, every round(1/r)-th request per
+  /// tracer is traced.
+  ///
+  /// \param method The fully qualified RPC method name, e.g.
+  /// "NodeInfoGcsService.RegisterNode".
+  std::shared_ptr<RequestTrace> MaybeStartTrace(const std::string &method);
+
+  /// A per-method, per-stage latency summary suitable for inclusion in the
+  /// periodic GCS debug dump. Empty when nothing has been sampled.
+  std::string StatsString() const ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  /// Histogram bucket upper bounds in milliseconds; the last bucket is
+  /// unbounded. Matches the boundaries of the exported metric.
+  static constexpr std::array<int64_t, 5> kBucketBoundsMs = {1, 10, 100, 1000, 10000};
+
+  struct StageStats {
+    std::array<int64_t, kBucketBoundsMs.size() + 1> buckets = {0};
+    int64_t count = 0;
+    int64_t sum_ns = 0;
+    int64_t max_ns = 0;
+  };
+
+  /// Fold one finished trace into the aggregates and the exported metric.
+  void Flush(const std::string &method,
+             const std::array<int64_t, kNumGcsRequestStages> &stage_duration_ns)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  /// Counts every request seen, traced or not, to drive sampling.
+  std::atomic<uint64_t> request_count_ = 0;
+
+  mutable absl::Mutex mutex_;
+
+  /// Aggregated stage histograms keyed by method name.
+  absl::flat_hash_map<std::string, std::array<StageStats, kNumGcsRequestStages>>
+      stats_ ABSL_GUARDED_BY(mutex_);
+
+  ray::stats::Histogram stage_time_ms_histogram_metric_{
+      ray::GetGcsRpcStageTimeMsHistogramMetric()};
+};
+
+}  // namespace gcs
+}  // namespace ray
@@ -186,7 +186,8 @@ GcsServer::GcsServer(const ray::gcs::GcsServerConfig &config,
     RAY_LOG(FATAL) << "Unexpected storage type: " << storage_type_;
   }
 
-  gcs_table_storage_ = std::make_unique<GcsTableStorage>(std::move(store_client));
+  gcs_table_storage_ =
+      std::make_unique<GcsTableStorage>(std::move(store_client), &io_context);
 
   auto inner_publisher = std::make_unique<pubsub::Publisher>(
       /*channels=*/
@@ -198,7 +199,8 @@ GcsServer::GcsServer(const ray::gcs::GcsServerConfig &config,
           rpc::ChannelType::RAY_ERROR_INFO_CHANNEL,
           rpc::ChannelType::RAY_LOG_CHANNEL,
           rpc::ChannelType::RAY_NODE_RESOURCE_USAGE_CHANNEL,
-          rpc::ChannelType::GCS_NODE_ADDRESS_AND_LIVENESS_CHANNEL},
+          rpc::ChannelType::GCS_NODE_ADDRESS_AND_LIVENESS_CHANNEL,
+          rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL},
       /*periodical_runner=*/*pubsub_periodical_runner_,
       /*get_time_ms=*/[]() { return absl::GetCurrentTimeNanos() / 1e6; },
       /*subscriber_timeout_ms=*/RayConfig::instance().subscriber_timeout_ms(),
@@ -355,7 +357,8 @@ void GcsServer::InitGcsNodeManager(const GcsInitData &gcs_init_data) {
       &raylet_client_pool_,
       rpc_server_.GetClusterId(),
       *ray_event_recorder_,
-      config_.session_name);
+      config_.session_name,
+      &request_tracer_);
   // Initialize by gcs tables data.
   gcs_node_manager_->Initialize(gcs_init_data);
   rpc_server_.RegisterService(std::make_unique<rpc::NodeInfoGrpcService>(
@@ -647,7 +650,8 @@ void GcsServer::InitKVManager() {
   kv_manager_ = std::make_unique<GcsInternalKVManager>(
       std::make_unique<StoreClientInternalKV>(std::move(store_client)),
       config_.raylet_config_list,
-      io_context);
+      io_context,
+      gcs_publisher_.get());
 
   kv_manager_->GetInstance().Put(
       "",
@@ -915,6 +919,11 @@ void GcsServer::PrintDebugState() const {
                 << gcs_task_manager_->DebugString() << "\n\n"
                 << gcs_autoscaler_state_manager_->DebugString() << "\n\n";
 
+  if (const auto request_trace_stats = request_tracer_.StatsString();
+      !request_trace_stats.empty()) {
+    RAY_LOG(INFO) << request_trace_stats << "\n\n";
+  }
+
   /// If periodic asio stats print is enabled, it will print it.
   const auto event_stats_print_interval_ms =
       RayConfig::instance().event_stats_print_interval_ms();
@@ -26,6 +26,7 @@
 #include "ray/gcs/gcs_health_check_manager.h"
 #include "ray/gcs/gcs_init_data.h"
 #include "ray/gcs/gcs_kv_manager.h"
+#include "ray/gcs/gcs_request_tracer.h"
 #include "ray/gcs/gcs_resource_manager.h"
 #include "ray/gcs/gcs_server_io_context_policy.h"
 #include "ray/gcs/gcs_table_storage.h"
@@ -255,6 +256,8 @@ class GcsServer {
   std::shared_ptr<ClusterResourceScheduler> cluster_resource_scheduler_;
   /// The gcs table storage.
   std::unique_ptr<gcs::GcsTableStorage> gcs_table_storage_;
+  /// Sampled per-stage request tracing; see gcs_request_trace_sample_rate.
+  gcs::GcsRequestTracer request_tracer_;
   /// [gcs_resource_manager_] depends on [cluster_lease_manager_].
   /// The gcs resource manager.
   std::unique_ptr<GcsResourceManager> gcs_resource_manager_;
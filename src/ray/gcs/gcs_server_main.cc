@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "gflags/gflags.h"
+#include "ray/common/asio/periodical_runner.h"
 #include "ray/common/constants.h"
 #include "ray/common/metrics.h"
 #include "ray/common/ray_config.h"
@@ -33,6 +34,7 @@
 #include "ray/raylet/metrics.h"
 #include "ray/stats/stats.h"
 #include "ray/util/event.h"
+#include "ray/util/memory_telemetry.h"
 #include "ray/util/port_persistence.h"
 #include "ray/util/raii.h"
 #include "ray/util/stream_redirection.h"
@@ -141,6 +143,24 @@ int main(int argc, char *argv[]) {
                                             {ray::stats::SessionNameKey, session_name}};
   ray::stats::Init(global_tags, ray::WorkerID::Nil());
 
+  if (RayConfig::instance().memory_telemetry_enabled()) {
+    ray::MemoryTelemetry::Instance().Enable(
+        RayConfig::instance().memory_telemetry_sample_period());
+    ray::stats::Gauge memory_telemetry_gauge =
+        ray::GetMemoryTelemetryEstimatedBytesGaugeMetric();
+    auto memory_telemetry_runner = ray::PeriodicalRunner::Create(main_service);
+    memory_telemetry_runner->RunFnPeriodically(
+        [memory_telemetry_runner, memory_telemetry_gauge]() mutable {
+          for (const auto &entry :
+               ray::MemoryTelemetry::Instance().GetEstimatedLiveBytes()) {
+            memory_telemetry_gauge.Record(static_cast<double>(entry.bytes),
+                                          {{"Tag", ray::MemoryTagName(entry.tag)}});
+          }
+        },
+        RayConfig::instance().memory_telemetry_report_interval_ms(),
+        "MemoryTelemetry.Export");
+  }
+
   // Initialize event framework.
   if (RayConfig::instance().event_log_reporter_enabled() && !log_dir.empty()) {
     // This GCS server process emits GCS standard events, and
@@ -0,0 +1,125 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/gcs_table_envelope.h"
+
+#include <algorithm>
+#include <string>
+
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace gcs {
+
+namespace {
+
+constexpr char kMagic[4] = {'\0', 'G', 'T', 'E'};
+constexpr uint8_t kVersion = 1;
+
+constexpr size_t kStateOffset = 8;
+constexpr size_t kTimestampOffset = 16;
+constexpr size_t kIdLengthOffset = 24;
+constexpr size_t kIdOffset = 25;
+
+void StoreInt64LE(int64_t value, char *dst) {
+  const auto bits = static_cast<uint64_t>(value);
+  for (int i = 0; i < 8; i++) {
+    dst[i] = static_cast<char>((bits >> (8 * i)) & 0xff);
+  }
+}
+
+int64_t LoadInt64LE(const char *src) {
+  uint64_t bits = 0;
+  for (int i = 0; i < 8; i++) {
+    bits |= static_cast<uint64_t>(static_cast<uint8_t>(src[i])) << (8 * i);
+  }
+  return static_cast<int64_t>(bits);
+}
+
+}  // namespace
+
+std::string WrapWithEnvelope(const GcsTableEnvelopeHeader &header,
+                             const std::string &body) {
+  RAY_CHECK_LE(header.id.size(), kGcsTableEnvelopeIdCapacity);
+  std::string stored(kGcsTableEnvelopeHeaderSize, '\0');
+  std::copy(std::begin(kMagic), std::end(kMagic), stored.begin());
+  stored[4] = static_cast<char>(kVersion);
+  StoreInt64LE(header.state, &stored[kStateOffset]);
+  StoreInt64LE(header.timestamp_ms, &stored[kTimestampOffset]);
+  stored[kIdLengthOffset] = static_cast<char>(header.id.size());
+  std::copy(header.id.begin(), header.id.end(), stored.begin() + kIdOffset);
+  stored += body;
+  return stored;
+}
+
+bool HasEnvelope(std::string_view stored) {
+  return stored.size() >= kGcsTableEnvelopeHeaderSize &&
+         std::equal(std::begin(kMagic), std::end(kMagic), stored.begin()) &&
+         static_cast<uint8_t>(stored[4]) == kVersion;
+}
+
+std::optional<GcsTableEnvelopeHeader> ParseEnvelopeHeader(std::string_view stored) {
+  if (!HasEnvelope(stored)) {
+    return std::nullopt;
+  }
+  GcsTableEnvelopeHeader header;
+  header.state = LoadInt64LE(&stored[kStateOffset]);
+  header.timestamp_ms = LoadInt64LE(&stored[kTimestampOffset]);
+  const auto id_length = static_cast<size_t>(static_cast<uint8_t>(stored[kIdLengthOffset]));
+  if (id_length > kGcsTableEnvelopeIdCapacity) {
+    return std::nullopt;
+  }
+  header.id = std::string(stored.substr(kIdOffset, id_length));
+  return header;
+}
+
+std::string_view EnvelopeBody(std::string_view stored) {
+  if (HasEnvelope(stored)) {
+    return stored.substr(kGcsTableEnvelopeHeaderSize);
+  }
+  return stored;
+}
+
+bool MakeEnvelopeHeader(const rpc::ActorTableData &data, GcsTableEnvelopeHeader *header) {
+  header->state = static_cast<int64_t>(data.state());
+  header->timestamp_ms = static_cast<int64_t>(data.timestamp());
+  header->id = data.address().node_id();
+  return true;
+}
+
+bool MakeEnvelopeHeader(const rpc::GcsNodeInfo &data, GcsTableEnvelopeHeader *header) {
+  header->state = static_cast<int64_t>(data.state());
+  header->timestamp_ms = static_cast<int64_t>(
+      data.state() == rpc::GcsNodeInfo::DEAD ? data.end_time_ms() : data.start_time_ms());
+  header->id = data.node_id();
+  return true;
+}
+
+bool MakeEnvelopeHeader(const rpc::WorkerTableData &data,
+                        GcsTableEnvelopeHeader *header) {
+  header->state = data.is_alive() ? 1 : 0;
+  header->timestamp_ms = data.timestamp();
+  header->id = data.worker_address().node_id();
+  return true;
+}
+
+bool MakeEnvelopeHeader(const rpc::JobTableData &data, GcsTableEnvelopeHeader *header) {
+  header->state = data.is_dead() ? 1 : 0;
+  header->timestamp_ms = data.timestamp();
+  header->id = data.job_id();
+  return true;
+}
+
+}  // namespace gcs
+}  // namespace ray
@@ -0,0 +1,103 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "src/ray/protobuf/gcs.pb.h"
+
+namespace ray {
+namespace gcs {
+
+/// Optional envelope format for GCS table values.
+///
+/// When gcs_storage_envelope_enabled is set, table values are stored as a
+/// fixed-size header carrying the hot fields of the row (state, timestamp and
+/// the associated node/job id) followed by the unchanged serialized protobuf.
+/// Readers that only need the hot fields, e.g. reconciliation passes over
+/// every row after a GCS failover, can consult the header at fixed offsets
+/// without deserializing the protobuf body.
+///
+/// Layout (integers little-endian, all offsets fixed):
+///   [0]       0x00  -- a serialized protobuf never starts with a zero tag
+///                      byte, so this distinguishes enveloped rows from rows
+///                      written without the envelope
+///   [1, 4)    magic "GTE"
+///   [4]       format version (currently 1)
+///   [5, 8)    reserved, zero
+///   [8, 16)   int64 state
+///   [16, 24)  int64 timestamp in ms
+///   [24]      id length in bytes
+///   [25, 53)  id bytes, zero padded
+///   [53, 56)  reserved, zero
+///   [56, ...) serialized protobuf body
+
+/// The hot fields stored in an envelope header. Their meaning per table is
+/// defined by the MakeEnvelopeHeader overload for the table's value type.
+struct GcsTableEnvelopeHeader {
+  int64_t state = 0;
+  int64_t timestamp_ms = 0;
+  /// Raw binary id, at most kGcsTableEnvelopeIdCapacity bytes. Empty when the
+  /// row has no associated id (e.g. an actor not yet placed on a node).
+  std::string id;
+};
+
+/// Large enough for a NodeID (28 bytes), the widest id stored.
+inline constexpr size_t kGcsTableEnvelopeIdCapacity = 28;
+
+/// Total header size; the protobuf body starts at this offset.
+inline constexpr size_t kGcsTableEnvelopeHeaderSize = 56;
+
+/// Prepend an envelope header to a serialized protobuf body.
+std::string WrapWithEnvelope(const GcsTableEnvelopeHeader &header,
+                             const std::string &body);
+
+/// Whether the stored value starts with an envelope header.
+bool HasEnvelope(std::string_view stored);
+
+/// Parse the envelope header of a stored value without touching the protobuf
+/// body. Returns nullopt for values stored without an envelope.
+std::optional<GcsTableEnvelopeHeader> ParseEnvelopeHeader(std::string_view stored);
+
+/// Return the serialized protobuf body of a stored value, skipping the
+/// envelope header if one is present.
+std::string_view EnvelopeBody(std::string_view stored);
+
+/// Fill the envelope header from a table value. Returns false for value types
+/// without designated hot fields; such values are stored without an envelope.
+template <typename Data>
+bool MakeEnvelopeHeader(const Data &data, GcsTableEnvelopeHeader *header) {
+  return false;
+}
+
+/// state = ActorState, timestamp = last state update, id = the actor's node.
+bool MakeEnvelopeHeader(const rpc::ActorTableData &data, GcsTableEnvelopeHeader *header);
+
+/// state = GcsNodeState, timestamp = start time (end time once dead), id =
+/// the node id.
+bool MakeEnvelopeHeader(const rpc::GcsNodeInfo &data, GcsTableEnvelopeHeader *header);
+
+/// state = is_alive, timestamp = last state update, id = the worker's node.
+bool MakeEnvelopeHeader(const rpc::WorkerTableData &data, GcsTableEnvelopeHeader *header);
+
+/// state = is_dead, timestamp = last state update, id = the job id.
+bool MakeEnvelopeHeader(const rpc::JobTableData &data, GcsTableEnvelopeHeader *header);
+
+}  // namespace gcs
+}  // namespace ray
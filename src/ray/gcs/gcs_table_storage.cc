@@ -14,12 +14,16 @@
 
 #include "ray/gcs/gcs_table_storage.h"
 
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "ray/common/asio/asio_util.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/gcs/postable/postable.h"
 
@@ -33,15 +37,180 @@ template <typename T>
 Postable<void(T)> JustOk(Postable<void(Status)> callback) {
   return std::move(callback).TransformArg([](T) { return Status::OK(); });
 }
+
+// Serialize a table value for storage, wrapping it in an envelope when the
+// envelope format is enabled and the value type has designated hot fields.
+template <typename Data>
+std::string SerializeValue(const Data &value) {
+  if (RayConfig::instance().gcs_storage_envelope_enabled()) {
+    GcsTableEnvelopeHeader header;
+    if (MakeEnvelopeHeader(value, &header)) {
+      return WrapWithEnvelope(header, value.SerializeAsString());
+    }
+  }
+  return value.SerializeAsString();
+}
+
+// Parse a stored table value, skipping the envelope header if one is present.
+// Rows written with and without the envelope can coexist in one table.
+template <typename Data>
+bool ParseValue(const std::string &stored, Data *data) {
+  const std::string_view body = EnvelopeBody(stored);
+  return data->ParseFromArray(body.data(), static_cast<int>(body.size()));
+}
 }  // namespace
 
+GcsTableWriteBuffer::GcsTableWriteBuffer(std::shared_ptr<StoreClient> store_client,
+                                         std::string table_name,
+                                         instrumented_io_context &io_context)
+    : store_client_(std::move(store_client)),
+      table_name_(std::move(table_name)),
+      io_context_(io_context),
+      batch_size_(RayConfig::instance().gcs_table_storage_write_behind_batch_size()),
+      flush_interval_ms_(
+          RayConfig::instance().gcs_table_storage_write_behind_flush_interval_ms()) {}
+
+void GcsTableWriteBuffer::Put(std::string key,
+                              std::string value,
+                              Postable<void(ray::Status)> callback) {
+  Append(Op{OpType::kPut, std::move(key), std::move(value), {}, std::move(callback)});
+}
+
+void GcsTableWriteBuffer::Delete(std::vector<std::string> keys,
+                                 Postable<void(ray::Status)> callback) {
+  Append(Op{OpType::kDelete, "", "", std::move(keys), std::move(callback)});
+}
+
+void GcsTableWriteBuffer::Append(Op op) {
+  bool flush_now = false;
+  bool arm_timer = false;
+  {
+    absl::MutexLock lock(&mutex_);
+    buffer_.push_back(std::move(op));
+    if (static_cast<int64_t>(buffer_.size()) >= batch_size_) {
+      flush_now = true;
+    } else if (!flush_timer_armed_ && !flush_in_flight_) {
+      // First op of a new batch: make sure it is flushed within the interval
+      // even if the batch never fills up. While a flush is in flight no timer
+      // is needed since its completion flushes whatever accumulated.
+      flush_timer_armed_ = true;
+      arm_timer = true;
+    }
+  }
+  if (flush_now) {
+    MaybeFlush();
+  }
+  if (arm_timer) {
+    execute_after(
+        io_context_,
+        [self = shared_from_this()]() {
+          {
+            absl::MutexLock lock(&self->mutex_);
+            self->flush_timer_armed_ = false;
+          }
+          self->MaybeFlush();
+        },
+        std::chrono::milliseconds(flush_interval_ms_));
+  }
+}
+
+void GcsTableWriteBuffer::MaybeFlush() {
+  auto ops = std::make_shared<std::vector<Op>>();
+  {
+    absl::MutexLock lock(&mutex_);
+    if (flush_in_flight_ || buffer_.empty()) {
+      return;
+    }
+    flush_in_flight_ = true;
+    ops->swap(buffer_);
+  }
+  FlushOps(std::move(ops), 0);
+}
+
+void GcsTableWriteBuffer::FlushOps(std::shared_ptr<std::vector<Op>> ops, size_t index) {
+  if (index == ops->size()) {
+    {
+      absl::MutexLock lock(&mutex_);
+      flush_in_flight_ = false;
+    }
+    // Group commit: everything buffered while this flush was in flight forms
+    // the next batch.
+    MaybeFlush();
+    return;
+  }
+  // [index, end) is the longest run of same-type ops; it becomes one batched
+  // store operation. Runs are issued sequentially to keep puts and deletes of
+  // the same key ordered.
+  const OpType type = (*ops)[index].type;
+  size_t end = index;
+  while (end < ops->size() && (*ops)[end].type == type) {
+    end++;
+  }
+  auto on_done = [self = shared_from_this(), ops, index, end]() {
+    for (size_t i = index; i < end; i++) {
+      std::move((*ops)[i].callback).Post("GcsTableWriteBuffer.Flush", Status::OK());
+    }
+    self->FlushOps(ops, end);
+  };
+  if (type == OpType::kPut) {
+    std::vector<std::pair<std::string, std::string>> key_values;
+    key_values.reserve(end - index);
+    for (size_t i = index; i < end; i++) {
+      key_values.emplace_back(std::move((*ops)[i].key), std::move((*ops)[i].value));
+    }
+    store_client_->AsyncMultiPut(
+        table_name_,
+        key_values,
+        {[on_done = std::move(on_done)](int64_t) { on_done(); }, io_context_});
+  } else {
+    std::vector<std::string> keys;
+    for (size_t i = index; i < end; i++) {
+      for (auto &key : (*ops)[i].keys) {
+        keys.push_back(std::move(key));
+      }
+    }
+    store_client_->AsyncBatchDelete(
+        table_name_,
+        keys,
+        {[on_done = std::move(on_done)](int64_t) { on_done(); }, io_context_});
+  }
+}
+
+template <typename Key, typename Data>
+std::shared_ptr<GcsTableWriteBuffer> GcsTable<Key, Data>::GetWriteBuffer() {
+  if (io_context_ == nullptr ||
+      RayConfig::instance().gcs_table_storage_write_behind_batch_size() <= 0) {
+    return nullptr;
+  }
+  absl::MutexLock lock(&write_buffer_mutex_);
+  if (write_buffer_ == nullptr) {
+    write_buffer_ =
+        std::make_shared<GcsTableWriteBuffer>(store_client_, table_name_, *io_context_);
+  }
+  return write_buffer_;
+}
+
+template <typename Key, typename Data>
+void GcsTable<Key, Data>::DeleteKeys(std::vector<std::string> keys,
+                                     Postable<void(ray::Status)> callback) {
+  if (auto write_buffer = GetWriteBuffer()) {
+    write_buffer->Delete(std::move(keys), std::move(callback));
+    return;
+  }
+  store_client_->AsyncBatchDelete(table_name_, keys, JustOk<int64_t>(std::move(callback)));
+}
+
 template <typename Key, typename Data>
 void GcsTable<Key, Data>::Put(const Key &key,
                               const Data &value,
                               Postable<void(ray::Status)> callback) {
+  if (auto write_buffer = GetWriteBuffer()) {
+    write_buffer->Put(key.Binary(), SerializeValue(value), std::move(callback));
+    return;
+  }
   store_client_->AsyncPut(table_name_,
                           key.Binary(),
-                          value.SerializeAsString(),
+                          SerializeValue(value),
                           /*overwrite*/ true,
                           JustOk<bool>(std::move(callback)));
 }
@@ -56,7 +225,7 @@ void GcsTable<Key, Data>::Get(const Key &key,
           std::optional<Data> value;
           if (result) {
             Data data;
-            data.ParseFromString(*result);
+            ParseValue(*result, &data);
             value = std::move(data);
           }
           cb(status, std::move(value));
@@ -75,15 +244,49 @@ void GcsTable<Key, Data>::GetAll(
             values.reserve(result.size());
             for (auto &item : result) {
               if (!item.second.empty()) {
-                values[Key::FromBinary(item.first)].ParseFromString(item.second);
+                ParseValue(item.second, &values[Key::FromBinary(item.first)]);
               }
             }
             return values;
           }));
 }
 
+template <typename Key, typename Data>
+void GcsTable<Key, Data>::GetAllEnvelopeHeaders(
+    Postable<void(absl::flat_hash_map<Key, GcsTableEnvelopeHeader>)> callback) {
+  store_client_->AsyncGetAll(
+      table_name_,
+      std::move(callback).TransformArg(
+          [](absl::flat_hash_map<std::string, std::string> result) {
+            absl::flat_hash_map<Key, GcsTableEnvelopeHeader> headers;
+            headers.reserve(result.size());
+            for (auto &item : result) {
+              if (item.second.empty()) {
+                continue;
+              }
+              auto header = ParseEnvelopeHeader(item.second);
+              if (!header.has_value()) {
+                // Row written without the envelope, e.g. before the format
+                // was enabled: fall back to a full parse for this row only.
+                Data data;
+                if (!ParseValue(item.second, &data)) {
+                  continue;
+                }
+                header.emplace();
+                MakeEnvelopeHeader(data, &header.value());
+              }
+              headers[Key::FromBinary(item.first)] = std::move(header.value());
+            }
+            return headers;
+          }));
+}
+
 template <typename Key, typename Data>
 void GcsTable<Key, Data>::Delete(const Key &key, Postable<void(ray::Status)> callback) {
+  if (auto write_buffer = GetWriteBuffer()) {
+    write_buffer->Delete({key.Binary()}, std::move(callback));
+    return;
+  }
   store_client_->AsyncDelete(
       table_name_, key.Binary(), JustOk<bool>(std::move(callback)));
 }
@@ -96,8 +299,7 @@ void GcsTable<Key, Data>::BatchDelete(const std::vector<Key> &keys,
   for (auto &key : keys) {
     keys_to_delete.emplace_back(std::move(key.Binary()));
   }
-  this->store_client_->AsyncBatchDelete(
-      this->table_name_, keys_to_delete, JustOk<int64_t>(std::move(callback)));
+  this->DeleteKeys(std::move(keys_to_delete), std::move(callback));
 }
 
 template <typename Key, typename Data>
@@ -108,11 +310,7 @@ void GcsTableWithJobId<Key, Data>::Put(const Key &key,
     absl::MutexLock lock(&mutex_);
     index_[GetJobIdFromKey(key)].insert(key);
   }
-  this->store_client_->AsyncPut(this->table_name_,
-                                key.Binary(),
-                                value.SerializeAsString(),
-                                /*overwrite*/ true,
-                                JustOk<bool>(std::move(callback)));
+  GcsTable<Key, Data>::Put(key, value, std::move(callback));
 }
 
 template <typename Key, typename Data>
@@ -134,7 +332,7 @@ void GcsTableWithJobId<Key, Data>::GetByJobId(
             absl::flat_hash_map<Key, Data> values;
             for (auto &item : result) {
               if (!item.second.empty()) {
-                values[Key::FromBinary(item.first)].ParseFromString(item.second);
+                ParseValue(item.second, &values[Key::FromBinary(item.first)]);
               }
             }
             return values;
@@ -169,18 +367,16 @@ void GcsTableWithJobId<Key, Data>::BatchDelete(const std::vector<Key> &keys,
   for (auto &key : keys) {
     keys_to_delete.push_back(key.Binary());
   }
-  this->store_client_->AsyncBatchDelete(
-      this->table_name_,
-      keys_to_delete,
-      std::move(callback).TransformArg([this, callback, keys](int64_t) {
-        {
-          absl::MutexLock lock(&mutex_);
-          for (auto &key : keys) {
-            index_[GetJobIdFromKey(key)].erase(key);
-          }
-        }
-        return Status::OK();
-      }));
+  this->DeleteKeys(std::move(keys_to_delete),
+                   std::move(callback).TransformArg([this, keys](Status status) {
+                     {
+                       absl::MutexLock lock(&mutex_);
+                       for (auto &key : keys) {
+                         index_[GetJobIdFromKey(key)].erase(key);
+                       }
+                     }
+                     return status;
+                   }));
 }
 
 template <typename Key, typename Data>
@@ -21,23 +21,91 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/mutex.h"
+#include "ray/common/asio/instrumented_io_context.h"
+#include "ray/gcs/gcs_table_envelope.h"
 #include "ray/gcs/store_client/store_client.h"
 #include "src/ray/protobuf/gcs.pb.h"
 
 namespace ray {
 namespace gcs {
 
+/// \class GcsTableWriteBuffer
+///
+/// Write-behind buffer for a single GCS table. Put and Delete operations are
+/// appended in arrival order and flushed as batched store operations (group
+/// commit) when the buffer reaches the configured batch size, when the flush
+/// timer fires, or as soon as the previous flush completes. At most one flush
+/// is in flight at a time and ops are applied in arrival order, so per-key
+/// ordering is preserved. Callbacks are invoked only after their batch has been
+/// written to the store, so they still signal durability.
+///
+/// Held by shared_ptr so in-flight flushes and armed timers keep it alive.
+class GcsTableWriteBuffer : public std::enable_shared_from_this<GcsTableWriteBuffer> {
+ public:
+  GcsTableWriteBuffer(std::shared_ptr<StoreClient> store_client,
+                      std::string table_name,
+                      instrumented_io_context &io_context);
+
+  /// Buffer a write. \p callback is called once the value is durably stored.
+  void Put(std::string key, std::string value, Postable<void(ray::Status)> callback);
+
+  /// Buffer a delete, ordered with respect to earlier buffered writes.
+  void Delete(std::vector<std::string> keys, Postable<void(ray::Status)> callback);
+
+ private:
+  enum class OpType { kPut, kDelete };
+
+  struct Op {
+    OpType type;
+    // Key and value for kPut; keys for kDelete.
+    std::string key;
+    std::string value;
+    std::vector<std::string> keys;
+    Postable<void(ray::Status)> callback;
+  };
+
+  // Appends the op, flushing if the batch size is reached and otherwise making
+  // sure a flush timer is armed.
+  void Append(Op op);
+
+  // Starts a flush unless one is already in flight or there is nothing to do.
+  void MaybeFlush();
+
+  // Issues the run of same-type ops starting at `index` as one batched store
+  // operation and chains the next run on completion.
+  void FlushOps(std::shared_ptr<std::vector<Op>> ops, size_t index);
+
+  std::shared_ptr<StoreClient> store_client_;
+  const std::string table_name_;
+  instrumented_io_context &io_context_;
+  const int64_t batch_size_;
+  const int64_t flush_interval_ms_;
+
+  absl::Mutex mutex_;
+  std::vector<Op> buffer_ ABSL_GUARDED_BY(mutex_);
+  bool flush_in_flight_ ABSL_GUARDED_BY(mutex_) = false;
+  bool flush_timer_armed_ ABSL_GUARDED_BY(mutex_) = false;
+};
+
 /// \class GcsTable
 ///
 /// GcsTable is the storage interface for all GCS tables whose data do not belong to
 /// specific jobs. This class is not meant to be used directly. All gcs table classes
 /// without job id should derive from this class and override the table_name_ member with
 /// a unique value for that table.
+///
+/// When an io_context is provided and gcs_table_storage_write_behind_batch_size
+/// is positive, Put/Delete go through a write-behind buffer (see
+/// GcsTableWriteBuffer). Reads go straight to storage and don't see buffered
+/// writes; callers needing read-after-write must wait for the Put callback,
+/// which fires only once the write is durable.
 template <typename Key, typename Data>
 class GcsTable {
  public:
-  explicit GcsTable(std::shared_ptr<StoreClient> store_client)
-      : store_client_(std::move(store_client)) {}
+  explicit GcsTable(std::shared_ptr<StoreClient> store_client,
+                    instrumented_io_context *io_context = nullptr)
+      : store_client_(std::move(store_client)), io_context_(io_context) {}
 
   virtual ~GcsTable() = default;
 
@@ -61,6 +129,15 @@ class GcsTable {
   /// \param callback Callback that will be called after data has been received.
   void GetAll(Postable<void(absl::flat_hash_map<Key, Data>)> callback);
 
+  /// Get only the envelope headers of all rows asynchronously. Rows written
+  /// with the envelope format (see gcs_storage_envelope_enabled) surface their
+  /// hot fields without deserializing the protobuf body; rows without an
+  /// envelope fall back to a full parse.
+  ///
+  /// \param callback Callback that will be called with the headers.
+  void GetAllEnvelopeHeaders(
+      Postable<void(absl::flat_hash_map<Key, GcsTableEnvelopeHeader>)> callback);
+
   /// Delete data from the table asynchronously.
   ///
   /// \param key The key that will be deleted from the table.
@@ -75,8 +152,23 @@ class GcsTable {
                            Postable<void(ray::Status)> callback);
 
  protected:
+  // Routes a batched delete through the write-behind buffer when enabled so it
+  // stays ordered with buffered writes.
+  void DeleteKeys(std::vector<std::string> keys, Postable<void(ray::Status)> callback);
+
+  // Returns the write-behind buffer, creating it on first use, or nullptr when
+  // write-behind is disabled. Created lazily because table_name_ is only set in
+  // the derived class constructor.
+  std::shared_ptr<GcsTableWriteBuffer> GetWriteBuffer();
+
   std::string table_name_;
   std::shared_ptr<StoreClient> store_client_;
+  instrumented_io_context *io_context_ = nullptr;
+
+ private:
+  absl::Mutex write_buffer_mutex_;
+  std::shared_ptr<GcsTableWriteBuffer> write_buffer_
+      ABSL_GUARDED_BY(write_buffer_mutex_);
 };
 
 /// \class GcsTableWithJobId
@@ -91,8 +183,9 @@ class GcsTable {
 template <typename Key, typename Data>
 class GcsTableWithJobId : public GcsTable<Key, Data> {
  public:
-  explicit GcsTableWithJobId(std::shared_ptr<StoreClient> store_client)
-      : GcsTable<Key, Data>(std::move(store_client)) {}
+  explicit GcsTableWithJobId(std::shared_ptr<StoreClient> store_client,
+                             instrumented_io_context *io_context = nullptr)
+      : GcsTable<Key, Data>(std::move(store_client), io_context) {}
 
   /// Write data to the table asynchronously.
   ///
@@ -144,16 +237,18 @@ class GcsTableWithJobId : public GcsTable<Key, Data> {
 
 class GcsJobTable : public GcsTable<JobID, rpc::JobTableData> {
  public:
-  explicit GcsJobTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTable(std::move(store_client)) {
+  explicit GcsJobTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTable(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::JOB);
   }
 };
 
 class GcsActorTable : public GcsTableWithJobId<ActorID, rpc::ActorTableData> {
  public:
-  explicit GcsActorTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTableWithJobId(std::move(store_client)) {
+  explicit GcsActorTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTableWithJobId(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::ACTOR);
   }
 
@@ -163,8 +258,9 @@ class GcsActorTable : public GcsTableWithJobId<ActorID, rpc::ActorTableData> {
 
 class GcsActorTaskSpecTable : public GcsTableWithJobId<ActorID, rpc::TaskSpec> {
  public:
-  explicit GcsActorTaskSpecTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTableWithJobId(std::move(store_client)) {
+  explicit GcsActorTaskSpecTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTableWithJobId(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::ACTOR_TASK_SPEC);
   }
 
@@ -175,38 +271,46 @@ class GcsActorTaskSpecTable : public GcsTableWithJobId<ActorID, rpc::TaskSpec> {
 class GcsPlacementGroupTable
     : public GcsTable<PlacementGroupID, rpc::PlacementGroupTableData> {
  public:
-  explicit GcsPlacementGroupTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTable(std::move(store_client)) {
+  explicit GcsPlacementGroupTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTable(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::PLACEMENT_GROUP);
   }
 };
 
 class GcsNodeTable : public GcsTable<NodeID, rpc::GcsNodeInfo> {
  public:
-  explicit GcsNodeTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTable(std::move(store_client)) {
+  explicit GcsNodeTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTable(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::NODE);
   }
 };
 
 class GcsWorkerTable : public GcsTable<WorkerID, rpc::WorkerTableData> {
  public:
-  explicit GcsWorkerTable(std::shared_ptr<StoreClient> store_client)
-      : GcsTable(std::move(store_client)) {
+  explicit GcsWorkerTable(std::shared_ptr<StoreClient> store_client,
+                       instrumented_io_context *io_context = nullptr)
+      : GcsTable(std::move(store_client), io_context) {
     table_name_ = rpc::TablePrefix_Name(rpc::TablePrefix::WORKERS);
   }
 };
 
 class GcsTableStorage {
  public:
-  explicit GcsTableStorage(std::shared_ptr<StoreClient> store_client)
+  /// \param io_context Used for write-behind flush timers and batch callbacks.
+  /// Required for gcs_table_storage_write_behind_batch_size to take effect.
+  explicit GcsTableStorage(std::shared_ptr<StoreClient> store_client,
+                           instrumented_io_context *io_context = nullptr)
       : store_client_(std::move(store_client)) {
-    job_table_ = std::make_unique<GcsJobTable>(store_client_);
-    actor_table_ = std::make_unique<GcsActorTable>(store_client_);
-    actor_task_spec_table_ = std::make_unique<GcsActorTaskSpecTable>(store_client_);
-    placement_group_table_ = std::make_unique<GcsPlacementGroupTable>(store_client_);
-    node_table_ = std::make_unique<GcsNodeTable>(store_client_);
-    worker_table_ = std::make_unique<GcsWorkerTable>(store_client_);
+    job_table_ = std::make_unique<GcsJobTable>(store_client_, io_context);
+    actor_table_ = std::make_unique<GcsActorTable>(store_client_, io_context);
+    actor_task_spec_table_ =
+        std::make_unique<GcsActorTaskSpecTable>(store_client_, io_context);
+    placement_group_table_ =
+        std::make_unique<GcsPlacementGroupTable>(store_client_, io_context);
+    node_table_ = std::make_unique<GcsNodeTable>(store_client_, io_context);
+    worker_table_ = std::make_unique<GcsWorkerTable>(store_client_, io_context);
   }
 
   virtual ~GcsTableStorage() = default;
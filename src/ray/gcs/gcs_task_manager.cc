@@ -78,6 +78,16 @@ std::vector<rpc::TaskEvents> GcsTaskManager::GcsTaskManagerStorage::GetTaskEvent
   return GetTaskEvents(task_locators_itr->second);
 }
 
+std::vector<rpc::TaskEvents> GcsTaskManager::GcsTaskManagerStorage::GetTaskEventsByState(
+    rpc::TaskStatus state) const {
+  auto task_locators_itr = state_index_.find(state);
+  if (task_locators_itr == state_index_.end()) {
+    // No tasks currently in this state.
+    return {};
+  }
+  return GetTaskEvents(task_locators_itr->second);
+}
+
 std::vector<rpc::TaskEvents> GcsTaskManager::GcsTaskManagerStorage::GetTaskEvents(
     const absl::flat_hash_set<TaskID> &task_ids) const {
   absl::flat_hash_set<std::shared_ptr<TaskEventLocator>> select_task_locators;
@@ -141,6 +151,9 @@ void GcsTaskManager::GcsTaskManagerStorage::MarkTaskAttemptFailedIfNeeded(
   auto state_updates = task_events.mutable_state_updates();
   (*state_updates->mutable_state_ts_ns())[ray::rpc::TaskStatus::FAILED] = failed_ts_ns;
   state_updates->mutable_error_info()->CopyFrom(error_info);
+
+  // Reflect the state change in the state index and counters.
+  UpdateStateIndex(locator);
 }
 
 void GcsTaskManager::GcsTaskManagerStorage::MarkTasksFailedOnJobEnds(
@@ -248,6 +261,36 @@ void GcsTaskManager::GcsTaskManagerStorage::UpdateIndex(
   if (!worker_id.IsNil()) {
     worker_index_[worker_id].insert(loc);
   }
+
+  UpdateStateIndex(loc);
+}
+
+void GcsTaskManager::GcsTaskManagerStorage::UpdateStateIndex(
+    const std::shared_ptr<TaskEventLocator> &loc) {
+  const auto &task_events = loc->GetTaskEventsMutable();
+  const auto latest_state = GetLatestTaskStatus(task_events);
+  const auto &indexed_state = loc->GetIndexedTaskStatus();
+  if (indexed_state.has_value() && *indexed_state == latest_state) {
+    return;
+  }
+
+  const auto job_id = JobID::FromBinary(task_events.job_id());
+  if (indexed_state.has_value()) {
+    // Move the task attempt from its previously indexed state.
+    auto state_locators_iter = state_index_.find(*indexed_state);
+    RAY_CHECK(state_locators_iter != state_index_.end());
+    RAY_CHECK(state_locators_iter->second.erase(loc) == 1);
+    if (state_locators_iter->second.empty()) {
+      state_index_.erase(state_locators_iter);
+    }
+    job_state_counter_.Swap(std::make_pair(job_id, *indexed_state),
+                            std::make_pair(job_id, latest_state));
+  } else {
+    job_state_counter_.Increment(std::make_pair(job_id, latest_state));
+  }
+
+  state_index_[latest_state].insert(loc);
+  loc->SetIndexedTaskStatus(latest_state);
 }
 
 void GcsTaskManager::GcsTaskManagerStorage::RemoveFromIndex(
@@ -284,6 +327,16 @@ void GcsTaskManager::GcsTaskManagerStorage::RemoveFromIndex(
     }
   }
 
+  const auto &indexed_state = loc->GetIndexedTaskStatus();
+  RAY_CHECK(indexed_state.has_value());
+  auto state_locators_iter = state_index_.find(*indexed_state);
+  RAY_CHECK(state_locators_iter != state_index_.end());
+  RAY_CHECK(state_locators_iter->second.erase(loc) == 1);
+  if (state_locators_iter->second.empty()) {
+    state_index_.erase(state_locators_iter);
+  }
+  job_state_counter_.Decrement(std::make_pair(job_id, *indexed_state));
+
   // Remove from primary index.
   primary_index_.erase(task_attempt);
 }
@@ -421,6 +474,20 @@ bool apply_predicate_ignore_case(std::string_view lhs,
   }
 }
 
+/// Resolve a task state filter string to the corresponding rpc::TaskStatus,
+/// matching the enum value name case-insensitively.
+std::optional<ray::rpc::TaskStatus> parse_task_status(const std::string &state_name) {
+  const google::protobuf::EnumDescriptor *task_status_descriptor =
+      ray::rpc::TaskStatus_descriptor();
+  for (int i = 0; i < task_status_descriptor->value_count(); ++i) {
+    if (absl::EqualsIgnoreCase(task_status_descriptor->value(i)->name(), state_name)) {
+      return static_cast<ray::rpc::TaskStatus>(
+          task_status_descriptor->value(i)->number());
+    }
+  }
+  return std::nullopt;
+}
+
 }  // namespace
 
 void GcsTaskManager::HandleGetTaskEvents(rpc::GetTaskEventsRequest request,
@@ -466,6 +533,32 @@ void GcsTaskManager::HandleGetTaskEvents(rpc::GetTaskEventsRequest request,
     } else if (job_ids.size() > 1) {
       task_events = std::vector<rpc::TaskEvents>();
     }
+  } else if (filters.state_filters_size() > 0) {
+    absl::flat_hash_set<ray::rpc::TaskStatus> states;
+    bool has_unknown_state = false;
+    for (const auto &state_filter_obj : filters.state_filters()) {
+      if (state_filter_obj.predicate() == rpc::FilterPredicate::EQUAL) {
+        auto state = parse_task_status(state_filter_obj.state());
+        if (state.has_value()) {
+          states.insert(*state);
+        } else {
+          // An unknown state name matches no stored task event.
+          has_unknown_state = true;
+        }
+      }
+    }
+
+    if (has_unknown_state || states.size() > 1) {
+      task_events = std::vector<rpc::TaskEvents>();
+    } else if (states.size() == 1) {
+      // Read the state index instead of scanning all stored task events.
+      task_events = task_event_storage_->GetTaskEventsByState(*states.begin());
+      // State selection spans all jobs, so report the all-jobs data loss.
+      reply->set_num_profile_task_events_dropped(
+          task_event_storage_->NumProfileEventsDropped());
+      reply->set_num_status_task_events_dropped(
+          task_event_storage_->NumTaskAttemptsDropped());
+    }
   }
 
   if (!task_events.has_value()) {
@@ -554,17 +647,7 @@ void GcsTaskManager::HandleGetTaskEvents(rpc::GetTaskEventsRequest request,
           ray::rpc::TaskStatus_descriptor();
 
       // Figure out the latest state of a task.
-      ray::rpc::TaskStatus state = ray::rpc::TaskStatus::NIL;
-      if (task_event.has_state_updates()) {
-        for (int i = task_status_descriptor->value_count() - 1; i >= 0; --i) {
-          if (task_event.state_updates().state_ts_ns().contains(
-                  task_status_descriptor->value(i)->number())) {
-            state = static_cast<ray::rpc::TaskStatus>(
-                task_status_descriptor->value(i)->number());
-            break;
-          }
-        }
-      }
+      ray::rpc::TaskStatus state = GetLatestTaskStatus(task_event);
 
       if (!std::all_of(filters.state_filters().begin(),
                        filters.state_filters().end(),
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -227,6 +228,24 @@ class GcsTaskManager : public rpc::TaskInfoGcsServiceHandler,
         const absl::flat_hash_set<std::shared_ptr<TaskEventLocator>> &task_locators)
         const;
 
+    /// Get task events of task attempts whose latest status is `state`.
+    ///
+    /// This reads the state index maintained on ingest rather than scanning all
+    /// stored task events.
+    ///
+    /// \param state The latest task status to filter on.
+    /// \return task events of task attempts currently in `state`.
+    std::vector<rpc::TaskEvents> GetTaskEventsByState(rpc::TaskStatus state) const;
+
+    /// Return the number of stored task attempts of a job whose latest status
+    /// is `state`. The counters are materialized on ingest.
+    ///
+    /// \param job_id Job ID.
+    /// \param state The latest task status.
+    int64_t NumTasksByStateForJob(const JobID &job_id, rpc::TaskStatus state) const {
+      return job_state_counter_.Get(std::make_pair(job_id, state));
+    }
+
     ///  Mark tasks from a job as failed as job ends with a delay.
     ///
     /// \param job_id Job ID
@@ -325,11 +344,22 @@ class GcsTaskManager : public rpc::TaskInfoGcsServiceHandler,
         task_list_index_ = cur_list_index;
       }
 
+      const std::optional<rpc::TaskStatus> &GetIndexedTaskStatus() const {
+        return indexed_task_status_;
+      }
+
+      void SetIndexedTaskStatus(rpc::TaskStatus status) {
+        indexed_task_status_ = status;
+      }
+
      private:
       /// Iterator to the task list.
       std::list<rpc::TaskEvents>::iterator iter_;
       /// Index of the task list.
       size_t task_list_index_;
+      /// The latest task status under which this task attempt is currently
+      /// tracked in the state index, or nullopt if not indexed yet.
+      std::optional<rpc::TaskStatus> indexed_task_status_;
     };
 
     /// A helper class to summarize the stats of a job.
@@ -433,6 +463,15 @@ class GcsTaskManager : public rpc::TaskInfoGcsServiceHandler,
     /// \return The task event locator.
     void RemoveFromIndex(const std::shared_ptr<TaskEventLocator> &loc);
 
+    /// Re-index the locator under the latest task status and keep the per-job
+    /// per-state counters in sync.
+    ///
+    /// This must be called whenever the state updates of a tracked task
+    /// attempt might have changed.
+    ///
+    /// \param loc The task event locator.
+    void UpdateStateIndex(const std::shared_ptr<TaskEventLocator> &loc);
+
     /// Record data loss from a worker.
     /// \param data
     void RecordDataLossFromWorker(const rpc::TaskEventData &data);
@@ -465,6 +504,13 @@ class GcsTaskManager : public rpc::TaskInfoGcsServiceHandler,
         job_index_;
     absl::flat_hash_map<WorkerID, absl::flat_hash_set<std::shared_ptr<TaskEventLocator>>>
         worker_index_;
+    absl::flat_hash_map<rpc::TaskStatus,
+                        absl::flat_hash_set<std::shared_ptr<TaskEventLocator>>>
+        state_index_;
+
+    /// Materialized number of stored task attempts per job and latest task
+    /// status, maintained on ingest, state transition and eviction.
+    CounterMap<std::pair<JobID, rpc::TaskStatus>> job_state_counter_;
 
     // A summary for per job stats.
     absl::flat_hash_map<JobID, JobTaskSummary> job_task_summary_;
@@ -545,6 +591,7 @@ class GcsTaskManager : public rpc::TaskInfoGcsServiceHandler,
   FRIEND_TEST(GcsTaskManagerMemoryLimitedTest, TestIndexNoLeak);
   FRIEND_TEST(GcsTaskManagerTest, TestJobFinishesFailAllRunningTasks);
   FRIEND_TEST(GcsTaskManagerTest, TestMarkTaskAttemptFailedIfNeeded);
+  FRIEND_TEST(GcsTaskManagerTest, TestStateIndexAndJobStateCounters);
   FRIEND_TEST(GcsTaskManagerTest, TestTaskDataLossWorker);
   FRIEND_TEST(GcsTaskManagerTest, TestMultipleJobsDataLoss);
   FRIEND_TEST(GcsTaskManagerDroppedTaskAttemptsLimit, TestDroppedTaskAttemptsLimit);
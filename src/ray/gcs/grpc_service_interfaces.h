@@ -166,6 +166,10 @@ class JobInfoGcsServiceHandler {
                                    GetAllJobInfoReply *reply,
                                    SendReplyCallback send_reply_callback) = 0;
 
+  virtual void HandleGetJobSnapshot(GetJobSnapshotRequest request,
+                                    GetJobSnapshotReply *reply,
+                                    SendReplyCallback send_reply_callback) = 0;
+
   virtual void AddJobFinishedListener(JobFinishListenerCallback listener) = 0;
 
   virtual void HandleReportJobError(ReportJobErrorRequest request,
@@ -31,7 +31,11 @@ void ActorInfoGrpcService::InitServerCallFactories(
   RPC_SERVICE_HANDLER(ActorInfoGcsService, RestartActorForLineageReconstruction, -1)
 
   RPC_SERVICE_HANDLER(ActorInfoGcsService, GetActorInfo, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(ActorInfoGcsService, GetAllActorInfo, max_active_rpcs_per_handler_)
+  /// Bulk reads driven by the dashboard and state APIs are sheddable: when the
+  /// low-priority in-flight budget is exhausted they are rejected instead of
+  /// queueing behind (and delaying) control-plane writes like RegisterActor.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
+      ActorInfoGcsService, GetAllActorInfo, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(
       ActorInfoGcsService, GetNamedActorInfo, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(ActorInfoGcsService, ListNamedActors, max_active_rpcs_per_handler_)
@@ -54,7 +58,10 @@ void NodeInfoGrpcService::InitServerCallFactories(
   RPC_SERVICE_HANDLER(NodeInfoGcsService, RegisterNode, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(NodeInfoGcsService, UnregisterNode, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(NodeInfoGcsService, DrainNode, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(NodeInfoGcsService, GetAllNodeInfo, max_active_rpcs_per_handler_)
+  /// Sheddable, see the note on GetAllActorInfo. GetAllNodeAddressAndLiveness
+  /// stays high-priority because core components rely on it to resolve nodes.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
+      NodeInfoGcsService, GetAllNodeInfo, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(
       NodeInfoGcsService, GetAllNodeAddressAndLiveness, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(NodeInfoGcsService, CheckAlive, max_active_rpcs_per_handler_)
@@ -65,13 +72,14 @@ void NodeResourceInfoGrpcService::InitServerCallFactories(
     std::vector<std::unique_ptr<ServerCallFactory>> *server_call_factories,
     const ClusterID &cluster_id,
     std::shared_ptr<const AuthenticationToken> auth_token) {
-  RPC_SERVICE_HANDLER(
+  /// The bulk resource reads are sheddable, see the note on GetAllActorInfo.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
       NodeResourceInfoGcsService, GetAllAvailableResources, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
       NodeResourceInfoGcsService, GetAllTotalResources, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(
       NodeResourceInfoGcsService, GetDrainingNodes, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
       NodeResourceInfoGcsService, GetAllResourceUsage, max_active_rpcs_per_handler_)
 }
 
@@ -94,7 +102,12 @@ void JobInfoGrpcService::InitServerCallFactories(
     std::shared_ptr<const AuthenticationToken> auth_token) {
   RPC_SERVICE_HANDLER(JobInfoGcsService, AddJob, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(JobInfoGcsService, MarkJobFinished, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(JobInfoGcsService, GetAllJobInfo, max_active_rpcs_per_handler_)
+  /// Sheddable, see the note on GetAllActorInfo.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
+      JobInfoGcsService, GetAllJobInfo, max_active_rpcs_per_handler_)
+  /// Sheddable: archival export tooling retries on its own schedule.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
+      JobInfoGcsService, GetJobSnapshot, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(JobInfoGcsService, ReportJobError, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(JobInfoGcsService, GetNextJobID, max_active_rpcs_per_handler_)
 }
@@ -116,7 +129,8 @@ void WorkerInfoGrpcService::InitServerCallFactories(
   RPC_SERVICE_HANDLER(
       WorkerInfoGcsService, ReportWorkerFailure, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(WorkerInfoGcsService, GetWorkerInfo, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(
+  /// Sheddable, see the note on GetAllActorInfo.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
       WorkerInfoGcsService, GetAllWorkerInfo, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(WorkerInfoGcsService, AddWorkerInfo, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(
@@ -148,7 +162,9 @@ void TaskInfoGrpcService::InitServerCallFactories(
     const ClusterID &cluster_id,
     std::shared_ptr<const AuthenticationToken> auth_token) {
   RPC_SERVICE_HANDLER(TaskInfoGcsService, AddTaskEventData, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(TaskInfoGcsService, GetTaskEvents, max_active_rpcs_per_handler_)
+  /// Sheddable, see the note on GetAllActorInfo.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
+      TaskInfoGcsService, GetTaskEvents, max_active_rpcs_per_handler_)
 }
 
 void PlacementGroupInfoGrpcService::InitServerCallFactories(
@@ -164,7 +180,8 @@ void PlacementGroupInfoGrpcService::InitServerCallFactories(
       PlacementGroupInfoGcsService, GetPlacementGroup, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(
       PlacementGroupInfoGcsService, GetNamedPlacementGroup, max_active_rpcs_per_handler_)
-  RPC_SERVICE_HANDLER(
+  /// Sheddable, see the note on GetAllActorInfo.
+  RPC_SERVICE_HANDLER_LOW_PRIORITY(
       PlacementGroupInfoGcsService, GetAllPlacementGroup, max_active_rpcs_per_handler_)
   RPC_SERVICE_HANDLER(PlacementGroupInfoGcsService,
                       WaitPlacementGroupUntilReady,
@@ -14,12 +14,38 @@
 
 #include "ray/gcs/store_client/in_memory_store_client.h"
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
+#include "ray/common/ray_config.h"
+
 namespace ray::gcs {
 
+InMemoryStoreClient::InMemoryStoreClient()
+    : table_shards_(
+          std::max<size_t>(1, RayConfig::instance().gcs_in_memory_store_table_shards())) {
+  const size_t num_read_threads = RayConfig::instance().gcs_in_memory_store_read_threads();
+  read_pool_.reserve(num_read_threads);
+  for (size_t i = 0; i < num_read_threads; i++) {
+    read_pool_.push_back(std::make_unique<InstrumentedIOContextWithThread>(
+        absl::StrCat("InMemoryStoreRead.", i)));
+  }
+}
+
+void InMemoryStoreClient::DispatchRead(std::string name, std::function<void()> read) {
+  if (read_pool_.empty()) {
+    read();
+    return;
+  }
+  const size_t index = next_read_index_.fetch_add(1, std::memory_order_relaxed);
+  read_pool_[index % read_pool_.size()]->GetIoService().post(std::move(read),
+                                                             std::move(name));
+}
+
 void InMemoryStoreClient::AsyncPut(const std::string &table_name,
                                    const std::string &key,
                                    std::string data,
@@ -35,27 +61,48 @@ void InMemoryStoreClient::AsyncPut(const std::string &table_name,
   std::move(callback).Post("GcsInMemoryStore.Put", inserted);
 }
 
+void InMemoryStoreClient::AsyncMultiPut(
+    const std::string &table_name,
+    const std::vector<std::pair<std::string, std::string>> &key_values,
+    Postable<void(int64_t)> callback) {
+  auto &table = GetOrCreateMutableTable(table_name);
+  int64_t num_added = 0;
+  for (const auto &[key, value] : key_values) {
+    if (table.InsertOrAssign(key, value)) {
+      num_added++;
+    }
+  }
+  std::move(callback).Post("GcsInMemoryStore.MultiPut", num_added);
+}
+
 void InMemoryStoreClient::AsyncGet(
     const std::string &table_name,
     const std::string &key,
     ToPostable<rpc::OptionalItemCallback<std::string>> callback) {
-  auto table = GetTable(table_name);
-  std::optional<std::string> data;
-  if (table != nullptr) {
-    data = table->Get(key);
-  }
-  std::move(callback).Post("GcsInMemoryStore.Get", Status::OK(), std::move(data));
+  DispatchRead("GcsInMemoryStore.Get",
+               [this, table_name, key, callback = std::move(callback)]() mutable {
+                 auto table = GetTable(table_name);
+                 std::optional<std::string> data;
+                 if (table != nullptr) {
+                   data = table->Get(key);
+                 }
+                 std::move(callback).Post(
+                     "GcsInMemoryStore.Get", Status::OK(), std::move(data));
+               });
 }
 
 void InMemoryStoreClient::AsyncGetAll(
     const std::string &table_name,
     Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) {
-  auto result = absl::flat_hash_map<std::string, std::string>();
-  auto table = GetTable(table_name);
-  if (table != nullptr) {
-    result = table->GetMapClone();
-  }
-  std::move(callback).Post("GcsInMemoryStore.GetAll", std::move(result));
+  DispatchRead("GcsInMemoryStore.GetAll",
+               [this, table_name, callback = std::move(callback)]() mutable {
+                 auto result = absl::flat_hash_map<std::string, std::string>();
+                 auto table = GetTable(table_name);
+                 if (table != nullptr) {
+                   result = table->GetMapClone();
+                 }
+                 std::move(callback).Post("GcsInMemoryStore.GetAll", std::move(result));
+               });
 }
 
 void InMemoryStoreClient::AsyncMultiGet(
@@ -101,7 +148,7 @@ ConcurrentFlatMap<std::string, std::string> &InMemoryStoreClient::GetOrCreateMut
   if (iter != tables_.end()) {
     return iter->second;
   }
-  return tables_[table_name];
+  return tables_.try_emplace(table_name, table_shards_).first->second;
 }
 
 const ConcurrentFlatMap<std::string, std::string> *InMemoryStoreClient::GetTable(
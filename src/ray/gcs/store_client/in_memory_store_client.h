@@ -14,12 +14,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/synchronization/mutex.h"
+#include "ray/common/asio/asio_util.h"
 #include "ray/gcs/store_client/store_client.h"
 #include "ray/util/concurrent_flat_map.h"
 
@@ -28,10 +33,17 @@ namespace ray::gcs {
 /// \class InMemoryStoreClient
 /// Please refer to StoreClient for API semantics.
 ///
-/// This class is thread safe.
+/// This class is thread safe. Writes always complete before their Async call
+/// returns; when a read pool is configured, reads issued afterwards still
+/// observe them, but a read racing with a concurrent write may see either
+/// state.
 class InMemoryStoreClient : public StoreClient {
  public:
-  explicit InMemoryStoreClient() = default;
+  /// Reads RAY_gcs_in_memory_store_table_shards (hash shards per table) and
+  /// RAY_gcs_in_memory_store_read_threads (dedicated Get/GetAll threads) at
+  /// construction. Defaults keep all operations inline on the calling thread
+  /// with one map per table.
+  InMemoryStoreClient();
 
   void AsyncPut(const std::string &table_name,
                 const std::string &key,
@@ -39,6 +51,10 @@ class InMemoryStoreClient : public StoreClient {
                 bool overwrite,
                 Postable<void(bool)> callback) override;
 
+  void AsyncMultiPut(const std::string &table_name,
+                     const std::vector<std::pair<std::string, std::string>> &key_values,
+                     Postable<void(int64_t)> callback) override;
+
   void AsyncGet(const std::string &table_name,
                 const std::string &key,
                 ToPostable<rpc::OptionalItemCallback<std::string>> callback) override;
@@ -82,6 +98,10 @@ class InMemoryStoreClient : public StoreClient {
   const ConcurrentFlatMap<std::string, std::string> *GetTable(
       const std::string &table_name);
 
+  // Runs `read` on the next read-pool thread in round-robin order, or inline
+  // when the pool is empty. Only safe for operations that don't mutate tables.
+  void DispatchRead(std::string name, std::function<void()> read);
+
   /// Mutex to protect the tables_ field.
   absl::Mutex mutex_;
   // node_hash_map to keep pointer validity and allow for InMemoryTable which holds a
@@ -91,6 +111,18 @@ class InMemoryStoreClient : public StoreClient {
   absl::node_hash_map<std::string, ConcurrentFlatMap<std::string, std::string>> tables_
       ABSL_GUARDED_BY(mutex_);
 
+  /// Number of hash shards each table is created with.
+  const size_t table_shards_;
+
+  /// Threads serving Get/GetAll reads so large scans don't occupy the caller's
+  /// thread. Empty when gcs_in_memory_store_read_threads is 0, in which case
+  /// reads run inline. Stopped and joined on destruction, so pending reads
+  /// never outlive the client.
+  std::vector<std::unique_ptr<InstrumentedIOContextWithThread>> read_pool_;
+
+  /// Round-robin cursor into read_pool_.
+  std::atomic<size_t> next_read_index_ = 0;
+
   /// Current job id, auto-increment when request next-id.
   std::atomic<int> job_id_ = 1;
 };
@@ -42,6 +42,21 @@ void ObservableStoreClient::AsyncPut(const std::string &table_name,
                       }));
 }
 
+void ObservableStoreClient::AsyncMultiPut(
+    const std::string &table_name,
+    const std::vector<std::pair<std::string, std::string>> &key_values,
+    Postable<void(int64_t)> callback) {
+  auto start = absl::GetCurrentTimeNanos();
+  storage_operation_count_counter_.Record(1, {{"Operation", "MultiPut"}});
+  delegate_->AsyncMultiPut(
+      table_name, key_values, std::move(callback).OnInvocation([this, start]() {
+        auto end = absl::GetCurrentTimeNanos();
+        storage_operation_latency_in_ms_histogram_.Record(
+            absl::ToDoubleMilliseconds(absl::Nanoseconds(end - start)),
+            {{"Operation", "MultiPut"}});
+      }));
+}
+
 void ObservableStoreClient::AsyncGet(
     const std::string &table_name,
     const std::string &key,
@@ -44,6 +44,10 @@ class ObservableStoreClient : public StoreClient {
                 bool overwrite,
                 Postable<void(bool)> callback) override;
 
+  void AsyncMultiPut(const std::string &table_name,
+                     const std::vector<std::pair<std::string, std::string>> &key_values,
+                     Postable<void(int64_t)> callback) override;
+
   void AsyncGet(const std::string &table_name,
                 const std::string &key,
                 ToPostable<rpc::OptionalItemCallback<std::string>> callback) override;
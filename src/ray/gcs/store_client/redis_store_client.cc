@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "absl/cleanup/cleanup.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "ray/common/ray_config.h"
@@ -159,6 +160,59 @@ void RedisStoreClient::AsyncPut(const std::string &table_name,
   SendRedisCmdWithKeys({key}, std::move(command), std::move(write_callback));
 }
 
+void RedisStoreClient::AsyncMultiPut(
+    const std::string &table_name,
+    const std::vector<std::pair<std::string, std::string>> &key_values,
+    Postable<void(int64_t)> callback) {
+  if (key_values.empty()) {
+    std::move(callback).Dispatch("RedisStoreClient.AsyncMultiPut", 0);
+    return;
+  }
+  // One HSET per batch of key value pairs, chunked like GenCommandsBatched but
+  // counting pairs instead of args.
+  const size_t batch_size =
+      RayConfig::instance().maximum_gcs_storage_operation_batch_size();
+  std::vector<std::vector<std::string>> batched_keys;
+  std::vector<RedisCommand> batched_commands;
+  absl::flat_hash_set<std::string> keys_in_batch;
+  for (const auto &[key, value] : key_values) {
+    if (batched_commands.empty() ||
+        batched_commands.back().args.size() >= batch_size * 2) {
+      batched_keys.emplace_back();
+      batched_commands.emplace_back(RedisCommand{
+          "HSET", RedisKey{external_storage_namespace_, table_name}, {}});
+      keys_in_batch.clear();
+    }
+    // A key may appear multiple times in a batch (the last value wins), but it
+    // must be used as a concurrency key only once.
+    if (keys_in_batch.insert(key).second) {
+      batched_keys.back().push_back(key);
+    }
+    batched_commands.back().args.push_back(key);
+    batched_commands.back().args.push_back(value);
+  }
+
+  auto total_count = batched_commands.size();
+  auto finished_count = std::make_shared<size_t>(0);
+  auto num_added = std::make_shared<int64_t>(0);
+  auto shared_callback = std::make_shared<Postable<void(int64_t)>>(std::move(callback));
+
+  for (size_t i = 0; i < batched_commands.size(); i++) {
+    auto hset_callback = [num_added, finished_count, total_count, shared_callback](
+                             const std::shared_ptr<CallbackReply> &reply) {
+      (*num_added) += reply->ReadAsInteger();
+      ++(*finished_count);
+      if (*finished_count == total_count) {
+        std::move(*shared_callback)
+            .Dispatch("RedisStoreClient.AsyncMultiPut", *num_added);
+      }
+    };
+    SendRedisCmdWithKeys(std::move(batched_keys[i]),
+                         std::move(batched_commands[i]),
+                         std::move(hset_callback));
+  }
+}
+
 void RedisStoreClient::AsyncGet(
     const std::string &table_name,
     const std::string &key,
@@ -185,6 +239,34 @@ void RedisStoreClient::AsyncGet(
 void RedisStoreClient::AsyncGetAll(
     const std::string &table_name,
     Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) {
+  if (RayConfig::instance().redis_get_all_use_hgetall()) {
+    // Fetch the whole table with a single HGETALL round trip instead of
+    // walking an HSCAN cursor batch by batch. Each HSCAN batch is a
+    // serialized round trip, which dominates GCS recovery time for large
+    // tables.
+    RedisCommand command{/*command=*/"HGETALL",
+                         RedisKey{external_storage_namespace_, table_name},
+                         /*args=*/{}};
+    primary_context_->RunArgvAsync(
+        command.ToRedisArgs(),
+        [callback =
+             std::move(callback)](const std::shared_ptr<CallbackReply> &reply) mutable {
+          absl::flat_hash_map<std::string, std::string> result;
+          if (!reply->IsNil()) {
+            // The reply is a flat array of alternating fields and values.
+            const auto &entries = reply->ReadAsStringArray();
+            RAY_CHECK(entries.size() % 2 == 0);
+            result.reserve(entries.size() / 2);
+            for (size_t i = 0; i < entries.size(); i += 2) {
+              RAY_CHECK(entries[i].has_value() && entries[i + 1].has_value());
+              result[*entries[i]] = *entries[i + 1];
+            }
+          }
+          std::move(callback).Dispatch("RedisStoreClient.AsyncGetAll",
+                                       std::move(result));
+        });
+    return;
+  }
   RedisScanner::ScanKeysAndValues(primary_context_,
                                   RedisKey{external_storage_namespace_, table_name},
                                   RedisMatchPattern::Any(),
@@ -270,10 +352,77 @@ void RedisStoreClient::SendRedisCmdArgsAsKeys(RedisCommand command,
   SendRedisCmdWithKeys(std::move(copied), std::move(command), std::move(redis_callback));
 }
 
+void RedisStoreClient::SendPipelinedRedisCmd(RedisCommand command,
+                                             RedisCallback redis_callback) {
+  size_t request_bytes = command.command.size() + command.redis_key.ToString().size();
+  for (const auto &arg : command.args) {
+    request_bytes += arg.size();
+  }
+
+  std::function<void()> send_redis = [this,
+                                      request_bytes,
+                                      command = std::move(command),
+                                      redis_callback =
+                                          std::move(redis_callback)]() mutable {
+    primary_context_->RunArgvAsync(
+        command.ToRedisArgs(),
+        [this, request_bytes, redis_callback = std::move(redis_callback)](auto reply) {
+          std::vector<std::function<void()>> ready_requests;
+          {
+            absl::MutexLock lock(&mu_);
+            RAY_CHECK_GE(pipeline_inflight_bytes_, request_bytes);
+            pipeline_inflight_bytes_ -= request_bytes;
+            const size_t max_inflight_bytes =
+                RayConfig::instance().redis_pipeline_max_inflight_bytes();
+            while (!pipeline_overflow_queue_.empty()) {
+              auto &[bytes, request] = pipeline_overflow_queue_.front();
+              // An oversized request is still sent once it's alone in flight,
+              // otherwise it would never fit the budget.
+              if (pipeline_inflight_bytes_ != 0 &&
+                  pipeline_inflight_bytes_ + bytes > max_inflight_bytes) {
+                break;
+              }
+              pipeline_inflight_bytes_ += bytes;
+              ready_requests.emplace_back(std::move(request));
+              pipeline_overflow_queue_.pop();
+            }
+          }
+          for (auto &request : ready_requests) {
+            request();
+          }
+          if (redis_callback) {
+            redis_callback(reply);
+          }
+        });
+  };
+
+  {
+    absl::MutexLock lock(&mu_);
+    const size_t max_inflight_bytes =
+        RayConfig::instance().redis_pipeline_max_inflight_bytes();
+    // Sending while older requests wait in the overflow queue would reorder
+    // commands, so the queue must drain first.
+    if (!pipeline_overflow_queue_.empty() ||
+        (pipeline_inflight_bytes_ != 0 &&
+         pipeline_inflight_bytes_ + request_bytes > max_inflight_bytes)) {
+      pipeline_overflow_queue_.emplace(request_bytes, std::move(send_redis));
+      return;
+    }
+    pipeline_inflight_bytes_ += request_bytes;
+  }
+  send_redis();
+}
+
 void RedisStoreClient::SendRedisCmdWithKeys(std::vector<std::string> keys,
                                             RedisCommand command,
                                             RedisCallback redis_callback) {
   RAY_CHECK(!keys.empty());
+  if (RayConfig::instance().redis_enable_command_pipelining()) {
+    // All commands go to the single primary connection, which executes them
+    // in submission order; per-key serialization is not needed for ordering.
+    SendPipelinedRedisCmd(std::move(command), std::move(redis_callback));
+    return;
+  }
   auto concurrency_keys =
       ray::move_mapped(std::move(keys), [&command](std::string &&key) {
         return RedisConcurrencyKey{command.redis_key.table_name, std::move(key)};
@@ -138,6 +138,10 @@ class RedisStoreClient : public StoreClient {
                 bool overwrite,
                 Postable<void(bool)> callback) override;
 
+  void AsyncMultiPut(const std::string &table_name,
+                     const std::vector<std::pair<std::string, std::string>> &key_values,
+                     Postable<void(int64_t)> callback) override;
+
   void AsyncGet(const std::string &table_name,
                 const std::string &key,
                 ToPostable<rpc::OptionalItemCallback<std::string>> callback) override;
@@ -266,6 +270,11 @@ class RedisStoreClient : public StoreClient {
   // serialized for each key in keys. At a given time, only one request for a {table_name,
   // key} will be in flight.
   //
+  // When `redis_enable_command_pipelining` is set, the per-key serialization is
+  // skipped instead: all commands go to the single `primary_context_` connection,
+  // which executes them in submission order, so per-key ordering holds without
+  // waiting a round trip per command. See SendPipelinedRedisCmd.
+  //
   // \param keys Used as concurrency key.
   // \param args The redis commands
   // \param redis_callback The callback to call when the reply is received.
@@ -273,6 +282,13 @@ class RedisStoreClient : public StoreClient {
                             RedisCommand command,
                             RedisCallback redis_callback);
 
+  // Send the command without waiting for outstanding replies, up to
+  // `redis_pipeline_max_inflight_bytes` of request bytes in flight. Commands
+  // beyond the budget are queued in FIFO order and sent as replies free up
+  // the budget, so submission order (and therefore per-key ordering on the
+  // single connection) is preserved.
+  void SendPipelinedRedisCmd(RedisCommand command, RedisCallback redis_callback);
+
   // Conveinence method for SendRedisCmdWithKeys with keys = command.args.
   // Reason for this method: if you call SendRedisCmdWithKeys(command.args,
   // std::move(command)), it's UB because C++ don't have arg evaluation order guarantee,
@@ -301,6 +317,15 @@ class RedisStoreClient : public StoreClient {
   // The queue will be poped when the request is processed.
   absl::flat_hash_map<RedisConcurrencyKey, std::queue<std::function<void()>>>
       pending_redis_request_by_key_ ABSL_GUARDED_BY(mu_);
+
+  // Request bytes currently in flight on the pipelined path.
+  size_t pipeline_inflight_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+
+  // Pipelined requests (request bytes, send function) waiting for in-flight
+  // bytes to drop below `redis_pipeline_max_inflight_bytes`. FIFO, so the
+  // submission order of pipelined commands is preserved.
+  std::queue<std::pair<size_t, std::function<void()>>> pipeline_overflow_queue_
+      ABSL_GUARDED_BY(mu_);
   FRIEND_TEST(RedisStoreClientTest, Random);
 };
 
@@ -0,0 +1,118 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/store_client/replicating_store_client.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ray {
+namespace gcs {
+
+void ReplicatingStoreClient::AsyncPut(const std::string &table_name,
+                                      const std::string &key,
+                                      std::string data,
+                                      bool overwrite,
+                                      Postable<void(bool)> callback) {
+  mutation_sink_(
+      StoreClientMutation{StoreClientMutation::Type::kPut, table_name, key, data});
+  delegate_->AsyncPut(table_name, key, std::move(data), overwrite, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncMultiPut(
+    const std::string &table_name,
+    const std::vector<std::pair<std::string, std::string>> &key_values,
+    Postable<void(int64_t)> callback) {
+  for (const auto &key_value : key_values) {
+    mutation_sink_(StoreClientMutation{StoreClientMutation::Type::kPut,
+                                       table_name,
+                                       key_value.first,
+                                       key_value.second});
+  }
+  delegate_->AsyncMultiPut(table_name, key_values, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncGet(
+    const std::string &table_name,
+    const std::string &key,
+    ToPostable<rpc::OptionalItemCallback<std::string>> callback) {
+  delegate_->AsyncGet(table_name, key, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncGetAll(
+    const std::string &table_name,
+    Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) {
+  delegate_->AsyncGetAll(table_name, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncMultiGet(
+    const std::string &table_name,
+    const std::vector<std::string> &keys,
+    Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) {
+  delegate_->AsyncMultiGet(table_name, keys, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncDelete(const std::string &table_name,
+                                         const std::string &key,
+                                         Postable<void(bool)> callback) {
+  mutation_sink_(StoreClientMutation{
+      StoreClientMutation::Type::kDelete, table_name, key, /*value=*/""});
+  delegate_->AsyncDelete(table_name, key, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncBatchDelete(const std::string &table_name,
+                                              const std::vector<std::string> &keys,
+                                              Postable<void(int64_t)> callback) {
+  for (const auto &key : keys) {
+    mutation_sink_(StoreClientMutation{
+        StoreClientMutation::Type::kDelete, table_name, key, /*value=*/""});
+  }
+  delegate_->AsyncBatchDelete(table_name, keys, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncGetNextJobID(Postable<void(int)> callback) {
+  delegate_->AsyncGetNextJobID(std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncGetKeys(
+    const std::string &table_name,
+    const std::string &prefix,
+    Postable<void(std::vector<std::string>)> callback) {
+  delegate_->AsyncGetKeys(table_name, prefix, std::move(callback));
+}
+
+void ReplicatingStoreClient::AsyncExists(const std::string &table_name,
+                                         const std::string &key,
+                                         Postable<void(bool)> callback) {
+  delegate_->AsyncExists(table_name, key, std::move(callback));
+}
+
+void StoreClientMutationApplier::Apply(StoreClientMutation mutation) {
+  switch (mutation.type) {
+  case StoreClientMutation::Type::kPut:
+    store_.AsyncPut(mutation.table_name,
+                    mutation.key,
+                    std::move(mutation.value),
+                    /*overwrite=*/true,
+                    {[](bool) {}, io_context_});
+    break;
+  case StoreClientMutation::Type::kDelete:
+    store_.AsyncDelete(mutation.table_name, mutation.key, {[](bool) {}, io_context_});
+    break;
+  }
+}
+
+}  // namespace gcs
+}  // namespace ray
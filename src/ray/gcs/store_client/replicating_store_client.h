@@ -0,0 +1,126 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ray/gcs/store_client/store_client.h"
+
+namespace ray {
+
+namespace gcs {
+
+/// One table mutation shipped to a standby GCS. Mutations are emitted in the
+/// order the primary submits them, which on the single GCS io_context is the
+/// order the writes take effect in the delegate store.
+struct StoreClientMutation {
+  enum class Type { kPut, kDelete };
+
+  Type type;
+  std::string table_name;
+  std::string key;
+  /// The serialized row; empty for deletes.
+  std::string value;
+};
+
+/// Receives every mutation, e.g. to forward it to a standby process.
+using StoreClientMutationSink = std::function<void(StoreClientMutation)>;
+
+/// Wraps around a StoreClient instance and ships every write to a mutation
+/// sink, the primary half of warm-standby state shipping. Reads pass through
+/// untouched. Mutations are emitted at submission time rather than at
+/// completion so the sink observes them in a deterministic order; a standby
+/// applying the stream therefore converges to the same state as the delegate
+/// store, and a write that later fails at most leaves the standby with an
+/// entry the takeover reconciliation pass drops again.
+class ReplicatingStoreClient : public StoreClient {
+ public:
+  ReplicatingStoreClient(std::unique_ptr<StoreClient> delegate,
+                         StoreClientMutationSink mutation_sink)
+      : delegate_(std::move(delegate)), mutation_sink_(std::move(mutation_sink)) {}
+
+  void AsyncPut(const std::string &table_name,
+                const std::string &key,
+                std::string data,
+                bool overwrite,
+                Postable<void(bool)> callback) override;
+
+  void AsyncMultiPut(const std::string &table_name,
+                     const std::vector<std::pair<std::string, std::string>> &key_values,
+                     Postable<void(int64_t)> callback) override;
+
+  void AsyncGet(const std::string &table_name,
+                const std::string &key,
+                ToPostable<rpc::OptionalItemCallback<std::string>> callback) override;
+
+  void AsyncGetAll(
+      const std::string &table_name,
+      Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) override;
+
+  void AsyncMultiGet(
+      const std::string &table_name,
+      const std::vector<std::string> &keys,
+      Postable<void(absl::flat_hash_map<std::string, std::string>)> callback) override;
+
+  void AsyncDelete(const std::string &table_name,
+                   const std::string &key,
+                   Postable<void(bool)> callback) override;
+
+  void AsyncBatchDelete(const std::string &table_name,
+                        const std::vector<std::string> &keys,
+                        Postable<void(int64_t)> callback) override;
+
+  void AsyncGetNextJobID(Postable<void(int)> callback) override;
+
+  void AsyncGetKeys(const std::string &table_name,
+                    const std::string &prefix,
+                    Postable<void(std::vector<std::string>)> callback) override;
+
+  void AsyncExists(const std::string &table_name,
+                   const std::string &key,
+                   Postable<void(bool)> callback) override;
+
+ private:
+  std::unique_ptr<StoreClient> delegate_;
+  StoreClientMutationSink mutation_sink_;
+};
+
+/// The standby half of warm-standby state shipping: applies a replicated
+/// mutation stream to a local store (typically an InMemoryStoreClient), so
+/// when the standby is promoted its GcsInitData load hits warm local state
+/// instead of a full reload from Redis.
+class StoreClientMutationApplier {
+ public:
+  /// \param store The local store to apply mutations to.
+  /// \param io_context The io_context the store's callbacks are posted to.
+  StoreClientMutationApplier(StoreClient &store, instrumented_io_context &io_context)
+      : store_(store), io_context_(io_context) {}
+
+  /// Apply one mutation. Puts always overwrite: the stream is ordered, so the
+  /// latest value for a key wins.
+  void Apply(StoreClientMutation mutation);
+
+ private:
+  StoreClient &store_;
+  instrumented_io_context &io_context_;
+};
+
+}  // namespace gcs
+
+}  // namespace ray
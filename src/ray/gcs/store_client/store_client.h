@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ray/common/asio/io_service_pool.h"
@@ -49,6 +50,19 @@ class StoreClient {
                         bool overwrite,
                         Postable<void(bool)> callback) = 0;
 
+  /// Batch write key value pairs to the given table asynchronously, overwriting
+  /// existing entries. Pairs are applied in order, so if a key appears multiple
+  /// times the last value wins.
+  ///
+  /// \param table_name The name of the table to be written.
+  /// \param key_values The key value pairs that will be written to the table.
+  /// \param callback returns the number of NEW entries added. Overwrites are not
+  /// counted.
+  virtual void AsyncMultiPut(
+      const std::string &table_name,
+      const std::vector<std::pair<std::string, std::string>> &key_values,
+      Postable<void(int64_t)> callback) = 0;
+
   /// Get data from the given table asynchronously.
   ///
   /// \param table_name The name of the table to be read.
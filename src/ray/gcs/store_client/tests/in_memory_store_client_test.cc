@@ -31,9 +31,37 @@ class InMemoryStoreClientTest : public StoreClientTestBase {
 
 TEST_F(InMemoryStoreClientTest, AsyncPutAndAsyncGetTest) { TestAsyncPutAndAsyncGet(); }
 
+TEST_F(InMemoryStoreClientTest, AsyncMultiPutAndAsyncGetTest) {
+  TestAsyncMultiPutAndAsyncGet();
+}
+
 TEST_F(InMemoryStoreClientTest, AsyncGetAllAndBatchDeleteTest) {
   TestAsyncGetAllAndBatchDelete();
 }
+
+// Same coverage with sharded tables and reads served by a dedicated pool.
+class ShardedInMemoryStoreClientTest : public InMemoryStoreClientTest {
+ public:
+  void SetUp() override {
+    ::RayConfig::instance().gcs_in_memory_store_table_shards() = 8;
+    ::RayConfig::instance().gcs_in_memory_store_read_threads() = 2;
+    InMemoryStoreClientTest::SetUp();
+  }
+
+  void TearDown() override {
+    InMemoryStoreClientTest::TearDown();
+    ::RayConfig::instance().gcs_in_memory_store_table_shards() = 1;
+    ::RayConfig::instance().gcs_in_memory_store_read_threads() = 0;
+  }
+};
+
+TEST_F(ShardedInMemoryStoreClientTest, AsyncPutAndAsyncGetTest) {
+  TestAsyncPutAndAsyncGet();
+}
+
+TEST_F(ShardedInMemoryStoreClientTest, AsyncGetAllAndBatchDeleteTest) {
+  TestAsyncGetAllAndBatchDelete();
+}
 }  // namespace gcs
 
 }  // namespace ray
@@ -86,6 +86,10 @@ class RedisStoreClientTest : public StoreClientTestBase {
 
 TEST_F(RedisStoreClientTest, AsyncPutAndAsyncGetTest) { TestAsyncPutAndAsyncGet(); }
 
+TEST_F(RedisStoreClientTest, AsyncMultiPutAndAsyncGetTest) {
+  TestAsyncMultiPutAndAsyncGet();
+}
+
 TEST_F(RedisStoreClientTest, AsyncGetAllAndBatchDeleteTest) {
   TestAsyncGetAllAndBatchDelete();
 }
@@ -233,6 +237,136 @@ TEST_F(RedisStoreClientTest, Complicated) {
       5000));
 }
 
+class RedisStoreClientPipelinedTest : public RedisStoreClientTest {
+ public:
+  void SetUp() override {
+    ::RayConfig::instance().redis_enable_command_pipelining() = true;
+    RedisStoreClientTest::SetUp();
+  }
+
+  void TearDown() override {
+    RedisStoreClientTest::TearDown();
+    ::RayConfig::instance().redis_enable_command_pipelining() = false;
+  }
+};
+
+TEST_F(RedisStoreClientPipelinedTest, AsyncPutAndAsyncGetTest) {
+  TestAsyncPutAndAsyncGet();
+}
+
+// Same coverage with whole-table reads served by a single HGETALL instead of
+// an HSCAN cursor walk.
+class RedisStoreClientHGetAllTest : public RedisStoreClientTest {
+ public:
+  void SetUp() override {
+    ::RayConfig::instance().redis_get_all_use_hgetall() = true;
+    RedisStoreClientTest::SetUp();
+  }
+
+  void TearDown() override {
+    RedisStoreClientTest::TearDown();
+    ::RayConfig::instance().redis_get_all_use_hgetall() = false;
+  }
+};
+
+TEST_F(RedisStoreClientHGetAllTest, AsyncGetAllAndBatchDeleteTest) {
+  TestAsyncGetAllAndBatchDelete();
+}
+
+TEST_F(RedisStoreClientPipelinedTest, SameKeyWritesKeepSubmissionOrder) {
+  // Same as BasicSimple: repeated writes to the same keys must be observed in
+  // submission order even though no command waits for the previous reply.
+  auto cnt = std::make_shared<std::atomic<size_t>>(0);
+  for (size_t i = 0; i < 100; ++i) {
+    for (size_t j = 0; j < 20; ++j) {
+      ++*cnt;
+      store_client_->AsyncPut("T",
+                              absl::StrCat("A", std::to_string(j)),
+                              std::to_string(i),
+                              true,
+                              {[i, cnt](auto r) {
+                                 --*cnt;
+                                 ASSERT_TRUE((i == 0 && r) || (i != 0 && !r));
+                               },
+                               *io_service_pool_->Get()});
+    }
+  }
+  for (size_t j = 0; j < 20; ++j) {
+    ++*cnt;
+    store_client_->AsyncGet("T",
+                            absl::StrCat("A", std::to_string(j)),
+                            {[cnt](auto s, auto r) {
+                               --*cnt;
+                               ASSERT_TRUE(r.has_value());
+                               ASSERT_EQ(*r, "99");
+                             },
+                             *io_service_pool_->Get()});
+  }
+  ASSERT_TRUE(WaitForCondition([cnt]() { return *cnt == 0; }, 5000));
+}
+
+TEST_F(RedisStoreClientPipelinedTest, TinyByteBudgetPreservesOrdering) {
+  // With a 1-byte budget every command overflows, so they are drained one at
+  // a time through the overflow queue; ordering and completion must hold.
+  ::RayConfig::instance().redis_pipeline_max_inflight_bytes() = 1;
+  auto cnt = std::make_shared<std::atomic<size_t>>(0);
+  for (size_t i = 0; i < 10; ++i) {
+    ++*cnt;
+    store_client_->AsyncPut("T",
+                            "A",
+                            std::to_string(i),
+                            true,
+                            {[i, cnt](auto r) {
+                               --*cnt;
+                               ASSERT_TRUE((i == 0 && r) || (i != 0 && !r));
+                             },
+                             *io_service_pool_->Get()});
+  }
+  ++*cnt;
+  store_client_->AsyncGet("T",
+                          "A",
+                          {[cnt](auto s, auto r) {
+                             --*cnt;
+                             ASSERT_TRUE(r.has_value());
+                             ASSERT_EQ(*r, "9");
+                           },
+                           *io_service_pool_->Get()});
+  ASSERT_TRUE(WaitForCondition([cnt]() { return *cnt == 0; }, 5000));
+  ::RayConfig::instance().redis_pipeline_max_inflight_bytes() = 16 * 1024 * 1024;
+}
+
+TEST_F(RedisStoreClientTest, PutThroughputBenchmark) {
+  // Reports AsyncPut ops/sec with and without command pipelining. 2000 writes
+  // spread over 50 keys, so the non-pipelined path pays ~40 serialized round
+  // trips per key.
+  constexpr size_t kNumOps = 2000;
+  constexpr size_t kNumKeys = 50;
+  const std::string value(64, 'x');
+  auto run_round = [&](const std::string &table) {
+    auto cnt = std::make_shared<std::atomic<size_t>>(kNumOps);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kNumOps; ++i) {
+      store_client_->AsyncPut(table,
+                              absl::StrCat("K", std::to_string(i % kNumKeys)),
+                              value,
+                              true,
+                              {[cnt](auto r) { --*cnt; }, *io_service_pool_->Get()});
+    }
+    EXPECT_TRUE(WaitForCondition([cnt]() { return *cnt == 0; }, 30000));
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return static_cast<double>(kNumOps) / elapsed.count();
+  };
+
+  const double baseline_ops = run_round("BENCH_QUEUED");
+  ::RayConfig::instance().redis_enable_command_pipelining() = true;
+  const double pipelined_ops = run_round("BENCH_PIPELINED");
+  ::RayConfig::instance().redis_enable_command_pipelining() = false;
+  RAY_LOG(INFO) << "AsyncPut throughput: " << baseline_ops
+                << " ops/sec without pipelining, " << pipelined_ops
+                << " ops/sec with pipelining.";
+}
+
 TEST_F(RedisStoreClientTest, Random) {
   std::map<std::string, std::string> dict;
   auto counter = std::make_shared<std::atomic<size_t>>(0);
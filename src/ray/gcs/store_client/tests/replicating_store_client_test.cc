@@ -0,0 +1,89 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/store_client/replicating_store_client.h"
+
+#include <memory>
+#include <string>
+
+#include "ray/gcs/store_client/in_memory_store_client.h"
+#include "ray/gcs/store_client/tests/store_client_test_base.h"
+
+namespace ray {
+
+namespace gcs {
+
+/// Wires the mutation sink of the primary store to an applier feeding a
+/// standby store, the way warm-standby state shipping composes the pieces.
+class ReplicatingStoreClientTest : public StoreClientTestBase {
+ public:
+  void InitStoreClient() override {
+    standby_store_ = std::make_shared<InMemoryStoreClient>();
+    applier_ = std::make_unique<StoreClientMutationApplier>(*standby_store_,
+                                                            *io_service_pool_->Get());
+    store_client_ = std::make_shared<ReplicatingStoreClient>(
+        std::make_unique<InMemoryStoreClient>(),
+        [this](StoreClientMutation mutation) { applier_->Apply(std::move(mutation)); });
+  }
+
+  /// Read all rows of the test table from the standby store.
+  absl::flat_hash_map<std::string, std::string> GetStandbyTable() {
+    absl::flat_hash_map<std::string, std::string> result;
+    auto get_all_callback =
+        [this, &result](absl::flat_hash_map<std::string, std::string> rows) {
+          result = std::move(rows);
+          --pending_count_;
+        };
+    ++pending_count_;
+    standby_store_->AsyncGetAll(table_name_,
+                                {get_all_callback, *io_service_pool_->Get()});
+    WaitPendingDone();
+    return result;
+  }
+
+ protected:
+  std::shared_ptr<InMemoryStoreClient> standby_store_;
+  std::unique_ptr<StoreClientMutationApplier> applier_;
+};
+
+TEST_F(ReplicatingStoreClientTest, AsyncPutAndAsyncGetTest) { TestAsyncPutAndAsyncGet(); }
+
+TEST_F(ReplicatingStoreClientTest, AsyncGetAllAndBatchDeleteTest) {
+  TestAsyncGetAllAndBatchDelete();
+}
+
+TEST_F(ReplicatingStoreClientTest, StandbyConvergesTest) {
+  // Writes land in the standby store as they are shipped.
+  Put();
+  auto standby_rows = GetStandbyTable();
+  ASSERT_EQ(standby_rows.size(), key_to_value_.size());
+  for (const auto &item : key_to_value_) {
+    auto it = standby_rows.find(item.first.Hex());
+    ASSERT_NE(it, standby_rows.end());
+    ASSERT_EQ(it->second, item.second.SerializeAsString());
+  }
+
+  // Deletes are shipped too, so the standby converges back to empty.
+  Delete();
+  ASSERT_TRUE(GetStandbyTable().empty());
+}
+
+}  // namespace gcs
+
+}  // namespace ray
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
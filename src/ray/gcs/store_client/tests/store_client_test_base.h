@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
@@ -81,6 +82,39 @@ class StoreClientTestBase : public ::testing::Test {
     WaitPendingDone();
   }
 
+  void MultiPut() {
+    std::vector<std::pair<std::string, std::string>> key_values;
+    for (const auto &[key, value] : key_to_value_) {
+      key_values.emplace_back(key.Hex(), value.SerializeAsString());
+    }
+    auto multi_put_callback = [this, expected = key_values.size()](int64_t num_added) {
+      // All keys are new, so they must all be counted as added.
+      RAY_CHECK(static_cast<size_t>(num_added) == expected);
+      --pending_count_;
+    };
+    ++pending_count_;
+    store_client_->AsyncMultiPut(
+        table_name_, key_values, {multi_put_callback, *io_service_pool_->Get()});
+    WaitPendingDone();
+
+    // Overwriting the same pairs must not count anything as added.
+    auto overwrite_callback = [this](int64_t num_added) {
+      RAY_CHECK(num_added == 0);
+      --pending_count_;
+    };
+    ++pending_count_;
+    store_client_->AsyncMultiPut(
+        table_name_, key_values, {overwrite_callback, *io_service_pool_->Get()});
+    WaitPendingDone();
+  }
+
+  void TestAsyncMultiPutAndAsyncGet() {
+    MultiPut();
+    Get();
+    Delete();
+    GetEmpty();
+  }
+
   void Get() {
     auto get_callback = [this](const Status &status,
                                const std::optional<std::string> &result) {
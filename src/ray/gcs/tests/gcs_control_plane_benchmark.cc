@@ -0,0 +1,428 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Control-plane benchmark for the GCS. It drives a real `GcsServer` (backed
+// by a local Redis, like gcs_server_rpc_test) through synthetic client load:
+//
+//   * node churn: registration and unregistration storms of N nodes,
+//   * actor-registration storms of M actors,
+//   * resource/cluster state read floods, the load monitors and dashboards
+//     put on a head node.
+//
+// Each scenario reports per-RPC-class latency percentiles and RPCs/sec so
+// head-node capacity can be sized before a cluster upgrade. Scale is
+// configurable through GCS_BENCHMARK_NUM_NODES and GCS_BENCHMARK_NUM_ACTORS.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "gtest/gtest.h"
+#include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
+#include "ray/common/test_utils.h"
+#include "ray/gcs/gcs_server.h"
+#include "ray/gcs/metrics.h"
+#include "ray/gcs_rpc_client/rpc_client.h"
+#include "ray/observability/fake_metric.h"
+
+namespace ray {
+
+namespace {
+
+constexpr int kMaxInFlightRequests = 32;
+
+int GetEnvInt(const char *name, int default_value) {
+  const char *value = std::getenv(name);
+  return value != nullptr ? std::atoi(value) : default_value;
+}
+
+/// Collects per-request latencies for one RPC class and prints percentiles
+/// and the observed request rate.
+class LatencyRecorder {
+ public:
+  void Record(double latency_us) {
+    absl::MutexLock lock(&mutex_);
+    latencies_us_.push_back(latency_us);
+  }
+
+  void RecordFailure() {
+    absl::MutexLock lock(&mutex_);
+    num_failures_++;
+  }
+
+  int num_failures() const {
+    absl::MutexLock lock(&mutex_);
+    return num_failures_;
+  }
+
+  void Print(const std::string &rpc_class, double wall_time_s) const {
+    absl::MutexLock lock(&mutex_);
+    auto sorted = latencies_us_;
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted.empty()) {
+      return;
+    }
+    double total_us = 0;
+    for (double latency : sorted) {
+      total_us += latency;
+    }
+    std::cout << absl::StrFormat(
+                     "%-22s %6d rpcs in %6.2f s (%8.1f rpc/s): mean %8.1f us, "
+                     "p50 %8.1f us, p99 %8.1f us",
+                     rpc_class,
+                     sorted.size(),
+                     wall_time_s,
+                     static_cast<double>(sorted.size()) / wall_time_s,
+                     total_us / static_cast<double>(sorted.size()),
+                     sorted[sorted.size() / 2],
+                     sorted[static_cast<size_t>(0.99 * (sorted.size() - 1))])
+              << std::endl;
+  }
+
+ private:
+  mutable absl::Mutex mutex_;
+  std::vector<double> latencies_us_;
+  int num_failures_ = 0;
+};
+
+/// Issues `count` asynchronous requests with a bounded in-flight window and
+/// blocks until all replies arrive. `issue` receives the request index and a
+/// completion callback to invoke from the reply handler. Returns the wall
+/// time in seconds.
+template <typename IssueFn>
+double RunStorm(int count, const IssueFn &issue) {
+  absl::Mutex mutex;
+  int in_flight = 0;
+  int completed = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; i++) {
+    {
+      absl::MutexLock lock(&mutex);
+      auto has_capacity = [&in_flight]() { return in_flight < kMaxInFlightRequests; };
+      mutex.Await(absl::Condition(&has_capacity));
+      in_flight++;
+    }
+    issue(i, [&mutex, &in_flight, &completed]() {
+      absl::MutexLock lock(&mutex);
+      in_flight--;
+      completed++;
+    });
+  }
+  {
+    absl::MutexLock lock(&mutex);
+    auto all_done = [&completed, count]() { return completed == count; };
+    mutex.Await(absl::Condition(&all_done));
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+double NowUs(const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                   start)
+      .count();
+}
+
+}  // namespace
+
+class GcsControlPlaneBenchmark : public ::testing::Test {
+ public:
+  GcsControlPlaneBenchmark()
+      : fake_metrics_{
+            /*actor_by_state_gauge=*/actor_by_state_gauge_,
+            /*gcs_actor_by_state_gauge=*/gcs_actor_by_state_gauge_,
+            /*running_job_gauge=*/running_job_gauge_,
+            /*finished_job_counter=*/finished_job_counter_,
+            /*job_duration_in_seconds_gauge=*/job_duration_in_seconds_gauge_,
+            /*placement_group_gauge=*/placement_group_gauge_,
+            /*placement_group_creation_latency_in_ms_histogram=*/
+            placement_group_creation_latency_in_ms_histogram_,
+            /*placement_group_scheduling_latency_in_ms_histogram=*/
+            placement_group_scheduling_latency_in_ms_histogram_,
+            /*placement_group_count_gauge=*/placement_group_count_gauge_,
+            /*task_events_reported_gauge=*/task_events_reported_gauge_,
+            /*task_events_dropped_gauge=*/task_events_dropped_gauge_,
+            /*task_events_stored_gauge=*/task_events_stored_gauge_,
+            /*event_recorder_dropped_events_counter=*/fake_dropped_events_counter_,
+            /*storage_operation_latency_in_ms_histogram=*/
+            storage_operation_latency_in_ms_histogram_,
+            /*storage_operation_count_counter=*/storage_operation_count_counter_,
+            /*resource_usage_gauge=*/fake_resource_usage_gauge_,
+            fake_scheduler_placement_time_ms_histogram_,
+            /*health_check_rpc_latency_ms_histogram=*/
+            fake_health_check_rpc_latency_ms_histogram_,
+        } {
+    TestSetupUtil::StartUpRedisServers(std::vector<int>());
+  }
+
+  virtual ~GcsControlPlaneBenchmark() { TestSetupUtil::ShutDownRedisServers(); }
+
+  void SetUp() override {
+    gcs::GcsServerConfig config;
+    config.grpc_server_port = 0;
+    config.grpc_server_name = "BenchmarkGcsServer";
+    config.grpc_server_thread_num = 1;
+    config.redis_address = "127.0.0.1";
+    config.node_ip_address = "127.0.0.1";
+    config.enable_sharding_conn = false;
+    config.redis_port = TEST_REDIS_SERVER_PORTS.front();
+
+    gcs_server_ = std::make_unique<gcs::GcsServer>(config, fake_metrics_, io_service_);
+    gcs_server_->Start();
+
+    thread_io_service_ = std::make_unique<std::thread>([this] {
+      boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work(
+          io_service_.get_executor());
+      io_service_.run();
+    });
+
+    // Wait until server starts listening.
+    while (gcs_server_->GetPort() == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    client_call_manager_ = std::make_unique<rpc::ClientCallManager>(
+        io_service_, /*record_stats=*/false, /*local_address=*/"");
+    client_ = std::make_unique<rpc::GcsRpcClient>(
+        "0.0.0.0", gcs_server_->GetPort(), *client_call_manager_);
+  }
+
+  void TearDown() override {
+    io_service_.stop();
+    rpc::DrainServerCallExecutor();
+    gcs_server_->Stop();
+    thread_io_service_->join();
+    gcs_server_.reset();
+    rpc::ResetServerCallExecutor();
+  }
+
+  /// Register `num_nodes` synthetic nodes and return their node infos.
+  std::vector<std::shared_ptr<rpc::GcsNodeInfo>> RegisterNodes(int num_nodes,
+                                                               LatencyRecorder *recorder,
+                                                               double *wall_time_s) {
+    std::vector<std::shared_ptr<rpc::GcsNodeInfo>> nodes;
+    nodes.reserve(num_nodes);
+    for (int i = 0; i < num_nodes; i++) {
+      nodes.push_back(GenNodeInfo(/*port=*/static_cast<uint16_t>(10000 + i)));
+    }
+    *wall_time_s = RunStorm(num_nodes, [&](int i, std::function<void()> done) {
+      rpc::RegisterNodeRequest request;
+      request.mutable_node_info()->CopyFrom(*nodes[i]);
+      auto start = std::chrono::steady_clock::now();
+      client_->RegisterNode(
+          std::move(request),
+          [recorder, start, done = std::move(done)](
+              const Status &status, const rpc::RegisterNodeReply &reply) {
+            if (status.ok()) {
+              recorder->Record(NowUs(start));
+            } else {
+              recorder->RecordFailure();
+            }
+            done();
+          });
+    });
+    return nodes;
+  }
+
+ protected:
+  // Gcs server
+  std::unique_ptr<gcs::GcsServer> gcs_server_;
+  std::unique_ptr<std::thread> thread_io_service_;
+  instrumented_io_context io_service_;
+
+  // Gcs client
+  std::unique_ptr<rpc::GcsRpcClient> client_;
+  std::unique_ptr<rpc::ClientCallManager> client_call_manager_;
+
+  // Fake metrics for testing
+  observability::FakeGauge actor_by_state_gauge_;
+  observability::FakeGauge gcs_actor_by_state_gauge_;
+  observability::FakeGauge running_job_gauge_;
+  observability::FakeCounter finished_job_counter_;
+  observability::FakeGauge job_duration_in_seconds_gauge_;
+  observability::FakeGauge placement_group_gauge_;
+  observability::FakeHistogram placement_group_creation_latency_in_ms_histogram_;
+  observability::FakeHistogram placement_group_scheduling_latency_in_ms_histogram_;
+  observability::FakeGauge placement_group_count_gauge_;
+  observability::FakeGauge task_events_reported_gauge_;
+  observability::FakeGauge task_events_dropped_gauge_;
+  observability::FakeGauge task_events_stored_gauge_;
+  observability::FakeHistogram storage_operation_latency_in_ms_histogram_;
+  observability::FakeCounter storage_operation_count_counter_;
+  observability::FakeCounter fake_dropped_events_counter_;
+  observability::FakeGauge fake_resource_usage_gauge_;
+  observability::FakeHistogram fake_scheduler_placement_time_ms_histogram_;
+  observability::FakeHistogram fake_health_check_rpc_latency_ms_histogram_;
+
+  // Fake metrics struct
+  gcs::GcsServerMetrics fake_metrics_;
+};
+
+// Node churn: a registration storm followed by an unregistration storm.
+TEST_F(GcsControlPlaneBenchmark, NodeChurn) {
+  const int num_nodes = GetEnvInt("GCS_BENCHMARK_NUM_NODES", 50);
+
+  LatencyRecorder register_recorder;
+  double register_wall_time_s = 0;
+  auto nodes = RegisterNodes(num_nodes, &register_recorder, &register_wall_time_s);
+  register_recorder.Print("RegisterNode", register_wall_time_s);
+  EXPECT_EQ(register_recorder.num_failures(), 0);
+
+  LatencyRecorder unregister_recorder;
+  double unregister_wall_time_s =
+      RunStorm(num_nodes, [&](int i, std::function<void()> done) {
+        rpc::UnregisterNodeRequest request;
+        request.set_node_id(nodes[i]->node_id());
+        request.mutable_node_death_info()->set_reason(
+            rpc::NodeDeathInfo::EXPECTED_TERMINATION);
+        request.mutable_node_death_info()->set_reason_message(
+            "Node churn benchmark termination.");
+        auto start = std::chrono::steady_clock::now();
+        client_->UnregisterNode(
+            std::move(request),
+            [&unregister_recorder, start, done = std::move(done)](
+                const Status &status, const rpc::UnregisterNodeReply &reply) {
+              if (status.ok()) {
+                unregister_recorder.Record(NowUs(start));
+              } else {
+                unregister_recorder.RecordFailure();
+              }
+              done();
+            });
+      });
+  unregister_recorder.Print("UnregisterNode", unregister_wall_time_s);
+  EXPECT_EQ(unregister_recorder.num_failures(), 0);
+}
+
+// Actor-registration storm: M actors registered against one job.
+TEST_F(GcsControlPlaneBenchmark, ActorRegistrationStorm) {
+  const int num_actors = GetEnvInt("GCS_BENCHMARK_NUM_ACTORS", 200);
+  const JobID job_id = JobID::FromInt(1);
+
+  rpc::AddJobRequest add_job_request;
+  add_job_request.mutable_data()->CopyFrom(*GenJobTableData(job_id));
+  std::promise<bool> job_added;
+  client_->AddJob(std::move(add_job_request),
+                  [&job_added](const Status &status, const rpc::AddJobReply &reply) {
+                    job_added.set_value(status.ok());
+                  });
+  ASSERT_TRUE(WaitReady(job_added.get_future(), std::chrono::milliseconds(5000)));
+
+  LatencyRecorder recorder;
+  double wall_time_s = RunStorm(num_actors, [&](int i, std::function<void()> done) {
+    auto request = GenRegisterActorRequest(job_id);
+    auto start = std::chrono::steady_clock::now();
+    client_->RegisterActor(std::move(request),
+                           [&recorder, start, done = std::move(done)](
+                               const Status &status, const rpc::RegisterActorReply &reply) {
+                             if (status.ok()) {
+                               recorder.Record(NowUs(start));
+                             } else {
+                               recorder.RecordFailure();
+                             }
+                             done();
+                           });
+  });
+  recorder.Print("RegisterActor", wall_time_s);
+  EXPECT_EQ(recorder.num_failures(), 0);
+
+  // The storm must be fully visible in the actor table afterwards.
+  rpc::GetAllActorInfoRequest get_all_request;
+  std::promise<int> num_registered;
+  client_->GetAllActorInfo(
+      std::move(get_all_request),
+      [&num_registered](const Status &status, const rpc::GetAllActorInfoReply &reply) {
+        RAY_CHECK_OK(status);
+        num_registered.set_value(reply.actor_table_data_size());
+      });
+  auto future = num_registered.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::milliseconds(10000)),
+            std::future_status::ready);
+  EXPECT_EQ(future.get(), num_actors);
+}
+
+// Cluster state read flood: the GetAllResourceUsage / GetAllNodeInfo polling
+// load monitors, autoscalers and dashboards put on a head node, against a
+// cluster of N registered nodes. Resource usage itself flows in over the ray
+// syncer rather than an RPC, so the flood covers the read side of that path.
+TEST_F(GcsControlPlaneBenchmark, ClusterStateReadFlood) {
+  const int num_nodes = GetEnvInt("GCS_BENCHMARK_NUM_NODES", 50);
+  const int num_reads = GetEnvInt("GCS_BENCHMARK_NUM_READS", 200);
+
+  LatencyRecorder register_recorder;
+  double register_wall_time_s = 0;
+  auto nodes = RegisterNodes(num_nodes, &register_recorder, &register_wall_time_s);
+  ASSERT_EQ(register_recorder.num_failures(), 0);
+
+  LatencyRecorder resource_usage_recorder;
+  double resource_usage_wall_time_s =
+      RunStorm(num_reads, [&](int i, std::function<void()> done) {
+        rpc::GetAllResourceUsageRequest request;
+        auto start = std::chrono::steady_clock::now();
+        client_->GetAllResourceUsage(
+            std::move(request),
+            [&resource_usage_recorder, start, done = std::move(done)](
+                const Status &status, const rpc::GetAllResourceUsageReply &reply) {
+              if (status.ok()) {
+                resource_usage_recorder.Record(NowUs(start));
+              } else {
+                resource_usage_recorder.RecordFailure();
+              }
+              done();
+            });
+      });
+  resource_usage_recorder.Print("GetAllResourceUsage", resource_usage_wall_time_s);
+  EXPECT_EQ(resource_usage_recorder.num_failures(), 0);
+
+  LatencyRecorder node_info_recorder;
+  double node_info_wall_time_s =
+      RunStorm(num_reads, [&](int i, std::function<void()> done) {
+        rpc::GetAllNodeInfoRequest request;
+        auto start = std::chrono::steady_clock::now();
+        client_->GetAllNodeInfo(
+            std::move(request),
+            [&node_info_recorder, start, done = std::move(done)](
+                const Status &status, const rpc::GetAllNodeInfoReply &reply) {
+              if (status.ok()) {
+                node_info_recorder.Record(NowUs(start));
+              } else {
+                node_info_recorder.RecordFailure();
+              }
+              done();
+            });
+      });
+  node_info_recorder.Print("GetAllNodeInfo", node_info_wall_time_s);
+  EXPECT_EQ(node_info_recorder.num_failures(), 0);
+}
+
+}  // namespace ray
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  RAY_CHECK(argc == 3);
+  ray::TEST_REDIS_SERVER_EXEC_PATH = argv[1];
+  ray::TEST_REDIS_CLIENT_EXEC_PATH = argv[2];
+  return RUN_ALL_TESTS();
+}
@@ -265,6 +265,84 @@ TEST_F(GcsHealthCheckManagerTest, NoRegister) {
   ASSERT_TRUE(dead_nodes.count(node_id));
 }
 
+TEST_F(GcsHealthCheckManagerTest, JitteredAdaptivePeriod) {
+  // Recreate the manager with jitter, adaptive probe spacing and a fan-out
+  // limit; the probe/failure flow must behave like the fixed schedule.
+  health_check = gcs::GcsHealthCheckManager::Create(
+      io_service,
+      [this](const NodeID &id) { dead_nodes.insert(id); },
+      fake_health_check_rpc_latency_ms_histogram_,
+      initial_delay_ms,
+      timeout_ms,
+      period_ms,
+      failure_threshold,
+      /*jitter_ms=*/5,
+      /*max_period_ms=*/100,
+      /*max_inflight_probes=*/1,
+      /*phi_threshold=*/0);
+
+  auto node_id = AddServer();
+  Run(0);  // Initial run
+  ASSERT_TRUE(dead_nodes.empty());
+
+  // Run the first health check
+  Run();
+  ASSERT_TRUE(dead_nodes.empty());
+
+  // A few passing checks stretch the probe interval.
+  for (auto i = 0; i < 3; ++i) {
+    Run(2);  // One for starting RPC and one for the RPC callback.
+  }
+  ASSERT_TRUE(dead_nodes.empty());
+  StopServing(node_id);
+
+  // The first failure resets the interval to the base period and the counting
+  // detector still fires after failure_threshold misses.
+  for (auto i = 0; i < failure_threshold; ++i) {
+    Run(2);  // One for starting RPC and one for the RPC callback.
+  }
+
+  ASSERT_EQ(1, dead_nodes.size());
+  ASSERT_TRUE(dead_nodes.count(node_id));
+}
+
+TEST_F(GcsHealthCheckManagerTest, PhiAccrualFailsFast) {
+  // With a (deliberately tiny) phi threshold, a node with an established probe
+  // success history is failed on the first missed probe instead of waiting
+  // for failure_threshold misses.
+  health_check = gcs::GcsHealthCheckManager::Create(
+      io_service,
+      [this](const NodeID &id) { dead_nodes.insert(id); },
+      fake_health_check_rpc_latency_ms_histogram_,
+      initial_delay_ms,
+      timeout_ms,
+      period_ms,
+      failure_threshold,
+      /*jitter_ms=*/0,
+      /*max_period_ms=*/0,
+      /*max_inflight_probes=*/0,
+      /*phi_threshold=*/1e-6);
+
+  auto node_id = AddServer();
+  Run(0);  // Initial run
+  ASSERT_TRUE(dead_nodes.empty());
+
+  // Run the first health check
+  Run();
+
+  // Three more passing checks give the detector enough interval samples.
+  for (auto i = 0; i < 3; ++i) {
+    Run(2);  // One for starting RPC and one for the RPC callback.
+  }
+  ASSERT_TRUE(dead_nodes.empty());
+  StopServing(node_id);
+
+  Run(2);  // A single failed probe trips the phi detector.
+
+  ASSERT_EQ(1, dead_nodes.size());
+  ASSERT_TRUE(dead_nodes.count(node_id));
+}
+
 TEST_F(GcsHealthCheckManagerTest, StressTest) {
 #ifdef _RAY_TSAN_BUILD
   GTEST_SKIP() << "Disabled in tsan because of performance";
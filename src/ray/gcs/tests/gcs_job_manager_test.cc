@@ -14,8 +14,11 @@
 
 #include "ray/gcs/gcs_job_manager.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "mock/ray/gcs/gcs_kv_manager.h"
@@ -529,6 +532,97 @@ TEST_F(GcsJobManagerTest, TestGetAllJobInfoWithLimit) {
   ASSERT_EQ(all_job_info_reply4.status().message(), "Invalid limit");
 }
 
+TEST_F(GcsJobManagerTest, TestGetJobSnapshot) {
+  gcs::GcsInitData gcs_init_data(*gcs_table_storage_);
+  gcs_job_manager_->Initialize(/*init_data=*/gcs_init_data);
+
+  // Add 10 jobs and mark the first one finished.
+  for (int i = 0; i < 10; ++i) {
+    auto job_id = JobID::FromInt(i + 1);
+    auto add_job_request = GenAddJobRequest(job_id, "namespace_" + std::to_string(i));
+    rpc::AddJobReply empty_reply;
+    std::promise<bool> promise;
+    gcs_job_manager_->HandleAddJob(
+        *add_job_request,
+        &empty_reply,
+        [&promise](Status, std::function<void()>, std::function<void()>) {
+          promise.set_value(true);
+        });
+    promise.get_future().get();
+  }
+  rpc::MarkJobFinishedRequest mark_finished_request;
+  mark_finished_request.set_job_id(JobID::FromInt(1).Binary());
+  rpc::MarkJobFinishedReply mark_finished_reply;
+  std::promise<bool> mark_finished_promise;
+  gcs_job_manager_->HandleMarkJobFinished(
+      mark_finished_request,
+      &mark_finished_reply,
+      [&mark_finished_promise](Status, std::function<void()>, std::function<void()>) {
+        mark_finished_promise.set_value(true);
+      });
+  mark_finished_promise.get_future().get();
+
+  // Page through the snapshot with a batch size of 4.
+  std::vector<std::string> job_ids;
+  absl::flat_hash_map<std::string, bool> is_dead;
+  std::optional<std::string> start_after;
+  int num_pages = 0;
+  do {
+    rpc::GetJobSnapshotRequest snapshot_request;
+    snapshot_request.set_batch_size(4);
+    if (start_after.has_value()) {
+      snapshot_request.set_start_after_job_id(*start_after);
+    }
+    rpc::GetJobSnapshotReply snapshot_reply;
+    std::promise<bool> snapshot_promise;
+    gcs_job_manager_->HandleGetJobSnapshot(
+        snapshot_request,
+        &snapshot_reply,
+        [&snapshot_promise](Status, std::function<void()>, std::function<void()>) {
+          snapshot_promise.set_value(true);
+        });
+    snapshot_promise.get_future().get();
+
+    ASSERT_LE(snapshot_reply.job_ids_size(), 4);
+    ASSERT_EQ(snapshot_reply.is_dead_size(), snapshot_reply.job_ids_size());
+    ASSERT_EQ(snapshot_reply.start_times_size(), snapshot_reply.job_ids_size());
+    ASSERT_EQ(snapshot_reply.end_times_size(), snapshot_reply.job_ids_size());
+    for (int i = 0; i < snapshot_reply.job_ids_size(); i++) {
+      job_ids.push_back(snapshot_reply.job_ids(i));
+      is_dead[snapshot_reply.job_ids(i)] = snapshot_reply.is_dead(i);
+    }
+    start_after = snapshot_reply.has_next_start_after_job_id()
+                      ? std::optional<std::string>(
+                            snapshot_reply.next_start_after_job_id())
+                      : std::nullopt;
+    num_pages++;
+  } while (start_after.has_value());
+
+  // 10 jobs in pages of 4 -> 3 pages, in job ID order with no duplicates.
+  ASSERT_EQ(num_pages, 3);
+  ASSERT_EQ(job_ids.size(), 10);
+  ASSERT_TRUE(std::is_sorted(job_ids.begin(), job_ids.end()));
+  for (int i = 0; i < 10; ++i) {
+    const auto job_id = JobID::FromInt(i + 1).Binary();
+    ASSERT_TRUE(is_dead.contains(job_id));
+    ASSERT_EQ(is_dead[job_id], i == 0);
+  }
+
+  // An invalid batch size fails validation.
+  rpc::GetJobSnapshotRequest invalid_request;
+  invalid_request.set_batch_size(-1);
+  rpc::GetJobSnapshotReply invalid_reply;
+  std::promise<bool> invalid_promise;
+  gcs_job_manager_->HandleGetJobSnapshot(
+      invalid_request,
+      &invalid_reply,
+      [&invalid_promise](Status, std::function<void()>, std::function<void()>) {
+        invalid_promise.set_value(true);
+      });
+  invalid_promise.get_future().get();
+  ASSERT_EQ(invalid_reply.status().code(), (int)StatusCode::Invalid);
+}
+
 TEST_F(GcsJobManagerTest, TestGetJobConfig) {
   auto job_id1 = JobID::FromInt(1);
   auto job_id2 = JobID::FromInt(2);
@@ -16,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -602,6 +604,32 @@ TEST_F(GcsNodeManagerTest, TestHandleGetAllNodeInfo) {
 
     EXPECT_EQ(reply.node_info_list_size(), 2);
   }
+
+  // Test 13: Cursor-based pagination over all nodes
+  {
+    std::vector<std::string> paged_node_ids;
+    std::string cursor;
+    for (int page = 0; page < 10; ++page) {
+      rpc::GetAllNodeInfoRequest request;
+      request.set_limit(3);
+      request.set_start_after_node_id(cursor);
+      rpc::GetAllNodeInfoReply reply;
+      node_manager.HandleGetAllNodeInfo(request, &reply, send_reply_callback);
+
+      EXPECT_LE(reply.node_info_list_size(), 3);
+      EXPECT_EQ(reply.total(), 8);
+      for (const auto &node_info : reply.node_info_list()) {
+        paged_node_ids.push_back(node_info.node_id());
+      }
+      if (!reply.has_next_start_after_node_id()) {
+        break;
+      }
+      cursor = reply.next_start_after_node_id();
+    }
+    // Every node is returned exactly once, in node ID order.
+    EXPECT_EQ(paged_node_ids.size(), 8);
+    EXPECT_TRUE(std::is_sorted(paged_node_ids.begin(), paged_node_ids.end()));
+  }
 }
 
 TEST_F(GcsNodeManagerTest, TestHandleGetAllNodeAddressAndLiveness) {
@@ -733,4 +761,71 @@ TEST_F(GcsNodeManagerTest, TestHandleGetAllNodeAddressAndLiveness) {
   }
 }
 
+TEST_F(GcsNodeManagerTest, TestRecommendedResourceReportPeriod) {
+  RayConfig::instance().initialize(
+      R"(
+{
+"adaptive_resource_report_period_enabled": true,
+"raylet_report_resources_period_milliseconds": 100,
+"adaptive_resource_report_nodes_per_step": 2,
+"adaptive_resource_report_max_period_milliseconds": 400
+}
+)");
+  gcs::GcsNodeManager node_manager(gcs_publisher_.get(),
+                                   gcs_table_storage_.get(),
+                                   *io_context_,
+                                   client_pool_.get(),
+                                   ClusterID::Nil(),
+                                   *fake_ray_event_recorder_,
+                                   "test_session_name");
+  auto send_reply_callback =
+      [](ray::Status status, std::function<void()> f1, std::function<void()> f2) {};
+  auto register_node = [&](int index) {
+    auto node = GenNodeInfo(/*port=*/10000 + index);
+    rpc::RegisterNodeRequest request;
+    request.mutable_node_info()->CopyFrom(*node);
+    rpc::RegisterNodeReply reply;
+    node_manager.HandleRegisterNode(request, &reply, send_reply_callback);
+    while (io_context_->poll() > 0) {
+    }
+    return reply.recommended_resource_report_period_ms();
+  };
+
+  // One base period step per nodes_per_step alive nodes, capped at the
+  // configured maximum.
+  ASSERT_EQ(register_node(0), 100);  // 1 alive node.
+  ASSERT_EQ(register_node(1), 200);  // 2 alive nodes.
+  ASSERT_EQ(register_node(2), 200);  // 3 alive nodes.
+  ASSERT_EQ(register_node(3), 300);  // 4 alive nodes.
+  ASSERT_EQ(register_node(4), 300);  // 5 alive nodes.
+  ASSERT_EQ(register_node(5), 400);  // 6 alive nodes.
+  ASSERT_EQ(register_node(6), 400);  // 7 alive nodes: capped.
+  ASSERT_EQ(register_node(7), 400);  // 8 alive nodes: capped.
+}
+
+TEST_F(GcsNodeManagerTest, TestRecommendedResourceReportPeriodDisabled) {
+  RayConfig::instance().initialize(
+      R"(
+{
+"adaptive_resource_report_period_enabled": false
+}
+)");
+  gcs::GcsNodeManager node_manager(gcs_publisher_.get(),
+                                   gcs_table_storage_.get(),
+                                   *io_context_,
+                                   client_pool_.get(),
+                                   ClusterID::Nil(),
+                                   *fake_ray_event_recorder_,
+                                   "test_session_name");
+  auto node = GenNodeInfo();
+  rpc::RegisterNodeRequest request;
+  request.mutable_node_info()->CopyFrom(*node);
+  rpc::RegisterNodeReply reply;
+  node_manager.HandleRegisterNode(
+      request, &reply, [](ray::Status, std::function<void()>, std::function<void()>) {});
+  while (io_context_->poll() > 0) {
+  }
+  ASSERT_EQ(reply.recommended_resource_report_period_ms(), 0);
+}
+
 }  // namespace ray
@@ -24,6 +24,7 @@
 
 #include "mock/ray/pubsub/publisher.h"
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/test_utils.h"
 #include "ray/gcs/gcs_node_manager.h"
 #include "ray/gcs/gcs_placement_group.h"
@@ -96,6 +97,7 @@ class GcsPlacementGroupSchedulerTest : public ::testing::Test {
   void TearDown() override {
     io_service_.stop();
     thread_io_service_->join();
+    RayConfig::instance().gcs_placement_group_batch_prepare_commit_enabled() = false;
   }
 
   void WaitPlacementGroupPendingDone(int expected_count,
@@ -375,6 +377,93 @@ TEST_F(GcsPlacementGroupSchedulerTest, TestSchedulePlacementGroupReplyFailure) {
   CheckEqWithPlacementGroupFront(placement_group, GcsPlacementGroupStatus::FAILURE);
 }
 
+TEST_F(GcsPlacementGroupSchedulerTest, TestBatchedPrepareCommitAcrossPlacementGroups) {
+  RayConfig::instance().gcs_placement_group_batch_prepare_commit_enabled() = true;
+  auto node = GenNodeInfo();
+  AddNode(node);
+  ASSERT_EQ(1, gcs_node_manager_->GetAllAliveNodes().size());
+
+  auto placement_group1 =
+      std::make_shared<GcsPlacementGroup>(GenCreatePlacementGroupRequest(), "", counter_);
+  auto placement_group2 =
+      std::make_shared<GcsPlacementGroup>(GenCreatePlacementGroupRequest(), "", counter_);
+
+  // Schedule both placement groups in the same event-loop iteration so their
+  // prepare requests to the node coalesce into a single RPC.
+  io_service_.post(
+      [this, placement_group1, placement_group2] {
+        ScheduleUnplacedBundles(placement_group1);
+        ScheduleUnplacedBundles(placement_group2);
+      },
+      "test");
+
+  WaitPendingDone(raylet_clients_[0]->lease_callbacks, 1);
+  ASSERT_EQ(1, raylet_clients_[0]->num_lease_requested);
+
+  // One vectorized reply resolves the prepare phase of both placement groups,
+  // and their commits coalesce into a single RPC as well.
+  io_service_.post(
+      [this] { ASSERT_TRUE(raylet_clients_[0]->GrantPrepareBundleResources()); },
+      "test");
+  WaitPendingDone(raylet_clients_[0]->commit_callbacks, 1);
+  ASSERT_EQ(1, raylet_clients_[0]->num_commit_requested);
+  io_service_.post(
+      [this] { ASSERT_TRUE(raylet_clients_[0]->GrantCommitBundleResources()); }, "test");
+
+  WaitPlacementGroupPendingDone(0, GcsPlacementGroupStatus::FAILURE);
+  WaitPlacementGroupPendingDone(2, GcsPlacementGroupStatus::SUCCESS);
+}
+
+TEST_F(GcsPlacementGroupSchedulerTest, TestBatchedPreparePerGroupFailure) {
+  RayConfig::instance().gcs_placement_group_batch_prepare_commit_enabled() = true;
+  auto node = GenNodeInfo();
+  AddNode(node);
+  ASSERT_EQ(1, gcs_node_manager_->GetAllAliveNodes().size());
+
+  auto placement_group1 =
+      std::make_shared<GcsPlacementGroup>(GenCreatePlacementGroupRequest(), "", counter_);
+  auto placement_group2 =
+      std::make_shared<GcsPlacementGroup>(GenCreatePlacementGroupRequest(), "", counter_);
+
+  io_service_.post(
+      [this, placement_group1, placement_group2] {
+        ScheduleUnplacedBundles(placement_group1);
+        ScheduleUnplacedBundles(placement_group2);
+      },
+      "test");
+
+  WaitPendingDone(raylet_clients_[0]->lease_callbacks, 1);
+  ASSERT_EQ(1, raylet_clients_[0]->num_lease_requested);
+
+  // The raylet prepares each placement group atomically on its own and the
+  // per-group results let one group fail without dragging the other down.
+  io_service_.post(
+      [this,
+       pg1_id = placement_group1->GetPlacementGroupID(),
+       pg2_id = placement_group2->GetPlacementGroupID()] {
+        rpc::PrepareBundleResourcesReply reply;
+        reply.set_success(false);
+        auto *group1_result = reply.add_group_results();
+        group1_result->set_placement_group_id(pg1_id.Binary());
+        group1_result->set_success(true);
+        auto *group2_result = reply.add_group_results();
+        group2_result->set_placement_group_id(pg2_id.Binary());
+        group2_result->set_success(false);
+        ASSERT_TRUE(
+            raylet_clients_[0]->GrantPrepareBundleResources(std::move(reply)));
+      },
+      "test");
+
+  WaitPlacementGroupPendingDone(1, GcsPlacementGroupStatus::FAILURE);
+  CheckEqWithPlacementGroupFront(placement_group2, GcsPlacementGroupStatus::FAILURE);
+
+  WaitPendingDone(raylet_clients_[0]->commit_callbacks, 1);
+  io_service_.post(
+      [this] { ASSERT_TRUE(raylet_clients_[0]->GrantCommitBundleResources()); }, "test");
+  WaitPlacementGroupPendingDone(1, GcsPlacementGroupStatus::SUCCESS);
+  CheckEqWithPlacementGroupFront(placement_group1, GcsPlacementGroupStatus::SUCCESS);
+}
+
 TEST_F(GcsPlacementGroupSchedulerTest, TestSpreadStrategyResourceCheck) {
   auto node = GenNodeInfo(0);
   AddNode(node, 2);
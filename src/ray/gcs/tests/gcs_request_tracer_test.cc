@@ -0,0 +1,79 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/gcs/gcs_request_tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ray/common/ray_config.h"
+
+namespace ray {
+namespace gcs {
+
+class GcsRequestTracerTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    RayConfig::instance().gcs_request_trace_sample_rate() = 0.0;
+  }
+};
+
+TEST_F(GcsRequestTracerTest, DisabledByDefault) {
+  GcsRequestTracer tracer;
+  ASSERT_EQ(tracer.MaybeStartTrace("NodeInfoGcsService.RegisterNode"), nullptr);
+  ASSERT_TRUE(tracer.StatsString().empty());
+}
+
+TEST_F(GcsRequestTracerTest, SamplesFractionOfRequests) {
+  RayConfig::instance().gcs_request_trace_sample_rate() = 0.25;
+  GcsRequestTracer tracer;
+  int sampled = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (tracer.MaybeStartTrace("NodeInfoGcsService.RegisterNode") != nullptr) {
+      ++sampled;
+    }
+  }
+  ASSERT_EQ(sampled, 25);
+}
+
+TEST_F(GcsRequestTracerTest, AggregatesStageDurations) {
+  RayConfig::instance().gcs_request_trace_sample_rate() = 1.0;
+  GcsRequestTracer tracer;
+  {
+    auto trace = tracer.MaybeStartTrace("NodeInfoGcsService.RegisterNode");
+    ASSERT_NE(trace, nullptr);
+    trace->RecordStage(GcsRequestStage::kStorage, 2'000'000);
+    trace->RecordStage(GcsRequestStage::kStorage, 3'000'000);
+    trace->RecordStage(GcsRequestStage::kPublish, 1'000'000);
+    // The handler span is closed when the trace is destroyed.
+  }
+  const std::string stats = tracer.StatsString();
+  ASSERT_NE(stats.find("NodeInfoGcsService.RegisterNode"), std::string::npos);
+  ASSERT_NE(stats.find("handler"), std::string::npos);
+  // Repeated storage spans within one request are summed: 5 ms total.
+  ASSERT_NE(stats.find("storage: count=1, mean=5"), std::string::npos);
+  ASSERT_NE(stats.find("publish: count=1, mean=1"), std::string::npos);
+}
+
+TEST_F(GcsRequestTracerTest, RuntimeDisableStopsSampling) {
+  RayConfig::instance().gcs_request_trace_sample_rate() = 1.0;
+  GcsRequestTracer tracer;
+  ASSERT_NE(tracer.MaybeStartTrace("NodeInfoGcsService.RegisterNode"), nullptr);
+  RayConfig::instance().gcs_request_trace_sample_rate() = 0.0;
+  ASSERT_EQ(tracer.MaybeStartTrace("NodeInfoGcsService.RegisterNode"), nullptr);
+}
+
+}  // namespace gcs
+}  // namespace ray
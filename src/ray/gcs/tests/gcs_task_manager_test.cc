@@ -1147,8 +1147,10 @@ TEST_F(GcsTaskManagerTest, TestGetTaskEventsFilters) {
                      reply_state.mutable_events_by_task());
   EXPECT_EQ(reply_state.num_profile_task_events_dropped(), 0);
   EXPECT_EQ(reply_state.num_status_task_events_dropped(), 0);
-  EXPECT_EQ(reply_state.num_total_stored(), 3);
-  EXPECT_EQ(reply_state.num_filtered_on_gcs(), 1);
+  // Equal state filters are answered from the state index, so only the
+  // matching task events are selected as candidates.
+  EXPECT_EQ(reply_state.num_total_stored(), 2);
+  EXPECT_EQ(reply_state.num_filtered_on_gcs(), 0);
   EXPECT_EQ(reply_state.num_truncated(), 0);
 
   reply_not_state =
@@ -1182,8 +1184,10 @@ TEST_F(GcsTaskManagerTest, TestGetTaskEventsFilters) {
   EXPECT_EQ(reply_state.events_by_task_size(), 0);
   EXPECT_EQ(reply_state.num_profile_task_events_dropped(), 0);
   EXPECT_EQ(reply_state.num_status_task_events_dropped(), 0);
-  EXPECT_EQ(reply_state.num_total_stored(), 3);
-  EXPECT_EQ(reply_state.num_filtered_on_gcs(), 3);
+  // No stored task event has this latest state, so the state index yields an
+  // empty candidate set.
+  EXPECT_EQ(reply_state.num_total_stored(), 0);
+  EXPECT_EQ(reply_state.num_filtered_on_gcs(), 0);
   EXPECT_EQ(reply_state.num_truncated(), 0);
 
   reply_not_state =
@@ -1225,8 +1229,10 @@ TEST_F(GcsTaskManagerTest, TestGetTaskEventsFilters) {
   EXPECT_EQ(reply_multiple_state.events_by_task_size(), 0);
   EXPECT_EQ(reply_multiple_state.num_profile_task_events_dropped(), 0);
   EXPECT_EQ(reply_multiple_state.num_status_task_events_dropped(), 0);
-  EXPECT_EQ(reply_multiple_state.num_total_stored(), 3);
-  EXPECT_EQ(reply_multiple_state.num_filtered_on_gcs(), 3);
+  // Multiple equal state filters can never all match, so no candidates are
+  // selected.
+  EXPECT_EQ(reply_multiple_state.num_total_stored(), 0);
+  EXPECT_EQ(reply_multiple_state.num_filtered_on_gcs(), 0);
   EXPECT_EQ(reply_multiple_state.num_truncated(), 0);
 
   // Test multiple filters
@@ -1307,6 +1313,55 @@ TEST_F(GcsTaskManagerTest, TestMarkTaskAttemptFailedIfNeeded) {
   }
 }
 
+TEST_F(GcsTaskManagerTest, TestStateIndexAndJobStateCounters) {
+  auto job_id = JobID::FromInt(1);
+  auto tasks = GenTaskIDs(3);
+
+  SyncAddTaskEvent({tasks[0]}, {{rpc::TaskStatus::RUNNING, 1}}, TaskID::Nil(), 1);
+  SyncAddTaskEvent({tasks[1]}, {{rpc::TaskStatus::RUNNING, 1}}, TaskID::Nil(), 1);
+  SyncAddTaskEvent({tasks[2]}, {{rpc::TaskStatus::FINISHED, 2}}, TaskID::Nil(), 1);
+
+  // Per-job per-state counters are materialized on ingest.
+  EXPECT_EQ(task_manager->task_event_storage_->NumTasksByStateForJob(
+                job_id, rpc::TaskStatus::RUNNING),
+            2);
+  EXPECT_EQ(task_manager->task_event_storage_->NumTasksByStateForJob(
+                job_id, rpc::TaskStatus::FINISHED),
+            1);
+
+  // State queries read the index instead of scanning.
+  EXPECT_EQ(
+      task_manager->task_event_storage_->GetTaskEventsByState(rpc::TaskStatus::RUNNING)
+          .size(),
+      2);
+
+  // A state transition moves the task attempt between index entries and
+  // updates the counters.
+  SyncAddTaskEvent({tasks[0]}, {{rpc::TaskStatus::FINISHED, 3}}, TaskID::Nil(), 1);
+  EXPECT_EQ(task_manager->task_event_storage_->NumTasksByStateForJob(
+                job_id, rpc::TaskStatus::RUNNING),
+            1);
+  EXPECT_EQ(task_manager->task_event_storage_->NumTasksByStateForJob(
+                job_id, rpc::TaskStatus::FINISHED),
+            2);
+  EXPECT_EQ(
+      task_manager->task_event_storage_->GetTaskEventsByState(rpc::TaskStatus::FINISHED)
+          .size(),
+      2);
+
+  // The handler reads the index for equal state filters.
+  auto reply = SyncGetTaskEvents({},
+                                 /* job_id */ absl::nullopt,
+                                 /* limit */ -1,
+                                 /* exclude_driver */ false,
+                                 /* task_name */ "",
+                                 ActorID::Nil(),
+                                 "FINISHED");
+  EXPECT_EQ(reply.events_by_task_size(), 2);
+  EXPECT_EQ(reply.num_total_stored(), 2);
+  EXPECT_EQ(reply.num_filtered_on_gcs(), 0);
+}
+
 TEST_F(GcsTaskManagerTest, TestJobFinishesWithoutTaskEvents) {
   // Test that if a job is finished, but no task events have been reported.
   // This should not crash.
@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "ray/common/asio/asio_util.h"
 #include "ray/common/test_utils.h"
 #include "ray/gcs/gcs_table_storage.h"
 #include "ray/gcs/store_client/in_memory_store_client.h"
@@ -37,4 +38,62 @@ TEST_F(InMemoryGcsTableStorageTest, TestGcsTableWithJobIdApi) {
   TestGcsTableWithJobIdApi();
 }
 
+// Without the envelope format, header reads fall back to a full parse.
+TEST_F(InMemoryGcsTableStorageTest, TestEnvelopeHeaders) { TestEnvelopeHeaders(); }
+
+// Same coverage with the envelope format enabled, so every table value is
+// stored as a fixed-offset hot-field header followed by the protobuf body.
+class EnvelopeInMemoryGcsTableStorageTest : public gcs::GcsTableStorageTestBase {
+ public:
+  void SetUp() override {
+    ::RayConfig::instance().gcs_storage_envelope_enabled() = true;
+    gcs_table_storage_ = std::make_shared<gcs::GcsTableStorage>(
+        std::make_unique<gcs::InMemoryStoreClient>());
+  }
+
+  void TearDown() override {
+    ::RayConfig::instance().gcs_storage_envelope_enabled() = false;
+  }
+};
+
+TEST_F(EnvelopeInMemoryGcsTableStorageTest, TestGcsTableApi) { TestGcsTableApi(); }
+
+TEST_F(EnvelopeInMemoryGcsTableStorageTest, TestGcsTableWithJobIdApi) {
+  TestGcsTableWithJobIdApi();
+}
+
+TEST_F(EnvelopeInMemoryGcsTableStorageTest, TestEnvelopeHeaders) {
+  TestEnvelopeHeaders();
+}
+
+// Same coverage with write-behind buffering enabled. The small batch size and
+// flush interval make sure both the size and the timer flush triggers fire.
+class WriteBehindInMemoryGcsTableStorageTest : public gcs::GcsTableStorageTestBase {
+ public:
+  void SetUp() override {
+    ::RayConfig::instance().gcs_table_storage_write_behind_batch_size() = 2;
+    ::RayConfig::instance().gcs_table_storage_write_behind_flush_interval_ms() = 5;
+    io_context_ =
+        std::make_unique<InstrumentedIOContextWithThread>("WriteBehindTableStorage");
+    gcs_table_storage_ = std::make_shared<gcs::GcsTableStorage>(
+        std::make_unique<gcs::InMemoryStoreClient>(), &io_context_->GetIoService());
+  }
+
+  void TearDown() override {
+    gcs_table_storage_.reset();
+    io_context_.reset();
+    ::RayConfig::instance().gcs_table_storage_write_behind_batch_size() = 0;
+    ::RayConfig::instance().gcs_table_storage_write_behind_flush_interval_ms() = 10;
+  }
+
+ private:
+  std::unique_ptr<InstrumentedIOContextWithThread> io_context_;
+};
+
+TEST_F(WriteBehindInMemoryGcsTableStorageTest, TestGcsTableApi) { TestGcsTableApi(); }
+
+TEST_F(WriteBehindInMemoryGcsTableStorageTest, TestGcsTableWithJobIdApi) {
+  TestGcsTableWithJobIdApi();
+}
+
 }  // namespace ray
@@ -21,6 +21,9 @@
 #include <utility>
 #include <vector>
 
+#include "absl/strings/match.h"
+#include "absl/time/clock.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/scheduling/label_selector.h"
 #include "ray/gcs_rpc_client/gcs_client.h"
 #include "ray/util/container_util.h"
@@ -173,7 +176,11 @@ void NodeInfoAccessor::RegisterSelf(rpc::GcsNodeInfo &&local_node_info,
   *request.mutable_node_info() = std::move(local_node_info);
   client_impl_->GetGcsRpcClient().RegisterNode(
       std::move(request),
-      [node_id, callback](const Status &status, rpc::RegisterNodeReply &&) {
+      [this, node_id, callback](const Status &status, rpc::RegisterNodeReply &&reply) {
+        if (status.ok()) {
+          recommended_resource_report_period_ms_.store(
+              reply.recommended_resource_report_period_ms());
+        }
         if (callback) {
           callback(status);
         }
@@ -817,20 +824,78 @@ Status PlacementGroupInfoAccessor::SyncWaitUntilReady(
 InternalKVAccessor::InternalKVAccessor(GcsClient *client_impl)
     : client_impl_(client_impl) {}
 
+bool InternalKVAccessor::CacheEnabled() {
+  return RayConfig::instance().gcs_internal_kv_cache_enabled();
+}
+
+std::optional<std::optional<std::string>> InternalKVAccessor::TryGetFromCache(
+    const std::string &ns, const std::string &key) {
+  absl::MutexLock lock(&cache_mutex_);
+  auto it = cache_.find(std::make_pair(ns, key));
+  if (it == cache_.end()) {
+    return std::nullopt;
+  }
+  if (it->second.expires_at_ms != 0 &&
+      it->second.expires_at_ms <= absl::GetCurrentTimeNanos() / 1000000) {
+    cache_.erase(it);
+    return std::nullopt;
+  }
+  return it->second.value;
+}
+
+void InternalKVAccessor::PopulateCache(const std::string &ns,
+                                       const std::string &key,
+                                       std::optional<std::string> value) {
+  const int64_t ttl_ms = RayConfig::instance().gcs_internal_kv_cache_ttl_ms();
+  const int64_t expires_at_ms =
+      ttl_ms <= 0 ? 0 : absl::GetCurrentTimeNanos() / 1000000 + ttl_ms;
+  absl::MutexLock lock(&cache_mutex_);
+  cache_[std::make_pair(ns, key)] = CacheEntry{std::move(value), expires_at_ms};
+}
+
+void InternalKVAccessor::InvalidateCacheEntry(const std::string &ns,
+                                              const std::string &key,
+                                              bool by_prefix) {
+  absl::MutexLock lock(&cache_mutex_);
+  if (!by_prefix) {
+    cache_.erase(std::make_pair(ns, key));
+    return;
+  }
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    if (it->first.first == ns && absl::StartsWith(it->first.second, key)) {
+      cache_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void InternalKVAccessor::AsyncInternalKVGet(
     const std::string &ns,
     const std::string &key,
     const int64_t timeout_ms,
     const rpc::OptionalItemCallback<std::string> &callback) {
+  if (CacheEnabled()) {
+    if (auto cached = TryGetFromCache(ns, key)) {
+      callback(Status::OK(), std::move(*cached));
+      return;
+    }
+  }
   rpc::InternalKVGetRequest req;
   req.set_key(key);
   req.set_namespace_(ns);
   client_impl_->GetGcsRpcClient().InternalKVGet(
       std::move(req),
-      [callback](const Status &status, rpc::InternalKVGetReply &&reply) {
+      [this, ns, key, callback](const Status &status, rpc::InternalKVGetReply &&reply) {
         if (reply.status().code() == static_cast<int>(StatusCode::NotFound)) {
+          if (status.ok() && CacheEnabled()) {
+            PopulateCache(ns, key, std::nullopt);
+          }
           callback(status, std::nullopt);
         } else {
+          if (status.ok() && CacheEnabled()) {
+            PopulateCache(ns, key, reply.value());
+          }
           callback(status, reply.value());
         }
       },
@@ -843,6 +908,26 @@ void InternalKVAccessor::AsyncInternalKVMultiGet(
     const int64_t timeout_ms,
     const rpc::OptionalItemCallback<std::unordered_map<std::string, std::string>>
         &callback) {
+  if (CacheEnabled()) {
+    // Serve from the cache only when every requested key is fresh; a partial
+    // hit still costs one RPC, so fetch all keys to refresh them together.
+    std::unordered_map<std::string, std::string> cached_map;
+    bool all_cached = true;
+    for (const auto &key : keys) {
+      auto cached = TryGetFromCache(ns, key);
+      if (!cached.has_value()) {
+        all_cached = false;
+        break;
+      }
+      if (cached->has_value()) {
+        cached_map[key] = std::move(**cached);
+      }
+    }
+    if (all_cached) {
+      callback(Status::OK(), std::move(cached_map));
+      return;
+    }
+  }
   rpc::InternalKVMultiGetRequest req;
   for (const auto &key : keys) {
     req.add_keys(key);
@@ -850,7 +935,8 @@ void InternalKVAccessor::AsyncInternalKVMultiGet(
   req.set_namespace_(ns);
   client_impl_->GetGcsRpcClient().InternalKVMultiGet(
       std::move(req),
-      [callback](const Status &status, rpc::InternalKVMultiGetReply &&reply) {
+      [this, ns, keys, callback](const Status &status,
+                                 rpc::InternalKVMultiGetReply &&reply) {
         std::unordered_map<std::string, std::string> map;
         if (!status.ok()) {
           callback(status, map);
@@ -861,6 +947,15 @@ void InternalKVAccessor::AsyncInternalKVMultiGet(
           for (const auto &entry : reply.results()) {
             map[entry.key()] = entry.value();
           }
+          if (CacheEnabled()) {
+            for (const auto &key : keys) {
+              auto it = map.find(key);
+              PopulateCache(ns,
+                            key,
+                            it == map.end() ? std::nullopt
+                                            : std::make_optional(it->second));
+            }
+          }
           callback(Status::OK(), map);
         }
       },
@@ -881,7 +976,12 @@ void InternalKVAccessor::AsyncInternalKVPut(
   req.set_overwrite(overwrite);
   client_impl_->GetGcsRpcClient().InternalKVPut(
       std::move(req),
-      [callback](const Status &status, rpc::InternalKVPutReply &&reply) {
+      [this, ns, key, callback](const Status &status, rpc::InternalKVPutReply &&reply) {
+        if (CacheEnabled()) {
+          // Drop rather than update the local entry: whether the write took
+          // effect depends on `overwrite` and the pre-existing value.
+          InvalidateCacheEntry(ns, key, /*by_prefix=*/false);
+        }
         callback(status, reply.added());
       },
       timeout_ms);
@@ -915,7 +1015,11 @@ void InternalKVAccessor::AsyncInternalKVDel(
   req.set_del_by_prefix(del_by_prefix);
   client_impl_->GetGcsRpcClient().InternalKVDel(
       std::move(req),
-      [callback](const Status &status, rpc::InternalKVDelReply &&reply) {
+      [this, ns, key, del_by_prefix, callback](const Status &status,
+                                               rpc::InternalKVDelReply &&reply) {
+        if (CacheEnabled()) {
+          InvalidateCacheEntry(ns, key, del_by_prefix);
+        }
         callback(status, reply.deleted_num());
       },
       timeout_ms);
@@ -1073,6 +1177,56 @@ void InternalKVAccessor::AsyncGetInternalConfig(
       });
 }
 
+void InternalKVAccessor::AsyncInternalKVPrefetch(const std::string &ns,
+                                                 const std::vector<std::string> &keys,
+                                                 const int64_t timeout_ms,
+                                                 const rpc::StatusCallback &callback) {
+  if (!CacheEnabled() || keys.empty()) {
+    if (callback != nullptr) {
+      callback(Status::OK());
+    }
+    return;
+  }
+  // AsyncInternalKVMultiGet populates the cache with the fetched values,
+  // including negative entries for keys absent from the store.
+  AsyncInternalKVMultiGet(
+      ns,
+      keys,
+      timeout_ms,
+      [callback](const Status &status,
+                 std::optional<std::unordered_map<std::string, std::string>> &&) {
+        if (callback != nullptr) {
+          callback(status);
+        }
+      });
+}
+
+void InternalKVAccessor::AsyncSubscribeToKVUpdates() {
+  subscribe_operation_ = [this](const rpc::StatusCallback &done_callback) {
+    client_impl_->GetGcsSubscriber().SubscribeAllInternalKVUpdates(
+        [this](rpc::InternalKVUpdateMessage &&message) {
+          InvalidateCacheEntry(
+              message.namespace_(), message.key(), message.del_by_prefix());
+        },
+        done_callback);
+  };
+  subscribe_operation_(nullptr);
+}
+
+void InternalKVAccessor::AsyncResubscribe() {
+  if (subscribe_operation_ == nullptr) {
+    return;
+  }
+  RAY_LOG(DEBUG) << "Reestablishing subscription for internal KV updates.";
+  // Invalidations published while disconnected are lost, so everything
+  // cached so far may be stale.
+  {
+    absl::MutexLock lock(&cache_mutex_);
+    cache_.clear();
+  }
+  subscribe_operation_(nullptr);
+}
+
 RuntimeEnvAccessor::RuntimeEnvAccessor(GcsClient *client_impl)
     : client_impl_(client_impl) {}
 
@@ -13,12 +13,17 @@
 // limitations under the License.
 
 #pragma once
+#include <gtest/gtest_prod.h>
+
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/id.h"
 #include "ray/common/placement_group.h"
@@ -132,6 +137,13 @@ class NodeInfoAccessor {
   virtual void RegisterSelf(rpc::GcsNodeInfo &&local_node_info,
                             const rpc::StatusCallback &callback);
 
+  /// Get the resource report period the GCS assigned to this node when
+  /// `RegisterSelf` completed, or 0 if the GCS did not assign one. See
+  /// adaptive_resource_report_period_enabled.
+  virtual int64_t GetRecommendedResourceReportPeriodMs() const {
+    return recommended_resource_report_period_ms_.load();
+  }
+
   /// Unregister local node to GCS asynchronously.
   ///
   /// \param node_id The ID of the node to unregister from GCS.
@@ -274,6 +286,10 @@ class NodeInfoAccessor {
 
   GcsClient *client_impl_;
 
+  /// The report period assigned by the GCS in the RegisterNode reply. Written
+  /// from the registration reply callback, read from the owner's main thread.
+  std::atomic<int64_t> recommended_resource_report_period_ms_ = 0;
+
   /// The callback to call when a new node is added or a node is removed when leveraging
   /// the GcsNodeAddressAndLiveness version of the node api
   std::function<void(NodeID, const rpc::GcsNodeAddressAndLiveness &)>
@@ -722,8 +738,69 @@ class InternalKVAccessor {
   virtual void AsyncGetInternalConfig(
       const rpc::OptionalItemCallback<std::string> &callback);
 
+  /// Warm the local cache with the values of `keys` using a single MultiGet,
+  /// so subsequent Gets of those keys are served locally. Keys missing from
+  /// the store are cached as absent. No-op when the cache is disabled.
+  ///
+  /// \param ns The namespace of the keys.
+  /// \param keys The keys to prefetch.
+  /// \param timeout_ms -1 means infinite.
+  /// \param callback Callback that will be called once the cache is warm.
+  virtual void AsyncInternalKVPrefetch(const std::string &ns,
+                                       const std::vector<std::string> &keys,
+                                       const int64_t timeout_ms,
+                                       const rpc::StatusCallback &callback);
+
+  /// Subscribe to KV updates published by the GCS so cached entries are
+  /// dropped when their key is written or deleted. Called on connection when
+  /// the cache is enabled.
+  virtual void AsyncSubscribeToKVUpdates();
+
+  /// Reestablish subscription, called when the GCS restarts. The cache is
+  /// cleared because invalidations may have been lost while disconnected.
+  virtual void AsyncResubscribe();
+
  private:
+  FRIEND_TEST(InternalKVAccessorTest, TestCacheServesRepeatReads);
+  FRIEND_TEST(InternalKVAccessorTest, TestCacheInvalidation);
+
+  /// Whether the local read-through cache is enabled.
+  static bool CacheEnabled();
+
+  /// Look up a fresh cache entry. The outer optional is whether the cache
+  /// holds the key; the inner one is the cached Get result (nullopt when the
+  /// key is known to be absent from the store).
+  std::optional<std::optional<std::string>> TryGetFromCache(const std::string &ns,
+                                                            const std::string &key)
+      ABSL_LOCKS_EXCLUDED(cache_mutex_);
+
+  /// Record a Get/MultiGet result. `value` being nullopt caches the key as
+  /// absent, so repeat misses don't hit the GCS either.
+  void PopulateCache(const std::string &ns,
+                     const std::string &key,
+                     std::optional<std::string> value)
+      ABSL_LOCKS_EXCLUDED(cache_mutex_);
+
+  /// Drop the cached entry for `key` (or all keys with the prefix `key`
+  /// when by_prefix is set) in `ns`.
+  void InvalidateCacheEntry(const std::string &ns,
+                            const std::string &key,
+                            bool by_prefix) ABSL_LOCKS_EXCLUDED(cache_mutex_);
+
   GcsClient *client_impl_;
+
+  /// A cached Get result and the time it stops being served.
+  struct CacheEntry {
+    std::optional<std::string> value;
+    int64_t expires_at_ms;
+  };
+  mutable absl::Mutex cache_mutex_;
+  /// Local read-through cache of internal KV entries, keyed by (namespace,
+  /// key). Only populated when gcs_internal_kv_cache_enabled is set.
+  absl::flat_hash_map<std::pair<std::string, std::string>, CacheEntry> cache_
+      ABSL_GUARDED_BY(cache_mutex_);
+
+  SubscribeOperation subscribe_operation_;
 };
 
 class RuntimeEnvAccessor {
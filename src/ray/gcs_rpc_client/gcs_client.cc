@@ -147,7 +147,8 @@ Status GcsClient::Connect(instrumented_io_context &io_service, int64_t timeout_m
             rpc::ChannelType::GCS_JOB_CHANNEL,
             rpc::ChannelType::GCS_NODE_INFO_CHANNEL,
             rpc::ChannelType::GCS_NODE_ADDRESS_AND_LIVENESS_CHANNEL,
-            rpc::ChannelType::GCS_WORKER_DELTA_CHANNEL},
+            rpc::ChannelType::GCS_WORKER_DELTA_CHANNEL,
+            rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL},
         /*max_command_batch_size*/ RayConfig::instance().max_command_batch_size(),
         /*get_client=*/
         [gcs_rpc_client](const rpc::Address &) {
@@ -174,12 +175,19 @@ Status GcsClient::Connect(instrumented_io_context &io_service, int64_t timeout_m
   autoscaler_state_accessor_ = std::make_unique<AutoscalerStateAccessor>(this);
   publisher_accessor_ = std::make_unique<PublisherAccessor>(this);
 
+  if (RayConfig::instance().gcs_internal_kv_cache_enabled()) {
+    // Keep the local KV cache coherent by dropping entries whose key the GCS
+    // reports as written or deleted.
+    internal_kv_accessor_->AsyncSubscribeToKVUpdates();
+  }
+
   resubscribe_func_ = [this]() {
     RAY_LOG(INFO) << "Resubscribing to GCS tables.";
     job_accessor_->AsyncResubscribe();
     actor_accessor_->AsyncResubscribe();
     node_accessor_->AsyncResubscribe();
     worker_accessor_->AsyncResubscribe();
+    internal_kv_accessor_->AsyncResubscribe();
   };
 
   RAY_LOG(DEBUG) << "GcsClient connected "
@@ -267,6 +267,12 @@ class GcsRpcClient {
                              job_info_grpc_client_,
                              /*method_timeout_ms*/ -1, )
 
+  /// Get a paginated columnar snapshot of the job table from GCS Service.
+  VOID_GCS_RPC_CLIENT_METHOD(JobInfoGcsService,
+                             GetJobSnapshot,
+                             job_info_grpc_client_,
+                             /*method_timeout_ms*/ -1, )
+
   /// Report job error to GCS Service.
   VOID_GCS_RPC_CLIENT_METHOD(JobInfoGcsService,
                              ReportJobError,
@@ -15,6 +15,7 @@
 #include "ray/gcs_rpc_client/accessor.h"
 
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "src/ray/protobuf/gcs.pb.h"
 
 namespace ray {
@@ -85,6 +86,60 @@ TEST(NodeInfoAccessorTest, TestHandleNotificationDeathInfo) {
   ASSERT_EQ(cached_node->death_info().reason_message(), "Test termination reason");
 }
 
+TEST(InternalKVAccessorTest, TestCacheServesRepeatReads) {
+  RayConfig::instance().initialize(R"({"gcs_internal_kv_cache_enabled": true})");
+
+  // The accessor has no GCS connection, so any lookup reaching the RPC layer
+  // would crash; a successful Get proves the cache served it.
+  InternalKVAccessor accessor;
+  accessor.PopulateCache("ns", "present", "value");
+  accessor.PopulateCache("ns", "absent", std::nullopt);
+
+  bool called = false;
+  accessor.AsyncInternalKVGet(
+      "ns", "present", -1, [&](Status status, std::optional<std::string> &&value) {
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(*value, "value");
+        called = true;
+      });
+  ASSERT_TRUE(called);
+
+  // Negative entries are cached too, so repeat misses stay local.
+  called = false;
+  accessor.AsyncInternalKVGet(
+      "ns", "absent", -1, [&](Status status, std::optional<std::string> &&value) {
+        ASSERT_TRUE(status.ok());
+        ASSERT_FALSE(value.has_value());
+        called = true;
+      });
+  ASSERT_TRUE(called);
+
+  RayConfig::instance().initialize(R"({"gcs_internal_kv_cache_enabled": false})");
+}
+
+TEST(InternalKVAccessorTest, TestCacheInvalidation) {
+  RayConfig::instance().initialize(R"({"gcs_internal_kv_cache_enabled": true})");
+
+  InternalKVAccessor accessor;
+  accessor.PopulateCache("ns", "a_1", "1");
+  accessor.PopulateCache("ns", "a_2", "2");
+  accessor.PopulateCache("ns", "b", "3");
+  accessor.PopulateCache("other", "a_1", "4");
+
+  // A published update drops exactly the changed key.
+  accessor.InvalidateCacheEntry("ns", "b", /*by_prefix=*/false);
+  ASSERT_FALSE(accessor.TryGetFromCache("ns", "b").has_value());
+  ASSERT_TRUE(accessor.TryGetFromCache("ns", "a_1").has_value());
+
+  // A prefix deletion drops every key with the prefix, in that namespace only.
+  accessor.InvalidateCacheEntry("ns", "a_", /*by_prefix=*/true);
+  ASSERT_FALSE(accessor.TryGetFromCache("ns", "a_1").has_value());
+  ASSERT_FALSE(accessor.TryGetFromCache("ns", "a_2").has_value());
+  ASSERT_TRUE(accessor.TryGetFromCache("other", "a_1").has_value());
+
+  RayConfig::instance().initialize(R"({"gcs_internal_kv_cache_enabled": false})");
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
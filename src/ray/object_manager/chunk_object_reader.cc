@@ -66,4 +66,25 @@ std::optional<std::string> ChunkObjectReader::GetChunk(uint64_t chunk_index) con
   }
   return result;
 }
+
+std::optional<std::string_view> ChunkObjectReader::GetChunkView(
+    uint64_t chunk_index) const {
+  const auto cur_chunk_offset = chunk_index * chunk_size_;
+  const auto cur_chunk_size =
+      std::min(chunk_size_,
+               object_->GetDataSize() + object_->GetMetadataSize() - cur_chunk_offset);
+
+  if (cur_chunk_offset + cur_chunk_size <= object_->GetDataSize()) {
+    // The chunk lies entirely in the data section.
+    return object_->GetDataSectionView(cur_chunk_offset, cur_chunk_size);
+  }
+  if (cur_chunk_offset >= object_->GetDataSize()) {
+    // The chunk lies entirely in the metadata section.
+    return object_->GetMetadataSectionView(cur_chunk_offset - object_->GetDataSize(),
+                                           cur_chunk_size);
+  }
+  // The chunk spans both sections, which are not contiguous in the view order
+  // (data before metadata); it has to be assembled by GetChunk.
+  return std::nullopt;
+}
 };  // namespace ray
@@ -39,8 +39,20 @@ class ChunkObjectReader {
   ///                    equal to GetNumChunks() yields undefined behavior.
   std::optional<std::string> GetChunk(uint64_t chunk_index) const;
 
+  /// Return a borrowed view over the chunk bytes without copying, or an empty
+  /// optional if the underlying reader cannot expose views or the chunk spans
+  /// the data/metadata section boundary (chunks are data-then-metadata while
+  /// readers expose the sections separately). Callers fall back to GetChunk.
+  /// The view stays valid for the lifetime of this reader.
+  ///
+  /// \param chunk_index the index of chunk to return. index greater or
+  ///                    equal to GetNumChunks() yields undefined behavior.
+  std::optional<std::string_view> GetChunkView(uint64_t chunk_index) const;
+
   const IObjectReader &GetObject() const { return *object_; }
 
+  uint64_t GetChunkSize() const { return chunk_size_; }
+
  private:
   const std::shared_ptr<IObjectReader> object_;
   const uint64_t chunk_size_;
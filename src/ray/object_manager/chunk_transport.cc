@@ -0,0 +1,95 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/chunk_transport.h"
+
+#include <grpcpp/support/slice.h>
+
+#include <string>
+#include <utility>
+
+#include "ray/common/ray_config.h"
+#include "src/ray/protobuf/object_manager.pb.h"
+
+namespace ray {
+
+namespace {
+
+/// Fill the Push fields shared by the copying and zero-copy paths.
+void ToPushHeader(const ChunkSendRequest &request, rpc::PushRequest *push_request) {
+  push_request->set_push_id(request.push_id.Binary());
+  push_request->set_object_id(request.object_id.Binary());
+  push_request->mutable_owner_address()->CopyFrom(request.owner_address);
+  push_request->set_node_id(request.from_node_id.Binary());
+  push_request->set_data_size(request.data_size);
+  push_request->set_metadata_size(request.metadata_size);
+  push_request->set_chunk_index(request.chunk_index);
+  push_request->set_chunk_size(request.chunk_size);
+  if (request.chunk_crc32c.has_value()) {
+    push_request->set_chunk_crc32c(*request.chunk_crc32c);
+  }
+  push_request->set_uncompressed_size(request.uncompressed_size);
+}
+
+/// Wrap a borrowed payload in a gRPC slice that references the chunk memory
+/// directly and keeps the payload's owner alive until gRPC releases it.
+grpc::Slice ToExternalSlice(ChunkPayload payload) {
+  auto *owner = new std::shared_ptr<const void>(std::move(payload.owner));
+  return grpc::Slice(
+      const_cast<char *>(payload.view.data()),
+      payload.view.size(),
+      [](void *user_data) {
+        delete static_cast<std::shared_ptr<const void> *>(user_data);
+      },
+      owner);
+}
+
+}  // namespace
+
+ChunkTransportInterface::SendChunkFn GrpcChunkTransport::MakeChunkSender(
+    const NodeID &node_id) {
+  auto rpc_client = get_rpc_client_(node_id);
+  if (rpc_client == nullptr) {
+    return nullptr;
+  }
+  return [rpc_client = std::move(rpc_client)](
+             const ChunkSendRequest &request,
+             ChunkPayload payload,
+             std::function<void(const Status &)> on_complete) {
+    auto callback = [on_complete = std::move(on_complete)](
+                        const Status &status, const rpc::PushReply &reply) {
+      on_complete(status);
+    };
+    if (RayConfig::instance().object_manager_grpc_zero_copy_push() &&
+        payload.owner != nullptr) {
+      // Hand the borrowed chunk bytes to gRPC without copying them into a
+      // protobuf message; the slice keeps the chunk alive until sent.
+      rpc::ZeroCopyPushRequest push_request;
+      ToPushHeader(request, &push_request.header);
+      push_request.payload = ToExternalSlice(std::move(payload));
+      rpc_client->PushZeroCopy(push_request, std::move(callback));
+      return;
+    }
+    rpc::PushRequest push_request;
+    ToPushHeader(request, &push_request);
+    if (payload.owner != nullptr) {
+      push_request.set_data(payload.view.data(), payload.view.size());
+    } else {
+      push_request.set_data(std::move(payload.owned));
+    }
+    rpc_client->Push(push_request, std::move(callback));
+  };
+}
+
+}  // namespace ray
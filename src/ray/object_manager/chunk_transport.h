@@ -0,0 +1,134 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "ray/common/id.h"
+#include "ray/common/status.h"
+#include "ray/object_manager_rpc_client/object_manager_client_interface.h"
+#include "src/ray/protobuf/common.pb.h"
+
+namespace ray {
+
+/// Transport-neutral description of one object chunk being sent to a remote
+/// object manager. The payload travels separately so transports can move it
+/// without copying it into a protobuf.
+struct ChunkSendRequest {
+  /// Unique id of the push this chunk belongs to.
+  UniqueID push_id;
+  /// The object the chunk belongs to.
+  ObjectID object_id;
+  /// The node id of the sender.
+  NodeID from_node_id;
+  /// The owner of the object.
+  rpc::Address owner_address;
+  /// Total size of the object's data, in bytes.
+  uint64_t data_size;
+  /// Size of the object's metadata, in bytes.
+  uint64_t metadata_size;
+  /// Index of the chunk within the object.
+  uint64_t chunk_index;
+  /// Chunk size used to compute the chunk layout of this transfer.
+  uint64_t chunk_size;
+  /// CRC32C of the chunk bytes as they travel on the wire, set when chunk
+  /// integrity checks are enabled.
+  std::optional<uint32_t> chunk_crc32c;
+  /// When non-zero, the payload is deflate-compressed and this is the
+  /// original chunk length. Zero means the payload is sent as-is.
+  uint64_t uncompressed_size = 0;
+};
+
+/// The bytes of one chunk being sent. Either owned, or borrowed from the
+/// buffer backing the object (e.g. plasma memory or an mmap of the spill
+/// file), in which case `owner` keeps the bytes alive for as long as any
+/// copy of the payload exists. Transports that can hand borrowed bytes to
+/// the wire directly avoid copying them.
+struct ChunkPayload {
+  /// The chunk bytes when the payload is owned; unused otherwise.
+  std::string owned;
+  /// A borrowed view of the chunk bytes; only valid when `owner` is set.
+  std::string_view view;
+  /// Keeps the borrowed view alive. Null for owned payloads.
+  std::shared_ptr<const void> owner;
+
+  static ChunkPayload FromOwned(std::string data) {
+    ChunkPayload payload;
+    payload.owned = std::move(data);
+    return payload;
+  }
+
+  static ChunkPayload FromBorrowed(std::string_view view,
+                                   std::shared_ptr<const void> owner) {
+    ChunkPayload payload;
+    payload.view = view;
+    payload.owner = std::move(owner);
+    return payload;
+  }
+
+  /// The chunk bytes, regardless of ownership.
+  std::string_view bytes() const { return owner ? view : std::string_view(owned); }
+};
+
+/// A pluggable transport for moving object chunks between object managers.
+///
+/// The object manager consults its transports in registration order for each
+/// push and uses the first one that can reach the destination, so specialized
+/// backends (e.g. an RDMA transport reading chunk data out of registered
+/// plasma memory) fall back to the gRPC transport automatically whenever they
+/// cannot serve a node.
+class ChunkTransportInterface {
+ public:
+  /// A function that sends one chunk to the destination the function was
+  /// created for. May be invoked from the rpc event loop so that the data
+  /// copy happens off the main thread. The callback is invoked with the send
+  /// status once the remote side has acknowledged the chunk.
+  using SendChunkFn = std::function<void(const ChunkSendRequest &request,
+                                         ChunkPayload payload,
+                                         std::function<void(const Status &)>)>;
+
+  virtual ~ChunkTransportInterface() = default;
+
+  /// Return a send function bound to the given destination node, or nullptr
+  /// if this transport cannot currently reach the node. Called on the main
+  /// event loop once per push; the returned function outlives the call and is
+  /// shared by all chunks of the push.
+  virtual SendChunkFn MakeChunkSender(const NodeID &node_id) = 0;
+};
+
+/// The default chunk transport. Sends each chunk as a gRPC Push message to
+/// the remote object manager.
+class GrpcChunkTransport : public ChunkTransportInterface {
+ public:
+  explicit GrpcChunkTransport(
+      std::function<std::shared_ptr<rpc::ObjectManagerClientInterface>(const NodeID &)>
+          get_rpc_client)
+      : get_rpc_client_(std::move(get_rpc_client)) {}
+
+  SendChunkFn MakeChunkSender(const NodeID &node_id) override;
+
+ private:
+  /// A callback to get or create the rpc client for a remote object manager.
+  /// Returns nullptr if the node is not alive. Must be called on the main
+  /// event loop.
+  std::function<std::shared_ptr<rpc::ObjectManagerClientInterface>(const NodeID &)>
+      get_rpc_client_;
+};
+
+}  // namespace ray
@@ -44,6 +44,14 @@ void PlasmaObjectHeader::Init() {
   num_read_releases_remaining = 0;
   data_size = 0;
   metadata_size = 0;
+  num_ring_slots = 0;
+  for (int64_t i = 0; i < kMaxRingSlots; i++) {
+    ring_slot_num_reading[i] = 0;
+    ring_slot_data_size[i] = 0;
+    ring_slot_metadata_size[i] = 0;
+  }
+  ring_pending_data_size = 0;
+  ring_pending_metadata_size = 0;
 }
 
 void PrintPlasmaObjectHeader(const PlasmaObjectHeader *header) {
@@ -64,6 +72,7 @@ void PrintPlasmaObjectHeader(const PlasmaObjectHeader *header) {
       &print, "num_read_releases_remaining: ", header->num_read_releases_remaining, "\n");
   absl::StrAppend(&print, "data_size: ", header->data_size, "\n");
   absl::StrAppend(&print, "metadata_size: ", header->metadata_size, "\n");
+  absl::StrAppend(&print, "num_ring_slots: ", header->num_ring_slots, "\n");
   RAY_LOG(DEBUG) << print;
 }
 
@@ -179,6 +188,144 @@ Status PlasmaObjectHeader::WriteRelease(Semaphores &sem) {
   return Status::OK();
 }
 
+Status PlasmaObjectHeader::WriteAcquireRing(
+    Semaphores &sem,
+    uint64_t write_data_size,
+    uint64_t write_metadata_size,
+    int64_t ring_slots,
+    int64_t &slot_index,
+    const std::optional<std::chrono::steady_clock::time_point> &timeout_point) {
+  RAY_CHECK(sem.object_sem);
+  RAY_CHECK(sem.header_sem);
+  RAY_CHECK_GT(ring_slots, 1);
+  RAY_CHECK_LE(ring_slots, kMaxRingSlots);
+
+  // In ring mode `object_sem` only serializes writers; readers never hold it.
+  RAY_RETURN_NOT_OK(TryToAcquireSemaphore(sem.object_sem, timeout_point));
+  RAY_RETURN_NOT_OK(TryToAcquireSemaphore(sem.header_sem));
+
+  if (num_ring_slots == 0) {
+    // The first write fixes the slot count of the channel. Versions written
+    // before the slot count is known could not be assigned to slots.
+    RAY_CHECK_EQ(version, 0) << "Cannot switch an open channel to ring mode";
+    num_ring_slots = ring_slots;
+  }
+  RAY_CHECK_EQ(num_ring_slots, ring_slots)
+      << "The ring slot count of a channel cannot change";
+
+  // The next version goes into the slot after the latest sealed one. Wait
+  // until no reader is still inside that slot, i.e. until the oldest buffered
+  // version is unreferenced.
+  slot_index = version % num_ring_slots;
+  while (ring_slot_num_reading[slot_index] > 0) {
+    RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+    sched_yield();
+    if (timeout_point && std::chrono::steady_clock::now() >= *timeout_point) {
+      RAY_CHECK_EQ(sem_post(sem.object_sem), 0);
+      return Status::ChannelTimeoutError(
+          "Timed out waiting for a reader to release the oldest ring slot.");
+    }
+    Status s = TryToAcquireSemaphore(sem.header_sem, timeout_point);
+    if (!s.ok()) {
+      if (s.IsChannelTimeoutError()) {
+        RAY_CHECK_EQ(sem_post(sem.object_sem), 0);
+      }
+      return s;
+    }
+  }
+
+  ring_pending_data_size = write_data_size;
+  ring_pending_metadata_size = write_metadata_size;
+
+  RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+  return Status::OK();
+}
+
+Status PlasmaObjectHeader::WriteReleaseRing(Semaphores &sem) {
+  // Header is locked only for a short time, so we don't have to apply a
+  // timeout.
+  RAY_RETURN_NOT_OK(TryToAcquireSemaphore(sem.header_sem));
+
+  RAY_CHECK_GT(num_ring_slots, 1);
+  version++;
+  is_sealed = true;
+  const int64_t slot_index = (version - 1) % num_ring_slots;
+  ring_slot_data_size[slot_index] = ring_pending_data_size;
+  ring_slot_metadata_size[slot_index] = ring_pending_metadata_size;
+  // Keep the latest sizes here as well, matching the default mode.
+  data_size = ring_pending_data_size;
+  metadata_size = ring_pending_metadata_size;
+
+  RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+  // Let the next writer in.
+  RAY_CHECK_EQ(sem_post(sem.object_sem), 0);
+  return Status::OK();
+}
+
+Status PlasmaObjectHeader::ReadAcquireRing(
+    Semaphores &sem,
+    int64_t version_to_read,
+    int64_t &version_read,
+    int64_t &slot_index,
+    uint64_t &slot_data_size,
+    uint64_t &slot_metadata_size,
+    const std::function<Status()> &check_signals,
+    const std::optional<std::chrono::steady_clock::time_point> &timeout_point) {
+  RAY_CHECK(sem.header_sem);
+
+  // Header is locked only for a short time, so we don't have to apply the
+  // same `timeout_point`.
+  RAY_RETURN_NOT_OK(TryToAcquireSemaphore(sem.header_sem));
+
+  // Wait for a sealed version at least as new as the requested one.
+  const auto check_signal_interval = std::chrono::milliseconds(
+      RayConfig::instance().get_check_signal_interval_milliseconds());
+  auto last_signal_check_time = std::chrono::steady_clock::now();
+  while (version < version_to_read || !is_sealed) {
+    if (check_signals && std::chrono::steady_clock::now() - last_signal_check_time >
+                             check_signal_interval) {
+      RAY_RETURN_NOT_OK(check_signals());
+      last_signal_check_time = std::chrono::steady_clock::now();
+    }
+    RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+    sched_yield();
+    if (timeout_point && std::chrono::steady_clock::now() >= *timeout_point) {
+      return Status::ChannelTimeoutError(
+          "Timed out waiting for object available to read.");
+    }
+    RAY_RETURN_NOT_OK(
+        TryToAcquireSemaphore(sem.header_sem, timeout_point, check_signals));
+  }
+
+  // The writer sets the slot count before sealing the first version, so it is
+  // known by now.
+  RAY_CHECK_GT(num_ring_slots, 1) << "The writer of the channel is not in ring mode";
+  // Always read the latest sealed version; a reader that fell behind skips
+  // the missed versions. Reads per version are not counted in ring mode.
+  version_read = version;
+  slot_index = (version - 1) % num_ring_slots;
+  ring_slot_num_reading[slot_index]++;
+  slot_data_size = ring_slot_data_size[slot_index];
+  slot_metadata_size = ring_slot_metadata_size[slot_index];
+
+  RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+  return Status::OK();
+}
+
+Status PlasmaObjectHeader::ReadReleaseRing(Semaphores &sem, int64_t read_version) {
+  RAY_CHECK(sem.header_sem);
+
+  RAY_RETURN_NOT_OK(TryToAcquireSemaphore(sem.header_sem));
+
+  RAY_CHECK_GT(num_ring_slots, 1);
+  const int64_t slot_index = (read_version - 1) % num_ring_slots;
+  RAY_CHECK_GT(ring_slot_num_reading[slot_index], 0UL);
+  ring_slot_num_reading[slot_index]--;
+
+  RAY_CHECK_EQ(sem_post(sem.header_sem), 0);
+  return Status::OK();
+}
+
 Status PlasmaObjectHeader::ReadAcquire(
     const ObjectID &object_id,
     Semaphores &sem,
@@ -289,6 +436,36 @@ Status PlasmaObjectHeader::WriteRelease(Semaphores &sem) {
   return Status::NotImplemented("Not supported on Windows.");
 }
 
+Status PlasmaObjectHeader::WriteAcquireRing(
+    Semaphores &sem,
+    uint64_t write_data_size,
+    uint64_t write_metadata_size,
+    int64_t ring_slots,
+    int64_t &slot_index,
+    const std::optional<std::chrono::steady_clock::time_point> &timeout_point) {
+  return Status::NotImplemented("Not supported on Windows.");
+}
+
+Status PlasmaObjectHeader::WriteReleaseRing(Semaphores &sem) {
+  return Status::NotImplemented("Not supported on Windows.");
+}
+
+Status PlasmaObjectHeader::ReadAcquireRing(
+    Semaphores &sem,
+    int64_t version_to_read,
+    int64_t &version_read,
+    int64_t &slot_index,
+    uint64_t &slot_data_size,
+    uint64_t &slot_metadata_size,
+    const std::function<Status()> &check_signals,
+    const std::optional<std::chrono::steady_clock::time_point> &timeout_point) {
+  return Status::NotImplemented("Not supported on Windows.");
+}
+
+Status PlasmaObjectHeader::ReadReleaseRing(Semaphores &sem, int64_t read_version) {
+  return Status::NotImplemented("Not supported on Windows.");
+}
+
 Status PlasmaObjectHeader::ReadAcquire(
     const ObjectID &object_id,
     Semaphores &sem,
@@ -123,6 +123,27 @@ struct PlasmaObjectHeader {
   uint64_t data_size = 0;
   uint64_t metadata_size = 0;
 
+  /// The maximum number of version slots a ring channel's buffer may be
+  /// divided into.
+  static constexpr int64_t kMaxRingSlots = 8;
+
+  // The number of equally sized version slots the object buffer is divided
+  // into when the channel is in ring mode, or 0 for the default mode where
+  // each write blocks until all readers of the previous version release it.
+  // Set by the writer on its first WriteAcquireRing() and constant afterwards.
+  int64_t num_ring_slots = 0;
+  // The number of readers currently between ReadAcquireRing() and
+  // ReadReleaseRing() for each slot. The writer may only reuse a slot once
+  // its count reaches zero.
+  uint64_t ring_slot_num_reading[kMaxRingSlots] = {};
+  // The valid data and metadata sizes of the sealed version in each slot.
+  uint64_t ring_slot_data_size[kMaxRingSlots] = {};
+  uint64_t ring_slot_metadata_size[kMaxRingSlots] = {};
+  // The sizes passed to WriteAcquireRing() for the version currently being
+  // written. WriteReleaseRing() copies them into the slot arrays.
+  uint64_t ring_pending_data_size = 0;
+  uint64_t ring_pending_metadata_size = 0;
+
   /// Blocks until all readers for the previous write have ReadRelease'd the
   /// value. Protects against concurrent writers.
   ///
@@ -149,6 +170,37 @@ struct PlasmaObjectHeader {
   /// \param sem The semaphores for this channel.
   Status WriteRelease(Semaphores &sem);
 
+  /// Ring mode variant of WriteAcquire(). The object buffer is divided into
+  /// `ring_slots` equal slots and the new version is written into the slot
+  /// after the latest sealed one, while readers keep reading the slots of
+  /// older versions. This only blocks while a reader is still inside the slot
+  /// being reused, i.e. a reader that is `ring_slots` versions behind and has
+  /// not released yet.
+  ///
+  /// \param sem The semaphores for this channel.
+  /// \param data_size The data size of the new version.
+  /// \param metadata_size The metadata size of the new version.
+  /// \param ring_slots The number of slots the buffer is divided into. The
+  /// first call fixes the slot count of the channel; later calls must pass
+  /// the same value.
+  /// \param[out] slot_index The slot the new version must be written into.
+  /// \param timeout_point The time point when to timeout, as in
+  /// WriteAcquire().
+  /// \return The return status.
+  Status WriteAcquireRing(Semaphores &sem,
+                          uint64_t data_size,
+                          uint64_t metadata_size,
+                          int64_t ring_slots,
+                          int64_t &slot_index,
+                          const std::optional<std::chrono::steady_clock::time_point>
+                              &timeout_point = std::nullopt);
+
+  /// Seals the version written after WriteAcquireRing(), making it the latest
+  /// version readers acquire.
+  ///
+  /// \param sem The semaphores for this channel.
+  Status WriteReleaseRing(Semaphores &sem);
+
   /// Blocks until the given version is ready to read. Returns false if the
   /// maximum number of readers have already read the requested version.
   ///
@@ -180,6 +232,38 @@ struct PlasmaObjectHeader {
   /// ReadAcquire.
   Status ReadRelease(Semaphores &sem, int64_t read_version);
 
+  /// Ring mode variant of ReadAcquire(). Blocks until a sealed version at
+  /// least as new as `version_to_read` is available, then acquires the latest
+  /// sealed version; a reader that fell behind skips the missed versions. The
+  /// number of reads per version is not counted in ring mode.
+  ///
+  /// \param[in] sem The semaphores for this channel.
+  /// \param[in] version_to_read The minimum version to read.
+  /// \param[out] version_read The version that was acquired.
+  /// \param[out] slot_index The slot holding the acquired version.
+  /// \param[out] slot_data_size The data size of the acquired version.
+  /// \param[out] slot_metadata_size The metadata size of the acquired version.
+  /// \param[in] check_signals As in ReadAcquire().
+  /// \param[in] timeout_point As in ReadAcquire().
+  /// \return The return status.
+  Status ReadAcquireRing(Semaphores &sem,
+                         int64_t version_to_read,
+                         int64_t &version_read,
+                         int64_t &slot_index,
+                         uint64_t &slot_data_size,
+                         uint64_t &slot_metadata_size,
+                         const std::function<Status()> &check_signals,
+                         const std::optional<std::chrono::steady_clock::time_point>
+                             &timeout_point = std::nullopt);
+
+  /// Finishes a ring mode read, allowing the writer to reuse the slot of the
+  /// read version.
+  ///
+  /// \param sem The semaphores for this channel.
+  /// \param read_version This must match the version previously returned by
+  /// ReadAcquireRing().
+  Status ReadReleaseRing(Semaphores &sem, int64_t read_version);
+
   /// Set up synchronization primitives.
   void Init();
 
@@ -52,4 +52,22 @@ bool MemoryObjectReader::ReadFromMetadataSection(uint64_t offset,
   return true;
 }
 
+std::optional<std::string_view> MemoryObjectReader::GetDataSectionView(
+    uint64_t offset, uint64_t size) const {
+  if (offset + size > GetDataSize()) {
+    return std::nullopt;
+  }
+  return std::string_view(
+      reinterpret_cast<const char *>(object_buffer_.data->Data() + offset), size);
+}
+
+std::optional<std::string_view> MemoryObjectReader::GetMetadataSectionView(
+    uint64_t offset, uint64_t size) const {
+  if (offset + size > GetMetadataSize()) {
+    return std::nullopt;
+  }
+  return std::string_view(
+      reinterpret_cast<const char *>(object_buffer_.metadata->Data() + offset), size);
+}
+
 }  // namespace ray
@@ -40,6 +40,11 @@ class MemoryObjectReader : public IObjectReader {
                                uint64_t size,
                                std::string &output) const override;
 
+  std::optional<std::string_view> GetDataSectionView(uint64_t offset,
+                                                     uint64_t size) const override;
+  std::optional<std::string_view> GetMetadataSectionView(uint64_t offset,
+                                                         uint64_t size) const override;
+
  private:
   const plasma::ObjectBuffer object_buffer_;
   const rpc::Address owner_address_;
@@ -91,11 +91,32 @@ inline ray::stats::Gauge GetObjectManagerReceivedChunksGaugeMetric() {
       /*name=*/"object_manager_received_chunks",
       /*description=*/
       "Number object chunks received broken per type {Total, FailedTotal, "
-      "FailedCancelled, FailedPlasmaFull}.",
+      "FailedCancelled, FailedPlasmaFull, FailedIntegrity, "
+      "FailedDecompression}.",
       /*unit=*/"chunks",
       /*tag_keys=*/{"Type"});
 }
 
+inline ray::stats::Gauge GetObjectManagerCompressionBytesGaugeMetric() {
+  return ray::stats::Gauge(
+      /*name=*/"object_manager_compression_bytes",
+      /*description=*/
+      "Bytes of pushed chunks that were sent compressed, before (Raw) and "
+      "after (Wire) compression. The quotient of the two is the achieved "
+      "compression ratio.",
+      /*unit=*/"bytes",
+      /*tag_keys=*/{"Type"});
+}
+
+inline ray::stats::Gauge GetObjectManagerCompressionCpuSecondsGaugeMetric() {
+  return ray::stats::Gauge(
+      /*name=*/"object_manager_compression_cpu_seconds",
+      /*description=*/
+      "Cumulative CPU time spent compressing pushed chunks and decompressing "
+      "received ones.",
+      /*unit=*/"seconds");
+}
+
 inline ray::stats::Gauge GetPullManagerUsageBytesGaugeMetric() {
   return ray::stats::Gauge(
       /*name=*/"pull_manager_usage_bytes",
@@ -62,15 +62,21 @@ ObjectBufferPool::~ObjectBufferPool() {
   store_client_->Disconnect();
 }
 
-uint64_t ObjectBufferPool::GetNumChunks(uint64_t data_size) const {
-  return (data_size + default_chunk_size_ - 1) / default_chunk_size_;
+uint64_t ObjectBufferPool::GetNumChunks(uint64_t data_size, uint64_t chunk_size) const {
+  if (chunk_size == 0) {
+    chunk_size = default_chunk_size_;
+  }
+  return (data_size + chunk_size - 1) / chunk_size;
 }
 
 uint64_t ObjectBufferPool::GetBufferLength(uint64_t chunk_index,
-                                           uint64_t data_size) const {
-  return (chunk_index + 1) * default_chunk_size_ > data_size
-             ? data_size % default_chunk_size_
-             : default_chunk_size_;
+                                           uint64_t data_size,
+                                           uint64_t chunk_size) const {
+  if (chunk_size == 0) {
+    chunk_size = default_chunk_size_;
+  }
+  return (chunk_index + 1) * chunk_size > data_size ? data_size % chunk_size
+                                                    : chunk_size;
 }
 
 std::pair<std::shared_ptr<MemoryObjectReader>, Status>
@@ -101,10 +107,14 @@ Status ObjectBufferPool::CreateChunk(const ObjectID &object_id,
                                      const rpc::Address &owner_address,
                                      uint64_t data_size,
                                      uint64_t metadata_size,
-                                     uint64_t chunk_index) {
+                                     uint64_t chunk_index,
+                                     uint64_t chunk_size) {
   absl::MutexLock lock(&pool_mutex_);
+  if (chunk_size == 0) {
+    chunk_size = default_chunk_size_;
+  }
   RAY_RETURN_NOT_OK(EnsureBufferExists(
-      object_id, owner_address, data_size, metadata_size, chunk_index));
+      object_id, owner_address, data_size, metadata_size, chunk_index, chunk_size));
   auto &state = create_buffer_state_.at(object_id);
   if (chunk_index >= state.chunk_state_.size()) {
     return Status::IOError("Object size mismatch");
@@ -203,19 +213,19 @@ std::vector<ObjectBufferPool::ChunkInfo> ObjectBufferPool::BuildChunks(
     const ObjectID &object_id,
     uint8_t *data,
     uint64_t data_size,
+    uint64_t chunk_size,
     std::shared_ptr<Buffer> buffer_ref) {
   uint64_t space_remaining = data_size;
   std::vector<ChunkInfo> chunks;
   int64_t position = 0;
   while (space_remaining > 0) {
     position = data_size - space_remaining;
-    if (space_remaining < default_chunk_size_) {
+    if (space_remaining < chunk_size) {
       chunks.emplace_back(chunks.size(), data + position, space_remaining, buffer_ref);
       space_remaining = 0;
     } else {
-      chunks.emplace_back(
-          chunks.size(), data + position, default_chunk_size_, buffer_ref);
-      space_remaining -= default_chunk_size_;
+      chunks.emplace_back(chunks.size(), data + position, chunk_size, buffer_ref);
+      space_remaining -= chunk_size;
     }
   }
   return chunks;
@@ -225,13 +235,16 @@ Status ObjectBufferPool::EnsureBufferExists(const ObjectID &object_id,
                                             const rpc::Address &owner_address,
                                             uint64_t data_size,
                                             uint64_t metadata_size,
-                                            uint64_t chunk_index) {
+                                            uint64_t chunk_index,
+                                            uint64_t chunk_size) {
   while (true) {
-    // Buffer for object_id already exists and the size matches ours.
+    // Buffer for object_id already exists and the size and chunk layout match
+    // ours.
     {
       auto it = create_buffer_state_.find(object_id);
       if (it != create_buffer_state_.end() && it->second.data_size_ == data_size &&
-          it->second.metadata_size_ == metadata_size) {
+          it->second.metadata_size_ == metadata_size &&
+          it->second.chunk_size_ == chunk_size) {
         return Status::OK();
       }
     }
@@ -259,12 +272,15 @@ Status ObjectBufferPool::EnsureBufferExists(const ObjectID &object_id,
     auto it = create_buffer_state_.find(object_id);
     if (it != create_buffer_state_.end()) {
       RAY_CHECK(it->second.data_size_ != data_size ||
-                it->second.metadata_size_ != metadata_size);
+                it->second.metadata_size_ != metadata_size ||
+                it->second.chunk_size_ != chunk_size);
       RAY_LOG(WARNING) << "Object " << object_id << " size (" << data_size
-                       << ") differs from the original (" << it->second.data_size_
+                       << ") or chunk size (" << chunk_size
+                       << ") differs from the original (" << it->second.data_size_ << "/"
+                       << it->second.chunk_size_
                        << "). This is likely due to re-execution of a task with a "
-                          "nondeterministic output. Recreating object with size "
-                       << data_size << ".";
+                          "nondeterministic output, or a sender with a different "
+                          "transfer chunk size. Recreating the object.";
       AbortCreateInternal(it->first);
     }
   }
@@ -310,13 +326,15 @@ Status ObjectBufferPool::EnsureBufferExists(const ObjectID &object_id,
 
   // Read object into store.
   uint8_t *mutable_data = data->Data();
-  uint64_t num_chunks = GetNumChunks(data_size);
+  uint64_t num_chunks = GetNumChunks(data_size, chunk_size);
   auto inserted = create_buffer_state_.emplace(
       std::piecewise_construct,
       std::forward_as_tuple(object_id),
-      std::forward_as_tuple(metadata_size,
-                            data_size,
-                            BuildChunks(object_id, mutable_data, data_size, data)));
+      std::forward_as_tuple(
+          metadata_size,
+          data_size,
+          chunk_size,
+          BuildChunks(object_id, mutable_data, data_size, chunk_size, data)));
   RAY_CHECK(inserted.first->second.chunk_info_.size() == num_chunks);
   RAY_LOG(DEBUG) << "Created object " << object_id
                  << " in plasma store, number of chunks: " << num_chunks
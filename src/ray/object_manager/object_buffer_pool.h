@@ -69,15 +69,21 @@ class ObjectBufferPool {
   /// Computes the number of chunks needed to transfer an object and its metadata.
   ///
   /// \param data_size The size of the object + metadata.
+  /// \param chunk_size The chunk size of the transfer, or 0 to use the pool's
+  /// configured default.
   /// \return The number of chunks into which the object will be split.
-  uint64_t GetNumChunks(uint64_t data_size) const;
+  uint64_t GetNumChunks(uint64_t data_size, uint64_t chunk_size = 0) const;
 
   /// Computes the buffer length of a chunk of an object.
   ///
   /// \param chunk_index The chunk index for which to obtain the buffer length.
   /// \param data_size The size of the object + metadata.
+  /// \param chunk_size The chunk size of the transfer, or 0 to use the pool's
+  /// configured default.
   /// \return The buffer length of the chunk at chunk_index.
-  uint64_t GetBufferLength(uint64_t chunk_index, uint64_t data_size) const;
+  uint64_t GetBufferLength(uint64_t chunk_index,
+                           uint64_t data_size,
+                           uint64_t chunk_size = 0) const;
 
   /// Returns an object reader for read.
   ///
@@ -103,6 +109,11 @@ class ObjectBufferPool {
   /// \param data_size The sum of the object size and metadata size.
   /// \param metadata_size The size of the metadata.
   /// \param chunk_index The index of the chunk.
+  /// \param chunk_size The chunk size the sender used to split the transfer,
+  /// or 0 to use the pool's configured default. All chunks of one transfer
+  /// must use the same size; if a transfer with a different chunk size is in
+  /// progress, the buffer is recreated with the new layout, like a transfer
+  /// whose object size changed.
   /// \return status of invoking this method.
   /// An IOError status is returned if object creation on the store client fails,
   /// or if create is invoked consecutively on the same chunk
@@ -111,7 +122,8 @@ class ObjectBufferPool {
                      const rpc::Address &owner_address,
                      uint64_t data_size,
                      uint64_t metadata_size,
-                     uint64_t chunk_index) ABSL_LOCKS_EXCLUDED(pool_mutex_);
+                     uint64_t chunk_index,
+                     uint64_t chunk_size = 0) ABSL_LOCKS_EXCLUDED(pool_mutex_);
 
   /// Write to a Chunk of an object. If all chunks of an object is written,
   /// it seals the object.
@@ -150,6 +162,7 @@ class ObjectBufferPool {
   std::vector<ChunkInfo> BuildChunks(const ObjectID &object_id,
                                      uint8_t *data,
                                      uint64_t data_size,
+                                     uint64_t chunk_size,
                                      std::shared_ptr<Buffer> buffer_ref)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(pool_mutex_);
 
@@ -161,7 +174,8 @@ class ObjectBufferPool {
                             const rpc::Address &owner_address,
                             uint64_t data_size,
                             uint64_t metadata_size,
-                            uint64_t chunk_index)
+                            uint64_t chunk_index,
+                            uint64_t chunk_size)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(pool_mutex_);
 
   void AbortCreateInternal(const ObjectID &object_id)
@@ -174,9 +188,11 @@ class ObjectBufferPool {
   struct CreateBufferState {
     CreateBufferState(uint64_t metadata_size,
                       uint64_t data_size,
+                      uint64_t chunk_size,
                       std::vector<ChunkInfo> chunk_info)
         : metadata_size_(metadata_size),
           data_size_(data_size),
+          chunk_size_(chunk_size),
           chunk_info_(std::move(chunk_info)),
           chunk_state_(chunk_info_.size(), CreateChunkState::AVAILABLE),
           num_seals_remaining_(chunk_info_.size()) {}
@@ -184,6 +200,9 @@ class ObjectBufferPool {
     uint64_t metadata_size_;
     /// Total size of the object data.
     uint64_t data_size_;
+    /// The chunk size the buffer was split with. Chunks of a transfer using
+    /// a different size cannot be written into this buffer.
+    uint64_t chunk_size_;
     /// A vector maintaining information about the chunks which comprise
     /// an object.
     std::vector<ChunkInfo> chunk_info_;
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -37,6 +38,21 @@ using OnLocationsFound = std::function<void(const ray::ObjectID &object_id,
                                             bool pending_creation,
                                             size_t object_size)>;
 
+/// A snapshot of the directory's cached location information for an object.
+/// The fields match what OnLocationsFound callbacks receive.
+struct CachedObjectLocations {
+  /// The set of nodes that have a copy of the object in plasma.
+  std::unordered_set<NodeID> node_ids;
+  /// If spilled, the URL of the object's spill location.
+  std::string spilled_url;
+  /// If spilled to local storage, the ID of the node that spilled the object.
+  NodeID spilled_node_id;
+  /// Whether the object is still pending creation by its task.
+  bool pending_creation;
+  /// The size of the object in bytes. 0 if unknown.
+  size_t object_size;
+};
+
 class IObjectDirectory {
  public:
   virtual ~IObjectDirectory() {}
@@ -75,6 +91,29 @@ class IObjectDirectory {
   virtual void UnsubscribeObjectLocations(const UniqueID &callback_id,
                                           const ObjectID &object_id) = 0;
 
+  /// Get the cached locations of an object without subscribing to it. A value
+  /// is only returned if this node holds an active location subscription for
+  /// the object and has received at least one notification from the owner,
+  /// i.e. the entry is kept up to date by the owner's pubsub notifications.
+  ///
+  /// \param object_id The object to look up.
+  /// \return The cached locations, or std::nullopt on a cache miss.
+  virtual std::optional<CachedObjectLocations> GetCachedLocations(
+      const ObjectID &object_id) const = 0;
+
+  /// Handle an eager location hint pushed by an object's owner, ahead of the
+  /// owner's location pubsub. The hint only has an effect if this node holds an
+  /// active location subscription for the object that has not yet received its
+  /// first notification from the owner; otherwise the pubsub data is
+  /// authoritative and the hint is dropped.
+  ///
+  /// \param object_id The object the hint is about.
+  /// \param node_id The node the object is now available on.
+  /// \param object_size The size of the object in bytes, 0 if unknown.
+  virtual void HandleLocationHint(const ObjectID &object_id,
+                                  const NodeID &node_id,
+                                  size_t object_size) = 0;
+
   /// Report objects added to this node's store to the object directory.
   ///
   /// \param object_id The object id that was put into the store.
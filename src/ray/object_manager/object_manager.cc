@@ -14,15 +14,20 @@
 
 #include "ray/object_manager/object_manager.h"
 
+#include <zlib.h>
+
 #include <algorithm>
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "absl/crc/crc32c.h"
 #include "ray/common/asio/asio_util.h"
 #include "ray/object_manager/plasma/store_runner.h"
 #include "ray/object_manager/spilled_object_reader.h"
@@ -30,6 +35,41 @@
 
 namespace ray {
 
+namespace {
+
+/// Deflate-compress one chunk. Returns std::nullopt if compression fails.
+std::optional<std::string> DeflateChunk(std::string_view bytes, int level) {
+  uLongf compressed_size = compressBound(bytes.size());
+  std::string compressed(compressed_size, '\0');
+  if (compress2(reinterpret_cast<Bytef *>(compressed.data()),
+                &compressed_size,
+                reinterpret_cast<const Bytef *>(bytes.data()),
+                bytes.size(),
+                level) != Z_OK) {
+    return std::nullopt;
+  }
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+/// Inflate one chunk back to its original bytes. Returns std::nullopt if the
+/// data is corrupt or does not inflate to exactly uncompressed_size bytes.
+std::optional<std::string> InflateChunk(const std::string &data,
+                                        uint64_t uncompressed_size) {
+  uLongf inflated_size = uncompressed_size;
+  std::string inflated(inflated_size, '\0');
+  if (uncompress(reinterpret_cast<Bytef *>(inflated.data()),
+                 &inflated_size,
+                 reinterpret_cast<const Bytef *>(data.data()),
+                 data.size()) != Z_OK ||
+      inflated_size != uncompressed_size) {
+    return std::nullopt;
+  }
+  return inflated;
+}
+
+}  // namespace
+
 ObjectStoreRunner::ObjectStoreRunner(const ObjectManagerConfig &config,
                                      SpillObjectsCallback spill_objects_callback,
                                      std::function<void()> object_store_full_callback,
@@ -98,10 +138,14 @@ ObjectManager::ObjectManager(
       get_spilled_object_url_(std::move(get_spilled_object_url)),
       pull_retry_timer_(*main_service_,
                         boost::posix_time::milliseconds(config.timer_freq_ms)),
-      push_manager_(std::make_unique<PushManager>(/* max_chunks_in_flight= */ std::max(
-          static_cast<int64_t>(1L),
-          static_cast<int64_t>(config_.max_bytes_in_flight /
-                               config_.object_chunk_size)))),
+      push_manager_(std::make_unique<PushManager>(
+          /* max_chunks_in_flight= */ std::max(
+              static_cast<int64_t>(1L),
+              static_cast<int64_t>(config_.max_bytes_in_flight /
+                                   config_.object_chunk_size)),
+          RayConfig::instance().object_manager_max_chunks_in_flight_per_node(),
+          RayConfig::instance().object_manager_urgent_push_weight(),
+          RayConfig::instance().object_manager_adaptive_push_budget_enabled())),
       object_manager_client_factory_(std::move(object_manager_client_factory)) {
   RAY_CHECK_GT(config_.rpc_service_threads_number, 0);
 
@@ -110,8 +154,11 @@ ObjectManager::ObjectManager(
   auto object_is_local = [this](const ObjectID &object_id) {
     return local_objects_.count(object_id) != 0;
   };
-  auto send_pull_request = [this](const ObjectID &object_id, const NodeID &client_id) {
-    SendPullRequest(object_id, client_id);
+  auto send_pull_request = [this](const ObjectID &object_id,
+                                  const NodeID &client_id,
+                                  uint64_t chunk_index_start,
+                                  uint64_t chunk_index_end) {
+    SendPullRequest(object_id, client_id, chunk_index_start, chunk_index_end);
   };
   auto cancel_pull_request = [this](const ObjectID &object_id) {
     // We must abort this object because it may have only been partially
@@ -133,6 +180,11 @@ ObjectManager::ObjectManager(
                                                 std::move(pin_object),
                                                 get_spilled_object_url_);
 
+  // The gRPC transport is the universal fallback, so it must be registered
+  // last; specialized transports (e.g. RDMA) go in front of it.
+  chunk_transports_.emplace_back(std::make_unique<GrpcChunkTransport>(
+      [this](const NodeID &node_id) { return GetRpcClient(node_id); }));
+
   RAY_CHECK_OK(
       buffer_pool_store_client_->Connect(config_.store_socket_name.c_str(), "", 300));
 
@@ -186,11 +238,17 @@ void ObjectManager::HandleObjectAdded(const ObjectInfo &object_info) {
   if (iter != unfulfilled_push_requests_.end()) {
     for (auto &pair : iter->second) {
       auto &node_id = pair.first;
-      main_service_->post([this, object_id, node_id]() { Push(object_id, node_id); },
-                          "ObjectManager.ObjectAddedPush");
+      auto priority = pair.second.priority;
+      auto chunk_index_start = pair.second.chunk_index_start;
+      auto chunk_index_end = pair.second.chunk_index_end;
+      main_service_->post(
+          [this, object_id, node_id, priority, chunk_index_start, chunk_index_end]() {
+            Push(object_id, node_id, priority, chunk_index_start, chunk_index_end);
+          },
+          "ObjectManager.ObjectAddedPush");
       // When push timeout is set to -1, there will be an empty timer in pair.second.
-      if (pair.second != nullptr) {
-        pair.second->cancel();
+      if (pair.second.timer != nullptr) {
+        pair.second.timer->cancel();
       }
     }
     unfulfilled_push_requests_.erase(iter);
@@ -252,15 +310,29 @@ void ObjectManager::CancelPull(uint64_t request_id) {
   }
 }
 
-void ObjectManager::SendPullRequest(const ObjectID &object_id, const NodeID &client_id) {
+void ObjectManager::SendPullRequest(const ObjectID &object_id,
+                                    const NodeID &client_id,
+                                    uint64_t chunk_index_start,
+                                    uint64_t chunk_index_end) {
   auto rpc_client = GetRpcClient(client_id);
   if (rpc_client) {
+    // Urgency must be computed here since the pull manager is not thread-safe.
+    const bool urgent = pull_manager_->IsObjectUrgent(object_id);
     // Try pulling from the client.
     rpc_service_.post(
-        [this, object_id, client_id, rpc_client]() {
+        [this,
+         object_id,
+         client_id,
+         rpc_client,
+         urgent,
+         chunk_index_start,
+         chunk_index_end]() {
           rpc::PullRequest pull_request;
           pull_request.set_object_id(object_id.Binary());
           pull_request.set_node_id(self_node_id_.Binary());
+          pull_request.set_urgent(urgent);
+          pull_request.set_chunk_index_start(chunk_index_start);
+          pull_request.set_chunk_index_end(chunk_index_end);
 
           rpc_client->Pull(
               pull_request,
@@ -304,6 +376,7 @@ void ObjectManager::HandlePushTaskTimeout(const ObjectID &object_id,
 void ObjectManager::HandleSendFinished(const ObjectID &object_id,
                                        const NodeID &node_id,
                                        uint64_t chunk_index,
+                                       uint64_t chunk_bytes,
                                        double start_time,
                                        double end_time,
                                        ray::Status status) {
@@ -315,26 +388,108 @@ void ObjectManager::HandleSendFinished(const ObjectID &object_id,
     RAY_LOG(DEBUG).WithField(object_id).WithField(node_id)
         << "Failed to send a push request for an object to node. Chunk index: "
         << chunk_index;
+    return;
+  }
+  if (RayConfig::instance().object_manager_adaptive_chunk_size() ||
+      RayConfig::instance().object_manager_push_compression_enabled()) {
+    UpdatePushThroughput(node_id, chunk_bytes, end_time - start_time);
+  }
+}
+
+uint64_t ObjectManager::GetPushChunkSize(const NodeID &node_id) const {
+  if (!RayConfig::instance().object_manager_adaptive_chunk_size()) {
+    return config_.object_chunk_size;
+  }
+  absl::MutexLock lock(&adaptive_chunk_size_mutex_);
+  auto it = push_throughput_states_.find(node_id);
+  if (it == push_throughput_states_.end() || it->second.chunk_size == 0) {
+    return config_.object_chunk_size;
+  }
+  return it->second.chunk_size;
+}
+
+void ObjectManager::UpdatePushThroughput(const NodeID &node_id,
+                                         uint64_t chunk_bytes,
+                                         double duration_s) {
+  if (duration_s <= 0) {
+    return;
+  }
+  // Weight of the newest throughput sample in the moving average.
+  constexpr double kThroughputEwmaWeight = 0.2;
+  const double sample = static_cast<double>(chunk_bytes) / duration_s;
+
+  absl::MutexLock lock(&adaptive_chunk_size_mutex_);
+  auto &state = push_throughput_states_[node_id];
+  if (state.ewma_bytes_per_second == 0) {
+    state.ewma_bytes_per_second = sample;
+  } else {
+    state.ewma_bytes_per_second = (1 - kThroughputEwmaWeight) *
+                                      state.ewma_bytes_per_second +
+                                  kThroughputEwmaWeight * sample;
+  }
+  if (!RayConfig::instance().object_manager_adaptive_chunk_size()) {
+    // The throughput observation is only used for compression gating.
+    return;
+  }
+  // Size the chunk so one send takes about the target duration at the
+  // observed throughput: fast links get larger chunks, congested links
+  // smaller ones.
+  const double target_s =
+      RayConfig::instance().object_manager_adaptive_chunk_target_ms() / 1000.0;
+  const auto target_bytes =
+      static_cast<uint64_t>(state.ewma_bytes_per_second * target_s);
+  state.chunk_size =
+      std::clamp(target_bytes,
+                 RayConfig::instance().object_manager_adaptive_chunk_size_min_bytes(),
+                 RayConfig::instance().object_manager_adaptive_chunk_size_max_bytes());
+}
+
+bool ObjectManager::PushCompressionEligible(const NodeID &node_id) const {
+  const int64_t max_bps =
+      RayConfig::instance().object_manager_push_compression_max_bytes_per_second();
+  if (max_bps <= 0) {
+    return true;
   }
+  absl::MutexLock lock(&adaptive_chunk_size_mutex_);
+  auto it = push_throughput_states_.find(node_id);
+  // Without a throughput observation the link is assumed fast; compression
+  // kicks in once the node's first chunk sends have been measured.
+  if (it == push_throughput_states_.end() || it->second.ewma_bytes_per_second == 0) {
+    return false;
+  }
+  return it->second.ewma_bytes_per_second < static_cast<double>(max_bps);
 }
 
-void ObjectManager::Push(const ObjectID &object_id, const NodeID &node_id) {
+void ObjectManager::Push(const ObjectID &object_id,
+                         const NodeID &node_id,
+                         PushPriority priority,
+                         uint64_t chunk_index_start,
+                         uint64_t chunk_index_end) {
   RAY_LOG(DEBUG).WithField(object_id)
       << "Push object on " << self_node_id_ << " to " << node_id << " of object";
   if (local_objects_.count(object_id) != 0) {
-    return PushLocalObject(object_id, node_id);
+    return PushLocalObject(object_id, node_id, priority, chunk_index_start, chunk_index_end);
   }
 
   // Push from spilled object directly if the object is on local disk.
   auto object_url = get_spilled_object_url_(object_id);
   if (!object_url.empty() && RayConfig::instance().is_external_storage_type_fs()) {
-    return PushFromFilesystem(object_id, node_id, object_url);
+    return PushFromFilesystem(
+        object_id, node_id, object_url, priority, chunk_index_start, chunk_index_end);
   }
 
   // Avoid setting duplicated timer for the same object and node pair.
   auto &nodes = unfulfilled_push_requests_[object_id];
 
-  if (nodes.count(node_id) == 0) {
+  auto node_it = nodes.find(node_id);
+  if (node_it != nodes.end()) {
+    // Remember the highest priority requested while waiting for the object.
+    node_it->second.priority = std::max(node_it->second.priority, priority);
+    // A later request supersedes the pending chunk range, e.g. when a
+    // re-striped pull hands this node a different range.
+    node_it->second.chunk_index_start = chunk_index_start;
+    node_it->second.chunk_index_end = chunk_index_end;
+  } else {
     // If config_.push_timeout_ms < 0, we give an empty timer
     // and the task will be kept infinitely.
     std::unique_ptr<boost::asio::deadline_timer> timer;
@@ -357,12 +512,19 @@ void ObjectManager::Push(const ObjectID &object_id, const NodeID &node_id) {
           });
     }
     if (config_.push_timeout_ms != 0) {
-      nodes.emplace(node_id, std::move(timer));
+      nodes.emplace(
+          node_id,
+          UnfulfilledPushRequest{
+              std::move(timer), priority, chunk_index_start, chunk_index_end});
     }
   }
 }
 
-void ObjectManager::PushLocalObject(const ObjectID &object_id, const NodeID &node_id) {
+void ObjectManager::PushLocalObject(const ObjectID &object_id,
+                                    const NodeID &node_id,
+                                    PushPriority priority,
+                                    uint64_t chunk_index_start,
+                                    uint64_t chunk_index_end) {
   const ObjectInfo &object_info = local_objects_[object_id].object_info;
   uint64_t data_size = static_cast<uint64_t>(object_info.data_size);
   uint64_t metadata_size = static_cast<uint64_t>(object_info.metadata_size);
@@ -399,20 +561,41 @@ void ObjectManager::PushLocalObject(const ObjectID &object_id, const NodeID &nod
     local_objects_[object_id].object_info.metadata_size = 1;
   }
 
-  PushObjectInternal(object_id,
-                     node_id,
-                     std::make_shared<ChunkObjectReader>(std::move(object_reader),
-                                                         config_.object_chunk_size),
-                     /*from_disk=*/false);
+  // Ranged pushes always use the configured default chunk size so that all
+  // sources of a striped pull agree on the chunk layout.
+  const uint64_t chunk_size =
+      chunk_index_end == 0 ? GetPushChunkSize(node_id) : config_.object_chunk_size;
+  PushObjectInternal(
+      object_id,
+      node_id,
+      std::make_shared<ChunkObjectReader>(std::move(object_reader), chunk_size),
+      /*from_disk=*/false,
+      priority,
+      chunk_index_start,
+      chunk_index_end);
 }
 
 void ObjectManager::PushFromFilesystem(const ObjectID &object_id,
                                        const NodeID &node_id,
-                                       const std::string &spilled_url) {
+                                       const std::string &spilled_url,
+                                       PushPriority priority,
+                                       uint64_t chunk_index_start,
+                                       uint64_t chunk_index_end) {
+  // Ranged pushes always use the configured default chunk size so that all
+  // sources of a striped pull agree on the chunk layout.
+  const uint64_t push_chunk_size =
+      chunk_index_end == 0 ? GetPushChunkSize(node_id) : config_.object_chunk_size;
   // SpilledObjectReader::CreateSpilledObjectReader does synchronous IO; schedule it off
   // main thread.
   rpc_service_.post(
-      [this, object_id, node_id, spilled_url, chunk_size = config_.object_chunk_size]() {
+      [this,
+       object_id,
+       node_id,
+       spilled_url,
+       priority,
+       chunk_index_start,
+       chunk_index_end,
+       chunk_size = push_chunk_size]() {
         auto optional_spilled_object =
             SpilledObjectReader::CreateSpilledObjectReader(spilled_url);
         if (!optional_spilled_object.has_value()) {
@@ -431,11 +614,17 @@ void ObjectManager::PushFromFilesystem(const ObjectID &object_id,
             [this,
              object_id,
              node_id,
+             priority,
+             chunk_index_start,
+             chunk_index_end,
              chunk_object_reader = std::move(chunk_object_reader)]() {
               PushObjectInternal(object_id,
                                  node_id,
                                  std::move(chunk_object_reader),
-                                 /*from_disk=*/true);
+                                 /*from_disk=*/true,
+                                 priority,
+                                 chunk_index_start,
+                                 chunk_index_end);
             },
             "ObjectManager.PushLocalSpilledObjectInternal");
       },
@@ -445,23 +634,57 @@ void ObjectManager::PushFromFilesystem(const ObjectID &object_id,
 void ObjectManager::PushObjectInternal(const ObjectID &object_id,
                                        const NodeID &node_id,
                                        std::shared_ptr<ChunkObjectReader> chunk_reader,
-                                       bool from_disk) {
-  auto rpc_client = GetRpcClient(node_id);
-  if (!rpc_client) {
+                                       bool from_disk,
+                                       PushPriority priority,
+                                       uint64_t chunk_index_start,
+                                       uint64_t chunk_index_end) {
+  // Pick the first transport that can reach the receiver.
+  ChunkTransportInterface::SendChunkFn send_chunk;
+  for (const auto &transport : chunk_transports_) {
+    send_chunk = transport->MakeChunkSender(node_id);
+    if (send_chunk != nullptr) {
+      break;
+    }
+  }
+  if (send_chunk == nullptr) {
     // Push is best effort, so do nothing here.
     RAY_LOG(INFO)
         << "Failed to establish connection for Push with remote object manager.";
     return;
   }
 
+  const uint64_t num_chunks = chunk_reader->GetNumChunks();
+  if (chunk_index_end == 0 || chunk_index_end > num_chunks) {
+    chunk_index_end = num_chunks;
+  }
+  if (chunk_index_start >= chunk_index_end) {
+    // A stale range, e.g. computed from an outdated object size. Pushing is
+    // best effort and the puller will retry, so do nothing here.
+    RAY_LOG(DEBUG).WithField(object_id)
+        << "Ignoring push request with empty chunk range [" << chunk_index_start << ", "
+        << chunk_index_end << ")";
+    return;
+  }
+
   RAY_LOG(DEBUG).WithField(node_id).WithField(node_id)
       << "Sending object chunks of object to node, number of chunks: "
-      << chunk_reader->GetNumChunks()
+      << chunk_index_end - chunk_index_start
       << ", total data size: " << chunk_reader->GetObject().GetObjectSize();
 
   auto push_id = UniqueID::FromRandom();
+  // Negotiate compression once per transfer. The shared state lets the
+  // first chunk's achieved ratio turn compression off for the remaining
+  // chunks when the payload turns out to be incompressible.
+  std::shared_ptr<PushCompressionState> compression_state;
+  if (RayConfig::instance().object_manager_push_compression_enabled() &&
+      PushCompressionEligible(node_id)) {
+    compression_state = std::make_shared<PushCompressionState>();
+  }
   push_manager_->StartPush(
-      node_id, object_id, chunk_reader->GetNumChunks(), [=](int64_t chunk_id) {
+      node_id,
+      object_id,
+      chunk_index_end - chunk_index_start,
+      [=](int64_t chunk_id) {
         rpc_service_.post(
             [=]() {
               // Post to the multithreaded RPC event loop so that data is copied
@@ -470,19 +693,24 @@ void ObjectManager::PushObjectInternal(const ObjectID &object_id,
                   push_id,
                   object_id,
                   node_id,
-                  chunk_id,
-                  rpc_client,
+                  chunk_index_start + chunk_id,
+                  send_chunk,
                   [=](const Status &status) {
                     // Post back to the main event loop because the
                     // PushManager is not thread-safe.
-                    main_service_->post([this]() { push_manager_->OnChunkComplete(); },
-                                        "ObjectManager.Push");
+                    main_service_->post(
+                        [this, node_id, success = status.ok()]() {
+                          push_manager_->OnChunkComplete(node_id, success);
+                        },
+                        "ObjectManager.Push");
                   },
                   chunk_reader,
-                  from_disk);
+                  from_disk,
+                  compression_state);
             },
             "ObjectManager.Push");
-      });
+      },
+      priority);
 }
 
 void ObjectManager::SendObjectChunk(
@@ -490,41 +718,84 @@ void ObjectManager::SendObjectChunk(
     const ObjectID &object_id,
     const NodeID &node_id,
     uint64_t chunk_index,
-    std::shared_ptr<rpc::ObjectManagerClientInterface> rpc_client,
+    const ChunkTransportInterface::SendChunkFn &send_chunk,
     std::function<void(const Status &)> on_complete,
     std::shared_ptr<ChunkObjectReader> chunk_reader,
-    bool from_disk) {
+    bool from_disk,
+    std::shared_ptr<PushCompressionState> compression_state) {
   double start_time = absl::GetCurrentTimeNanos() / 1e9;
-  rpc::PushRequest push_request;
-  // Set request header
-  push_request.set_push_id(push_id.Binary());
-  push_request.set_object_id(object_id.Binary());
-  push_request.mutable_owner_address()->CopyFrom(
-      chunk_reader->GetObject().GetOwnerAddress());
-  push_request.set_node_id(self_node_id_.Binary());
-  push_request.set_data_size(chunk_reader->GetObject().GetObjectSize());
-  push_request.set_metadata_size(chunk_reader->GetObject().GetMetadataSize());
-  push_request.set_chunk_index(chunk_index);
-
-  // read a chunk into push_request and handle errors.
-  auto optional_chunk = chunk_reader->GetChunk(chunk_index);
-  if (!optional_chunk.has_value()) {
-    RAY_LOG(DEBUG) << "Read chunk " << chunk_index << " of object " << object_id
-                   << " failed. It may have been evicted.";
-    on_complete(Status::IOError("Failed to read spilled object"));
-    return;
+  ChunkSendRequest request;
+  request.push_id = push_id;
+  request.object_id = object_id;
+  request.from_node_id = self_node_id_;
+  request.owner_address = chunk_reader->GetObject().GetOwnerAddress();
+  request.data_size = chunk_reader->GetObject().GetObjectSize();
+  request.metadata_size = chunk_reader->GetObject().GetMetadataSize();
+  request.chunk_index = chunk_index;
+  request.chunk_size = chunk_reader->GetChunkSize();
+
+  // Read the chunk data and handle errors. Prefer a borrowed view of the
+  // chunk (backed by the plasma buffer or an mmap of the spill file), which
+  // lets the transport send the bytes without copying them; the chunk reader
+  // is handed along as the payload's owner to keep the view alive. Fall back
+  // to GetChunk for readers that can't expose views or chunks that span the
+  // data/metadata boundary.
+  ChunkPayload payload;
+  if (auto chunk_view = chunk_reader->GetChunkView(chunk_index)) {
+    payload = ChunkPayload::FromBorrowed(*chunk_view, chunk_reader);
+  } else {
+    auto optional_chunk = chunk_reader->GetChunk(chunk_index);
+    if (!optional_chunk.has_value()) {
+      RAY_LOG(DEBUG) << "Read chunk " << chunk_index << " of object " << object_id
+                     << " failed. It may have been evicted.";
+      on_complete(Status::IOError("Failed to read spilled object"));
+      return;
+    }
+    payload = ChunkPayload::FromOwned(std::move(optional_chunk.value()));
   }
-  push_request.set_data(std::move(optional_chunk.value()));
+  if (compression_state != nullptr &&
+      compression_state->verdict.load(std::memory_order_relaxed) >= 0) {
+    const int64_t compress_start_ns = absl::GetCurrentTimeNanos();
+    const std::string_view raw = payload.bytes();
+    auto compressed = DeflateChunk(
+        raw,
+        static_cast<int>(
+            RayConfig::instance().object_manager_push_compression_level()));
+    compression_cpu_us_ += (absl::GetCurrentTimeNanos() - compress_start_ns) / 1000;
+    const uint64_t min_savings_percent =
+        RayConfig::instance().object_manager_push_compression_min_savings_percent();
+    if (compressed.has_value() &&
+        compressed->size() + raw.size() * min_savings_percent / 100 <= raw.size()) {
+      num_bytes_push_compression_raw_ += raw.size();
+      num_bytes_push_compression_wire_ += compressed->size();
+      request.uncompressed_size = raw.size();
+      payload = ChunkPayload::FromOwned(std::move(*compressed));
+      compression_state->verdict.store(1, std::memory_order_relaxed);
+    } else if (compression_state->verdict.load(std::memory_order_relaxed) == 0) {
+      // The sampled chunk did not shrink enough; send the rest of this
+      // transfer uncompressed instead of burning CPU on it.
+      compression_state->verdict.store(-1, std::memory_order_relaxed);
+    }
+  }
+  if (RayConfig::instance().object_manager_chunk_integrity_checks()) {
+    // Hardware-accelerated CRC (SSE4.2 / ARMv8 CRC with runtime dispatch),
+    // computed here on the rpc threads so the main loop is not affected.
+    const std::string_view chunk_bytes_view = payload.bytes();
+    request.chunk_crc32c = static_cast<uint32_t>(absl::ComputeCrc32c(
+        absl::string_view(chunk_bytes_view.data(), chunk_bytes_view.size())));
+  }
+
+  const uint64_t chunk_bytes = payload.bytes().size();
   if (from_disk) {
-    num_bytes_pushed_from_disk_ += push_request.data().length();
+    num_bytes_pushed_from_disk_ += chunk_bytes;
   } else {
-    num_bytes_pushed_from_plasma_ += push_request.data().length();
+    num_bytes_pushed_from_plasma_ += chunk_bytes;
   }
 
   // record the time cost between send chunk and receive reply
-  rpc::ClientCallback<rpc::PushReply> callback =
-      [this, start_time, object_id, node_id, chunk_index, on_complete](
-          const Status &status, const rpc::PushReply &reply) {
+  auto callback =
+      [this, start_time, object_id, node_id, chunk_index, chunk_bytes, on_complete](
+          const Status &status) {
         // TODO(Eric Liang): Just print warning here, should we try to resend this chunk?
         if (!status.ok()) {
           RAY_LOG(WARNING).WithField(object_id).WithField(node_id)
@@ -532,11 +803,12 @@ void ObjectManager::SendObjectChunk(
               << ", chunk index: " << chunk_index;
         }
         double end_time = absl::GetCurrentTimeNanos() / 1e9;
-        HandleSendFinished(object_id, node_id, chunk_index, start_time, end_time, status);
+        HandleSendFinished(
+            object_id, node_id, chunk_index, chunk_bytes, start_time, end_time, status);
         on_complete(status);
       };
 
-  rpc_client->Push(push_request, callback);
+  send_chunk(request, std::move(payload), std::move(callback));
 }
 
 /// Implementation of ObjectManagerServiceHandler
@@ -550,11 +822,25 @@ void ObjectManager::HandlePush(rpc::PushRequest request,
   uint64_t chunk_index = request.chunk_index();
   uint64_t metadata_size = request.metadata_size();
   uint64_t data_size = request.data_size();
+  uint64_t chunk_size = request.chunk_size();
   const rpc::Address &owner_address = request.owner_address();
   const std::string &data = request.data();
-
-  bool success = ReceiveObjectChunk(
-      node_id, object_id, owner_address, data_size, metadata_size, chunk_index, data);
+  std::optional<uint32_t> chunk_crc32c;
+  if (request.has_chunk_crc32c()) {
+    chunk_crc32c = request.chunk_crc32c();
+  }
+  uint64_t uncompressed_size = request.uncompressed_size();
+
+  bool success = ReceiveObjectChunk(node_id,
+                                    object_id,
+                                    owner_address,
+                                    data_size,
+                                    metadata_size,
+                                    chunk_index,
+                                    chunk_size,
+                                    data,
+                                    chunk_crc32c,
+                                    uncompressed_size);
   num_chunks_received_total_++;
   if (!success) {
     num_chunks_received_total_failed_++;
@@ -573,7 +859,10 @@ bool ObjectManager::ReceiveObjectChunk(const NodeID &node_id,
                                        uint64_t data_size,
                                        uint64_t metadata_size,
                                        uint64_t chunk_index,
-                                       const std::string &data) {
+                                       uint64_t chunk_size,
+                                       const std::string &data,
+                                       std::optional<uint32_t> chunk_crc32c,
+                                       uint64_t uncompressed_size) {
   num_bytes_received_total_ += data.size();
   RAY_LOG(DEBUG).WithField(object_id)
       << "ReceiveObjectChunk on " << self_node_id_ << " from " << node_id
@@ -585,8 +874,44 @@ bool ObjectManager::ReceiveObjectChunk(const NodeID &node_id,
     // This object is no longer being actively pulled. Do not create the object.
     return false;
   }
+
+  if (chunk_crc32c.has_value() &&
+      RayConfig::instance().object_manager_chunk_integrity_checks()) {
+    const uint32_t actual_crc32c =
+        static_cast<uint32_t>(absl::ComputeCrc32c(absl::string_view(data)));
+    if (actual_crc32c != *chunk_crc32c) {
+      num_chunks_received_corrupt_++;
+      RAY_LOG(ERROR).WithField(object_id).WithField(node_id)
+          << "Object chunk failed CRC32C verification, dropping it so it is "
+             "re-pulled. Chunk index: "
+          << chunk_index << ", sender crc: " << *chunk_crc32c
+          << ", computed crc: " << actual_crc32c;
+      return false;
+    }
+  }
+
+  // The sender deflate-compressed the chunk; restore the original bytes
+  // before writing them into the buffer pool. The CRC above covers the wire
+  // bytes, so it has already been checked at this point.
+  const std::string *chunk_data = &data;
+  std::string inflated;
+  if (uncompressed_size > 0) {
+    const int64_t inflate_start_ns = absl::GetCurrentTimeNanos();
+    auto restored = InflateChunk(data, uncompressed_size);
+    compression_cpu_us_ += (absl::GetCurrentTimeNanos() - inflate_start_ns) / 1000;
+    if (!restored.has_value()) {
+      num_chunks_received_decompress_failed_++;
+      RAY_LOG(ERROR).WithField(object_id).WithField(node_id)
+          << "Object chunk failed to decompress to its declared "
+          << uncompressed_size << " bytes, dropping it so it is re-pulled. "
+          << "Chunk index: " << chunk_index;
+      return false;
+    }
+    inflated = std::move(*restored);
+    chunk_data = &inflated;
+  }
   auto chunk_status = buffer_pool_.CreateChunk(
-      object_id, owner_address, data_size, metadata_size, chunk_index);
+      object_id, owner_address, data_size, metadata_size, chunk_index, chunk_size);
   if (!pull_manager_->IsObjectActive(object_id)) {
     num_chunks_received_cancelled_++;
     // This object is no longer being actively pulled. Abort the object. We
@@ -601,7 +926,8 @@ bool ObjectManager::ReceiveObjectChunk(const NodeID &node_id,
 
   if (chunk_status.ok()) {
     // Avoid handling this chunk if it's already being handled by another process.
-    buffer_pool_.WriteChunk(object_id, data_size, metadata_size, chunk_index, data);
+    buffer_pool_.WriteChunk(
+        object_id, data_size, metadata_size, chunk_index, *chunk_data);
     return true;
   } else {
     num_chunks_received_failed_due_to_plasma_++;
@@ -618,11 +944,17 @@ void ObjectManager::HandlePull(rpc::PullRequest request,
                                rpc::SendReplyCallback send_reply_callback) {
   ObjectID object_id = ObjectID::FromBinary(request.object_id());
   NodeID node_id = NodeID::FromBinary(request.node_id());
+  const auto priority = request.urgent() ? PushPriority::kUrgent : PushPriority::kBulk;
+  const uint64_t chunk_index_start = request.chunk_index_start();
+  const uint64_t chunk_index_end = request.chunk_index_end();
   RAY_LOG(DEBUG).WithField(node_id).WithField(object_id)
       << "Received pull request from node for object";
 
-  main_service_->post([this, object_id, node_id]() { Push(object_id, node_id); },
-                      "ObjectManager.HandlePull");
+  main_service_->post(
+      [this, object_id, node_id, priority, chunk_index_start, chunk_index_end]() {
+        Push(object_id, node_id, priority, chunk_index_start, chunk_index_end);
+      },
+      "ObjectManager.HandlePull");
   send_reply_callback(Status::OK(), nullptr, nullptr);
 }
 
@@ -741,6 +1073,7 @@ std::shared_ptr<rpc::ObjectManagerClientInterface> ObjectManager::GetRpcClient(
 
 void ObjectManager::HandleNodeRemoved(const NodeID &node_id) {
   push_manager_->HandleNodeRemoved(node_id);
+  pull_manager_->HandleNodeRemoved(node_id);
   remote_object_manager_clients_.erase(node_id);
 }
 
@@ -794,6 +1127,15 @@ void ObjectManager::RecordMetrics() {
                                                {{"Type", "FailedCancelled"}});
   object_manager_received_chunks_gauge_.Record(num_chunks_received_failed_due_to_plasma_,
                                                {{"Type", "FailedPlasmaFull"}});
+  object_manager_received_chunks_gauge_.Record(num_chunks_received_corrupt_,
+                                               {{"Type", "FailedIntegrity"}});
+  object_manager_received_chunks_gauge_.Record(num_chunks_received_decompress_failed_,
+                                               {{"Type", "FailedDecompression"}});
+  object_manager_compression_bytes_gauge_.Record(num_bytes_push_compression_raw_,
+                                                 {{"Type", "Raw"}});
+  object_manager_compression_bytes_gauge_.Record(num_bytes_push_compression_wire_,
+                                                 {{"Type", "Wire"}});
+  object_manager_compression_cpu_seconds_gauge_.Record(compression_cpu_us_ / 1e6);
 }
 
 void ObjectManager::FillObjectStoreStats(rpc::GetNodeStatsReply *reply) const {
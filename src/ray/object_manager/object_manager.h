@@ -14,18 +14,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/id.h"
 #include "ray/common/status.h"
 #include "ray/object_manager/chunk_object_reader.h"
+#include "ray/object_manager/chunk_transport.h"
 #include "ray/object_manager/common.h"
 #include "ray/object_manager/object_buffer_pool.h"
 #include "ray/object_manager/object_directory.h"
@@ -216,7 +220,15 @@ class ObjectManager : public ObjectManagerInterface,
   ///
   /// \param object_id The object's object id.
   /// \param node_id The remote node's id.
-  void Push(const ObjectID &object_id, const NodeID &node_id);
+  /// \param priority The priority lane to schedule the push in.
+  /// \param chunk_index_start The start of the chunk index range to push.
+  /// \param chunk_index_end The end (exclusive) of the chunk index range to
+  /// push. 0 pushes the whole object.
+  void Push(const ObjectID &object_id,
+            const NodeID &node_id,
+            PushPriority priority = PushPriority::kBulk,
+            uint64_t chunk_index_start = 0,
+            uint64_t chunk_index_end = 0);
 
   /// Pull a bundle of objects. This will attempt to make all objects in the
   /// bundle local until the request is canceled with the returned ID.
@@ -242,8 +254,9 @@ class ObjectManager : public ObjectManagerInterface,
   ///                   or send it to all the object stores.
   void FreeObjects(const std::vector<ObjectID> &object_ids, bool local_only) override;
 
-  /// Cancel all pushes that have not yet been sent to the removed node and erases the
-  /// associated client if it exists.
+  /// Cancel all pushes that have not yet been sent to the removed node, drop the
+  /// node from all pull requests' known locations, and erase the associated
+  /// client if it exists.
   ///
   /// \param node_id The ID of the node that was removed.
   void HandleNodeRemoved(const NodeID &node_id) override;
@@ -293,15 +306,30 @@ class ObjectManager : public ObjectManagerInterface,
   ///
   /// \param object_id The object's object id.
   /// \param node_id The remote node's id.
-  void PushLocalObject(const ObjectID &object_id, const NodeID &node_id);
+  /// \param priority The priority lane to schedule the push in.
+  /// \param chunk_index_start The start of the chunk index range to push.
+  /// \param chunk_index_end The end (exclusive) of the chunk index range to
+  /// push. 0 pushes the whole object.
+  void PushLocalObject(const ObjectID &object_id,
+                       const NodeID &node_id,
+                       PushPriority priority,
+                       uint64_t chunk_index_start,
+                       uint64_t chunk_index_end);
 
   /// Pushing a known spilled object to a remote object manager.
   /// \param object_id The object's object id.
   /// \param node_id The remote node's id.
   /// \param spilled_url The url of the spilled object.
+  /// \param priority The priority lane to schedule the push in.
+  /// \param chunk_index_start The start of the chunk index range to push.
+  /// \param chunk_index_end The end (exclusive) of the chunk index range to
+  /// push. 0 pushes the whole object.
   void PushFromFilesystem(const ObjectID &object_id,
                           const NodeID &node_id,
-                          const std::string &spilled_url);
+                          const std::string &spilled_url,
+                          PushPriority priority,
+                          uint64_t chunk_index_start,
+                          uint64_t chunk_index_end);
 
   /// The internal implementation of pushing an object.
   ///
@@ -310,11 +338,28 @@ class ObjectManager : public ObjectManagerInterface,
   /// \param chunk_reader Chunk reader used to read a chunk of the object
   /// \param from_disk Whether chunk is being read from disk or plasma. This is
   /// used only for metrics.
+  /// \param priority The priority lane to schedule the push in.
+  /// \param chunk_index_start The start of the chunk index range to push.
+  /// \param chunk_index_end The end (exclusive) of the chunk index range to
+  /// push, clamped to the object's chunk count. 0 pushes the whole object.
   /// Status::OK() if the read succeeded.
   void PushObjectInternal(const ObjectID &object_id,
                           const NodeID &node_id,
                           std::shared_ptr<ChunkObjectReader> chunk_reader,
-                          bool from_disk);
+                          bool from_disk,
+                          PushPriority priority,
+                          uint64_t chunk_index_start,
+                          uint64_t chunk_index_end);
+
+  /// Compression negotiation state shared by all chunk sends of one push.
+  /// The first chunk acts as a sample: if it does not compress well enough,
+  /// the remaining chunks of the transfer are sent raw. Chunk sends run
+  /// concurrently on the rpc threads, hence the atomic.
+  struct PushCompressionState {
+    /// 0 while sampling, 1 once a chunk compressed well, -1 once the sampled
+    /// chunk turned out to be incompressible.
+    std::atomic<int8_t> verdict{0};
+  };
 
   /// Send one chunk of the object to remote object manager
   ///
@@ -324,19 +369,22 @@ class ObjectManager : public ObjectManagerInterface,
   /// \param object_id Object id
   /// \param node_id The id of the receiver.
   /// \param chunk_index Chunk index of this object chunk, start with 0
-  /// \param rpc_client Rpc client used to send message to remote object manager
+  /// \param send_chunk Transport send function bound to the receiver.
   /// \param on_complete Callback when the chunk is sent
   /// \param chunk_reader Chunk reader used to read a chunk of the object
   /// \param from_disk Whether chunk is being read from disk or plasma. This is
   /// used only for metrics.
+  /// \param compression_state The push's shared compression negotiation
+  /// state, or nullptr when the transfer is not compressed.
   void SendObjectChunk(const UniqueID &push_id,
                        const ObjectID &object_id,
                        const NodeID &node_id,
                        uint64_t chunk_index,
-                       std::shared_ptr<rpc::ObjectManagerClientInterface> rpc_client,
+                       const ChunkTransportInterface::SendChunkFn &send_chunk,
                        std::function<void(const Status &)> on_complete,
                        std::shared_ptr<ChunkObjectReader> chunk_reader,
-                       bool from_disk);
+                       bool from_disk,
+                       std::shared_ptr<PushCompressionState> compression_state);
 
   /// Handle starting, running, and stopping asio rpc_service.
   void StartRpcService();
@@ -359,6 +407,7 @@ class ObjectManager : public ObjectManagerInterface,
   /// \param object_id The ID of the object that was sent.
   /// \param node_id The ID of the node that the chunk was sent to.
   /// \param chunk_index The index of the chunk.
+  /// \param chunk_bytes The number of bytes of chunk data that were sent.
   /// \param start_time_us The time when the object manager began sending the
   /// chunk.
   /// \param end_time_us The time when the object manager finished sending the
@@ -367,6 +416,7 @@ class ObjectManager : public ObjectManagerInterface,
   void HandleSendFinished(const ObjectID &object_id,
                           const NodeID &node_id,
                           uint64_t chunk_index,
+                          uint64_t chunk_bytes,
                           double start_time_us,
                           double end_time_us,
                           ray::Status status);
@@ -390,23 +440,39 @@ class ObjectManager : public ObjectManagerInterface,
   /// \param data_size Data size
   /// \param metadata_size Metadata size
   /// \param chunk_index Chunk index
+  /// \param chunk_size The chunk size the sender split the transfer with, or
+  /// 0 for the configured default
   /// \param data Chunk data
+  /// \param chunk_crc32c CRC32C of the chunk data as computed by the sender,
+  /// if the sender has chunk integrity checks enabled
   /// \return Whether the chunk was successfully written into the local object
-  /// store. This can fail if the chunk was already received in the past, or if
-  /// the object is no longer being actively pulled.
+  /// store. This can fail if the chunk was already received in the past, if
+  /// the object is no longer being actively pulled, or if the chunk failed
+  /// integrity verification.
+  /// \param uncompressed_size When non-zero, the chunk is deflate-compressed
+  /// and this is its original length.
   bool ReceiveObjectChunk(const NodeID &node_id,
                           const ObjectID &object_id,
                           const rpc::Address &owner_address,
                           uint64_t data_size,
                           uint64_t metadata_size,
                           uint64_t chunk_index,
-                          const std::string &data);
+                          uint64_t chunk_size,
+                          const std::string &data,
+                          std::optional<uint32_t> chunk_crc32c,
+                          uint64_t uncompressed_size);
 
   /// Send pull request
   ///
   /// \param object_id Object id
   /// \param client_id Remote server client id
-  void SendPullRequest(const ObjectID &object_id, const NodeID &client_id);
+  /// \param chunk_index_start The start of the requested chunk index range.
+  /// \param chunk_index_end The end (exclusive) of the requested chunk index
+  /// range. 0 requests the whole object.
+  void SendPullRequest(const ObjectID &object_id,
+                       const NodeID &client_id,
+                       uint64_t chunk_index_start,
+                       uint64_t chunk_index_end);
 
   /// Retry free objects request
   ///
@@ -422,6 +488,25 @@ class ObjectManager : public ObjectManagerInterface,
   /// \param node_id Remote node id, will send rpc request to it
   std::shared_ptr<rpc::ObjectManagerClientInterface> GetRpcClient(const NodeID &node_id);
 
+  /// Pick the chunk size for a new transfer to a node. Returns the configured
+  /// default unless adaptive chunk sizing is enabled and we have observed
+  /// throughput towards the node.
+  uint64_t GetPushChunkSize(const NodeID &node_id) const
+      ABSL_LOCKS_EXCLUDED(adaptive_chunk_size_mutex_);
+
+  /// Fold a completed chunk send into the node's observed throughput and
+  /// renegotiate the chunk size used for future transfers to it. Called from
+  /// the rpc threads as chunk sends complete.
+  void UpdatePushThroughput(const NodeID &node_id,
+                            uint64_t chunk_bytes,
+                            double duration_s)
+      ABSL_LOCKS_EXCLUDED(adaptive_chunk_size_mutex_);
+
+  /// Whether a new transfer to the node should be compressed, based on the
+  /// observed push throughput towards it and the configured threshold.
+  bool PushCompressionEligible(const NodeID &node_id) const
+      ABSL_LOCKS_EXCLUDED(adaptive_chunk_size_mutex_);
+
   /// Weak reference to main service. We ensure this object is destroyed before
   /// main_service_ is stopped.
   instrumented_io_context *main_service_;
@@ -457,11 +542,20 @@ class ObjectManager : public ObjectManagerInterface,
   /// subscribe multiple times to the same object during Pull.
   UniqueID object_directory_pull_callback_id_ = UniqueID::FromRandom();
 
+  /// A push request that is waiting for its object to become local, together
+  /// with the priority and chunk index range it was requested at.
+  struct UnfulfilledPushRequest {
+    std::unique_ptr<boost::asio::deadline_timer> timer;
+    PushPriority priority = PushPriority::kBulk;
+    /// The requested chunk index range. A chunk_index_end of 0 means the
+    /// whole object.
+    uint64_t chunk_index_start = 0;
+    uint64_t chunk_index_end = 0;
+  };
+
   /// Maintains a map of push requests that have not been fulfilled due to an object not
   /// being local. Objects are removed from this map after push_timeout_ms have elapsed.
-  absl::flat_hash_map<
-      ObjectID,
-      absl::flat_hash_map<NodeID, std::unique_ptr<boost::asio::deadline_timer>>>
+  absl::flat_hash_map<ObjectID, absl::flat_hash_map<NodeID, UnfulfilledPushRequest>>
       unfulfilled_push_requests_;
 
   /// The gPRC server.
@@ -487,6 +581,11 @@ class ObjectManager : public ObjectManagerInterface,
   /// Object push manager.
   std::unique_ptr<PushManager> push_manager_;
 
+  /// Transports for outgoing object chunks, consulted in registration order
+  /// for each push. The gRPC transport is registered last as the universal
+  /// fallback.
+  std::vector<std::unique_ptr<ChunkTransportInterface>> chunk_transports_;
+
   /// Object pull manager.
   std::unique_ptr<PullManager> pull_manager_;
 
@@ -521,6 +620,38 @@ class ObjectManager : public ObjectManagerInterface,
   /// plasma.
   size_t num_chunks_received_failed_due_to_plasma_ = 0;
 
+  /// The total number of chunks dropped because their data did not match the
+  /// sender's CRC32C. Only counted when chunk integrity checks are enabled.
+  size_t num_chunks_received_corrupt_ = 0;
+
+  /// The total number of compressed chunks dropped because they failed to
+  /// decompress to their declared size.
+  size_t num_chunks_received_decompress_failed_ = 0;
+
+  /// Compression telemetry, counted only for chunks actually sent
+  /// compressed: their size before (raw) and after (wire) compression, and
+  /// the cumulative CPU time spent compressing pushed chunks plus
+  /// decompressing received ones.
+  size_t num_bytes_push_compression_raw_ = 0;
+  size_t num_bytes_push_compression_wire_ = 0;
+  size_t compression_cpu_us_ = 0;
+
+  /// Observed push throughput towards a node, used to pick the chunk size of
+  /// new transfers when adaptive chunk sizing is enabled.
+  struct PushThroughputState {
+    /// Exponentially weighted moving average of the chunk send throughput.
+    double ewma_bytes_per_second = 0;
+    /// The chunk size negotiated for new transfers to the node.
+    uint64_t chunk_size = 0;
+  };
+
+  /// Protects push_throughput_states_. Chunk sends complete on the rpc
+  /// threads while new transfers pick their chunk size on the main thread.
+  mutable absl::Mutex adaptive_chunk_size_mutex_;
+
+  absl::flat_hash_map<NodeID, PushThroughputState> push_throughput_states_
+      ABSL_GUARDED_BY(adaptive_chunk_size_mutex_);
+
   ray::stats::Gauge object_store_available_memory_gauge_{
       GetObjectStoreAvailableMemoryGaugeMetric()};
   ray::stats::Gauge object_store_used_memory_gauge_{
@@ -534,6 +665,10 @@ class ObjectManager : public ObjectManagerInterface,
   ray::stats::Gauge object_manager_bytes_gauge_{ray::GetObjectManagerBytesGaugeMetric()};
   ray::stats::Gauge object_manager_received_chunks_gauge_{
       ray::GetObjectManagerReceivedChunksGaugeMetric()};
+  ray::stats::Gauge object_manager_compression_bytes_gauge_{
+      ray::GetObjectManagerCompressionBytesGaugeMetric()};
+  ray::stats::Gauge object_manager_compression_cpu_seconds_gauge_{
+      ray::GetObjectManagerCompressionCpuSecondsGaugeMetric()};
 };
 
 }  // namespace ray
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "src/ray/protobuf/common.pb.h"
 
@@ -55,5 +57,23 @@ class IObjectReader {
   virtual bool ReadFromMetadataSection(uint64_t offset,
                                        uint64_t size,
                                        std::string &output) const = 0;
+
+  /// Return a borrowed view over a range of the data section without copying,
+  /// or an empty optional if this reader cannot expose its bytes directly or
+  /// the range is invalid. Callers fall back to ReadFromDataSection. The view
+  /// stays valid for the lifetime of the reader.
+  ///
+  /// \param offset offset to the data section the view starts at.
+  /// \param size number of bytes the view covers.
+  virtual std::optional<std::string_view> GetDataSectionView(uint64_t offset,
+                                                             uint64_t size) const {
+    return std::nullopt;
+  }
+
+  /// Same as GetDataSectionView, for the metadata section.
+  virtual std::optional<std::string_view> GetMetadataSectionView(uint64_t offset,
+                                                                 uint64_t size) const {
+    return std::nullopt;
+  }
 };
 }  // namespace ray
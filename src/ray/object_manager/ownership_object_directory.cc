@@ -15,6 +15,7 @@
 #include "ray/object_manager/ownership_object_directory.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -57,7 +58,6 @@ bool UpdateObjectLocations(const rpc::WorkerObjectLocationsPubMessage &location_
                            bool *pending_creation,
                            size_t *object_size) {
   bool is_updated = false;
-  std::unordered_set<NodeID> new_node_ids;
   // The size can be 0 if the update was a deletion. The size can also be unset if the
   // size is unknown e.g. because the task is not finished yet. This assumes that an
   // object's size is always greater than 0.
@@ -67,14 +67,31 @@ bool UpdateObjectLocations(const rpc::WorkerObjectLocationsPubMessage &location_
     *object_size = location_info.object_size();
     is_updated = true;
   }
-  for (auto const &node_id : location_info.node_ids()) {
-    new_node_ids.emplace(NodeID::FromBinary(node_id));
-  }
-  // Filter out the removed nodes from the object locations.
-  FilterRemovedNodes(gcs_client, &new_node_ids);
-  if (new_node_ids != *node_ids) {
-    *node_ids = new_node_ids;
-    is_updated = true;
+  if (location_info.is_delta()) {
+    // Apply the added and removed nodes to the locations from the last
+    // message. The caller guarantees a full snapshot was received first.
+    for (auto const &node_id_binary : location_info.node_ids_added()) {
+      const auto node_id = NodeID::FromBinary(node_id_binary);
+      if (!gcs_client.Nodes().IsNodeDead(node_id) && node_ids->insert(node_id).second) {
+        is_updated = true;
+      }
+    }
+    for (auto const &node_id_binary : location_info.node_ids_removed()) {
+      if (node_ids->erase(NodeID::FromBinary(node_id_binary)) > 0) {
+        is_updated = true;
+      }
+    }
+  } else {
+    std::unordered_set<NodeID> new_node_ids;
+    for (auto const &node_id : location_info.node_ids()) {
+      new_node_ids.emplace(NodeID::FromBinary(node_id));
+    }
+    // Filter out the removed nodes from the object locations.
+    FilterRemovedNodes(gcs_client, &new_node_ids);
+    if (new_node_ids != *node_ids) {
+      *node_ids = new_node_ids;
+      is_updated = true;
+    }
   }
   const std::string &new_spilled_url = location_info.spilled_url();
   if (new_spilled_url != *spilled_url) {
@@ -267,6 +284,11 @@ void OwnershipBasedObjectDirectory::ObjectLocationSubscriptionCallback(
   if (it == listeners_.end()) {
     return;
   }
+  if (location_info.is_delta() && !it->second.subscribed) {
+    // A delta cannot be applied before the initial snapshot. The snapshot the
+    // owner publishes on subscription already includes this change.
+    return;
+  }
   // Once this flag is set to true, it should never go back to false.
   it->second.subscribed = true;
 
@@ -434,6 +456,72 @@ void OwnershipBasedObjectDirectory::UnsubscribeObjectLocations(
   }
 }
 
+std::optional<CachedObjectLocations> OwnershipBasedObjectDirectory::GetCachedLocations(
+    const ObjectID &object_id) const {
+  auto entry = listeners_.find(object_id);
+  if (entry == listeners_.end() || !entry->second.subscribed) {
+    // Either no local subscriber cares about this object or we have not yet
+    // received the first notification from the owner, so we do not know the
+    // object's locations.
+    return std::nullopt;
+  }
+  const auto &state = entry->second;
+  return CachedObjectLocations{state.current_object_locations,
+                               state.spilled_url,
+                               state.spilled_node_id,
+                               state.pending_creation,
+                               state.object_size};
+}
+
+void OwnershipBasedObjectDirectory::HandleLocationHint(const ObjectID &object_id,
+                                                       const NodeID &node_id,
+                                                       size_t object_size) {
+  auto it = listeners_.find(object_id);
+  // Do nothing for objects we are not listening for.
+  if (it == listeners_.end()) {
+    return;
+  }
+  auto &state = it->second;
+  if (state.subscribed) {
+    // The owner's pubsub snapshot has already arrived and is authoritative; it
+    // includes any location the owner could have hinted at.
+    return;
+  }
+  if (gcs_client_.Nodes().IsNodeDead(node_id)) {
+    return;
+  }
+  bool updated = state.current_object_locations.insert(node_id).second;
+  if (state.object_size == 0 && object_size > 0) {
+    state.object_size = object_size;
+    updated = true;
+  }
+  if (state.pending_creation) {
+    state.pending_creation = false;
+    updated = true;
+  }
+  // NOTE: `subscribed` is deliberately left false. The hint is a best-effort
+  // head start; the owner's initial snapshot still has to arrive before deltas
+  // can be applied and before the cached entry is considered authoritative.
+  if (!updated) {
+    return;
+  }
+  RAY_LOG(DEBUG).WithField(object_id).WithField(node_id)
+      << "Applying eager location hint, object size: " << object_size;
+  metrics_num_object_location_updates_++;
+  cum_metrics_num_object_location_updates_++;
+  // Copy the callbacks so that the callbacks can unsubscribe without
+  // interrupting looping over the callbacks.
+  auto callbacks = state.callbacks;
+  for (const auto &[_, func] : callbacks) {
+    func(object_id,
+         state.current_object_locations,
+         state.spilled_url,
+         state.spilled_node_id,
+         state.pending_creation,
+         state.object_size);
+  }
+}
+
 void OwnershipBasedObjectDirectory::HandleNodeRemoved(const NodeID &node_id) {
   for (auto &[object_id, listener] : listeners_) {
     bool updated = listener.current_object_locations.erase(node_id) > 0;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -57,6 +58,13 @@ class OwnershipBasedObjectDirectory : public IObjectDirectory {
   void UnsubscribeObjectLocations(const UniqueID &callback_id,
                                   const ObjectID &object_id) override;
 
+  std::optional<CachedObjectLocations> GetCachedLocations(
+      const ObjectID &object_id) const override;
+
+  void HandleLocationHint(const ObjectID &object_id,
+                          const NodeID &node_id,
+                          size_t object_size) override;
+
   /// Report to the owner that the given object is added to the current node.
   /// This method guarantees ordering and batches requests.
   void ReportObjectAdded(const ObjectID &object_id,
@@ -17,6 +17,7 @@
 
 #include "ray/object_manager/plasma/client.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <mutex>
@@ -77,19 +78,27 @@ uint8_t *PlasmaClient::GetStoreFdAndMmap(MEMFD_TYPE store_fd_val, int64_t map_si
   auto entry = mmap_table_.find(store_fd_val);
   if (entry != mmap_table_.end()) {
     return entry->second->pointer();
-  } else {
-    MEMFD_TYPE fd;
-    RAY_CHECK_OK(store_conn_->RecvFd(&fd.first));
-    fd.second = store_fd_val.second;
-    // Close and erase the old duplicated fd entry that is no longer needed.
-    if (dedup_fd_table_.find(store_fd_val.first) != dedup_fd_table_.end()) {
-      RAY_LOG(INFO) << "Erasing re-used mmap entry for fd " << store_fd_val.first;
-      mmap_table_.erase(dedup_fd_table_[store_fd_val.first]);
-    }
-    dedup_fd_table_[store_fd_val.first] = store_fd_val;
-    mmap_table_[store_fd_val] = std::make_unique<ClientMmapTableEntry>(fd, map_size);
-    return mmap_table_[store_fd_val]->pointer();
   }
+  MEMFD_TYPE_NON_UNIQUE received_fd;
+  RAY_CHECK_OK(store_conn_->RecvFd(&received_fd));
+  return StoreMmapEntry(store_fd_val, received_fd, map_size);
+}
+
+// Record the mmap entry for a file descriptor just received from the store.
+uint8_t *PlasmaClient::StoreMmapEntry(MEMFD_TYPE store_fd_val,
+                                      MEMFD_TYPE_NON_UNIQUE received_fd,
+                                      int64_t map_size) {
+  MEMFD_TYPE fd;
+  fd.first = received_fd;
+  fd.second = store_fd_val.second;
+  // Close and erase the old duplicated fd entry that is no longer needed.
+  if (dedup_fd_table_.find(store_fd_val.first) != dedup_fd_table_.end()) {
+    RAY_LOG(INFO) << "Erasing re-used mmap entry for fd " << store_fd_val.first;
+    mmap_table_.erase(dedup_fd_table_[store_fd_val.first]);
+  }
+  dedup_fd_table_[store_fd_val.first] = store_fd_val;
+  mmap_table_[store_fd_val] = std::make_unique<ClientMmapTableEntry>(fd, map_size);
+  return mmap_table_[store_fd_val]->pointer();
 }
 
 // Get a pointer to a file that we know has been memory mapped in this client
@@ -228,6 +237,9 @@ Status PlasmaClient::CreateAndSpillIfNeeded(const ObjectID &object_id,
 
     RAY_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
+    // Send any deferred releases first so the store can evict those objects
+    // if it needs the space for this creation.
+    RAY_RETURN_NOT_OK(FlushPendingReleases());
     RAY_RETURN_NOT_OK(SendCreateRequest(store_conn_,
                                         object_id,
                                         owner_address,
@@ -251,6 +263,7 @@ Status PlasmaClient::CreateAndSpillIfNeeded(const ObjectID &object_id,
     std::unique_lock<std::recursive_mutex> guard(client_mutex_);
     RAY_LOG(DEBUG) << "Retrying request for object " << object_id << " with request ID "
                    << retry_with_request_id;
+    RAY_RETURN_NOT_OK(FlushPendingReleases());
     RAY_RETURN_NOT_OK(
         SendCreateRetryRequest(store_conn_, object_id, retry_with_request_id));
     status = HandleCreateReply(object_id,
@@ -275,6 +288,7 @@ Status PlasmaClient::TryCreateImmediately(const ObjectID &object_id,
 
   RAY_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                  << data_size << " and metadata size " << metadata_size;
+  RAY_RETURN_NOT_OK(FlushPendingReleases());
   RAY_RETURN_NOT_OK(SendCreateRequest(store_conn_,
                                       object_id,
                                       owner_address,
@@ -288,6 +302,53 @@ Status PlasmaClient::TryCreateImmediately(const ObjectID &object_id,
       object_id, /*is_experimental_mutable_object=*/false, metadata, nullptr, data);
 }
 
+Status PlasmaClient::CreateAndSealBatch(const std::vector<ObjectID> &object_ids,
+                                        const ray::rpc::Address &owner_address,
+                                        const std::vector<std::string> &data,
+                                        const std::vector<std::string> &metadata,
+                                        plasma::flatbuf::ObjectSource source,
+                                        std::vector<PlasmaError> *errors) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  RAY_LOG(DEBUG) << "called plasma batch create on conn " << store_conn_ << " with "
+                 << object_ids.size() << " objects";
+  RAY_RETURN_NOT_OK(FlushPendingReleases());
+  RAY_RETURN_NOT_OK(SendBatchCreateRequest(
+      store_conn_, object_ids, owner_address, data, metadata, source));
+  std::vector<uint8_t> buffer;
+  RAY_RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaBatchCreateReply, &buffer));
+  std::vector<ObjectID> reply_object_ids;
+  RAY_RETURN_NOT_OK(
+      ReadBatchCreateReply(buffer.data(), buffer.size(), &reply_object_ids, errors));
+  RAY_CHECK_EQ(reply_object_ids.size(), object_ids.size());
+  // The store seals the objects and drops the creator references itself, so
+  // there is nothing to track in objects_in_use_.
+  return Status::OK();
+}
+
+Status PlasmaClient::RestoreSpilledObject(const ObjectID &object_id,
+                                          const std::string &spilled_url) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  RAY_LOG(DEBUG) << "called plasma restore spilled object on conn " << store_conn_
+                 << " for object " << object_id;
+  RAY_RETURN_NOT_OK(
+      SendRestoreSpilledObjectRequest(store_conn_, object_id, spilled_url));
+  std::vector<uint8_t> buffer;
+  RAY_RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaRestoreSpilledObjectReply, &buffer));
+  ObjectID reply_object_id;
+  PlasmaError error;
+  ReadRestoreSpilledObjectReply(buffer.data(), buffer.size(), &reply_object_id, &error);
+  RAY_CHECK_EQ(reply_object_id, object_id);
+  if (error == PlasmaError::OK || error == PlasmaError::ObjectExists) {
+    // ObjectExists means the object was already local, which is just as good.
+    return Status::OK();
+  }
+  return Status::NotFound("Failed to map the spilled object at " + spilled_url);
+}
+
 Status PlasmaClient::GetBuffers(const ObjectID *object_ids,
                                 int64_t num_objects,
                                 int64_t timeout_ms,
@@ -318,16 +379,20 @@ Status PlasmaClient::GetBuffers(const ObjectID *object_ids,
       RAY_CHECK_EQ(object->device_num, 0) << "GPU library is not enabled.";
 
       uint8_t *data = LookupMmappedFile(object->store_fd);
+      // Data and metadata are adjacent, but objects restored from a mapped
+      // spill file keep the on-disk layout with the metadata first, so slice
+      // both out of a buffer that starts at whichever section comes first.
+      const ptrdiff_t base_offset = std::min(object->data_offset, object->metadata_offset);
       auto physical_buf = std::make_shared<PlasmaBuffer>(
           shared_from_this(),
           object_ids[i],
           std::make_shared<SharedMemoryBuffer>(
-              data + object->data_offset, object->data_size + object->metadata_size));
+              data + base_offset, object->data_size + object->metadata_size));
 
-      object_buffers[i].data =
-          SharedMemoryBuffer::Slice(physical_buf, 0, object->data_size);
+      object_buffers[i].data = SharedMemoryBuffer::Slice(
+          physical_buf, object->data_offset - base_offset, object->data_size);
       object_buffers[i].metadata = SharedMemoryBuffer::Slice(
-          physical_buf, object->data_size, object->metadata_size);
+          physical_buf, object->metadata_offset - base_offset, object->metadata_size);
       object_buffers[i].device_num = object->device_num;
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
@@ -344,6 +409,10 @@ Status PlasmaClient::GetBuffers(const ObjectID *object_ids,
   for (int64_t i = 0; i < num_objects; i++) {
     RAY_LOG(DEBUG) << "Sending get request " << object_ids[i];
   }
+  // Send any deferred releases first. Otherwise a release of one of the
+  // requested objects could be flushed after this get re-pins it, and the
+  // store would drop our reference while we still use the object.
+  RAY_RETURN_NOT_OK(FlushPendingReleases());
   RAY_RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
   std::vector<uint8_t> buffer;
   RAY_RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
@@ -362,11 +431,26 @@ Status PlasmaClient::GetBuffers(const ObjectID *object_ids,
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
   // having to know the relevant file descriptor received from recv_fd.
+  //
+  // The store only sends the file descriptors we have not mmapped yet (it
+  // tracks what it already sent per client), batched into as few messages as
+  // possible, so compute the same subset here and receive it in one go.
+  std::vector<size_t> missing_fd_indices;
   for (size_t i = 0; i < store_fds.size(); i++) {
-    RAY_LOG(DEBUG) << "GetStoreFdAndMmap " << store_fds[i].first << ", "
+    if (mmap_table_.find(store_fds[i]) == mmap_table_.end()) {
+      missing_fd_indices.push_back(i);
+    }
+  }
+  std::vector<MEMFD_TYPE_NON_UNIQUE> received_fds(missing_fd_indices.size());
+  if (!received_fds.empty()) {
+    RAY_CHECK_OK(store_conn_->RecvFds(&received_fds));
+  }
+  for (size_t k = 0; k < missing_fd_indices.size(); k++) {
+    const size_t i = missing_fd_indices[k];
+    RAY_LOG(DEBUG) << "StoreMmapEntry " << store_fds[i].first << ", "
                    << store_fds[i].second << ", size " << mmap_sizes[i]
                    << " for object id " << received_object_ids[i];
-    GetStoreFdAndMmap(store_fds[i], mmap_sizes[i]);
+    StoreMmapEntry(store_fds[i], received_fds[k], mmap_sizes[i]);
   }
 
   std::unique_ptr<PlasmaObject> object;
@@ -400,18 +484,23 @@ Status PlasmaClient::GetBuffers(const ObjectID *object_ids,
           << "Arrow GPU library is not enabled.";
       uint8_t *data = LookupMmappedFile(object_entry->object.store_fd);
 
-      // Finish filling out the return values.
+      // Finish filling out the return values. As above, start the physical
+      // buffer at whichever of the data and metadata sections comes first.
+      const ptrdiff_t base_offset = std::min(object_entry->object.data_offset,
+                                             object_entry->object.metadata_offset);
       auto physical_buf = std::make_shared<PlasmaBuffer>(
           shared_from_this(),
           object_ids[i],
           std::make_shared<SharedMemoryBuffer>(
-              data + object_entry->object.data_offset,
+              data + base_offset,
               object_entry->object.data_size + object_entry->object.metadata_size));
       object_buffers[i].data =
-          SharedMemoryBuffer::Slice(physical_buf, 0, object_entry->object.data_size);
+          SharedMemoryBuffer::Slice(physical_buf,
+                                    object_entry->object.data_offset - base_offset,
+                                    object_entry->object.data_size);
       object_buffers[i].metadata =
           SharedMemoryBuffer::Slice(physical_buf,
-                                    object_entry->object.data_size,
+                                    object_entry->object.metadata_offset - base_offset,
                                     object_entry->object.metadata_size);
       object_buffers[i].device_num = object_entry->object.device_num;
     } else {
@@ -502,49 +591,82 @@ Status PlasmaClient::Release(const ObjectID &object_id) {
                  << object_entry->second->count;
   RAY_CHECK_GE(object_entry->second->count, 0);
 
-  if (object_entry->second->count == 0) {
-    RAY_LOG(DEBUG) << "Releasing object no longer in use " << object_id;
-    // object_entry is invalidated in MarkObjectUnused, need to read the fd beforehand.
-    // If the fd may be unmapped, we wait for the plasma server to send a ReleaseReply.
-    // Otherwise, skip the reply to boost performance.
-    // Q: since both server and client knows this fd is fallback allocated, why do we
-    //    need to pass it in PlasmaReleaseRequest?
-    // A: because we wanna be idempotent, and in the 2nd call, the server does not know
-    //    about the object.
-    const MEMFD_TYPE fd = object_entry->second->object.store_fd;
-    bool may_unmap = object_entry->second->object.fallback_allocated;
-    // Tell the store that the client no longer needs the object.
+  if (object_entry->second->count > 0) {
+    return Status::OK();
+  }
+
+  const int64_t release_batch_size =
+      RayConfig::instance().plasma_client_release_batch_size();
+  if (release_batch_size > 1 && !object_entry->second->object.fallback_allocated &&
+      deletion_cache_.count(object_id) == 0) {
+    // Defer the release IPC so that a burst of releases (e.g. dropping the
+    // results of a ray.get on a list of small objects) goes to the store as a
+    // single batched message instead of one message per object. Only objects
+    // that never need the unmap handshake are deferred.
     RAY_RETURN_NOT_OK(MarkObjectUnused(object_id));
-    RAY_RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id, may_unmap));
-    if (may_unmap) {
-      // Now, since the object release may unmap the mmap, we wait for a reply.
-      std::vector<uint8_t> buffer;
-      RAY_RETURN_NOT_OK(
-          PlasmaReceive(store_conn_, MessageType::PlasmaReleaseReply, &buffer));
-      ObjectID released_object_id;
-
-      // `should_unmap` is set to true by the plasma server, when the mmap section is
-      // fallback-allocated and is no longer used.
-      bool should_unmap;
-      RAY_RETURN_NOT_OK(ReadReleaseReply(
-          buffer.data(), buffer.size(), &released_object_id, &should_unmap));
-      if (should_unmap) {
-        auto mmap_entry = mmap_table_.find(fd);
-        // Release call is idempotent: if we already released, it's ok.
-        if (mmap_entry != mmap_table_.end()) {
-          mmap_table_.erase(mmap_entry);
-        }
-      }
+    pending_release_batch_.push_back(object_id);
+    if (static_cast<int64_t>(pending_release_batch_.size()) >= release_batch_size) {
+      return FlushPendingReleases();
     }
-    auto iter = deletion_cache_.find(object_id);
-    if (iter != deletion_cache_.end()) {
-      deletion_cache_.erase(object_id);
-      RAY_RETURN_NOT_OK(Delete({object_id}));
+    return Status::OK();
+  }
+  return ReleaseNoLongerUsedObject(object_id);
+}
+
+Status PlasmaClient::ReleaseNoLongerUsedObject(const ObjectID &object_id) {
+  const auto object_entry = objects_in_use_.find(object_id);
+  RAY_CHECK(object_entry != objects_in_use_.end());
+  RAY_LOG(DEBUG) << "Releasing object no longer in use " << object_id;
+  // object_entry is invalidated in MarkObjectUnused, need to read the fd beforehand.
+  // If the fd may be unmapped, we wait for the plasma server to send a ReleaseReply.
+  // Otherwise, skip the reply to boost performance.
+  // Q: since both server and client knows this fd is fallback allocated, why do we
+  //    need to pass it in PlasmaReleaseRequest?
+  // A: because we wanna be idempotent, and in the 2nd call, the server does not know
+  //    about the object.
+  const MEMFD_TYPE fd = object_entry->second->object.store_fd;
+  bool may_unmap = object_entry->second->object.fallback_allocated;
+  // Tell the store that the client no longer needs the object.
+  RAY_RETURN_NOT_OK(MarkObjectUnused(object_id));
+  RAY_RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id, may_unmap));
+  if (may_unmap) {
+    // Now, since the object release may unmap the mmap, we wait for a reply.
+    std::vector<uint8_t> buffer;
+    RAY_RETURN_NOT_OK(
+        PlasmaReceive(store_conn_, MessageType::PlasmaReleaseReply, &buffer));
+    ObjectID released_object_id;
+
+    // `should_unmap` is set to true by the plasma server, when the mmap section is
+    // fallback-allocated and is no longer used.
+    bool should_unmap;
+    RAY_RETURN_NOT_OK(ReadReleaseReply(
+        buffer.data(), buffer.size(), &released_object_id, &should_unmap));
+    if (should_unmap) {
+      auto mmap_entry = mmap_table_.find(fd);
+      // Release call is idempotent: if we already released, it's ok.
+      if (mmap_entry != mmap_table_.end()) {
+        mmap_table_.erase(mmap_entry);
+      }
     }
   }
+  auto iter = deletion_cache_.find(object_id);
+  if (iter != deletion_cache_.end()) {
+    deletion_cache_.erase(object_id);
+    RAY_RETURN_NOT_OK(Delete({object_id}));
+  }
   return Status::OK();
 }
 
+Status PlasmaClient::FlushPendingReleases() {
+  if (pending_release_batch_.empty() || !store_conn_) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> object_ids = std::move(pending_release_batch_);
+  pending_release_batch_.clear();
+  RAY_LOG(DEBUG) << "Flushing " << object_ids.size() << " batched releases";
+  return SendBatchReleaseRequest(store_conn_, object_ids);
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Contains(const ObjectID &object_id, bool *has_object) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -631,6 +753,10 @@ Status PlasmaClient::Abort(const ObjectID &object_id) {
 Status PlasmaClient::Delete(const std::vector<ObjectID> &object_ids) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  // Objects with a deferred release look unused to us but are still
+  // referenced on the store side; flush so the deletes below can succeed.
+  RAY_RETURN_NOT_OK(FlushPendingReleases());
+
   std::vector<ObjectID> not_in_use_ids;
   for (auto &object_id : object_ids) {
     // If the object is in used, skip it.
@@ -213,6 +213,36 @@ class PlasmaClientInterface {
                                       plasma::flatbuf::ObjectSource source,
                                       int device_num = 0) = 0;
 
+  /// Create and seal a batch of small objects in a single message exchange.
+  /// The payloads are sent inline and copied into shared memory by the store,
+  /// which seals each object; the objects do not need to be released or sealed
+  /// by the caller. Entries at index i of object_ids, data and metadata
+  /// describe one object.
+  ///
+  /// \param object_ids The IDs of the objects to create.
+  /// \param owner_address The address of the objects' owner.
+  /// \param data The data payload for each object.
+  /// \param metadata The metadata payload for each object.
+  /// \param source The source of the objects.
+  /// \param errors The per-object creation result, in request order.
+  virtual Status CreateAndSealBatch(const std::vector<ObjectID> &object_ids,
+                                    const ray::rpc::Address &owner_address,
+                                    const std::vector<std::string> &data,
+                                    const std::vector<std::string> &metadata,
+                                    plasma::flatbuf::ObjectSource source,
+                                    std::vector<plasma::flatbuf::PlasmaError> *errors) = 0;
+
+  /// Ask the store to restore a spilled object by memory-mapping its spill
+  /// file record, so subsequent Gets are served from the file-backed mapping.
+  /// Returns OK if the object was restored or is already present in the
+  /// store, and NotFound if the spill URL could not be mapped.
+  ///
+  /// \param object_id The ID of the object to restore.
+  /// \param spilled_url The object's local filesystem spill URL
+  ///        ("{path}?offset={offset}&size={size}").
+  virtual Status RestoreSpilledObject(const ObjectID &object_id,
+                                      const std::string &spilled_url) = 0;
+
   /// Delete a list of objects from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -258,6 +288,16 @@ class PlasmaClient : public std::enable_shared_from_this<PlasmaClient>,
                               plasma::flatbuf::ObjectSource source,
                               int device_num = 0) override;
 
+  Status CreateAndSealBatch(const std::vector<ObjectID> &object_ids,
+                            const ray::rpc::Address &owner_address,
+                            const std::vector<std::string> &data,
+                            const std::vector<std::string> &metadata,
+                            plasma::flatbuf::ObjectSource source,
+                            std::vector<plasma::flatbuf::PlasmaError> *errors) override;
+
+  Status RestoreSpilledObject(const ObjectID &object_id,
+                              const std::string &spilled_url) override;
+
   Status Get(const std::vector<ObjectID> &object_ids,
              int64_t timeout_ms,
              std::vector<ObjectBuffer> *object_buffers) override;
@@ -297,12 +337,25 @@ class PlasmaClient : public std::enable_shared_from_this<PlasmaClient>,
   /// \return The pointer corresponding to store_fd.
   uint8_t *GetStoreFdAndMmap(MEMFD_TYPE store_fd, int64_t map_size);
 
+  uint8_t *StoreMmapEntry(MEMFD_TYPE store_fd,
+                          MEMFD_TYPE_NON_UNIQUE received_fd,
+                          int64_t map_size);
+
   /// This is a helper method for marking an object as unused by this client.
   ///
   /// \param object_id The object ID we mark unused.
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID &object_id);
 
+  /// Sends the release IPC for an object whose in-use count just reached
+  /// zero, including the unmap handshake for fallback-allocated objects and
+  /// any cached deletion. Must be called with client_mutex_ held.
+  Status ReleaseNoLongerUsedObject(const ObjectID &object_id);
+
+  /// Sends all deferred releases to the store as one batched release
+  /// message. Must be called with client_mutex_ held.
+  Status FlushPendingReleases();
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID *object_ids,
                     int64_t num_objects,
@@ -355,6 +408,12 @@ class PlasmaClient : public std::enable_shared_from_this<PlasmaClient>,
 
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// Objects that are no longer in use by this client but whose release has
+  /// not been sent to the store yet. Only populated when
+  /// plasma_client_release_batch_size > 1; flushed once it reaches the batch
+  /// size and before any create, get or delete request so the store can
+  /// reclaim the memory when it needs space.
+  std::vector<ObjectID> pending_release_batch_;
   /// A mutex which protects this class.
   std::recursive_mutex client_mutex_;
   /// Whether the current process should exit when read or write to the connection fails.
@@ -103,9 +103,18 @@ struct Allocation {
 
   friend class PlasmaAllocator;
   friend class DummyAllocator;
+  friend class SizeClassAllocator;
+  friend class SpillFileMapper;
+  // The object stores reset an entry's allocation to the empty state while
+  // the object is being relocated during compaction.
+  friend class ObjectStore;
+  friend class ShardedObjectStore;
   friend struct ObjectLifecycleManagerTest;
   FRIEND_TEST(ObjectStoreTest, PassThroughTest);
+  FRIEND_TEST(ObjectStoreTest, DedupAliasTest);
+  FRIEND_TEST(ShardedObjectStoreTest, CrossShardOperations);
   FRIEND_TEST(EvictionPolicyTest, Test);
+  FRIEND_TEST(CostAwareEvictionPolicyTest, Test);
   friend struct GetRequestQueueTest;
 };
 
@@ -145,7 +154,11 @@ class LocalObject {
     object->store_fd = GetAllocation().fd_;
     object->header_offset = GetAllocation().offset_;
     object->data_offset = GetAllocation().offset_;
-    object->metadata_offset = GetAllocation().offset_ + GetObjectInfo().data_size;
+    // Objects served from a mapped spill file keep the on-disk record layout,
+    // which places the metadata immediately before the data.
+    object->metadata_offset = metadata_precedes_data_
+                                  ? GetAllocation().offset_ - GetObjectInfo().metadata_size
+                                  : GetAllocation().offset_ + GetObjectInfo().data_size;
     if (object_info_.is_mutable) {
       object->data_offset += sizeof(ray::PlasmaObjectHeader);
       object->metadata_offset += sizeof(ray::PlasmaObjectHeader);
@@ -164,12 +177,15 @@ class LocalObject {
 
  private:
   friend class ObjectStore;
+  friend class ShardedObjectStore;
   friend class ObjectLifecycleManager;
   FRIEND_TEST(ObjectStoreTest, PassThroughTest);
+  FRIEND_TEST(ShardedObjectStoreTest, CrossShardOperations);
   friend struct ObjectLifecycleManagerTest;
   FRIEND_TEST(ObjectLifecycleManagerTest, RemoveReferenceOneRefNotSealed);
   friend struct ObjectStatsCollectorTest;
   FRIEND_TEST(EvictionPolicyTest, Test);
+  FRIEND_TEST(CostAwareEvictionPolicyTest, Test);
   friend struct GetRequestQueueTest;
 
   /// Allocation Info;
@@ -187,5 +203,8 @@ class LocalObject {
   ObjectState state_;
   /// The source of the object. Used for debugging purposes.
   plasma::flatbuf::ObjectSource source_;
+  /// True for objects restored from a mapped spill file, where the record
+  /// layout places the metadata before the data instead of after it.
+  bool metadata_precedes_data_ = false;
 };
 }  // namespace plasma
@@ -17,6 +17,7 @@
 #ifndef _WIN32
 #include "ray/object_manager/plasma/fling.h"
 #endif
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -171,6 +172,47 @@ Status Client::SendFd(MEMFD_TYPE fd) {
   return Status::OK();
 }
 
+Status Client::SendFds(const std::vector<MEMFD_TYPE> &fds) {
+#ifdef _WIN32
+  // Windows handles are duplicated one at a time.
+  for (const auto &fd : fds) {
+    RAY_RETURN_NOT_OK(SendFd(fd));
+  }
+  return Status::OK();
+#else
+  // Only send the file descriptors that haven't been sent yet; the client
+  // computes the same subset from its mmap table (see GetStoreFdAndMmap in
+  // client.cc) so both sides agree on the batch.
+  std::vector<MEMFD_TYPE> to_send;
+  to_send.reserve(fds.size());
+  for (const auto &fd : fds) {
+    if (used_fds_.find(fd) == used_fds_.end()) {
+      to_send.push_back(fd);
+    }
+  }
+  for (size_t start = 0; start < to_send.size(); start += kMaxFdsPerControlMessage) {
+    const size_t count = std::min(kMaxFdsPerControlMessage, to_send.size() - start);
+    std::vector<int> raw_fds;
+    raw_fds.reserve(count);
+    for (size_t i = start; i < start + count; i++) {
+      raw_fds.push_back(to_send[i].first);
+    }
+    auto ec = send_fds(GetNativeHandle(), raw_fds.data(), raw_fds.size());
+    if (ec <= 0) {
+      if (ec == 0) {
+        return Status::IOError("Encountered unexpected EOF");
+      } else {
+        return Status::IOError("Unknown I/O Error");
+      }
+    }
+    for (size_t i = start; i < start + count; i++) {
+      used_fds_.insert(to_send[i]);  // Succeed, record the fds.
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 StoreConn::StoreConn(ray::local_stream_socket &&socket)
     : ray::ServerConnection(std::move(socket)), exit_on_connection_failure_(false) {}
 
@@ -198,6 +240,22 @@ Status StoreConn::RecvFd(MEMFD_TYPE_NON_UNIQUE *fd) {
   return Status::OK();
 }
 
+Status StoreConn::RecvFds(std::vector<MEMFD_TYPE_NON_UNIQUE> *fds) {
+#ifdef _WIN32
+  for (auto &fd : *fds) {
+    RAY_RETURN_NOT_OK(RecvFd(&fd));
+  }
+#else
+  for (size_t start = 0; start < fds->size(); start += kMaxFdsPerControlMessage) {
+    const size_t count = std::min(kMaxFdsPerControlMessage, fds->size() - start);
+    if (recv_fds(GetNativeHandle(), fds->data() + start, count) < 0) {
+      return Status::IOError("Failed to receive the fds.");
+    }
+  }
+#endif
+  return Status::OK();
+}
+
 ray::Status StoreConn::WriteBuffer(const std::vector<boost::asio::const_buffer> &buffer) {
   auto status = ray::ServerConnection::WriteBuffer(buffer);
   ExitIfErrorStatus(status);
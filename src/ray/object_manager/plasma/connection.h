@@ -44,6 +44,7 @@ class ClientInterface {
   virtual ~ClientInterface() = default;
 
   virtual ray::Status SendFd(MEMFD_TYPE fd) = 0;
+  virtual ray::Status SendFds(const std::vector<MEMFD_TYPE> &fds) = 0;
   virtual const std::unordered_set<ray::ObjectID> &GetObjectIDs() = 0;
   virtual void MarkObjectAsUsed(const ray::ObjectID &object_id,
                                 std::optional<MEMFD_TYPE> fallback_allocated_fd) = 0;
@@ -72,6 +73,11 @@ class Client : public ray::ClientConnection, public ClientInterface {
 
   ray::Status SendFd(MEMFD_TYPE fd) override;
 
+  /// Send the file descriptors the client has not received yet, batched into
+  /// as few SCM_RIGHTS control messages as possible. The client must compute
+  /// the same batch from its mmap table and receive it with RecvFds.
+  ray::Status SendFds(const std::vector<MEMFD_TYPE> &fds) override;
+
   const std::unordered_set<ray::ObjectID> &GetObjectIDs() override { return object_ids; }
 
   // Holds the object ID. If the object ID has a fallback-allocated fd, adds the ref count
@@ -171,6 +177,10 @@ class StoreConn : public ray::ServerConnection {
   /// \return A file descriptor.
   ray::Status RecvFd(MEMFD_TYPE_NON_UNIQUE *fd);
 
+  /// Receive a batch of file descriptors sent with Client::SendFds. fds must
+  /// be pre-sized to the number of descriptors the store is sending.
+  ray::Status RecvFds(std::vector<MEMFD_TYPE_NON_UNIQUE> *fds);
+
   ray::Status WriteBuffer(const std::vector<boost::asio::const_buffer> &buffer) override;
 
   ray::Status ReadBuffer(const std::vector<boost::asio::mutable_buffer> &buffer) override;
@@ -14,6 +14,7 @@
 
 #include "ray/object_manager/plasma/create_request_queue.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <list>
 #include <memory>
@@ -21,6 +22,7 @@
 #include <utility>
 
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
 #include "ray/object_manager/plasma/common.h"
 
 namespace plasma {
@@ -34,6 +36,9 @@ uint64_t CreateRequestQueue::AddRequest(const ObjectID &object_id,
   queue_.emplace_back(std::make_unique<CreateRequest>(
       object_id, req_id, client, create_callback, object_size));
   num_bytes_pending_ += object_size;
+  if (num_requests_per_client_[client.get()]++ == 0) {
+    fair_ring_.push_back(client.get());
+  }
   return req_id;
 }
 
@@ -82,11 +87,71 @@ Status CreateRequestQueue::ProcessRequest(bool fallback_allocator,
   }
 }
 
+std::list<std::unique_ptr<CreateRequestQueue::CreateRequest>>::iterator
+CreateRequestQueue::FirstRequestOfClient(const ClientInterface *client) {
+  auto request_it = queue_.begin();
+  while (request_it != queue_.end() && (*request_it)->client_.get() != client) {
+    request_it++;
+  }
+  RAY_CHECK(request_it != queue_.end());
+  return request_it;
+}
+
+std::list<std::unique_ptr<CreateRequestQueue::CreateRequest>>::iterator
+CreateRequestQueue::SelectNextRequest() {
+  if (!RayConfig::instance().plasma_fair_creation_admission_enabled() ||
+      fair_ring_.size() <= 1) {
+    return queue_.begin();
+  }
+  const int64_t quantum = RayConfig::instance().plasma_fair_creation_quantum_bytes();
+  for (size_t i = 0; i < fair_ring_.size(); i++) {
+    const auto *client = fair_ring_.front();
+    auto request_it = FirstRequestOfClient(client);
+    auto &deficit = deficit_bytes_[client];
+    if (deficit < static_cast<int64_t>((*request_it)->object_size_)) {
+      deficit += quantum;
+    }
+    if (deficit >= static_cast<int64_t>((*request_it)->object_size_)) {
+      return request_it;
+    }
+    // The client is over its budget for now; let the next one go first.
+    fair_ring_.splice(fair_ring_.end(), fair_ring_, fair_ring_.begin());
+  }
+  // Every client's next request still exceeds its accumulated budget (they
+  // are all larger than the quantum). Serve the front client's request to
+  // guarantee progress; its budget has already been bumped above.
+  return FirstRequestOfClient(fair_ring_.front());
+}
+
+void CreateRequestQueue::SpendDeficit(const ClientInterface *client,
+                                      size_t object_size) {
+  auto it = deficit_bytes_.find(client);
+  if (it != deficit_bytes_.end()) {
+    it->second = std::max<int64_t>(0, it->second - static_cast<int64_t>(object_size));
+  }
+}
+
+void CreateRequestQueue::ServeOtherServiceableRequests(
+    const ClientInterface *blocked_client) {
+  if (!RayConfig::instance().plasma_fair_creation_admission_enabled()) {
+    return;
+  }
+  for (auto it = queue_.begin(); it != queue_.end();) {
+    auto next_it = std::next(it);
+    if ((*it)->client_.get() != blocked_client &&
+        ProcessRequest(/*fallback_allocator=*/false, *it).ok()) {
+      SpendDeficit((*it)->client_.get(), (*it)->object_size_);
+      FinishRequest(it);
+    }
+    it = next_it;
+  }
+}
+
 Status CreateRequestQueue::ProcessRequests() {
   // Suppress OOM dump to once per grace period.
   bool logged_oom = false;
   while (!queue_.empty()) {
-    auto request_it = queue_.begin();
+    auto request_it = SelectNextRequest();
     auto status = ProcessRequest(/*fallback_allocator=*/false, *request_it);
 
     // if allocation failed due to OOM, and fs_monitor_ indicates the local disk is full,
@@ -102,6 +167,7 @@ Status CreateRequestQueue::ProcessRequests() {
 
     auto now = get_time_();
     if (status.ok()) {
+      SpendDeficit((*request_it)->client_.get(), (*request_it)->object_size_);
       FinishRequest(request_it);
       // Reset the oom start time since the creation succeeds.
       oom_start_time_ns_ = -1;
@@ -118,6 +184,7 @@ Status CreateRequestQueue::ProcessRequests() {
       if (spill_pending) {
         RAY_LOG(DEBUG) << "Reset grace period " << status << " " << spill_pending;
         oom_start_time_ns_ = -1;
+        ServeOtherServiceableRequests((*request_it)->client_.get());
         return Status::TransientObjectStoreFull("Waiting for objects to spill.");
       }
       if (now - oom_start_time_ns_ < grace_period_ns) {
@@ -125,6 +192,7 @@ Status CreateRequestQueue::ProcessRequests() {
         // kick in, and (2) there is a race between spilling finishing and space
         // actually freeing up in the object store.
         RAY_LOG(DEBUG) << "In grace period before fallback allocation / oom.";
+        ServeOtherServiceableRequests((*request_it)->client_.get());
         return Status::ObjectStoreFull("Waiting for grace period.");
       }
       // Trigger the fallback allocator.
@@ -143,6 +211,7 @@ Status CreateRequestQueue::ProcessRequests() {
                       << (*request_it)->object_size_ / 1024 / 1024 << "MB\n"
                       << dump;
       }
+      SpendDeficit((*request_it)->client_.get(), (*request_it)->object_size_);
       FinishRequest(request_it);
     }
   }
@@ -150,6 +219,16 @@ Status CreateRequestQueue::ProcessRequests() {
   return Status::OK();
 }
 
+void CreateRequestQueue::OnRequestDequeued(const ClientInterface *client) {
+  auto it = num_requests_per_client_.find(client);
+  RAY_CHECK(it != num_requests_per_client_.end());
+  if (--it->second == 0) {
+    num_requests_per_client_.erase(it);
+    deficit_bytes_.erase(client);
+    fair_ring_.remove(client);
+  }
+}
+
 void CreateRequestQueue::FinishRequest(
     std::list<std::unique_ptr<CreateRequest>>::iterator request_it) {
   // Fulfill the request.
@@ -160,6 +239,7 @@ void CreateRequestQueue::FinishRequest(
   it->second = std::move(request);
   RAY_CHECK(num_bytes_pending_ >= it->second->object_size_);
   num_bytes_pending_ -= it->second->object_size_;
+  OnRequestDequeued(it->second->client_.get());
   queue_.erase(request_it);
 }
 
@@ -170,6 +250,7 @@ void CreateRequestQueue::RemoveDisconnectedClientRequests(
       fulfilled_requests_.erase((*it)->request_id_);
       RAY_CHECK(num_bytes_pending_ >= (*it)->object_size_);
       num_bytes_pending_ -= (*it)->object_size_;
+      OnRequestDequeued((*it)->client_.get());
       it = queue_.erase(it);
     } else {
       it++;
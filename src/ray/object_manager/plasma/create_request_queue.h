@@ -159,6 +159,32 @@ class CreateRequestQueue {
   /// finished.
   Status ProcessRequest(bool fallback_allocator, std::unique_ptr<CreateRequest> &request);
 
+  /// Pick the queued request to try to serve next. With FIFO admission this
+  /// is the head of the queue. With fair admission
+  /// (plasma_fair_creation_admission_enabled), clients take turns and each
+  /// turn adds plasma_fair_creation_quantum_bytes to the client's byte
+  /// budget, so one client's burst of large creations cannot monopolize
+  /// admission.
+  std::list<std::unique_ptr<CreateRequest>>::iterator SelectNextRequest();
+
+  /// The earliest queued request made by the given client. The client must
+  /// have at least one queued request.
+  std::list<std::unique_ptr<CreateRequest>>::iterator FirstRequestOfClient(
+      const ClientInterface *client);
+
+  /// Charge a served request's size against its client's admission budget.
+  void SpendDeficit(const ClientInterface *client, size_t object_size);
+
+  /// While the selected request waits for spilling or the OOM grace period,
+  /// serve other clients' queued requests that already fit in memory, so a
+  /// single large creation does not block unrelated small ones. Only active
+  /// with fair admission.
+  void ServeOtherServiceableRequests(const ClientInterface *blocked_client);
+
+  /// Drop a dequeued request from the per-client bookkeeping, removing the
+  /// client from the round-robin ring if this was its last queued request.
+  void OnRequestDequeued(const ClientInterface *client);
+
   /// Finish a queued request and remove it from the queue.
   void FinishRequest(std::list<std::unique_ptr<CreateRequest>>::iterator request_it);
 
@@ -214,6 +240,19 @@ class CreateRequestQueue {
 
   size_t num_bytes_pending_ = 0;
 
+  /// Number of queued requests per client, used to keep fair_ring_ in sync
+  /// with queue_.
+  absl::flat_hash_map<const ClientInterface *, size_t> num_requests_per_client_;
+
+  /// Round-robin ring of clients that have queued requests. The front client
+  /// is considered first by SelectNextRequest.
+  std::list<const ClientInterface *> fair_ring_;
+
+  /// Unspent admission budget per client in the ring, in bytes. Grows by the
+  /// configured quantum each time the client is considered and shrinks by the
+  /// object size each time one of its requests is served.
+  absl::flat_hash_map<const ClientInterface *, int64_t> deficit_bytes_;
+
   friend class CreateRequestQueueTest;
 };
 
@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ray/object_manager/plasma/deferred_free_allocator.h"
+
+#include <utility>
+#include <vector>
+
+#include "ray/util/logging.h"
+#include "ray/util/thread_utils.h"
+
+namespace plasma {
+
+DeferredFreeAllocator::DeferredFreeAllocator(IAllocator &base, int64_t min_defer_bytes)
+    : base_(base), min_defer_bytes_(min_defer_bytes) {
+  RAY_CHECK_GT(min_defer_bytes_, 0);
+  reclaim_thread_ = std::thread(&DeferredFreeAllocator::ReclaimLoop, this);
+}
+
+DeferredFreeAllocator::~DeferredFreeAllocator() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+  }
+  reclaim_thread_.join();
+  // The reclamation thread drained whatever was queued before it observed
+  // stopped_; anything enqueued after that is freed here.
+  FlushDeferredFrees();
+}
+
+std::optional<Allocation> DeferredFreeAllocator::Allocate(size_t bytes) {
+  {
+    absl::MutexLock lock(&base_mutex_);
+    auto allocation = base_.Allocate(bytes);
+    if (allocation.has_value()) {
+      return allocation;
+    }
+  }
+  // The base allocator may only be out of space because frees are still
+  // pending reclamation; drain them and retry once.
+  if (!FlushDeferredFrees()) {
+    return std::nullopt;
+  }
+  absl::MutexLock lock(&base_mutex_);
+  return base_.Allocate(bytes);
+}
+
+std::optional<Allocation> DeferredFreeAllocator::FallbackAllocate(size_t bytes) {
+  {
+    absl::MutexLock lock(&base_mutex_);
+    auto allocation = base_.FallbackAllocate(bytes);
+    if (allocation.has_value()) {
+      return allocation;
+    }
+  }
+  if (!FlushDeferredFrees()) {
+    return std::nullopt;
+  }
+  absl::MutexLock lock(&base_mutex_);
+  return base_.FallbackAllocate(bytes);
+}
+
+void DeferredFreeAllocator::Free(Allocation allocation) {
+  if (allocation.size_ < min_defer_bytes_) {
+    absl::MutexLock lock(&base_mutex_);
+    base_.Free(std::move(allocation));
+    return;
+  }
+  absl::MutexLock lock(&mutex_);
+  deferred_bytes_ += allocation.size_;
+  if (allocation.fallback_allocated_) {
+    deferred_fallback_bytes_ += allocation.size_;
+  }
+  deferred_.push_back(std::move(allocation));
+}
+
+int64_t DeferredFreeAllocator::GetFootprintLimit() const {
+  return base_.GetFootprintLimit();
+}
+
+int64_t DeferredFreeAllocator::Allocated() const {
+  // base_mutex_ orders the read of the base counter against the reclamation
+  // thread's concurrent base_.Free() calls. Taking it before mutex_ is
+  // deadlock free: the two locks are never held together elsewhere.
+  absl::MutexLock base_lock(&base_mutex_);
+  absl::MutexLock lock(&mutex_);
+  return base_.Allocated() - deferred_bytes_;
+}
+
+int64_t DeferredFreeAllocator::FallbackAllocated() const {
+  absl::MutexLock base_lock(&base_mutex_);
+  absl::MutexLock lock(&mutex_);
+  return base_.FallbackAllocated() - deferred_fallback_bytes_;
+}
+
+bool DeferredFreeAllocator::FlushDeferredFrees() {
+  std::vector<Allocation> batch;
+  {
+    absl::MutexLock lock(&mutex_);
+    batch.swap(deferred_);
+  }
+  if (batch.empty()) {
+    return false;
+  }
+  FreeBatch(std::move(batch));
+  return true;
+}
+
+bool DeferredFreeAllocator::ReclaimReady() const {
+  return stopped_ || !deferred_.empty();
+}
+
+void DeferredFreeAllocator::ReclaimLoop() {
+  SetThreadName("plasma.reclaim");
+  while (true) {
+    std::vector<Allocation> batch;
+    {
+      absl::MutexLock lock(&mutex_);
+      mutex_.Await(absl::Condition(this, &DeferredFreeAllocator::ReclaimReady));
+      if (stopped_) {
+        return;
+      }
+      batch.swap(deferred_);
+    }
+    FreeBatch(std::move(batch));
+  }
+}
+
+void DeferredFreeAllocator::FreeBatch(std::vector<Allocation> batch) {
+  for (auto &allocation : batch) {
+    const int64_t size = allocation.size_;
+    const bool fallback_allocated = allocation.fallback_allocated_;
+    {
+      // Free one allocation at a time so allocations on the store thread can
+      // interleave with a large batch.
+      absl::MutexLock base_lock(&base_mutex_);
+      base_.Free(std::move(allocation));
+    }
+    absl::MutexLock lock(&mutex_);
+    deferred_bytes_ -= size;
+    if (fallback_allocated) {
+      deferred_fallback_bytes_ -= size;
+    }
+  }
+}
+
+}  // namespace plasma
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "ray/object_manager/plasma/allocator.h"
+#include "ray/object_manager/plasma/common.h"
+
+namespace plasma {
+
+// DeferredFreeAllocator moves expensive deallocations off the store thread.
+// Freeing a multi-gigabyte object makes dlmalloc walk and coalesce the freed
+// range synchronously, stalling every queued client request. Frees of at
+// least min_defer_bytes are instead pushed onto a deferred list that a
+// background reclamation thread drains in batches, so DeleteObject only
+// unlinks metadata on the hot path. Smaller frees are performed inline since
+// their coalescing cost is negligible.
+//
+// Allocated()/FallbackAllocated() subtract the bytes pending reclamation so
+// eviction and capacity accounting see the logical usage. If the base
+// allocator rejects an allocation while frees are pending, the pending frees
+// are drained synchronously and the allocation is retried once, so deferral
+// never turns into a spurious out-of-memory error.
+//
+// Unlike the base allocator, this class may be used from multiple threads;
+// all base allocator calls are serialized internally.
+class DeferredFreeAllocator : public IAllocator {
+ public:
+  /// \param base The allocator that actually owns the memory.
+  /// \param min_defer_bytes Frees of at least this many bytes are handed to
+  /// the background reclamation thread; smaller frees happen inline.
+  DeferredFreeAllocator(IAllocator &base, int64_t min_defer_bytes);
+
+  ~DeferredFreeAllocator() override;
+
+  std::optional<Allocation> Allocate(size_t bytes) override;
+
+  std::optional<Allocation> FallbackAllocate(size_t bytes) override;
+
+  void Free(Allocation allocation) override;
+
+  int64_t GetFootprintLimit() const override;
+
+  int64_t Allocated() const override;
+
+  int64_t FallbackAllocated() const override;
+
+  /// Synchronously free everything on the deferred list. Returns true if any
+  /// memory was reclaimed.
+  bool FlushDeferredFrees();
+
+ private:
+  /// Main loop of the reclamation thread. Swaps the deferred list out under
+  /// the lock and frees each allocation with the lock released, so producers
+  /// are never blocked behind a batch.
+  void ReclaimLoop();
+
+  bool ReclaimReady() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Frees a batch through the base allocator and updates the pending-bytes
+  /// counters.
+  void FreeBatch(std::vector<Allocation> batch);
+
+  IAllocator &base_;
+
+  /// Frees below this many bytes are performed inline.
+  const int64_t min_defer_bytes_;
+
+  /// Serializes all calls into base_, which is not thread safe.
+  mutable absl::Mutex base_mutex_;
+
+  /// Guards the deferred list and the pending-bytes counters.
+  mutable absl::Mutex mutex_;
+
+  /// Allocations waiting to be returned to the base allocator.
+  std::vector<Allocation> deferred_ ABSL_GUARDED_BY(mutex_);
+
+  /// Bytes on the deferred list, total and fallback-allocated.
+  int64_t deferred_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t deferred_fallback_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+
+  std::thread reclaim_thread_;
+};
+
+}  // namespace plasma
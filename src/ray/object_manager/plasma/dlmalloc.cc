@@ -24,6 +24,7 @@
 #define _GNU_SOURCE /* Turns on fallocate() definition */
 #endif              /* _GNU_SOURCE */
 #include <fcntl.h>
+#include <sys/syscall.h>
 #endif /* __linux__ */
 
 #include <stddef.h>
@@ -36,10 +37,15 @@
 #include <unistd.h>
 #endif
 #include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "ray/common/ray_config.h"
+#include "ray/object_manager/plasma/fallback_file_pool.h"
 #include "ray/object_manager/plasma/plasma.h"
 
 namespace plasma {
@@ -79,6 +85,23 @@ int fake_munmap(void *, int64_t);
 #define MAP_POPULATE 0
 #endif
 
+#ifdef __linux__
+// memfd_create() hugetlb flags are missing from older glibc headers; the
+// kernel has supported them since 4.14.
+#ifndef MFD_HUGETLB
+#define MFD_HUGETLB 0x0004U
+#endif
+#ifndef MFD_HUGE_SHIFT
+#define MFD_HUGE_SHIFT 26
+#endif
+#ifndef MFD_HUGE_2MB
+#define MFD_HUGE_2MB (21U << MFD_HUGE_SHIFT)
+#endif
+#ifndef MFD_HUGE_1GB
+#define MFD_HUGE_1GB (30U << MFD_HUGE_SHIFT)
+#endif
+#endif /* __linux__ */
+
 constexpr int GRANULARITY_MULTIPLIER = 2;
 
 namespace {
@@ -114,6 +137,11 @@ struct DLMallocConfig {
 };
 
 DLMallocConfig dlmalloc_config;
+
+// Pool of pre-created fallback-mmap files, created in SetDLMallocConfig when
+// plasma_fallback_file_pool_enabled is set. nullptr when disabled; fallback
+// files are then created synchronously on the store thread.
+std::unique_ptr<FallbackFilePool> fallback_file_pool;
 }  // namespace
 
 #ifdef _WIN32
@@ -137,43 +165,226 @@ void create_and_mmap_buffer(int64_t size, void **pointer, HANDLE *handle) {
   }
 }
 #else
+
+#ifdef __linux__
+// Try to create a hugetlb-backed memfd for the main plasma arena. Unlike the
+// hugepage_enabled mode, this does not require a hugetlbfs mount point: the
+// kernel backs the fd with 2MB (or 1GB) pages directly. Returns -1 if huge
+// pages of the requested size are unavailable, in which case the caller falls
+// back to the regular 4K-page file.
+int try_create_hugetlb_memfd(int64_t size, uint64_t hugepage_size_mb) {
+  unsigned int flags = MFD_CLOEXEC | MFD_HUGETLB;
+  flags |= (hugepage_size_mb >= 1024) ? MFD_HUGE_1GB : MFD_HUGE_2MB;
+  int fd = memfd_create("plasma_hugepage", flags);
+  if (fd < 0) {
+    RAY_LOG(WARNING) << "memfd_create(MFD_HUGETLB) failed ("
+                     << std::strerror(errno) << "), falling back to 4K pages. "
+                     << "Check /proc/sys/vm/nr_hugepages.";
+    return -1;
+  }
+  if (ftruncate(fd, (off_t)size) != 0) {
+    RAY_LOG(WARNING) << "ftruncate on hugetlb memfd failed ("
+                     << std::strerror(errno)
+                     << "), falling back to 4K pages. Not enough huge pages "
+                        "are reserved for an object store of this size.";
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// set_mempolicy(2) and mbind(2) have no glibc wrappers without libnuma, so
+// they are invoked through syscall() to avoid growing a libnuma dependency.
+constexpr int kMpolDefault = 0;
+constexpr int kMpolInterleave = 3;
+constexpr unsigned long kMaxNumaNodes = 64;
+
+// Mask of the online NUMA nodes, parsed from sysfs ("0", "0-1", "0,2-3").
+// Returns 0 if it cannot be determined or a node id doesn't fit the mask.
+unsigned long OnlineNumaNodeMask() {
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string node_list;
+  if (!online || !std::getline(online, node_list)) {
+    return 0;
+  }
+  unsigned long mask = 0;
+  size_t pos = 0;
+  while (pos < node_list.size()) {
+    char *end = nullptr;
+    long first = std::strtol(node_list.c_str() + pos, &end, 10);
+    long last = first;
+    if (*end == '-') {
+      last = std::strtol(end + 1, &end, 10);
+    }
+    if (first < 0 || last < first || last >= static_cast<long>(kMaxNumaNodes)) {
+      return 0;
+    }
+    for (long node = first; node <= last; node++) {
+      mask |= 1UL << node;
+    }
+    pos = end - node_list.c_str();
+    if (pos < node_list.size() && node_list[pos] == ',') {
+      pos++;
+    } else {
+      break;
+    }
+  }
+  return mask;
+}
+
+/// Interleaves page placement across NUMA nodes for memory faulted while the
+/// guard is alive, which covers MAP_POPULATE pre-faulting inside mmap. A
+/// no-op unless plasma_numa_interleave_enabled is set and the machine has
+/// more than one online node.
+class ScopedNumaInterleave {
+ public:
+  ScopedNumaInterleave() {
+    if (!RayConfig::instance().plasma_numa_interleave_enabled()) {
+      return;
+    }
+    nodemask_ = OnlineNumaNodeMask();
+    if (__builtin_popcountl(nodemask_) < 2) {
+      return;
+    }
+    if (syscall(SYS_set_mempolicy, kMpolInterleave, &nodemask_, kMaxNumaNodes) == 0) {
+      applied_ = true;
+    } else {
+      RAY_LOG(WARNING) << "set_mempolicy(MPOL_INTERLEAVE) failed ("
+                       << std::strerror(errno)
+                       << "), plasma arena pages will not be interleaved.";
+    }
+  }
+
+  ~ScopedNumaInterleave() {
+    if (applied_) {
+      syscall(SYS_set_mempolicy, kMpolDefault, nullptr, 0);
+    }
+  }
+
+  ScopedNumaInterleave(const ScopedNumaInterleave &) = delete;
+  ScopedNumaInterleave &operator=(const ScopedNumaInterleave &) = delete;
+
+  /// Record the interleave policy on the mapped region itself, so pages
+  /// faulted lazily later (when pre-faulting is off) follow it no matter
+  /// which thread touches them first.
+  void ApplyToRegion(void *addr, size_t length) const {
+    if (!applied_ || addr == MAP_FAILED) {
+      return;
+    }
+    if (syscall(SYS_mbind, addr, length, kMpolInterleave, &nodemask_, kMaxNumaNodes, 0) !=
+        0) {
+      RAY_LOG(WARNING) << "mbind(MPOL_INTERLEAVE) failed (" << std::strerror(errno)
+                       << "), lazily faulted plasma pages will not be interleaved.";
+    } else {
+      RAY_LOG(INFO) << "Plasma arena pages interleaved across NUMA node mask 0x"
+                    << std::hex << nodemask_ << std::dec << ".";
+    }
+  }
+
+ private:
+  unsigned long nodemask_ = 0;
+  bool applied_ = false;
+};
+#endif /* __linux__ */
+
 void create_and_mmap_buffer(int64_t size, void **pointer, int *fd) {
-  // Create a buffer. This is creating a temporary file and then
-  // immediately unlinking it so we do not leave traces in the system.
-  std::string file_template = dlmalloc_config.directory;
-
-  // In never-OOM mode, fallback to allocating from the filesystem. Note that these
-  // allocations will be run with dlmallopt(M_MMAP_THRESHOLD, 0) set by
-  // plasma_allocator.cc.
-  if (allocated_once && dlmalloc_config.fallback_enabled) {
-    file_template = dlmalloc_config.fallback_directory;
+  const bool is_fallback_allocation =
+      allocated_once && dlmalloc_config.fallback_enabled;
+
+#ifdef __linux__
+  // Interleave the main arena's pages across NUMA nodes while it is mapped
+  // (and possibly pre-faulted). See plasma_numa_interleave_enabled. Fallback
+  // allocations are filesystem-backed and left alone.
+  std::optional<ScopedNumaInterleave> numa_interleave;
+  if (!is_fallback_allocation) {
+    numa_interleave.emplace();
   }
 
-  file_template += "/plasmaXXXXXX";
-  RAY_LOG(INFO) << "create_and_mmap_buffer(" << size << ", " << file_template << ")";
-  std::vector<char> file_name(file_template.begin(), file_template.end());
-  file_name.push_back('\0');
-  // O_CLOEXEC will ensure the fd for plasma store memory backed by shm or fallback
-  // is closed when the process is forked. The core and IO worker processes are
-  // are forked from raylet which can cause memory leaks.
-  *fd = mkostemp(&file_name[0], O_CLOEXEC);
-  if (*fd < 0) {
-    RAY_LOG(FATAL) << "create_buffer failed to open file " << &file_name[0] << ", error"
-                   << std::strerror(errno);
+  // Hugepage arena mode: back the main arena with explicit huge pages and
+  // pre-fault it, so large object memcpy doesn't pay TLB misses and the first
+  // touch doesn't pay page faults. Fallback allocations stay on 4K pages since
+  // they live on the filesystem.
+  const uint64_t hugepage_size_mb = RayConfig::instance().plasma_hugepage_size_mb();
+  if (hugepage_size_mb > 0 && !is_fallback_allocation) {
+    int hugetlb_fd = try_create_hugetlb_memfd(size, hugepage_size_mb);
+    if (hugetlb_fd >= 0) {
+      // MAP_POPULATE pre-faults the arena at startup. For hugetlb mappings it
+      // also surfaces reservation failures here instead of as SIGBUS on first
+      // touch.
+      *pointer =
+          mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, hugetlb_fd, 0);
+      if (*pointer == MAP_FAILED) {
+        RAY_LOG(WARNING) << "mmap of hugetlb arena failed ("
+                         << std::strerror(errno) << "), falling back to 4K pages.";
+        close(hugetlb_fd);
+      } else {
+        *fd = hugetlb_fd;
+        if (!allocated_once) {
+          initial_region_ptr = static_cast<char *>(*pointer);
+          initial_region_size = size;
+        }
+        if (numa_interleave.has_value()) {
+          numa_interleave->ApplyToRegion(*pointer, size);
+        }
+        RAY_LOG(INFO) << "Plasma arena backed by " << hugepage_size_mb
+                      << "MB huge pages, pre-faulted " << size << " bytes.";
+        return;
+      }
+    }
   }
-  // Immediately unlink the file so we do not leave traces in the system.
-  if (unlink(&file_name[0]) != 0) {
-    RAY_LOG(FATAL) << "failed to unlink file " << &file_name[0] << ", error"
-                   << std::strerror(errno);
+#endif /* __linux__ */
+
+  // A pooled fallback file is already created, unlinked and pre-allocated by
+  // the pool's background thread, so only the mmap below remains on the store
+  // thread.
+  bool from_pool = false;
+  if (is_fallback_allocation && fallback_file_pool != nullptr) {
+    if (auto pooled_fd = fallback_file_pool->TakeFile(size)) {
+      *fd = *pooled_fd;
+      from_pool = true;
+      RAY_LOG(DEBUG) << "serving fallback allocation of " << size
+                     << " bytes from the fallback file pool";
+    }
   }
-  if (!dlmalloc_config.hugepages_enabled) {
-    // Increase the size of the file to the desired size. This seems not to be
-    // needed for files that are backed by the huge page fs, see also
-    // http://www.mail-archive.com/kvm-devel@lists.sourceforge.net/msg14737.html
-    if (ftruncate(*fd, (off_t)size) != 0) {
-      RAY_LOG(FATAL) << "failed to ftruncate file " << &file_name[0] << ", error"
+
+  if (!from_pool) {
+    // Create a buffer. This is creating a temporary file and then
+    // immediately unlinking it so we do not leave traces in the system.
+    std::string file_template = dlmalloc_config.directory;
+
+    // In never-OOM mode, fallback to allocating from the filesystem. Note that these
+    // allocations will be run with dlmallopt(M_MMAP_THRESHOLD, 0) set by
+    // plasma_allocator.cc.
+    if (is_fallback_allocation) {
+      file_template = dlmalloc_config.fallback_directory;
+    }
+
+    file_template += "/plasmaXXXXXX";
+    RAY_LOG(INFO) << "create_and_mmap_buffer(" << size << ", " << file_template << ")";
+    std::vector<char> file_name(file_template.begin(), file_template.end());
+    file_name.push_back('\0');
+    // O_CLOEXEC will ensure the fd for plasma store memory backed by shm or fallback
+    // is closed when the process is forked. The core and IO worker processes are
+    // are forked from raylet which can cause memory leaks.
+    *fd = mkostemp(&file_name[0], O_CLOEXEC);
+    if (*fd < 0) {
+      RAY_LOG(FATAL) << "create_buffer failed to open file " << &file_name[0] << ", error"
+                     << std::strerror(errno);
+    }
+    // Immediately unlink the file so we do not leave traces in the system.
+    if (unlink(&file_name[0]) != 0) {
+      RAY_LOG(FATAL) << "failed to unlink file " << &file_name[0] << ", error"
                      << std::strerror(errno);
     }
+    if (!dlmalloc_config.hugepages_enabled) {
+      // Increase the size of the file to the desired size. This seems not to be
+      // needed for files that are backed by the huge page fs, see also
+      // http://www.mail-archive.com/kvm-devel@lists.sourceforge.net/msg14737.html
+      if (ftruncate(*fd, (off_t)size) != 0) {
+        RAY_LOG(FATAL) << "failed to ftruncate file " << &file_name[0] << ", error"
+                       << std::strerror(errno);
+      }
+    }
   }
 
   // MAP_POPULATE can be used to pre-populate the page tables for this memory region
@@ -190,8 +401,9 @@ void create_and_mmap_buffer(int64_t size, void **pointer, int *fd) {
 
 #ifdef __linux__
   // For fallback allocation, use fallocate to ensure follow up access to this
-  // mmaped file doesn't cause SIGBUS. Only supported on Linux.
-  if (allocated_once && dlmalloc_config.fallback_enabled) {
+  // mmaped file doesn't cause SIGBUS. Only supported on Linux. Pooled files
+  // were already pre-allocated by the pool's background thread.
+  if (is_fallback_allocation && !from_pool) {
     RAY_LOG(DEBUG) << "Preallocating fallback allocation using fallocate";
     int ret = fallocate(*fd, /*mode*/ 0, /*offset*/ 0, size);
     if (ret != 0) {
@@ -223,6 +435,10 @@ void create_and_mmap_buffer(int64_t size, void **pointer, int *fd) {
   }
 
 #ifdef __linux__
+  if (numa_interleave.has_value() && *pointer != MAP_FAILED) {
+    numa_interleave->ApplyToRegion(*pointer, size);
+  }
+
   if (RayConfig::instance().raylet_core_dump_exclude_plasma_store()) {
     int rval = madvise(initial_region_ptr, initial_region_size, MADV_DONTDUMP);
     if (rval) {
@@ -309,6 +525,8 @@ int fake_munmap(void *addr, int64_t size) {
 namespace internal {
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
 
+int64_t GetNextMmapUniqueId() { return next_mmap_unique_id++; }
+
 // Returns whether the given pointer is outside the initially allocated region.
 bool IsOutsideInitialAllocation(void *p) {
   if (initial_region_ptr == nullptr) {
@@ -330,6 +548,13 @@ void SetDLMallocConfig(const std::string &plasma_directory,
   dlmalloc_config.directory = plasma_directory;
   dlmalloc_config.fallback_directory = fallback_directory;
   dlmalloc_config.fallback_enabled = fallback_enabled;
+  if (fallback_enabled && RayConfig::instance().plasma_fallback_file_pool_enabled()) {
+    fallback_file_pool = std::make_unique<FallbackFilePool>(
+        fallback_directory,
+        RayConfig::instance().plasma_fallback_file_pool_files_per_bucket(),
+        RayConfig::instance().plasma_fallback_file_pool_min_bucket_bytes(),
+        RayConfig::instance().plasma_fallback_file_pool_max_bucket_bytes());
+  }
 }
 }  // namespace internal
 }  // namespace plasma
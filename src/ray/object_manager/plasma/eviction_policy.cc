@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ray/object_manager/plasma/plasma_allocator.h"
@@ -160,4 +161,145 @@ bool EvictionPolicy::IsObjectExists(const ObjectID &object_id) const {
 }
 
 std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
+
+namespace {
+/// Relative cost of losing an object, by how it got into the store. Pulled
+/// objects must be re-fetched cross-node, restored objects re-read from
+/// external storage; both are far more expensive than recreating a local
+/// temporary.
+double SourceCost(flatbuf::ObjectSource source) {
+  switch (source) {
+  case flatbuf::ObjectSource::ReceivedFromRemoteRaylet:
+    return 100.0;
+  case flatbuf::ObjectSource::RestoredFromStorage:
+    return 10.0;
+  case flatbuf::ObjectSource::CreatedByWorker:
+  case flatbuf::ObjectSource::ErrorStoredByRaylet:
+  default:
+    return 1.0;
+  }
+}
+}  // namespace
+
+CostAwareEvictionPolicy::CostAwareEvictionPolicy(const IObjectStore &object_store,
+                                                 const IAllocator &allocator)
+    : pinned_memory_bytes_(0),
+      access_seq_(0),
+      num_evictions_total_(0),
+      bytes_evicted_total_(0),
+      object_store_(object_store),
+      allocator_(allocator) {}
+
+double CostAwareEvictionPolicy::Score(const Entry &entry) const {
+  return entry.source_cost * (1.0 + static_cast<double>(entry.access_count)) /
+         static_cast<double>(std::max<int64_t>(entry.size, 1));
+}
+
+CostAwareEvictionPolicy::Entry CostAwareEvictionPolicy::MakeEntry(
+    const ObjectID &object_id) const {
+  const auto *object = object_store_.GetObject(object_id);
+  Entry entry;
+  entry.size = object->GetObjectSize();
+  entry.source_cost = SourceCost(object->GetSource());
+  entry.access_count = 0;
+  entry.last_access_seq = 0;
+  return entry;
+}
+
+void CostAwareEvictionPolicy::ObjectCreated(const ObjectID &object_id) {
+  RAY_CHECK(evictable_.emplace(object_id, MakeEntry(object_id)).second)
+      << object_id << " already tracked by the eviction policy";
+}
+
+int64_t CostAwareEvictionPolicy::RequireSpace(int64_t size,
+                                              std::vector<ObjectID> &objects_to_evict) {
+  int64_t required_space = allocator_.Allocated() + size - allocator_.GetFootprintLimit();
+  // Like the LRU policy, free up to 20% of capacity at once to amortize
+  // eviction rounds.
+  int64_t space_to_free = std::max(required_space, allocator_.GetFootprintLimit() / 5);
+  int64_t num_bytes_evicted = ChooseObjectsToEvict(space_to_free, objects_to_evict);
+  RAY_LOG(DEBUG) << "There is not enough space to create this object, so evicting "
+                 << objects_to_evict.size() << " objects to free up " << num_bytes_evicted
+                 << " bytes. The number of bytes in use (before "
+                 << "this eviction) is " << allocator_.Allocated() << ".";
+  return required_space - num_bytes_evicted;
+}
+
+void CostAwareEvictionPolicy::BeginObjectAccess(const ObjectID &object_id) {
+  auto it = evictable_.find(object_id);
+  if (it == evictable_.end()) {
+    return;
+  }
+  Entry entry = it->second;
+  evictable_.erase(it);
+  entry.access_count++;
+  entry.last_access_seq = ++access_seq_;
+  pinned_memory_bytes_ += entry.size;
+  pinned_.emplace(object_id, entry);
+}
+
+void CostAwareEvictionPolicy::EndObjectAccess(const ObjectID &object_id) {
+  auto it = pinned_.find(object_id);
+  if (it == pinned_.end()) {
+    return;
+  }
+  Entry entry = it->second;
+  pinned_.erase(it);
+  pinned_memory_bytes_ -= entry.size;
+  evictable_.emplace(object_id, entry);
+}
+
+int64_t CostAwareEvictionPolicy::ChooseObjectsToEvict(
+    int64_t num_bytes_required, std::vector<ObjectID> &objects_to_evict) {
+  // Rank evictable objects from cheapest to most expensive to lose.
+  std::vector<std::pair<ObjectID, const Entry *>> candidates;
+  candidates.reserve(evictable_.size());
+  for (const auto &[object_id, entry] : evictable_) {
+    candidates.emplace_back(object_id, &entry);
+  }
+  std::sort(candidates.begin(), candidates.end(), [this](const auto &a, const auto &b) {
+    const double score_a = Score(*a.second);
+    const double score_b = Score(*b.second);
+    if (score_a != score_b) {
+      return score_a < score_b;
+    }
+    return a.second->last_access_seq < b.second->last_access_seq;
+  });
+
+  int64_t bytes_evicted = 0;
+  for (const auto &[object_id, entry] : candidates) {
+    if (bytes_evicted >= num_bytes_required) {
+      break;
+    }
+    objects_to_evict.push_back(object_id);
+    bytes_evicted += entry->size;
+    bytes_evicted_total_ += entry->size;
+    num_evictions_total_++;
+  }
+  for (const auto &object_id : objects_to_evict) {
+    evictable_.erase(object_id);
+  }
+  return bytes_evicted;
+}
+
+void CostAwareEvictionPolicy::RemoveObject(const ObjectID &object_id) {
+  auto it = pinned_.find(object_id);
+  if (it != pinned_.end()) {
+    pinned_memory_bytes_ -= it->second.size;
+    pinned_.erase(it);
+    return;
+  }
+  evictable_.erase(object_id);
+}
+
+std::string CostAwareEvictionPolicy::DebugString() const {
+  std::stringstream result;
+  result << "\n(cost aware) evictable objects: " << evictable_.size();
+  result << "\n(cost aware) pinned objects: " << pinned_.size();
+  result << "\n(cost aware) pinned bytes: " << pinned_memory_bytes_;
+  result << "\n(cost aware) num evictions: " << num_evictions_total_;
+  result << "\n(cost aware) bytes evicted: " << bytes_evicted_total_;
+  return result.str();
+}
+
 }  // namespace plasma
@@ -68,6 +68,28 @@ class FakePlasmaClient : public PlasmaClientInterface {
     return Status::OK();
   }
 
+  Status CreateAndSealBatch(const std::vector<ObjectID> &object_ids,
+                            const ray::rpc::Address &owner_address,
+                            const std::vector<std::string> &data,
+                            const std::vector<std::string> &metadata,
+                            plasma::flatbuf::ObjectSource source,
+                            std::vector<plasma::flatbuf::PlasmaError> *errors) override {
+    errors->clear();
+    for (size_t i = 0; i < object_ids.size(); i++) {
+      std::vector<uint8_t> data_vec(data[i].begin(), data[i].end());
+      std::vector<uint8_t> metadata_vec(metadata[i].begin(), metadata[i].end());
+      objects_in_plasma_.emplace(
+          object_ids[i], std::make_pair(std::move(data_vec), std::move(metadata_vec)));
+      errors->push_back(plasma::flatbuf::PlasmaError::OK);
+    }
+    return Status::OK();
+  }
+
+  Status RestoreSpilledObject(const ObjectID &object_id,
+                              const std::string &spilled_url) override {
+    return Status::OK();
+  }
+
   Status Get(const std::vector<ObjectID> &object_ids,
              int64_t timeout_ms,
              std::vector<plasma::ObjectBuffer> *object_buffers) override {
@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ray/object_manager/plasma/fallback_file_pool.h"
+
+#ifdef __linux__
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* Turns on fallocate() definition */
+#endif              /* _GNU_SOURCE */
+#endif /* __linux__ */
+
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "absl/time/clock.h"
+#include "ray/util/logging.h"
+
+namespace plasma {
+
+FallbackFilePool::FallbackFilePool(std::string directory,
+                                   size_t files_per_bucket,
+                                   int64_t min_bucket_bytes,
+                                   int64_t max_bucket_bytes)
+    : directory_(std::move(directory)), files_per_bucket_(files_per_bucket) {
+  RAY_CHECK(min_bucket_bytes > 0) << "min_bucket_bytes must be positive";
+  RAY_CHECK(max_bucket_bytes >= min_bucket_bytes)
+      << "max_bucket_bytes must be at least min_bucket_bytes";
+  int64_t bucket_size = 1;
+  while (bucket_size < min_bucket_bytes) {
+    bucket_size *= 2;
+  }
+  for (; bucket_size <= max_bucket_bytes; bucket_size *= 2) {
+    buckets_.push_back({bucket_size, {}});
+  }
+  RAY_CHECK(!buckets_.empty()) << "No power of two in [" << min_bucket_bytes << ", "
+                               << max_bucket_bytes << "]";
+  refill_thread_ = std::thread(&FallbackFilePool::RefillLoop, this);
+}
+
+FallbackFilePool::~FallbackFilePool() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+  }
+  refill_thread_.join();
+#ifndef _WIN32
+  absl::MutexLock lock(&mutex_);
+  for (auto &bucket : buckets_) {
+    for (int fd : bucket.fds) {
+      close(fd);
+    }
+    bucket.fds.clear();
+  }
+#endif
+}
+
+std::optional<int> FallbackFilePool::TakeFile(int64_t size) {
+#ifdef _WIN32
+  return std::nullopt;
+#else
+  int fd = -1;
+  {
+    absl::MutexLock lock(&mutex_);
+    // Take from the smallest bucket that fits; the refill thread notices the
+    // deficit and replaces the file in the background.
+    for (auto &bucket : buckets_) {
+      if (bucket.size >= size && !bucket.fds.empty()) {
+        fd = bucket.fds.back();
+        bucket.fds.pop_back();
+        break;
+      }
+    }
+  }
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  // Shrink the file to the requested size. This releases the extra disk
+  // blocks; the blocks that remain were already allocated by the refill
+  // thread, so accessing the mapping can't SIGBUS on a full disk.
+  if (ftruncate(fd, (off_t)size) != 0) {
+    RAY_LOG(WARNING) << "failed to ftruncate pooled fallback file to " << size
+                     << " bytes, error: " << std::strerror(errno);
+    close(fd);
+    return std::nullopt;
+  }
+  return fd;
+#endif
+}
+
+void FallbackFilePool::RefillLoop() {
+#ifndef _WIN32
+  while (true) {
+    int64_t deficient_bucket_size = 0;
+    {
+      absl::MutexLock lock(&mutex_);
+      mutex_.Await(absl::Condition(this, &FallbackFilePool::RefillReady));
+      if (stopped_) {
+        return;
+      }
+      for (const auto &bucket : buckets_) {
+        if (bucket.fds.size() < files_per_bucket_) {
+          deficient_bucket_size = bucket.size;
+          break;
+        }
+      }
+    }
+    // Create the file with the lock released so TakeFile never waits behind
+    // filesystem work.
+    int fd = CreatePoolFile(deficient_bucket_size);
+    if (fd < 0) {
+      // Likely out of disk space; back off instead of spinning. TakeFile
+      // callers fall through to synchronous creation in the meantime.
+      absl::SleepFor(absl::Seconds(1));
+      continue;
+    }
+    absl::MutexLock lock(&mutex_);
+    if (stopped_) {
+      close(fd);
+      return;
+    }
+    for (auto &bucket : buckets_) {
+      if (bucket.size == deficient_bucket_size) {
+        bucket.fds.push_back(fd);
+        break;
+      }
+    }
+  }
+#endif
+}
+
+bool FallbackFilePool::RefillReady() const {
+  if (stopped_) {
+    return true;
+  }
+  for (const auto &bucket : buckets_) {
+    if (bucket.fds.size() < files_per_bucket_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int FallbackFilePool::CreatePoolFile(int64_t size) const {
+#ifdef _WIN32
+  return -1;
+#else
+  std::string file_template = directory_ + "/plasmaXXXXXX";
+  std::vector<char> file_name(file_template.begin(), file_template.end());
+  file_name.push_back('\0');
+  // O_CLOEXEC for the same reason as the synchronous path: fds for plasma
+  // store memory must not leak into processes forked from the raylet.
+  int fd = mkostemp(&file_name[0], O_CLOEXEC);
+  if (fd < 0) {
+    RAY_LOG(WARNING) << "fallback file pool failed to open file " << &file_name[0]
+                     << ", error: " << std::strerror(errno);
+    return -1;
+  }
+  // Immediately unlink the file so we do not leave traces in the system.
+  if (unlink(&file_name[0]) != 0) {
+    RAY_LOG(WARNING) << "fallback file pool failed to unlink file " << &file_name[0]
+                     << ", error: " << std::strerror(errno);
+    close(fd);
+    return -1;
+  }
+  if (ftruncate(fd, (off_t)size) != 0) {
+    RAY_LOG(WARNING) << "fallback file pool failed to ftruncate file to " << size
+                     << " bytes, error: " << std::strerror(errno);
+    close(fd);
+    return -1;
+  }
+#ifdef __linux__
+  // Allocate the blocks up front so follow up access to the mmaped file
+  // doesn't cause SIGBUS. This is the expensive step the pool exists to keep
+  // off the store thread.
+  int ret = fallocate(fd, /*mode*/ 0, /*offset*/ 0, size);
+  if (ret != 0) {
+    if (errno == EOPNOTSUPP || errno == ENOSYS) {
+      // In case fallocate is not supported by the current filesystem or
+      // kernel, the file is still usable; it just isn't pre-allocated.
+      RAY_LOG(DEBUG) << "fallocate is not supported: " << std::strerror(errno);
+    } else {
+      RAY_LOG(WARNING) << "fallback file pool out of disk space, fallocate error: "
+                       << std::strerror(errno);
+      close(fd);
+      return -1;
+    }
+  }
+#endif /* __linux__ */
+  return fd;
+#endif
+}
+
+}  // namespace plasma
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace plasma {
+
+// FallbackFilePool keeps a pool of pre-created files in the fallback
+// directory so fallback allocations don't pay for file creation on the store
+// thread. Creating a fallback-mmap file synchronously means an mkstemp,
+// ftruncate and fallocate against the filesystem per object, which can stall
+// the store for tens of milliseconds under memory pressure. The pool's
+// background thread creates unlinked, fully pre-allocated files in
+// power-of-two size buckets ahead of time; TakeFile hands one over after
+// truncating it down to the requested size, leaving only the mmap itself on
+// the hot path. Requests the pool cannot serve (larger than the biggest
+// bucket, or the pool is momentarily drained) return an empty optional and
+// the caller creates the file synchronously as before.
+//
+// TakeFile may be called from any thread.
+class FallbackFilePool {
+ public:
+  /// \param directory Directory to create the pooled files in. This should
+  /// NOT be in /dev/shm; it is the same directory fallback allocations use.
+  /// \param files_per_bucket Number of pre-created files kept per bucket.
+  /// \param min_bucket_bytes Smallest bucket size; rounded up to a power of
+  /// two.
+  /// \param max_bucket_bytes Largest bucket size. Buckets are the powers of
+  /// two in [min_bucket_bytes, max_bucket_bytes].
+  FallbackFilePool(std::string directory,
+                   size_t files_per_bucket,
+                   int64_t min_bucket_bytes,
+                   int64_t max_bucket_bytes);
+
+  ~FallbackFilePool();
+
+  FallbackFilePool(const FallbackFilePool &) = delete;
+  FallbackFilePool &operator=(const FallbackFilePool &) = delete;
+
+  /// Take a pre-created file of at least `size` bytes from the pool, truncated
+  /// down to exactly `size` bytes. The returned fd refers to an unlinked file
+  /// whose blocks are already allocated on disk, ready to be mmapped; the
+  /// caller owns the fd. Returns an empty optional if no pooled file can serve
+  /// the request, in which case the caller should create one synchronously.
+  std::optional<int> TakeFile(int64_t size);
+
+ private:
+  struct Bucket {
+    int64_t size;
+    std::vector<int> fds;
+  };
+
+  /// Main loop of the refill thread. Creates one file at a time with the lock
+  /// released so TakeFile is never blocked behind filesystem work.
+  void RefillLoop();
+
+  bool RefillReady() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Create an unlinked, pre-allocated file of `size` bytes in directory_.
+  /// Returns -1 on failure.
+  int CreatePoolFile(int64_t size) const;
+
+  const std::string directory_;
+  const size_t files_per_bucket_;
+
+  mutable absl::Mutex mutex_;
+
+  /// Buckets in ascending size order.
+  std::vector<Bucket> buckets_ ABSL_GUARDED_BY(mutex_);
+
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+
+  std::thread refill_thread_;
+};
+
+}  // namespace plasma
@@ -25,6 +25,8 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "ray/util/logging.h"
 
 // This is necessary for Mac OS X, see http://www.apuebook.com/faqs2e.html
@@ -143,3 +145,98 @@ int recv_fd(int conn) {
   }
   return found_fd;
 }
+
+int send_fds(int conn, const int *fds, size_t num_fds) {
+  RAY_CHECK(num_fds > 0 && num_fds <= kMaxFdsPerControlMessage);
+  struct msghdr msg;
+  struct iovec iov;
+  std::vector<char> buf(CMSG_SPACE(num_fds * sizeof(int)), 0);
+
+  init_msg(&msg, &iov, buf.data(), buf.size());
+
+  struct cmsghdr *header = CMSG_FIRSTHDR(&msg);
+  if (header == nullptr) {
+    return -1;
+  }
+  header->cmsg_level = SOL_SOCKET;
+  header->cmsg_type = SCM_RIGHTS;
+  header->cmsg_len = CMSG_LEN(num_fds * sizeof(int));
+  memcpy(CMSG_DATA(header), fds, num_fds * sizeof(int));
+
+  // Send the file descriptors in one message.
+  while (true) {
+    ssize_t r = sendmsg(conn, &msg, 0);
+    if (r < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+        continue;
+      } else if (errno == EMSGSIZE) {
+        // See the comment in send_fd; retry until the kernel accepts it.
+        RAY_LOG(WARNING) << "Failed to send " << num_fds << " file descriptors"
+                         << " (errno = EMSGSIZE), retrying.";
+        continue;
+      } else {
+        RAY_LOG(INFO) << "Error in send_fds (errno = " << errno << ")";
+        return static_cast<int>(r);
+      }
+    } else if (r == 0) {
+      RAY_LOG(INFO) << "Encountered unexpected EOF";
+      return 0;
+    } else {
+      RAY_CHECK(r > 0);
+      return static_cast<int>(r);
+    }
+  }
+}
+
+int recv_fds(int conn, int *fds, size_t num_fds) {
+  RAY_CHECK(num_fds > 0 && num_fds <= kMaxFdsPerControlMessage);
+  struct msghdr msg;
+  struct iovec iov;
+  std::vector<char> buf(CMSG_SPACE(num_fds * sizeof(int)), 0);
+  init_msg(&msg, &iov, buf.data(), buf.size());
+
+  while (true) {
+    ssize_t r = recvmsg(conn, &msg, 0);
+    if (r == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+        continue;
+      } else {
+        RAY_LOG(INFO) << "Error in recv_fds (errno = " << errno << ")";
+        return -1;
+      }
+    } else {
+      break;
+    }
+  }
+
+  size_t found = 0;
+  bool oh_noes = false;
+  for (struct cmsghdr *header = CMSG_FIRSTHDR(&msg); header != NULL;
+       header = CMSG_NXTHDR(&msg, header))
+    if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+      ssize_t count = (header->cmsg_len -
+                       (CMSG_DATA(header) - reinterpret_cast<unsigned char *>(header))) /
+                      sizeof(int);
+      for (int i = 0; i < count; ++i) {
+        int fd = (reinterpret_cast<int *>(CMSG_DATA(header)))[i];
+        if (found < num_fds) {
+          fds[found++] = fd;
+        } else {
+          close(fd);
+          oh_noes = true;
+        }
+      }
+    }
+
+  // The sender sent a different number of file descriptors than we expected.
+  // Close everything we received to prevent fd leaks and notify the caller
+  // that we got a bad message.
+  if (oh_noes || found != num_fds) {
+    for (size_t i = 0; i < found; ++i) {
+      close(fds[i]);
+    }
+    errno = EBADMSG;
+    return -1;
+  }
+  return 0;
+}
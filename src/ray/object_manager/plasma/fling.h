@@ -25,6 +25,12 @@
 
 #pragma once
 
+#include <cstddef>
+
+// The kernel caps the number of file descriptors that fit into a single
+// SCM_RIGHTS control message (SCM_MAX_FD).
+constexpr size_t kMaxFdsPerControlMessage = 253;
+
 // Send a file descriptor over a unix domain socket.
 //
 // \param conn Unix domain socket to send the file descriptor over.
@@ -37,3 +43,22 @@ int send_fd(int conn, int fd);
 // \param conn Unix domain socket to receive the file descriptor from.
 // \return File descriptor or a value < 0 on failure.
 int recv_fd(int conn);
+
+// Send a batch of file descriptors over a unix domain socket in a single
+// SCM_RIGHTS control message (one sendmsg syscall). Both sides must agree on
+// the batch size, and num_fds must not exceed kMaxFdsPerControlMessage.
+//
+// \param conn Unix domain socket to send the file descriptors over.
+// \param fds File descriptors to send over.
+// \param num_fds Number of file descriptors in fds.
+// \return Status code which is < 0 on failure.
+int send_fds(int conn, const int *fds, size_t num_fds);
+
+// Receive a batch of file descriptors sent with send_fds. num_fds must match
+// the number the sender passed to send_fds.
+//
+// \param conn Unix domain socket to receive the file descriptors from.
+// \param fds Output array of num_fds file descriptors.
+// \param num_fds Number of file descriptors to receive.
+// \return 0 on success or a value < 0 on failure.
+int recv_fds(int conn, int *fds, size_t num_fds);
@@ -54,14 +54,20 @@ bool GetRequest::IsRemoved() const { return is_removed_; }
 void GetRequestQueue::AddRequest(const std::shared_ptr<ClientInterface> &client,
                                  const std::vector<ObjectID> &object_ids,
                                  int64_t timeout_ms) {
-  const absl::flat_hash_set<ObjectID> unique_ids(object_ids.begin(), object_ids.end());
+  const absl::flat_hash_set<ObjectID> unique_ids_set(object_ids.begin(),
+                                                     object_ids.end());
+  const std::vector<ObjectID> unique_ids(unique_ids_set.begin(), unique_ids_set.end());
   // Create a get request for this object.
   auto get_request =
       std::make_shared<GetRequest>(io_context_, client, object_ids, unique_ids.size());
-  for (const auto &object_id : unique_ids) {
+  // Resolve all objects of the request in one batch over the object table
+  // instead of one lookup at a time.
+  const auto entries = object_lifecycle_mgr_.GetObjects(unique_ids);
+  for (size_t i = 0; i < unique_ids.size(); i++) {
+    const auto &object_id = unique_ids[i];
+    const auto *entry = entries[i];
     // Check if this object is already present locally. If so, record that the object is
     // being used and mark it as accounted for.
-    auto entry = object_lifecycle_mgr_.GetObject(object_id);
     if (entry != nullptr && entry->Sealed()) {
       // Update the get request to take into account the present object.
       auto *plasma_object = &get_request->objects_[object_id];
@@ -41,11 +41,16 @@ struct MmapRecord {
 /// and size.
 extern absl::flat_hash_map<void *, MmapRecord> mmap_records;
 
-/// private function, only used by PlasmaAllocator
+/// private functions, only used by PlasmaAllocator and SpillFileMapper
 namespace internal {
 bool GetMallocMapinfo(const void *const addr,
                       MEMFD_TYPE *fd,
                       int64_t *map_length,
                       ptrdiff_t *offset);
-}
+
+/// Returns the next unique id for an fd handed out to clients, from the
+/// same sequence used for the allocator's own mmap regions so ids never
+/// collide after fd reuse.
+int64_t GetNextMmapUniqueId();
+}  // namespace internal
 }  // namespace plasma
@@ -17,11 +17,15 @@
 
 #include "ray/object_manager/plasma/obj_lifecycle_mgr.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "ray/common/ray_config.h"
 
@@ -31,10 +35,31 @@ using flatbuf::PlasmaError;
 using plasma::ObjectState;
 using ray::ObjectID;
 
+namespace {
+std::unique_ptr<IObjectStore> MakeObjectStore(IAllocator &allocator) {
+  const auto num_shards = RayConfig::instance().object_store_index_shards();
+  if (num_shards > 1) {
+    return std::make_unique<ShardedObjectStore>(allocator, num_shards);
+  }
+  return std::make_unique<ObjectStore>(allocator);
+}
+
+std::unique_ptr<IEvictionPolicy> MakeEvictionPolicy(const IObjectStore &object_store,
+                                                    const IAllocator &allocator) {
+  const auto &policy_name = RayConfig::instance().plasma_eviction_policy();
+  if (policy_name == "cost_aware") {
+    return std::make_unique<CostAwareEvictionPolicy>(object_store, allocator);
+  }
+  RAY_CHECK_EQ(policy_name, std::string("lru"))
+      << "Unknown plasma eviction policy " << policy_name;
+  return std::make_unique<EvictionPolicy>(object_store, allocator);
+}
+}  // namespace
+
 ObjectLifecycleManager::ObjectLifecycleManager(
     IAllocator &allocator, ray::DeleteObjectCallback delete_object_callback)
-    : object_store_(std::make_unique<ObjectStore>(allocator)),
-      eviction_policy_(std::make_unique<EvictionPolicy>(*object_store_, allocator)),
+    : object_store_(MakeObjectStore(allocator)),
+      eviction_policy_(MakeEvictionPolicy(*object_store_, allocator)),
       delete_object_callback_(std::move(delete_object_callback)),
       stats_collector_(std::make_unique<ObjectStatsCollector>()) {}
 
@@ -57,15 +82,35 @@ std::pair<const LocalObject *, flatbuf::PlasmaError> ObjectLifecycleManager::Cre
   return {entry, PlasmaError::OK};
 }
 
+const LocalObject *ObjectLifecycleManager::RestoreObject(
+    const ray::ObjectInfo &object_info,
+    plasma::flatbuf::ObjectSource source,
+    Allocation allocation) {
+  RAY_CHECK(object_store_->GetObject(object_info.object_id) == nullptr)
+      << object_info.object_id << " already exists!";
+  auto entry =
+      object_store_->AddRestoredObject(object_info, source, std::move(allocation));
+  eviction_policy_->ObjectCreated(object_info.object_id);
+  stats_collector_->OnObjectCreated(*entry);
+  stats_collector_->OnObjectSealed(*entry);
+  return entry;
+}
+
 const LocalObject *ObjectLifecycleManager::GetObject(const ObjectID &object_id) const {
   return object_store_->GetObject(object_id);
 }
 
+std::vector<const LocalObject *> ObjectLifecycleManager::GetObjects(
+    const std::vector<ObjectID> &object_ids) const {
+  return object_store_->GetObjects(object_ids);
+}
+
 const LocalObject *ObjectLifecycleManager::SealObject(const ObjectID &object_id) {
   // TODO(scv119): should we check delete object from earger_deletion_objects_?
   auto entry = object_store_->SealObject(object_id);
   if (entry != nullptr) {
     stats_collector_->OnObjectSealed(*entry);
+    MaybeRecordContentHash(*entry);
   }
   return entry;
 }
@@ -170,6 +215,10 @@ bool ObjectLifecycleManager::RemoveReference(const ObjectID &object_id) {
   RAY_CHECK(entry->Sealed()) << object_id << " is not sealed while ref count becomes 0.";
   if (earger_deletion_objects_.count(object_id) > 0) {
     DeleteObjectInternal(object_id);
+  } else if (RayConfig::instance().plasma_dedup_enabled()) {
+    // Now that no client maps the allocation it is safe to collapse it onto
+    // another sealed object with identical content.
+    TryDedupUnreferenced(object_id);
   }
   return true;
 }
@@ -186,6 +235,7 @@ const LocalObject *ObjectLifecycleManager::CreateObjectInternal(
   // NOTE(ekl) if we can't achieve this after a number of retries, it's
   // because memory fragmentation in dlmalloc prevents us from allocating
   // even if our footprint tracker here still says we have free space.
+  int64_t space_needed = 0;
   for (int num_tries = 0; num_tries <= 10; num_tries++) {
     auto result =
         object_store_->CreateObject(object_info, source, /*fallback_allocate*/ false);
@@ -194,7 +244,7 @@ const LocalObject *ObjectLifecycleManager::CreateObjectInternal(
     }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
-    int64_t space_needed =
+    space_needed =
         eviction_policy_->RequireSpace(object_info.GetObjectSize(), objects_to_evict);
     EvictObjects(objects_to_evict);
     // More space is still needed.
@@ -205,6 +255,26 @@ const LocalObject *ObjectLifecycleManager::CreateObjectInternal(
     }
   }
 
+  // If we get here with the footprint tracker still reporting room, the
+  // allocation failed because the free space is fragmented. Optionally
+  // compact: move sealed objects that no client is using aside so the
+  // allocator can coalesce a contiguous run for this request, then move them
+  // back into whatever space remains.
+  if (space_needed <= 0 &&
+      RayConfig::instance().plasma_unreferenced_object_compaction()) {
+    auto evacuated = EvacuateObjectsForCompaction(object_info.GetObjectSize());
+    if (!evacuated.empty()) {
+      auto result =
+          object_store_->CreateObject(object_info, source, /*fallback_allocate*/ false);
+      RehomeEvacuatedObjects(std::move(evacuated));
+      if (result != nullptr) {
+        RAY_LOG(INFO) << "Compaction made room for a fragmented create of "
+                      << object_info.GetObjectSize() << " bytes";
+        return result;
+      }
+    }
+  }
+
   if (!allow_fallback_allocation) {
     RAY_LOG(DEBUG) << "Fallback allocation not enabled for this request.";
     return nullptr;
@@ -223,6 +293,79 @@ const LocalObject *ObjectLifecycleManager::CreateObjectInternal(
   return result;
 }
 
+bool ObjectLifecycleManager::IsRelocatable(const LocalObject &entry) const {
+  if (!entry.Sealed() || entry.ref_count_ != 0) {
+    return false;
+  }
+  // Mutable objects stay mapped by their readers and writers regardless of
+  // the plasma ref count.
+  if (entry.object_info_.is_mutable) {
+    return false;
+  }
+  // Fallback-allocated and spill-file-backed objects live on disk and do not
+  // fragment the shared memory arena.
+  if (entry.allocation_.fallback_allocated_ || entry.metadata_precedes_data_) {
+    return false;
+  }
+  // Entries sharing a deduplicated allocation cannot be moved; the other
+  // sharers would keep pointing at the old block.
+  if (shared_allocation_objects_.contains(entry.object_info_.object_id)) {
+    return false;
+  }
+  return true;
+}
+
+std::vector<ObjectLifecycleManager::EvacuatedObject>
+ObjectLifecycleManager::EvacuateObjectsForCompaction(int64_t needed_size) {
+  // Over-provision the amount freed: releasing exactly needed_size bytes of
+  // scattered cold objects rarely coalesces into a single contiguous run.
+  const int64_t target_bytes =
+      std::min(RayConfig::instance().plasma_compaction_max_bytes_per_pass(),
+               needed_size * 2);
+  std::vector<ObjectID> candidates;
+  eviction_policy_->ChooseObjectsToEvict(std::max(needed_size, target_bytes),
+                                         candidates);
+  std::vector<EvacuatedObject> evacuated;
+  for (const auto &object_id : candidates) {
+    auto entry = object_store_->GetObject(object_id);
+    RAY_CHECK(entry != nullptr)
+        << "To relocate an object it must be in the object table.";
+    if (!IsRelocatable(*entry)) {
+      continue;
+    }
+    const int64_t object_size = entry->GetObjectSize();
+    auto payload = std::make_unique<uint8_t[]>(object_size);
+    if (object_size > 0) {
+      std::memcpy(payload.get(), entry->GetAllocation().address_, object_size);
+    }
+    object_store_->BeginObjectRelocation(object_id);
+    evacuated.push_back({object_id, std::move(payload)});
+  }
+  return evacuated;
+}
+
+void ObjectLifecycleManager::RehomeEvacuatedObjects(
+    std::vector<EvacuatedObject> evacuated) {
+  for (auto &object : evacuated) {
+    if (object_store_->FinishObjectRelocation(
+            object.object_id, object.payload.get(), /*fallback_allocate=*/false)) {
+      continue;
+    }
+    // The compacted arena cannot hold the object anymore; moving it to a
+    // fallback file keeps it local, which is still cheaper than the pull or
+    // restore an eviction would cause later.
+    if (object_store_->FinishObjectRelocation(
+            object.object_id, object.payload.get(), /*fallback_allocate=*/true)) {
+      stats_collector_->OnObjectRelocatedToFallback(
+          *object_store_->GetObject(object.object_id));
+      continue;
+    }
+    RAY_LOG(WARNING) << "Could not re-allocate object " << object.object_id
+                     << " after compaction, deleting it instead.";
+    DeleteObjectInternal(object.object_id);
+  }
+}
+
 void ObjectLifecycleManager::EvictObjects(const std::vector<ObjectID> &object_ids) {
   for (const auto &object_id : object_ids) {
     RAY_LOG(DEBUG) << "evicting object " << object_id.Hex();
@@ -248,6 +391,7 @@ void ObjectLifecycleManager::DeleteObjectInternal(const ObjectID &object_id) {
 
   stats_collector_->OnObjectDeleting(*entry);
   earger_deletion_objects_.erase(object_id);
+  RemoveDedupState(object_id);
   eviction_policy_->RemoveObject(object_id);
   object_store_->DeleteObject(object_id);
 
@@ -257,6 +401,84 @@ void ObjectLifecycleManager::DeleteObjectInternal(const ObjectID &object_id) {
   }
 }
 
+void ObjectLifecycleManager::MaybeRecordContentHash(const LocalObject &entry) {
+  if (!RayConfig::instance().plasma_dedup_enabled()) {
+    return;
+  }
+  // Mutable objects can change after sealing; fallback-allocated objects live
+  // on disk and do not consume arena space. Spill-file-backed entries come in
+  // through RestoreObject and never pass through here.
+  if (entry.object_info_.is_mutable || entry.allocation_.fallback_allocated_ ||
+      entry.allocation_.address_ == nullptr || entry.GetObjectSize() == 0) {
+    return;
+  }
+  const uint64_t hash = absl::Hash<absl::string_view>{}(absl::string_view(
+      reinterpret_cast<const char *>(entry.allocation_.address_), entry.GetObjectSize()));
+  const auto &object_id = entry.object_info_.object_id;
+  content_hashes_[object_id] = hash;
+  dedup_index_[hash].insert(object_id);
+}
+
+void ObjectLifecycleManager::TryDedupUnreferenced(const ObjectID &object_id) {
+  // Already collapsed onto (or shared with) another object.
+  if (shared_allocation_objects_.contains(object_id)) {
+    return;
+  }
+  auto hash_it = content_hashes_.find(object_id);
+  if (hash_it == content_hashes_.end()) {
+    return;
+  }
+  auto entry = object_store_->GetObject(object_id);
+  if (entry == nullptr || !entry->Sealed() || entry->ref_count_ != 0 ||
+      entry->allocation_.address_ == nullptr ||
+      entry->allocation_.fallback_allocated_) {
+    return;
+  }
+  for (const auto &canonical_id : dedup_index_[hash_it->second]) {
+    if (canonical_id == object_id) {
+      continue;
+    }
+    auto canonical = object_store_->GetObject(canonical_id);
+    if (canonical == nullptr || !canonical->Sealed() ||
+        canonical->GetObjectSize() != entry->GetObjectSize() ||
+        canonical->allocation_.fallback_allocated_ ||
+        canonical->allocation_.address_ == nullptr ||
+        canonical->allocation_.address_ == entry->allocation_.address_) {
+      continue;
+    }
+    // The hash is only a candidate filter; verify the payloads really match
+    // before sharing the allocation.
+    if (std::memcmp(canonical->allocation_.address_,
+                    entry->allocation_.address_,
+                    entry->GetObjectSize()) != 0) {
+      continue;
+    }
+    if (!object_store_->AliasObjectAllocation(object_id, canonical_id)) {
+      continue;
+    }
+    shared_allocation_objects_.insert(object_id);
+    shared_allocation_objects_.insert(canonical_id);
+    RAY_LOG(DEBUG) << "Deduplicated object " << object_id << " onto " << canonical_id
+                   << ", reclaimed " << entry->GetObjectSize() << " bytes";
+    return;
+  }
+}
+
+void ObjectLifecycleManager::RemoveDedupState(const ObjectID &object_id) {
+  auto hash_it = content_hashes_.find(object_id);
+  if (hash_it != content_hashes_.end()) {
+    auto index_it = dedup_index_.find(hash_it->second);
+    if (index_it != dedup_index_.end()) {
+      index_it->second.erase(object_id);
+      if (index_it->second.empty()) {
+        dedup_index_.erase(index_it);
+      }
+    }
+    content_hashes_.erase(hash_it);
+  }
+  shared_allocation_objects_.erase(object_id);
+}
+
 int64_t ObjectLifecycleManager::GetNumBytesInUse() const {
   return stats_collector_->GetNumBytesInUse();
 }
@@ -22,6 +22,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "gtest/gtest_prod.h"
 #include "ray/object_manager/plasma/common.h"
@@ -57,6 +58,14 @@ class IObjectLifecycleManager {
   ///   - otherwise, pointer to the object.
   virtual const LocalObject *GetObject(const ObjectID &object_id) const = 0;
 
+  /// Get multiple objects in one batch over the object table.
+  ///
+  /// \param object_ids Object IDs to look up.
+  /// \return pointers aligned with \p object_ids; nullptr where the object
+  /// doesn't exist.
+  virtual std::vector<const LocalObject *> GetObjects(
+      const std::vector<ObjectID> &object_ids) const = 0;
+
   /// Seal created object by id.
   ///
   /// \param object_id Object ID of the object to be sealed.
@@ -113,8 +122,24 @@ class ObjectLifecycleManager : public IObjectLifecycleManager {
       plasma::flatbuf::ObjectSource source,
       bool fallback_allocator) override;
 
+  /// Add an already-sealed object backed by an externally created allocation,
+  /// e.g. a mapped spill file record. The object participates in eviction and
+  /// stats like any sealed object. The caller must ensure no object with the
+  /// same id exists.
+  ///
+  /// \param object_info Plasma object info.
+  /// \param source From where the object is created.
+  /// \param allocation Allocation holding the object payload.
+  /// \return pointer to the restored object.
+  const LocalObject *RestoreObject(const ray::ObjectInfo &object_info,
+                                   plasma::flatbuf::ObjectSource source,
+                                   Allocation allocation);
+
   const LocalObject *GetObject(const ObjectID &object_id) const override;
 
+  std::vector<const LocalObject *> GetObjects(
+      const std::vector<ObjectID> &object_ids) const override;
+
   const LocalObject *SealObject(const ObjectID &object_id) override;
 
   flatbuf::PlasmaError AbortObject(const ObjectID &object_id) override;
@@ -173,7 +198,47 @@ class ObjectLifecycleManager : public IObjectLifecycleManager {
   // \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID> &object_ids);
 
+  // A sealed object whose allocation was released during compaction, together
+  // with its payload saved on the heap until it is re-allocated.
+  struct EvacuatedObject {
+    ObjectID object_id;
+    std::unique_ptr<uint8_t[]> payload;
+  };
+
+  // Whether the object can be moved to another allocation. It must be sealed
+  // with no client references (any client that has gotten it holds a raw
+  // pointer into the current allocation), not a mutable object (their readers
+  // and writers stay mapped regardless of the ref count), and backed by the
+  // shared memory arena rather than a fallback file or spill file on disk.
+  bool IsRelocatable(const LocalObject &entry) const;
+
+  // Copy eligible unreferenced sealed objects aside and release their
+  // allocations, so the allocator can coalesce contiguous space for a create
+  // of needed_size bytes that failed due to fragmentation.
+  std::vector<EvacuatedObject> EvacuateObjectsForCompaction(int64_t needed_size);
+
+  // Give evacuated objects new allocations and restore their payloads.
+  // Objects that cannot be re-allocated even from the fallback allocator are
+  // deleted, which is no worse than the eviction that would otherwise have
+  // made room.
+  void RehomeEvacuatedObjects(std::vector<EvacuatedObject> evacuated);
+
   void DeleteObjectInternal(const ObjectID &object_id);
+
+  // Record the content hash of a freshly sealed object so later seals of
+  // identical payloads can find it. No-op unless plasma_dedup_enabled.
+  void MaybeRecordContentHash(const LocalObject &entry);
+
+  // Try to collapse object_id's allocation onto another sealed object with
+  // identical content. Called when the last client reference is dropped;
+  // before that the creating client still has the allocation mapped, so it
+  // cannot be freed. Payloads are compared byte for byte before aliasing to
+  // guard against hash collisions.
+  void TryDedupUnreferenced(const ObjectID &object_id);
+
+  // Drop any dedup bookkeeping for a deleted object.
+  void RemoveDedupState(const ObjectID &object_id);
+
   std::unique_ptr<IObjectStore> object_store_;
   std::unique_ptr<IEvictionPolicy> eviction_policy_;
   const ray::DeleteObjectCallback delete_object_callback_;
@@ -182,6 +247,17 @@ class ObjectLifecycleManager : public IObjectLifecycleManager {
   // once reference count becomes 0.
   absl::flat_hash_set<ObjectID> earger_deletion_objects_;
 
+  // Content hash of each sealed object eligible for deduplication, and the
+  // reverse index used to find objects with identical content. The hash is
+  // only a candidate filter; payloads are memcmp'd before aliasing.
+  absl::flat_hash_map<ObjectID, uint64_t> content_hashes_;
+  absl::flat_hash_map<uint64_t, absl::flat_hash_set<ObjectID>> dedup_index_;
+
+  // Objects whose entries share a deduplicated allocation. Excluded from
+  // compaction relocation since the other sharers would keep pointing at the
+  // old block.
+  absl::flat_hash_set<ObjectID> shared_allocation_objects_;
+
   std::unique_ptr<ObjectStatsCollector> stats_collector_;
 };
 }  // namespace plasma
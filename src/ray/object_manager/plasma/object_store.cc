@@ -17,6 +17,8 @@
 
 #include "ray/object_manager/plasma/object_store.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -60,6 +62,23 @@ const LocalObject *ObjectStore::CreateObject(const ray::ObjectInfo &object_info,
   return entry;
 }
 
+const LocalObject *ObjectStore::AddRestoredObject(const ray::ObjectInfo &object_info,
+                                                  plasma::flatbuf::ObjectSource source,
+                                                  Allocation allocation) {
+  RAY_CHECK(!object_table_.contains(object_info.object_id))
+      << object_info.object_id << " already exists!";
+  auto ptr = std::make_unique<LocalObject>(std::move(allocation));
+  auto entry =
+      object_table_.emplace(object_info.object_id, std::move(ptr)).first->second.get();
+  entry->object_info_ = object_info;
+  entry->state_ = ObjectState::PLASMA_SEALED;
+  entry->create_time_ = std::time(nullptr);
+  entry->construct_duration_ = 0;
+  entry->source_ = source;
+  entry->metadata_precedes_data_ = true;
+  return entry;
+}
+
 const LocalObject *ObjectStore::GetObject(const ObjectID &object_id) const {
   auto it = object_table_.find(object_id);
   if (it == object_table_.end()) {
@@ -68,6 +87,16 @@ const LocalObject *ObjectStore::GetObject(const ObjectID &object_id) const {
   return it->second.get();
 }
 
+std::vector<const LocalObject *> ObjectStore::GetObjects(
+    const std::vector<ObjectID> &object_ids) const {
+  std::vector<const LocalObject *> entries;
+  entries.reserve(object_ids.size());
+  for (const auto &object_id : object_ids) {
+    entries.push_back(GetObject(object_id));
+  }
+  return entries;
+}
+
 const LocalObject *ObjectStore::SealObject(const ObjectID &object_id) {
   auto entry = GetMutableObject(object_id);
   if (entry == nullptr || entry->state_ == ObjectState::PLASMA_SEALED) {
@@ -83,11 +112,93 @@ bool ObjectStore::DeleteObject(const ObjectID &object_id) {
   if (entry == nullptr) {
     return false;
   }
-  allocator_.Free(std::move(entry->allocation_));
+  // The entry has no backing memory if it is deleted after a relocation that
+  // could not re-allocate it.
+  if (entry->allocation_.address_ != nullptr) {
+    // A deduplicated allocation is freed only when its last sharer goes away.
+    auto shared_it = shared_allocation_refs_.find(entry->allocation_.address_);
+    if (shared_it != shared_allocation_refs_.end() && --shared_it->second > 0) {
+      // Another entry still references this block; drop our record of it
+      // without freeing.
+      entry->allocation_ = Allocation();
+    } else {
+      if (shared_it != shared_allocation_refs_.end()) {
+        shared_allocation_refs_.erase(shared_it);
+      }
+      allocator_.Free(std::move(entry->allocation_));
+    }
+  }
   object_table_.erase(object_id);
   return true;
 }
 
+void ObjectStore::BeginObjectRelocation(const ObjectID &object_id) {
+  auto entry = GetMutableObject(object_id);
+  RAY_CHECK(entry != nullptr) << "To relocate an object it must be in the object table.";
+  RAY_CHECK(entry->Sealed()) << "To relocate an object it must have been sealed.";
+  RAY_CHECK_EQ(entry->GetRefCount(), 0)
+      << "To relocate an object, there must be no clients currently using it.";
+  RAY_CHECK(!shared_allocation_refs_.contains(entry->allocation_.address_))
+      << "Deduplicated allocations cannot be relocated.";
+  allocator_.Free(std::move(entry->allocation_));
+  entry->allocation_ = Allocation();
+}
+
+bool ObjectStore::FinishObjectRelocation(const ObjectID &object_id,
+                                         const uint8_t *payload,
+                                         bool fallback_allocate) {
+  auto entry = GetMutableObject(object_id);
+  RAY_CHECK(entry != nullptr) << "To relocate an object it must be in the object table.";
+  RAY_CHECK(entry->allocation_.address_ == nullptr)
+      << "Object must have been evacuated before finishing a relocation.";
+  const auto object_size = entry->GetObjectSize();
+  auto allocation = fallback_allocate ? allocator_.FallbackAllocate(object_size)
+                                      : allocator_.Allocate(object_size);
+  if (!allocation.has_value()) {
+    return false;
+  }
+  std::memcpy(allocation->address_, payload, object_size);
+  entry->allocation_ = std::move(allocation.value());
+  return true;
+}
+
+bool ObjectStore::AliasObjectAllocation(const ObjectID &object_id,
+                                        const ObjectID &canonical_id) {
+  auto entry = GetMutableObject(object_id);
+  auto canonical = GetMutableObject(canonical_id);
+  if (entry == nullptr || canonical == nullptr || entry == canonical) {
+    return false;
+  }
+  if (!entry->Sealed() || !canonical->Sealed()) {
+    return false;
+  }
+  const auto &shared = canonical->allocation_;
+  if (shared.address_ == nullptr || entry->allocation_.address_ == nullptr ||
+      shared.address_ == entry->allocation_.address_) {
+    return false;
+  }
+  // Aliasing an already-shared allocation onto another one is not supported;
+  // the caller only deduplicates exclusively owned blocks.
+  if (shared_allocation_refs_.contains(entry->allocation_.address_)) {
+    return false;
+  }
+  RAY_CHECK_EQ(entry->GetRefCount(), 0)
+      << "To alias an object's allocation, there must be no clients using it.";
+  allocator_.Free(std::move(entry->allocation_));
+  entry->allocation_ = Allocation(shared.address_,
+                                  shared.size_,
+                                  shared.fd_,
+                                  shared.offset_,
+                                  shared.device_num_,
+                                  shared.mmap_size_,
+                                  shared.fallback_allocated_);
+  auto [it, inserted] = shared_allocation_refs_.emplace(shared.address_, 2);
+  if (!inserted) {
+    it->second += 1;
+  }
+  return true;
+}
+
 LocalObject *ObjectStore::GetMutableObject(const ObjectID &object_id) {
   auto it = object_table_.find(object_id);
   if (it == object_table_.end()) {
@@ -96,4 +207,223 @@ LocalObject *ObjectStore::GetMutableObject(const ObjectID &object_id) {
   return it->second.get();
 }
 
+namespace {
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 1;
+  while (result < n) {
+    result <<= 1;
+  }
+  return result;
+}
+}  // namespace
+
+ShardedObjectStore::ShardedObjectStore(IAllocator &allocator, size_t num_shards)
+    : allocator_(allocator),
+      shards_(RoundUpToPowerOfTwo(std::max<size_t>(num_shards, 1))),
+      shard_mask_(shards_.size() - 1) {}
+
+ShardedObjectStore::Shard &ShardedObjectStore::GetShard(const ObjectID &object_id) {
+  return shards_[object_id.Hash() & shard_mask_];
+}
+
+const ShardedObjectStore::Shard &ShardedObjectStore::GetShard(
+    const ObjectID &object_id) const {
+  return shards_[object_id.Hash() & shard_mask_];
+}
+
+const LocalObject *ShardedObjectStore::CreateObject(const ray::ObjectInfo &object_info,
+                                                    plasma::flatbuf::ObjectSource source,
+                                                    bool fallback_allocate) {
+  RAY_LOG(DEBUG) << "attempting to create object " << object_info.object_id << " size "
+                 << object_info.data_size;
+  auto &shard = GetShard(object_info.object_id);
+  RAY_CHECK(!shard.contains(object_info.object_id))
+      << object_info.object_id << " already exists!";
+  auto object_size = object_info.GetObjectSize();
+  auto allocation = fallback_allocate ? allocator_.FallbackAllocate(object_size)
+                                      : allocator_.Allocate(object_size);
+  RAY_LOG_EVERY_MS(INFO, 10 * 60 * 1000)
+      << "Object store current usage " << (allocator_.Allocated() / 1e9) << " / "
+      << (allocator_.GetFootprintLimit() / 1e9) << " GB.";
+  if (!allocation.has_value()) {
+    return nullptr;
+  }
+  auto ptr = std::make_unique<LocalObject>(std::move(allocation.value()));
+  auto entry = shard.emplace(object_info.object_id, std::move(ptr)).first->second.get();
+  entry->object_info_ = object_info;
+  entry->state_ = ObjectState::PLASMA_CREATED;
+  entry->create_time_ = std::time(nullptr);
+  entry->construct_duration_ = -1;
+  entry->source_ = source;
+
+#if defined(__APPLE__) || defined(__linux__)
+  if (object_info.is_mutable) {
+    RAY_LOG(DEBUG) << "PlasmaObjectHeader::Init " << object_info.object_id;
+    entry->GetPlasmaObjectHeader()->Init();
+  }
+#endif
+
+  RAY_LOG(DEBUG) << "create object " << object_info.object_id << " succeeded";
+  return entry;
+}
+
+const LocalObject *ShardedObjectStore::AddRestoredObject(
+    const ray::ObjectInfo &object_info,
+    plasma::flatbuf::ObjectSource source,
+    Allocation allocation) {
+  auto &shard = GetShard(object_info.object_id);
+  RAY_CHECK(!shard.contains(object_info.object_id))
+      << object_info.object_id << " already exists!";
+  auto ptr = std::make_unique<LocalObject>(std::move(allocation));
+  auto entry = shard.emplace(object_info.object_id, std::move(ptr)).first->second.get();
+  entry->object_info_ = object_info;
+  entry->state_ = ObjectState::PLASMA_SEALED;
+  entry->create_time_ = std::time(nullptr);
+  entry->construct_duration_ = 0;
+  entry->source_ = source;
+  entry->metadata_precedes_data_ = true;
+  return entry;
+}
+
+const LocalObject *ShardedObjectStore::GetObject(const ObjectID &object_id) const {
+  const auto &shard = GetShard(object_id);
+  auto it = shard.find(object_id);
+  if (it == shard.end()) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
+std::vector<const LocalObject *> ShardedObjectStore::GetObjects(
+    const std::vector<ObjectID> &object_ids) const {
+  std::vector<const LocalObject *> entries(object_ids.size(), nullptr);
+  // Group the lookups by shard so each shard's table is probed in one pass
+  // rather than bouncing between tables for every id.
+  std::vector<std::vector<size_t>> indices_per_shard(shards_.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    indices_per_shard[object_ids[i].Hash() & shard_mask_].push_back(i);
+  }
+  for (size_t shard_index = 0; shard_index < shards_.size(); shard_index++) {
+    const auto &shard = shards_[shard_index];
+    for (size_t i : indices_per_shard[shard_index]) {
+      auto it = shard.find(object_ids[i]);
+      if (it != shard.end()) {
+        entries[i] = it->second.get();
+      }
+    }
+  }
+  return entries;
+}
+
+const LocalObject *ShardedObjectStore::SealObject(const ObjectID &object_id) {
+  auto entry = GetMutableObject(object_id);
+  if (entry == nullptr || entry->state_ == ObjectState::PLASMA_SEALED) {
+    return nullptr;
+  }
+  entry->state_ = ObjectState::PLASMA_SEALED;
+  entry->construct_duration_ = std::time(nullptr) - entry->create_time_;
+  return entry;
+}
+
+bool ShardedObjectStore::DeleteObject(const ObjectID &object_id) {
+  auto entry = GetMutableObject(object_id);
+  if (entry == nullptr) {
+    return false;
+  }
+  // The entry has no backing memory if it is deleted after a relocation that
+  // could not re-allocate it.
+  if (entry->allocation_.address_ != nullptr) {
+    // A deduplicated allocation is freed only when its last sharer goes away.
+    auto shared_it = shared_allocation_refs_.find(entry->allocation_.address_);
+    if (shared_it != shared_allocation_refs_.end() && --shared_it->second > 0) {
+      // Another entry still references this block; drop our record of it
+      // without freeing.
+      entry->allocation_ = Allocation();
+    } else {
+      if (shared_it != shared_allocation_refs_.end()) {
+        shared_allocation_refs_.erase(shared_it);
+      }
+      allocator_.Free(std::move(entry->allocation_));
+    }
+  }
+  GetShard(object_id).erase(object_id);
+  return true;
+}
+
+void ShardedObjectStore::BeginObjectRelocation(const ObjectID &object_id) {
+  auto entry = GetMutableObject(object_id);
+  RAY_CHECK(entry != nullptr) << "To relocate an object it must be in the object table.";
+  RAY_CHECK(entry->Sealed()) << "To relocate an object it must have been sealed.";
+  RAY_CHECK_EQ(entry->GetRefCount(), 0)
+      << "To relocate an object, there must be no clients currently using it.";
+  RAY_CHECK(!shared_allocation_refs_.contains(entry->allocation_.address_))
+      << "Deduplicated allocations cannot be relocated.";
+  allocator_.Free(std::move(entry->allocation_));
+  entry->allocation_ = Allocation();
+}
+
+bool ShardedObjectStore::FinishObjectRelocation(const ObjectID &object_id,
+                                                const uint8_t *payload,
+                                                bool fallback_allocate) {
+  auto entry = GetMutableObject(object_id);
+  RAY_CHECK(entry != nullptr) << "To relocate an object it must be in the object table.";
+  RAY_CHECK(entry->allocation_.address_ == nullptr)
+      << "Object must have been evacuated before finishing a relocation.";
+  const auto object_size = entry->GetObjectSize();
+  auto allocation = fallback_allocate ? allocator_.FallbackAllocate(object_size)
+                                      : allocator_.Allocate(object_size);
+  if (!allocation.has_value()) {
+    return false;
+  }
+  std::memcpy(allocation->address_, payload, object_size);
+  entry->allocation_ = std::move(allocation.value());
+  return true;
+}
+
+bool ShardedObjectStore::AliasObjectAllocation(const ObjectID &object_id,
+                                               const ObjectID &canonical_id) {
+  auto entry = GetMutableObject(object_id);
+  auto canonical = GetMutableObject(canonical_id);
+  if (entry == nullptr || canonical == nullptr || entry == canonical) {
+    return false;
+  }
+  if (!entry->Sealed() || !canonical->Sealed()) {
+    return false;
+  }
+  const auto &shared = canonical->allocation_;
+  if (shared.address_ == nullptr || entry->allocation_.address_ == nullptr ||
+      shared.address_ == entry->allocation_.address_) {
+    return false;
+  }
+  // Aliasing an already-shared allocation onto another one is not supported;
+  // the caller only deduplicates exclusively owned blocks.
+  if (shared_allocation_refs_.contains(entry->allocation_.address_)) {
+    return false;
+  }
+  RAY_CHECK_EQ(entry->GetRefCount(), 0)
+      << "To alias an object's allocation, there must be no clients using it.";
+  allocator_.Free(std::move(entry->allocation_));
+  entry->allocation_ = Allocation(shared.address_,
+                                  shared.size_,
+                                  shared.fd_,
+                                  shared.offset_,
+                                  shared.device_num_,
+                                  shared.mmap_size_,
+                                  shared.fallback_allocated_);
+  auto [it, inserted] = shared_allocation_refs_.emplace(shared.address_, 2);
+  if (!inserted) {
+    it->second += 1;
+  }
+  return true;
+}
+
+LocalObject *ShardedObjectStore::GetMutableObject(const ObjectID &object_id) {
+  auto &shard = GetShard(object_id);
+  auto it = shard.find(object_id);
+  if (it == shard.end()) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
 }  // namespace plasma
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "ray/object_manager/plasma/allocator.h"
@@ -46,6 +47,20 @@ class IObjectStore {
                                           plasma::flatbuf::ObjectSource source,
                                           bool fallback_allocate) = 0;
 
+  /// Add an already-sealed object backed by an externally created
+  /// allocation, such as a mapped spill file record. The allocation is
+  /// released through the allocator on deletion like any other.
+  /// NOTE: It ABORTs the program if an object with the same id already exists.
+  ///
+  /// \param object_info Plasma object info.
+  /// \param source From where the object is created.
+  /// \param allocation Allocation holding the object payload, laid out with
+  /// the metadata immediately before the data.
+  /// \return pointer to the added object.
+  virtual const LocalObject *AddRestoredObject(const ray::ObjectInfo &object_info,
+                                               plasma::flatbuf::ObjectSource source,
+                                               Allocation allocation) = 0;
+
   /// Get object by id.
   ///
   /// \param object_id Object ID of the object to be sealed.
@@ -54,6 +69,14 @@ class IObjectStore {
   ///   - otherwise, pointer to the object.
   virtual const LocalObject *GetObject(const ObjectID &object_id) const = 0;
 
+  /// Get multiple objects in one batch.
+  ///
+  /// \param object_ids Object IDs to look up.
+  /// \return pointers aligned with \p object_ids; nullptr where the object
+  /// doesn't exist.
+  virtual std::vector<const LocalObject *> GetObjects(
+      const std::vector<ObjectID> &object_ids) const = 0;
+
   /// Seal created object by id.
   ///
   /// \param object_id Object ID of the object to be sealed.
@@ -69,6 +92,42 @@ class IObjectStore {
   ///   - false if such object doesn't exist.
   ///   - true if deleted.
   virtual bool DeleteObject(const ObjectID &object_id) = 0;
+
+  /// Free the allocation backing a sealed, unreferenced object while keeping
+  /// its entry, as the first half of a compaction relocation. The caller must
+  /// have copied the payload out beforehand and must either complete the
+  /// relocation with FinishObjectRelocation or delete the object; until then
+  /// the entry has no backing memory.
+  ///
+  /// \param object_id Object ID of the object to be evacuated.
+  virtual void BeginObjectRelocation(const ObjectID &object_id) = 0;
+
+  /// Back an evacuated entry with a freshly allocated block and restore its
+  /// payload.
+  ///
+  /// \param object_id Object ID of the object being relocated.
+  /// \param payload The payload saved before BeginObjectRelocation; must hold
+  /// the object's data and metadata (GetObjectSize() bytes).
+  /// \param fallback_allocate Whether to use fallback allocation.
+  /// \return false if no memory could be allocated; the entry remains without
+  /// a backing allocation and must be deleted by the caller.
+  virtual bool FinishObjectRelocation(const ObjectID &object_id,
+                                      const uint8_t *payload,
+                                      bool fallback_allocate) = 0;
+
+  /// Make object_id's entry share canonical_id's allocation, freeing its own.
+  /// Used by content deduplication once identical payloads have been
+  /// verified. Both objects must be sealed with distinct backing allocations,
+  /// and no client may be using object_id (its current allocation is freed).
+  /// The shared block is reference counted and freed once the last sharing
+  /// entry is deleted.
+  ///
+  /// \param object_id Object whose allocation is replaced.
+  /// \param canonical_id Object whose allocation becomes shared.
+  /// \return false if either object is missing, unsealed, or they already
+  /// share an allocation.
+  virtual bool AliasObjectAllocation(const ObjectID &object_id,
+                                     const ObjectID &canonical_id) = 0;
 };
 
 // ObjectStore implements IObjectStore. It uses IAllocator
@@ -81,12 +140,28 @@ class ObjectStore : public IObjectStore {
                                   plasma::flatbuf::ObjectSource source,
                                   bool fallback_allocate) override;
 
+  const LocalObject *AddRestoredObject(const ray::ObjectInfo &object_info,
+                                       plasma::flatbuf::ObjectSource source,
+                                       Allocation allocation) override;
+
   const LocalObject *GetObject(const ObjectID &object_id) const override;
 
+  std::vector<const LocalObject *> GetObjects(
+      const std::vector<ObjectID> &object_ids) const override;
+
   const LocalObject *SealObject(const ObjectID &object_id) override;
 
   bool DeleteObject(const ObjectID &object_id) override;
 
+  void BeginObjectRelocation(const ObjectID &object_id) override;
+
+  bool FinishObjectRelocation(const ObjectID &object_id,
+                              const uint8_t *payload,
+                              bool fallback_allocate) override;
+
+  bool AliasObjectAllocation(const ObjectID &object_id,
+                             const ObjectID &canonical_id) override;
+
  private:
   friend struct ObjectStatsCollectorTest;
 
@@ -97,5 +172,73 @@ class ObjectStore : public IObjectStore {
 
   /// Mapping from ObjectIDs to information about the object.
   absl::flat_hash_map<ObjectID, std::unique_ptr<LocalObject>> object_table_;
+
+  /// Number of entries sharing each deduplicated allocation, keyed by the
+  /// allocation address. Absent means the allocation is exclusively owned.
+  absl::flat_hash_map<void *, size_t> shared_allocation_refs_;
+};
+
+// ShardedObjectStore implements IObjectStore with the object index split
+// across multiple open-addressing hash maps, selected by object id hash.
+// Compared to a single map, sharding bounds the cost of rehashing and keeps
+// probe sequences short when the store holds tens of millions of entries,
+// which removes the lookup tail-latency cliffs seen with one large table.
+// Like ObjectStore, it's not thread safe.
+class ShardedObjectStore : public IObjectStore {
+ public:
+  /// \param allocator The allocator used for object creation.
+  /// \param num_shards Number of index shards. Rounded up to the next
+  /// power of two; must be at least 1.
+  ShardedObjectStore(IAllocator &allocator, size_t num_shards);
+
+  const LocalObject *CreateObject(const ray::ObjectInfo &object_info,
+                                  plasma::flatbuf::ObjectSource source,
+                                  bool fallback_allocate) override;
+
+  const LocalObject *AddRestoredObject(const ray::ObjectInfo &object_info,
+                                       plasma::flatbuf::ObjectSource source,
+                                       Allocation allocation) override;
+
+  const LocalObject *GetObject(const ObjectID &object_id) const override;
+
+  /// Groups the lookups by shard and resolves each shard's group in one
+  /// pass, so probe sequences stay within one table at a time.
+  std::vector<const LocalObject *> GetObjects(
+      const std::vector<ObjectID> &object_ids) const override;
+
+  const LocalObject *SealObject(const ObjectID &object_id) override;
+
+  bool DeleteObject(const ObjectID &object_id) override;
+
+  void BeginObjectRelocation(const ObjectID &object_id) override;
+
+  bool FinishObjectRelocation(const ObjectID &object_id,
+                              const uint8_t *payload,
+                              bool fallback_allocate) override;
+
+  bool AliasObjectAllocation(const ObjectID &object_id,
+                             const ObjectID &canonical_id) override;
+
+ private:
+  using Shard = absl::flat_hash_map<ObjectID, std::unique_ptr<LocalObject>>;
+
+  Shard &GetShard(const ObjectID &object_id);
+  const Shard &GetShard(const ObjectID &object_id) const;
+
+  LocalObject *GetMutableObject(const ObjectID &object_id);
+
+  /// Allocator that allocates memory.
+  IAllocator &allocator_;
+
+  /// Index shards. The size is a power of two so the shard can be selected
+  /// with a mask instead of a modulo on the hot path.
+  std::vector<Shard> shards_;
+
+  /// shards_.size() - 1, cached for shard selection.
+  size_t shard_mask_;
+
+  /// Number of entries sharing each deduplicated allocation, keyed by the
+  /// allocation address. Absent means the allocation is exclusively owned.
+  absl::flat_hash_map<void *, size_t> shared_allocation_refs_;
 };
 }  // namespace plasma
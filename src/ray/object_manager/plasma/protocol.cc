@@ -43,6 +43,9 @@ inline constexpr std::string_view kObjectIds = "object_ids";
 inline constexpr std::string_view kOwnerNodeId = "owner_node_id";
 inline constexpr std::string_view kOwnerIpAddress = "owner_ip_address";
 inline constexpr std::string_view kOnwerWorkerId = "owner_worker_id";
+inline constexpr std::string_view kEntries = "entries";
+inline constexpr std::string_view kErrors = "errors";
+inline constexpr std::string_view kSpilledUrl = "spilled_url";
 
 /// \brief Returns maybe_null if not null or a non-null pointer to an arbitrary memory
 /// that shouldn't be dereferenced.
@@ -344,6 +347,167 @@ Status ReadCreateReply(uint8_t *data,
   return PlasmaErrorStatus(message->error());
 }
 
+// BatchCreate messages.
+
+Status SendBatchCreateRequest(const std::shared_ptr<StoreConn> &store_conn,
+                              const std::vector<ObjectID> &object_ids,
+                              const ray::rpc::Address &owner_address,
+                              const std::vector<std::string> &data,
+                              const std::vector<std::string> &metadata,
+                              flatbuf::ObjectSource source) {
+  RAY_CHECK(object_ids.size() == data.size() && object_ids.size() == metadata.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::PlasmaBatchCreateEntry>> entries;
+  entries.reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    entries.push_back(fb::CreatePlasmaBatchCreateEntry(
+        fbb,
+        fbb.CreateString(object_ids[i].Binary()),
+        fbb.CreateVector(MakeNonNull(reinterpret_cast<const uint8_t *>(data[i].data())),
+                         data[i].size()),
+        fbb.CreateVector(
+            MakeNonNull(reinterpret_cast<const uint8_t *>(metadata[i].data())),
+            metadata[i].size())));
+  }
+  auto message = fb::CreatePlasmaBatchCreateRequest(
+      fbb,
+      fbb.CreateString(owner_address.node_id()),
+      fbb.CreateString(owner_address.ip_address()),
+      owner_address.port(),
+      fbb.CreateString(owner_address.worker_id()),
+      source,
+      fbb.CreateVector(MakeNonNull(entries.data()), entries.size()));
+  return PlasmaSend(store_conn, MessageType::PlasmaBatchCreateRequest, &fbb, message);
+}
+
+void ReadBatchCreateRequest(const uint8_t *data,
+                            size_t size,
+                            std::vector<ray::ObjectInfo> *object_infos,
+                            flatbuf::ObjectSource *source,
+                            std::vector<const uint8_t *> *data_ptrs,
+                            std::vector<const uint8_t *> *metadata_ptrs) {
+  RAY_DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaBatchCreateRequest>(data);
+  RAY_DCHECK(VerifyFlatbuffer(message, data, size));
+  VerifyNotNullPtr(
+      message->owner_node_id(), kOwnerNodeId, MessageType::PlasmaBatchCreateRequest);
+  VerifyNotNullPtr(message->owner_ip_address(),
+                   kOwnerIpAddress,
+                   MessageType::PlasmaBatchCreateRequest);
+  VerifyNotNullPtr(
+      message->owner_worker_id(), kOnwerWorkerId, MessageType::PlasmaBatchCreateRequest);
+  VerifyNotNullPtr(message->entries(), kEntries, MessageType::PlasmaBatchCreateRequest);
+  const auto owner_node_id = NodeID::FromBinary(message->owner_node_id()->str());
+  const auto owner_ip_address = message->owner_ip_address()->str();
+  const auto owner_worker_id = WorkerID::FromBinary(message->owner_worker_id()->str());
+  *source = message->source();
+  object_infos->clear();
+  data_ptrs->clear();
+  metadata_ptrs->clear();
+  object_infos->reserve(message->entries()->size());
+  data_ptrs->reserve(message->entries()->size());
+  metadata_ptrs->reserve(message->entries()->size());
+  for (uoffset_t i = 0; i < message->entries()->size(); i++) {
+    const auto *entry = message->entries()->Get(i);
+    VerifyNotNullPtr(
+        entry->object_id(), kObjectId, MessageType::PlasmaBatchCreateRequest);
+    ray::ObjectInfo object_info;
+    object_info.object_id = ObjectID::FromBinary(entry->object_id()->str());
+    object_info.data_size = entry->data() != nullptr ? entry->data()->size() : 0;
+    object_info.metadata_size =
+        entry->metadata() != nullptr ? entry->metadata()->size() : 0;
+    object_info.owner_node_id = owner_node_id;
+    object_info.owner_ip_address = owner_ip_address;
+    object_info.owner_port = message->owner_port();
+    object_info.owner_worker_id = owner_worker_id;
+    object_infos->push_back(object_info);
+    data_ptrs->push_back(entry->data() != nullptr ? entry->data()->data() : nullptr);
+    metadata_ptrs->push_back(entry->metadata() != nullptr ? entry->metadata()->data()
+                                                          : nullptr);
+  }
+}
+
+Status SendBatchCreateReply(const std::shared_ptr<Client> &client,
+                            const std::vector<ObjectID> &object_ids,
+                            const std::vector<PlasmaError> &errors) {
+  RAY_DCHECK(object_ids.size() == errors.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaBatchCreateReply(
+      fbb,
+      ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(errors.data(), errors.size()));
+  return PlasmaSend(client, MessageType::PlasmaBatchCreateReply, &fbb, message);
+}
+
+Status ReadBatchCreateReply(uint8_t *data,
+                            size_t size,
+                            std::vector<ObjectID> *object_ids,
+                            std::vector<PlasmaError> *errors) {
+  RAY_DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaBatchCreateReply>(data);
+  RAY_DCHECK(VerifyFlatbuffer(message, data, size));
+  VerifyNotNullPtr(
+      message->object_ids(), kObjectIds, MessageType::PlasmaBatchCreateReply);
+  VerifyNotNullPtr(message->errors(), kErrors, MessageType::PlasmaBatchCreateReply);
+  object_ids->clear();
+  errors->clear();
+  object_ids->reserve(message->object_ids()->size());
+  errors->reserve(message->object_ids()->size());
+  for (uoffset_t i = 0; i < message->object_ids()->size(); i++) {
+    object_ids->push_back(ObjectID::FromBinary(message->object_ids()->Get(i)->str()));
+    errors->push_back(static_cast<PlasmaError>(message->errors()->Get(i)));
+  }
+  return Status::OK();
+}
+
+// RestoreSpilledObject messages.
+
+Status SendRestoreSpilledObjectRequest(const std::shared_ptr<StoreConn> &store_conn,
+                                       ObjectID object_id,
+                                       const std::string &spilled_url) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaRestoreSpilledObjectRequest(
+      fbb, fbb.CreateString(object_id.Binary()), fbb.CreateString(spilled_url));
+  return PlasmaSend(store_conn, MessageType::PlasmaRestoreSpilledObjectRequest, &fbb, message);
+}
+
+void ReadRestoreSpilledObjectRequest(const uint8_t *data,
+                                     size_t size,
+                                     ObjectID *object_id,
+                                     std::string *spilled_url) {
+  RAY_DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaRestoreSpilledObjectRequest>(data);
+  RAY_DCHECK(VerifyFlatbuffer(message, data, size));
+  VerifyNotNullPtr(message->object_id(),
+                   kObjectId,
+                   MessageType::PlasmaRestoreSpilledObjectRequest);
+  VerifyNotNullPtr(message->spilled_url(),
+                   kSpilledUrl,
+                   MessageType::PlasmaRestoreSpilledObjectRequest);
+  *object_id = ObjectID::FromBinary(message->object_id()->str());
+  *spilled_url = message->spilled_url()->str();
+}
+
+Status SendRestoreSpilledObjectReply(const std::shared_ptr<Client> &client,
+                                     ObjectID object_id,
+                                     PlasmaError error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaRestoreSpilledObjectReply(
+      fbb, fbb.CreateString(object_id.Binary()), error);
+  return PlasmaSend(client, MessageType::PlasmaRestoreSpilledObjectReply, &fbb, message);
+}
+
+void ReadRestoreSpilledObjectReply(uint8_t *data,
+                                   size_t size,
+                                   ObjectID *object_id,
+                                   PlasmaError *error) {
+  RAY_DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaRestoreSpilledObjectReply>(data);
+  RAY_DCHECK(VerifyFlatbuffer(message, data, size));
+  *object_id = ObjectID::FromBinary(message->object_id()->str());
+  *error = message->error();
+}
+
 Status SendAbortRequest(const std::shared_ptr<StoreConn> &store_conn,
                         ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
@@ -450,6 +614,32 @@ Status ReadReleaseReply(uint8_t *data,
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendBatchReleaseRequest(const std::shared_ptr<StoreConn> &store_conn,
+                               const std::vector<ObjectID> &object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaBatchReleaseRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(store_conn, MessageType::PlasmaBatchReleaseRequest, &fbb, message);
+}
+
+void ReadBatchReleaseRequest(const uint8_t *data,
+                             size_t size,
+                             std::vector<ObjectID> *object_ids) {
+  RAY_DCHECK(data);
+  RAY_DCHECK(object_ids);
+  auto message = flatbuffers::GetRoot<fb::PlasmaBatchReleaseRequest>(data);
+  RAY_DCHECK(VerifyFlatbuffer(message, data, size));
+  VerifyNotNullPtr(
+      message->object_ids(), kObjectIds, MessageType::PlasmaBatchReleaseRequest);
+  object_ids->clear();
+  object_ids->reserve(message->object_ids()->size());
+  for (uoffset_t i = 0; i < message->object_ids()->size(); i++) {
+    VerifyNotNullPtr(
+        message->object_ids()->Get(i), kObjectId, MessageType::PlasmaBatchReleaseRequest);
+    object_ids->push_back(ObjectID::FromBinary(message->object_ids()->Get(i)->str()));
+  }
+}
+
 // Delete objects messages.
 
 Status SendDeleteRequest(const std::shared_ptr<StoreConn> &store_conn,
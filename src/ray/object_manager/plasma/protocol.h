@@ -119,6 +119,57 @@ Status ReadCreateReply(uint8_t *data,
                        MEMFD_TYPE *store_fd,
                        int64_t *mmap_size);
 
+/* Plasma BatchCreate message functions. */
+
+/// Sends a batch of small objects to be created and sealed in one exchange.
+/// The payloads are copied into shared memory by the store; entries at index
+/// i of object_ids, data and metadata describe one object.
+Status SendBatchCreateRequest(const std::shared_ptr<StoreConn> &store_conn,
+                              const std::vector<ObjectID> &object_ids,
+                              const ray::rpc::Address &owner_address,
+                              const std::vector<std::string> &data,
+                              const std::vector<std::string> &metadata,
+                              flatbuf::ObjectSource source);
+
+/// Reads a batch create request. The data/metadata pointers index into the
+/// request buffer and stay valid only while it is alive; their sizes are the
+/// data_size/metadata_size fields of the corresponding ObjectInfo.
+void ReadBatchCreateRequest(const uint8_t *data,
+                            size_t size,
+                            std::vector<ray::ObjectInfo> *object_infos,
+                            flatbuf::ObjectSource *source,
+                            std::vector<const uint8_t *> *data_ptrs,
+                            std::vector<const uint8_t *> *metadata_ptrs);
+
+Status SendBatchCreateReply(const std::shared_ptr<Client> &client,
+                            const std::vector<ObjectID> &object_ids,
+                            const std::vector<PlasmaError> &errors);
+
+Status ReadBatchCreateReply(uint8_t *data,
+                            size_t size,
+                            std::vector<ObjectID> *object_ids,
+                            std::vector<PlasmaError> *errors);
+
+/* Plasma RestoreSpilledObject message functions. */
+
+Status SendRestoreSpilledObjectRequest(const std::shared_ptr<StoreConn> &store_conn,
+                                       ObjectID object_id,
+                                       const std::string &spilled_url);
+
+void ReadRestoreSpilledObjectRequest(const uint8_t *data,
+                                     size_t size,
+                                     ObjectID *object_id,
+                                     std::string *spilled_url);
+
+Status SendRestoreSpilledObjectReply(const std::shared_ptr<Client> &client,
+                                     ObjectID object_id,
+                                     PlasmaError error);
+
+void ReadRestoreSpilledObjectReply(uint8_t *data,
+                                   size_t size,
+                                   ObjectID *object_id,
+                                   PlasmaError *error);
+
 Status SendAbortRequest(const std::shared_ptr<StoreConn> &store_conn, ObjectID object_id);
 
 void ReadAbortRequest(const uint8_t *data, size_t size, ObjectID *object_id);
@@ -187,6 +238,15 @@ Status ReadReleaseReply(uint8_t *data,
                         ObjectID *object_id,
                         bool *should_unmap);
 
+/// Sends a single release message covering every object in object_ids. Only
+/// valid for objects that are not fallback-allocated; the store never replies.
+Status SendBatchReleaseRequest(const std::shared_ptr<StoreConn> &store_conn,
+                               const std::vector<ObjectID> &object_ids);
+
+void ReadBatchReleaseRequest(const uint8_t *data,
+                             size_t size,
+                             std::vector<ObjectID> *object_ids);
+
 /* Plasma Delete objects message functions. */
 
 Status SendDeleteRequest(const std::shared_ptr<StoreConn> &store_conn,
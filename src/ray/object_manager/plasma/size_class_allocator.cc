@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ray/object_manager/plasma/size_class_allocator.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "ray/util/logging.h"
+
+namespace plasma {
+
+namespace {
+
+// Matches kAllocationAlignment in plasma_allocator.cc; the smallest size
+// class, so every block stays 64-byte aligned within its slab.
+constexpr size_t kMinClassSize = 64;
+
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = kMinClassSize;
+  while (result < n) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+SizeClassAllocator::SizeClassAllocator(IAllocator &base,
+                                       size_t small_object_threshold,
+                                       size_t slab_size)
+    : base_(base),
+      small_object_threshold_(RoundUpToPowerOfTwo(small_object_threshold)),
+      slab_size_(slab_size) {
+  RAY_CHECK(slab_size_ >= small_object_threshold_)
+      << "Slab size " << slab_size_ << " is smaller than the small object threshold "
+      << small_object_threshold_;
+  for (size_t size = kMinClassSize; size <= small_object_threshold_; size <<= 1) {
+    class_sizes_.push_back(size);
+  }
+  partial_slabs_.resize(class_sizes_.size());
+  num_empty_slabs_.resize(class_sizes_.size(), 0);
+}
+
+size_t SizeClassAllocator::SizeClassIndex(size_t bytes) const {
+  size_t index = 0;
+  while (class_sizes_[index] < bytes) {
+    index++;
+  }
+  return index;
+}
+
+SizeClassAllocator::Slab *SizeClassAllocator::AllocateSlab(size_t size_class) {
+  auto allocation = base_.Allocate(slab_size_);
+  if (!allocation.has_value()) {
+    return nullptr;
+  }
+  auto slab = std::make_unique<Slab>(std::move(allocation.value()));
+  slab->size_class = size_class;
+  const size_t block_size = class_sizes_[size_class];
+  slab->num_blocks = slab_size_ / block_size;
+  slab->free_blocks.reserve(slab->num_blocks);
+  auto *base_addr = static_cast<char *>(slab->allocation.address_);
+  // Push blocks in reverse so allocation proceeds from the slab start.
+  for (size_t i = slab->num_blocks; i > 0; i--) {
+    slab->free_blocks.push_back(base_addr + (i - 1) * block_size);
+  }
+  Slab *result = slab.get();
+  slabs_by_address_.emplace(reinterpret_cast<uintptr_t>(base_addr), std::move(slab));
+  partial_slabs_[size_class].push_back(result);
+  return result;
+}
+
+Allocation SizeClassAllocator::MakeBlockAllocation(const Slab &slab, void *block) const {
+  const auto block_offset = static_cast<char *>(block) -
+                            static_cast<char *>(slab.allocation.address_);
+  return Allocation(block,
+                    static_cast<int64_t>(class_sizes_[slab.size_class]),
+                    slab.allocation.fd_,
+                    slab.allocation.offset_ + block_offset,
+                    slab.allocation.device_num_,
+                    slab.allocation.mmap_size_,
+                    /*fallback_allocated=*/false);
+}
+
+std::optional<Allocation> SizeClassAllocator::Allocate(size_t bytes) {
+  if (bytes >= small_object_threshold_) {
+    return base_.Allocate(bytes);
+  }
+  const size_t size_class = SizeClassIndex(std::max(bytes, kMinClassSize));
+  auto &partial = partial_slabs_[size_class];
+  if (partial.empty() && AllocateSlab(size_class) == nullptr) {
+    return std::nullopt;
+  }
+  Slab *slab = partial.back();
+  if (slab->free_blocks.size() == slab->num_blocks) {
+    // We're carving into a fully free slab.
+    RAY_CHECK_GT(num_empty_slabs_[size_class], static_cast<size_t>(0));
+    num_empty_slabs_[size_class]--;
+  }
+  void *block = slab->free_blocks.back();
+  slab->free_blocks.pop_back();
+  if (slab->free_blocks.empty()) {
+    partial.pop_back();
+  }
+  return MakeBlockAllocation(*slab, block);
+}
+
+std::optional<Allocation> SizeClassAllocator::FallbackAllocate(size_t bytes) {
+  return base_.FallbackAllocate(bytes);
+}
+
+void SizeClassAllocator::Free(Allocation allocation) {
+  RAY_CHECK(allocation.address_ != nullptr) << "Cannot free the nullptr";
+  // Find the slab whose range contains this address, if any.
+  const auto addr = reinterpret_cast<uintptr_t>(allocation.address_);
+  auto it = slabs_by_address_.upper_bound(addr);
+  if (it != slabs_by_address_.begin()) {
+    --it;
+    Slab &slab = *it->second;
+    if (addr < it->first + slab_size_) {
+      const size_t size_class = slab.size_class;
+      if (slab.free_blocks.empty()) {
+        partial_slabs_[size_class].push_back(&slab);
+      }
+      slab.free_blocks.push_back(allocation.address_);
+      if (slab.free_blocks.size() == slab.num_blocks) {
+        num_empty_slabs_[size_class]++;
+        // Bulk reclamation: cache one empty slab per class for reuse and
+        // return the rest to the base allocator.
+        if (num_empty_slabs_[size_class] > 1) {
+          auto &partial = partial_slabs_[size_class];
+          partial.erase(std::find(partial.begin(), partial.end(), &slab));
+          num_empty_slabs_[size_class]--;
+          Allocation slab_allocation = std::move(slab.allocation);
+          slabs_by_address_.erase(it);
+          base_.Free(std::move(slab_allocation));
+        }
+      }
+      return;
+    }
+  }
+  // Not slab-backed: a large or fallback allocation owned by the base.
+  base_.Free(std::move(allocation));
+}
+
+int64_t SizeClassAllocator::GetFootprintLimit() const {
+  return base_.GetFootprintLimit();
+}
+
+int64_t SizeClassAllocator::Allocated() const { return base_.Allocated(); }
+
+int64_t SizeClassAllocator::FallbackAllocated() const {
+  return base_.FallbackAllocated();
+}
+
+}  // namespace plasma
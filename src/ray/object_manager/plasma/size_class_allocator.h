@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ray/object_manager/plasma/allocator.h"
+#include "ray/object_manager/plasma/common.h"
+
+namespace plasma {
+
+// SizeClassAllocator serves allocations below a configurable threshold from
+// slabs carved out of a base allocator. Each slab belongs to one power-of-two
+// size class and keeps its own free-block list, so freeing a small object is a
+// push onto the slab's list instead of a dlmalloc coalescing pass, and dead
+// space stays bounded by the per-class slab granularity rather than growing
+// with heap age. Slabs that become fully free are returned to the base
+// allocator in bulk (at most one empty slab per class is cached). Allocations
+// at or above the threshold, and all fallback allocations, are delegated to
+// the base allocator untouched.
+//
+// Like the base allocator, this class is not thread safe.
+class SizeClassAllocator : public IAllocator {
+ public:
+  /// \param base The allocator slabs and large allocations come from.
+  /// \param small_object_threshold Allocations strictly below this many bytes
+  /// are served from size-class slabs. Rounded up to the next power of two.
+  /// \param slab_size Number of bytes requested from the base allocator per
+  /// slab. Must be at least the rounded threshold.
+  SizeClassAllocator(IAllocator &base, size_t small_object_threshold, size_t slab_size);
+
+  std::optional<Allocation> Allocate(size_t bytes) override;
+
+  std::optional<Allocation> FallbackAllocate(size_t bytes) override;
+
+  void Free(Allocation allocation) override;
+
+  int64_t GetFootprintLimit() const override;
+
+  int64_t Allocated() const override;
+
+  int64_t FallbackAllocated() const override;
+
+ private:
+  struct Slab {
+    /// The backing allocation from the base allocator.
+    Allocation allocation;
+    /// Index into class_sizes_.
+    size_t size_class;
+    /// Free blocks within this slab.
+    std::vector<void *> free_blocks;
+    /// Total number of blocks this slab was carved into.
+    size_t num_blocks;
+
+    explicit Slab(Allocation alloc) : allocation(std::move(alloc)) {}
+  };
+
+  /// Returns the index of the smallest size class that fits bytes.
+  size_t SizeClassIndex(size_t bytes) const;
+
+  /// Carves a new slab for the given size class out of the base allocator.
+  /// Returns nullptr if the base allocator is out of space.
+  Slab *AllocateSlab(size_t size_class);
+
+  /// Builds the client-visible Allocation for a block within a slab.
+  Allocation MakeBlockAllocation(const Slab &slab, void *block) const;
+
+  IAllocator &base_;
+
+  /// Allocations of at least this many bytes bypass the size classes.
+  const size_t small_object_threshold_;
+
+  /// Bytes requested from the base allocator per slab.
+  const size_t slab_size_;
+
+  /// Block sizes of the size classes, ascending powers of two.
+  std::vector<size_t> class_sizes_;
+
+  /// Per size class, the slabs that still have at least one free block.
+  std::vector<std::vector<Slab *>> partial_slabs_;
+
+  /// Per size class, how many of the partial slabs are fully free.
+  std::vector<size_t> num_empty_slabs_;
+
+  /// All live slabs keyed by slab start address, for owner lookup on Free.
+  std::map<uintptr_t, std::unique_ptr<Slab>> slabs_by_address_;
+};
+
+}  // namespace plasma
@@ -0,0 +1,200 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/plasma/spill_file_mapper.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <regex>
+#include <utility>
+
+#include "ray/object_manager/plasma/malloc.h"
+#include "ray/util/logging.h"
+#include "src/ray/protobuf/common.pb.h"
+
+namespace plasma {
+
+namespace {
+
+// The spilled object record header: address size, metadata size and data
+// size, each a little-endian uint64, followed by the serialized owner
+// address. This mirrors SpilledObjectReader::ParseObjectHeader.
+constexpr uint64_t kHeaderFieldSize = sizeof(uint64_t);
+
+uint64_t ReadUINT64(const uint8_t *ptr) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < kHeaderFieldSize; i++) {
+    value |= static_cast<uint64_t>(ptr[i]) << (8 * i);
+  }
+  return value;
+}
+
+bool ParseObjectURL(const std::string &object_url,
+                    std::string &file_path,
+                    uint64_t &object_offset,
+                    uint64_t &object_size) {
+  static const std::regex object_url_pattern("^(.*)\\?offset=(\\d+)&size=(\\d+)$");
+  std::smatch match_groups;
+  if (!std::regex_match(object_url, match_groups, object_url_pattern) ||
+      match_groups.size() != 4) {
+    return false;
+  }
+  file_path = match_groups[1].str();
+  try {
+    object_offset = std::stoull(match_groups[2].str());
+    object_size = std::stoull(match_groups[3].str());
+  } catch (...) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+SpillFileMapper::SpillFileMapper(IAllocator &base) : base_(base) {}
+
+SpillFileMapper::~SpillFileMapper() {
+#ifndef _WIN32
+  for (auto &entry : mapped_regions_) {
+    munmap(entry.second.base, entry.second.length);
+    close(entry.second.fd);
+  }
+#endif
+}
+
+std::optional<Allocation> SpillFileMapper::Allocate(size_t bytes) {
+  return base_.Allocate(bytes);
+}
+
+std::optional<Allocation> SpillFileMapper::FallbackAllocate(size_t bytes) {
+  return base_.FallbackAllocate(bytes);
+}
+
+void SpillFileMapper::Free(Allocation allocation) {
+#ifndef _WIN32
+  auto it = mapped_regions_.find(allocation.address_);
+  if (it != mapped_regions_.end()) {
+    munmap(it->second.base, it->second.length);
+    close(it->second.fd);
+    mapped_bytes_ -= allocation.size_;
+    mapped_regions_.erase(it);
+    return;
+  }
+#endif
+  base_.Free(std::move(allocation));
+}
+
+int64_t SpillFileMapper::GetFootprintLimit() const { return base_.GetFootprintLimit(); }
+
+int64_t SpillFileMapper::Allocated() const { return base_.Allocated(); }
+
+int64_t SpillFileMapper::FallbackAllocated() const {
+  return base_.FallbackAllocated() + mapped_bytes_;
+}
+
+std::optional<Allocation> SpillFileMapper::MapSpilledObject(
+    const std::string &object_url, ray::ObjectInfo *object_info) {
+#ifdef _WIN32
+  return std::nullopt;
+#else
+  std::string file_path;
+  uint64_t object_offset = 0;
+  uint64_t object_size = 0;
+  if (!ParseObjectURL(object_url, file_path, object_offset, object_size)) {
+    RAY_LOG(WARNING) << "Failed to parse spill URL " << object_url;
+    return std::nullopt;
+  }
+
+  int fd = open(file_path.c_str(), O_RDWR);
+  if (fd < 0) {
+    RAY_LOG(WARNING) << "Failed to open spill file " << file_path << ": "
+                     << strerror(errno);
+    return std::nullopt;
+  }
+
+  struct stat file_stats {};
+  if (fstat(fd, &file_stats) != 0 ||
+      object_offset + object_size > static_cast<uint64_t>(file_stats.st_size) ||
+      object_size < 3 * kHeaderFieldSize) {
+    RAY_LOG(WARNING) << "Spill URL " << object_url
+                     << " is inconsistent with the file on disk.";
+    close(fd);
+    return std::nullopt;
+  }
+
+  // Map the file from offset 0 through the end of the record; clients always
+  // map received fds from the beginning of the file. The mapping is address
+  // space only, pages are faulted in from the page cache on access.
+  const size_t map_length = object_offset + object_size;
+  void *base = mmap(nullptr, map_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    RAY_LOG(WARNING) << "Failed to mmap spill file " << file_path << ": "
+                     << strerror(errno);
+    close(fd);
+    return std::nullopt;
+  }
+
+  const uint8_t *record = static_cast<const uint8_t *>(base) + object_offset;
+  const uint64_t address_size = ReadUINT64(record);
+  const uint64_t metadata_size = ReadUINT64(record + kHeaderFieldSize);
+  const uint64_t data_size = ReadUINT64(record + 2 * kHeaderFieldSize);
+  if (3 * kHeaderFieldSize + address_size + metadata_size + data_size != object_size) {
+    RAY_LOG(WARNING) << "Spilled object record at " << object_url
+                     << " has an inconsistent header.";
+    munmap(base, map_length);
+    close(fd);
+    return std::nullopt;
+  }
+
+  ray::rpc::Address owner_address;
+  if (!owner_address.ParseFromArray(record + 3 * kHeaderFieldSize, address_size)) {
+    RAY_LOG(WARNING) << "Failed to parse the owner address of the spilled object at "
+                     << object_url;
+    munmap(base, map_length);
+    close(fd);
+    return std::nullopt;
+  }
+
+  object_info->data_size = data_size;
+  object_info->metadata_size = metadata_size;
+  object_info->owner_node_id = ray::NodeID::FromBinary(owner_address.node_id());
+  object_info->owner_ip_address = owner_address.ip_address();
+  object_info->owner_port = owner_address.port();
+  object_info->owner_worker_id = ray::WorkerID::FromBinary(owner_address.worker_id());
+
+  const ptrdiff_t data_offset =
+      object_offset + 3 * kHeaderFieldSize + address_size + metadata_size;
+  void *data_address = static_cast<uint8_t *>(base) + data_offset;
+  mapped_regions_.emplace(data_address, MappedRegion{base, map_length, fd});
+  mapped_bytes_ += data_size + metadata_size;
+
+  // Clients subtract kMmapRegionsGap from the advertised mmap size before
+  // mapping, so add it here; the fd is shared like a fallback-allocated one.
+  return Allocation(data_address,
+                    data_size + metadata_size,
+                    MEMFD_TYPE{fd, internal::GetNextMmapUniqueId()},
+                    data_offset,
+                    /*device_num=*/0,
+                    map_length + kMmapRegionsGap,
+                    /*fallback_allocated=*/true);
+#endif
+}
+
+}  // namespace plasma
@@ -0,0 +1,93 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "ray/object_manager/common.h"
+#include "ray/object_manager/plasma/allocator.h"
+#include "ray/object_manager/plasma/common.h"
+
+namespace plasma {
+
+// SpillFileMapper serves restored objects straight from their spill files.
+// Instead of reading the spilled bytes back into a fresh plasma allocation,
+// it mmaps the spill file and hands out an Allocation that points at the
+// object's record inside the mapping. The file descriptor is shared with
+// clients exactly like a fallback-allocated mmap, so Get works unchanged and
+// the pages are populated lazily from the page cache.
+//
+// It wraps the regular allocator chain: allocations pass through untouched,
+// and Free unmaps the spill file when the freed allocation is one of its
+// mappings. Like the allocators it wraps, it's not thread safe; all calls
+// must come from the store thread.
+class SpillFileMapper : public IAllocator {
+ public:
+  explicit SpillFileMapper(IAllocator &base);
+
+  ~SpillFileMapper() override;
+
+  std::optional<Allocation> Allocate(size_t bytes) override;
+
+  std::optional<Allocation> FallbackAllocate(size_t bytes) override;
+
+  /// Unmaps the spill file if the allocation came from MapSpilledObject,
+  /// otherwise delegates to the wrapped allocator.
+  void Free(Allocation allocation) override;
+
+  int64_t GetFootprintLimit() const override;
+
+  int64_t Allocated() const override;
+
+  /// Includes the bytes of mapped spill file records, since like fallback
+  /// allocations they are disk backed rather than part of the main pool.
+  int64_t FallbackAllocated() const override;
+
+  /// Map the object record addressed by a local filesystem spill URL
+  /// ("{path}?offset={offset}&size={size}") and parse its header.
+  ///
+  /// On success fills the size and owner fields of \p object_info (the
+  /// object id is left untouched) and returns an Allocation whose address
+  /// points at the record's data section inside the mapping. The returned
+  /// allocation must be released through Free.
+  ///
+  /// Returns nullopt if the URL doesn't parse, the file can't be opened or
+  /// mapped, or the record header is inconsistent with the URL.
+  std::optional<Allocation> MapSpilledObject(const std::string &object_url,
+                                             ray::ObjectInfo *object_info);
+
+ private:
+  struct MappedRegion {
+    /// Base address of the mapping (file offset 0).
+    void *base;
+    /// Length of the mapping in bytes.
+    size_t length;
+    /// The spill file descriptor backing the mapping.
+    MEMFD_TYPE_NON_UNIQUE fd;
+  };
+
+  IAllocator &base_;
+
+  /// Live spill file mappings, keyed by the data address handed out in the
+  /// Allocation so Free can recognize them.
+  absl::flat_hash_map<void *, MappedRegion> mapped_regions_;
+
+  /// Total bytes of object payload served from spill file mappings.
+  int64_t mapped_bytes_ = 0;
+};
+
+}  // namespace plasma
@@ -17,12 +17,48 @@
 
 #include "ray/object_manager/plasma/stats_collector.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "absl/time/clock.h"
+#include "ray/common/ray_config.h"
 #include "ray/stats/tag_defs.h"
 
 namespace plasma {
 
+namespace {
+// Round up to the next power of two; size classes in the detailed breakdown
+// are labeled by their upper bound.
+int64_t SizeClassUpperBound(int64_t object_size) {
+  int64_t upper_bound = 1;
+  while (upper_bound < object_size) {
+    upper_bound *= 2;
+  }
+  return upper_bound;
+}
+}  // namespace
+
+ObjectStatsCollector::ObjectStatsCollector()
+    : detailed_stats_enabled_(RayConfig::instance().object_store_detailed_stats_enabled()) {
+  if (detailed_stats_enabled_) {
+    uint64_t capacity = 1;
+    while (capacity < RayConfig::instance().object_store_detailed_stats_ring_size()) {
+      capacity *= 2;
+    }
+    ring_.resize(capacity);
+    sampler_thread_ = std::thread(&ObjectStatsCollector::SamplerLoop, this);
+  }
+}
+
+ObjectStatsCollector::~ObjectStatsCollector() {
+  if (sampler_thread_.joinable()) {
+    sampler_stopped_.store(true, std::memory_order_release);
+    sampler_thread_.join();
+  }
+}
+
 void ObjectStatsCollector::OnObjectCreated(const LocalObject &obj) {
   const auto kObjectSize = obj.GetObjectInfo().GetObjectSize();
   const auto kSource = obj.GetSource();
@@ -60,6 +96,8 @@ void ObjectStatsCollector::OnObjectCreated(const LocalObject &obj) {
   RAY_CHECK(!obj.Sealed());
   num_objects_unsealed_++;
   num_bytes_unsealed_ += kObjectSize;
+
+  RecordDetailedEvent(obj, /*created=*/true);
 }
 
 void ObjectStatsCollector::OnObjectSealed(const LocalObject &obj) {
@@ -115,6 +153,8 @@ void ObjectStatsCollector::OnObjectDeleting(const LocalObject &obj) {
     num_bytes_in_use_ -= kObjectSize;
   }
 
+  RecordDetailedEvent(obj, /*created=*/false);
+
   if (!obj.Sealed()) {
     num_objects_unsealed_--;
     num_bytes_unsealed_ -= kObjectSize;
@@ -134,6 +174,13 @@ void ObjectStatsCollector::OnObjectDeleting(const LocalObject &obj) {
   }
 }
 
+void ObjectStatsCollector::OnObjectRelocatedToFallback(const LocalObject &obj) {
+  RAY_CHECK(obj.Sealed());
+  bytes_by_loc_seal_.Swap({/*fallback_allocated*/ false, /*sealed*/ true},
+                          {/*fallback_allocated*/ true, /*sealed*/ true},
+                          obj.GetObjectInfo().GetObjectSize());
+}
+
 void ObjectStatsCollector::OnObjectRefIncreased(const LocalObject &obj) {
   const auto kObjectSize = obj.GetObjectInfo().GetObjectSize();
   const auto kSource = obj.GetSource();
@@ -193,6 +240,85 @@ void ObjectStatsCollector::OnObjectRefDecreased(const LocalObject &obj) {
   }
 }
 
+void ObjectStatsCollector::RecordDetailedEvent(const LocalObject &obj, bool created) {
+  if (!detailed_stats_enabled_) {
+    return;
+  }
+  const uint64_t write_pos = ring_write_pos_.load(std::memory_order_relaxed);
+  if (write_pos - ring_read_pos_.load(std::memory_order_acquire) >= ring_.size()) {
+    num_detailed_events_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  auto &event = ring_[write_pos & (ring_.size() - 1)];
+  event.object_size = obj.GetObjectInfo().GetObjectSize();
+  event.owner_worker_id = obj.GetObjectInfo().owner_worker_id;
+  event.created = created;
+  ring_write_pos_.store(write_pos + 1, std::memory_order_release);
+}
+
+void ObjectStatsCollector::SamplerLoop() {
+  while (!sampler_stopped_.load(std::memory_order_acquire)) {
+    uint64_t read_pos = ring_read_pos_.load(std::memory_order_relaxed);
+    const uint64_t write_pos = ring_write_pos_.load(std::memory_order_acquire);
+    if (read_pos == write_pos) {
+      absl::SleepFor(absl::Milliseconds(10));
+      continue;
+    }
+    absl::MutexLock lock(&breakdown_mutex_);
+    while (read_pos != write_pos) {
+      const auto &event = ring_[read_pos & (ring_.size() - 1)];
+      const int64_t delta_objects = event.created ? 1 : -1;
+      const int64_t delta_bytes = event.created ? event.object_size : -event.object_size;
+
+      auto &size_class_entry = usage_by_size_class_[SizeClassUpperBound(event.object_size)];
+      size_class_entry.num_objects += delta_objects;
+      size_class_entry.num_bytes += delta_bytes;
+      if (size_class_entry.num_objects == 0 && size_class_entry.num_bytes == 0) {
+        usage_by_size_class_.erase(SizeClassUpperBound(event.object_size));
+      }
+
+      auto &owner_entry = usage_by_owner_[event.owner_worker_id];
+      owner_entry.num_objects += delta_objects;
+      owner_entry.num_bytes += delta_bytes;
+      if (owner_entry.num_objects == 0 && owner_entry.num_bytes == 0) {
+        usage_by_owner_.erase(event.owner_worker_id);
+      }
+
+      read_pos++;
+    }
+    ring_read_pos_.store(read_pos, std::memory_order_release);
+  }
+}
+
+void ObjectStatsCollector::GetDetailedStatsDump(std::stringstream &buffer) const {
+  absl::MutexLock lock(&breakdown_mutex_);
+  buffer << "\n";
+  buffer << "- detailed stats events dropped: "
+         << num_detailed_events_dropped_.load(std::memory_order_relaxed) << "\n";
+
+  std::vector<std::pair<int64_t, DetailedStatsEntry>> by_size_class(
+      usage_by_size_class_.begin(), usage_by_size_class_.end());
+  std::sort(by_size_class.begin(), by_size_class.end(), [](const auto &a, const auto &b) {
+    return a.first < b.first;
+  });
+  buffer << "- objects by size class:\n";
+  for (const auto &[upper_bound, entry] : by_size_class) {
+    buffer << "  - <= " << upper_bound << " bytes: " << entry.num_objects << " objects, "
+           << entry.num_bytes << " bytes\n";
+  }
+
+  std::vector<std::pair<ray::WorkerID, DetailedStatsEntry>> by_owner(
+      usage_by_owner_.begin(), usage_by_owner_.end());
+  std::sort(by_owner.begin(), by_owner.end(), [](const auto &a, const auto &b) {
+    return a.second.num_bytes > b.second.num_bytes;
+  });
+  buffer << "- objects by owner worker:\n";
+  for (const auto &[worker_id, entry] : by_owner) {
+    buffer << "  - " << worker_id.Hex() << ": " << entry.num_objects << " objects, "
+           << entry.num_bytes << " bytes\n";
+  }
+}
+
 int64_t ObjectStatsCollector::GetNumBytesCreatedCurrent() const {
   return num_bytes_created_by_worker_ + num_bytes_restored_ + num_bytes_received_ +
          num_bytes_errored_;
@@ -248,6 +374,10 @@ void ObjectStatsCollector::GetDebugDump(std::stringstream &buffer) const {
   buffer << "- bytes received: " << num_bytes_received_ << "\n";
   buffer << "- objects errored: " << num_objects_errored_ << "\n";
   buffer << "- bytes errored: " << num_bytes_errored_ << "\n";
+
+  if (detailed_stats_enabled_) {
+    GetDetailedStatsDump(buffer);
+  }
 }
 
 int64_t ObjectStatsCollector::GetNumBytesInUse() const { return num_bytes_in_use_; }
@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <thread>
 #include <utility>  // std::pair
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "ray/common/metrics.h"
 #include "ray/object_manager/metrics.h"
 #include "ray/object_manager/plasma/common.h"
@@ -29,11 +35,21 @@ namespace plasma {
 // ObjectStatsCollector subscribes to plasma store state changes
 // and calculate the store statistics.
 //
+// When object_store_detailed_stats_enabled is set, create/delete events are
+// additionally recorded into a fixed-size single-producer ring that a
+// background sampler thread drains into a breakdown of live objects by size
+// class and by owner worker, reported by GetDebugDump. The store thread only
+// writes one ring slot per event, so the detailed breakdown costs no
+// aggregation work on the hot path; if the sampler falls behind, events are
+// dropped and counted rather than blocking the store.
+//
 // TODO(scv119): move other stats from PlasmaStore/ObjectStore/
 // ObjectLifeCycleManager into this class.
 class ObjectStatsCollector {
  public:
-  virtual ~ObjectStatsCollector() = default;
+  ObjectStatsCollector();
+
+  virtual ~ObjectStatsCollector();
 
   // Called after a new object is created.
   // Marked virtual for test mocking
@@ -47,6 +63,10 @@ class ObjectStatsCollector {
   // Marked virtual for test mocking
   virtual void OnObjectDeleting(const LocalObject &object);
 
+  // Called after compaction moved a sealed object's backing allocation from
+  // the shared memory arena to a fallback-allocated file.
+  void OnObjectRelocatedToFallback(const LocalObject &object);
+
   // Called after an object's ref count is bumped by 1.
   void OnObjectRefIncreased(const LocalObject &object);
 
@@ -74,6 +94,31 @@ class ObjectStatsCollector {
 
   int64_t GetNumBytesCreatedCurrent() const;
 
+  /// One create/delete event recorded on the store thread for the sampler
+  /// thread to aggregate.
+  struct DetailedStatsEvent {
+    int64_t object_size;
+    ray::WorkerID owner_worker_id;
+    bool created;
+  };
+
+  /// Objects and bytes currently live in one breakdown entry.
+  struct DetailedStatsEntry {
+    int64_t num_objects = 0;
+    int64_t num_bytes = 0;
+  };
+
+  /// Record a create/delete event into the ring. Called on the store thread;
+  /// no-op unless detailed stats are enabled.
+  void RecordDetailedEvent(const LocalObject &object, bool created);
+
+  /// Main loop of the sampler thread. Drains the ring and folds events into
+  /// the size-class and owner-worker breakdowns.
+  void SamplerLoop();
+
+  /// Append the size-class and owner-worker breakdowns to the dump.
+  void GetDetailedStatsDump(std::stringstream &buffer) const;
+
   CounterMap<std::pair</* fallback_allocated*/ bool, /*sealed*/ bool>> bytes_by_loc_seal_;
   int64_t num_objects_spillable_ = 0;
   int64_t num_bytes_spillable_ = 0;
@@ -99,6 +144,34 @@ class ObjectStatsCollector {
       ray::GetObjectStoreMemoryGaugeMetric()};
   mutable ray::stats::Histogram object_store_dist_histogram_{
       ray::GetObjectStoreDistHistogramMetric()};
+
+  const bool detailed_stats_enabled_;
+
+  /// Single-producer single-consumer event ring; the store thread writes at
+  /// ring_write_pos_, the sampler thread reads at ring_read_pos_. Capacity is
+  /// a power of two so positions wrap with a mask. Empty unless detailed
+  /// stats are enabled.
+  std::vector<DetailedStatsEvent> ring_;
+  std::atomic<uint64_t> ring_write_pos_{0};
+  std::atomic<uint64_t> ring_read_pos_{0};
+
+  /// Events discarded because the ring was full.
+  std::atomic<int64_t> num_detailed_events_dropped_{0};
+
+  /// Guards the breakdowns, which the sampler thread writes and the debug
+  /// dump reads.
+  mutable absl::Mutex breakdown_mutex_;
+
+  /// Live objects/bytes keyed by power-of-two size-class upper bound.
+  absl::flat_hash_map<int64_t, DetailedStatsEntry> usage_by_size_class_
+      ABSL_GUARDED_BY(breakdown_mutex_);
+
+  /// Live objects/bytes keyed by owner worker.
+  absl::flat_hash_map<ray::WorkerID, DetailedStatsEntry> usage_by_owner_
+      ABSL_GUARDED_BY(breakdown_mutex_);
+
+  std::atomic<bool> sampler_stopped_{false};
+  std::thread sampler_thread_;
 };
 
 }  // namespace plasma
@@ -74,13 +74,15 @@ PlasmaStore::PlasmaStore(instrumented_io_context &main_service,
                          ray::SpillObjectsCallback spill_objects_callback,
                          std::function<void()> object_store_full_callback,
                          ray::AddObjectCallback add_object_callback,
-                         ray::DeleteObjectCallback delete_object_callback)
+                         ray::DeleteObjectCallback delete_object_callback,
+                         SpillFileMapper *spill_file_mapper)
     : io_context_(main_service),
       socket_name_(socket_name),
       acceptor_(main_service, ray::ParseUrlEndpoint(socket_name)),
       socket_(main_service),
       allocator_(allocator),
       fs_monitor_(fs_monitor),
+      spill_file_mapper_(spill_file_mapper),
       add_object_callback_(add_object_callback),
       delete_object_callback_(delete_object_callback),
       object_lifecycle_mgr_(allocator_, delete_object_callback_),
@@ -111,6 +113,13 @@ PlasmaStore::PlasmaStore(instrumented_io_context &main_service,
           [this](const auto &request) { this->ReturnFromGet(request); }) {
   ray::SetCloseOnExec(acceptor_);
 
+  const auto client_executor_threads =
+      RayConfig::instance().plasma_store_client_executor_threads();
+  if (client_executor_threads > 0) {
+    client_executor_pool_ =
+        std::make_unique<ray::IOServicePool>(client_executor_threads);
+  }
+
   if (RayConfig::instance().event_stats_print_interval_ms() > 0 &&
       RayConfig::instance().event_stats()) {
     PrintAndRecordDebugDump();
@@ -125,11 +134,19 @@ PlasmaStore::PlasmaStore(instrumented_io_context &main_service,
 PlasmaStore::~PlasmaStore() {}
 
 void PlasmaStore::Start() {
+  if (client_executor_pool_ != nullptr) {
+    client_executor_pool_->Run();
+  }
   // Start listening for clients.
   DoAccept();
 }
 
-void PlasmaStore::Stop() { acceptor_.close(); }
+void PlasmaStore::Stop() {
+  acceptor_.close();
+  if (client_executor_pool_ != nullptr) {
+    client_executor_pool_->Stop();
+  }
+}
 
 // If this client is not already using the object, add the client to the
 // object's list of clients, otherwise do nothing.
@@ -171,6 +188,87 @@ PlasmaError PlasmaStore::HandleCreateObjectRequest(const std::shared_ptr<Client>
   return error;
 }
 
+Status PlasmaStore::HandleBatchCreateRequest(const std::shared_ptr<Client> &client,
+                                             const std::vector<uint8_t> &message) {
+  std::vector<ray::ObjectInfo> object_infos;
+  fb::ObjectSource source;
+  std::vector<const uint8_t *> data_ptrs;
+  std::vector<const uint8_t *> metadata_ptrs;
+  ReadBatchCreateRequest(
+      message.data(), message.size(), &object_infos, &source, &data_ptrs, &metadata_ptrs);
+
+  std::vector<ObjectID> object_ids;
+  std::vector<PlasmaError> errors;
+  std::vector<ObjectID> to_seal;
+  object_ids.reserve(object_infos.size());
+  errors.reserve(object_infos.size());
+  for (size_t i = 0; i < object_infos.size(); i++) {
+    const auto &object_info = object_infos[i];
+    const auto &object_id = object_info.object_id;
+
+    // absl failed analyze mutex safety for lambda
+    auto handle_create = [this, client, &object_info, source](
+                             bool fallback_allocator,
+                             PlasmaObject *result) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+      mutex_.AssertHeld();
+      return CreateObject(object_info, source, client, fallback_allocator, result);
+    };
+
+    auto result_error = create_request_queue_.TryRequestImmediately(
+        object_id, client, handle_create, object_info.GetObjectSize());
+    const auto &error = result_error.second;
+    if (error == PlasmaError::OK) {
+      auto entry = object_lifecycle_mgr_.GetObject(object_id);
+      auto *address = static_cast<uint8_t *>(entry->GetAllocation().address_);
+      if (object_info.data_size > 0) {
+        std::memcpy(address, data_ptrs[i], object_info.data_size);
+      }
+      if (object_info.metadata_size > 0) {
+        std::memcpy(
+            address + object_info.data_size, metadata_ptrs[i], object_info.metadata_size);
+      }
+      to_seal.push_back(object_id);
+    }
+    object_ids.push_back(object_id);
+    errors.push_back(error);
+  }
+  SealObjects(to_seal);
+  // The store sealed the objects on the creator's behalf and the client never
+  // maps them, so drop the creator references right away.
+  for (const auto &object_id : to_seal) {
+    RemoveFromClientObjectIds(object_id, client);
+  }
+  return SendBatchCreateReply(client, object_ids, errors);
+}
+
+PlasmaError PlasmaStore::RestoreSpilledObject(const ObjectID &object_id,
+                                              const std::string &spilled_url) {
+  if (spill_file_mapper_ == nullptr) {
+    RAY_LOG(ERROR) << "Received a restore request for " << object_id
+                   << " but memory-mapped restore is disabled.";
+    return PlasmaError::UnexpectedError;
+  }
+  if (object_lifecycle_mgr_.GetObject(object_id) != nullptr) {
+    // The object is already local, e.g. because a concurrent restore finished
+    // first. Callers treat this as success.
+    return PlasmaError::ObjectExists;
+  }
+
+  ray::ObjectInfo object_info;
+  object_info.object_id = object_id;
+  auto allocation = spill_file_mapper_->MapSpilledObject(spilled_url, &object_info);
+  if (!allocation.has_value()) {
+    return PlasmaError::ObjectNonexistent;
+  }
+
+  auto entry = object_lifecycle_mgr_.RestoreObject(
+      object_info, fb::ObjectSource::RestoredFromStorage, std::move(allocation.value()));
+  RAY_LOG(DEBUG) << "restored object " << object_id << " from " << spilled_url;
+  add_object_callback_(entry->GetObjectInfo());
+  get_request_queue_.MarkObjectSealed(object_id);
+  return PlasmaError::OK;
+}
+
 PlasmaError PlasmaStore::CreateObject(const ray::ObjectInfo &object_info,
                                       fb::ObjectSource source,
                                       const std::shared_ptr<Client> &client,
@@ -222,13 +320,12 @@ void PlasmaStore::ReturnFromGet(const std::shared_ptr<GetRequest> &get_request)
   // If we successfully sent the get reply message to the client, then also send
   // the file descriptors.
   if (s.ok()) {
-    // Send all of the file descriptors for the present objects.
-    for (MEMFD_TYPE store_fd : store_fds) {
-      Status send_fd_status = get_request->client_->SendFd(store_fd);
-      if (!send_fd_status.ok()) {
-        RAY_LOG(ERROR) << "Failed to send mmap results to client on fd "
-                       << get_request->client_;
-      }
+    // Send the file descriptors for the present objects that the client has
+    // not seen yet, batched into as few sendmsg syscalls as possible.
+    Status send_fd_status = get_request->client_->SendFds(store_fds);
+    if (!send_fd_status.ok()) {
+      RAY_LOG(ERROR) << "Failed to send mmap results to client on fd "
+                     << get_request->client_;
     }
   } else {
     RAY_LOG(ERROR) << "Failed to send Get reply to client on fd " << get_request->client_;
@@ -302,6 +399,25 @@ int PlasmaStore::AbortObject(const ObjectID &object_id,
 
 void PlasmaStore::ConnectClient(const boost::system::error_code &error) {
   if (!error) {
+    ray::local_stream_socket socket = std::move(socket_);
+#ifndef _WIN32
+    if (client_executor_pool_ != nullptr) {
+      // Rebind the accepted socket to one of the executor io contexts so this
+      // client's reads and replies run off the main store thread. Mutating
+      // handlers still take mutex_, keeping metadata updates serialized.
+      boost::system::error_code release_ec;
+      auto native_handle = socket.release(release_ec);
+      if (!release_ec) {
+        ray::local_stream_socket rebound(*client_executor_pool_->Get());
+        boost::system::error_code assign_ec;
+        rebound.assign(
+            acceptor_.local_endpoint().protocol(), native_handle, assign_ec);
+        if (!assign_ec) {
+          socket = std::move(rebound);
+        }
+      }
+    }
+#endif
     // Accept a new local client and dispatch it to the node manager.
     auto new_connection = Client::Create(
         /*message_handler=*/
@@ -315,7 +431,7 @@ void PlasmaStore::ConnectClient(const boost::system::error_code &error) {
                const boost::system::error_code &err) -> void {
           return HandleClientConnectionError(client, err);
         },
-        std::move(socket_));
+        std::move(socket));
 
     // Start receiving messages.
     new_connection->ProcessMessages();
@@ -411,6 +527,16 @@ Status PlasmaStore::ProcessClientMessage(const std::shared_ptr<Client> &client,
       ReplyToCreateClient(client, object_id, req_id);
     }
   } break;
+  case fb::MessageType::PlasmaBatchCreateRequest: {
+    RAY_RETURN_NOT_OK(HandleBatchCreateRequest(client, message));
+  } break;
+  case fb::MessageType::PlasmaRestoreSpilledObjectRequest: {
+    ObjectID object_id;
+    std::string spilled_url;
+    ReadRestoreSpilledObjectRequest(input, input_size, &object_id, &spilled_url);
+    const auto error = RestoreSpilledObject(object_id, spilled_url);
+    RAY_RETURN_NOT_OK(SendRestoreSpilledObjectReply(client, object_id, error));
+  } break;
   case fb::MessageType::PlasmaCreateRetryRequest: {
     auto request = flatbuffers::GetRoot<fb::PlasmaCreateRetryRequest>(input);
     RAY_DCHECK(plasma::VerifyFlatbuffer(request, input, input_size));
@@ -450,6 +576,20 @@ Status PlasmaStore::ProcessClientMessage(const std::shared_ptr<Client> &client,
           SendReleaseReply(client, object_id, should_unmap, PlasmaError::OK));
     }
   } break;
+  case fb::MessageType::PlasmaBatchReleaseRequest: {
+    // The client only batches releases of objects it knows are not
+    // fallback-allocated, so no release can require an unmap handshake and no
+    // reply is sent.
+    std::vector<ObjectID> object_ids;
+    ReadBatchReleaseRequest(input, input_size, &object_ids);
+    for (const auto &object_id : object_ids) {
+      RAY_CHECK(!ReleaseObject(object_id, client))
+          << "A batched release should never unmap a mmap section because the "
+             "client only batches objects that are not fallback-allocated. "
+             "Object ID: "
+          << object_id;
+    }
+  } break;
   case fb::MessageType::PlasmaDeleteRequest: {
     std::vector<ObjectID> object_ids;
     std::vector<PlasmaError> error_codes;
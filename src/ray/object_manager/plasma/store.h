@@ -27,6 +27,7 @@
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/asio/io_service_pool.h"
 #include "ray/common/file_system_monitor.h"
 #include "ray/common/ray_config.h"
 #include "ray/common/status.h"
@@ -41,6 +42,7 @@
 #include "ray/object_manager/plasma/plasma.h"
 #include "ray/object_manager/plasma/plasma_allocator.h"
 #include "ray/object_manager/plasma/protocol.h"
+#include "ray/object_manager/plasma/spill_file_mapper.h"
 
 namespace plasma {
 
@@ -62,7 +64,8 @@ class PlasmaStore {
               ray::SpillObjectsCallback spill_objects_callback,
               std::function<void()> object_store_full_callback,
               ray::AddObjectCallback add_object_callback,
-              ray::DeleteObjectCallback delete_object_callback);
+              ray::DeleteObjectCallback delete_object_callback,
+              SpillFileMapper *spill_file_mapper = nullptr);
 
   ~PlasmaStore();
 
@@ -227,6 +230,23 @@ class PlasmaStore {
                                         PlasmaObject *object)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  /// Handle a batched create-and-seal request. Each entry is created
+  /// immediately (no queueing), its inline payload is copied into shared
+  /// memory, and the object is sealed; the creator reference is dropped right
+  /// away so clients do not have to release the objects afterwards.
+  Status HandleBatchCreateRequest(const std::shared_ptr<Client> &client,
+                                  const std::vector<uint8_t> &message)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  /// Restore a spilled object by mapping its spill file record and adding it
+  /// to the store as a sealed object served from the mapping. Returns
+  /// ObjectExists if the object is already local (callers may treat that as
+  /// success) and ObjectNonexistent if the URL can't be mapped, e.g. because
+  /// the spill file was deleted.
+  PlasmaError RestoreSpilledObject(const ObjectID &object_id,
+                                   const std::string &spilled_url)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   void ReplyToCreateClient(const std::shared_ptr<Client> &client,
                            const ObjectID &object_id,
                            uint64_t req_id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
@@ -257,6 +277,13 @@ class PlasmaStore {
 
   // A reference to the asio io context.
   instrumented_io_context &io_context_;
+  /// Optional pool of client executor threads. When
+  /// plasma_store_client_executor_threads > 0, each accepted client connection
+  /// is rebound to one of these io contexts so request parsing, fd passing and
+  /// reply serialization for different clients proceed in parallel; all
+  /// metadata mutations stay serialized under mutex_. When disabled (the
+  /// default), clients are served on io_context_ as before.
+  std::unique_ptr<ray::IOServicePool> client_executor_pool_;
   /// The name of the socket this object store listens on.
   std::string socket_name_;
   /// An acceptor for new clients.
@@ -278,6 +305,10 @@ class PlasmaStore {
   /// Monitor the disk utilization.
   ray::FileSystemMonitor &fs_monitor_;
 
+  /// Maps spill file regions for restored objects. May be null when
+  /// memory-mapped restore is disabled.
+  SpillFileMapper *const spill_file_mapper_ ABSL_GUARDED_BY(mutex_);
+
   /// A callback to asynchronously notify that an object is sealed.
   /// NOTE: This function should guarantee the thread-safety because the callback is
   /// shared with the main raylet thread.
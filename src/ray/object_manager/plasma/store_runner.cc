@@ -108,6 +108,28 @@ void PlasmaStoreRunner::Start(ray::SpillObjectsCallback spill_objects_callback,
     absl::MutexLock lock(&store_runner_mutex_);
     allocator_ = std::make_unique<PlasmaAllocator>(
         plasma_directory_, fallback_directory_, hugepages_enabled_, system_memory_);
+    IAllocator *allocator = allocator_.get();
+    const auto deferred_free_min_bytes =
+        RayConfig::instance().plasma_deferred_free_min_bytes();
+    if (deferred_free_min_bytes > 0) {
+      deferred_free_allocator_ =
+          std::make_unique<DeferredFreeAllocator>(*allocator, deferred_free_min_bytes);
+      allocator = deferred_free_allocator_.get();
+    }
+    const auto small_object_threshold =
+        RayConfig::instance().plasma_small_object_threshold_bytes();
+    if (small_object_threshold > 0) {
+      size_class_allocator_ = std::make_unique<SizeClassAllocator>(
+          *allocator,
+          small_object_threshold,
+          RayConfig::instance().plasma_size_class_slab_bytes());
+      allocator = size_class_allocator_.get();
+    }
+    if (RayConfig::instance().object_spilling_mmap_restore() &&
+        RayConfig::instance().is_external_storage_type_fs()) {
+      spill_file_mapper_ = std::make_unique<SpillFileMapper>(*allocator);
+      allocator = spill_file_mapper_.get();
+    }
 #ifndef _WIN32
     std::vector<std::string> local_spilling_paths;
     if (RayConfig::instance().is_external_storage_type_fs()) {
@@ -124,14 +146,15 @@ void PlasmaStoreRunner::Start(ray::SpillObjectsCallback spill_objects_callback,
     fs_monitor_ = std::make_unique<ray::FileSystemMonitor>();
 #endif
     store_.reset(new PlasmaStore(main_service_,
-                                 *allocator_,
+                                 *allocator,
                                  *fs_monitor_,
                                  socket_name_,
                                  RayConfig::instance().object_store_full_delay_ms(),
                                  spill_objects_callback,
                                  object_store_full_callback,
                                  add_object_callback,
-                                 delete_object_callback));
+                                 delete_object_callback,
+                                 spill_file_mapper_.get()));
     store_->Start();
   }
   main_service_.run();
@@ -21,6 +21,9 @@
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/file_system_monitor.h"
 #include "ray/object_manager/plasma/plasma_allocator.h"
+#include "ray/object_manager/plasma/deferred_free_allocator.h"
+#include "ray/object_manager/plasma/size_class_allocator.h"
+#include "ray/object_manager/plasma/spill_file_mapper.h"
 #include "ray/object_manager/plasma/store.h"
 
 namespace plasma {
@@ -66,6 +69,16 @@ class PlasmaStoreRunner {
   mutable instrumented_io_context main_service_{/*enable_lag_probe=*/false,
                                                 /*running_on_single_thread=*/true};
   std::unique_ptr<PlasmaAllocator> allocator_;
+  /// Optional deferred-free layer over allocator_; non-null iff
+  /// plasma_deferred_free_min_bytes > 0.
+  std::unique_ptr<DeferredFreeAllocator> deferred_free_allocator_;
+  /// Optional size-class layer over the allocator chain; non-null iff
+  /// plasma_small_object_threshold_bytes > 0.
+  std::unique_ptr<SizeClassAllocator> size_class_allocator_;
+  /// Optional spill-file mapping layer, the outermost of the chain; non-null
+  /// iff object_spilling_mmap_restore is set and spilling goes to the local
+  /// filesystem.
+  std::unique_ptr<SpillFileMapper> spill_file_mapper_;
   std::unique_ptr<ray::FileSystemMonitor> fs_monitor_;
   std::unique_ptr<PlasmaStore> store_;
 };
@@ -96,9 +96,19 @@ class MockObjectStore : public IObjectStore {
                const LocalObject *(const ray::ObjectInfo &,
                                    plasma::flatbuf::ObjectSource,
                                    bool));
+  MOCK_METHOD3(AddRestoredObject,
+               const LocalObject *(const ray::ObjectInfo &,
+                                   plasma::flatbuf::ObjectSource,
+                                   Allocation));
   MOCK_CONST_METHOD1(GetObject, const LocalObject *(const ObjectID &));
+  MOCK_CONST_METHOD1(GetObjects,
+                     std::vector<const LocalObject *>(const std::vector<ObjectID> &));
   MOCK_METHOD1(SealObject, const LocalObject *(const ObjectID &));
   MOCK_METHOD1(DeleteObject, bool(const ObjectID &));
+  MOCK_METHOD1(BeginObjectRelocation, void(const ObjectID &));
+  MOCK_METHOD3(FinishObjectRelocation,
+               bool(const ObjectID &, const uint8_t *, bool));
+  MOCK_METHOD2(AliasObjectAllocation, bool(const ObjectID &, const ObjectID &));
   MOCK_CONST_METHOD0(GetNumBytesCreatedTotal, int64_t());
   MOCK_CONST_METHOD0(GetNumBytesUnsealed, int64_t());
   MOCK_CONST_METHOD0(GetNumObjectsUnsealed, int64_t());
@@ -187,6 +197,74 @@ TEST(EvictionPolicyTest, Test) {
     EXPECT_TRUE(policy.IsObjectExists(key1));
   }
 }
+TEST(CostAwareEvictionPolicyTest, Test) {
+  MockAllocator allocator;
+  MockObjectStore store;
+  EXPECT_CALL(allocator, GetFootprintLimit()).WillRepeatedly(Return(100));
+
+  ObjectID local_key = ObjectID::FromRandom();
+  ObjectID pulled_key = ObjectID::FromRandom();
+  ObjectID hot_key = ObjectID::FromRandom();
+
+  // A large local temporary: cheapest bytes to evict.
+  LocalObject local_object{Allocation()};
+  local_object.object_info_.data_size = 40;
+  local_object.object_info_.metadata_size = 0;
+  local_object.source_ = flatbuf::ObjectSource::CreatedByWorker;
+
+  // A small object pulled from a remote node: expensive to lose.
+  LocalObject pulled_object{Allocation()};
+  pulled_object.object_info_.data_size = 10;
+  pulled_object.object_info_.metadata_size = 0;
+  pulled_object.source_ = flatbuf::ObjectSource::ReceivedFromRemoteRaylet;
+
+  // A frequently accessed local object.
+  LocalObject hot_object{Allocation()};
+  hot_object.object_info_.data_size = 40;
+  hot_object.object_info_.metadata_size = 0;
+  hot_object.source_ = flatbuf::ObjectSource::CreatedByWorker;
+
+  CostAwareEvictionPolicy policy(store, allocator);
+  EXPECT_CALL(store, GetObject(local_key)).WillRepeatedly(Return(&local_object));
+  EXPECT_CALL(store, GetObject(pulled_key)).WillRepeatedly(Return(&pulled_object));
+  EXPECT_CALL(store, GetObject(hot_key)).WillRepeatedly(Return(&hot_object));
+  policy.ObjectCreated(local_key);
+  policy.ObjectCreated(pulled_key);
+  policy.ObjectCreated(hot_key);
+
+  // Access the hot object a few times to raise its score.
+  for (int i = 0; i < 5; i++) {
+    policy.BeginObjectAccess(hot_key);
+    policy.EndObjectAccess(hot_key);
+  }
+
+  {
+    // Evicting 40 bytes takes the cold local temporary, not the pulled
+    // object (higher source cost) or the hot object (higher frequency).
+    std::vector<ObjectID> objects_to_evict;
+    EXPECT_EQ(40, policy.ChooseObjectsToEvict(40, objects_to_evict));
+    EXPECT_EQ(objects_to_evict, std::vector<ObjectID>{local_key});
+  }
+
+  {
+    // Next round takes the hot local object before the pulled one.
+    std::vector<ObjectID> objects_to_evict;
+    EXPECT_EQ(40, policy.ChooseObjectsToEvict(40, objects_to_evict));
+    EXPECT_EQ(objects_to_evict, std::vector<ObjectID>{hot_key});
+  }
+
+  {
+    // Pinned objects are never chosen.
+    policy.BeginObjectAccess(pulled_key);
+    std::vector<ObjectID> objects_to_evict;
+    EXPECT_EQ(0, policy.ChooseObjectsToEvict(10, objects_to_evict));
+    EXPECT_TRUE(objects_to_evict.empty());
+    policy.EndObjectAccess(pulled_key);
+    EXPECT_EQ(10, policy.ChooseObjectsToEvict(10, objects_to_evict));
+    EXPECT_EQ(objects_to_evict, std::vector<ObjectID>{pulled_key});
+  }
+}
+
 }  // namespace plasma
 
 int main(int argc, char **argv) {
@@ -0,0 +1,104 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/plasma/fallback_file_pool.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "absl/time/clock.h"
+#include "gtest/gtest.h"
+#include "ray/common/id.h"
+
+using std::filesystem::create_directories;
+using std::filesystem::path;
+
+namespace plasma {
+namespace {
+const int64_t kMB = 1024 * 1024;
+
+std::string CreateTestDir() {
+  path directory =
+      std::filesystem::temp_directory_path() / ray::UniqueID::FromRandom().Hex();
+  create_directories(directory);
+  return directory.string();
+}
+
+// The pool fills asynchronously; retry taking a file until the background
+// thread has created one.
+std::optional<int> TakeFileWithRetry(FallbackFilePool &pool, int64_t size) {
+  for (int i = 0; i < 500; i++) {
+    if (auto fd = pool.TakeFile(size)) {
+      return fd;
+    }
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+TEST(FallbackFilePoolTest, TestTakeFile) {
+  FallbackFilePool pool(CreateTestDir(),
+                        /*files_per_bucket=*/2,
+                        /*min_bucket_bytes=*/1 * kMB,
+                        /*max_bucket_bytes=*/4 * kMB);
+
+  // Requests larger than the largest bucket are never served.
+  ASSERT_FALSE(pool.TakeFile(8 * kMB).has_value());
+
+  // A pooled file is truncated down to the requested size and is mmapable
+  // and writable.
+  const int64_t request_size = 1 * kMB + 123;
+  auto fd = TakeFileWithRetry(pool, request_size);
+  ASSERT_TRUE(fd.has_value());
+  struct stat file_stat;
+  ASSERT_EQ(0, fstat(*fd, &file_stat));
+  ASSERT_EQ(request_size, file_stat.st_size);
+
+  void *pointer =
+      mmap(nullptr, request_size, PROT_READ | PROT_WRITE, MAP_SHARED, *fd, 0);
+  ASSERT_NE(MAP_FAILED, pointer);
+  auto *bytes = static_cast<char *>(pointer);
+  bytes[0] = 'a';
+  bytes[request_size - 1] = 'z';
+  ASSERT_EQ(0, munmap(pointer, request_size));
+  ASSERT_EQ(0, close(*fd));
+}
+
+TEST(FallbackFilePoolTest, TestRefill) {
+  FallbackFilePool pool(CreateTestDir(),
+                        /*files_per_bucket=*/1,
+                        /*min_bucket_bytes=*/1 * kMB,
+                        /*max_bucket_bytes=*/1 * kMB);
+
+  // Drain the single bucket repeatedly; the background thread replaces the
+  // file each time.
+  for (int i = 0; i < 3; i++) {
+    auto fd = TakeFileWithRetry(pool, 1 * kMB);
+    ASSERT_TRUE(fd.has_value());
+    ASSERT_EQ(0, close(*fd));
+  }
+}
+
+}  // namespace plasma
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,6 +21,7 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/core_worker/experimental_mutable_object_manager.h"
 #include "ray/object_manager/common.h"
 
@@ -174,6 +175,74 @@ TEST(MutableObjectTest, TestBasic) {
   }
 }
 
+// Tests ring mode: the writer is not blocked by readers that have not
+// consumed every version, a reader that falls behind skips to the latest
+// version, and the writer only blocks while a reader still holds the oldest
+// buffered slot.
+TEST(MutableObjectTest, TestRingSlots) {
+  RayConfig::instance().initialize(
+      R"({"experimental_mutable_object_ring_slots": 4})");
+
+  auto manager = std::make_shared<MutableObjectManager>();
+  ObjectID object_id = ObjectID::FromRandom();
+  plasma::PlasmaObjectHeader *header;
+  {
+    std::unique_ptr<plasma::MutableObject> object = MakeObject();
+    header = object->header;
+    header->Init();
+    ASSERT_TRUE(
+        manager->RegisterChannel(object_id, std::move(object), /*reader=*/true).ok());
+  }
+
+  auto write = [&](const std::string &payload) {
+    std::shared_ptr<Buffer> data;
+    RAY_RETURN_NOT_OK(manager->WriteAcquire(object_id,
+                                            payload.size(),
+                                            /*metadata=*/nullptr,
+                                            /*metadata_size=*/0,
+                                            /*num_readers=*/1,
+                                            data,
+                                            /*timeout_ms=*/0));
+    memcpy(data->Data(), payload.data(), payload.size());
+    return manager->WriteRelease(object_id);
+  };
+  auto read_payload = [&](const std::shared_ptr<RayObject> &result) {
+    return std::string(reinterpret_cast<const char *>(result->GetData()->Data()),
+                       result->GetData()->Size());
+  };
+
+  // Three writes with no reader. In the default mode the second write would
+  // block until a reader released version 1.
+  for (int i = 1; i <= 3; i++) {
+    ASSERT_TRUE(write(absl::StrCat("version", i)).ok());
+  }
+
+  // A reader that starts now skips to the latest version.
+  std::shared_ptr<RayObject> result;
+  ASSERT_TRUE(manager->ReadAcquire(object_id, result).ok());
+  ASSERT_EQ(read_payload(result), "version3");
+
+  // While the reader holds version 3, the writer can reuse the other three
+  // slots, but reusing the held slot for version 7 times out.
+  for (int i = 4; i <= 6; i++) {
+    ASSERT_TRUE(write(absl::StrCat("version", i)).ok());
+  }
+  ASSERT_TRUE(write("version7").IsChannelTimeoutError());
+
+  // Releasing the reader frees the slot for version 7. The reader then skips
+  // the versions it missed and reads the latest one.
+  result = nullptr;
+  ASSERT_TRUE(write("version7").ok());
+  ASSERT_TRUE(manager->ReadAcquire(object_id, result).ok());
+  ASSERT_EQ(read_payload(result), "version7");
+  result = nullptr;
+
+  RayConfig::instance().initialize(
+      R"({"experimental_mutable_object_ring_slots": 1})");
+  manager->DestroySemaphores(object_id);
+  free(header);
+}
+
 // Tests that multiple readers can read from a single writer.
 TEST(MutableObjectTest, TestMultipleReaders) {
   MutableObjectManager manager;
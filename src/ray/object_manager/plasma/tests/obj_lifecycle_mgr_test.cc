@@ -14,6 +14,8 @@
 
 #include "ray/object_manager/plasma/obj_lifecycle_mgr.h"
 
+#include <array>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -22,6 +24,7 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 
 using ray::ObjectID;
 using testing::_;
@@ -49,8 +52,18 @@ class MockObjectStore : public IObjectStore {
                                    plasma::flatbuf::ObjectSource,
                                    bool));
   MOCK_CONST_METHOD1(GetObject, const LocalObject *(const ObjectID &));
+  MOCK_CONST_METHOD1(GetObjects,
+                     std::vector<const LocalObject *>(const std::vector<ObjectID> &));
+  MOCK_METHOD3(AddRestoredObject,
+               const LocalObject *(const ray::ObjectInfo &,
+                                   plasma::flatbuf::ObjectSource,
+                                   Allocation));
   MOCK_METHOD1(SealObject, const LocalObject *(const ObjectID &));
   MOCK_METHOD1(DeleteObject, bool(const ObjectID &));
+  MOCK_METHOD1(BeginObjectRelocation, void(const ObjectID &));
+  MOCK_METHOD3(FinishObjectRelocation,
+               bool(const ObjectID &, const uint8_t *, bool));
+  MOCK_METHOD2(AliasObjectAllocation, bool(const ObjectID &, const ObjectID &));
   MOCK_CONST_METHOD1(GetDebugDump, void(std::stringstream &buffer));
 };
 
@@ -82,6 +95,21 @@ struct ObjectLifecycleManagerTest : public Test {
     one_ref_object_.ref_count_ = 1;
     two_ref_object_.state_ = ObjectState::PLASMA_SEALED;
     two_ref_object_.ref_count_ = 2;
+    relocation_backing_.fill(0xAB);
+    relocatable_object_.state_ = ObjectState::PLASMA_SEALED;
+    relocatable_object_.object_info_.data_size = 8;
+    relocatable_object_.object_info_.metadata_size = 0;
+    dedup_backing1_.fill(0xCD);
+    dedup_backing2_.fill(0xCD);
+    dedup_object1_.state_ = ObjectState::PLASMA_SEALED;
+    dedup_object1_.object_info_.object_id = id1_;
+    dedup_object1_.object_info_.data_size = 8;
+    dedup_object1_.object_info_.metadata_size = 0;
+    dedup_object2_.state_ = ObjectState::PLASMA_SEALED;
+    dedup_object2_.object_info_.object_id = id2_;
+    dedup_object2_.object_info_.data_size = 8;
+    dedup_object2_.object_info_.metadata_size = 0;
+    dedup_object2_.ref_count_ = 1;
   }
 
   MockEvictionPolicy *eviction_policy_;
@@ -96,6 +124,34 @@ struct ObjectLifecycleManagerTest : public Test {
   LocalObject not_sealed_object_{Allocation()};
   LocalObject one_ref_object_{Allocation()};
   LocalObject two_ref_object_{Allocation()};
+  // A sealed, unreferenced object with real backing memory so compaction can
+  // copy its payload out.
+  std::array<uint8_t, 8> relocation_backing_{};
+  LocalObject relocatable_object_{Allocation(relocation_backing_.data(),
+                                             8,
+                                             MEMFD_TYPE(),
+                                             /*offset=*/0,
+                                             /*device_num=*/0,
+                                             /*mmap_size=*/8,
+                                             /*fallback_allocated=*/false)};
+  // Two sealed objects with identical payloads in distinct allocations, so
+  // the second can be collapsed onto the first by deduplication.
+  std::array<uint8_t, 8> dedup_backing1_{};
+  std::array<uint8_t, 8> dedup_backing2_{};
+  LocalObject dedup_object1_{Allocation(dedup_backing1_.data(),
+                                        8,
+                                        MEMFD_TYPE(),
+                                        /*offset=*/0,
+                                        /*device_num=*/0,
+                                        /*mmap_size=*/8,
+                                        /*fallback_allocated=*/false)};
+  LocalObject dedup_object2_{Allocation(dedup_backing2_.data(),
+                                        8,
+                                        MEMFD_TYPE(),
+                                        /*offset=*/0,
+                                        /*device_num=*/0,
+                                        /*mmap_size=*/8,
+                                        /*fallback_allocated=*/false)};
   ObjectID id1_ = ObjectID::FromRandom();
   ObjectID id2_ = ObjectID::FromRandom();
   ObjectID id3_ = ObjectID::FromRandom();
@@ -184,6 +240,99 @@ TEST_F(ObjectLifecycleManagerTest, CreateObjectWithoutFallback) {
   EXPECT_EQ(expected, result);
 }
 
+TEST_F(ObjectLifecycleManagerTest, CompactionSatisfiesFragmentedCreate) {
+  RayConfig::instance().initialize(
+      R"({"plasma_unreferenced_object_compaction": true})");
+  ray::ObjectInfo info;
+  info.data_size = 8;
+  info.metadata_size = 0;
+  EXPECT_CALL(*object_store_, GetObject(info.object_id))
+      .Times(1)
+      .WillOnce(Return(nullptr));
+  // The create keeps failing although the eviction policy reports enough
+  // room, i.e. the free memory is fragmented. The 12th attempt, after the
+  // candidate was evacuated, succeeds.
+  int num_create_calls = 0;
+  EXPECT_CALL(*object_store_, CreateObject(_, _, false))
+      .Times(12)
+      .WillRepeatedly(Invoke([&](auto &, auto, bool) -> const LocalObject * {
+        return ++num_create_calls <= 11 ? nullptr : &object1_;
+      }));
+  EXPECT_CALL(*eviction_policy_, RequireSpace(_, _)).Times(11).WillRepeatedly(Return(0));
+  EXPECT_CALL(*eviction_policy_, ChooseObjectsToEvict(_, _))
+      .Times(1)
+      .WillOnce(Invoke([&](auto, auto &candidates) {
+        candidates.push_back(id1_);
+        return 8;
+      }));
+  EXPECT_CALL(*object_store_, GetObject(id1_))
+      .Times(1)
+      .WillOnce(Return(&relocatable_object_));
+  EXPECT_CALL(*object_store_, BeginObjectRelocation(id1_)).Times(1);
+  EXPECT_CALL(*object_store_, FinishObjectRelocation(id1_, _, false))
+      .Times(1)
+      .WillOnce(Invoke([&](auto &, const uint8_t *payload, bool) {
+        // The payload saved before the evacuation is handed back.
+        EXPECT_EQ(0, std::memcmp(payload, relocation_backing_.data(), 8));
+        return true;
+      }));
+  auto expected = std::pair<const LocalObject *, flatbuf::PlasmaError>(
+      &object1_, flatbuf::PlasmaError::OK);
+  auto result = manager_->CreateObject(info, {}, /*falback*/ false);
+  EXPECT_EQ(expected, result);
+  RayConfig::instance().initialize(
+      R"({"plasma_unreferenced_object_compaction": false})");
+}
+
+TEST_F(ObjectLifecycleManagerTest, CompactionDeletesObjectItCannotRehome) {
+  RayConfig::instance().initialize(
+      R"({"plasma_unreferenced_object_compaction": true})");
+  ray::ObjectInfo info;
+  info.data_size = 8;
+  info.metadata_size = 0;
+  EXPECT_CALL(*object_store_, GetObject(info.object_id))
+      .Times(1)
+      .WillOnce(Return(nullptr));
+  int num_create_calls = 0;
+  EXPECT_CALL(*object_store_, CreateObject(_, _, false))
+      .Times(12)
+      .WillRepeatedly(Invoke([&](auto &, auto, bool) -> const LocalObject * {
+        return ++num_create_calls <= 11 ? nullptr : &object1_;
+      }));
+  EXPECT_CALL(*eviction_policy_, RequireSpace(_, _)).Times(11).WillRepeatedly(Return(0));
+  EXPECT_CALL(*eviction_policy_, ChooseObjectsToEvict(_, _))
+      .Times(1)
+      .WillOnce(Invoke([&](auto, auto &candidates) {
+        candidates.push_back(id1_);
+        return 8;
+      }));
+  // Looked up once during evacuation and once during the deletion.
+  EXPECT_CALL(*object_store_, GetObject(id1_))
+      .Times(2)
+      .WillRepeatedly(Return(&relocatable_object_));
+  EXPECT_CALL(*object_store_, BeginObjectRelocation(id1_)).Times(1);
+  // Neither the compacted arena nor the fallback allocator can take the
+  // object back, so it is evicted instead.
+  EXPECT_CALL(*object_store_, FinishObjectRelocation(id1_, _, false))
+      .Times(1)
+      .WillOnce(Return(false));
+  EXPECT_CALL(*object_store_, FinishObjectRelocation(id1_, _, true))
+      .Times(1)
+      .WillOnce(Return(false));
+  EXPECT_CALL(*eviction_policy_, RemoveObject(id1_)).Times(1);
+  EXPECT_CALL(*object_store_, DeleteObject(id1_)).Times(1).WillOnce(Return(true));
+
+  auto expected = std::pair<const LocalObject *, flatbuf::PlasmaError>(
+      &object1_, flatbuf::PlasmaError::OK);
+  auto result = manager_->CreateObject(info, {}, /*falback*/ false);
+  EXPECT_EQ(expected, result);
+
+  std::vector<ObjectID> expect_notified_ids{id1_};
+  EXPECT_EQ(expect_notified_ids, notify_deleted_ids_);
+  RayConfig::instance().initialize(
+      R"({"plasma_unreferenced_object_compaction": false})");
+}
+
 TEST_F(ObjectLifecycleManagerTest, CreateObjectWithFallback) {
   EXPECT_CALL(*object_store_, GetObject(_)).Times(1).WillOnce(Return(nullptr));
   EXPECT_CALL(*object_store_, CreateObject(_, _, false))
@@ -348,6 +497,68 @@ TEST_F(ObjectLifecycleManagerTest, RemoveReferenceOneRefEagerlyDeletion) {
   std::vector<ObjectID> expect_notified_ids{id1_};
   EXPECT_EQ(expect_notified_ids, notify_deleted_ids_);
 }
+
+TEST_F(ObjectLifecycleManagerTest, DedupCollapsesIdenticalUnreferencedObject) {
+  RayConfig::instance().initialize(R"({"plasma_dedup_enabled": true})");
+
+  // Both seals record the (identical) content hash.
+  EXPECT_CALL(*object_store_, SealObject(id1_))
+      .Times(1)
+      .WillOnce(Return(&dedup_object1_));
+  EXPECT_CALL(*object_store_, SealObject(id2_))
+      .Times(1)
+      .WillOnce(Return(&dedup_object2_));
+  manager_->SealObject(id1_);
+  manager_->SealObject(id2_);
+
+  // Dropping the last reference of the second object collapses its
+  // allocation onto the first after the payloads compare equal.
+  EXPECT_CALL(*object_store_, GetObject(id2_))
+      .Times(2)
+      .WillRepeatedly(Return(&dedup_object2_));
+  EXPECT_CALL(*object_store_, GetObject(id1_))
+      .Times(1)
+      .WillOnce(Return(&dedup_object1_));
+  EXPECT_CALL(*eviction_policy_, EndObjectAccess(id2_)).Times(1).WillOnce(Return());
+  EXPECT_CALL(*object_store_, AliasObjectAllocation(id2_, id1_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_TRUE(manager_->RemoveReference(id2_));
+
+  EXPECT_TRUE(manager_->shared_allocation_objects_.contains(id1_));
+  EXPECT_TRUE(manager_->shared_allocation_objects_.contains(id2_));
+  // Objects sharing an allocation must not be moved by compaction.
+  EXPECT_FALSE(manager_->IsRelocatable(dedup_object2_));
+
+  RayConfig::instance().initialize(R"({"plasma_dedup_enabled": false})");
+}
+
+TEST_F(ObjectLifecycleManagerTest, DedupSkipsObjectsWithDifferentContent) {
+  RayConfig::instance().initialize(R"({"plasma_dedup_enabled": true})");
+  dedup_backing1_.fill(0xEF);
+
+  EXPECT_CALL(*object_store_, SealObject(id1_))
+      .Times(1)
+      .WillOnce(Return(&dedup_object1_));
+  EXPECT_CALL(*object_store_, SealObject(id2_))
+      .Times(1)
+      .WillOnce(Return(&dedup_object2_));
+  manager_->SealObject(id1_);
+  manager_->SealObject(id2_);
+
+  // The content hashes differ, so there is no dedup candidate and the
+  // object keeps its own allocation.
+  EXPECT_CALL(*object_store_, GetObject(id2_))
+      .Times(2)
+      .WillRepeatedly(Return(&dedup_object2_));
+  EXPECT_CALL(*eviction_policy_, EndObjectAccess(id2_)).Times(1).WillOnce(Return());
+  EXPECT_CALL(*object_store_, AliasObjectAllocation(_, _)).Times(0);
+  EXPECT_TRUE(manager_->RemoveReference(id2_));
+
+  EXPECT_TRUE(manager_->shared_allocation_objects_.empty());
+
+  RayConfig::instance().initialize(R"({"plasma_dedup_enabled": false})");
+}
 }  // namespace plasma
 
 int main(int argc, char **argv) {
@@ -17,6 +17,7 @@
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/random/random.h"
 #include "absl/strings/str_format.h"
@@ -182,6 +183,108 @@ TEST(ObjectStoreTest, PassThroughTest) {
     EXPECT_TRUE(store.DeleteObject(kId2));
   }
 }
+TEST(ObjectStoreTest, DedupAliasTest) {
+  MockAllocator allocator;
+  ObjectStore store(allocator);
+  char backing1[10];
+  char backing2[10];
+
+  auto id1 = ObjectID::FromRandom();
+  auto id2 = ObjectID::FromRandom();
+  auto alloc1 = CreateAllocation(Allocation(), 10);
+  alloc1.address_ = backing1;
+  auto alloc2 = CreateAllocation(Allocation(), 10);
+  alloc2.address_ = backing2;
+  EXPECT_CALL(allocator, Allocate(10))
+      .Times(2)
+      .WillOnce(Invoke(
+          [&](size_t) { return std::optional<Allocation>(std::move(alloc1)); }))
+      .WillOnce(Invoke(
+          [&](size_t) { return std::optional<Allocation>(std::move(alloc2)); }));
+  ASSERT_NE(nullptr,
+            store.CreateObject(CreateObjectInfo(id1, 10), {}, /*fallback*/ false));
+  ASSERT_NE(nullptr,
+            store.CreateObject(CreateObjectInfo(id2, 10), {}, /*fallback*/ false));
+
+  // Aliasing requires both objects to be sealed.
+  EXPECT_FALSE(store.AliasObjectAllocation(id2, id1));
+  store.SealObject(id1);
+  store.SealObject(id2);
+
+  // id2's own allocation is freed and replaced by id1's.
+  EXPECT_CALL(allocator, Free(_)).Times(1).WillOnce(Invoke([&](auto &&freed) {
+    EXPECT_EQ(freed.address_, static_cast<void *>(backing2));
+  }));
+  EXPECT_TRUE(store.AliasObjectAllocation(id2, id1));
+  EXPECT_EQ(store.GetObject(id2)->GetAllocation().address_,
+            static_cast<void *>(backing1));
+  // The pair already shares a block, so aliasing again is rejected.
+  EXPECT_FALSE(store.AliasObjectAllocation(id2, id1));
+
+  // Deleting the first sharer must not free the shared block.
+  EXPECT_TRUE(store.DeleteObject(id1));
+  // Deleting the last sharer frees it.
+  EXPECT_CALL(allocator, Free(_)).Times(1).WillOnce(Invoke([&](auto &&freed) {
+    EXPECT_EQ(freed.address_, static_cast<void *>(backing1));
+  }));
+  EXPECT_TRUE(store.DeleteObject(id2));
+}
+
+TEST(ShardedObjectStoreTest, CrossShardOperations) {
+  MockAllocator allocator;
+  // 5 rounds up to 8 shards.
+  ShardedObjectStore store(allocator, 5);
+
+  // Create enough objects that multiple shards are populated, then verify
+  // get/seal/delete behave identically to the single-map store.
+  std::vector<ObjectID> ids;
+  for (int i = 0; i < 64; i++) {
+    ids.push_back(ObjectID::FromRandom());
+  }
+
+  EXPECT_CALL(allocator, Allocate(_))
+      .Times(64)
+      .WillRepeatedly(Invoke([](size_t bytes) {
+        return std::optional<Allocation>(CreateAllocation(Allocation(), bytes));
+      }));
+  for (const auto &id : ids) {
+    auto info = CreateObjectInfo(id, 10);
+    auto entry = store.CreateObject(info, {}, /*fallback_allocate*/ false);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->state_, ObjectState::PLASMA_CREATED);
+  }
+
+  for (const auto &id : ids) {
+    auto entry = store.GetObject(id);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->object_info_.object_id, id);
+
+    auto sealed = store.SealObject(id);
+    EXPECT_EQ(sealed, entry);
+    EXPECT_EQ(sealed->state_, ObjectState::PLASMA_SEALED);
+    // Sealing twice fails.
+    EXPECT_EQ(nullptr, store.SealObject(id));
+  }
+
+  // Batch lookup resolves everything in one call, including missing ids.
+  std::vector<ObjectID> lookup_ids = ids;
+  lookup_ids.push_back(ObjectID::FromRandom());
+  auto entries = store.GetObjects(lookup_ids);
+  ASSERT_EQ(entries.size(), lookup_ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    ASSERT_NE(entries[i], nullptr);
+    EXPECT_EQ(entries[i], store.GetObject(lookup_ids[i]));
+  }
+  EXPECT_EQ(entries.back(), nullptr);
+
+  EXPECT_CALL(allocator, Free(_)).Times(64);
+  for (const auto &id : ids) {
+    EXPECT_TRUE(store.DeleteObject(id));
+    EXPECT_EQ(nullptr, store.GetObject(id));
+    EXPECT_FALSE(store.DeleteObject(id));
+  }
+}
+
 }  // namespace plasma
 
 int main(int argc, char **argv) {
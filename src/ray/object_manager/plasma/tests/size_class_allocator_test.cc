@@ -0,0 +1,146 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/plasma/size_class_allocator.h"
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+// A heap-backed base allocator so the size-class layer can carve real memory.
+class DummyAllocator : public IAllocator {
+ public:
+  std::optional<Allocation> Allocate(size_t bytes) override {
+    auto allocation = Allocation();
+    allocation.address_ = static_cast<void *>(new char[bytes]);
+    allocation.size_ = static_cast<int64_t>(bytes);
+    allocation.mmap_size_ = static_cast<int64_t>(bytes);
+    allocated_ += bytes;
+    num_allocations_++;
+    return std::move(allocation);
+  }
+
+  std::optional<Allocation> FallbackAllocate(size_t bytes) override {
+    num_fallback_allocations_++;
+    return Allocate(bytes);
+  }
+
+  void Free(Allocation allocation) override {
+    delete[] static_cast<char *>(allocation.address_);
+    allocated_ -= allocation.size_;
+    num_frees_++;
+  }
+
+  int64_t GetFootprintLimit() const override {
+    return std::numeric_limits<int64_t>::max();
+  }
+
+  int64_t Allocated() const override { return allocated_; }
+
+  int64_t FallbackAllocated() const override { return 0; }
+
+  int64_t num_allocations_ = 0;
+  int64_t num_fallback_allocations_ = 0;
+  int64_t num_frees_ = 0;
+
+ private:
+  int64_t allocated_ = 0;
+};
+
+TEST(SizeClassAllocatorTest, SmallAllocationsShareSlab) {
+  DummyAllocator base;
+  // 1KB threshold, 16KB slabs.
+  SizeClassAllocator allocator(base, 1024, 16 * 1024);
+
+  // 100 bytes lands in the 128-byte class: 128 blocks per slab.
+  std::vector<Allocation> allocations;
+  for (int i = 0; i < 128; i++) {
+    auto allocation = allocator.Allocate(100);
+    ASSERT_TRUE(allocation.has_value());
+    EXPECT_EQ(allocation->size_, 128);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(allocation->address_) % 64, 0u);
+    allocations.push_back(std::move(allocation.value()));
+  }
+  // All 128 blocks came out of a single base allocation.
+  EXPECT_EQ(base.num_allocations_, 1);
+
+  // Blocks are distinct and within the slab.
+  for (size_t i = 1; i < allocations.size(); i++) {
+    EXPECT_NE(allocations[i].address_, allocations[i - 1].address_);
+  }
+
+  // The 129th small allocation needs a second slab.
+  auto extra = allocator.Allocate(100);
+  ASSERT_TRUE(extra.has_value());
+  EXPECT_EQ(base.num_allocations_, 2);
+
+  allocator.Free(std::move(extra.value()));
+  for (auto &allocation : allocations) {
+    allocator.Free(std::move(allocation));
+  }
+  // One empty slab per class is cached; the other goes back to the base.
+  EXPECT_EQ(base.num_frees_, 1);
+
+  // The cached slab is reused without touching the base allocator.
+  auto reused = allocator.Allocate(100);
+  ASSERT_TRUE(reused.has_value());
+  EXPECT_EQ(base.num_allocations_, 2);
+  allocator.Free(std::move(reused.value()));
+}
+
+TEST(SizeClassAllocatorTest, LargeAndFallbackDelegate) {
+  DummyAllocator base;
+  SizeClassAllocator allocator(base, 1024, 16 * 1024);
+
+  // At or above the threshold goes straight to the base allocator.
+  auto large = allocator.Allocate(1024);
+  ASSERT_TRUE(large.has_value());
+  EXPECT_EQ(large->size_, 1024);
+  EXPECT_EQ(base.num_allocations_, 1);
+  allocator.Free(std::move(large.value()));
+  EXPECT_EQ(base.num_frees_, 1);
+
+  // Fallback allocations always delegate, regardless of size.
+  auto fallback = allocator.FallbackAllocate(100);
+  ASSERT_TRUE(fallback.has_value());
+  EXPECT_EQ(base.num_fallback_allocations_, 1);
+  allocator.Free(std::move(fallback.value()));
+  EXPECT_EQ(base.num_frees_, 2);
+}
+
+TEST(SizeClassAllocatorTest, BlockOffsetsMatchSlab) {
+  DummyAllocator base;
+  SizeClassAllocator allocator(base, 1024, 16 * 1024);
+
+  auto first = allocator.Allocate(64);
+  auto second = allocator.Allocate(64);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  // Blocks carry their offset within the slab's mmap region.
+  EXPECT_EQ(second->offset_ - first->offset_, 64);
+  allocator.Free(std::move(first.value()));
+  allocator.Free(std::move(second.value()));
+}
+
+}  // namespace plasma
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,193 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/plasma/spill_file_mapper.h"
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "gtest/gtest.h"
+#include "ray/object_manager/plasma/malloc.h"
+#include "src/ray/protobuf/common.pb.h"
+
+namespace plasma {
+
+namespace {
+
+class DummyAllocator : public IAllocator {
+ public:
+  std::optional<Allocation> Allocate(size_t bytes) override {
+    auto allocation = Allocation();
+    allocation.address_ = static_cast<void *>(new char[bytes]);
+    allocation.size_ = static_cast<int64_t>(bytes);
+    allocation.mmap_size_ = static_cast<int64_t>(bytes);
+    allocated_ += bytes;
+    return std::move(allocation);
+  }
+
+  std::optional<Allocation> FallbackAllocate(size_t bytes) override {
+    return Allocate(bytes);
+  }
+
+  void Free(Allocation allocation) override {
+    delete[] static_cast<char *>(allocation.address_);
+    allocated_ -= allocation.size_;
+    num_frees_++;
+  }
+
+  int64_t GetFootprintLimit() const override {
+    return std::numeric_limits<int64_t>::max();
+  }
+
+  int64_t Allocated() const override { return allocated_; }
+
+  int64_t FallbackAllocated() const override { return 0; }
+
+  int64_t num_frees_ = 0;
+
+ private:
+  int64_t allocated_ = 0;
+};
+
+void AppendUINT64(std::string &buffer, uint64_t value) {
+  for (size_t i = 0; i < sizeof(uint64_t); i++) {
+    buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+// Builds a spill file record in the on-disk format produced by the spill
+// workers: three little-endian uint64 sizes, the serialized owner address,
+// the metadata and then the data.
+std::string BuildSpilledObjectRecord(const ray::rpc::Address &owner_address,
+                                     const std::string &metadata,
+                                     const std::string &data) {
+  std::string serialized_address;
+  RAY_CHECK(owner_address.SerializeToString(&serialized_address));
+  std::string record;
+  AppendUINT64(record, serialized_address.size());
+  AppendUINT64(record, metadata.size());
+  AppendUINT64(record, data.size());
+  record += serialized_address;
+  record += metadata;
+  record += data;
+  return record;
+}
+
+std::string WriteSpillFile(const std::string &name, const std::string &content) {
+  std::string path = ::testing::TempDir() + name;
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file << content;
+  file.close();
+  return path;
+}
+
+}  // namespace
+
+TEST(SpillFileMapperTest, MapsRecordAndParsesHeader) {
+  DummyAllocator base;
+  SpillFileMapper mapper(base);
+
+  ray::rpc::Address owner_address;
+  owner_address.set_node_id(ray::NodeID::FromRandom().Binary());
+  owner_address.set_ip_address("10.0.0.1");
+  owner_address.set_port(1234);
+  owner_address.set_worker_id(ray::WorkerID::FromRandom().Binary());
+  const std::string metadata = "META";
+  const std::string data = "0123456789abcdef";
+  const std::string record = BuildSpilledObjectRecord(owner_address, metadata, data);
+
+  // Prefix the record with some other bytes so the offset is non-zero.
+  const std::string prefix(100, 'x');
+  const std::string path = WriteSpillFile("mapper_record", prefix + record);
+  const std::string url =
+      absl::StrFormat("%s?offset=%d&size=%d", path, prefix.size(), record.size());
+
+  ray::ObjectInfo info;
+  auto allocation = mapper.MapSpilledObject(url, &info);
+  ASSERT_TRUE(allocation.has_value());
+
+  EXPECT_EQ(info.data_size, static_cast<int64_t>(data.size()));
+  EXPECT_EQ(info.metadata_size, static_cast<int64_t>(metadata.size()));
+  EXPECT_EQ(info.owner_node_id.Binary(), owner_address.node_id());
+  EXPECT_EQ(info.owner_ip_address, "10.0.0.1");
+  EXPECT_EQ(info.owner_port, 1234);
+  EXPECT_EQ(info.owner_worker_id.Binary(), owner_address.worker_id());
+
+  // The allocation points at the data section; metadata immediately precedes it.
+  EXPECT_EQ(allocation->size_, static_cast<int64_t>(data.size() + metadata.size()));
+  EXPECT_TRUE(allocation->fallback_allocated_);
+  EXPECT_EQ(std::memcmp(allocation->address_, data.data(), data.size()), 0);
+  EXPECT_EQ(std::memcmp(static_cast<char *>(allocation->address_) - metadata.size(),
+                        metadata.data(),
+                        metadata.size()),
+            0);
+  // The mapping covers the file from offset 0 through the end of the record,
+  // plus the gap clients subtract before mapping.
+  EXPECT_EQ(allocation->mmap_size_,
+            static_cast<int64_t>(prefix.size() + record.size() + kMmapRegionsGap));
+  EXPECT_EQ(allocation->offset_,
+            static_cast<ptrdiff_t>(prefix.size() + record.size() - data.size()));
+
+  // The mapped bytes count as fallback-allocated (disk backed), and Free
+  // unmaps without touching the base allocator.
+  EXPECT_EQ(mapper.FallbackAllocated(),
+            static_cast<int64_t>(data.size() + metadata.size()));
+  mapper.Free(std::move(allocation.value()));
+  EXPECT_EQ(mapper.FallbackAllocated(), 0);
+  EXPECT_EQ(base.num_frees_, 0);
+}
+
+TEST(SpillFileMapperTest, RejectsBadURLAndInconsistentRecord) {
+  DummyAllocator base;
+  SpillFileMapper mapper(base);
+  ray::ObjectInfo info;
+
+  EXPECT_FALSE(mapper.MapSpilledObject("not-a-spill-url", &info).has_value());
+  EXPECT_FALSE(
+      mapper.MapSpilledObject("/does/not/exist?offset=0&size=64", &info).has_value());
+
+  // A record whose header sizes don't add up to the URL size is rejected.
+  ray::rpc::Address owner_address;
+  std::string record = BuildSpilledObjectRecord(owner_address, "meta", "data");
+  const std::string path = WriteSpillFile("mapper_bad_record", record);
+  const std::string url =
+      absl::StrFormat("%s?offset=0&size=%d", path, record.size() - 1);
+  EXPECT_FALSE(mapper.MapSpilledObject(url, &info).has_value());
+  EXPECT_EQ(mapper.FallbackAllocated(), 0);
+}
+
+TEST(SpillFileMapperTest, DelegatesRegularAllocations) {
+  DummyAllocator base;
+  SpillFileMapper mapper(base);
+
+  auto allocation = mapper.Allocate(128);
+  ASSERT_TRUE(allocation.has_value());
+  EXPECT_EQ(mapper.Allocated(), 128);
+  EXPECT_EQ(mapper.FallbackAllocated(), 0);
+  mapper.Free(std::move(allocation.value()));
+  EXPECT_EQ(mapper.Allocated(), 0);
+  EXPECT_EQ(base.num_frees_, 1);
+}
+
+}  // namespace plasma
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
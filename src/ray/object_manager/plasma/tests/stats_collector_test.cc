@@ -14,12 +14,16 @@
 
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "absl/random/random.h"
+#include "absl/time/clock.h"
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/object_manager/plasma/obj_lifecycle_mgr.h"
 
 using plasma::flatbuf::ObjectSource;
@@ -306,4 +310,47 @@ TEST_F(ObjectStatsCollectorTest, RefCountPassThrough) {
   manager_->DeleteObject(id2);
   ExpectStatsMatch();
 }
+
+TEST_F(ObjectStatsCollectorTest, DetailedStatsBreakdown) {
+  RayConfig::instance().initialize(
+      R"({"object_store_detailed_stats_enabled": true})");
+  // Recreate the collector so it picks up the config.
+  Reset();
+
+  // The breakdown is maintained by the sampler thread, so poll the dump.
+  auto dump_contains = [&](const std::string &needle) {
+    for (int i = 0; i < 500; i++) {
+      std::stringstream buffer;
+      collector_->GetDebugDump(buffer);
+      if (buffer.str().find(needle) != std::string::npos) {
+        return true;
+      }
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    return false;
+  };
+
+  const auto owner_worker_id = ray::WorkerID::FromRandom();
+
+  auto info1 = CreateNewObjectInfo(100);
+  info1.owner_worker_id = owner_worker_id;
+  manager_->CreateObject(info1, ObjectSource::CreatedByWorker, false);
+
+  auto info2 = CreateNewObjectInfo(100);
+  info2.owner_worker_id = owner_worker_id;
+  manager_->CreateObject(info2, ObjectSource::CreatedByWorker, false);
+
+  // Both objects land in the 128-byte size class and the same owner.
+  EXPECT_TRUE(dump_contains("- <= 128 bytes: 2 objects, 200 bytes"));
+  EXPECT_TRUE(
+      dump_contains("- " + owner_worker_id.Hex() + ": 2 objects, 200 bytes"));
+
+  manager_->DeleteObject(info1.object_id);
+  EXPECT_TRUE(dump_contains("- <= 128 bytes: 1 objects, 100 bytes"));
+  EXPECT_TRUE(
+      dump_contains("- " + owner_worker_id.Hex() + ": 1 objects, 100 bytes"));
+
+  RayConfig::instance().initialize(
+      R"({"object_store_detailed_stats_enabled": false})");
+}
 }  // namespace plasma
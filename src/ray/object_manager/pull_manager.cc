@@ -21,13 +21,21 @@
 #include <vector>
 
 #include "ray/common/ray_config.h"
+#include "ray/util/memory_telemetry.h"
 
 namespace ray {
 
+namespace {
+/// Weight of the newest sample in the pull bandwidth and restore throughput
+/// moving averages used by cost based source selection.
+constexpr double kThroughputSampleWeight = 0.2;
+}  // namespace
+
 PullManager::PullManager(
     NodeID self_node_id,
     std::function<bool(const ObjectID &)> object_is_local,
-    std::function<void(const ObjectID &, const NodeID &)> send_pull_request,
+    std::function<void(const ObjectID &, const NodeID &, uint64_t, uint64_t)>
+        send_pull_request,
     std::function<void(const ObjectID &)> cancel_pull_request,
     std::function<void(const ObjectID &, rpc::ErrorType)> fail_pull_request,
     RestoreSpilledObjectCallback restore_spilled_object,
@@ -47,12 +55,31 @@ PullManager::PullManager(
       pin_object_(std::move(pin_object)),
       get_locally_spilled_object_url_(std::move(get_locally_spilled_object_url)),
       fail_pull_request_(std::move(fail_pull_request)),
-      gen_(std::chrono::high_resolution_clock::now().time_since_epoch().count()) {}
+      gen_(std::chrono::high_resolution_clock::now().time_since_epoch().count()) {
+  if (RayConfig::instance().dynamic_config_enabled()) {
+    // Re-read the pull retry timeout when it is tuned at runtime; it is
+    // cached here because it is normally plumbed in through the
+    // ObjectManagerConfig. The callback runs on the thread applying the
+    // override, which is the main raylet thread that also drives pulls.
+    pull_timeout_config_callback_id_ = RayConfig::instance().RegisterOnChangeCallback(
+        "object_manager_pull_timeout_ms", [this]() {
+          pull_timeout_ms_ = RayConfig::instance().object_manager_pull_timeout_ms();
+        });
+  }
+}
+
+PullManager::~PullManager() {
+  if (pull_timeout_config_callback_id_ >= 0) {
+    RayConfig::instance().UnregisterOnChangeCallback(pull_timeout_config_callback_id_);
+  }
+}
 
 uint64_t PullManager::Pull(const std::vector<rpc::ObjectReference> &object_ref_bundle,
                            BundlePriority prio,
                            const TaskMetricsKey &task_key,
                            std::vector<rpc::ObjectReference> *objects_to_locate) {
+  // Attribute the pull bookkeeping allocated below to the object pull subsystem.
+  ScopedMemoryTag memory_tag(MemoryTag::kObjectPulls);
   // To avoid edge cases dealing with duplicated object ids in the bundle,
   // canonicalize the set up-front by dropping all duplicates.
   absl::flat_hash_set<ObjectID> seen;
@@ -359,6 +386,42 @@ std::vector<ObjectID> PullManager::CancelPull(uint64_t request_id) {
   return object_ids_to_cancel_subscription;
 }
 
+void PullManager::HandleNodeRemoved(const NodeID &node_id) {
+  // Any bandwidth estimate for the node is stale now.
+  pull_bytes_per_second_.erase(node_id);
+
+  std::vector<ObjectID> objects_to_retry;
+  for (auto &[object_id, request] : object_pull_requests_) {
+    auto &locations = request.client_locations;
+    locations.erase(std::remove(locations.begin(), locations.end(), node_id),
+                    locations.end());
+    if (request.spilled_node_id == node_id) {
+      // The spilled copy went down with the node.
+      request.spilled_node_id = NodeID::Nil();
+      request.spilled_url.clear();
+    }
+    if (std::find(request.last_pull_sources.begin(),
+                  request.last_pull_sources.end(),
+                  node_id) != request.last_pull_sources.end()) {
+      // The in-flight pull (or part of a striped pull) was addressed to the
+      // dead node and will never complete. The backoff reflects the dead
+      // peer, not the surviving sources, so retry immediately; num_retries
+      // is kept so the backoff resumes where it left off if the retry fails.
+      request.last_pull_dispatch_time = 0;
+      request.last_pull_sources.clear();
+      if (request.next_pull_time > get_time_seconds_()) {
+        request.next_pull_time = get_time_seconds_();
+      }
+      objects_to_retry.push_back(object_id);
+    }
+  }
+
+  absl::MutexLock lock(&active_objects_mu_);
+  for (const auto &object_id : objects_to_retry) {
+    TryToMakeObjectLocal(object_id);
+  }
+}
+
 void PullManager::OnLocationChange(const ObjectID &object_id,
                                    const std::unordered_set<NodeID> &client_ids,
                                    const std::string &spilled_url,
@@ -372,6 +435,20 @@ void PullManager::OnLocationChange(const ObjectID &object_id,
   }
 
   const bool was_pullable_before = it->second.IsPullable();
+  // Snapshot the sources known before this update, so a source that appears
+  // for the first time can bypass the retry backoff below.
+  const bool retry_on_new_locations =
+      RayConfig::instance().pull_manager_retry_on_new_locations();
+  absl::flat_hash_set<NodeID> previous_sources;
+  bool had_spilled_url = false;
+  if (retry_on_new_locations) {
+    previous_sources.insert(it->second.client_locations.begin(),
+                            it->second.client_locations.end());
+    if (!it->second.spilled_node_id.IsNil()) {
+      previous_sources.insert(it->second.spilled_node_id);
+    }
+    had_spilled_url = !it->second.spilled_url.empty();
+  }
   // Reset the list of clients that are now expected to have the object.
   // NOTE(swang): Since we are overwriting the previous list of clients,
   // we may end up sending a duplicate request to the same client as
@@ -437,6 +514,17 @@ void PullManager::OnLocationChange(const ObjectID &object_id,
   RAY_LOG(DEBUG) << object_id << " OnLocationChange " << spilled_url << " num clients "
                  << client_ids.size();
 
+  if (retry_on_new_locations && it->second.next_pull_time > get_time_seconds_() &&
+      HasNewSource(it->second, previous_sources, had_spilled_url)) {
+    // The retry timer is backing off because the known sources failed to
+    // deliver the object, but that says nothing about the source that just
+    // appeared. Retry immediately; num_retries is kept so the backoff resumes
+    // where it left off if the new source fails too.
+    RAY_LOG(DEBUG) << "New source for object " << object_id
+                   << ", bypassing the retry backoff";
+    it->second.next_pull_time = get_time_seconds_();
+  }
+
   {
     absl::MutexLock lock(&active_objects_mu_);
     TryToMakeObjectLocal(object_id);
@@ -460,15 +548,8 @@ void PullManager::TryToMakeObjectLocal(const ObjectID &object_id) {
     return;
   }
 
-  // Try to pull the object from a remote node. If the object is spilled on the local
-  // disk of the remote node, it will be restored by PushManager prior to pushing.
-  bool did_pull = PullFromRandomLocation(object_id);
-  if (did_pull) {
-    UpdateRetryTimer(request, object_id);
-    return;
-  }
-
-  // check if we can restore the object directly in the current raylet.
+  // Check whether the object can be restored directly in the current raylet
+  // up front, so the cost model below can weigh both options.
   // first check local spilled objects
   std::string direct_restore_url = get_locally_spilled_object_url_(object_id);
   if (direct_restore_url.empty()) {
@@ -476,21 +557,44 @@ void PullManager::TryToMakeObjectLocal(const ObjectID &object_id) {
       direct_restore_url = request.spilled_url;
     }
   }
+
+  // Try to pull the object from a remote node, unless restoring it from local
+  // external storage is estimated to be cheaper. If the object is spilled on
+  // the local disk of the remote node, it will be restored by PushManager
+  // prior to pushing.
+  if (direct_restore_url.empty() || !ShouldRestoreOverPull(request)) {
+    bool did_pull = PullFromRandomLocation(object_id);
+    if (did_pull) {
+      UpdateRetryTimer(request, object_id);
+      return;
+    }
+  }
+
   if (!direct_restore_url.empty()) {
     // Select an url from the object directory update
     UpdateRetryTimer(request, object_id);
     // Avoid restore failure by the object already exists.
     // Details: https://github.com/ray-project/ray/issues/31390
     cancel_pull_request_(object_id);
-    restore_spilled_object_(object_id,
-                            request.object_size,
-                            direct_restore_url,
-                            [object_id](const ray::Status &status) {
-                              if (!status.ok()) {
-                                RAY_LOG(ERROR) << "Object restore for " << object_id
-                                               << " failed, will retry later: " << status;
-                              }
-                            });
+    // The pull was cancelled, so the restore must not be credited to the
+    // remote node when the object becomes local.
+    request.last_pull_dispatch_time = 0;
+    request.last_pull_sources.clear();
+    const double restore_start_time = get_time_seconds_();
+    const size_t object_size = request.object_size;
+    restore_spilled_object_(
+        object_id,
+        request.object_size,
+        direct_restore_url,
+        [this, object_id, object_size, restore_start_time](const ray::Status &status) {
+          if (!status.ok()) {
+            RAY_LOG(ERROR) << "Object restore for " << object_id
+                           << " failed, will retry later: " << status;
+            return;
+          }
+          RecordRestoreThroughput(object_size,
+                                  get_time_seconds_() - restore_start_time);
+        });
     return;
   }
 
@@ -523,7 +627,9 @@ bool PullManager::PullFromRandomLocation(const ObjectID &object_id) {
       RAY_LOG(DEBUG).WithField(object_id)
           << "Sending pull request from " << self_node_id_ << " to spilled location at "
           << spilled_node_id;
-      send_pull_request_(object_id, spilled_node_id);
+      it->second.last_pull_dispatch_time = get_time_seconds_();
+      it->second.last_pull_sources = {spilled_node_id};
+      send_pull_request_(object_id, spilled_node_id, 0, 0);
       return true;
     }
     // The timer should never fire if there are no expected client locations.
@@ -532,6 +638,46 @@ bool PullManager::PullFromRandomLocation(const ObjectID &object_id) {
 
   RAY_CHECK(!object_is_local_(object_id));
 
+  // For large objects with several known locations, stripe the pull across
+  // the locations so the transfer is not capped by a single source's
+  // bandwidth. Each source is asked for a disjoint chunk index range and the
+  // chunks are reassembled locally by the object buffer pool.
+  if (RayConfig::instance().pull_manager_striped_pulls() && node_vector.size() > 1 &&
+      it->second.object_size_set &&
+      it->second.object_size >=
+          RayConfig::instance().pull_manager_striped_pull_min_object_size()) {
+    const uint64_t chunk_size = RayConfig::instance().object_manager_default_chunk_size();
+    const uint64_t num_chunks =
+        std::max<uint64_t>(1, (it->second.object_size + chunk_size - 1) / chunk_size);
+    const uint64_t num_sources =
+        std::min<uint64_t>(node_vector.size(), num_chunks);
+    // Rotate the stripe assignment across retries so that when a straggler
+    // source forces the pull to be re-dispatched, its range is handed to a
+    // different node.
+    const uint64_t rotation = it->second.num_retries;
+    const uint64_t chunks_per_source = num_chunks / num_sources;
+    const uint64_t num_extra_chunks = num_chunks % num_sources;
+    it->second.last_pull_dispatch_time = get_time_seconds_();
+    it->second.last_pull_sources.clear();
+    uint64_t chunk_index_start = 0;
+    for (uint64_t i = 0; i < num_sources; i++) {
+      const NodeID &node_id = node_vector[(i + rotation) % node_vector.size()];
+      RAY_CHECK(node_id != self_node_id_);
+      const uint64_t num_source_chunks =
+          chunks_per_source + (i < num_extra_chunks ? 1 : 0);
+      RAY_LOG(DEBUG).WithField(object_id)
+          << "Sending striped pull request from " << self_node_id_
+          << " to in-memory location at " << node_id << " for chunks ["
+          << chunk_index_start << ", " << chunk_index_start + num_source_chunks << ")";
+      it->second.last_pull_sources.push_back(node_id);
+      send_pull_request_(
+          object_id, node_id, chunk_index_start, chunk_index_start + num_source_chunks);
+      chunk_index_start += num_source_chunks;
+    }
+    RAY_CHECK_EQ(chunk_index_start, num_chunks);
+    return true;
+  }
+
   // Choose a random client to pull the object from.
   // Generate a random index.
   std::uniform_int_distribution<int> distribution(0, node_vector.size() - 1);
@@ -540,10 +686,98 @@ bool PullManager::PullFromRandomLocation(const ObjectID &object_id) {
   RAY_CHECK(node_id != self_node_id_);
   RAY_LOG(DEBUG).WithField(object_id) << "Sending pull request from " << self_node_id_
                                       << " to in-memory location at " << node_id;
-  send_pull_request_(object_id, node_id);
+  it->second.last_pull_dispatch_time = get_time_seconds_();
+  it->second.last_pull_sources = {node_id};
+  send_pull_request_(object_id, node_id, 0, 0);
   return true;
 }
 
+bool PullManager::HasNewSource(const ObjectPullRequest &request,
+                               const absl::flat_hash_set<NodeID> &previous_sources,
+                               bool had_spilled_url) const {
+  for (const auto &node_id : request.client_locations) {
+    if (!previous_sources.contains(node_id)) {
+      return true;
+    }
+  }
+  if (!request.spilled_node_id.IsNil() &&
+      !previous_sources.contains(request.spilled_node_id)) {
+    return true;
+  }
+  return !had_spilled_url && !request.spilled_url.empty();
+}
+
+bool PullManager::ShouldRestoreOverPull(const ObjectPullRequest &request) const {
+  if (!RayConfig::instance().pull_manager_cost_based_source_selection()) {
+    return false;
+  }
+  bool has_remote_source = false;
+  double best_pull_bps = 0;
+  const auto default_pull_bps = static_cast<double>(
+      RayConfig::instance().pull_manager_default_pull_bytes_per_second());
+  auto consider_source = [&](const NodeID &node_id) {
+    has_remote_source = true;
+    auto it = pull_bytes_per_second_.find(node_id);
+    best_pull_bps = std::max(
+        best_pull_bps, it == pull_bytes_per_second_.end() ? default_pull_bps : it->second);
+  };
+  for (const auto &node_id : request.client_locations) {
+    consider_source(node_id);
+  }
+  if (!request.spilled_node_id.IsNil() && request.spilled_node_id != self_node_id_) {
+    consider_source(request.spilled_node_id);
+  }
+  if (!has_remote_source) {
+    // There is nothing to compare against; the caller falls back to the
+    // restore path anyway.
+    return false;
+  }
+  const double restore_bps =
+      restore_bytes_per_second_ > 0
+          ? restore_bytes_per_second_
+          : static_cast<double>(
+                RayConfig::instance().pull_manager_default_restore_bytes_per_second());
+  // Both transfers move the full object, so with no per-source setup cost the
+  // comparison reduces to the throughputs. Ties go to the pull to preserve the
+  // historical preference for in-memory copies.
+  return restore_bps > best_pull_bps;
+}
+
+void PullManager::RecordPullBandwidth(ObjectPullRequest &request, size_t num_bytes) {
+  if (request.last_pull_dispatch_time == 0 || request.last_pull_sources.empty()) {
+    return;
+  }
+  const double elapsed = get_time_seconds_() - request.last_pull_dispatch_time;
+  if (elapsed > 0 && num_bytes > 0) {
+    // A striped pull moved roughly equal shares of the object, so credit each
+    // source with its share rather than the aggregate.
+    const double bytes_per_second = static_cast<double>(num_bytes) /
+                                    request.last_pull_sources.size() / elapsed;
+    for (const auto &node_id : request.last_pull_sources) {
+      auto [it, inserted] = pull_bytes_per_second_.emplace(node_id, bytes_per_second);
+      if (!inserted) {
+        it->second = kThroughputSampleWeight * bytes_per_second +
+                     (1 - kThroughputSampleWeight) * it->second;
+      }
+    }
+  }
+  request.last_pull_dispatch_time = 0;
+  request.last_pull_sources.clear();
+}
+
+void PullManager::RecordRestoreThroughput(size_t num_bytes, double elapsed_seconds) {
+  if (elapsed_seconds <= 0 || num_bytes == 0) {
+    return;
+  }
+  const double bytes_per_second = num_bytes / elapsed_seconds;
+  if (restore_bytes_per_second_ == 0) {
+    restore_bytes_per_second_ = bytes_per_second;
+  } else {
+    restore_bytes_per_second_ = kThroughputSampleWeight * bytes_per_second +
+                                (1 - kThroughputSampleWeight) * restore_bytes_per_second_;
+  }
+}
+
 void PullManager::ResetRetryTimer(const ObjectID &object_id) {
   auto it = object_pull_requests_.find(object_id);
   if (it != object_pull_requests_.end()) {
@@ -615,6 +849,7 @@ bool PullManager::TryPinObject(const ObjectID &object_id) {
           absl::GetCurrentTimeNanos() / 1e3 - it->second.activate_time_ms,
           {{"Type", "MemoryAvailableToPin"}});
     }
+    RecordPullBandwidth(it->second, it->second.object_size);
     return true;
   }
 
@@ -640,6 +875,20 @@ bool PullManager::IsObjectActive(const ObjectID &object_id) const {
   return active_object_pull_requests_.count(object_id) == 1;
 }
 
+bool PullManager::IsObjectUrgent(const ObjectID &object_id) const {
+  auto it = object_pull_requests_.find(object_id);
+  if (it == object_pull_requests_.end()) {
+    return false;
+  }
+  for (const auto &bundle_request_id : it->second.bundle_request_ids) {
+    if (get_request_bundles_.requests.contains(bundle_request_id) ||
+        task_argument_bundles_.requests.contains(bundle_request_id)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 const PullManager::BundlePullRequestQueue &PullManager::GetBundlePullRequestQueue(
     uint64_t request_id) const {
   if (get_request_bundles_.requests.contains(request_id)) {
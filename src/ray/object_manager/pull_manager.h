@@ -57,7 +57,9 @@ class PullManager {
   /// \param object_is_local A callback which should return true if a given object is
   /// already on the local node.
   /// \param send_pull_request A callback which should send a
-  /// pull request to the specified node.
+  /// pull request to the specified node for the given chunk index range
+  /// [chunk_index_start, chunk_index_end). A chunk_index_end of 0 requests the
+  /// whole object.
   /// \param cancel_pull_request A callback which should
   /// cancel pulling an object.
   /// \param restore_spilled_object A callback which should
@@ -65,7 +67,8 @@ class PullManager {
   PullManager(
       NodeID self_node_id,
       std::function<bool(const ObjectID &)> object_is_local,
-      std::function<void(const ObjectID &, const NodeID &)> send_pull_request,
+      std::function<void(const ObjectID &, const NodeID &, uint64_t, uint64_t)>
+          send_pull_request,
       std::function<void(const ObjectID &)> cancel_pull_request,
       std::function<void(const ObjectID &, rpc::ErrorType)> fail_pull_request,
       RestoreSpilledObjectCallback restore_spilled_object,
@@ -75,6 +78,8 @@ class PullManager {
       std::function<std::unique_ptr<RayObject>(const ObjectID &object_id)> pin_object,
       std::function<std::string(const ObjectID &)> get_locally_spilled_object_url);
 
+  ~PullManager();
+
   /// Add a new pull request for a bundle of objects. The objects in the
   /// request will get pulled once:
   /// 1. Their sizes are known.
@@ -128,6 +133,17 @@ class PullManager {
   /// locations.
   std::vector<ObjectID> CancelPull(uint64_t request_id);
 
+  /// Handle a node being removed from the cluster. The node is dropped from
+  /// every pull request's known locations so that no further pulls are
+  /// dispatched at it, and any pull that was in flight to the node is retried
+  /// immediately from the remaining sources instead of waiting out the retry
+  /// backoff. The object directory will eventually deliver the same
+  /// information via OnLocationChange, but only after its own notification
+  /// round trip; reacting here keeps the failure off the pull critical path.
+  ///
+  /// \param node_id The ID of the node that was removed.
+  void HandleNodeRemoved(const NodeID &node_id);
+
   /// Called when the retry timer fires. If this fires, the pull manager may try to pull
   /// existing objects from other nodes if necessary.
   void Tick();
@@ -151,6 +167,12 @@ class PullManager {
   /// This method (and this method only) is thread-safe.
   bool IsObjectActive(const ObjectID &object_id) const;
 
+  /// Returns whether the object is needed by a `ray.get` request or by a
+  /// queued task's arguments, as opposed to only `ray.wait` requests. Urgent
+  /// objects are flagged in the pull request so the pushing node can schedule
+  /// them ahead of bulk transfers.
+  bool IsObjectUrgent(const ObjectID &object_id) const;
+
   /// Check whether the pull request is currently active or waiting for object
   /// size information. If this returns false, then the pull request is most
   /// likely inactive due to lack of memory.
@@ -194,6 +216,11 @@ class PullManager {
     uint8_t num_retries = 0;
     bool object_size_set = false;
     size_t object_size = 0;
+    /// The time at which the most recent pull for this object was dispatched
+    /// and the nodes it was dispatched to. Used to estimate the per-node pull
+    /// bandwidth once the object arrives; zero/empty if no pull is in flight.
+    double last_pull_dispatch_time = 0;
+    std::vector<NodeID> last_pull_sources;
     // All bundle requests that haven't been canceled yet that require this
     // object. This includes bundle requests whose objects are not actively
     // being pulled.
@@ -384,6 +411,30 @@ class PullManager {
   /// \param object_id The object id for the request.
   void UpdateRetryTimer(ObjectPullRequest &request, const ObjectID &object_id);
 
+  /// Whether the latest location update added a source for the object that
+  /// was not in `previous_sources` (the nodes and spilled copy known before
+  /// the update). Used by OnLocationChange to decide whether a backing off
+  /// pull should be retried immediately when
+  /// pull_manager_retry_on_new_locations is enabled.
+  bool HasNewSource(const ObjectPullRequest &request,
+                    const absl::flat_hash_set<NodeID> &previous_sources,
+                    bool had_spilled_url) const;
+
+  /// Whether restoring the object from local external storage is estimated to
+  /// be cheaper than pulling it from a remote node. Always false unless
+  /// pull_manager_cost_based_source_selection is enabled. The estimates are
+  /// the observed per-node pull bandwidth and the observed local restore
+  /// throughput, falling back to configured defaults before the first
+  /// measurement.
+  bool ShouldRestoreOverPull(const ObjectPullRequest &request) const;
+
+  /// Fold the transfer that just made this object local into the pull
+  /// bandwidth estimates for the nodes the last pull was dispatched to.
+  void RecordPullBandwidth(ObjectPullRequest &request, size_t num_bytes);
+
+  /// Fold a finished restore into the local restore throughput estimate.
+  void RecordRestoreThroughput(size_t num_bytes, double elapsed_seconds);
+
   /// Activate the next pull request in the queue. This will start pulls for
   /// any objects in the request that are not already being pulled.
   ///
@@ -429,12 +480,17 @@ class PullManager {
   /// See the constructor's arguments.
   NodeID self_node_id_;
   const std::function<bool(const ObjectID &)> object_is_local_;
-  const std::function<void(const ObjectID &, const NodeID &)> send_pull_request_;
+  const std::function<void(const ObjectID &, const NodeID &, uint64_t, uint64_t)>
+      send_pull_request_;
   const std::function<void(const ObjectID &)> cancel_pull_request_;
   const RestoreSpilledObjectCallback restore_spilled_object_;
   const std::function<double()> get_time_seconds_;
   uint64_t pull_timeout_ms_;
 
+  /// Id of the dynamic config callback that re-reads the pull retry timeout,
+  /// or -1 if dynamic config is disabled.
+  int64_t pull_timeout_config_callback_id_ = -1;
+
   /// The next ID to assign to a bundle pull request, so that the caller can
   /// cancel. Start at 1 because 0 means null.
   uint64_t next_req_id_ = 1;
@@ -506,6 +562,14 @@ class PullManager {
 
   /// Internally maintained random number generator.
   std::mt19937_64 gen_;
+
+  /// Exponential moving average of the observed pull bandwidth per source
+  /// node, in bytes per second. Fed into cost based source selection.
+  absl::flat_hash_map<NodeID, double> pull_bytes_per_second_;
+  /// Exponential moving average of the observed local restore throughput in
+  /// bytes per second. Zero until the first restore completes.
+  double restore_bytes_per_second_ = 0;
+
   int64_t max_timeout_ = 0;
   ObjectID max_timeout_object_id_;
   int64_t num_tries_total_ = 0;
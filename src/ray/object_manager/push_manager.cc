@@ -14,6 +14,8 @@
 
 #include "ray/object_manager/push_manager.h"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -22,72 +24,157 @@ namespace ray {
 void PushManager::StartPush(const NodeID &dest_id,
                             const ObjectID &obj_id,
                             int64_t num_chunks,
-                            std::function<void(int64_t)> send_chunk_fn) {
+                            std::function<void(int64_t)> send_chunk_fn,
+                            PushPriority priority) {
   auto push_id = std::make_pair(dest_id, obj_id);
   RAY_CHECK(num_chunks > 0);
 
   auto &dest_map = push_state_map_[dest_id];
   auto it = dest_map.find(obj_id);
+  if (it != dest_map.end() && it->second->num_chunks_ != num_chunks) {
+    // The new request covers a different number of chunks than the pending
+    // push, e.g. a re-striped pull handed this destination a different chunk
+    // range. Drop the stale state and start over.
+    chunks_remaining_ -= it->second->num_chunks_to_send_;
+    Lane(it->second->priority_).erase(it->second);
+    dest_map.erase(it);
+    it = dest_map.end();
+  }
   if (it == dest_map.end()) {
+    auto &lane = Lane(priority);
     chunks_remaining_ += num_chunks;
-    dest_map[obj_id] = push_requests_with_chunks_to_send_.emplace(
-        push_requests_with_chunks_to_send_.end(),
-        dest_id,
-        obj_id,
-        num_chunks,
-        std::move(send_chunk_fn));
+    dest_map[obj_id] = lane.emplace(
+        lane.end(), dest_id, obj_id, num_chunks, std::move(send_chunk_fn), priority);
   } else {
     RAY_LOG(DEBUG) << "Duplicate push request " << push_id.first << ", " << push_id.second
                    << ", resending all the chunks.";
     RAY_CHECK_NE(it->second->num_chunks_to_send_, 0);
     chunks_remaining_ += it->second->ResendAllChunks(std::move(send_chunk_fn));
+    if (priority > it->second->priority_) {
+      // Promote the pending push so the retry jumps the queue too.
+      auto &to = Lane(priority);
+      to.splice(to.end(), Lane(it->second->priority_), it->second);
+      it->second->priority_ = priority;
+    }
   }
   ScheduleRemainingPushes();
 }
 
-void PushManager::OnChunkComplete() {
+void PushManager::OnChunkComplete(const NodeID &dest_id, bool success) {
   chunks_in_flight_ -= 1;
   chunks_remaining_ -= 1;
+  auto it = chunks_in_flight_per_node_.find(dest_id);
+  RAY_CHECK(it != chunks_in_flight_per_node_.end());
+  if (--it->second == 0) {
+    chunks_in_flight_per_node_.erase(it);
+  }
+  if (adaptive_in_flight_budget_) {
+    UpdateNodeBudget(dest_id, success);
+  }
   ScheduleRemainingPushes();
 }
 
-void PushManager::ScheduleRemainingPushes() {
-  // TODO(ekl) this isn't the best implementation of round robin, we should
-  // consider tracking the number of chunks active per-push and balancing those.
-  // TODO(dayshah): Does round-robin even make sense here? We should probably finish
-  // pushes in the order they were asked for, so that some finish and some work can start.
-  // Otherwise all work will be halted for a period of time
-
-  // Loop over all active pushes for approximate round-robin prioritization.
-  bool keep_looping = true;
-  while (chunks_in_flight_ < max_chunks_in_flight_ && keep_looping) {
-    // Loop over each active push and try to send another chunk.
-    // If we could push out a chunk and haven't reached the chunks_in_flight_ limit,
-    // we'll loop again to try to send more chunks.
-    keep_looping = false;
-    auto iter = push_requests_with_chunks_to_send_.begin();
-    while (iter != push_requests_with_chunks_to_send_.end() &&
-           chunks_in_flight_ < max_chunks_in_flight_) {
-      auto &push_state = *iter;
-      push_state.SendOneChunk();
-      chunks_in_flight_ += 1;
-      if (push_state.num_chunks_to_send_ == 0) {
-        auto push_state_map_iter = push_state_map_.find(push_state.node_id_);
-        RAY_CHECK(push_state_map_iter != push_state_map_.end());
-
-        auto &dest_map = push_state_map_iter->second;
-        auto dest_map_iter = dest_map.find(push_state.object_id_);
-        RAY_CHECK(dest_map_iter != dest_map.end());
-
-        iter = push_requests_with_chunks_to_send_.erase(dest_map_iter->second);
-        dest_map.erase(dest_map_iter);
-        if (dest_map.empty()) {
-          push_state_map_.erase(push_state_map_iter);
-        }
-      } else {
-        keep_looping = true;
-        iter++;
+void PushManager::UpdateNodeBudget(const NodeID &dest_id, bool success) {
+  auto it = node_budgets_.find(dest_id);
+  if (!success) {
+    // Multiplicative decrease: halve the node's budget, bottoming out at one
+    // chunk so the push can still probe the path.
+    const int64_t limit = it == node_budgets_.end() ? BaseNodeBudget() : it->second.limit;
+    node_budgets_[dest_id] = NodeBudget{std::max<int64_t>(1, limit / 2)};
+    return;
+  }
+  if (it == node_budgets_.end()) {
+    // The node is already at its base budget.
+    return;
+  }
+  // Additive increase: one extra chunk per budget's worth of successful
+  // sends, so recovery takes roughly one round trip per step like TCP's
+  // congestion avoidance.
+  if (++it->second.successes_since_change >= it->second.limit) {
+    it->second.limit += 1;
+    it->second.successes_since_change = 0;
+    if (it->second.limit >= BaseNodeBudget()) {
+      node_budgets_.erase(it);
+    }
+  }
+}
+
+int64_t PushManager::EffectiveNodeLimit(const NodeID &node_id) const {
+  auto it = node_budgets_.find(node_id);
+  if (it != node_budgets_.end()) {
+    return it->second.limit;
+  }
+  return max_chunks_in_flight_per_node_ > 0 ? max_chunks_in_flight_per_node_
+                                            : std::numeric_limits<int64_t>::max();
+}
+
+bool PushManager::NodeAtInFlightLimit(const NodeID &node_id) const {
+  const int64_t limit = EffectiveNodeLimit(node_id);
+  if (limit == std::numeric_limits<int64_t>::max()) {
+    return false;
+  }
+  auto it = chunks_in_flight_per_node_.find(node_id);
+  return it != chunks_in_flight_per_node_.end() && it->second >= limit;
+}
+
+bool PushManager::SendOneChunkFromLane(std::list<PushState> &lane) {
+  for (auto iter = lane.begin(); iter != lane.end(); iter++) {
+    auto &push_state = *iter;
+    if (NodeAtInFlightLimit(push_state.node_id_)) {
+      continue;
+    }
+    push_state.SendOneChunk();
+    chunks_in_flight_ += 1;
+    chunks_in_flight_per_node_[push_state.node_id_] += 1;
+    if (push_state.num_chunks_to_send_ == 0) {
+      auto push_state_map_iter = push_state_map_.find(push_state.node_id_);
+      RAY_CHECK(push_state_map_iter != push_state_map_.end());
+
+      auto &dest_map = push_state_map_iter->second;
+      auto dest_map_iter = dest_map.find(push_state.object_id_);
+      RAY_CHECK(dest_map_iter != dest_map.end());
+
+      lane.erase(dest_map_iter->second);
+      dest_map.erase(dest_map_iter);
+      if (dest_map.empty()) {
+        push_state_map_.erase(push_state_map_iter);
       }
+    } else {
+      // Move the push to the back of its lane for approximate round-robin
+      // prioritization across pushes. This does not invalidate the iterator
+      // stored in push_state_map_.
+      lane.splice(lane.end(), lane, iter);
+    }
+    return true;
+  }
+  return false;
+}
+
+void PushManager::ScheduleRemainingPushes() {
+  auto &urgent_lane = Lane(PushPriority::kUrgent);
+  auto &bulk_lane = Lane(PushPriority::kBulk);
+  // Interleave the two lanes with a weighted round-robin: while both lanes
+  // have chunks waiting, the urgent lane sends urgent_priority_weight_ chunks
+  // for every bulk chunk. This way latency-sensitive pushes jump ahead of
+  // bulk transfers without starving them. A destination at its per-node
+  // in-flight limit is skipped so other destinations can make progress.
+  while (chunks_in_flight_ < max_chunks_in_flight_) {
+    const bool prefer_urgent = urgent_sends_since_bulk_send_ < urgent_priority_weight_;
+    bool sent = false;
+    if (prefer_urgent && SendOneChunkFromLane(urgent_lane)) {
+      urgent_sends_since_bulk_send_ += 1;
+      sent = true;
+    } else if (SendOneChunkFromLane(bulk_lane)) {
+      urgent_sends_since_bulk_send_ = 0;
+      sent = true;
+    } else if (!prefer_urgent && SendOneChunkFromLane(urgent_lane)) {
+      // The urgent lane was passed over to give the (empty or blocked) bulk
+      // lane a turn; let it use the slot instead.
+      urgent_sends_since_bulk_send_ += 1;
+      sent = true;
+    }
+    if (!sent) {
+      break;
     }
   }
 }
@@ -98,9 +185,10 @@ void PushManager::HandleNodeRemoved(const NodeID &node_id) {
     return;
   }
   for (auto &[_, push_state_iter] : push_state_map_iter->second) {
-    push_requests_with_chunks_to_send_.erase(push_state_iter);
+    Lane(push_state_iter->priority_).erase(push_state_iter);
   }
   push_state_map_.erase(node_id);
+  node_budgets_.erase(node_id);
 }
 
 void PushManager::RecordMetrics() const {
@@ -116,6 +204,10 @@ std::string PushManager::DebugString() const {
   result << "\n- num chunks in flight: " << NumChunksInFlight();
   result << "\n- num chunks remaining: " << NumChunksRemaining();
   result << "\n- max chunks allowed: " << max_chunks_in_flight_;
+  result << "\n- max chunks allowed per node: " << max_chunks_in_flight_per_node_;
+  if (adaptive_in_flight_budget_) {
+    result << "\n- num nodes under congestion backoff: " << node_budgets_.size();
+  }
   return result.str();
 }
 
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <string>
 #include <utility>
@@ -24,21 +25,52 @@
 
 namespace ray {
 
-/// Manages rate limiting and deduplication of outbound object pushes.
+/// Priority class of an outbound push. Urgent pushes (e.g. task arguments and
+/// ray.get() requests blocked on the object) are scheduled ahead of bulk
+/// transfers such as rebalancing, so a large broadcast cannot starve them.
+enum class PushPriority : uint8_t {
+  /// Default lane for bulk transfers.
+  kBulk = 0,
+  /// Lane for latency-sensitive pushes that should jump the queue.
+  kUrgent = 1,
+};
+
+/// Manages rate limiting, prioritization and deduplication of outbound object
+/// pushes.
 class PushManager {
  public:
   /// Create a push manager.
   ///
   /// \param max_chunks_in_flight Max number of chunks allowed to be in flight
   ///                             from this PushManager (this raylet).
-  explicit PushManager(int64_t max_chunks_in_flight)
-      : max_chunks_in_flight_(max_chunks_in_flight) {
+  /// \param max_chunks_in_flight_per_node Max number of chunks allowed to be
+  ///                             in flight to a single destination node, so one
+  ///                             slow receiver cannot consume the whole budget.
+  ///                             0 means no per-node limit.
+  /// \param urgent_priority_weight Number of urgent chunks to send for each
+  ///                             bulk chunk while both lanes have chunks
+  ///                             waiting, so bulk transfers are not starved.
+  /// \param adaptive_in_flight_budget Whether to adapt the per-node in-flight
+  ///                             budget to congestion feedback: failed chunk
+  ///                             sends to a node halve its budget and
+  ///                             successful sends grow it back additively.
+  explicit PushManager(int64_t max_chunks_in_flight,
+                       int64_t max_chunks_in_flight_per_node = 0,
+                       int64_t urgent_priority_weight = 4,
+                       bool adaptive_in_flight_budget = false)
+      : max_chunks_in_flight_(max_chunks_in_flight),
+        max_chunks_in_flight_per_node_(max_chunks_in_flight_per_node),
+        urgent_priority_weight_(urgent_priority_weight),
+        adaptive_in_flight_budget_(adaptive_in_flight_budget) {
     RAY_CHECK_GT(max_chunks_in_flight_, 0);
+    RAY_CHECK_GT(urgent_priority_weight_, 0);
   };
 
   /// Start pushing an object subject to max chunks in flight limit.
   ///
   /// Duplicate concurrent pushes to the same destination will be suppressed.
+  /// If a duplicate push requests a higher priority, the pending push is
+  /// promoted to that priority.
   ///
   /// \param dest_id The node to send to.
   /// \param obj_id The object to send.
@@ -46,14 +78,20 @@ class PushManager {
   /// \param send_chunk_fn This function will be called with args 0...{num_chunks-1}.
   ///                      The caller promises to call PushManager::OnChunkComplete()
   ///                      once a call to send_chunk_fn finishes.
+  /// \param priority The priority lane to schedule the push in.
   void StartPush(const NodeID &dest_id,
                  const ObjectID &obj_id,
                  int64_t num_chunks,
-                 std::function<void(int64_t)> send_chunk_fn);
+                 std::function<void(int64_t)> send_chunk_fn,
+                 PushPriority priority = PushPriority::kBulk);
 
   /// Called every time a chunk completes to trigger additional sends.
   /// TODO(ekl) maybe we should cancel the entire push on error.
-  void OnChunkComplete();
+  ///
+  /// \param dest_id The node the completed chunk was sent to.
+  /// \param success Whether the chunk was delivered. Only used as congestion
+  ///                feedback when the adaptive in-flight budget is enabled.
+  void OnChunkComplete(const NodeID &dest_id, bool success = true);
 
   /// Cancel all pushes that have not yet been sent to the removed node.
   void HandleNodeRemoved(const NodeID &node_id);
@@ -66,7 +104,11 @@ class PushManager {
 
   /// Return the number of push requests with remaining chunks. For metrics and testing.
   int64_t NumPushRequestsWithChunksToSend() const {
-    return push_requests_with_chunks_to_send_.size();
+    size_t total = 0;
+    for (const auto &lane : push_requests_with_chunks_to_send_) {
+      total += lane.size();
+    }
+    return total;
   };
 
   /// Record the internal metrics.
@@ -77,6 +119,7 @@ class PushManager {
  private:
   FRIEND_TEST(TestPushManager, TestPushState);
   FRIEND_TEST(TestPushManager, TestNodeRemoved);
+  FRIEND_TEST(TestPushManager, TestAdaptiveInFlightBudget);
 
   /// Tracks the state of an active object push to another node.
   struct PushState {
@@ -87,6 +130,8 @@ class PushManager {
     int64_t num_chunks_;
     /// The function to send chunks with.
     std::function<void(int64_t)> chunk_send_fn_;
+    /// The priority lane this push is scheduled in.
+    PushPriority priority_;
     /// The index of the next chunk to send.
     int64_t next_chunk_id_ = 0;
     /// The number of chunks remaining to send.
@@ -95,11 +140,13 @@ class PushManager {
     PushState(NodeID node_id,
               ObjectID object_id,
               int64_t num_chunks,
-              std::function<void(int64_t)> chunk_send_fn)
+              std::function<void(int64_t)> chunk_send_fn,
+              PushPriority priority = PushPriority::kBulk)
         : node_id_(node_id),
           object_id_(object_id),
           num_chunks_(num_chunks),
           chunk_send_fn_(std::move(chunk_send_fn)),
+          priority_(priority),
           num_chunks_to_send_(num_chunks) {}
 
     /// Resend all chunks and returns how many more chunks will be sent.
@@ -123,12 +170,74 @@ class PushManager {
   /// Called on completion events to trigger additional pushes.
   void ScheduleRemainingPushes();
 
+  /// Send one chunk from the given lane, round-robining across its pushes and
+  /// skipping destinations that are at their per-node in-flight limit.
+  ///
+  /// \return Whether a chunk was sent.
+  bool SendOneChunkFromLane(std::list<PushState> &lane);
+
+  /// Whether the given destination is at its per-node in-flight limit.
+  bool NodeAtInFlightLimit(const NodeID &node_id) const;
+
+  /// The per-node in-flight limit currently in effect for the given
+  /// destination: the static limit, lowered by congestion backoff when the
+  /// adaptive budget is enabled.
+  int64_t EffectiveNodeLimit(const NodeID &node_id) const;
+
+  /// Apply congestion feedback for a completed chunk send to the node's
+  /// in-flight budget (AIMD: halve on failure, grow back one chunk per
+  /// budget's worth of successes).
+  void UpdateNodeBudget(const NodeID &dest_id, bool success);
+
+  /// The base per-node in-flight budget the adaptive budget decays from and
+  /// recovers towards.
+  int64_t BaseNodeBudget() const {
+    return max_chunks_in_flight_per_node_ > 0 ? max_chunks_in_flight_per_node_
+                                              : max_chunks_in_flight_;
+  }
+
+  /// Return the pending push lane for the given priority.
+  std::list<PushState> &Lane(PushPriority priority) {
+    return push_requests_with_chunks_to_send_[static_cast<size_t>(priority)];
+  }
+
   /// Max number of chunks in flight allowed.
   const int64_t max_chunks_in_flight_;
 
+  /// Max number of chunks in flight to a single node. 0 means no limit.
+  const int64_t max_chunks_in_flight_per_node_;
+
+  /// Number of urgent chunks to send per bulk chunk when both lanes have
+  /// chunks waiting.
+  const int64_t urgent_priority_weight_;
+
+  /// Whether completed chunk sends feed back into the per-node in-flight
+  /// budget.
+  const bool adaptive_in_flight_budget_;
+
   /// Running count of chunks in flight, used to limit progress of in_flight_pushes_.
   int64_t chunks_in_flight_ = 0;
 
+  /// Per-destination count of chunks in flight, used to enforce the per-node
+  /// in-flight limit. Entries are erased when they drop to zero.
+  absl::flat_hash_map<NodeID, int64_t> chunks_in_flight_per_node_;
+
+  /// Per-destination congestion state, only tracked for nodes whose budget is
+  /// currently below the base limit. Entries are erased once a node's budget
+  /// recovers to the base limit.
+  struct NodeBudget {
+    /// The current in-flight budget for the node.
+    int64_t limit;
+    /// Successful sends since the budget was last changed, used for the
+    /// additive-increase half of AIMD.
+    int64_t successes_since_change = 0;
+  };
+  absl::flat_hash_map<NodeID, NodeBudget> node_budgets_;
+
+  /// Number of urgent chunks sent since the last bulk chunk, used for the
+  /// weighted interleaving of the two lanes.
+  int64_t urgent_sends_since_bulk_send_ = 0;
+
   /// Remaining count of chunks to push to other nodes.
   int64_t chunks_remaining_ = 0;
 
@@ -137,8 +246,9 @@ class PushManager {
                       absl::flat_hash_map<ObjectID, std::list<PushState>::iterator>>
       push_state_map_;
 
-  /// The list of push requests with chunks waiting to be sent.
-  std::list<PushState> push_requests_with_chunks_to_send_;
+  /// The pending push requests with chunks waiting to be sent, one lane per
+  /// priority class.
+  std::array<std::list<PushState>, 2> push_requests_with_chunks_to_send_;
 
   mutable ray::stats::Gauge push_manager_num_pushes_remaining_gauge_{
       GetPushManagerNumPushesRemainingGaugeMetric()};
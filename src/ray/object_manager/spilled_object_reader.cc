@@ -14,7 +14,16 @@
 
 #include "ray/object_manager/spilled_object_reader.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
 #include <fstream>
+#include <memory>
 #include <regex>
 #include <string>
 #include <utility>
@@ -26,6 +35,39 @@ namespace {
 const size_t UINT64_size = sizeof(uint64_t);
 }
 
+/* static */ std::shared_ptr<ReadOnlyFileMapping> ReadOnlyFileMapping::Create(
+    const std::string &file_path) {
+#ifdef _WIN32
+  return nullptr;
+#else
+  int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  const auto size = static_cast<uint64_t>(file_stat.st_size);
+  void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid after the fd is closed.
+  close(fd);
+  if (addr == MAP_FAILED) {
+    RAY_LOG(WARNING) << "Failed to mmap spill file " << file_path
+                     << ", falling back to filesystem reads. errno: " << errno;
+    return nullptr;
+  }
+  return std::shared_ptr<ReadOnlyFileMapping>(new ReadOnlyFileMapping(addr, size));
+#endif
+}
+
+ReadOnlyFileMapping::~ReadOnlyFileMapping() {
+#ifndef _WIN32
+  munmap(addr_, size_);
+#endif
+}
+
 /* static */ std::optional<SpilledObjectReader>
 SpilledObjectReader::CreateSpilledObjectReader(const std::string &object_url) {
   std::string file_path;
@@ -56,6 +98,10 @@ SpilledObjectReader::CreateSpilledObjectReader(const std::string &object_url) {
     return std::optional<SpilledObjectReader>();
   }
 
+  // Map the file eagerly so chunk reads can serve borrowed views without
+  // re-opening it; on failure reads fall back to the filesystem.
+  auto mapping = ReadOnlyFileMapping::Create(file_path);
+
   return std::optional<SpilledObjectReader>(
       SpilledObjectReader(std::move(file_path),
                           object_size,
@@ -63,7 +109,8 @@ SpilledObjectReader::CreateSpilledObjectReader(const std::string &object_url) {
                           data_size,
                           metadata_offset,
                           metadata_size,
-                          std::move(owner_address)));
+                          std::move(owner_address),
+                          std::move(mapping)));
 }
 
 uint64_t SpilledObjectReader::GetDataSize() const { return data_size_; }
@@ -80,14 +127,16 @@ SpilledObjectReader::SpilledObjectReader(std::string file_path,
                                          uint64_t data_size,
                                          uint64_t metadata_offset,
                                          uint64_t metadata_size,
-                                         rpc::Address owner_address)
+                                         rpc::Address owner_address,
+                                         std::shared_ptr<ReadOnlyFileMapping> mapping)
     : file_path_(std::move(file_path)),
       object_size_(object_size),
       data_offset_(data_offset),
       data_size_(data_size),
       metadata_offset_(metadata_offset),
       metadata_size_(metadata_size),
-      owner_address_(std::move(owner_address)) {}
+      owner_address_(std::move(owner_address)),
+      mapping_(std::move(mapping)) {}
 
 /* static */ bool SpilledObjectReader::ParseObjectURL(const std::string &object_url,
                                                       std::string &file_path,
@@ -195,4 +244,22 @@ bool SpilledObjectReader::ReadFromMetadataSection(uint64_t offset,
   }
   return size_idx == size;
 }
+
+std::optional<std::string_view> SpilledObjectReader::GetDataSectionView(
+    uint64_t offset, uint64_t size) const {
+  if (mapping_ == nullptr || offset + size > data_size_ ||
+      data_offset_ + offset + size > mapping_->Size()) {
+    return std::nullopt;
+  }
+  return std::string_view(mapping_->Data() + data_offset_ + offset, size);
+}
+
+std::optional<std::string_view> SpilledObjectReader::GetMetadataSectionView(
+    uint64_t offset, uint64_t size) const {
+  if (mapping_ == nullptr || offset + size > metadata_size_ ||
+      metadata_offset_ + offset + size > mapping_->Size()) {
+    return std::nullopt;
+  }
+  return std::string_view(mapping_->Data() + metadata_offset_ + offset, size);
+}
 }  // namespace ray
@@ -16,12 +16,37 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <memory>
 #include <string>
 
 #include "absl/types/optional.h"
 #include "ray/object_manager/object_reader.h"
 
 namespace ray {
+
+/// A read-only memory mapping of a file. Create returns nullptr if the file
+/// cannot be mapped (e.g. it was deleted, or the platform doesn't support
+/// mmap), in which case callers fall back to reading through the filesystem.
+class ReadOnlyFileMapping {
+ public:
+  static std::shared_ptr<ReadOnlyFileMapping> Create(const std::string &file_path);
+
+  ~ReadOnlyFileMapping();
+
+  ReadOnlyFileMapping(const ReadOnlyFileMapping &) = delete;
+  ReadOnlyFileMapping &operator=(const ReadOnlyFileMapping &) = delete;
+
+  const char *Data() const { return static_cast<const char *>(addr_); }
+
+  uint64_t Size() const { return size_; }
+
+ private:
+  ReadOnlyFileMapping(void *addr, uint64_t size) : addr_(addr), size_(size) {}
+
+  void *const addr_;
+  const uint64_t size_;
+};
+
 /// Reader for a local object spilled in the object_url.
 /// This class is thread safe.
 class SpilledObjectReader : public IObjectReader {
@@ -46,6 +71,11 @@ class SpilledObjectReader : public IObjectReader {
                                uint64_t size,
                                std::string &output) const override;
 
+  std::optional<std::string_view> GetDataSectionView(uint64_t offset,
+                                                     uint64_t size) const override;
+  std::optional<std::string_view> GetMetadataSectionView(uint64_t offset,
+                                                         uint64_t size) const override;
+
  private:
   SpilledObjectReader(std::string file_path,
                       uint64_t total_size,
@@ -53,7 +83,8 @@ class SpilledObjectReader : public IObjectReader {
                       uint64_t data_size,
                       uint64_t metadata_offset,
                       uint64_t metadata_size,
-                      rpc::Address owner_address);
+                      rpc::Address owner_address,
+                      std::shared_ptr<ReadOnlyFileMapping> mapping);
 
   /// Parse the object url in the form of {path}?offset={offset}&size={size}.
   /// Return false if parsing failed.
@@ -118,6 +149,10 @@ class SpilledObjectReader : public IObjectReader {
   const uint64_t metadata_offset_;
   const uint64_t metadata_size_;
   const rpc::Address owner_address_;
+  /// Read-only mapping of the spill file, shared between copies of this
+  /// reader. nullptr if the file couldn't be mapped; section views are then
+  /// unavailable and reads go through the filesystem.
+  const std::shared_ptr<ReadOnlyFileMapping> mapping_;
 };
 
 }  // namespace ray
@@ -0,0 +1,229 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/object_manager/chunk_transport.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
+#include "ray/object_manager_rpc_client/object_manager_client_interface.h"
+
+namespace ray {
+
+namespace {
+
+/// Records pushed requests so the test can inspect the wire mapping.
+class RecordingObjectManagerClient : public rpc::ObjectManagerClientInterface {
+ public:
+  void Push(const rpc::PushRequest &request,
+            const rpc::ClientCallback<rpc::PushReply> &callback) override {
+    push_requests.push_back(request);
+    push_callbacks.push_back(callback);
+  }
+
+  void PushZeroCopy(const rpc::ZeroCopyPushRequest &request,
+                    const rpc::ClientCallback<rpc::PushReply> &callback) override {
+    zero_copy_push_requests.push_back(request);
+    push_callbacks.push_back(callback);
+  }
+
+  void Pull(const rpc::PullRequest &request,
+            const rpc::ClientCallback<rpc::PullReply> &callback) override {}
+
+  void FreeObjects(const rpc::FreeObjectsRequest &request,
+                   const rpc::ClientCallback<rpc::FreeObjectsReply> &callback) override {}
+
+  std::vector<rpc::PushRequest> push_requests;
+  std::vector<rpc::ZeroCopyPushRequest> zero_copy_push_requests;
+  std::vector<rpc::ClientCallback<rpc::PushReply>> push_callbacks;
+};
+
+}  // namespace
+
+TEST(GrpcChunkTransportTest, TestUnreachableNode) {
+  GrpcChunkTransport transport([](const NodeID &) { return nullptr; });
+  ASSERT_EQ(transport.MakeChunkSender(NodeID::FromRandom()), nullptr);
+}
+
+TEST(GrpcChunkTransportTest, TestSendChunk) {
+  auto client = std::make_shared<RecordingObjectManagerClient>();
+  NodeID dest_node_id = NodeID::FromRandom();
+  GrpcChunkTransport transport([&](const NodeID &node_id) {
+    EXPECT_EQ(node_id, dest_node_id);
+    return client;
+  });
+  auto send_chunk = transport.MakeChunkSender(dest_node_id);
+  ASSERT_NE(send_chunk, nullptr);
+
+  ChunkSendRequest request;
+  request.push_id = UniqueID::FromRandom();
+  request.object_id = ObjectID::FromRandom();
+  request.from_node_id = NodeID::FromRandom();
+  request.owner_address.set_ip_address("1.2.3.4");
+  request.data_size = 100;
+  request.metadata_size = 10;
+  request.chunk_index = 3;
+  request.chunk_size = 25;
+
+  Status send_status = Status::Invalid("not yet replied");
+  send_chunk(request, ChunkPayload::FromOwned("chunk data"), [&](const Status &status) {
+    send_status = status;
+  });
+
+  // The chunk was mapped onto a single Push message.
+  ASSERT_EQ(client->push_requests.size(), 1);
+  const auto &push_request = client->push_requests[0];
+  ASSERT_EQ(push_request.push_id(), request.push_id.Binary());
+  ASSERT_EQ(push_request.object_id(), request.object_id.Binary());
+  ASSERT_EQ(push_request.node_id(), request.from_node_id.Binary());
+  ASSERT_EQ(push_request.owner_address().ip_address(), "1.2.3.4");
+  ASSERT_EQ(push_request.data_size(), 100);
+  ASSERT_EQ(push_request.metadata_size(), 10);
+  ASSERT_EQ(push_request.chunk_index(), 3);
+  ASSERT_EQ(push_request.chunk_size(), 25);
+  ASSERT_EQ(push_request.data(), "chunk data");
+
+  // The completion callback fires with the reply's status.
+  ASSERT_TRUE(send_status.IsInvalid());
+  client->push_callbacks[0](Status::OK(), rpc::PushReply());
+  ASSERT_TRUE(send_status.ok());
+}
+
+TEST(GrpcChunkTransportTest, TestSendChunkCarriesCrc32c) {
+  auto client = std::make_shared<RecordingObjectManagerClient>();
+  GrpcChunkTransport transport([&](const NodeID &) { return client; });
+  auto send_chunk = transport.MakeChunkSender(NodeID::FromRandom());
+
+  // Without a checksum, the wire field is absent.
+  ChunkSendRequest request;
+  request.object_id = ObjectID::FromRandom();
+  send_chunk(request, ChunkPayload::FromOwned("chunk data"), [](const Status &) {});
+  ASSERT_EQ(client->push_requests.size(), 1);
+  ASSERT_FALSE(client->push_requests[0].has_chunk_crc32c());
+
+  // With a checksum, it travels in the Push message.
+  request.chunk_crc32c = 0xdeadbeef;
+  send_chunk(request, ChunkPayload::FromOwned("chunk data"), [](const Status &) {});
+  ASSERT_EQ(client->push_requests.size(), 2);
+  ASSERT_TRUE(client->push_requests[1].has_chunk_crc32c());
+  ASSERT_EQ(client->push_requests[1].chunk_crc32c(), 0xdeadbeef);
+}
+
+TEST(GrpcChunkTransportTest, TestSendChunkCarriesUncompressedSize) {
+  auto client = std::make_shared<RecordingObjectManagerClient>();
+  GrpcChunkTransport transport([&](const NodeID &) { return client; });
+  auto send_chunk = transport.MakeChunkSender(NodeID::FromRandom());
+
+  // Uncompressed chunks advertise a zero original length.
+  ChunkSendRequest request;
+  request.object_id = ObjectID::FromRandom();
+  send_chunk(request, ChunkPayload::FromOwned("chunk data"), [](const Status &) {});
+  ASSERT_EQ(client->push_requests.size(), 1);
+  ASSERT_EQ(client->push_requests[0].uncompressed_size(), 0);
+
+  // Compressed chunks carry the original chunk length alongside the payload.
+  request.uncompressed_size = 4096;
+  send_chunk(request, ChunkPayload::FromOwned("deflated"), [](const Status &) {});
+  ASSERT_EQ(client->push_requests.size(), 2);
+  ASSERT_EQ(client->push_requests[1].uncompressed_size(), 4096);
+}
+
+TEST(GrpcChunkTransportTest, TestSendBorrowedChunkCopiesWhenZeroCopyDisabled) {
+  auto client = std::make_shared<RecordingObjectManagerClient>();
+  GrpcChunkTransport transport([&](const NodeID &) { return client; });
+  auto send_chunk = transport.MakeChunkSender(NodeID::FromRandom());
+
+  auto buffer = std::make_shared<std::string>("borrowed bytes");
+  ChunkSendRequest request;
+  request.object_id = ObjectID::FromRandom();
+  send_chunk(request,
+             ChunkPayload::FromBorrowed(*buffer, buffer),
+             [](const Status &) {});
+
+  // With zero copy disabled (the default), the borrowed bytes are copied
+  // into a regular Push message.
+  ASSERT_EQ(client->push_requests.size(), 1);
+  ASSERT_TRUE(client->zero_copy_push_requests.empty());
+  ASSERT_EQ(client->push_requests[0].data(), "borrowed bytes");
+}
+
+TEST(GrpcChunkTransportTest, TestSendBorrowedChunkZeroCopy) {
+  RayConfig::instance().object_manager_grpc_zero_copy_push() = true;
+  auto client = std::make_shared<RecordingObjectManagerClient>();
+  GrpcChunkTransport transport([&](const NodeID &) { return client; });
+  auto send_chunk = transport.MakeChunkSender(NodeID::FromRandom());
+
+  auto buffer = std::make_shared<std::string>("borrowed bytes");
+  ChunkSendRequest request;
+  request.push_id = UniqueID::FromRandom();
+  request.object_id = ObjectID::FromRandom();
+  request.chunk_index = 3;
+  send_chunk(request,
+             ChunkPayload::FromBorrowed(*buffer, buffer),
+             [](const Status &) {});
+
+  // The borrowed bytes travel as a slice referencing the original buffer;
+  // no Push message carries a copy of them.
+  ASSERT_TRUE(client->push_requests.empty());
+  ASSERT_EQ(client->zero_copy_push_requests.size(), 1);
+  const auto &zero_copy_request = client->zero_copy_push_requests[0];
+  ASSERT_EQ(zero_copy_request.header.object_id(), request.object_id.Binary());
+  ASSERT_EQ(zero_copy_request.header.chunk_index(), 3);
+  ASSERT_TRUE(zero_copy_request.header.data().empty());
+  ASSERT_EQ(reinterpret_cast<const char *>(zero_copy_request.payload.begin()),
+            buffer->data());
+  ASSERT_EQ(zero_copy_request.payload.size(), buffer->size());
+  RayConfig::instance().object_manager_grpc_zero_copy_push() = false;
+}
+
+TEST(ZeroCopyPushRequestTest, TestSerializesToRegularPushRequest) {
+  rpc::ZeroCopyPushRequest request;
+  request.header.set_object_id("object id");
+  request.header.set_chunk_index(7);
+  request.header.set_data_size(1000);
+  const std::string chunk_bytes = "the chunk bytes";
+  request.payload = grpc::Slice(chunk_bytes);
+
+  grpc::ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(grpc::SerializationTraits<rpc::ZeroCopyPushRequest>::Serialize(
+                  request, &buffer, &own_buffer)
+                  .ok());
+
+  // The serialized bytes parse back into an equivalent regular PushRequest,
+  // which is what the server deserializes.
+  std::vector<grpc::Slice> slices;
+  ASSERT_TRUE(buffer.Dump(&slices).ok());
+  std::string wire_bytes;
+  for (const auto &slice : slices) {
+    wire_bytes.append(reinterpret_cast<const char *>(slice.begin()), slice.size());
+  }
+  rpc::PushRequest parsed;
+  ASSERT_TRUE(parsed.ParseFromString(wire_bytes));
+  ASSERT_EQ(parsed.object_id(), "object id");
+  ASSERT_EQ(parsed.chunk_index(), 7);
+  ASSERT_EQ(parsed.data_size(), 1000);
+  ASSERT_EQ(parsed.data(), chunk_bytes);
+}
+
+}  // namespace ray
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
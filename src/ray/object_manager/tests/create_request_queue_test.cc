@@ -16,9 +16,11 @@
 
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 
 namespace plasma {
@@ -26,6 +28,7 @@ namespace plasma {
 class MockClient : public ClientInterface {
  public:
   MOCK_METHOD1(SendFd, Status(MEMFD_TYPE));
+  MOCK_METHOD1(SendFds, Status(const std::vector<MEMFD_TYPE> &));
   MOCK_METHOD0(GetObjectIDs, const std::unordered_set<ray::ObjectID> &());
   MOCK_METHOD2(MarkObjectAsUsed,
                void(const ObjectID &object_id,
@@ -69,6 +72,9 @@ class CreateRequestQueueTest : public ::testing::Test {
   void AssertNoLeaks() {
     ASSERT_TRUE(queue_.queue_.empty());
     ASSERT_TRUE(queue_.fulfilled_requests_.empty());
+    ASSERT_TRUE(queue_.num_requests_per_client_.empty());
+    ASSERT_TRUE(queue_.fair_ring_.empty());
+    ASSERT_TRUE(queue_.deficit_bytes_.empty());
   }
 
   void TearDown() { current_time_ns_ = 0; }
@@ -267,6 +273,80 @@ TEST_F(CreateRequestQueueTest, TestTransientOom) {
   AssertNoLeaks();
 }
 
+TEST_F(CreateRequestQueueTest, TestFairAdmissionServesOtherClients) {
+  RayConfig::instance().initialize(
+      R"({"plasma_fair_creation_admission_enabled": true})");
+  CreateRequestQueue queue(
+      monitor_,
+      /*oom_grace_period_s=*/oom_grace_period_s_,
+      /*spill_object_callback=*/[&]() { return true; },
+      /*on_global_gc=*/[&]() { num_global_gc_++; },
+      /*get_time=*/[&]() { return current_time_ns_; });
+
+  auto oom_request = [&](bool fallback, PlasmaObject *result) {
+    return PlasmaError::OutOfMemory;
+  };
+  auto ok_request = [&](bool fallback, PlasmaObject *result) {
+    result->data_size = 1234;
+    return PlasmaError::OK;
+  };
+
+  // One client's large creation is stuck waiting for spilling, while another
+  // client's creation already fits in memory.
+  auto client1 = std::make_shared<MockClient>();
+  auto client2 = std::make_shared<MockClient>();
+  auto req_id1 = queue.AddRequest(ObjectID::Nil(), client1, oom_request, 1 << 20);
+  auto req_id2 = queue.AddRequest(ObjectID::Nil(), client2, ok_request, 1234);
+
+  // The stuck request triggers a transient OOM, but the other client's
+  // request is served instead of waiting behind it.
+  ASSERT_TRUE(queue.ProcessRequests().IsTransientObjectStoreFull());
+  ASSERT_REQUEST_UNFINISHED(queue, req_id1);
+  ASSERT_REQUEST_FINISHED(queue, req_id2, PlasmaError::OK);
+
+  // Requests added while the head is still stuck are served too.
+  auto req_id3 = queue.AddRequest(ObjectID::Nil(), client2, ok_request, 1234);
+  ASSERT_TRUE(queue.ProcessRequests().IsTransientObjectStoreFull());
+  ASSERT_REQUEST_UNFINISHED(queue, req_id1);
+  ASSERT_REQUEST_FINISHED(queue, req_id3, PlasmaError::OK);
+
+  queue.RemoveDisconnectedClientRequests(client1);
+  ASSERT_EQ(queue.NumPendingRequests(), 0);
+  RayConfig::instance().initialize(
+      R"({"plasma_fair_creation_admission_enabled": false})");
+}
+
+TEST_F(CreateRequestQueueTest, TestFairAdmissionDeficitRoundRobin) {
+  RayConfig::instance().initialize(
+      R"({"plasma_fair_creation_admission_enabled": true,)"
+      R"("plasma_fair_creation_quantum_bytes": 100})");
+
+  std::vector<uint64_t> served;
+  auto make_request = [&](uint64_t id) {
+    return [&served, id](bool fallback, PlasmaObject *result) {
+      served.push_back(id);
+      result->data_size = 1234;
+      return PlasmaError::OK;
+    };
+  };
+
+  // The first client's request exceeds one quantum, so the second client's
+  // small request is admitted first even though it was queued later.
+  auto client1 = std::make_shared<MockClient>();
+  auto client2 = std::make_shared<MockClient>();
+  auto req_id1 = queue_.AddRequest(ObjectID::Nil(), client1, make_request(1), 1000);
+  auto req_id2 = queue_.AddRequest(ObjectID::Nil(), client2, make_request(2), 50);
+
+  ASSERT_TRUE(queue_.ProcessRequests().ok());
+  ASSERT_EQ(served, (std::vector<uint64_t>{2, 1}));
+  ASSERT_REQUEST_FINISHED(queue_, req_id1, PlasmaError::OK);
+  ASSERT_REQUEST_FINISHED(queue_, req_id2, PlasmaError::OK);
+
+  AssertNoLeaks();
+  RayConfig::instance().initialize(
+      R"({"plasma_fair_creation_admission_enabled": false})");
+}
+
 TEST_F(CreateRequestQueueTest, TestOomTimerWithSpilling) {
   int spill_object_callback_ret = true;
   CreateRequestQueue queue(
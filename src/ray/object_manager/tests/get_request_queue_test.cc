@@ -14,6 +14,7 @@
 
 #include "ray/object_manager/plasma/get_request_queue.h"
 
+#include <functional>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -27,6 +28,7 @@ using ray::ObjectInfo;
 using ray::Status;
 using testing::_;
 using testing::Eq;
+using testing::Invoke;
 using testing::Return;
 using testing::Test;
 
@@ -35,6 +37,7 @@ namespace plasma {
 class MockClient : public ClientInterface {
  public:
   MOCK_METHOD1(SendFd, Status(MEMFD_TYPE));
+  MOCK_METHOD1(SendFds, Status(const std::vector<MEMFD_TYPE> &));
   MOCK_METHOD0(GetObjectIDs, const std::unordered_set<ObjectID> &());
   MOCK_METHOD2(MarkObjectAsUsed,
                void(const ObjectID &object_id,
@@ -50,6 +53,9 @@ class MockObjectLifecycleManager : public IObjectLifecycleManager {
                    plasma::flatbuf::ObjectSource source,
                    bool fallback_allocator));
   MOCK_CONST_METHOD1(GetObject, const LocalObject *(const ObjectID &object_id));
+  MOCK_CONST_METHOD1(GetObjects,
+                     std::vector<const LocalObject *>(
+                         const std::vector<ObjectID> &object_ids));
   MOCK_METHOD1(SealObject, const LocalObject *(const ObjectID &object_id));
   MOCK_METHOD1(AbortObject, flatbuf::PlasmaError(const ObjectID &object_id));
   MOCK_METHOD1(DeleteObject, flatbuf::PlasmaError(const ObjectID &object_id));
@@ -109,6 +115,19 @@ struct GetRequestQueueTest : public Test {
     EXPECT_FALSE(IsGetRequestExist(queue, object_id2));
   }
 
+  /// Resolves the batched lookup done by AddRequest: object_id1 maps to
+  /// object1 and every other id to object2.
+  std::function<std::vector<const LocalObject *>(const std::vector<ObjectID> &)>
+  BatchResolver() {
+    return [this](const std::vector<ObjectID> &ids) {
+      std::vector<const LocalObject *> entries;
+      for (const auto &id : ids) {
+        entries.push_back(id == object_id1 ? &object1 : &object2);
+      }
+      return entries;
+    };
+  }
+
  protected:
   instrumented_io_context io_context_;
   boost::asio::executor_work_guard<boost::asio::io_context::executor_type> io_work_;
@@ -135,7 +154,9 @@ TEST_F(GetRequestQueueTest, TestObjectSealed) {
   std::vector<ObjectID> object_ids{object_id1};
   /// Mock the object already sealed.
   MarkObject(object1, ObjectState::PLASMA_SEALED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(_)).Times(1).WillOnce(Return(&object1));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   get_request_queue.AddRequest(client, object_ids, 1000);
   EXPECT_TRUE(satisfied);
 
@@ -157,7 +178,9 @@ TEST_F(GetRequestQueueTest, TestObjectTimeout) {
   /// Test object not satisfied, time out.
   std::vector<ObjectID> object_ids{object_id1};
   MarkObject(object1, ObjectState::PLASMA_CREATED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(_)).Times(1).WillOnce(Return(&object1));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   get_request_queue.AddRequest(client, object_ids, 1000);
   /// This trigger timeout
   io_context_.run_one();
@@ -181,9 +204,12 @@ TEST_F(GetRequestQueueTest, TestObjectNotSealed) {
   /// Test object not satisfied, then sealed.
   std::vector<ObjectID> object_ids{object_id1};
   MarkObject(object1, ObjectState::PLASMA_CREATED);
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   EXPECT_CALL(object_lifecycle_manager, GetObject(_))
-      .Times(2)
-      .WillRepeatedly(Return(&object1));
+      .Times(1)
+      .WillOnce(Return(&object1));
   get_request_queue.AddRequest(client, object_ids, /*timeout_ms*/ -1);
   MarkObject(object1, ObjectState::PLASMA_SEALED);
   get_request_queue.MarkObjectSealed(object_id1);
@@ -215,8 +241,8 @@ TEST_F(GetRequestQueueTest, TestMultipleObjects) {
   std::vector<ObjectID> object_ids{object_id1, object_id2};
   MarkObject(object1, ObjectState::PLASMA_SEALED);
   MarkObject(object2, ObjectState::PLASMA_CREATED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(Eq(object_id1)))
-      .WillRepeatedly(Return(&object1));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .WillOnce(Invoke(BatchResolver()));
   EXPECT_CALL(object_lifecycle_manager, GetObject(Eq(object_id2)))
       .WillRepeatedly(Return(&object2));
   get_request_queue.AddRequest(client, object_ids, 1000);
@@ -262,8 +288,8 @@ TEST_F(GetRequestQueueTest, TestFallbackAllocatedFdArePassed) {
   MEMFD_TYPE fd{INT2FD(101), 42};
   MarkObjectFallbackAllocated(object2, true, fd);
 
-  EXPECT_CALL(object_lifecycle_manager, GetObject(Eq(object_id1)))
-      .WillRepeatedly(Return(&object1));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .WillOnce(Invoke(BatchResolver()));
   EXPECT_CALL(object_lifecycle_manager, GetObject(Eq(object_id2)))
       .WillRepeatedly(Return(&object2));
   get_request_queue.AddRequest(client, object_ids, 1000);
@@ -295,10 +321,9 @@ TEST_F(GetRequestQueueTest, TestDuplicateObjects) {
   /// Set state to PLASMA_CREATED, so we can check them using IsGetRequestExist.
   MarkObject(object1, ObjectState::PLASMA_CREATED);
   MarkObject(object2, ObjectState::PLASMA_CREATED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(_))
-      .Times(2)
-      .WillOnce(Return(&object1))
-      .WillOnce(Return(&object2));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   get_request_queue.AddRequest(client, object_ids, 1000);
   EXPECT_TRUE(IsGetRequestExist(get_request_queue, object_id1));
   EXPECT_TRUE(IsGetRequestExist(get_request_queue, object_id2));
@@ -321,10 +346,9 @@ TEST_F(GetRequestQueueTest, TestRemoveAll) {
   std::vector<ObjectID> object_ids{object_id1, object_id2};
   MarkObject(object1, ObjectState::PLASMA_CREATED);
   MarkObject(object2, ObjectState::PLASMA_CREATED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(_))
-      .Times(2)
-      .WillOnce(Return(&object1))
-      .WillOnce(Return(&object2));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   get_request_queue.AddRequest(client, object_ids, 1000);
 
   EXPECT_TRUE(IsGetRequestExist(get_request_queue, object_id1));
@@ -352,10 +376,9 @@ TEST_F(GetRequestQueueTest, TestRemoveTwice) {
   std::vector<ObjectID> object_ids{object_id1, object_id2};
   MarkObject(object1, ObjectState::PLASMA_CREATED);
   MarkObject(object2, ObjectState::PLASMA_CREATED);
-  EXPECT_CALL(object_lifecycle_manager, GetObject(_))
-      .Times(2)
-      .WillOnce(Return(&object1))
-      .WillOnce(Return(&object2));
+  EXPECT_CALL(object_lifecycle_manager, GetObjects(_))
+      .Times(1)
+      .WillOnce(Invoke(BatchResolver()));
   get_request_queue.AddRequest(client, object_ids, 1000);
 
   EXPECT_TRUE(IsGetRequestExist(get_request_queue, object_id1));
@@ -140,6 +140,47 @@ TEST_F(ObjectBufferPoolTest, TestSizeMismatch) {
   object_buffer_pool_.WriteChunk(obj_id, data_size_2, 0, 0, mock_data_);
 }
 
+TEST_F(ObjectBufferPoolTest, TestPerTransferChunkSize) {
+  auto obj_id = ObjectID::FromRandom();
+  rpc::Address owner_address;
+
+  // A transfer split with a chunk size different from the pool default.
+  uint64_t transfer_chunk_size = 2 * chunk_size_;
+  uint64_t data_size = 3 * chunk_size_;
+  ASSERT_EQ(object_buffer_pool_.GetNumChunks(data_size, transfer_chunk_size), 2);
+  ASSERT_EQ(object_buffer_pool_.GetBufferLength(0, data_size, transfer_chunk_size),
+            transfer_chunk_size);
+  ASSERT_EQ(object_buffer_pool_.GetBufferLength(1, data_size, transfer_chunk_size),
+            chunk_size_);
+
+  ASSERT_TRUE(object_buffer_pool_
+                  .CreateChunk(obj_id, owner_address, data_size, 0, 0, transfer_chunk_size)
+                  .ok());
+  // A transfer with a different chunk size recreates the buffer, like a
+  // transfer whose object size changed. The second Release/Abort pair comes
+  // from tearing the recreated buffer down again below.
+  EXPECT_CALL(*mock_plasma_client_, Release(obj_id)).Times(2);
+  EXPECT_CALL(*mock_plasma_client_, Abort(obj_id)).Times(2);
+  ASSERT_TRUE(
+      object_buffer_pool_.CreateChunk(obj_id, owner_address, data_size, 0, 0).ok());
+  object_buffer_pool_.AbortCreate(obj_id);
+
+  // Receive the whole object with the transfer's chunk size.
+  std::string large_chunk(transfer_chunk_size, 'x');
+  ASSERT_TRUE(object_buffer_pool_
+                  .CreateChunk(obj_id, owner_address, data_size, 0, 0, transfer_chunk_size)
+                  .ok());
+  ASSERT_TRUE(object_buffer_pool_
+                  .CreateChunk(obj_id, owner_address, data_size, 0, 1, transfer_chunk_size)
+                  .ok());
+  EXPECT_CALL(*mock_plasma_client_, Seal(obj_id));
+  EXPECT_CALL(*mock_plasma_client_, Release(obj_id));
+  object_buffer_pool_.WriteChunk(obj_id, data_size, 0, 0, large_chunk);
+  object_buffer_pool_.WriteChunk(obj_id, data_size, 0, 1, mock_data_);
+
+  AssertNoLeaks();
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
@@ -0,0 +1,451 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Macro-benchmark for the object path. It drives a real `PlasmaStoreRunner`
+// and real `ObjectManager` instances (with the production gRPC transport)
+// through the hot paths a Ray object takes:
+//
+//   * put/get against the local plasma store,
+//   * node-to-node transfer via `ObjectManager::Push`,
+//   * the per-object disk round trip behind spill and restore.
+//
+// Each scenario sweeps object sizes and reports per-object latency
+// percentiles and GB/s. The assertions are deliberately loose floors meant to
+// catch order-of-magnitude regressions in CI, not machine-specific tuning.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mock/ray/gcs_client/gcs_client.h"
+#include "mock/ray/object_manager/object_directory.h"
+#include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/id.h"
+#include "ray/common/ray_config.h"
+#include "ray/common/status.h"
+#include "ray/object_manager/common.h"
+#include "ray/object_manager/object_manager.h"
+#include "ray/object_manager/plasma/client.h"
+#include "ray/object_manager/plasma/plasma_generated.h"
+#include "ray/object_manager/plasma/store_runner.h"
+#include "ray/object_manager_rpc_client/object_manager_client.h"
+
+namespace ray {
+
+namespace {
+
+constexpr int64_t kObjectStoreMemory = 512LL * 1024 * 1024;
+const std::vector<int64_t> kObjectSizes = {64 * 1024,
+                                           1024 * 1024,
+                                           8 * 1024 * 1024,
+                                           64 * 1024 * 1024};
+constexpr int kIterationsPerSize = 10;
+
+struct LatencyReport {
+  double mean_us = 0;
+  double p50_us = 0;
+  double p99_us = 0;
+  double gigabytes_per_second = 0;
+};
+
+LatencyReport SummarizeLatencies(std::vector<double> latencies_us, int64_t object_size) {
+  LatencyReport report;
+  if (latencies_us.empty()) {
+    return report;
+  }
+  std::sort(latencies_us.begin(), latencies_us.end());
+  double total_us = 0;
+  for (double latency : latencies_us) {
+    total_us += latency;
+  }
+  report.mean_us = total_us / static_cast<double>(latencies_us.size());
+  report.p50_us = latencies_us[latencies_us.size() / 2];
+  report.p99_us = latencies_us[static_cast<size_t>(0.99 * (latencies_us.size() - 1))];
+  report.gigabytes_per_second =
+      static_cast<double>(object_size) / (report.mean_us * 1e-6) / 1e9;
+  return report;
+}
+
+void PrintReport(const std::string &scenario,
+                 int64_t object_size,
+                 const LatencyReport &report) {
+  std::cout << absl::StrFormat(
+                   "%-10s %8d KiB: mean %10.1f us, p50 %10.1f us, p99 %10.1f us, "
+                   "%6.2f GB/s",
+                   scenario,
+                   object_size / 1024,
+                   report.mean_us,
+                   report.p50_us,
+                   report.p99_us,
+                   report.gigabytes_per_second)
+            << std::endl;
+}
+
+/// One in-process "node": a real plasma store, a real object manager serving
+/// the production gRPC transport, and a benchmark-side plasma client. The
+/// global `ObjectStoreRunner` singleton cannot host two stores in one
+/// process, so the store lifetime is managed here directly.
+class BenchmarkNode {
+ public:
+  explicit BenchmarkNode(const std::string &name)
+      : node_id_(NodeID::FromRandom()),
+        io_work_(boost::asio::make_work_guard(main_context_.get_executor())),
+        rpc_work_(boost::asio::make_work_guard(rpc_context_.get_executor())) {
+    config_.object_manager_address = "127.0.0.1";
+    config_.object_manager_port = 0;
+    config_.timer_freq_ms = RayConfig::instance().object_manager_timer_freq_ms();
+    config_.pull_timeout_ms = RayConfig::instance().object_manager_pull_timeout_ms();
+    config_.object_chunk_size = RayConfig::instance().object_manager_default_chunk_size();
+    config_.max_bytes_in_flight =
+        RayConfig::instance().object_manager_max_bytes_in_flight();
+    config_.store_socket_name =
+        absl::StrFormat("/tmp/object_path_benchmark_%s_%d", name, getpid());
+    config_.push_timeout_ms = 10000;
+    config_.rpc_service_threads_number = 1;
+    config_.object_store_memory = kObjectStoreMemory;
+    config_.plasma_directory = "/tmp";
+    config_.fallback_directory = "/tmp";
+    config_.huge_pages = false;
+
+    store_runner_ = std::make_unique<plasma::PlasmaStoreRunner>(
+        config_.store_socket_name,
+        config_.object_store_memory,
+        config_.huge_pages,
+        config_.plasma_directory,
+        config_.fallback_directory);
+    store_thread_ = std::thread([this]() {
+      store_runner_->Start(
+          /*spill_objects_callback=*/[]() { return false; },
+          /*object_store_full_callback=*/[]() {},
+          /*add_object_callback=*/
+          [this](const ObjectInfo &object_info) {
+            // Called from the store thread. Post before signalling the
+            // benchmark thread so that a Push posted on wakeup is ordered
+            // after HandleObjectAdded on the main context.
+            main_context_.post(
+                [this, object_info]() {
+                  object_manager_->HandleObjectAdded(object_info);
+                },
+                "ObjectPathBenchmark.ObjectAdded");
+            absl::MutexLock lock(&added_mutex_);
+            added_objects_.insert(object_info.object_id);
+          },
+          /*delete_object_callback=*/
+          [this](const ObjectID &object_id) {
+            main_context_.post(
+                [this, object_id]() { object_manager_->HandleObjectDeleted(object_id); },
+                "ObjectPathBenchmark.ObjectDeleted");
+            absl::MutexLock lock(&added_mutex_);
+            added_objects_.erase(object_id);
+          });
+    });
+
+    gcs_client_ = std::make_unique<::testing::NiceMock<gcs::MockGcsClient>>();
+    object_directory_ = std::make_unique<::testing::NiceMock<MockObjectDirectory>>();
+
+    object_manager_ = std::make_unique<ObjectManager>(
+        main_context_,
+        node_id_,
+        config_,
+        *gcs_client_,
+        object_directory_.get(),
+        /*restore_spilled_object=*/
+        [](const ObjectID &object_id,
+           int64_t object_size,
+           const std::string &object_url,
+           std::function<void(const Status &)> callback) {},
+        /*get_spilled_object_url=*/
+        [](const ObjectID &object_id) -> std::string { return ""; },
+        /*pin_object=*/
+        [](const ObjectID &object_id) -> std::unique_ptr<RayObject> { return nullptr; },
+        /*fail_pull_request=*/
+        [](const ObjectID &object_id, rpc::ErrorType error_type) {},
+        std::make_shared<plasma::PlasmaClient>(),
+        /*object_store_internal=*/nullptr,
+        [](const std::string &address,
+           const int port,
+           rpc::ClientCallManager &client_call_manager) {
+          return std::make_shared<rpc::ObjectManagerClient>(
+              address, port, client_call_manager);
+        },
+        rpc_context_);
+
+    main_thread_ = std::thread([this]() { main_context_.run(); });
+    rpc_thread_ = std::thread([this]() { rpc_context_.run(); });
+
+    RAY_CHECK_OK(client_.Connect(config_.store_socket_name, "", /*num_retries=*/300));
+  }
+
+  ~BenchmarkNode() {
+    client_.Disconnect();
+    // Stop the object manager on its own context, mirroring the raylet
+    // shutdown path; this also stops the rpc context.
+    std::promise<void> stopped;
+    main_context_.post(
+        [this, &stopped]() {
+          object_manager_->Stop();
+          stopped.set_value();
+        },
+        "ObjectPathBenchmark.Stop");
+    stopped.get_future().wait();
+    store_runner_->Stop();
+    store_thread_.join();
+    rpc_thread_.join();
+    io_work_.reset();
+    main_context_.stop();
+    main_thread_.join();
+    std::remove(config_.store_socket_name.c_str());
+  }
+
+  const NodeID &node_id() const { return node_id_; }
+
+  ObjectManager &object_manager() { return *object_manager_; }
+
+  gcs::MockGcsClient &gcs_client() { return *gcs_client_; }
+
+  plasma::PlasmaClient &client() { return client_; }
+
+  /// Create, fill and seal an object in the local store. Returns the wall
+  /// time in microseconds.
+  double Put(const ObjectID &object_id, int64_t data_size) {
+    rpc::Address owner_address;
+    owner_address.set_node_id(node_id_.Binary());
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<Buffer> data;
+    RAY_CHECK_OK(client_.CreateAndSpillIfNeeded(
+        object_id,
+        owner_address,
+        /*is_mutable=*/false,
+        data_size,
+        /*metadata=*/nullptr,
+        /*metadata_size=*/0,
+        &data,
+        plasma::flatbuf::ObjectSource::CreatedByWorker));
+    std::memset(data->Data(), 0xA5, data_size);
+    RAY_CHECK_OK(client_.Seal(object_id));
+    auto end = std::chrono::steady_clock::now();
+    RAY_CHECK_OK(client_.Release(object_id));
+    return std::chrono::duration<double, std::micro>(end - start).count();
+  }
+
+  /// Fetch a sealed object from the local store. Returns the wall time in
+  /// microseconds.
+  double Get(const ObjectID &object_id) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<plasma::ObjectBuffer> buffers;
+    RAY_CHECK_OK(client_.Get({object_id}, /*timeout_ms=*/-1, &buffers));
+    RAY_CHECK(buffers.size() == 1 && buffers[0].data != nullptr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+  }
+
+  void Delete(const ObjectID &object_id) { RAY_CHECK_OK(client_.Delete({object_id})); }
+
+  /// Post a push of a local object towards `node_id` on the object manager's
+  /// own context.
+  void PostPush(const ObjectID &object_id, const NodeID &node_id) {
+    main_context_.post(
+        [this, object_id, node_id]() { object_manager_->Push(object_id, node_id); },
+        "ObjectPathBenchmark.Push");
+  }
+
+  /// Block until the local store has sealed `object_id`.
+  bool WaitForObjectAdded(const ObjectID &object_id, absl::Duration timeout) {
+    absl::MutexLock lock(&added_mutex_);
+    auto has_object = [this, &object_id]() {
+      added_mutex_.AssertHeld();
+      return added_objects_.contains(object_id);
+    };
+    return added_mutex_.AwaitWithTimeout(absl::Condition(&has_object), timeout);
+  }
+
+ private:
+  NodeID node_id_;
+  ObjectManagerConfig config_;
+
+  instrumented_io_context main_context_{/*enable_lag_probe=*/false,
+                                        /*running_on_single_thread=*/true};
+  instrumented_io_context rpc_context_{/*enable_lag_probe=*/false,
+                                       /*running_on_single_thread=*/true};
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> io_work_;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> rpc_work_;
+
+  std::unique_ptr<plasma::PlasmaStoreRunner> store_runner_;
+  std::unique_ptr<::testing::NiceMock<gcs::MockGcsClient>> gcs_client_;
+  std::unique_ptr<::testing::NiceMock<MockObjectDirectory>> object_directory_;
+  std::unique_ptr<ObjectManager> object_manager_;
+  plasma::PlasmaClient client_;
+
+  std::thread store_thread_;
+  std::thread main_thread_;
+  std::thread rpc_thread_;
+
+  absl::Mutex added_mutex_;
+  absl::flat_hash_set<ObjectID> added_objects_ ABSL_GUARDED_BY(added_mutex_);
+};
+
+}  // namespace
+
+// Put and get latency against the local plasma store.
+TEST(ObjectPathBenchmark, PutGetSweep) {
+  BenchmarkNode node("putget");
+
+  for (int64_t object_size : kObjectSizes) {
+    std::vector<double> put_latencies_us;
+    std::vector<double> get_latencies_us;
+    for (int i = 0; i < kIterationsPerSize; i++) {
+      auto object_id = ObjectID::FromRandom();
+      put_latencies_us.push_back(node.Put(object_id, object_size));
+      get_latencies_us.push_back(node.Get(object_id));
+      node.Delete(object_id);
+    }
+    auto put_report = SummarizeLatencies(std::move(put_latencies_us), object_size);
+    auto get_report = SummarizeLatencies(std::move(get_latencies_us), object_size);
+    PrintReport("put", object_size, put_report);
+    PrintReport("get", object_size, get_report);
+    if (object_size >= 8 * 1024 * 1024) {
+      // Loose CI floor: creating or mapping large objects below this rate
+      // indicates a serious regression in the allocator or client protocol.
+      EXPECT_GT(put_report.gigabytes_per_second, 0.05);
+      EXPECT_GT(get_report.gigabytes_per_second, 0.05);
+    }
+  }
+}
+
+// End-to-end transfer between two in-process nodes: sender-side chunk reads,
+// the gRPC Push stream and receiver-side chunk writes up to the receiving
+// store sealing the object. The receive half is the same code path a pull
+// exercises once the directory names a location.
+TEST(ObjectPathBenchmark, TransferSweep) {
+  BenchmarkNode sender("sender");
+  BenchmarkNode receiver("receiver");
+
+  rpc::GcsNodeAddressAndLiveness receiver_info;
+  receiver_info.set_node_id(receiver.node_id().Binary());
+  receiver_info.set_node_manager_address("127.0.0.1");
+  receiver_info.set_object_manager_port(receiver.object_manager().GetServerPort());
+  ON_CALL(*sender.gcs_client().mock_node_accessor,
+          GetNodeAddressAndLiveness(receiver.node_id(), ::testing::_))
+      .WillByDefault(::testing::Return(receiver_info));
+
+  for (int64_t object_size : kObjectSizes) {
+    std::vector<double> transfer_latencies_us;
+    for (int i = 0; i < kIterationsPerSize; i++) {
+      auto object_id = ObjectID::FromRandom();
+      sender.Put(object_id, object_size);
+      ASSERT_TRUE(sender.WaitForObjectAdded(object_id, absl::Seconds(30)));
+
+      auto start = std::chrono::steady_clock::now();
+      sender.PostPush(object_id, receiver.node_id());
+      ASSERT_TRUE(receiver.WaitForObjectAdded(object_id, absl::Seconds(60)));
+      auto end = std::chrono::steady_clock::now();
+      transfer_latencies_us.push_back(
+          std::chrono::duration<double, std::micro>(end - start).count());
+
+      sender.Delete(object_id);
+      receiver.Delete(object_id);
+    }
+    auto report = SummarizeLatencies(std::move(transfer_latencies_us), object_size);
+    PrintReport("transfer", object_size, report);
+    if (object_size >= 8 * 1024 * 1024) {
+      EXPECT_GT(report.gigabytes_per_second, 0.01);
+    }
+  }
+}
+
+// The per-object disk round trip behind spill and restore: stream a sealed
+// object out to a file, then recreate and reseal it in the store from that
+// file, as the local object manager's IO workers do per fused object.
+TEST(ObjectPathBenchmark, SpillRestoreSweep) {
+  BenchmarkNode node("spill");
+  const std::string spill_path =
+      absl::StrFormat("/tmp/object_path_benchmark_spill_%d", getpid());
+
+  for (int64_t object_size : kObjectSizes) {
+    std::vector<double> spill_latencies_us;
+    std::vector<double> restore_latencies_us;
+    for (int i = 0; i < kIterationsPerSize; i++) {
+      auto object_id = ObjectID::FromRandom();
+      node.Put(object_id, object_size);
+
+      // Spill: stream the sealed object out to disk.
+      auto spill_start = std::chrono::steady_clock::now();
+      {
+        std::vector<plasma::ObjectBuffer> buffers;
+        RAY_CHECK_OK(node.client().Get({object_id}, /*timeout_ms=*/-1, &buffers));
+        std::ofstream out(spill_path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(buffers[0].data->Data()),
+                  buffers[0].data->Size());
+        out.flush();
+      }
+      auto spill_end = std::chrono::steady_clock::now();
+      spill_latencies_us.push_back(
+          std::chrono::duration<double, std::micro>(spill_end - spill_start).count());
+      node.Delete(object_id);
+
+      // Restore: read the file back and recreate the object in the store.
+      auto restored_id = ObjectID::FromRandom();
+      rpc::Address owner_address;
+      owner_address.set_node_id(node.node_id().Binary());
+      auto restore_start = std::chrono::steady_clock::now();
+      {
+        std::ifstream in(spill_path, std::ios::binary);
+        std::vector<char> file_data(object_size);
+        in.read(file_data.data(), object_size);
+        std::shared_ptr<Buffer> data;
+        RAY_CHECK_OK(node.client().CreateAndSpillIfNeeded(
+            restored_id,
+            owner_address,
+            /*is_mutable=*/false,
+            object_size,
+            /*metadata=*/nullptr,
+            /*metadata_size=*/0,
+            &data,
+            plasma::flatbuf::ObjectSource::RestoredFromStorage));
+        std::memcpy(data->Data(), file_data.data(), object_size);
+        RAY_CHECK_OK(node.client().Seal(restored_id));
+      }
+      auto restore_end = std::chrono::steady_clock::now();
+      restore_latencies_us.push_back(
+          std::chrono::duration<double, std::micro>(restore_end - restore_start).count());
+      RAY_CHECK_OK(node.client().Release(restored_id));
+      node.Delete(restored_id);
+    }
+    auto spill_report = SummarizeLatencies(std::move(spill_latencies_us), object_size);
+    auto restore_report =
+        SummarizeLatencies(std::move(restore_latencies_us), object_size);
+    PrintReport("spill", object_size, spill_report);
+    PrintReport("restore", object_size, restore_report);
+  }
+  std::remove(spill_path.c_str());
+}
+
+}  // namespace ray
@@ -546,6 +546,175 @@ TEST_F(OwnershipBasedObjectDirectoryTest, TestNotifyOnUpdate) {
   AssertNoLeak();
 }
 
+TEST_F(OwnershipBasedObjectDirectoryTest, TestNotifyOnDeltaUpdate) {
+  UniqueID callback_id = UniqueID::FromRandom();
+  ObjectID obj_id = ObjectID::FromRandom();
+  int num_callbacks = 0;
+  std::unordered_set<NodeID> locations;
+  obod_->SubscribeObjectLocations(callback_id,
+                                  obj_id,
+                                  rpc::Address(),
+                                  [&](const ObjectID &object_id,
+                                      const std::unordered_set<NodeID> &client_ids,
+                                      const std::string &spilled_url,
+                                      const NodeID &spilled_node_id,
+                                      bool pending_creation,
+                                      size_t object_size) {
+                                    num_callbacks++;
+                                    locations = client_ids;
+                                  });
+  const NodeID node_1 = NodeID::FromRandom();
+  const NodeID node_2 = NodeID::FromRandom();
+
+  // A delta received before the initial snapshot is ignored; the snapshot the
+  // owner publishes on subscription already includes the change.
+  rpc::WorkerObjectLocationsPubMessage delta;
+  delta.set_is_delta(true);
+  delta.add_node_ids_added(node_1.Binary());
+  delta.set_object_size(100);
+  HandleMessage(delta, obj_id);
+  ASSERT_EQ(num_callbacks, 0);
+
+  // The full snapshot establishes the base location set.
+  rpc::WorkerObjectLocationsPubMessage snapshot;
+  snapshot.set_object_size(100);
+  snapshot.add_node_ids(node_1.Binary());
+  HandleMessage(snapshot, obj_id);
+  ASSERT_EQ(num_callbacks, 1);
+  ASSERT_EQ(locations, std::unordered_set<NodeID>({node_1}));
+
+  // A delta adding a node is applied on top of the snapshot.
+  delta.Clear();
+  delta.set_is_delta(true);
+  delta.set_object_size(100);
+  delta.add_node_ids_added(node_2.Binary());
+  HandleMessage(delta, obj_id);
+  ASSERT_EQ(num_callbacks, 2);
+  ASSERT_EQ(locations, std::unordered_set<NodeID>({node_1, node_2}));
+
+  // Re-applying the same delta changes nothing, so no callback fires.
+  HandleMessage(delta, obj_id);
+  ASSERT_EQ(num_callbacks, 2);
+
+  // A delta removing a node drops it from the set.
+  delta.Clear();
+  delta.set_is_delta(true);
+  delta.set_object_size(100);
+  delta.add_node_ids_removed(node_1.Binary());
+  HandleMessage(delta, obj_id);
+  ASSERT_EQ(num_callbacks, 3);
+  ASSERT_EQ(locations, std::unordered_set<NodeID>({node_2}));
+
+  AssertNoLeak();
+}
+
+TEST_F(OwnershipBasedObjectDirectoryTest, TestGetCachedLocations) {
+  UniqueID callback_id = UniqueID::FromRandom();
+  ObjectID obj_id = ObjectID::FromRandom();
+  const NodeID node_1 = NodeID::FromRandom();
+  const NodeID spilled_node = NodeID::FromRandom();
+
+  // No subscription, no cache entry.
+  ASSERT_FALSE(obod_->GetCachedLocations(obj_id).has_value());
+
+  obod_->SubscribeObjectLocations(callback_id,
+                                  obj_id,
+                                  rpc::Address(),
+                                  [&](const ObjectID &object_id,
+                                      const std::unordered_set<NodeID> &client_ids,
+                                      const std::string &spilled_url,
+                                      const NodeID &spilled_node_id,
+                                      bool pending_creation,
+                                      size_t object_size) {});
+  // Subscribed but no notification from the owner yet, so the locations are
+  // not known and must not be served from the cache.
+  ASSERT_FALSE(obod_->GetCachedLocations(obj_id).has_value());
+
+  // The first notification makes the entry servable.
+  rpc::WorkerObjectLocationsPubMessage location_info;
+  location_info.set_object_size(100);
+  location_info.add_node_ids(node_1.Binary());
+  HandleMessage(location_info, obj_id);
+  auto cached = obod_->GetCachedLocations(obj_id);
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_EQ(cached->node_ids, std::unordered_set<NodeID>({node_1}));
+  ASSERT_EQ(cached->object_size, 100);
+  ASSERT_TRUE(cached->spilled_url.empty());
+
+  // Further notifications keep the cached entry up to date.
+  location_info.mutable_node_ids()->Clear();
+  location_info.set_spilled_url("url1");
+  location_info.set_spilled_node_id(spilled_node.Binary());
+  HandleMessage(location_info, obj_id);
+  cached = obod_->GetCachedLocations(obj_id);
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_TRUE(cached->node_ids.empty());
+  ASSERT_EQ(cached->spilled_url, "url1");
+  ASSERT_EQ(cached->spilled_node_id, spilled_node);
+
+  // The entry disappears with the last subscriber.
+  obod_->UnsubscribeObjectLocations(callback_id, obj_id);
+  ASSERT_FALSE(obod_->GetCachedLocations(obj_id).has_value());
+
+  AssertNoLeak();
+}
+
+TEST_F(OwnershipBasedObjectDirectoryTest, TestLocationHint) {
+  UniqueID callback_id = UniqueID::FromRandom();
+  ObjectID obj_id = ObjectID::FromRandom();
+  const NodeID hinted_node = NodeID::FromRandom();
+
+  // A hint for an object without a listener is a no-op.
+  obod_->HandleLocationHint(obj_id, hinted_node, 100);
+
+  int num_callbacks = 0;
+  std::unordered_set<NodeID> locations;
+  size_t object_size = 0;
+  obod_->SubscribeObjectLocations(callback_id,
+                                  obj_id,
+                                  rpc::Address(),
+                                  [&](const ObjectID &object_id,
+                                      const std::unordered_set<NodeID> &client_ids,
+                                      const std::string &spilled_url,
+                                      const NodeID &spilled_node_id,
+                                      bool pending_creation,
+                                      size_t size) {
+                                    num_callbacks++;
+                                    locations = client_ids;
+                                    object_size = size;
+                                  });
+
+  // A hint arriving before the owner's snapshot fires the callbacks with the
+  // hinted location.
+  obod_->HandleLocationHint(obj_id, hinted_node, 100);
+  ASSERT_EQ(num_callbacks, 1);
+  ASSERT_EQ(locations, std::unordered_set<NodeID>({hinted_node}));
+  ASSERT_EQ(object_size, 100);
+
+  // Re-applying the same hint changes nothing.
+  obod_->HandleLocationHint(obj_id, hinted_node, 100);
+  ASSERT_EQ(num_callbacks, 1);
+
+  // The hint does not make the cached entry authoritative; only the owner's
+  // pubsub notifications do.
+  ASSERT_FALSE(obod_->GetCachedLocations(obj_id).has_value());
+
+  // The owner's snapshot is applied as usual and overrides the hinted state.
+  const NodeID node_1 = NodeID::FromRandom();
+  rpc::WorkerObjectLocationsPubMessage location_info;
+  location_info.set_object_size(100);
+  location_info.add_node_ids(node_1.Binary());
+  HandleMessage(location_info, obj_id);
+  ASSERT_EQ(num_callbacks, 2);
+  ASSERT_EQ(locations, std::unordered_set<NodeID>({node_1}));
+
+  // Hints after the snapshot are dropped; pubsub is authoritative.
+  obod_->HandleLocationHint(obj_id, hinted_node, 100);
+  ASSERT_EQ(num_callbacks, 2);
+
+  AssertNoLeak();
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
@@ -18,10 +18,12 @@
 #include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 
 namespace ray {
 
@@ -38,8 +40,12 @@ class PullManagerTestWithCapacity {
         pull_manager_(
             self_node_id_,
             [this](const ObjectID &object_id) { return object_is_local_; },
-            [this](const ObjectID &object_id, const NodeID &node_id) {
+            [this](const ObjectID &object_id,
+                   const NodeID &node_id,
+                   uint64_t chunk_index_start,
+                   uint64_t chunk_index_end) {
               num_send_pull_request_calls_++;
+              sent_chunk_ranges_.emplace_back(chunk_index_start, chunk_index_end);
             },
             [this](const ObjectID &object_id) { num_abort_calls_[object_id]++; },
             [this](const ObjectID &object_id, rpc::ErrorType) {
@@ -92,6 +98,9 @@ class PullManagerTestWithCapacity {
   bool object_is_local_;
   bool allow_pin_ = false;
   int num_send_pull_request_calls_;
+  /// The chunk index ranges of the sent pull requests, (0, 0) for whole-object
+  /// pulls.
+  std::vector<std::pair<uint64_t, uint64_t>> sent_chunk_ranges_;
   int num_restore_spilled_object_calls_;
   std::function<void(const ray::Status &)> restore_object_callback_;
   double fake_time_;
@@ -146,6 +155,106 @@ std::vector<rpc::ObjectReference> CreateObjectRefs(int num_objs) {
   return refs;
 }
 
+TEST_P(PullManagerTest, TestIsObjectUrgent) {
+  BundlePriority prio = GetParam();
+  auto refs = CreateObjectRefs(1);
+  auto oids = ObjectRefsToIds(refs);
+  std::vector<rpc::ObjectReference> objects_to_locate;
+  auto req_id = pull_manager_.Pull(refs, prio, {"", false}, &objects_to_locate);
+
+  // Only ray.get() requests and task arguments are urgent; ray.wait() is not.
+  if (prio == BundlePriority::WAIT_REQUEST) {
+    ASSERT_FALSE(pull_manager_.IsObjectUrgent(oids[0]));
+  } else {
+    ASSERT_TRUE(pull_manager_.IsObjectUrgent(oids[0]));
+  }
+  // Unknown objects are never urgent.
+  ASSERT_FALSE(pull_manager_.IsObjectUrgent(ObjectID::FromRandom()));
+
+  auto objects_to_cancel = pull_manager_.CancelPull(req_id);
+  ASSERT_EQ(objects_to_cancel, oids);
+  ASSERT_FALSE(pull_manager_.IsObjectUrgent(oids[0]));
+  AssertNoLeaks();
+}
+
+TEST_P(PullManagerTest, TestStripedPull) {
+  BundlePriority prio = GetParam();
+  RayConfig::instance().initialize(
+      R"({"pull_manager_striped_pulls": true, "pull_manager_striped_pull_min_object_size": 1})");
+  const uint64_t chunk_size = RayConfig::instance().object_manager_default_chunk_size();
+
+  auto refs = CreateObjectRefs(1);
+  auto oid = ObjectRefsToIds(refs)[0];
+  std::vector<rpc::ObjectReference> objects_to_locate;
+  auto req_id = pull_manager_.Pull(refs, prio, {"", false}, &objects_to_locate);
+
+  std::unordered_set<NodeID> client_ids;
+  client_ids.insert(NodeID::FromRandom());
+  client_ids.insert(NodeID::FromRandom());
+  client_ids.insert(NodeID::FromRandom());
+  // An object of 5 chunks pulled from 3 locations is striped 2/2/1.
+  pull_manager_.OnLocationChange(
+      oid, client_ids, "", NodeID::Nil(), false, 5 * chunk_size);
+  ASSERT_EQ(num_send_pull_request_calls_, 3);
+  std::sort(sent_chunk_ranges_.begin(), sent_chunk_ranges_.end());
+  ASSERT_EQ(sent_chunk_ranges_,
+            (std::vector<std::pair<uint64_t, uint64_t>>{{0, 2}, {2, 4}, {4, 5}}));
+
+  // A single-location object is pulled whole, regardless of its size.
+  sent_chunk_ranges_.clear();
+  pull_manager_.ResetRetryTimer(oid);
+  pull_manager_.OnLocationChange(
+      oid, {NodeID::FromRandom()}, "", NodeID::Nil(), false, 5 * chunk_size);
+  ASSERT_EQ(num_send_pull_request_calls_, 4);
+  ASSERT_EQ(sent_chunk_ranges_,
+            (std::vector<std::pair<uint64_t, uint64_t>>{{0, 0}}));
+
+  RayConfig::instance().initialize(R"({"pull_manager_striped_pulls": false})");
+  auto objects_to_cancel = pull_manager_.CancelPull(req_id);
+  ASSERT_EQ(objects_to_cancel, ObjectRefsToIds(refs));
+  AssertNoLeaks();
+}
+
+TEST_P(PullManagerTest, TestCostBasedSourceSelection) {
+  BundlePriority prio = GetParam();
+  RayConfig::instance().initialize(
+      R"({"pull_manager_cost_based_source_selection": true})");
+
+  auto refs = CreateObjectRefs(1);
+  auto oid = ObjectRefsToIds(refs)[0];
+  std::vector<rpc::ObjectReference> objects_to_locate;
+  auto req_id = pull_manager_.Pull(refs, prio, {"", false}, &objects_to_locate);
+
+  // The object is both available on a remote node and spilled locally. With
+  // the default estimates (restores are assumed faster than pulls from nodes
+  // we have never pulled from), the restore is chosen.
+  NodeID remote_node = NodeID::FromRandom();
+  ObjectSpilled(oid, "local_url/foo/bar");
+  pull_manager_.OnLocationChange(oid, {remote_node}, "", NodeID::Nil(), false, 50);
+  ASSERT_EQ(num_send_pull_request_calls_, 0);
+  ASSERT_EQ(num_restore_spilled_object_calls_, 1);
+  ASSERT_EQ(num_abort_calls_[oid], 1);
+
+  // Completing the restore feeds the throughput estimate: 50 bytes in 2s.
+  fake_time_ += 2.;
+  restore_object_callback_(Status::OK());
+  ASSERT_EQ(pull_manager_.restore_bytes_per_second_, 25.);
+
+  // Once the remote node is known to be faster than the measured restore
+  // throughput, the pull is chosen instead.
+  pull_manager_.pull_bytes_per_second_[remote_node] = 100.;
+  pull_manager_.ResetRetryTimer(oid);
+  pull_manager_.OnLocationChange(oid, {remote_node}, "", NodeID::Nil(), false, 50);
+  ASSERT_EQ(num_send_pull_request_calls_, 1);
+  ASSERT_EQ(num_restore_spilled_object_calls_, 1);
+
+  RayConfig::instance().initialize(
+      R"({"pull_manager_cost_based_source_selection": false})");
+  auto objects_to_cancel = pull_manager_.CancelPull(req_id);
+  ASSERT_EQ(objects_to_cancel, ObjectRefsToIds(refs));
+  AssertNoLeaks();
+}
+
 TEST_P(PullManagerTest, TestStaleSubscription) {
   BundlePriority prio = GetParam();
   auto refs = CreateObjectRefs(1);
@@ -639,6 +748,90 @@ TEST_P(PullManagerTest, TestRetryTimer) {
   AssertNoLeaks();
 }
 
+TEST_P(PullManagerTest, TestRetryOnNewLocations) {
+  BundlePriority prio = GetParam();
+  RayConfig::instance().initialize(
+      R"({"pull_manager_retry_on_new_locations": true})");
+
+  auto refs = CreateObjectRefs(1);
+  auto obj1 = ObjectRefsToIds(refs)[0];
+  std::vector<rpc::ObjectReference> objects_to_locate;
+  auto req_id = pull_manager_.Pull(refs, prio, {"", false}, &objects_to_locate);
+
+  std::unordered_set<NodeID> client_ids;
+  client_ids.insert(NodeID::FromRandom());
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 1);
+
+  // Build up some backoff by letting the retry timer fire once.
+  fake_time_ += 10.;
+  pull_manager_.Tick();
+  ASSERT_EQ(num_send_pull_request_calls_, 2);
+
+  // Republishing an unchanged location set does not bypass the backoff.
+  fake_time_ += 1.;
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 2);
+
+  // A node we have not seen holding the object triggers an immediate retry.
+  client_ids.insert(NodeID::FromRandom());
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 3);
+
+  // The retry count was preserved, so once the new node is known the backoff
+  // applies to it as well.
+  fake_time_ += 1.;
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 3);
+
+  RayConfig::instance().initialize(
+      R"({"pull_manager_retry_on_new_locations": false})");
+  ASSERT_TRUE(num_abort_calls_.empty());
+  auto objects_to_cancel = pull_manager_.CancelPull(req_id);
+  ASSERT_EQ(objects_to_cancel, ObjectRefsToIds(refs));
+  AssertNoLeaks();
+}
+
+TEST_P(PullManagerTest, TestHandleNodeRemoved) {
+  BundlePriority prio = GetParam();
+  auto refs = CreateObjectRefs(1);
+  auto obj1 = ObjectRefsToIds(refs)[0];
+  std::vector<rpc::ObjectReference> objects_to_locate;
+  auto req_id = pull_manager_.Pull(refs, prio, {"", false}, &objects_to_locate);
+
+  NodeID node_a = NodeID::FromRandom();
+  std::unordered_set<NodeID> client_ids;
+  client_ids.insert(node_a);
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 1);
+
+  // Build up some backoff by letting the retry timer fire once.
+  fake_time_ += 10.;
+  pull_manager_.Tick();
+  ASSERT_EQ(num_send_pull_request_calls_, 2);
+
+  // A second location appears, but the retry timer is still backing off.
+  NodeID node_b = NodeID::FromRandom();
+  client_ids.insert(node_b);
+  fake_time_ += 1.;
+  pull_manager_.OnLocationChange(obj1, client_ids, "", NodeID::Nil(), false, 0);
+  ASSERT_EQ(num_send_pull_request_calls_, 2);
+
+  // The node the pull was dispatched to dies. The pull must be re-dispatched
+  // to the surviving location immediately instead of waiting out the backoff.
+  pull_manager_.HandleNodeRemoved(node_a);
+  ASSERT_EQ(num_send_pull_request_calls_, 3);
+
+  // Losing the last location leaves nothing to pull from; no request is sent.
+  pull_manager_.HandleNodeRemoved(node_b);
+  ASSERT_EQ(num_send_pull_request_calls_, 3);
+
+  ASSERT_TRUE(num_abort_calls_.empty());
+  auto objects_to_cancel = pull_manager_.CancelPull(req_id);
+  ASSERT_EQ(objects_to_cancel, ObjectRefsToIds(refs));
+  AssertNoLeaks();
+}
+
 TEST_P(PullManagerTest, TestBasic) {
   BundlePriority prio = GetParam();
   auto refs = CreateObjectRefs(3);
@@ -33,7 +33,7 @@ TEST(TestPushManager, TestSingleTransfer) {
   ASSERT_EQ(pm.NumChunksRemaining(), 10);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
   for (int i = 0; i < 10; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id);
   }
   ASSERT_EQ(pm.NumChunksInFlight(), 0);
   ASSERT_EQ(pm.NumChunksRemaining(), 0);
@@ -121,7 +121,7 @@ TEST(TestPushManager, TestRetryDuplicates) {
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
   // first 5 chunks will be sent by first push request.
   for (int i = 0; i < 5; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id);
   }
   for (int i = 0; i < 5; i++) {
     ASSERT_EQ(results[i], 1);
@@ -130,7 +130,7 @@ TEST(TestPushManager, TestRetryDuplicates) {
   ASSERT_EQ(pm.NumChunksRemaining(), 10);
   // we will resend all chunks by second push request.
   for (int i = 0; i < 10; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id);
   }
   for (int i = 0; i < 10; i++) {
     ASSERT_EQ(results[i], 2);
@@ -152,7 +152,7 @@ TEST(TestPushManager, TestResendWholeObject) {
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
 
   for (int i = 0; i < 5; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id);
   }
   // All chunks have been sent out
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 0);
@@ -165,7 +165,7 @@ TEST(TestPushManager, TestResendWholeObject) {
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
   // we will resend all chunks by second push request.
   for (int i = 0; i < 15; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id);
   }
   for (int i = 0; i < 10; i++) {
     ASSERT_EQ(results[i], 2);
@@ -199,10 +199,10 @@ TEST(TestPushManager, TestMultipleTransfers) {
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 2);
   for (int i = 0; i < 20; i++) {
     if (num_active1 > 0) {
-      pm.OnChunkComplete();
+      pm.OnChunkComplete(node1);
       num_active1--;
     } else if (num_active2 > 0) {
-      pm.OnChunkComplete();
+      pm.OnChunkComplete(node2);
       num_active2--;
     }
   }
@@ -242,18 +242,18 @@ TEST(TestPushManager, TestPushMultipleObject) {
   ASSERT_EQ(pm.NumChunksRemaining(), 7);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 3);
 
-  pm.OnChunkComplete();
+  pm.OnChunkComplete(node_id);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 2);
-  pm.OnChunkComplete();
+  pm.OnChunkComplete(node_id);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
-  pm.OnChunkComplete();
+  pm.OnChunkComplete(node_id);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
-  pm.OnChunkComplete();
+  pm.OnChunkComplete(node_id);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 0);
 
-  pm.OnChunkComplete();
-  pm.OnChunkComplete();
-  pm.OnChunkComplete();
+  pm.OnChunkComplete(node_id);
+  pm.OnChunkComplete(node_id);
+  pm.OnChunkComplete(node_id);
 
   ASSERT_EQ(pm.NumChunksInFlight(), 0);
   ASSERT_EQ(pm.NumChunksRemaining(), 0);
@@ -283,32 +283,136 @@ TEST(TestPushManager, TestNodeRemoved) {
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 3);
   ASSERT_EQ(pm.NumChunksInFlight(), 3);
   ASSERT_EQ(pm.push_state_map_.size(), 2);
-  ASSERT_EQ(pm.push_requests_with_chunks_to_send_.size(), 3);
+  ASSERT_EQ(pm.Lane(PushPriority::kBulk).size(), 3);
 
   // Remove Node 1. This should cause its associated push requests to be cleaned up.
   pm.HandleNodeRemoved(node_id_1);
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 1);
   ASSERT_EQ(pm.NumChunksInFlight(), 3);
   ASSERT_EQ(pm.push_state_map_.size(), 1);
-  ASSERT_EQ(pm.push_requests_with_chunks_to_send_.size(), 1);
+  ASSERT_EQ(pm.Lane(PushPriority::kBulk).size(), 1);
 
   // All 3 in flight chunks finish.
   // All pushes should be done with chunks to node 2 in flight.
   for (int i = 0; i < 3; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id_1);
   }
   ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 0);
   ASSERT_EQ(pm.NumChunksInFlight(), 3);
   ASSERT_EQ(pm.push_state_map_.size(), 0);
-  ASSERT_EQ(pm.push_requests_with_chunks_to_send_.size(), 0);
+  ASSERT_EQ(pm.Lane(PushPriority::kBulk).size(), 0);
 
   // The in flight chunks complete.
   for (int i = 0; i < 3; i++) {
-    pm.OnChunkComplete();
+    pm.OnChunkComplete(node_id_2);
   }
   ASSERT_EQ(pm.NumChunksInFlight(), 0);
 }
 
+TEST(TestPushManager, TestAdaptiveInFlightBudget) {
+  auto node_id = NodeID::FromRandom();
+  auto obj_id = ObjectID::FromRandom();
+  PushManager pm(/*max_chunks_in_flight=*/8,
+                 /*max_chunks_in_flight_per_node=*/4,
+                 /*urgent_priority_weight=*/4,
+                 /*adaptive_in_flight_budget=*/true);
+
+  int64_t num_sent = 0;
+  pm.StartPush(node_id, obj_id, 20, [&](int64_t) { num_sent++; });
+  ASSERT_EQ(pm.NumChunksInFlight(), 4);
+  ASSERT_EQ(num_sent, 4);
+
+  // A failed send halves the node's budget and the in-flight backlog drains
+  // down to it before new chunks are sent.
+  pm.OnChunkComplete(node_id, /*success=*/false);
+  ASSERT_EQ(pm.EffectiveNodeLimit(node_id), 2);
+  ASSERT_EQ(pm.NumChunksInFlight(), 3);
+  ASSERT_EQ(num_sent, 4);
+  pm.OnChunkComplete(node_id);
+  ASSERT_EQ(pm.NumChunksInFlight(), 2);
+  ASSERT_EQ(num_sent, 4);
+
+  // One budget's worth of successful sends grows the budget by one chunk.
+  pm.OnChunkComplete(node_id);
+  ASSERT_EQ(pm.EffectiveNodeLimit(node_id), 3);
+  ASSERT_EQ(pm.NumChunksInFlight(), 3);
+  ASSERT_EQ(num_sent, 6);
+
+  // Three more successes restore the full budget and drop the backoff state.
+  pm.OnChunkComplete(node_id);
+  pm.OnChunkComplete(node_id);
+  pm.OnChunkComplete(node_id);
+  ASSERT_TRUE(pm.node_budgets_.empty());
+  ASSERT_EQ(pm.EffectiveNodeLimit(node_id), 4);
+  ASSERT_EQ(pm.NumChunksInFlight(), 4);
+  ASSERT_EQ(num_sent, 10);
+}
+
+TEST(TestPushManager, TestUrgentPushesJumpTheQueue) {
+  auto node1 = NodeID::FromRandom();
+  auto node2 = NodeID::FromRandom();
+  auto bulk_obj = ObjectID::FromRandom();
+  auto urgent_obj = ObjectID::FromRandom();
+  std::vector<char> send_order;
+  // Weight 1 alternates the two lanes while both have chunks waiting.
+  PushManager pm(1, /*max_chunks_in_flight_per_node=*/0, /*urgent_priority_weight=*/1);
+  pm.StartPush(node1, bulk_obj, 4, [&](int64_t) { send_order.push_back('b'); });
+  // The first bulk chunk is already in flight when the urgent push arrives.
+  ASSERT_EQ(send_order, (std::vector<char>{'b'}));
+  pm.StartPush(
+      node2,
+      urgent_obj,
+      4,
+      [&](int64_t) { send_order.push_back('u'); },
+      PushPriority::kUrgent);
+  // The single in-flight slot is always occupied by the last sent chunk.
+  for (int i = 0; i < 7; i++) {
+    pm.OnChunkComplete(send_order.back() == 'b' ? node1 : node2);
+  }
+  // The urgent push cut ahead of the queued bulk chunks.
+  ASSERT_EQ(send_order, (std::vector<char>{'b', 'u', 'b', 'u', 'b', 'u', 'b', 'u'}));
+  pm.OnChunkComplete(node2);
+  ASSERT_EQ(pm.NumChunksInFlight(), 0);
+  ASSERT_EQ(pm.NumChunksRemaining(), 0);
+  ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 0);
+}
+
+TEST(TestPushManager, TestPerNodeInFlightLimit) {
+  auto node1 = NodeID::FromRandom();
+  auto node2 = NodeID::FromRandom();
+  auto obj1 = ObjectID::FromRandom();
+  auto obj2 = ObjectID::FromRandom();
+  int sent_to_node1 = 0;
+  int sent_to_node2 = 0;
+  PushManager pm(4, /*max_chunks_in_flight_per_node=*/1);
+
+  // Only one chunk may be in flight to node 1 even though the global budget
+  // allows more.
+  pm.StartPush(node1, obj1, 3, [&](int64_t) { sent_to_node1++; });
+  ASSERT_EQ(pm.NumChunksInFlight(), 1);
+  ASSERT_EQ(sent_to_node1, 1);
+
+  // Node 2 is not affected by node 1 being at its limit.
+  pm.StartPush(node2, obj2, 2, [&](int64_t) { sent_to_node2++; });
+  ASSERT_EQ(pm.NumChunksInFlight(), 2);
+  ASSERT_EQ(sent_to_node2, 1);
+
+  // Each completion frees the slot for the next chunk to that node.
+  pm.OnChunkComplete(node1);
+  ASSERT_EQ(sent_to_node1, 2);
+  ASSERT_EQ(pm.NumChunksInFlight(), 2);
+  pm.OnChunkComplete(node2);
+  ASSERT_EQ(sent_to_node2, 2);
+  pm.OnChunkComplete(node1);
+  ASSERT_EQ(sent_to_node1, 3);
+
+  pm.OnChunkComplete(node2);
+  pm.OnChunkComplete(node1);
+  ASSERT_EQ(pm.NumChunksInFlight(), 0);
+  ASSERT_EQ(pm.NumChunksRemaining(), 0);
+  ASSERT_EQ(pm.NumPushRequestsWithChunksToSend(), 0);
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
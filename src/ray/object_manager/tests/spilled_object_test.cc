@@ -415,6 +415,49 @@ TYPED_TEST(ObjectReaderTest, GetChunk) {
   }
 }
 
+TYPED_TEST(ObjectReaderTest, GetChunkView) {
+  std::vector<std::string> list_data{"", "alotofdata", "da", "data"};
+  std::vector<std::string> list_metadata{"", "meta", "metadata", "alotofmetadata"};
+  for (auto &data : list_data) {
+    for (auto &metadata : list_metadata) {
+      std::vector<uint64_t> chunk_sizes{1, 2, 3, 5, 100};
+      rpc::Address owner_address;
+      owner_address.set_node_id("nonsense");
+
+      std::string expected_output = data + metadata;
+      if (expected_output.size() != 0) {
+        chunk_sizes.push_back(expected_output.size());
+      }
+
+      for (auto chunk_size : chunk_sizes) {
+        auto reader = ChunkObjectReader(
+            TestFixture::CreateObjectReader_(data, metadata, owner_address), chunk_size);
+
+        // Check that each view matches the copied chunk, that a view is only
+        // missing for chunks spanning the data/metadata boundary, and that we
+        // can reconstruct the output from views with GetChunk as fallback.
+        std::string actual_output_by_chunks;
+        for (uint64_t i = 0; i < reader.GetNumChunks(); i++) {
+          auto chunk = reader.GetChunk(i);
+          ASSERT_TRUE(chunk.has_value());
+          auto chunk_view = reader.GetChunkView(i);
+          const auto chunk_offset = i * chunk_size;
+          const bool spans_boundary = chunk_offset < data.size() &&
+                                      chunk_offset + chunk->size() > data.size();
+          ASSERT_EQ(!spans_boundary, chunk_view.has_value());
+          if (chunk_view.has_value()) {
+            ASSERT_EQ(chunk.value(), std::string(chunk_view.value()));
+            actual_output_by_chunks.append(chunk_view.value());
+          } else {
+            actual_output_by_chunks.append(chunk.value());
+          }
+        }
+        ASSERT_EQ(expected_output, actual_output_by_chunks);
+      }
+    }
+  }
+}
+
 TEST(StringAllocationTest, TestNoCopyWhenStringMoved) {
   // Since protobuf always allocate string on heap,
   // move assign a string field doesn't copy the data.
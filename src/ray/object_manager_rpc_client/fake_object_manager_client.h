@@ -43,6 +43,12 @@ class FakeObjectManagerClient : public ObjectManagerClientInterface {
     push_callbacks.push_back(callback);
   }
 
+  void PushZeroCopy(const ZeroCopyPushRequest &request,
+                    const ClientCallback<PushReply> &callback) override {
+    num_push_requests++;
+    push_callbacks.push_back(callback);
+  }
+
   void Pull(const PullRequest &request,
             const ClientCallback<PullReply> &callback) override {
     num_pull_requests++;
@@ -58,6 +58,24 @@ class ObjectManagerClient : public ObjectManagerClientInterface {
                          /*method_timeout_ms*/ -1,
                          override)
 
+  /// Push object to remote object manager without copying the chunk payload
+  /// into a protobuf message. The request is serialized by
+  /// `grpc::SerializationTraits<ZeroCopyPushRequest>` into the same wire
+  /// format as a regular Push, so it targets the regular Push method.
+  ///
+  /// \param request The request message.
+  /// \param callback The callback function that handles reply from server
+  void PushZeroCopy(const ZeroCopyPushRequest &request,
+                    const ClientCallback<PushReply> &callback) override {
+    grpc_client_manager_->GetGrpcClient()
+        ->template CallGenericMethod<ZeroCopyPushRequest, PushReply>(
+            "/ray.rpc.ObjectManagerService/Push",
+            request,
+            callback,
+            "ObjectManagerService.grpc_client.Push",
+            /*method_timeout_ms*/ -1);
+  }
+
   /// Pull object from remote object manager
   ///
   /// \param request The request message
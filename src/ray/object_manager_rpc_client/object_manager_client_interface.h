@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "ray/object_manager_rpc_client/zero_copy_push_request.h"
 #include "ray/rpc/rpc_callback_types.h"
 #include "src/ray/protobuf/object_manager.pb.h"
 
@@ -32,6 +33,16 @@ class ObjectManagerClientInterface {
   virtual void Push(const PushRequest &request,
                     const ClientCallback<PushReply> &callback) = 0;
 
+  /// Push an object chunk whose payload travels as a gRPC slice instead of a
+  /// protobuf `bytes` field, so plasma chunk memory is handed to gRPC without
+  /// being copied. The server receives a regular Push message.
+  ///
+  /// \param request The request message; its payload slice may reference
+  /// external memory kept alive by the slice's releaser.
+  /// \param callback The callback function that handles reply from server
+  virtual void PushZeroCopy(const ZeroCopyPushRequest &request,
+                            const ClientCallback<PushReply> &callback) = 0;
+
   /// Pull object from remote object manager
   ///
   /// \param request The request message
@@ -0,0 +1,92 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <cstdint>
+#include <string>
+
+#include "src/ray/protobuf/object_manager.pb.h"
+
+namespace ray {
+namespace rpc {
+
+/// A Push request whose chunk payload is carried as a gRPC slice instead of
+/// the protobuf `data` field. The slice can reference plasma chunk memory
+/// directly (with a releaser keeping the chunk alive), so the payload is
+/// handed to gRPC without being copied into a protobuf message first. The
+/// wire format is identical to a regular `PushRequest`, so the receiving
+/// object manager needs no changes.
+struct ZeroCopyPushRequest {
+  /// All Push fields except `data`, which must be left unset.
+  PushRequest header;
+  /// The bytes of the `data` field. May reference external memory.
+  grpc::Slice payload;
+};
+
+/// Append `value` to `out` in protobuf varint encoding.
+inline void AppendProtobufVarint(uint64_t value, std::string *out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+}  // namespace rpc
+}  // namespace ray
+
+namespace grpc {
+
+/// Serializes a `ZeroCopyPushRequest` by emitting the serialized header
+/// followed by a hand-encoded `data` field whose bytes are the payload slice.
+/// Protobuf accepts fields in any order on the wire, so the result parses as
+/// a regular `PushRequest` on the server.
+template <>
+class SerializationTraits<ray::rpc::ZeroCopyPushRequest, void> {
+ public:
+  static Status Serialize(const ray::rpc::ZeroCopyPushRequest &msg,
+                          ByteBuffer *buffer,
+                          bool *own_buffer) {
+    std::string header_bytes;
+    if (!msg.header.SerializeToString(&header_bytes)) {
+      return Status(StatusCode::INTERNAL, "Failed to serialize PushRequest header");
+    }
+    // Key and length prefix of the `data` field (wire type 2,
+    // length-delimited).
+    ray::rpc::AppendProtobufVarint(
+        (static_cast<uint64_t>(ray::rpc::PushRequest::kDataFieldNumber) << 3) | 2,
+        &header_bytes);
+    ray::rpc::AppendProtobufVarint(msg.payload.size(), &header_bytes);
+    // The header slice copies the small metadata; the payload slice is
+    // reference counted and keeps pointing at the original chunk memory.
+    Slice slices[2] = {Slice(header_bytes), msg.payload};
+    *buffer = ByteBuffer(slices, 2);
+    *own_buffer = true;
+    return Status::OK;
+  }
+
+  /// The request only travels from client to server; the server parses it as
+  /// a regular `PushRequest`.
+  static Status Deserialize(ByteBuffer *buffer, ray::rpc::ZeroCopyPushRequest *msg) {
+    return Status(StatusCode::UNIMPLEMENTED,
+                  "ZeroCopyPushRequest cannot be deserialized");
+  }
+};
+
+}  // namespace grpc
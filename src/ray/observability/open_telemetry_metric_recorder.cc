@@ -27,6 +27,7 @@
 #include <opentelemetry/sdk/metrics/view/view_registry.h>
 
 #include <cassert>
+#include <memory>
 #include <utility>
 
 #include "ray/common/constants.h"
@@ -40,6 +41,10 @@
 namespace {
 using ray::observability::OpenTelemetryMetricRecorder;
 
+// Tag key marking the synthetic series that carries the number of data points
+// dropped by the per-gauge series cap.
+constexpr char kMetricOverflowTagKey[] = "ray_metric_overflow";
+
 static void DoubleGaugeCallback(opentelemetry::metrics::ObserverResult observer,
                                 void *state) {
   const std::string *name_ptr = static_cast<const std::string *>(state);
@@ -212,14 +217,38 @@ void OpenTelemetryMetricRecorder::CollectGaugeMetricValues(
     const std::string &name,
     const opentelemetry::nostd::shared_ptr<
         opentelemetry::metrics::ObserverResultT<double>> &observer) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = observations_by_name_.find(name);
-  RAY_CHECK(it != observations_by_name_.end())
-      << "Metric " << name << " is not registered";
-  for (const auto &observation : it->second) {
+  GaugeObservations *observations = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = observations_by_name_.find(name);
+    RAY_CHECK(it != observations_by_name_.end())
+        << "Metric " << name << " is not registered";
+    observations = it->second.get();
+  }
+  // Swap the data points out under the per-metric lock and hand them to the
+  // observer unlocked, so collecting a high-cardinality gauge doesn't stall
+  // writers for the duration of the export.
+  absl::flat_hash_map<absl::flat_hash_map<std::string, std::string>, double> points;
+  int64_t num_overflow_points = 0;
+  {
+    std::lock_guard<std::mutex> lock(observations->mutex);
+    points.swap(observations->points);
+    num_overflow_points = observations->num_overflow_points;
+    observations->num_overflow_points = 0;
+  }
+  for (const auto &observation : points) {
     observer->Observe(observation.second, observation.first);
   }
-  it->second.clear();
+  if (num_overflow_points > 0) {
+    RAY_LOG_EVERY_MS(WARNING, 60000)
+        << "Gauge metric " << name << " dropped " << num_overflow_points
+        << " data points this interval because it exceeded "
+        << RayConfig::instance().open_telemetry_max_series_per_gauge()
+        << " distinct tag sets (open_telemetry_max_series_per_gauge).";
+    observer->Observe(static_cast<double>(num_overflow_points),
+                      absl::flat_hash_map<std::string, std::string>{
+                          {kMetricOverflowTagKey, "true"}});
+  }
 }
 
 void OpenTelemetryMetricRecorder::RegisterGaugeMetric(const std::string &name,
@@ -238,7 +267,7 @@ void OpenTelemetryMetricRecorder::RegisterGaugeMetric(const std::string &name,
     gauge_metric_names_.push_back(name);
     name_ptr = &gauge_metric_names_.back();
     instrument = GetMeter()->CreateDoubleObservableGauge(name, description, "");
-    observations_by_name_[name] = {};
+    observations_by_name_[name] = std::make_unique<GaugeObservations>();
     registered_instruments_[name] = instrument;
   }
   // Important: Do not hold mutex_ (mutex A) when registering the callback.
@@ -331,23 +360,39 @@ void OpenTelemetryMetricRecorder::SetMetricValue(
     const std::string &name,
     absl::flat_hash_map<std::string, std::string> &&tags,
     double value) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (observations_by_name_.contains(name)) {
-    SetObservableMetricValue(name, std::move(tags), value);
-  } else {
-    SetSynchronousMetricValue(name, std::move(tags), value);
+  GaugeObservations *observations = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = observations_by_name_.find(name);
+    if (it == observations_by_name_.end()) {
+      SetSynchronousMetricValue(name, std::move(tags), value);
+      return;
+    }
+    observations = it->second.get();
   }
+  // Gauge writes only take the per-metric lock, so high-rate writers on
+  // different gauges don't contend with each other or with collection.
+  SetObservableMetricValue(*observations, std::move(tags), value);
 }
 
 void OpenTelemetryMetricRecorder::SetObservableMetricValue(
-    const std::string &name,
+    GaugeObservations &observations,
     absl::flat_hash_map<std::string, std::string> &&tags,
     double value) {
-  auto it = observations_by_name_.find(name);
-  RAY_CHECK(it != observations_by_name_.end())
-      << "Metric " << name
-      << " is not registered. Please register it before setting a value.";
-  it->second[std::move(tags)] = value;  // Set or update the value
+  std::lock_guard<std::mutex> lock(observations.mutex);
+  auto it = observations.points.find(tags);
+  if (it != observations.points.end()) {
+    it->second = value;  // Update the value
+    return;
+  }
+  const int64_t max_series = RayConfig::instance().open_telemetry_max_series_per_gauge();
+  if (max_series > 0 && static_cast<int64_t>(observations.points.size()) >= max_series) {
+    // Cardinality guard: don't let one runaway tag set grow the map without
+    // bound. The drop is surfaced via the overflow series at collection time.
+    observations.num_overflow_points += 1;
+    return;
+  }
+  observations.points[std::move(tags)] = value;  // Set the value
 }
 
 void OpenTelemetryMetricRecorder::SetSynchronousMetricValue(
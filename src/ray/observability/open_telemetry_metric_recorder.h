@@ -24,6 +24,7 @@
 #include <cassert>
 #include <chrono>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
@@ -114,12 +115,23 @@ class OpenTelemetryMetricRecorder {
   std::shared_ptr<opentelemetry::sdk::metrics::MeterProvider> meter_provider_;
   opentelemetry::exporter::otlp::OtlpGrpcMetricExporterOptions exporter_options_;
 
+  // Per-gauge observation state. Each gauge carries its own lock so writers
+  // to different metrics don't serialize on the global mutex_, and so
+  // export-time collection of one high-cardinality gauge doesn't block
+  // recording on others.
+  struct GaugeObservations {
+    std::mutex mutex;
+    // All data points recorded for this metric since the last collection.
+    absl::flat_hash_map<absl::flat_hash_map<std::string, std::string>, double> points;
+    // Data points dropped since the last collection because the series cap
+    // (open_telemetry_max_series_per_gauge) was reached.
+    int64_t num_overflow_points = 0;
+  };
+
   // Map of metric names to their observations (aka. set of tags and metric values).
-  // This contains all data points for a given metric for a given interval. This map
-  // should only be used for Gauge metrics.
-  absl::flat_hash_map<
-      std::string,
-      absl::flat_hash_map<absl::flat_hash_map<std::string, std::string>, double>>
+  // This map should only be used for Gauge metrics. Entries are never erased, so
+  // the GaugeObservations pointers stay valid once registered.
+  absl::flat_hash_map<std::string, std::unique_ptr<GaugeObservations>>
       observations_by_name_;
   // Map of metric names to their instrument pointers. This is used to ensure
   // that each metric is only registered once.
@@ -142,7 +154,7 @@ class OpenTelemetryMetricRecorder {
   // The name of the meter used for this recorder.
   const std::string meter_name_ = "ray";
 
-  void SetObservableMetricValue(const std::string &name,
+  void SetObservableMetricValue(GaugeObservations &observations,
                                 absl::flat_hash_map<std::string, std::string> &&tags,
                                 double value);
 
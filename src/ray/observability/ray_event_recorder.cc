@@ -14,6 +14,9 @@
 
 #include "ray/observability/ray_event_recorder.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "ray/common/ray_config.h"
 #include "ray/util/graceful_shutdown.h"
 #include "ray/util/logging.h"
@@ -22,6 +25,52 @@
 namespace ray {
 namespace observability {
 
+namespace {
+
+// Upper bound on the number of ingest shards. Shards are only worth their
+// per-shard buffer overhead for reasonably large buffers; small buffers (as
+// used in tests) collapse to a single shard with the original semantics.
+constexpr size_t kMaxIngestShards = 8;
+constexpr size_t kMinEventsPerIngestShard = 64;
+
+size_t NumIngestShards(size_t max_buffer_size) {
+  return std::max<size_t>(
+      1, std::min(kMaxIngestShards, max_buffer_size / kMinEventsPerIngestShard));
+}
+
+// Task-class events are high volume and individually low value, so they are
+// the only class eligible for adaptive sampling; node, actor and driver job
+// events are always kept.
+bool IsTaskClassEvent(rpc::events::RayEvent::EventType event_type) {
+  switch (event_type) {
+    case rpc::events::RayEvent::TASK_DEFINITION_EVENT:
+    case rpc::events::RayEvent::TASK_LIFECYCLE_EVENT:
+    case rpc::events::RayEvent::ACTOR_TASK_DEFINITION_EVENT:
+    case rpc::events::RayEvent::TASK_PROFILE_EVENT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Keep rate for task-class events as a function of shard occupancy: keep
+// everything below half full, then halve the keep rate each time the remaining
+// headroom halves, bottoming out at 1-in-8.
+int64_t TaskSampleEveryN(size_t size, size_t capacity) {
+  if (size * 2 < capacity) {
+    return 1;
+  }
+  if (size * 4 < capacity * 3) {
+    return 2;
+  }
+  if (size * 8 < capacity * 7) {
+    return 4;
+  }
+  return 8;
+}
+
+}  // namespace
+
 RayEventRecorder::RayEventRecorder(
     rpc::EventAggregatorClient &event_aggregator_client,
     instrumented_io_context &io_service,
@@ -33,9 +82,15 @@ RayEventRecorder::RayEventRecorder(
       periodical_runner_(PeriodicalRunner::Create(io_service)),
       max_buffer_size_(max_buffer_size),
       metric_source_(metric_source),
-      buffer_(max_buffer_size),
+      ingest_shards_(NumIngestShards(max_buffer_size)),
       dropped_events_counter_(dropped_events_counter),
-      node_id_(node_id) {}
+      node_id_(node_id) {
+  const size_t shard_capacity =
+      (max_buffer_size_ + ingest_shards_.size() - 1) / ingest_shards_.size();
+  for (auto &shard : ingest_shards_) {
+    shard.buffer.set_capacity(std::max<size_t>(1, shard_capacity));
+  }
+}
 
 void RayEventRecorder::StartExportingEvents() {
   absl::MutexLock lock(&mutex_);
@@ -54,14 +109,10 @@ void RayEventRecorder::StartExportingEvents() {
 }
 
 void RayEventRecorder::StopExportingEvents() {
-  {
-    absl::MutexLock lock(&mutex_);
-    if (!enabled_) {
-      return;
-    }
-    // Set enabled_ to false early to prevent new events from being added during shutdown.
-    // This prevents event loss from events added after ExportEvents() clears the buffer.
-    enabled_ = false;
+  // Set enabled_ to false early to prevent new events from being added during shutdown.
+  // This prevents event loss from events added after ExportEvents() clears the shards.
+  if (!enabled_.exchange(false)) {
+    return;
   }
   RAY_LOG(INFO) << "Stopping RayEventRecorder and flushing remaining events.";
 
@@ -97,9 +148,6 @@ void RayEventRecorder::StopExportingEvents() {
 
 void RayEventRecorder::ExportEvents() {
   absl::MutexLock lock(&mutex_);
-  if (buffer_.empty()) {
-    return;
-  }
   // Skip if there's already an in-flight gRPC call to avoid overlapping requests.
   // This prevents the race where StopExportingEvents() could return while a
   // periodic export is still in flight.
@@ -109,15 +157,33 @@ void RayEventRecorder::ExportEvents() {
            "once previous export completes.";
     return;
   }
+  // Drain all ingest shards. Events from the same thread always land in the
+  // same shard, so per-thread ordering is preserved; cross-shard ordering is
+  // not guaranteed, which is fine because events are merged by key below.
+  std::vector<std::unique_ptr<RayEventInterface>> drained_events;
+  int64_t num_task_events_sampled_out = 0;
+  for (auto &shard : ingest_shards_) {
+    absl::MutexLock shard_lock(&shard.mutex);
+    for (auto &event : shard.buffer) {
+      drained_events.push_back(std::move(event));
+    }
+    shard.buffer.clear();
+    num_task_events_sampled_out += shard.task_events_sampled_out;
+    shard.task_events_sampled_out = 0;
+  }
+  if (drained_events.empty() && num_task_events_sampled_out == 0) {
+    return;
+  }
   rpc::events::AddEventsRequest request;
   rpc::events::RayEventsData ray_event_data;
-  // group the event in the buffer_ by their entity id and type; then for each group,
-  // merge the events into a single event. maintain the order of the events in the buffer.
+  // group the drained events by their entity id and type; then for each group,
+  // merge the events into a single event. maintain the order of the events in the
+  // shards.
   std::list<std::unique_ptr<RayEventInterface>> grouped_events;
   absl::flat_hash_map<RayEventKey,
                       std::list<std::unique_ptr<RayEventInterface>>::iterator>
       event_key_to_iterator;
-  for (auto &event : buffer_) {
+  for (auto &event : drained_events) {
     auto key = std::make_pair(event->GetEntityId(), event->GetEventType());
     auto [it, inserted] = event_key_to_iterator.try_emplace(key);
     if (inserted) {
@@ -133,8 +199,13 @@ void RayEventRecorder::ExportEvents() {
     ray_event.set_node_id(node_id_.Binary());
     *ray_event_data.mutable_events()->Add() = std::move(ray_event);
   }
+  if (num_task_events_sampled_out > 0) {
+    // Annotate how many task-class events adaptive sampling dropped since the
+    // last export so downstream consumers can rescale task counts.
+    ray_event_data.mutable_task_events_metadata()->set_num_task_events_sampled_out(
+        num_task_events_sampled_out);
+  }
   *request.mutable_events_data() = std::move(ray_event_data);
-  buffer_.clear();
 
   grpc_in_progress_ = true;
   event_aggregator_client_.AddEvents(
@@ -155,22 +226,42 @@ void RayEventRecorder::ExportEvents() {
 
 void RayEventRecorder::AddEvents(
     std::vector<std::unique_ptr<RayEventInterface>> &&data_list) {
-  absl::MutexLock lock(&mutex_);
-  if (!enabled_) {
+  if (!enabled_.load(std::memory_order_acquire)) {
     return;
   }
   if (!RayConfig::instance().enable_ray_event()) {
     return;
   }
-  if (data_list.size() + buffer_.size() > max_buffer_size_) {
-    size_t events_to_remove = data_list.size() + buffer_.size() - max_buffer_size_;
+  const bool sampling_enabled =
+      RayConfig::instance().ray_event_recorder_adaptive_task_sampling_enabled();
+  IngestShard &shard =
+      ingest_shards_[std::hash<std::thread::id>{}(std::this_thread::get_id()) %
+                     ingest_shards_.size()];
+  size_t num_overflow_dropped = 0;
+  size_t num_sampled_out = 0;
+  absl::MutexLock lock(&shard.mutex);
+  for (auto &event : data_list) {
+    if (sampling_enabled && IsTaskClassEvent(event->GetEventType())) {
+      const int64_t sample_every_n =
+          TaskSampleEveryN(shard.buffer.size(), shard.buffer.capacity());
+      if (shard.task_events_seen++ % sample_every_n != 0) {
+        shard.task_events_sampled_out++;
+        num_sampled_out++;
+        continue;
+      }
+    }
+    if (shard.buffer.full()) {
+      num_overflow_dropped++;
+    }
+    shard.buffer.push_back(std::move(event));
+  }
+  if (num_overflow_dropped > 0) {
     // Record dropped events from the buffer
-    RAY_LOG(ERROR) << "Dropping " << events_to_remove << " events from the buffer.";
-    dropped_events_counter_.Record(events_to_remove,
-                                   {{"Source", std::string(metric_source_)}});
+    RAY_LOG(ERROR) << "Dropping " << num_overflow_dropped << " events from the buffer.";
   }
-  for (auto &event : data_list) {
-    buffer_.push_back(std::move(event));
+  if (num_overflow_dropped + num_sampled_out > 0) {
+    dropped_events_counter_.Record(num_overflow_dropped + num_sampled_out,
+                                   {{"Source", std::string(metric_source_)}});
   }
 }
 
@@ -52,30 +52,50 @@ class RayEventRecorder : public RayEventRecorderInterface {
   void StopExportingEvents() override;
 
   // Add a vector of data to the internal buffer. Data in the buffer will be sent to
-  // the event aggregator periodically.
+  // the event aggregator periodically. When adaptive sampling is enabled and the
+  // ingest queue is under load, task-class events are sampled 1-in-N; all other
+  // event classes are always kept. The number of sampled-out task events is
+  // reported to the aggregator so consumers can rescale.
   void AddEvents(std::vector<std::unique_ptr<RayEventInterface>> &&data_list) override;
 
  private:
   using RayEventKey = std::pair<std::string, rpc::events::RayEvent::EventType>;
 
+  // One ingest queue. Writers are spread across shards by thread id so that
+  // concurrent AddEvents() calls from different threads don't serialize on a
+  // single mutex, and ingest never contends with the export path.
+  struct IngestShard {
+    // Lock for this shard only; never held across shards.
+    absl::Mutex mutex;
+    // Bounded queue to store events before sending to the event aggregator.
+    // When the queue is full, old events are dropped to make room for new ones.
+    boost::circular_buffer<std::unique_ptr<RayEventInterface>> buffer
+        ABSL_GUARDED_BY(mutex);
+    // Task-class events observed by this shard, used for deterministic 1-in-N
+    // sampling.
+    int64_t task_events_seen ABSL_GUARDED_BY(mutex) = 0;
+    // Task-class events dropped by adaptive sampling since the last export.
+    int64_t task_events_sampled_out ABSL_GUARDED_BY(mutex) = 0;
+  };
+
   rpc::EventAggregatorClient &event_aggregator_client_;
   std::shared_ptr<PeriodicalRunner> periodical_runner_;
-  // Lock for thread safety when modifying the buffer.
+  // Lock serializing the export path and guarding exporting_started_. The
+  // ingest path only takes the per-shard locks.
   absl::Mutex mutex_;
 
-  // Maximum number of events to store in the buffer (configurable at runtime)
+  // Maximum number of events to store across all shards (configurable at runtime)
   size_t max_buffer_size_;
   std::string_view metric_source_;
-  // Bounded queue to store events before sending to the event aggregator.
-  // When the queue is full, old events are dropped to make room for new ones.
-  boost::circular_buffer<std::unique_ptr<RayEventInterface>> buffer_
-      ABSL_GUARDED_BY(mutex_);
+  // Ingest queues. Sized once in the constructor and never resized, so the
+  // shards (and their mutexes) stay at stable addresses.
+  std::vector<IngestShard> ingest_shards_;
   ray::observability::MetricInterface &dropped_events_counter_;
   // Flag to track if exporting has been started
   bool exporting_started_ ABSL_GUARDED_BY(mutex_) = false;
   // Flag to track if the recorder is enabled and accepting new events.
   // Set to false during shutdown to prevent event loss.
-  bool enabled_ ABSL_GUARDED_BY(mutex_) = true;
+  std::atomic<bool> enabled_ = true;
   // Node ID to be set on all events
   const NodeID node_id_;
 
@@ -39,13 +39,18 @@ class OpenTelemetryMetricRecorderTest : public ::testing::Test {
   std::optional<double> GetObservableMetricValue(
       const std::string &name,
       const absl::flat_hash_map<std::string, std::string> &tags) {
-    std::lock_guard<std::mutex> lock(recorder_.mutex_);
-    auto it = recorder_.observations_by_name_.find(name);
-    if (it == recorder_.observations_by_name_.end()) {
-      return std::nullopt;  // Not registered
+    OpenTelemetryMetricRecorder::GaugeObservations *observations = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(recorder_.mutex_);
+      auto it = recorder_.observations_by_name_.find(name);
+      if (it == recorder_.observations_by_name_.end()) {
+        return std::nullopt;  // Not registered
+      }
+      observations = it->second.get();
     }
-    auto tag_it = it->second.find(tags);
-    if (tag_it != it->second.end()) {
+    std::lock_guard<std::mutex> lock(observations->mutex);
+    auto tag_it = observations->points.find(tags);
+    if (tag_it != observations->points.end()) {
       return tag_it->second;  // Get the value
     }
     return std::nullopt;
@@ -64,6 +69,22 @@ TEST_F(OpenTelemetryMetricRecorderTest, TestGaugeMetric) {
   ASSERT_EQ(GetObservableMetricValue("test_metric", {{"tag1", "value2"}}), std::nullopt);
 }
 
+TEST_F(OpenTelemetryMetricRecorderTest, TestGaugeSeriesCap) {
+  RayConfig::instance().initialize(R"({"open_telemetry_max_series_per_gauge": 2})");
+  recorder_.RegisterGaugeMetric("test_capped_metric", "Test capped metric description");
+  recorder_.SetMetricValue("test_capped_metric", {{"tag1", "value1"}}, 1.0);
+  recorder_.SetMetricValue("test_capped_metric", {{"tag1", "value2"}}, 2.0);
+  // A third tag set exceeds the cap and is dropped.
+  recorder_.SetMetricValue("test_capped_metric", {{"tag1", "value3"}}, 3.0);
+  // Updating an existing tag set is still allowed at the cap.
+  recorder_.SetMetricValue("test_capped_metric", {{"tag1", "value1"}}, 4.0);
+  ASSERT_EQ(GetObservableMetricValue("test_capped_metric", {{"tag1", "value1"}}), 4.0);
+  ASSERT_EQ(GetObservableMetricValue("test_capped_metric", {{"tag1", "value2"}}), 2.0);
+  ASSERT_EQ(GetObservableMetricValue("test_capped_metric", {{"tag1", "value3"}}),
+            std::nullopt);
+  RayConfig::instance().initialize(R"({"open_telemetry_max_series_per_gauge": 10000})");
+}
+
 TEST_F(OpenTelemetryMetricRecorderTest, TestCounterMetric) {
   recorder_.RegisterCounterMetric("test_counter", "Test counter description");
   // Check that the counter metric is registered
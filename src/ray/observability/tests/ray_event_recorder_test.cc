@@ -44,6 +44,7 @@ class FakeEventAggregatorClient : public rpc::EventAggregatorClient {
       const rpc::events::AddEventsRequest &request,
       const rpc::ClientCallback<rpc::events::AddEventsReply> &callback) override {
     absl::MutexLock lock(&mutex_);
+    recorded_requests_.push_back(request);
     for (const auto &event : request.events_data().events()) {
       recorded_events_.push_back(event);
     }
@@ -59,6 +60,11 @@ class FakeEventAggregatorClient : public rpc::EventAggregatorClient {
     return recorded_events_;
   }
 
+  std::vector<rpc::events::AddEventsRequest> GetRecordedRequests() {
+    absl::MutexLock lock(&mutex_);
+    return recorded_requests_;
+  }
+
   void HoldCallbacks() {
     absl::MutexLock lock(&mutex_);
     hold_callbacks_ = true;
@@ -85,12 +91,39 @@ class FakeEventAggregatorClient : public rpc::EventAggregatorClient {
 
  private:
   std::vector<rpc::events::RayEvent> recorded_events_ ABSL_GUARDED_BY(mutex_);
+  std::vector<rpc::events::AddEventsRequest> recorded_requests_ ABSL_GUARDED_BY(mutex_);
   absl::Mutex mutex_;
   bool hold_callbacks_ ABSL_GUARDED_BY(mutex_) = false;
   std::optional<rpc::ClientCallback<rpc::events::AddEventsReply>> pending_callback_
       ABSL_GUARDED_BY(mutex_);
 };
 
+// Minimal task-class event for exercising adaptive sampling. The real task
+// event wrappers live in the core worker, so tests here provide their own.
+class FakeTaskLifecycleEvent : public RayEventInterface {
+ public:
+  explicit FakeTaskLifecycleEvent(std::string entity_id)
+      : entity_id_(std::move(entity_id)) {}
+
+  std::string GetEntityId() const override { return entity_id_; }
+
+  void Merge(RayEventInterface &&other) override {}
+
+  rpc::events::RayEvent Serialize() && override {
+    rpc::events::RayEvent event;
+    event.set_event_type(rpc::events::RayEvent::TASK_LIFECYCLE_EVENT);
+    event.set_session_name(entity_id_);
+    return event;
+  }
+
+  rpc::events::RayEvent::EventType GetEventType() const override {
+    return rpc::events::RayEvent::TASK_LIFECYCLE_EVENT;
+  }
+
+ private:
+  std::string entity_id_;
+};
+
 class RayEventRecorderTest : public ::testing::Test {
  public:
   RayEventRecorderTest() {
@@ -290,6 +323,63 @@ TEST_F(RayEventRecorderTest, TestDropEvents) {
   ASSERT_EQ(num_dropped_events, expected_num_dropped_events);
 }
 
+// Test that adaptive sampling drops task-class events under load, keeps other
+// event classes, and annotates the export with the sampled-out count.
+TEST_F(RayEventRecorderTest, TestAdaptiveTaskSampling) {
+  RayConfig::instance().initialize(
+      R"(
+{
+"enable_ray_event": true,
+"ray_event_recorder_adaptive_task_sampling_enabled": true
+}
+)");
+  recorder_->StartExportingEvents();
+
+  // With a buffer of 5, sampling starts once the queue is half full: task
+  // events are kept 1-in-2 from 3 queued events and 1-in-4 from 4. Of the 8
+  // task events below, 4 are kept.
+  std::vector<std::unique_ptr<RayEventInterface>> events;
+  for (int i = 0; i < 8; i++) {
+    events.push_back(
+        std::make_unique<FakeTaskLifecycleEvent>("task_" + std::to_string(i)));
+  }
+  // Non-task events are never sampled, even under load.
+  rpc::JobTableData data;
+  data.set_job_id("test_job_id");
+  events.push_back(std::make_unique<RayDriverJobDefinitionEvent>(data, "test_session"));
+  recorder_->AddEvents(std::move(events));
+  io_service_.run_one();
+
+  std::vector<rpc::events::RayEvent> recorded_events = fake_client_->GetRecordedEvents();
+  ASSERT_EQ(recorded_events.size(), 5);
+  size_t num_task_events = 0;
+  for (const auto &event : recorded_events) {
+    if (event.event_type() == rpc::events::RayEvent::TASK_LIFECYCLE_EVENT) {
+      num_task_events++;
+    }
+  }
+  ASSERT_EQ(num_task_events, 4);
+
+  // The export is annotated with the sampled-out count so consumers can
+  // rescale task counts.
+  std::vector<rpc::events::AddEventsRequest> requests =
+      fake_client_->GetRecordedRequests();
+  ASSERT_EQ(requests.size(), 1);
+  ASSERT_EQ(
+      requests[0].events_data().task_events_metadata().num_task_events_sampled_out(), 4);
+
+  // Sampled-out events are also counted as dropped events.
+  auto tag_to_value = fake_dropped_events_counter_->GetTagToValue();
+  size_t num_dropped_events = 0;
+  for (const auto &[tags, value] : tag_to_value) {
+    num_dropped_events += value;
+  }
+  ASSERT_EQ(num_dropped_events, 4);
+
+  RayConfig::instance().initialize(
+      R"({"ray_event_recorder_adaptive_task_sampling_enabled": false})");
+}
+
 TEST_F(RayEventRecorderTest, TestDisabled) {
   RayConfig::instance().initialize(
       R"(
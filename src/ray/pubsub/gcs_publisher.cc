@@ -70,6 +70,15 @@ void GcsPublisher::PublishError(std::string id, rpc::ErrorTableData message) {
   publisher_->Publish(std::move(msg));
 }
 
+void GcsPublisher::PublishInternalKVUpdate(const std::string &key,
+                                           rpc::InternalKVUpdateMessage message) {
+  rpc::PubMessage msg;
+  msg.set_channel_type(rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL);
+  msg.set_key_id(key);
+  *msg.mutable_internal_kv_update_message() = std::move(message);
+  publisher_->Publish(std::move(msg));
+}
+
 std::string GcsPublisher::DebugString() const { return publisher_->DebugString(); }
 
 }  // namespace pubsub
@@ -64,6 +64,11 @@ class GcsPublisher {
 
   void PublishError(std::string id, rpc::ErrorTableData message);
 
+  /// Publishes that an internal KV entry changed, so client-side caches can
+  /// drop their copy. `key` is the KV key (or prefix) carried by the message.
+  void PublishInternalKVUpdate(const std::string &key,
+                               rpc::InternalKVUpdateMessage message);
+
   /// Prints debugging info for the publisher.
   std::string DebugString() const;
 
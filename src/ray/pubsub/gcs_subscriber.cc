@@ -162,5 +162,30 @@ void GcsSubscriber::SubscribeAllWorkerFailures(
       std::move(subscription_failure_callback));
 }
 
+void GcsSubscriber::SubscribeAllInternalKVUpdates(
+    const rpc::ItemCallback<rpc::InternalKVUpdateMessage> &subscribe,
+    const rpc::StatusCallback &done) {
+  auto subscribe_item_callback = [subscribe](rpc::PubMessage &&msg) {
+    RAY_CHECK(msg.channel_type() == rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL);
+    subscribe(std::move(*msg.mutable_internal_kv_update_message()));
+  };
+  auto subscription_failure_callback = [](const std::string &, const Status &status) {
+    RAY_LOG(WARNING) << "Subscription to InternalKV channel failed: "
+                     << status.ToString();
+  };
+  subscriber_->Subscribe(
+      std::make_unique<rpc::SubMessage>(),
+      rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL,
+      gcs_address_,
+      /*key_id=*/std::nullopt,
+      [done](const Status &status) {
+        if (done != nullptr) {
+          done(status);
+        }
+      },
+      std::move(subscribe_item_callback),
+      std::move(subscription_failure_callback));
+}
+
 }  // namespace pubsub
 }  // namespace ray
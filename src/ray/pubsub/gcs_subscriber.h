@@ -64,6 +64,10 @@ class GcsSubscriber {
       const rpc::ItemCallback<rpc::WorkerDeltaData> &subscribe,
       const rpc::StatusCallback &done);
 
+  void SubscribeAllInternalKVUpdates(
+      const rpc::ItemCallback<rpc::InternalKVUpdateMessage> &subscribe,
+      const rpc::StatusCallback &done);
+
   /// Prints debugging info for the subscriber.
   std::string DebugString() const;
 
@@ -14,6 +14,7 @@
 
 #include "ray/pubsub/publisher.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -25,7 +26,9 @@ namespace ray {
 
 namespace pubsub {
 
-bool EntityState::Publish(const std::shared_ptr<rpc::PubMessage> &msg, size_t msg_size) {
+bool EntityState::Publish(const std::shared_ptr<rpc::PubMessage> &msg,
+                          size_t msg_size,
+                          absl::flat_hash_set<SubscriberState *> *touched_subscribers) {
   if (subscribers_.empty()) {
     return false;
   }
@@ -85,7 +88,12 @@ bool EntityState::Publish(const std::shared_ptr<rpc::PubMessage> &msg, size_t ms
   total_size_ += msg_size;
 
   for (auto &[id, subscriber] : subscribers_) {
-    subscriber->QueueMessage(msg);
+    if (touched_subscribers != nullptr) {
+      subscriber->QueueMessage(msg, msg_size, /*try_flush=*/false);
+      touched_subscribers->insert(subscriber);
+    } else {
+      subscriber->QueueMessage(msg, msg_size);
+    }
   }
   return true;
 }
@@ -118,13 +126,19 @@ int64_t SubscriptionIndex::GetNumBufferedBytes() const {
   return num_bytes_buffered;
 }
 
+bool SubscriptionIndex::HasSubscribersFor(const std::string &key_id) const {
+  return !subscribers_to_all_->Subscribers().empty() || entities_.contains(key_id);
+}
+
 bool SubscriptionIndex::Publish(const std::shared_ptr<rpc::PubMessage> &pub_message,
-                                size_t msg_size) {
-  const bool publish_to_all = subscribers_to_all_->Publish(pub_message, msg_size);
+                                size_t msg_size,
+                                absl::flat_hash_set<SubscriberState *> *touched_subscribers) {
+  const bool publish_to_all =
+      subscribers_to_all_->Publish(pub_message, msg_size, touched_subscribers);
   bool publish_to_entity = false;
   auto it = entities_.find(pub_message->key_id());
   if (it != entities_.end()) {
-    publish_to_entity = it->second->Publish(pub_message, msg_size);
+    publish_to_entity = it->second->Publish(pub_message, msg_size, touched_subscribers);
   }
   return publish_to_all || publish_to_entity;
 }
@@ -257,6 +271,7 @@ std::unique_ptr<EntityState> SubscriptionIndex::CreateEntityState(
   case rpc::ChannelType::GCS_NODE_INFO_CHANNEL:
   case rpc::ChannelType::GCS_NODE_ADDRESS_AND_LIVENESS_CHANNEL:
   case rpc::ChannelType::GCS_WORKER_DELTA_CHANNEL:
+  case rpc::ChannelType::GCS_INTERNAL_KV_CHANNEL:
     // Critical if messages are dropped.
     return std::make_unique<EntityState>(RayConfig::instance().max_grpc_message_size(),
                                          /*max_buffered_bytes=*/-1);
@@ -281,7 +296,7 @@ void SubscriberState::ConnectToSubscriber(
 
   // clean up messages that have already been processed.
   while (!mailbox_.empty() &&
-         mailbox_.front()->sequence_id() <= max_processed_sequence_id) {
+         mailbox_.front().first->sequence_id() <= max_processed_sequence_id) {
     mailbox_.pop_front();
   }
 
@@ -293,14 +308,22 @@ void SubscriberState::ConnectToSubscriber(
   RAY_CHECK(!long_polling_connection_);
   long_polling_connection_ = std::make_unique<LongPollConnection>(
       publisher_id, pub_messages, std::move(send_reply_callback));
+  publish_credit_bytes_ = request.publish_credit_bytes();
   last_connection_update_time_ms_ = get_time_ms_();
   PublishIfPossible(/*force_noop=*/false);
 }
 
-void SubscriberState::QueueMessage(const std::shared_ptr<rpc::PubMessage> &pub_message) {
+void SubscriberState::QueueMessage(const std::shared_ptr<rpc::PubMessage> &pub_message,
+                                   size_t msg_size,
+                                   bool try_flush) {
   RAY_LOG(DEBUG) << "enqueue: " << pub_message->sequence_id();
-  mailbox_.push_back(pub_message);
-  PublishIfPossible(/*force_noop=*/false);
+  if (msg_size == 0) {
+    msg_size = pub_message->ByteSizeLong();
+  }
+  mailbox_.emplace_back(pub_message, msg_size);
+  if (try_flush) {
+    PublishIfPossible(/*force_noop=*/false);
+  }
 }
 
 void SubscriberState::PublishIfPossible(bool force_noop) {
@@ -316,19 +339,27 @@ void SubscriberState::PublishIfPossible(bool force_noop) {
   *long_polling_connection_->publisher_id_ = publisher_id_binary_;
   int64_t num_total_bytes = 0;
   if (!force_noop) {
+    // The reply is capped by the publisher's own serialization size threshold, and
+    // additionally by the byte credit the subscriber advertised in its poll request.
+    int64_t max_batch_bytes =
+        static_cast<int64_t>(RayConfig::instance().max_grpc_message_size());
+    if (publish_credit_bytes_ > 0) {
+      max_batch_bytes = std::min(max_batch_bytes, publish_credit_bytes_);
+    }
     for (auto it = mailbox_.begin(); it != mailbox_.end(); it++) {
       if (long_polling_connection_->pub_messages_->size() >= publish_batch_size_) {
         break;
       }
 
-      const rpc::PubMessage &msg = **it;
+      const rpc::PubMessage &msg = *it->first;
 
-      int64_t msg_size_bytes = msg.ByteSizeLong();
-      if (num_total_bytes > 0 &&
-          num_total_bytes + msg_size_bytes >
-              static_cast<int64_t>(RayConfig::instance().max_grpc_message_size())) {
-        // Adding this message to the batch would put us over the serialization
-        // size threshold.
+      // Use the size recorded when the message was published, so batching by
+      // total bytes does not re-measure the shared message once per subscriber.
+      int64_t msg_size_bytes = it->second;
+      if (num_total_bytes > 0 && num_total_bytes + msg_size_bytes > max_batch_bytes) {
+        // Adding this message to the batch would put us over the size threshold.
+        // At least one message is always sent so an oversized message cannot
+        // wedge the mailbox.
         break;
       }
       num_total_bytes += msg_size_bytes;
@@ -423,6 +454,12 @@ void Publisher::Publish(rpc::PubMessage pub_message) {
   const auto channel_type = pub_message.channel_type();
   absl::MutexLock lock(&mutex_);
   auto &subscription_index = subscription_index_map_.at(channel_type);
+  // Fast path: nobody listens on the entity or the channel, so skip sequencing,
+  // size measurement, and the shared message allocation entirely. This keeps
+  // publish storms on idle channels allocation-free.
+  if (!subscription_index.HasSubscribersFor(pub_message.key_id())) {
+    return;
+  }
   pub_message.set_sequence_id(++next_sequence_id_);
 
   const size_t msg_size = pub_message.ByteSizeLong();
@@ -433,6 +470,35 @@ void Publisher::Publish(rpc::PubMessage pub_message) {
                              msg_size);
 }
 
+void Publisher::PublishBatch(std::vector<rpc::PubMessage> pub_messages) {
+  absl::MutexLock lock(&mutex_);
+  // Queue all messages without flushing, then flush each touched subscriber's
+  // long-poll connection once. Publishing one by one would consume the parked
+  // connection with the first message, turning a mass publish into one reply
+  // round trip per message.
+  absl::flat_hash_set<SubscriberState *> touched_subscribers;
+  for (auto &pub_message : pub_messages) {
+    RAY_CHECK_EQ(pub_message.sequence_id(), 0) << "sequence_id should not be set;";
+    const auto channel_type = pub_message.channel_type();
+    auto &subscription_index = subscription_index_map_.at(channel_type);
+    if (!subscription_index.HasSubscribersFor(pub_message.key_id())) {
+      continue;
+    }
+    pub_message.set_sequence_id(++next_sequence_id_);
+
+    const size_t msg_size = pub_message.ByteSizeLong();
+    cum_pub_message_cnt_[channel_type]++;
+    cum_pub_message_bytes_cnt_[channel_type] += msg_size;
+
+    subscription_index.Publish(std::make_shared<rpc::PubMessage>(std::move(pub_message)),
+                               msg_size,
+                               &touched_subscribers);
+  }
+  for (auto *subscriber : touched_subscribers) {
+    subscriber->PublishIfPossible(/*force_noop=*/false);
+  }
+}
+
 void Publisher::PublishFailure(const rpc::ChannelType channel_type,
                                const std::string &key_id) {
   rpc::PubMessage pub_message;
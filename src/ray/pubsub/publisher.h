@@ -59,9 +59,15 @@ class EntityState {
    *
    * @param pub_message The message to publish to subscribers.
    * @param msg_size The size of the message in bytes.
+   * @param touched_subscribers When non-null, messages are queued without flushing
+   *                            the subscribers' long-poll connections, and each
+   *                            subscriber that received the message is recorded so
+   *                            the caller can flush it once per batch.
    * @return true if there are subscribers, false otherwise.
    */
-  bool Publish(const std::shared_ptr<rpc::PubMessage> &pub_message, size_t msg_size);
+  bool Publish(const std::shared_ptr<rpc::PubMessage> &pub_message,
+               size_t msg_size,
+               absl::flat_hash_set<SubscriberState *> *touched_subscribers = nullptr);
 
   /**
    * @brief Add a subscriber to this entity.
@@ -131,10 +137,28 @@ class SubscriptionIndex {
    *
    * @param pub_message The message to publish.
    * @param msg_size The size of the message in bytes.
+   * @param touched_subscribers When non-null, messages are queued without flushing
+   *                            the subscribers' long-poll connections; subscribers
+   *                            that received the message are recorded for the caller
+   *                            to flush once per batch.
    * @return true if there are subscribers listening on the entity key of the message,
    *         false otherwise.
    */
-  bool Publish(const std::shared_ptr<rpc::PubMessage> &pub_message, size_t msg_size);
+  bool Publish(const std::shared_ptr<rpc::PubMessage> &pub_message,
+               size_t msg_size,
+               absl::flat_hash_set<SubscriberState *> *touched_subscribers = nullptr);
+
+  /**
+   * @brief Returns true if any subscriber listens on the entity key, including
+   * subscribers of all keys in the channel.
+   *
+   * This is a cheap check that lets callers skip the per-message bookkeeping
+   * when nobody would receive the message.
+   *
+   * @param key_id The entity key of the message to publish.
+   * @return true if publishing a message with this key would reach a subscriber.
+   */
+  bool HasSubscribersFor(const std::string &key_id) const;
 
   /**
    * @brief Adds a new subscriber and the key it subscribes to.
@@ -276,8 +300,16 @@ class SubscriberState {
    * @brief Queue a pubsub message to publish to the subscriber.
    *
    * @param pub_message The message to queue.
+   * @param msg_size Serialized size of the message in bytes, when the caller has
+   *                 already computed it. Pass 0 to compute it here. Sharing the
+   *                 size avoids re-measuring the same message once per subscriber
+   *                 when batching long-poll replies.
+   * @param try_flush Whether to try flushing the long-poll connection right away.
+   *                  Batch publishers pass false and flush once per batch.
    */
-  void QueueMessage(const std::shared_ptr<rpc::PubMessage> &pub_message);
+  void QueueMessage(const std::shared_ptr<rpc::PubMessage> &pub_message,
+                    size_t msg_size = 0,
+                    bool try_flush = true);
 
   /**
    * @brief Publish all queued messages if possible.
@@ -323,8 +355,11 @@ class SubscriberState {
   const UniqueID subscriber_id_;
   /// Inflight long polling reply callback, for replying to the subscriber.
   std::unique_ptr<LongPollConnection> long_polling_connection_;
-  /// Queued messages to publish.
-  std::deque<std::shared_ptr<rpc::PubMessage>> mailbox_;
+  /// Queued messages to publish, with the serialized size each message had when
+  /// it was published. Messages are shared across all subscriber mailboxes; a
+  /// message cleared by the entity buffer cap may be smaller than its recorded
+  /// size, but cleared messages are skipped when replies are assembled.
+  std::deque<std::pair<std::shared_ptr<rpc::PubMessage>, size_t>> mailbox_;
   /// Callback to get the current time.
   const std::function<double()> get_time_ms_;
   /// The time in which the connection is considered as timed out.
@@ -333,6 +368,10 @@ class SubscriberState {
   const int64_t publish_batch_size_;
   /// The last time long polling was connected in milliseconds.
   double last_connection_update_time_ms_;
+  /// Byte credit advertised by the latest long poll request. When positive,
+  /// replies are capped at this many message bytes in addition to the
+  /// publisher's own serialization size threshold.
+  int64_t publish_credit_bytes_ = 0;
   std::string publisher_id_binary_;
 };
 
@@ -402,6 +441,16 @@ class Publisher : public PublisherInterface {
 
   void Publish(rpc::PubMessage pub_message) override;
 
+  /**
+   * @brief Publish a batch of messages, taking the lock once and flushing each
+   * touched subscriber's long-poll connection once per batch instead of once per
+   * message. Mass publishes (e.g. object eviction waves) should prefer this over
+   * per-message Publish calls.
+   *
+   * @param pub_messages The messages to publish.
+   */
+  void PublishBatch(std::vector<rpc::PubMessage> pub_messages) override;
+
   void PublishFailure(const rpc::ChannelType channel_type,
                       const std::string &key_id) override;
 
@@ -439,6 +488,7 @@ class Publisher : public PublisherInterface {
   ///
 
   FRIEND_TEST(PublisherTest, TestBasicSingleSubscriber);
+  FRIEND_TEST(PublisherTest, TestPublishWithoutSubscribersFastPath);
   FRIEND_TEST(PublisherTest, TestNoConnectionWhenRegistered);
   FRIEND_TEST(PublisherTest, TestMultiObjectsFromSingleNode);
   FRIEND_TEST(PublisherTest, TestMultiObjectsFromMultiNodes);
@@ -17,6 +17,8 @@
 #include <gtest/gtest_prod.h>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "ray/common/id.h"
 #include "ray/common/status.h"
@@ -74,6 +76,22 @@ class PublisherInterface {
    */
   virtual void Publish(rpc::PubMessage pub_message) = 0;
 
+  /**
+   * @brief Publish a batch of messages to subscribers.
+   *
+   * Implementations may override this to amortize per-message locking and to
+   * flush each subscriber connection once per batch instead of once per
+   * message; the default simply publishes the messages one by one.
+   *
+   * @param pub_messages The messages to publish.
+   *                     Each is required to contain channel_type and key_id fields.
+   */
+  virtual void PublishBatch(std::vector<rpc::PubMessage> pub_messages) {
+    for (auto &pub_message : pub_messages) {
+      Publish(std::move(pub_message));
+    }
+  }
+
   /**
    * @brief Publish to the subscriber that the given key id is not available anymore.
    *
@@ -19,12 +19,21 @@
 #include <utility>
 #include <vector>
 
+#include "ray/common/ray_config.h"
+
 namespace ray {
 
 namespace pubsub {
 namespace {
 const UniqueID kDefaultUniqueID{};
+
+/// Channels whose messages are dispatched to the callback service ahead of the other
+/// messages from the same long polling reply. This keeps critical notifications such
+/// as object eviction from queueing behind bulk object location chatter.
+bool IsHighPriorityChannel(rpc::ChannelType channel_type) {
+  return channel_type == rpc::ChannelType::WORKER_OBJECT_EVICTION;
 }
+}  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
 /// SubscriberChannel
@@ -104,6 +113,12 @@ bool SubscriberChannel::IsSubscribed(const rpc::Address &publisher_address,
 }
 
 bool SubscriberChannel::CheckNoLeaks() const {
+  {
+    absl::MutexLock lock(&coalesced_delivery_state_->mu);
+    if (!coalesced_delivery_state_->latest_messages.empty()) {
+      return false;
+    }
+  }
   for (const auto &subscription : subscription_map_) {
     if (subscription.second.all_entities_subscription != nullptr) {
       return false;
@@ -137,9 +152,42 @@ void SubscriberChannel::HandlePublishedMessage(const rpc::Address &publisher_add
     return;
   }
   cum_processed_messages_++;
-  // If the object id is still subscribed, run a callback to the callback io service.
   const auto &channel_name =
       rpc::ChannelType_descriptor()->FindValueByNumber(channel_type_)->name();
+  if (IsCoalescingChannel()) {
+    // Coalesce per key: keep only the latest snapshot, and schedule at most one
+    // delivery per key at a time. Under location update storms this saves the
+    // consumer from processing redundant intermediate updates.
+    auto map_key = std::make_pair(publisher_id, key_id);
+    {
+      absl::MutexLock lock(&coalesced_delivery_state_->mu);
+      auto inserted = coalesced_delivery_state_->latest_messages.insert_or_assign(
+          map_key, std::move(pub_message));
+      if (!inserted.second) {
+        // A delivery for this key is already queued; it picks up the newer
+        // snapshot when it runs.
+        cum_coalesced_messages_++;
+        return;
+      }
+    }
+    callback_service_->post(
+        [subscription_callback = std::move(maybe_subscription_callback.value()),
+         state = coalesced_delivery_state_,
+         map_key = std::move(map_key)]() mutable {
+          rpc::PubMessage msg;
+          {
+            absl::MutexLock lock(&state->mu);
+            auto it = state->latest_messages.find(map_key);
+            RAY_CHECK(it != state->latest_messages.end());
+            msg = std::move(it->second);
+            state->latest_messages.erase(it);
+          }
+          subscription_callback(std::move(msg));
+        },
+        "Subscriber.HandlePublishedMessage_" + channel_name);
+    return;
+  }
+  // If the object id is still subscribed, run a callback to the callback io service.
   callback_service_->post(
       [subscription_callback = std::move(maybe_subscription_callback.value()),
        msg = std::move(pub_message)]() mutable  // allow data to be moved
@@ -217,6 +265,7 @@ std::string SubscriberChannel::DebugString() const {
   result << "\n- active subscribed publishers: " << subscription_map_.size();
   result << "\n- cumulative published messages: " << cum_published_messages_;
   result << "\n- cumulative processed messages: " << cum_processed_messages_;
+  result << "\n- cumulative coalesced messages: " << cum_coalesced_messages_;
   return result.str();
 }
 
@@ -304,6 +353,13 @@ void Subscriber::MakeLongPollingPubsubConnection(const rpc::Address &publisher_a
       processed_sequences_[publisher_id];
   long_polling_request.set_publisher_id(last_publisher_id.Binary());
   long_polling_request.set_max_processed_sequence_id(max_processed_sequence_id);
+  // Advertise the per-reply byte credit, if configured, so the publisher can
+  // cap its reply batches to what this subscriber wants to process at a time.
+  const int64_t publish_credit_bytes =
+      RayConfig::instance().subscriber_publish_credit_bytes();
+  if (publish_credit_bytes > 0) {
+    long_polling_request.set_publish_credit_bytes(publish_credit_bytes);
+  }
   subscriber_client->PubsubLongPolling(
       std::move(long_polling_request),
       [this, publisher_address](const Status &status,
@@ -344,6 +400,10 @@ void Subscriber::HandleLongPollingResponse(const rpc::Address &publisher_address
       processed_sequences_[publisher_id] = {reply_publisher_id, 0};
     }
 
+    // Messages are dispatched in two passes so that high priority channels are posted
+    // to the callback service ahead of bulk channels from the same reply. Sequence
+    // bookkeeping still happens in arrival order in the first pass.
+    std::vector<int> deferred_message_indices;
     for (int i = 0; i < reply.pub_messages_size(); i++) {
       const auto &msg = reply.pub_messages(i);
       const auto channel_type = msg.channel_type();
@@ -371,11 +431,23 @@ void Subscriber::HandleLongPollingResponse(const rpc::Address &publisher_address
         continue;
       }
 
+      if (!IsHighPriorityChannel(channel_type)) {
+        deferred_message_indices.push_back(i);
+        continue;
+      }
+
       // Otherwise, invoke the subscription callback, consuming the pub message.
       Channel(channel_type)
           ->HandlePublishedMessage(publisher_address,
                                    std::move(*reply.mutable_pub_messages(i)));
     }
+
+    for (const int i : deferred_message_indices) {
+      const auto channel_type = reply.pub_messages(i).channel_type();
+      Channel(channel_type)
+          ->HandlePublishedMessage(publisher_address,
+                                   std::move(*reply.mutable_pub_messages(i)));
+    }
   }
 
   if (SubscriptionExists(publisher_id)) {
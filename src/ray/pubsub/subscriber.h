@@ -103,6 +103,11 @@ class SubscriberChannel {
   /// Run a success callback for the given pub message.
   /// Note that this will ensure that the callback is running on a designated IO service.
   ///
+  /// On coalescing channels (see IsCoalescingChannel), if a delivery for the same key is
+  /// already queued on the IO service, the queued snapshot is replaced with the newer
+  /// message instead of scheduling another callback. This bounds the work the consumer
+  /// does under publish storms, where only the latest snapshot matters.
+  ///
   /// \param publisher_address The address of the publisher.
   /// \param pub_message The message to handle from the publisher.
   void HandlePublishedMessage(const rpc::Address &publisher_address,
@@ -180,11 +185,31 @@ class SubscriberChannel {
     return callback_it->second.failure_cb;
   }
 
+  /// Return true if messages on this channel may be coalesced. Only snapshot-style
+  /// channels, where the latest message for a key supersedes all earlier ones, are
+  /// eligible; one-shot notifications such as object eviction must never be dropped.
+  bool IsCoalescingChannel() const {
+    return channel_type_ == rpc::ChannelType::WORKER_OBJECT_LOCATIONS_CHANNEL;
+  }
+
+  /// Latest undelivered message per (publisher id, key id) for coalescing channels.
+  /// The state is shared with delivery tasks posted to the callback service, which run
+  /// without the subscriber lock, so it carries its own mutex.
+  struct CoalescedDeliveryState {
+    absl::Mutex mu;
+    absl::flat_hash_map<std::pair<UniqueID, std::string>, rpc::PubMessage>
+        latest_messages ABSL_GUARDED_BY(mu);
+  };
+
   const rpc::ChannelType channel_type_;
 
   /// Mapping of the publisher ID -> subscription info for the publisher.
   absl::flat_hash_map<UniqueID, Subscriptions> subscription_map_;
 
+  /// Pending coalesced deliveries. See CoalescedDeliveryState.
+  std::shared_ptr<CoalescedDeliveryState> coalesced_delivery_state_ =
+      std::make_shared<CoalescedDeliveryState>();
+
   /// An event loop to execute RPC callbacks. This should be equivalent to the client
   /// pool's io service.
   instrumented_io_context *callback_service_;
@@ -196,6 +221,7 @@ class SubscriberChannel {
   uint64_t cum_unsubscribe_requests_ = 0;
   mutable uint64_t cum_published_messages_ = 0;
   mutable uint64_t cum_processed_messages_ = 0;
+  mutable uint64_t cum_coalesced_messages_ = 0;
 };
 
 /// The pubsub client implementation. The class is thread-safe.
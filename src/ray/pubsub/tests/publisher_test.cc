@@ -482,6 +482,73 @@ TEST_F(PublisherTest, TestSubscriberBatchSize) {
   }
 }
 
+TEST_F(PublisherTest, TestSubscriberPublishCredit) {
+  absl::flat_hash_set<ObjectID> object_ids_published;
+  int64_t max_processed_sequence_id = 0;
+  int64_t num_replies = 0;
+  send_reply_callback =
+      [this, &object_ids_published, &max_processed_sequence_id, &num_replies](
+          Status status, std::function<void()> success, std::function<void()> failure) {
+        num_replies++;
+        for (int i = 0; i < reply.pub_messages_size(); i++) {
+          const auto &msg = reply.pub_messages(i);
+          const auto oid =
+              ObjectID::FromBinary(msg.worker_object_eviction_message().object_id());
+          object_ids_published.emplace(oid);
+          max_processed_sequence_id =
+              std::max(msg.sequence_id(), max_processed_sequence_id);
+        }
+        reply = rpc::PubsubLongPollingReply();
+      };
+
+  auto subscriber = std::make_shared<SubscriberState>(
+      subscriber_id_,
+      [this]() { return current_time_; },
+      subscriber_timeout_ms_,
+      /*publish_batch_size=*/100,
+      kDefaultPublisherId);
+
+  std::vector<ObjectID> oids;
+  int64_t msg_size = 0;
+  for (int i = 0; i < 10; i++) {
+    auto oid = ObjectID::FromRandom();
+    oids.push_back(oid);
+    auto msg = GeneratePubMessage(oid, GetNextSequenceId());
+    msg_size = msg.ByteSizeLong();
+    subscriber->QueueMessage(std::make_shared<rpc::PubMessage>(std::move(msg)));
+  }
+
+  // With a credit of one message per reply, each poll should deliver exactly one
+  // message even though the batch size and grpc size threshold allow more.
+  request_.set_publish_credit_bytes(msg_size);
+  for (int i = 0; i < 10; i++) {
+    request_.set_max_processed_sequence_id(max_processed_sequence_id);
+    subscriber->ConnectToSubscriber(request_,
+                                    reply.mutable_publisher_id(),
+                                    reply.mutable_pub_messages(),
+                                    send_reply_callback);
+    ASSERT_EQ(object_ids_published.size(), i + 1);
+    ASSERT_TRUE(object_ids_published.contains(oids[i]));
+  }
+  ASSERT_EQ(num_replies, 10);
+  ASSERT_TRUE(subscriber->CheckNoLeaks());
+
+  // Without a credit, the remaining behavior is unchanged: everything fits in
+  // one reply.
+  object_ids_published.clear();
+  request_.set_publish_credit_bytes(0);
+  request_.set_max_processed_sequence_id(0);
+  for (int i = 0; i < 10; i++) {
+    subscriber->QueueMessage(
+        std::make_shared<rpc::PubMessage>(GeneratePubMessage(oids[i], i + 1)));
+  }
+  subscriber->ConnectToSubscriber(request_,
+                                  reply.mutable_publisher_id(),
+                                  reply.mutable_pub_messages(),
+                                  send_reply_callback);
+  ASSERT_EQ(object_ids_published.size(), 10);
+}
+
 TEST_F(PublisherTest, TestSubscriberActiveTimeout) {
   ///
   /// Test the active connection timeout.
@@ -719,6 +786,74 @@ TEST_F(PublisherTest, TestBasicSingleSubscriber) {
   ASSERT_EQ(batched_ids[0], oid);
 }
 
+TEST_F(PublisherTest, TestPublishBatchFlushesConnectionOnce) {
+  int num_replies = 0;
+  std::vector<ObjectID> batched_ids;
+  send_reply_callback = [this, &num_replies, &batched_ids](
+                            Status status,
+                            std::function<void()> success,
+                            std::function<void()> failure) {
+    num_replies++;
+    for (int i = 0; i < reply.pub_messages_size(); i++) {
+      const auto &msg = reply.pub_messages(i);
+      const auto oid =
+          ObjectID::FromBinary(msg.worker_object_eviction_message().object_id());
+      batched_ids.push_back(oid);
+    }
+    reply = rpc::PubsubLongPollingReply();
+  };
+
+  std::vector<ObjectID> oids;
+  std::vector<rpc::PubMessage> pub_messages;
+  for (int i = 0; i < 3; i++) {
+    oids.push_back(ObjectID::FromRandom());
+    RAY_CHECK(publisher_
+                  ->RegisterSubscription(rpc::ChannelType::WORKER_OBJECT_EVICTION,
+                                         subscriber_id_,
+                                         oids.back().Binary())
+                  .ok());
+    pub_messages.push_back(GeneratePubMessage(oids.back(), 0));
+  }
+  publisher_->ConnectToSubscriber(request_,
+                                  reply.mutable_publisher_id(),
+                                  reply.mutable_pub_messages(),
+                                  send_reply_callback);
+
+  // Publishing one by one would consume the parked connection with the first
+  // message; a batch goes out as a single reply carrying all of them.
+  publisher_->PublishBatch(std::move(pub_messages));
+  ASSERT_EQ(num_replies, 1);
+  ASSERT_EQ(batched_ids, oids);
+  publisher_->UnregisterSubscriber(subscriber_id_);
+}
+
+TEST_F(PublisherTest, TestPublishWithoutSubscribersFastPath) {
+  const auto oid = ObjectID::FromRandom();
+
+  // Publishing to a channel with no subscribers takes the fast path: the message
+  // is dropped without consuming a sequence id or buffering anything.
+  publisher_->Publish(GeneratePubMessage(oid, 0));
+  {
+    absl::MutexLock lock(&publisher_->mutex_);
+    ASSERT_EQ(publisher_->next_sequence_id_, 0);
+  }
+  ASSERT_TRUE(publisher_->CheckNoLeaks());
+
+  // Once a subscriber registers for the key, publishing sequences the message
+  // again.
+  RAY_CHECK(publisher_
+                ->RegisterSubscription(rpc::ChannelType::WORKER_OBJECT_EVICTION,
+                                       subscriber_id_,
+                                       oid.Binary())
+                .ok());
+  publisher_->Publish(GeneratePubMessage(oid, 0));
+  {
+    absl::MutexLock lock(&publisher_->mutex_);
+    ASSERT_EQ(publisher_->next_sequence_id_, 1);
+  }
+  publisher_->UnregisterSubscriber(subscriber_id_);
+}
+
 TEST_F(PublisherTest, TestNoConnectionWhenRegistered) {
   std::vector<ObjectID> batched_ids;
   send_reply_callback = [this, &batched_ids](Status status,
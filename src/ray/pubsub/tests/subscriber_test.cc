@@ -312,6 +312,97 @@ TEST_F(SubscriberTest, TestIgnoreOutofOrderMessage) {
   ASSERT_EQ(4, owner_client->GetReportedMaxProcessedSequenceId());
 }
 
+TEST_F(SubscriberTest, TestCoalescedLocationUpdates) {
+  // On the object locations channel, redundant updates for the same key received
+  // before the consumer runs are coalesced: only the latest snapshot is delivered.
+  int64_t num_deliveries = 0;
+  int64_t last_delivered_sequence_id = 0;
+  auto subscription_callback = [&](const rpc::PubMessage &msg) {
+    num_deliveries++;
+    last_delivered_sequence_id = msg.sequence_id();
+  };
+  auto failure_callback = EMPTY_FAILURE_CALLBACK;
+
+  const auto locations_channel = rpc::ChannelType::WORKER_OBJECT_LOCATIONS_CHANNEL;
+  const auto owner_addr = GenerateOwnerAddress();
+  const auto object_id = ObjectID::FromRandom();
+  subscriber_->Subscribe(std::make_unique<rpc::SubMessage>(),
+                         locations_channel,
+                         owner_addr,
+                         object_id.Binary(),
+                         /*subscribe_done_callback=*/nullptr,
+                         subscription_callback,
+                         failure_callback);
+  ASSERT_TRUE(owner_client->ReplyCommandBatch());
+
+  // Three updates for the same key arrive in one reply, before the callback service
+  // runs. Only the latest one should be delivered.
+  ASSERT_TRUE(ReplyLongPolling(locations_channel, {object_id, object_id, object_id}));
+  ASSERT_EQ(num_deliveries, 1);
+  ASSERT_EQ(last_delivered_sequence_id, 3);
+
+  // After the coalesced delivery runs, the next update is delivered as usual.
+  ASSERT_TRUE(ReplyLongPolling(locations_channel, {object_id}));
+  ASSERT_EQ(num_deliveries, 2);
+  ASSERT_EQ(last_delivered_sequence_id, 4);
+
+  subscriber_->Unsubscribe(locations_channel, owner_addr, object_id.Binary());
+  ASSERT_TRUE(owner_client->ReplyCommandBatch());
+  ASSERT_TRUE(ReplyLongPolling(locations_channel, {object_id}));
+  ASSERT_TRUE(subscriber_->CheckNoLeaks());
+}
+
+TEST_F(SubscriberTest, TestEvictionDispatchedBeforeLocationUpdates) {
+  // Object eviction messages from a long polling reply are dispatched to the
+  // callback service before bulk object location updates from the same reply.
+  std::vector<rpc::ChannelType> delivery_order;
+  auto subscription_callback = [&](const rpc::PubMessage &msg) {
+    delivery_order.push_back(msg.channel_type());
+  };
+  auto failure_callback = EMPTY_FAILURE_CALLBACK;
+
+  const auto locations_channel = rpc::ChannelType::WORKER_OBJECT_LOCATIONS_CHANNEL;
+  const auto owner_addr = GenerateOwnerAddress();
+  const auto location_object_id = ObjectID::FromRandom();
+  const auto evicted_object_id = ObjectID::FromRandom();
+  subscriber_->Subscribe(std::make_unique<rpc::SubMessage>(),
+                         locations_channel,
+                         owner_addr,
+                         location_object_id.Binary(),
+                         /*subscribe_done_callback=*/nullptr,
+                         subscription_callback,
+                         failure_callback);
+  subscriber_->Subscribe(GenerateSubMessage(evicted_object_id),
+                         channel,
+                         owner_addr,
+                         evicted_object_id.Binary(),
+                         /*subscribe_done_callback=*/nullptr,
+                         subscription_callback,
+                         failure_callback);
+  ASSERT_TRUE(owner_client->ReplyCommandBatch());
+
+  // Build a reply where the location update precedes the eviction message.
+  auto callback = owner_client->long_polling_callbacks.front();
+  owner_client->long_polling_callbacks.pop_front();
+  auto reply = rpc::PubsubLongPollingReply();
+  reply.set_publisher_id(owner_client->publisher_id_);
+  auto *location_message = reply.add_pub_messages();
+  location_message->set_key_id(location_object_id.Binary());
+  location_message->set_channel_type(locations_channel);
+  location_message->set_sequence_id(owner_client->GetNextSequenceId());
+  auto *eviction_message = reply.add_pub_messages();
+  eviction_message->set_key_id(evicted_object_id.Binary());
+  eviction_message->set_channel_type(channel);
+  eviction_message->set_sequence_id(owner_client->GetNextSequenceId());
+  callback(Status::OK(), std::move(reply));
+  callback_service_.poll();
+  callback_service_.reset();
+
+  ASSERT_EQ(delivery_order.size(), 2);
+  ASSERT_EQ(delivery_order[0], rpc::ChannelType::WORKER_OBJECT_EVICTION);
+  ASSERT_EQ(delivery_order[1], locations_channel);
+}
+
 TEST_F(SubscriberTest, TestPublisherFailsOver) {
   auto subscription_callback = [this](const rpc::PubMessage &msg) {
     object_subscribed_[ObjectID::FromBinary(msg.key_id())]++;
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
+#include <string>
 
+#include "absl/container/flat_hash_map.h"
 #include "ray/common/id.h"
 #include "src/ray/protobuf/ray_syncer.grpc.pb.h"
 #include "src/ray/protobuf/ray_syncer.pb.h"
@@ -34,4 +37,26 @@ inline constexpr size_t kComponentArraySize =
 // between the current node and the remote node.
 using RpcCompletionCallback = std::function<void(const NodeID &)>;
 
+// Metadata key used when establishing a sync stream to advertise that this
+// node understands delta-encoded RESOURCE_VIEW messages. See
+// `RayConfig::syncer_resource_view_delta_updates`.
+inline constexpr char kResourceViewDeltaMetadataKey[] = "resource_view_delta";
+
+// Metadata key used when establishing a sync stream to tell the server which
+// bootstrap snapshot seeded the client's cluster view, so the server can skip
+// the part of the initial push the snapshot already covered. See
+// `RayConfig::syncer_bootstrap_snapshot`.
+inline constexpr char kBootstrapSnapshotIdMetadataKey[] = "bootstrap_snapshot_id";
+
+// Message versions per node (binary NodeID) and component. Used to record
+// which messages a bootstrap snapshot covered.
+using NodeVersionsMap =
+    absl::flat_hash_map<std::string, std::array<int64_t, kComponentArraySize>>;
+
+// Pseudo node id used as the connection key when a raylet syncs through an
+// aggregator raylet addressed by host:port, whose real node id is not known
+// at connect time. See `RayConfig::syncer_aggregator_address`.
+inline const NodeID kAggregatorUpstreamNodeID =
+    NodeID::FromBinary(std::string(kUniqueIDSize, '\x01'));
+
 }  // namespace ray::syncer
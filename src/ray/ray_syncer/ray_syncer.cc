@@ -14,6 +14,8 @@
 
 #include "ray/ray_syncer/ray_syncer.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -21,13 +23,25 @@
 #include <vector>
 
 #include "ray/common/asio/asio_util.h"
+#include "ray/common/constants.h"
 #include "ray/common/ray_config.h"
 #include "ray/ray_syncer/node_state.h"
 #include "ray/ray_syncer/ray_syncer_client.h"
 #include "ray/ray_syncer/ray_syncer_server.h"
+#include "ray/rpc/authentication/authentication_mode.h"
+#include "ray/rpc/authentication/authentication_token_loader.h"
 
 namespace ray::syncer {
 
+namespace {
+
+// A connection that stayed up at least this long is considered to have been
+// healthy, which resets the consecutive-failure count used for upstream
+// fallback.
+constexpr std::chrono::seconds kHealthyConnectionDuration{30};
+
+}  // namespace
+
 RaySyncer::RaySyncer(instrumented_io_context &io_context,
                      const std::string &local_node_id,
                      size_t max_batch_size,
@@ -80,8 +94,21 @@ std::vector<std::string> RaySyncer::GetAllConnectedNodeIDs() const {
 
 void RaySyncer::Connect(const std::string &node_id,
                         std::shared_ptr<grpc::Channel> channel) {
+  if (RayConfig::instance().syncer_bootstrap_snapshot()) {
+    FetchBootstrapSnapshotAndConnect(node_id, std::move(channel));
+    return;
+  }
+  DoConnect(node_id, std::move(channel), /*bootstrap_snapshot_id=*/-1, {});
+}
+
+void RaySyncer::DoConnect(const std::string &node_id,
+                          std::shared_ptr<grpc::Channel> channel,
+                          int64_t bootstrap_snapshot_id,
+                          NodeVersionsMap snapshot_versions) {
   boost::asio::dispatch(
-      io_context_.get_executor(), std::packaged_task<void()>([=]() {
+      io_context_.get_executor(),
+      std::packaged_task<void()>([=,
+                                  snapshot_versions = std::move(snapshot_versions)]() {
         auto stub = ray::rpc::syncer::RaySyncer::NewStub(channel);
         auto reactor = std::make_shared<RayClientBidiReactor>(
             /* remote_node_id */ node_id,
@@ -101,6 +128,9 @@ void RaySyncer::Connect(const std::string &node_id,
                 sync_reactors_.erase(iter);
               }
               if (restart) {
+                if (TryFallbackUpstream(remote_node_id)) {
+                  return;
+                }
                 execute_after(
                     io_context_,
                     [this, remote_node_id, channel]() {
@@ -111,18 +141,178 @@ void RaySyncer::Connect(const std::string &node_id,
                     /* delay_microseconds = */ std::chrono::milliseconds(2000));
               } else {
                 node_state_->RemoveNode(remote_node_id);
+                fallback_upstreams_.erase(remote_node_id);
               }
             },
             /* stub */ std::move(stub),
             /* max_batch_size */ max_batch_size_,
-            /* max_batch_delay_ms */ max_batch_delay_ms_);
+            /* max_batch_delay_ms */ max_batch_delay_ms_,
+            /* bootstrap_snapshot_id */ bootstrap_snapshot_id);
         reactor->SetSelfRef(reactor);
+        if (!snapshot_versions.empty()) {
+          // The server already holds everything the snapshot covered; don't
+          // echo it back through the stream.
+          reactor->SeedNodeComponentVersions(snapshot_versions);
+        }
+        if (auto fallback_iter = fallback_upstreams_.find(node_id);
+            fallback_iter != fallback_upstreams_.end()) {
+          fallback_iter->second.connected_at = std::chrono::steady_clock::now();
+        }
         Connect(reactor);
         reactor->StartCall();
       }))
       .get();
 }
 
+void RaySyncer::FetchBootstrapSnapshotAndConnect(
+    const std::string &node_id, std::shared_ptr<grpc::Channel> channel) {
+  std::shared_ptr<ray::rpc::syncer::RaySyncer::Stub> stub =
+      ray::rpc::syncer::RaySyncer::NewStub(channel);
+  auto context = std::make_shared<grpc::ClientContext>();
+  // Add authentication token if token authentication is enabled.
+  if (auto auth_token = ray::rpc::AuthenticationTokenLoader::instance().GetToken();
+      auth_token && !auth_token->empty()) {
+    auth_token->SetMetadata(*context);
+  }
+  auto request = std::make_shared<ray::rpc::syncer::BootstrapSnapshotRequest>();
+  auto reply = std::make_shared<ray::rpc::syncer::BootstrapSnapshotReply>();
+  auto *stub_ptr = stub.get();
+  stub_ptr->async()->GetBootstrapSnapshot(
+      context.get(),
+      request.get(),
+      reply.get(),
+      [this,
+       stopped = stopped_,
+       &io_context = io_context_,
+       node_id,
+       channel,
+       stub,
+       context,
+       request,
+       reply](grpc::Status status) {
+        io_context.dispatch(
+            [this, stopped, node_id, channel, status, reply]() {
+              if (*stopped) {
+                return;
+              }
+              if (!status.ok()) {
+                RAY_LOG(WARNING).WithField(NodeID::FromBinary(node_id))
+                    << "Failed to fetch the bootstrap snapshot, falling back to the "
+                       "full initial sync: "
+                    << status.error_message();
+                DoConnect(node_id, channel, /*bootstrap_snapshot_id=*/-1, {});
+                return;
+              }
+              RAY_LOG(INFO).WithField(NodeID::FromBinary(node_id))
+                  << "Bootstrapping the cluster view from snapshot "
+                  << reply->snapshot_id() << " carrying " << reply->messages_size()
+                  << " messages.";
+              NodeVersionsMap snapshot_versions;
+              for (auto &message : *reply->mutable_messages()) {
+                auto [iter, is_new] = snapshot_versions.emplace(
+                    message.node_id(), std::array<int64_t, kComponentArraySize>());
+                if (is_new) {
+                  iter->second.fill(-1);
+                }
+                iter->second[message.message_type()] =
+                    std::max(iter->second[message.message_type()], message.version());
+                BroadcastMessage(std::make_shared<RaySyncMessage>(std::move(message)));
+              }
+              DoConnect(
+                  node_id, channel, reply->snapshot_id(), std::move(snapshot_versions));
+            },
+            "RaySyncer.BootstrapSnapshot");
+      });
+}
+
+int64_t RaySyncer::FillBootstrapSnapshot(
+    ray::rpc::syncer::BootstrapSnapshotReply *reply) {
+  if (bootstrap_snapshot_stale_ || served_bootstrap_snapshots_.empty()) {
+    auto &snapshot = served_bootstrap_snapshots_.emplace_back();
+    snapshot.snapshot_id = next_bootstrap_snapshot_id_++;
+    for (const auto &[node_id, messages] : node_state_->GetClusterView()) {
+      for (const auto &message : messages) {
+        if (!message) {
+          continue;
+        }
+        auto [iter, is_new] = snapshot.versions.emplace(
+            node_id, std::array<int64_t, kComponentArraySize>());
+        if (is_new) {
+          iter->second.fill(-1);
+        }
+        iter->second[message->message_type()] = message->version();
+      }
+    }
+    bootstrap_snapshot_stale_ = false;
+    const auto cache_size = static_cast<size_t>(std::max<int64_t>(
+        1, RayConfig::instance().syncer_bootstrap_snapshot_cache_size()));
+    while (served_bootstrap_snapshots_.size() > cache_size) {
+      served_bootstrap_snapshots_.pop_front();
+    }
+  }
+  for (const auto &[_, messages] : node_state_->GetClusterView()) {
+    for (const auto &message : messages) {
+      if (message) {
+        *reply->add_messages() = *message;
+      }
+    }
+  }
+  return served_bootstrap_snapshots_.back().snapshot_id;
+}
+
+const NodeVersionsMap *RaySyncer::GetServedBootstrapSnapshot(
+    int64_t snapshot_id) const {
+  if (snapshot_id < 0) {
+    return nullptr;
+  }
+  for (const auto &snapshot : served_bootstrap_snapshots_) {
+    if (snapshot.snapshot_id == snapshot_id) {
+      return &snapshot.versions;
+    }
+  }
+  return nullptr;
+}
+
+void RaySyncer::Connect(const std::string &node_id,
+                        std::shared_ptr<grpc::Channel> channel,
+                        const std::string &fallback_node_id,
+                        std::shared_ptr<grpc::Channel> fallback_channel) {
+  boost::asio::dispatch(
+      io_context_.get_executor(), std::packaged_task<void()>([&]() {
+        auto &fallback = fallback_upstreams_[node_id];
+        fallback.fallback_node_id = fallback_node_id;
+        fallback.fallback_channel = std::move(fallback_channel);
+      }))
+      .get();
+  Connect(node_id, std::move(channel));
+}
+
+bool RaySyncer::TryFallbackUpstream(const std::string &node_id) {
+  auto iter = fallback_upstreams_.find(node_id);
+  if (iter == fallback_upstreams_.end()) {
+    return false;
+  }
+  auto &fallback = iter->second;
+  if (std::chrono::steady_clock::now() - fallback.connected_at >
+      kHealthyConnectionDuration) {
+    // The broken connection was healthy for a while; start counting afresh.
+    fallback.consecutive_failures = 0;
+  }
+  if (++fallback.consecutive_failures <=
+      RayConfig::instance().syncer_aggregator_fallback_attempts()) {
+    return false;
+  }
+  RAY_LOG(WARNING).WithField(NodeID::FromBinary(node_id))
+      << "Upstream sync node is unreachable, re-parenting to fallback upstream "
+      << NodeID::FromBinary(fallback.fallback_node_id);
+  auto fallback_node_id = fallback.fallback_node_id;
+  auto fallback_channel = std::move(fallback.fallback_channel);
+  fallback_upstreams_.erase(iter);
+  node_state_->RemoveNode(node_id);
+  Connect(fallback_node_id, std::move(fallback_channel));
+  return true;
+}
+
 void RaySyncer::Connect(std::shared_ptr<RaySyncerBidiReactor> reactor) {
   // Bind rpc completion callback.
   if (on_rpc_completion_) {
@@ -134,6 +324,13 @@ void RaySyncer::Connect(std::shared_ptr<RaySyncerBidiReactor> reactor) {
         auto is_new = sync_reactors_.emplace(reactor->GetRemoteNodeID(), reactor).second;
         RAY_CHECK(is_new) << NodeID::FromBinary(reactor->GetRemoteNodeID())
                           << " has already registered.";
+        // A joiner that bootstrapped from a snapshot we served advertised the
+        // snapshot id; seed the reactor with the versions the snapshot
+        // covered so the initial push only carries what came after it.
+        if (const auto *versions =
+                GetServedBootstrapSnapshot(reactor->GetBootstrapSnapshotId())) {
+          reactor->SeedNodeComponentVersions(*versions);
+        }
         // Send the view for new connections.
         for (const auto &[_, messages] : node_state_->GetClusterView()) {
           for (const auto &message : messages) {
@@ -216,6 +413,7 @@ void RaySyncer::BroadcastMessage(std::shared_ptr<const RaySyncMessage> message)
         if (!node_state_->ConsumeSyncMessage(message)) {
           return;
         }
+        bootstrap_snapshot_stale_ = true;
         for (auto &reactor : sync_reactors_) {
           reactor.second->PushToSendingQueue(message);
         }
@@ -276,4 +474,32 @@ ServerBidiReactor *RaySyncerService::StartSync(grpc::CallbackServerContext *cont
   return reactor.get();
 }
 
+grpc::ServerUnaryReactor *RaySyncerService::GetBootstrapSnapshot(
+    grpc::CallbackServerContext *context,
+    const ray::rpc::syncer::BootstrapSnapshotRequest *request,
+    ray::rpc::syncer::BootstrapSnapshotReply *reply) {
+  auto *reactor = context->DefaultReactor();
+  if ((auth_token_ && !auth_token_->empty()) || ray::rpc::IsK8sTokenAuthEnabled()) {
+    const auto &metadata = context->client_metadata();
+    auto iter = metadata.find(kAuthTokenKey);
+    if (iter == metadata.end() ||
+        !auth_token_validator_.ValidateToken(
+            auth_token_, std::string_view(iter->second.data(), iter->second.length()))) {
+      reactor->Finish(
+          grpc::Status(grpc::StatusCode::UNAUTHENTICATED, "Invalid bearer token"));
+      return reactor;
+    }
+  }
+  // The snapshot is the bulk of a joiner's sync traffic, compress it.
+  context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  syncer_.GetIOContext().dispatch(
+      [this, reply, reactor]() {
+        const int64_t snapshot_id = syncer_.FillBootstrapSnapshot(reply);
+        reply->set_snapshot_id(snapshot_id);
+        reactor->Finish(grpc::Status::OK);
+      },
+      "RaySyncerService.GetBootstrapSnapshot");
+  return reactor;
+}
+
 }  // namespace ray::syncer
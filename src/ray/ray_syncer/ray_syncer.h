@@ -17,6 +17,8 @@
 #include <grpcpp/server.h>
 #include <gtest/gtest_prod.h>
 
+#include <chrono>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -113,6 +115,24 @@ class RaySyncer {
   /// \param channel The gRPC channel.
   void Connect(const std::string &node_id, std::shared_ptr<grpc::Channel> channel);
 
+  /// Connect to a node, with a fallback upstream used for tree repair.
+  ///
+  /// This is used for the aggregation-tree topology: a node syncing through an
+  /// aggregator passes the root (GCS) channel as the fallback. If connections to
+  /// `node_id` keep failing shortly after being established, the syncer gives up
+  /// on it and connects to `fallback_node_id` instead, so a subtree re-parents
+  /// to the root when its aggregator dies. See
+  /// RayConfig::syncer_aggregator_fallback_attempts.
+  ///
+  /// \param node_id The id of the node to connect to.
+  /// \param channel The gRPC channel to the node.
+  /// \param fallback_node_id The id of the node to re-parent to.
+  /// \param fallback_channel The gRPC channel to the fallback node.
+  void Connect(const std::string &node_id,
+               std::shared_ptr<grpc::Channel> channel,
+               const std::string &fallback_node_id,
+               std::shared_ptr<grpc::Channel> fallback_channel);
+
   void Disconnect(const std::string &node_id);
 
   /// Get the latest sync message sent from a specific node.
@@ -164,6 +184,42 @@ class RaySyncer {
  private:
   void Connect(std::shared_ptr<RaySyncerBidiReactor> connection);
 
+  /// Establish the client-side sync stream to a node. When
+  /// `bootstrap_snapshot_id` is not -1, the id is advertised in the stream
+  /// metadata and `snapshot_versions` seeds the reactor bookkeeping so the
+  /// snapshot content is neither echoed back to the server nor pushed to us
+  /// again.
+  void DoConnect(const std::string &node_id,
+                 std::shared_ptr<grpc::Channel> channel,
+                 int64_t bootstrap_snapshot_id,
+                 NodeVersionsMap snapshot_versions);
+
+  /// Fetch the cluster view from `node_id` through a single compressed unary
+  /// rpc, seed the local state with it and then open the sync stream. Falls
+  /// back to a plain connect (full initial push) when the fetch fails. Used
+  /// when RayConfig::syncer_bootstrap_snapshot is set.
+  void FetchBootstrapSnapshotAndConnect(const std::string &node_id,
+                                        std::shared_ptr<grpc::Channel> channel);
+
+  /// Fill `reply` with the current cluster view, remember which message
+  /// versions it covered and return the snapshot id. The previous snapshot id
+  /// is reused while the view is unchanged, so joiners arriving in a burst
+  /// share one cache entry. Must run on the io context.
+  int64_t FillBootstrapSnapshot(ray::rpc::syncer::BootstrapSnapshotReply *reply);
+
+  /// Return the version vector of a previously served bootstrap snapshot, or
+  /// nullptr when the id is unknown (e.g. evicted from the cache); the caller
+  /// then falls back to the full initial push.
+  const NodeVersionsMap *GetServedBootstrapSnapshot(int64_t snapshot_id) const;
+
+  /// If `node_id` has a fallback upstream registered and its connection has now
+  /// failed too many times in a row, drop it and connect to the fallback
+  /// instead.
+  ///
+  /// \return true if the fallback connection was initiated; in that case the
+  /// caller must not schedule a reconnect to `node_id`.
+  bool TryFallbackUpstream(const std::string &node_id);
+
   std::shared_ptr<bool> stopped_;
 
   /// Get the io_context used by RaySyncer.
@@ -178,6 +234,32 @@ class RaySyncer {
   /// Manage connections. Here the key is the NodeID in binary form.
   absl::flat_hash_map<std::string, std::shared_ptr<RaySyncerBidiReactor>> sync_reactors_;
 
+  /// Tree repair bookkeeping for connections established with a fallback
+  /// upstream. Keyed by the NodeID (binary) of the primary upstream.
+  struct FallbackUpstream {
+    std::string fallback_node_id;
+    std::shared_ptr<grpc::Channel> fallback_channel;
+    /// Number of connection failures since the last healthy connection.
+    int64_t consecutive_failures = 0;
+    /// When the current reactor was created, to distinguish a dead upstream
+    /// (quick failures) from occasional disconnects of a healthy one.
+    std::chrono::steady_clock::time_point connected_at;
+  };
+  absl::flat_hash_map<std::string, FallbackUpstream> fallback_upstreams_;
+
+  /// Recently served bootstrap snapshots, oldest first. Bounded by
+  /// RayConfig::syncer_bootstrap_snapshot_cache_size.
+  struct BootstrapSnapshot {
+    int64_t snapshot_id = -1;
+    /// The message versions per node the snapshot covered.
+    NodeVersionsMap versions;
+  };
+  std::deque<BootstrapSnapshot> served_bootstrap_snapshots_;
+  int64_t next_bootstrap_snapshot_id_ = 0;
+  /// Set when the cluster view changes so that the next bootstrap snapshot
+  /// gets a fresh id instead of reusing the last one.
+  bool bootstrap_snapshot_stale_ = true;
+
   /// The local node state
   std::unique_ptr<NodeState> node_state_;
 
@@ -199,6 +281,8 @@ class RaySyncer {
   friend struct SyncerServerTest;
   FRIEND_TEST(SyncerTest, Broadcast);
   FRIEND_TEST(SyncerTest, Reconnect);
+  FRIEND_TEST(SyncerTest, AggregationTreeFallback);
+  FRIEND_TEST(SyncerTest, BootstrapSnapshot);
   FRIEND_TEST(SyncerTest, Test1To1);
   FRIEND_TEST(SyncerTest, Test1ToN);
   FRIEND_TEST(SyncerTest, TestMToN);
@@ -224,6 +308,11 @@ class RaySyncerService : public ray::rpc::syncer::RaySyncer::CallbackService {
   grpc::ServerBidiReactor<RaySyncMessageBatch, RaySyncMessageBatch> *StartSync(
       grpc::CallbackServerContext *context) override;
 
+  grpc::ServerUnaryReactor *GetBootstrapSnapshot(
+      grpc::CallbackServerContext *context,
+      const ray::rpc::syncer::BootstrapSnapshotRequest *request,
+      ray::rpc::syncer::BootstrapSnapshotReply *reply) override;
+
  private:
   // The ray syncer this RPC wrappers of.
   RaySyncer &syncer_;
@@ -87,6 +87,18 @@ class RaySyncerBidiReactor {
   /// Return the remote node id of this connection.
   const std::string &GetRemoteNodeID() const { return remote_node_id_; }
 
+  /// Id of the bootstrap snapshot the remote node advertised when this
+  /// connection was established, or -1 if none. Only server-side reactors
+  /// learn one. See `RayConfig::syncer_bootstrap_snapshot`.
+  virtual int64_t GetBootstrapSnapshotId() const { return -1; }
+
+  /// Seed the per-node version bookkeeping with versions the remote node is
+  /// known to hold already (because it fetched or served a bootstrap
+  /// snapshot covering them), so those messages are not sent again on this
+  /// connection. Must be called on the io context before any message is
+  /// queued.
+  virtual void SeedNodeComponentVersions(const NodeVersionsMap &versions) {}
+
   /// Disconnect will terminate the communication between local and remote node.
   /// It also needs to do proper cleanup.
   void Disconnect() {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -21,8 +22,10 @@
 
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/ray_syncer/common.h"
 #include "ray/ray_syncer/ray_syncer_bidi_reactor.h"
+#include "ray/ray_syncer/resource_view_delta.h"
 #include "src/ray/protobuf/ray_syncer.grpc.pb.h"
 
 namespace ray::syncer {
@@ -129,6 +132,20 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
     StartRead(receiving_message_batch_.get());
   }
 
+  /// Mark that the remote node understands delta-encoded RESOURCE_VIEW
+  /// messages. Called by the derived reactor once the peer advertised support
+  /// during stream establishment; must run on the io context.
+  void MarkPeerAcceptsResourceViewDeltas() { peer_accepts_resource_view_deltas_ = true; }
+
+  void SeedNodeComponentVersions(const NodeVersionsMap &versions) override {
+    for (const auto &[node_id, component_versions] : versions) {
+      auto &node_versions = GetNodeComponentVersions(node_id);
+      for (size_t i = 0; i < kComponentArraySize; ++i) {
+        node_versions[i] = std::max(node_versions[i], component_versions[i]);
+      }
+    }
+  }
+
  protected:
   /// The io context
   instrumented_io_context &io_context_;
@@ -150,9 +167,19 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
                      << ", message_version=" << message.version()
                      << ", local_message_version="
                      << node_versions[message.message_type()];
+      std::shared_ptr<RaySyncMessage> received_message;
+      if (message.message_type() == MessageType::RESOURCE_VIEW &&
+          ::RayConfig::instance().syncer_resource_view_delta_updates()) {
+        received_message = DecodeResourceViewMessage(message);
+        if (received_message == nullptr) {
+          continue;
+        }
+      } else {
+        received_message = std::make_shared<RaySyncMessage>(message);
+      }
       if (node_versions[message.message_type()] < message.version()) {
         node_versions[message.message_type()] = message.version();
-        message_processor_(std::make_shared<RaySyncMessage>(message));
+        message_processor_(std::move(received_message));
       } else {
         RAY_LOG_EVERY_MS(WARNING, 1000)
             << "Drop message received from " << NodeID::FromBinary(message.node_id())
@@ -185,7 +212,7 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
       RAY_LOG(DEBUG) << "Adding message version: " << message->version()
                      << " from node: " << NodeID::FromBinary(message->node_id())
                      << " to message batch";
-      *message_batch->add_messages() = *message;
+      AddMessageToBatch(*message, message_batch.get());
     }
 
     RAY_LOG(DEBUG) << "Created message batch containing "
@@ -196,6 +223,94 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
     sending_ = true;
   }
 
+  /// Append a message to the outgoing batch, delta-encoding RESOURCE_VIEW
+  /// payloads when the peer supports them. Deltas are computed against the
+  /// last message written to this stream; gRPC streams are ordered and
+  /// reliable, so the receiver is guaranteed to have seen that base, and a
+  /// reconnect starts a fresh reactor whose first message is always full. A
+  /// full message is also sent as a periodic anchor, or when the delta would
+  /// not be smaller than the full payload.
+  ///
+  /// \param message The message to append.
+  /// \param batch The batch being built for the next write.
+  void AddMessageToBatch(const RaySyncMessage &message, RaySyncMessageBatch *batch) {
+    auto *entry = batch->add_messages();
+    *entry = message;
+    if (!peer_accepts_resource_view_deltas_ ||
+        message.message_type() != MessageType::RESOURCE_VIEW) {
+      return;
+    }
+    ResourceViewSyncMessage current;
+    if (!current.ParseFromString(message.sync_message())) {
+      RAY_LOG(WARNING) << "Failed to parse a RESOURCE_VIEW sync message from "
+                       << NodeID::FromBinary(message.node_id())
+                       << ", sending it as is.";
+      sent_resource_views_.erase(message.node_id());
+      return;
+    }
+    auto iter = sent_resource_views_.find(message.node_id());
+    const int64_t anchor_interval =
+        ::RayConfig::instance().syncer_resource_view_delta_anchor_interval();
+    if (iter != sent_resource_views_.end() &&
+        iter->second.deltas_since_anchor + 1 < anchor_interval) {
+      auto delta = ComputeResourceViewDelta(iter->second.last_view, current);
+      std::string serialized;
+      if (delta.SerializeToString(&serialized) &&
+          serialized.size() < message.sync_message().size()) {
+        entry->set_is_delta(true);
+        entry->set_sync_message(std::move(serialized));
+        iter->second.deltas_since_anchor += 1;
+      } else {
+        iter->second.deltas_since_anchor = 0;
+      }
+      iter->second.last_view = std::move(current);
+    } else {
+      auto &sent_state = sent_resource_views_[message.node_id()];
+      sent_state.last_view = std::move(current);
+      sent_state.deltas_since_anchor = 0;
+    }
+  }
+
+  /// Reconstruct the full payload of a RESOURCE_VIEW message received on this
+  /// stream. Full messages are recorded as the new base; deltas are applied
+  /// on top of the recorded base. The base is updated even for messages the
+  /// version check later drops so it stays aligned with what the sender last
+  /// wrote.
+  ///
+  /// \param message The message as received from the wire.
+  ///
+  /// \return The message with a full payload, or nullptr when it cannot be
+  /// decoded, e.g. a delta arriving before any full message; the next anchor
+  /// recovers the stream.
+  std::shared_ptr<RaySyncMessage> DecodeResourceViewMessage(
+      const RaySyncMessage &message) {
+    if (!message.is_delta()) {
+      ResourceViewSyncMessage view;
+      if (view.ParseFromString(message.sync_message())) {
+        received_resource_views_[message.node_id()] = std::move(view);
+      } else {
+        // Don't keep a base the sender didn't produce this message from.
+        received_resource_views_.erase(message.node_id());
+      }
+      return std::make_shared<RaySyncMessage>(message);
+    }
+    ResourceViewSyncMessage delta;
+    auto iter = received_resource_views_.find(message.node_id());
+    if (iter == received_resource_views_.end() ||
+        !delta.ParseFromString(message.sync_message())) {
+      RAY_LOG_EVERY_MS(WARNING, 1000)
+          << "Dropping a delta-encoded RESOURCE_VIEW message from "
+          << NodeID::FromBinary(message.node_id())
+          << " that cannot be applied, waiting for the next full message.";
+      return nullptr;
+    }
+    ApplyResourceViewDelta(delta, &iter->second);
+    auto reconstructed = std::make_shared<RaySyncMessage>(message);
+    reconstructed->set_is_delta(false);
+    reconstructed->set_sync_message(iter->second.SerializeAsString());
+    return reconstructed;
+  }
+
   /// Sending a message to the remote node
   ///
   /// \param message The message batch to be sent
@@ -265,6 +380,7 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
   FRIEND_TEST(RaySyncerTest, RaySyncerBidiReactorBase);
   FRIEND_TEST(RaySyncerTest, RaySyncerBidiReactorBaseBatchSizeTriggerSend);
   FRIEND_TEST(RaySyncerTest, RaySyncerBidiReactorBaseBatchTimeoutTriggerSend);
+  FRIEND_TEST(RaySyncerTest, RaySyncerBidiReactorBaseResourceViewDelta);
 
   friend struct SyncerServerTest;
 
@@ -294,6 +410,23 @@ class RaySyncerBidiReactorBase : public RaySyncerBidiReactor, public T {
   absl::flat_hash_map<std::string, std::array<int64_t, kComponentArraySize>>
       node_versions_;
 
+  /// Whether the remote node advertised support for delta-encoded
+  /// RESOURCE_VIEW messages when the stream was established.
+  bool peer_accepts_resource_view_deltas_ = false;
+
+  /// Per origin node: the payload of the last RESOURCE_VIEW message written
+  /// to this stream and how many deltas were sent since the last full
+  /// message.
+  struct SentResourceViewState {
+    ResourceViewSyncMessage last_view;
+    int64_t deltas_since_anchor = 0;
+  };
+  absl::flat_hash_map<std::string, SentResourceViewState> sent_resource_views_;
+
+  /// Per origin node: the reconstructed full RESOURCE_VIEW payload received
+  /// on this stream; deltas are applied on top of it.
+  absl::flat_hash_map<std::string, ResourceViewSyncMessage> received_resource_views_;
+
   bool sending_ = false;
 
   /// Batch configuration
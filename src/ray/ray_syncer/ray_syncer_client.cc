@@ -18,6 +18,7 @@
 #include <string>
 #include <utility>
 
+#include "ray/common/ray_config.h"
 #include "ray/rpc/authentication/authentication_token_loader.h"
 
 namespace ray::syncer {
@@ -30,7 +31,8 @@ RayClientBidiReactor::RayClientBidiReactor(
     std::function<void(RaySyncerBidiReactor *, bool)> cleanup_cb,
     std::unique_ptr<ray::rpc::syncer::RaySyncer::Stub> stub,
     size_t max_batch_size,
-    uint64_t max_batch_delay_ms)
+    uint64_t max_batch_delay_ms,
+    int64_t bootstrap_snapshot_id)
     : RaySyncerBidiReactorBase<ClientBidiReactor>(
           io_context,
           remote_node_id,
@@ -40,6 +42,17 @@ RayClientBidiReactor::RayClientBidiReactor(
       cleanup_cb_(std::move(cleanup_cb)),
       stub_(std::move(stub)) {
   client_context_.AddMetadata("node_id", NodeID::FromBinary(local_node_id).Hex());
+  if (RayConfig::instance().syncer_resource_view_delta_updates()) {
+    // Advertise delta support to the server; whether the server supports it
+    // is learned from its initial metadata in OnReadInitialMetadataDone.
+    client_context_.AddMetadata(kResourceViewDeltaMetadataKey, "1");
+  }
+  if (bootstrap_snapshot_id >= 0) {
+    // Tell the server which snapshot seeded our cluster view so it can skip
+    // the covered part of the initial push.
+    client_context_.AddMetadata(kBootstrapSnapshotIdMetadataKey,
+                                std::to_string(bootstrap_snapshot_id));
+  }
   // Add authentication token if token authentication is enabled
   auto auth_token = ray::rpc::AuthenticationTokenLoader::instance().GetToken();
   if (auth_token && !auth_token->empty()) {
@@ -53,6 +66,25 @@ RayClientBidiReactor::RayClientBidiReactor(
   StartPull();
 }
 
+void RayClientBidiReactor::OnReadInitialMetadataDone(bool ok) {
+  if (!ok) {
+    return;
+  }
+  io_context_.dispatch(
+      [this, disconnected = IsDisconnected()]() {
+        if (*disconnected) {
+          return;
+        }
+        if (RayConfig::instance().syncer_resource_view_delta_updates()) {
+          const auto &metadata = client_context_.GetServerInitialMetadata();
+          if (metadata.find(kResourceViewDeltaMetadataKey) != metadata.end()) {
+            MarkPeerAcceptsResourceViewDeltas();
+          }
+        }
+      },
+      "");
+}
+
 void RayClientBidiReactor::OnDone(const grpc::Status &status) {
   io_context_.dispatch(
       [this, status]() {
@@ -37,12 +37,17 @@ class RayClientBidiReactor : public RaySyncerBidiReactorBase<ClientBidiReactor>
       std::function<void(RaySyncerBidiReactor *, bool)> cleanup_cb,
       std::unique_ptr<ray::rpc::syncer::RaySyncer::Stub> stub,
       size_t max_batch_size,
-      uint64_t max_batch_delay_ms);
+      uint64_t max_batch_delay_ms,
+      int64_t bootstrap_snapshot_id = -1);
 
   ~RayClientBidiReactor() override = default;
 
  private:
   void DoDisconnect() override;
+  /// Callback from gRPC, called once the server's initial metadata arrives.
+  /// Used to learn whether the server supports delta-encoded RESOURCE_VIEW
+  /// messages.
+  void OnReadInitialMetadataDone(bool ok) override;
   /// Callback from gRPC
   void OnDone(const grpc::Status &status) override;
 
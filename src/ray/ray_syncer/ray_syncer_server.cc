@@ -17,7 +17,9 @@
 #include <string>
 #include <utility>
 
+#include "absl/strings/numbers.h"
 #include "ray/common/constants.h"
+#include "ray/common/ray_config.h"
 #include "ray/rpc/authentication/authentication_mode.h"
 
 namespace ray::syncer {
@@ -77,6 +79,26 @@ RayServerBidiReactor::RayServerBidiReactor(
 
   // Send the local node id to the remote
   server_context_->AddInitialMetadata("node_id", NodeID::FromBinary(local_node_id).Hex());
+  if (RayConfig::instance().syncer_resource_view_delta_updates()) {
+    // Advertise delta support to the client and check whether the client
+    // advertised it too.
+    server_context_->AddInitialMetadata(kResourceViewDeltaMetadataKey, "1");
+    const auto &metadata = server_context->client_metadata();
+    if (metadata.find(kResourceViewDeltaMetadataKey) != metadata.end()) {
+      MarkPeerAcceptsResourceViewDeltas();
+    }
+  }
+  if (RayConfig::instance().syncer_bootstrap_snapshot()) {
+    const auto &metadata = server_context->client_metadata();
+    if (auto iter = metadata.find(kBootstrapSnapshotIdMetadataKey);
+        iter != metadata.end()) {
+      int64_t snapshot_id = -1;
+      if (absl::SimpleAtoi(absl::string_view(iter->second.data(), iter->second.size()),
+                           &snapshot_id)) {
+        bootstrap_snapshot_id_ = snapshot_id;
+      }
+    }
+  }
   StartSendInitialMetadata();
 
   // Start pulling from remote
@@ -50,6 +50,8 @@ class RayServerBidiReactor : public RaySyncerBidiReactorBase<ServerBidiReactor>
 
   bool IsFinished() const { return finished_.load(); }
 
+  int64_t GetBootstrapSnapshotId() const override { return bootstrap_snapshot_id_; }
+
  private:
   void DoDisconnect() override;
   void OnCancel() override;
@@ -76,6 +78,10 @@ class RayServerBidiReactor : public RaySyncerBidiReactorBase<ServerBidiReactor>
   /// Track if Finish() has been called to avoid using a reactor that is terminating
   std::atomic<bool> finished_{false};
 
+  /// Id of the bootstrap snapshot the client advertised in its metadata, or
+  /// -1 if the client did not bootstrap from a snapshot.
+  int64_t bootstrap_snapshot_id_ = -1;
+
   FRIEND_TEST(SyncerReactorTest, TestReactorFailure);
 };
 
@@ -0,0 +1,102 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/ray_syncer/resource_view_delta.h"
+
+#include <string>
+#include <utility>
+
+namespace ray::syncer {
+
+namespace {
+
+using ray::rpc::syncer::ResourceViewSyncMessage;
+
+/// Fill `changed` with the entries of `current` that are absent from or
+/// different in `base`, and `deleted` with the keys of `base` missing from
+/// `current`.
+template <typename MapType>
+void DiffMap(const MapType &base,
+             const MapType &current,
+             MapType *changed,
+             google::protobuf::RepeatedPtrField<std::string> *deleted) {
+  for (const auto &[key, value] : current) {
+    auto iter = base.find(key);
+    if (iter == base.end() || iter->second != value) {
+      (*changed)[key] = value;
+    }
+  }
+  for (const auto &[key, _] : base) {
+    if (current.find(key) == current.end()) {
+      *deleted->Add() = key;
+    }
+  }
+}
+
+/// Replay a map diff: drop the deleted keys, then overwrite with the changed
+/// entries.
+template <typename MapType>
+void MergeMap(const MapType &changed,
+              const google::protobuf::RepeatedPtrField<std::string> &deleted,
+              MapType *state) {
+  for (const auto &key : deleted) {
+    state->erase(key);
+  }
+  for (const auto &[key, value] : changed) {
+    (*state)[key] = value;
+  }
+}
+
+}  // namespace
+
+ResourceViewSyncMessage ComputeResourceViewDelta(const ResourceViewSyncMessage &base,
+                                                 const ResourceViewSyncMessage &current) {
+  // Start from a full copy so the scalar and repeated fields come along, then
+  // rebuild the map fields as diffs against the base.
+  ResourceViewSyncMessage delta = current;
+  delta.clear_resources_available();
+  delta.clear_resources_total();
+  delta.clear_labels();
+  DiffMap(base.resources_available(),
+          current.resources_available(),
+          delta.mutable_resources_available(),
+          delta.mutable_deleted_resources_available());
+  DiffMap(base.resources_total(),
+          current.resources_total(),
+          delta.mutable_resources_total(),
+          delta.mutable_deleted_resources_total());
+  DiffMap(base.labels(),
+          current.labels(),
+          delta.mutable_labels(),
+          delta.mutable_deleted_labels());
+  return delta;
+}
+
+void ApplyResourceViewDelta(const ResourceViewSyncMessage &delta,
+                            ResourceViewSyncMessage *state) {
+  MergeMap(delta.resources_available(),
+           delta.deleted_resources_available(),
+           state->mutable_resources_available());
+  MergeMap(delta.resources_total(),
+           delta.deleted_resources_total(),
+           state->mutable_resources_total());
+  MergeMap(delta.labels(), delta.deleted_labels(), state->mutable_labels());
+  state->set_object_pulls_queued(delta.object_pulls_queued());
+  state->set_idle_duration_ms(delta.idle_duration_ms());
+  state->set_is_draining(delta.is_draining());
+  state->set_draining_deadline_timestamp_ms(delta.draining_deadline_timestamp_ms());
+  *state->mutable_node_activity() = delta.node_activity();
+}
+
+}  // namespace ray::syncer
@@ -0,0 +1,34 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "src/ray/protobuf/ray_syncer.pb.h"
+
+namespace ray::syncer {
+
+/// Build a delta that transforms `base` into `current`. The returned message
+/// carries only the resources_available/resources_total/labels entries that
+/// were added or changed, records the removed keys in the deleted_* fields,
+/// and copies the scalar and repeated fields in full.
+ray::rpc::syncer::ResourceViewSyncMessage ComputeResourceViewDelta(
+    const ray::rpc::syncer::ResourceViewSyncMessage &base,
+    const ray::rpc::syncer::ResourceViewSyncMessage &current);
+
+/// Apply a delta produced by ComputeResourceViewDelta on top of `state`,
+/// turning it into the full message the delta was computed from.
+void ApplyResourceViewDelta(const ray::rpc::syncer::ResourceViewSyncMessage &delta,
+                            ray::rpc::syncer::ResourceViewSyncMessage *state);
+
+}  // namespace ray::syncer
@@ -33,9 +33,11 @@
 #include <utility>
 #include <vector>
 
+#include "ray/common/ray_config.h"
 #include "ray/common/test_utils.h"
 #include "ray/ray_syncer/node_state.h"
 #include "ray/ray_syncer/ray_syncer.h"
+#include "ray/ray_syncer/resource_view_delta.h"
 #include "ray/ray_syncer/ray_syncer_client.h"
 #include "ray/ray_syncer/ray_syncer_server.h"
 #include "ray/rpc/authentication/authentication_token.h"
@@ -287,6 +289,132 @@ TEST_F(RaySyncerTest, RaySyncerBidiReactorBaseBatchTimeoutTriggerSend) {
   ASSERT_EQ(1, sync_reactor.node_versions_.size());
 }
 
+TEST(ResourceViewDeltaTest, ComputeAndApplyRoundTrip) {
+  ResourceViewSyncMessage base;
+  (*base.mutable_resources_available())["CPU"] = 4;
+  (*base.mutable_resources_available())["GPU"] = 2;
+  (*base.mutable_resources_total())["CPU"] = 8;
+  (*base.mutable_resources_total())["GPU"] = 2;
+  (*base.mutable_labels())["zone"] = "a";
+  base.add_node_activity("busy");
+
+  ResourceViewSyncMessage current = base;
+  (*current.mutable_resources_available())["CPU"] = 1;
+  current.mutable_resources_available()->erase("GPU");
+  (*current.mutable_resources_total())["TPU"] = 4;
+  (*current.mutable_labels())["zone"] = "b";
+  current.set_idle_duration_ms(42);
+  current.clear_node_activity();
+
+  auto delta = ComputeResourceViewDelta(base, current);
+  // Only the changed entries and the removed keys are carried.
+  ASSERT_EQ(delta.resources_available().size(), 1);
+  ASSERT_EQ(delta.resources_available().at("CPU"), 1);
+  ASSERT_EQ(delta.deleted_resources_available().size(), 1);
+  ASSERT_EQ(delta.deleted_resources_available(0), "GPU");
+  ASSERT_EQ(delta.resources_total().size(), 1);
+  ASSERT_EQ(delta.resources_total().at("TPU"), 4);
+  ASSERT_TRUE(delta.deleted_resources_total().empty());
+  ASSERT_EQ(delta.labels().size(), 1);
+  ASSERT_EQ(delta.labels().at("zone"), "b");
+  ASSERT_EQ(delta.idle_duration_ms(), 42);
+
+  // Applying the delta on top of the base yields the current view.
+  ResourceViewSyncMessage state = base;
+  ApplyResourceViewDelta(delta, &state);
+  ASSERT_TRUE(google::protobuf::util::MessageDifferencer::Equals(state, current));
+}
+
+TEST_F(RaySyncerTest, RaySyncerBidiReactorBaseResourceViewDelta) {
+  RayConfig::instance().syncer_resource_view_delta_updates() = true;
+  RayConfig::instance().syncer_resource_view_delta_anchor_interval() = 2;
+
+  auto node_id = NodeID::FromRandom();
+  MockRaySyncerBidiReactorBase<MockReactor> sender(
+      /* io_context */ io_context_,
+      /* remote_node_id */ node_id.Binary(),
+      /* message_processor */
+      [](std::shared_ptr<const ray::rpc::syncer::RaySyncMessage>) {},
+      /* max_batch_size */ 1,
+      /* max_batch_delay_ms */ 0);
+  sender.SetSelfRef(std::shared_ptr<MockRaySyncerBidiReactorBase<MockReactor>>(
+      &sender, [](auto *) {}));
+  sender.MarkPeerAcceptsResourceViewDeltas();
+
+  std::vector<std::shared_ptr<const RaySyncMessage>> received;
+  MockRaySyncerBidiReactorBase<MockReactor> receiver(
+      /* io_context */ io_context_,
+      /* remote_node_id */ NodeID::FromRandom().Binary(),
+      /* message_processor */
+      [&received](std::shared_ptr<const ray::rpc::syncer::RaySyncMessage> msg) {
+        received.push_back(std::move(msg));
+      },
+      /* max_batch_size */ 1,
+      /* max_batch_delay_ms */ 0);
+  receiver.SetSelfRef(std::shared_ptr<MockRaySyncerBidiReactorBase<MockReactor>>(
+      &receiver, [](auto *) {}));
+
+  auto from_node_id = NodeID::FromRandom();
+  ResourceViewSyncMessage view;
+  for (int i = 0; i < 8; ++i) {
+    (*view.mutable_resources_available())["CPU" + std::to_string(i)] = 4;
+    (*view.mutable_resources_total())["CPU" + std::to_string(i)] = 8;
+  }
+  auto make_view_message = [&view, &from_node_id](int64_t version) {
+    auto msg = MakeMessage(MessageType::RESOURCE_VIEW, version, from_node_id);
+    msg.set_sync_message(view.SerializeAsString());
+    return std::make_shared<RaySyncMessage>(msg);
+  };
+  // Hand the batch the sender just wrote over to the receiver.
+  auto deliver = [&sender, &receiver]() {
+    receiver.ReceiveUpdate(
+        std::make_shared<RaySyncMessageBatch>(*sender.sending_message_batch_));
+  };
+
+  // The first message on the stream is always full.
+  ASSERT_TRUE(sender.PushToSendingQueue(make_view_message(1)));
+  ASSERT_FALSE(sender.sending_message_batch_->messages(0).is_delta());
+  deliver();
+
+  // Only one counter changes, so the second message is a delta carrying just
+  // that entry.
+  (*view.mutable_resources_available())["CPU0"] = 1;
+  auto view_v2 = view;
+  ASSERT_TRUE(sender.PushToSendingQueue(make_view_message(2)));
+  sender.SendNext();
+  const auto &delta_msg = sender.sending_message_batch_->messages(0);
+  ASSERT_TRUE(delta_msg.is_delta());
+  ResourceViewSyncMessage delta;
+  ASSERT_TRUE(delta.ParseFromString(delta_msg.sync_message()));
+  ASSERT_EQ(delta.resources_available().size(), 1);
+  ASSERT_EQ(delta.resources_available().at("CPU0"), 1);
+  ASSERT_TRUE(delta.resources_total().empty());
+  deliver();
+
+  // The anchor interval of 2 forces a full message again.
+  (*view.mutable_resources_available())["CPU1"] = 1;
+  auto view_v3 = view;
+  ASSERT_TRUE(sender.PushToSendingQueue(make_view_message(3)));
+  sender.SendNext();
+  ASSERT_FALSE(sender.sending_message_batch_->messages(0).is_delta());
+  deliver();
+
+  // The receiver reconstructed a full payload for every message.
+  ASSERT_EQ(received.size(), 3u);
+  ResourceViewSyncMessage reconstructed_v2;
+  ASSERT_FALSE(received[1]->is_delta());
+  ASSERT_TRUE(reconstructed_v2.ParseFromString(received[1]->sync_message()));
+  ASSERT_TRUE(
+      google::protobuf::util::MessageDifferencer::Equals(reconstructed_v2, view_v2));
+  ResourceViewSyncMessage reconstructed_v3;
+  ASSERT_TRUE(reconstructed_v3.ParseFromString(received[2]->sync_message()));
+  ASSERT_TRUE(
+      google::protobuf::util::MessageDifferencer::Equals(reconstructed_v3, view_v3));
+
+  RayConfig::instance().syncer_resource_view_delta_updates() = false;
+  RayConfig::instance().syncer_resource_view_delta_anchor_interval() = 100;
+}
+
 struct SyncerServerTest {
   explicit SyncerServerTest(std::string port)
       : SyncerServerTest(
@@ -692,6 +820,105 @@ TEST_F(SyncerTest, Reconnect) {
       5));
 }
 
+TEST_F(SyncerTest, AggregationTreeFallback) {
+  // s1 plays the role of the root (GCS), s2 is an aggregator and s3 syncs
+  // through s2. Messages must flow s3 -> s2 -> s1, and when the aggregator
+  // dies s3 must re-parent to the root and keep syncing.
+  auto prev_fallback_attempts =
+      RayConfig::instance().syncer_aggregator_fallback_attempts();
+  RayConfig::instance().syncer_aggregator_fallback_attempts() = 1;
+
+  auto &s1 = MakeServer("19990");
+  auto &s2 = MakeServer("19991");
+  auto &s3 = MakeServer("19992");
+
+  s2.syncer->Connect(s1.syncer->GetLocalNodeID(), MakeChannel("19990"));
+  s3.syncer->Connect(s2.syncer->GetLocalNodeID(),
+                     MakeChannel("19991"),
+                     /*fallback_node_id=*/s1.syncer->GetLocalNodeID(),
+                     /*fallback_channel=*/MakeChannel("19990"));
+
+  // s3's updates reach the root through the aggregator.
+  s3.local_versions[0] = 1;
+  ASSERT_TRUE(s1.WaitUntil(
+      [&s1, node_id = s3.syncer->GetLocalNodeID()]() mutable {
+        return s1.received_versions[node_id][0] == 1;
+      },
+      10));
+
+  // Kill the aggregator. s3 should give up reconnecting to it and re-parent
+  // to the root.
+  s2.Stop();
+  servers.erase(servers.begin() + 1);
+
+  ASSERT_TRUE(s3.WaitUntil(
+      [&s3, node_id = s1.syncer->GetLocalNodeID()]() mutable {
+        return s3.syncer->sync_reactors_.count(node_id) > 0;
+      },
+      30));
+
+  // Syncing continues through the repaired tree.
+  s3.local_versions[0] = 2;
+  ASSERT_TRUE(s1.WaitUntil(
+      [&s1, node_id = s3.syncer->GetLocalNodeID()]() mutable {
+        return s1.received_versions[node_id][0] == 2;
+      },
+      10));
+
+  RayConfig::instance().syncer_aggregator_fallback_attempts() = prev_fallback_attempts;
+}
+
+TEST_F(SyncerTest, BootstrapSnapshot) {
+  // A joining node seeds its cluster view from a snapshot fetched
+  // out-of-band, and the server's initial push skips what the snapshot
+  // covered.
+  RayConfig::instance().syncer_bootstrap_snapshot() = true;
+
+  auto &s1 = MakeServer("19990");
+  auto &s2 = MakeServer("19991");
+  auto &s3 = MakeServer("19992");
+
+  // s2 joins first so s1 has a view worth snapshotting.
+  s2.syncer->Connect(s1.syncer->GetLocalNodeID(), MakeChannel("19990"));
+  ASSERT_TRUE(s1.WaitUntil(
+      [&s1, node_id = s2.syncer->GetLocalNodeID()]() {
+        return s1.GetNumConsumedMessages(node_id) >= 1;
+      },
+      5));
+
+  // s3 joins through the snapshot path.
+  s3.syncer->Connect(s1.syncer->GetLocalNodeID(), MakeChannel("19990"));
+  ASSERT_TRUE(s1.WaitUntil(
+      [&s1]() { return !s1.syncer->served_bootstrap_snapshots_.empty(); }, 5));
+
+  // The cluster still converges: s3 learns about s1 and s2 (the latter only
+  // through the snapshot), and s1 learns about s3 through the stream.
+  ASSERT_TRUE(s3.WaitUntil(
+      [&s1, &s2, &s3]() {
+        return s3.GetReceivedVersions(s1.syncer->GetLocalNodeID())[0] ==
+                   s1.local_versions[0] &&
+               s3.GetReceivedVersions(s2.syncer->GetLocalNodeID())[0] ==
+                   s2.local_versions[0];
+      },
+      5));
+  ASSERT_TRUE(s1.WaitUntil(
+      [&s1, &s3]() {
+        return s1.GetReceivedVersions(s3.syncer->GetLocalNodeID())[0] ==
+               s3.local_versions[0];
+      },
+      5));
+
+  // Updates made after the snapshot was served still reach the joiner.
+  s2.local_versions[0] = 1;
+  ASSERT_TRUE(s3.WaitUntil(
+      [&s2, &s3]() {
+        return s3.GetReceivedVersions(s2.syncer->GetLocalNodeID())[0] == 1;
+      },
+      5));
+
+  RayConfig::instance().syncer_bootstrap_snapshot() = false;
+}
+
 TEST_F(SyncerTest, Broadcast) {
   // This test covers the broadcast feature of ray syncer.
   auto &s1 = MakeServer("19990");
@@ -0,0 +1,250 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/raylet/direct_spill_writer.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "absl/time/clock.h"
+#include "ray/common/ray_config.h"
+#include "ray/util/logging.h"
+#include "ray/util/thread_utils.h"
+
+namespace ray {
+namespace raylet {
+
+namespace {
+
+// Little-endian, matching SpilledObjectReader::ToUINT64 and the Python
+// filesystem storage.
+void AppendUINT64(uint64_t value, std::string *out) {
+  for (size_t i = 0; i < sizeof(uint64_t); i++) {
+    out->push_back(static_cast<char>(value & 0xff));
+    value >>= 8;
+  }
+}
+
+#ifndef _WIN32
+// Writes every iovec fully, advancing through partial writes.
+Status WriteAll(int fd, std::vector<iovec> iovs) {
+  size_t index = 0;
+  while (index < iovs.size()) {
+    const int count =
+        static_cast<int>(std::min<size_t>(iovs.size() - index, IOV_MAX));
+    ssize_t written = writev(fd, iovs.data() + index, count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError(strerror(errno));
+    }
+    size_t remaining = static_cast<size_t>(written);
+    while (index < iovs.size() && remaining >= iovs[index].iov_len) {
+      remaining -= iovs[index].iov_len;
+      index++;
+    }
+    if (index < iovs.size() && remaining > 0) {
+      iovs[index].iov_base = static_cast<char *>(iovs[index].iov_base) + remaining;
+      iovs[index].iov_len -= remaining;
+    }
+  }
+  return Status::OK();
+}
+#endif
+
+}  // namespace
+
+DirectSpillWriter::DirectSpillWriter(std::vector<std::string> directories,
+                                     instrumented_io_context &callback_service)
+    : queue_depth_per_directory_(std::max<int64_t>(
+          1,
+          RayConfig::instance().object_spilling_direct_fs_queue_depth_per_directory())),
+      callback_service_(callback_service) {
+  RAY_CHECK(!directories.empty());
+  lanes_.reserve(directories.size());
+  for (size_t i = 0; i < directories.size(); i++) {
+    auto lane = std::make_unique<Lane>(std::move(directories[i]));
+    lane->write_threads.reserve(queue_depth_per_directory_);
+    for (int64_t j = 0; j < queue_depth_per_directory_; j++) {
+      lane->write_threads.emplace_back([lane = lane.get(), i, j] {
+        SetThreadName(absl::StrFormat("spill.write.%d.%d", i, j));
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work(
+            lane->write_service.get_executor());
+        lane->write_service.run();
+      });
+    }
+    lanes_.push_back(std::move(lane));
+  }
+}
+
+DirectSpillWriter::~DirectSpillWriter() {
+  for (auto &lane : lanes_) {
+    lane->write_service.stop();
+  }
+  for (auto &lane : lanes_) {
+    for (auto &thread : lane->write_threads) {
+      thread.join();
+    }
+  }
+}
+
+void DirectSpillWriter::SpillObjects(std::vector<SpillRequest> requests,
+                                     SpillCallback callback) {
+  // Pick the directory with the fewest writes in flight, rotating the
+  // starting point so equally loaded devices alternate.
+  size_t best = next_lane_index_;
+  int64_t best_depth = lanes_[best]->num_in_flight.load(std::memory_order_relaxed);
+  for (size_t offset = 1; offset < lanes_.size() && best_depth > 0; offset++) {
+    const size_t index = (next_lane_index_ + offset) % lanes_.size();
+    const int64_t depth = lanes_[index]->num_in_flight.load(std::memory_order_relaxed);
+    if (depth < best_depth) {
+      best = index;
+      best_depth = depth;
+    }
+  }
+  next_lane_index_ = (next_lane_index_ + 1) % lanes_.size();
+
+  Lane *lane = lanes_[best].get();
+  lane->num_in_flight.fetch_add(1, std::memory_order_relaxed);
+  lane->write_service.post(
+      [this,
+       lane,
+       requests = std::move(requests),
+       callback = std::move(callback)]() mutable {
+        std::vector<std::string> urls;
+        const int64_t start_time = absl::GetCurrentTimeNanos();
+        Status status = WriteBatch(lane->directory, requests, &urls);
+        if (status.ok()) {
+          int64_t written_bytes = 0;
+          for (const auto &request : requests) {
+            written_bytes += request.object->GetSize();
+          }
+          lane->written_bytes_total.fetch_add(written_bytes, std::memory_order_relaxed);
+          lane->write_time_total_ns.fetch_add(absl::GetCurrentTimeNanos() - start_time,
+                                              std::memory_order_relaxed);
+        }
+        lane->num_in_flight.fetch_sub(1, std::memory_order_relaxed);
+        callback_service_.post(
+            [status = std::move(status),
+             urls = std::move(urls),
+             callback = std::move(callback)]() mutable {
+              callback(status, std::move(urls));
+            },
+            "DirectSpillWriter.SpillCallback");
+      },
+      "DirectSpillWriter.SpillObjects");
+}
+
+bool DirectSpillWriter::HasCapacity() const {
+  for (const auto &lane : lanes_) {
+    if (lane->num_in_flight.load(std::memory_order_relaxed) <
+        queue_depth_per_directory_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<DirectSpillWriter::DeviceStats> DirectSpillWriter::GetDeviceStats() const {
+  std::vector<DeviceStats> stats;
+  stats.reserve(lanes_.size());
+  for (const auto &lane : lanes_) {
+    DeviceStats device_stats;
+    device_stats.directory = lane->directory;
+    device_stats.num_in_flight_writes =
+        lane->num_in_flight.load(std::memory_order_relaxed);
+    device_stats.written_bytes_total =
+        lane->written_bytes_total.load(std::memory_order_relaxed);
+    device_stats.write_time_total_s =
+        lane->write_time_total_ns.load(std::memory_order_relaxed) / 1e9;
+    stats.push_back(std::move(device_stats));
+  }
+  return stats;
+}
+
+Status DirectSpillWriter::WriteBatch(const std::string &directory,
+                                     const std::vector<SpillRequest> &requests,
+                                     std::vector<std::string> *urls) {
+#ifdef _WIN32
+  return Status::NotImplemented("Direct spilling is not supported on Windows.");
+#else
+  const std::string file_path = absl::StrFormat(
+      "%s/ray_spilled_object-%s", directory, UniqueID::FromRandom().Hex());
+
+  int fd = open(file_path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+  if (fd < 0) {
+    return Status::IOError(absl::StrFormat(
+        "Failed to open spill file %s: %s", file_path, strerror(errno)));
+  }
+
+  // Each record is [owner address size][metadata size][data size]
+  // [owner address][metadata][data]; the payload iovecs point straight into
+  // the plasma mmap, so the object bytes are never copied.
+  std::vector<std::string> headers;
+  headers.reserve(requests.size());
+  std::vector<std::shared_ptr<Buffer>> data_refs;
+  data_refs.reserve(requests.size());
+  std::vector<iovec> iovs;
+  uint64_t offset = 0;
+  for (const auto &request : requests) {
+    const std::string owner = request.owner_address.SerializeAsString();
+    data_refs.push_back(request.object->GetData());
+    const auto &data = data_refs.back();
+    const auto &metadata = request.object->GetMetadata();
+    const uint64_t data_size = data != nullptr ? data->Size() : 0;
+    const uint64_t metadata_size = metadata != nullptr ? metadata->Size() : 0;
+
+    std::string header;
+    AppendUINT64(owner.size(), &header);
+    AppendUINT64(metadata_size, &header);
+    AppendUINT64(data_size, &header);
+    header += owner;
+    headers.push_back(std::move(header));
+    iovs.push_back({headers.back().data(), headers.back().size()});
+    if (metadata_size > 0) {
+      iovs.push_back({metadata->Data(), metadata_size});
+    }
+    if (data_size > 0) {
+      iovs.push_back({data->Data(), data_size});
+    }
+
+    const uint64_t record_size = headers.back().size() + metadata_size + data_size;
+    urls->push_back(absl::StrFormat("%s?offset=%d&size=%d", file_path, offset, record_size));
+    offset += record_size;
+  }
+
+  Status status = WriteAll(fd, std::move(iovs));
+  close(fd);
+  if (!status.ok()) {
+    urls->clear();
+    unlink(file_path.c_str());
+    return status;
+  }
+  return Status::OK();
+#endif
+}
+
+}  // namespace raylet
+}  // namespace ray
@@ -0,0 +1,124 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/id.h"
+#include "ray/common/ray_object.h"
+#include "ray/common/status.h"
+#include "src/ray/protobuf/common.pb.h"
+
+namespace ray {
+namespace raylet {
+
+/// Writes sealed plasma objects straight from their shared-memory mapping to
+/// local spill files, bypassing the Python spill worker for the
+/// filesystem-storage case. The object payload is handed to pwritev directly
+/// from the plasma mmap, so the bytes are never copied into another address
+/// space. Files use the same on-disk layout and offset/size URL format as the
+/// Python filesystem storage, so the existing restore and delete paths work
+/// on them unchanged.
+///
+/// Each spill directory gets its own write lane — an io_context with
+/// object_spilling_direct_fs_queue_depth_per_directory threads — so batches
+/// stripe across the backing devices and a single slow device does not stall
+/// the others. Completion callbacks are posted back to the io_context the
+/// raylet handed in.
+class DirectSpillWriter {
+ public:
+  struct SpillRequest {
+    ObjectID object_id;
+    rpc::Address owner_address;
+    /// The pinned object. The caller must keep it alive until the spill
+    /// callback fires.
+    const RayObject *object = nullptr;
+  };
+
+  /// Called with the spill result. On success urls[i] is the spilled URL of
+  /// requests[i]; on failure urls is empty and none of the objects should be
+  /// considered spilled.
+  using SpillCallback = std::function<void(Status, std::vector<std::string> urls)>;
+
+  /// Per-directory counters, exposed through LocalObjectManager::RecordMetrics
+  /// so device saturation is visible. Totals are cumulative since startup.
+  struct DeviceStats {
+    std::string directory;
+    int64_t num_in_flight_writes = 0;
+    int64_t written_bytes_total = 0;
+    double write_time_total_s = 0;
+  };
+
+  /// \param directories The spill directories. Each directory gets its own
+  /// write lane.
+  /// \param callback_service The io_context to post completion callbacks to.
+  DirectSpillWriter(std::vector<std::string> directories,
+                    instrumented_io_context &callback_service);
+
+  ~DirectSpillWriter();
+
+  /// Write a batch of objects into one spill file, fused like the Python
+  /// storage does. The batch goes to the directory with the fewest writes in
+  /// flight; ties rotate round-robin so equally idle devices all get traffic.
+  void SpillObjects(std::vector<SpillRequest> requests, SpillCallback callback);
+
+  /// Whether some directory is below its in-flight depth target. Callers use
+  /// this to throttle spill submissions once every device is saturated.
+  bool HasCapacity() const;
+
+  /// Snapshot the per-directory counters.
+  std::vector<DeviceStats> GetDeviceStats() const;
+
+ private:
+  /// The write lane for one spill directory: the threads doing the blocking
+  /// writes plus the counters describing the device's load.
+  struct Lane {
+    explicit Lane(std::string directory_arg) : directory(std::move(directory_arg)) {}
+
+    const std::string directory;
+    /// Runs the blocking file writes for this directory.
+    instrumented_io_context write_service;
+    std::vector<std::thread> write_threads;
+    /// Batches submitted but not yet written, including ones still queued
+    /// behind a busy thread.
+    std::atomic<int64_t> num_in_flight{0};
+    std::atomic<int64_t> written_bytes_total{0};
+    std::atomic<int64_t> write_time_total_ns{0};
+  };
+
+  /// Writes the batch synchronously into `directory`. On success fills urls;
+  /// on failure the partially written file is removed.
+  Status WriteBatch(const std::string &directory,
+                    const std::vector<SpillRequest> &requests,
+                    std::vector<std::string> *urls);
+
+  /// The in-flight depth target per directory, from
+  /// object_spilling_direct_fs_queue_depth_per_directory.
+  const int64_t queue_depth_per_directory_;
+
+  std::vector<std::unique_ptr<Lane>> lanes_;
+  size_t next_lane_index_ = 0;
+
+  instrumented_io_context &callback_service_;
+};
+
+}  // namespace raylet
+}  // namespace ray
@@ -248,9 +248,40 @@ bool LeaseDependencyManager::RequestLeaseDependencies(
                    << " request: " << lease_entry->pull_request_id_;
   }
 
+  // The real pull above subsumes any speculative prefetch issued while the
+  // lease was still queued for scheduling. Cancel the prefetch after starting
+  // the real pull so objects already in flight stay active.
+  CancelPrefetchLeaseDependencies(lease_id);
+
   return lease_entry->num_missing_dependencies_ == 0;
 }
 
+void LeaseDependencyManager::PrefetchLeaseDependencies(
+    const LeaseID &lease_id, const std::vector<rpc::ObjectReference> &required_objects) {
+  if (required_objects.empty() || queued_lease_requests_.contains(lease_id) ||
+      prefetch_pull_requests_.contains(lease_id)) {
+    return;
+  }
+  // Use an empty task key so the speculative pull is not reported as a
+  // waiting task by the pull manager's per-task metrics.
+  auto pull_request_id =
+      object_manager_.Pull(required_objects, BundlePriority::TASK_ARGS, {"", false});
+  RAY_LOG(DEBUG) << "Started prefetch for dependencies of queued lease " << lease_id
+                 << " request: " << pull_request_id;
+  prefetch_pull_requests_.emplace(lease_id, pull_request_id);
+}
+
+void LeaseDependencyManager::CancelPrefetchLeaseDependencies(const LeaseID &lease_id) {
+  auto it = prefetch_pull_requests_.find(lease_id);
+  if (it == prefetch_pull_requests_.end()) {
+    return;
+  }
+  RAY_LOG(DEBUG) << "Canceling prefetch for dependencies of lease " << lease_id
+                 << " request: " << it->second;
+  object_manager_.CancelPull(it->second);
+  prefetch_pull_requests_.erase(it);
+}
+
 void LeaseDependencyManager::RemoveLeaseDependencies(const LeaseID &lease_id) {
   RAY_LOG(DEBUG) << "Removing dependencies for lease " << lease_id;
   auto lease_entry = queued_lease_requests_.find(lease_id);
@@ -306,25 +337,27 @@ std::vector<LeaseID> LeaseDependencyManager::HandleObjectMissing(
 
 std::vector<LeaseID> LeaseDependencyManager::HandleObjectLocal(
     const ray::ObjectID &object_id) {
-  // Add the object to the table of locally available objects.
-  auto inserted = local_objects_.insert(object_id);
-  RAY_CHECK(inserted.second) << "Local object was already local " << object_id;
+  return HandleObjectsLocal({object_id});
+}
 
-  // Find all leases and workers that depend on the newly available object.
-  std::vector<LeaseID> ready_lease_ids;
-  auto object_entry = required_objects_.find(object_id);
-  if (object_entry != required_objects_.end()) {
-    // Loop through all leases that depend on the newly available object.
+std::vector<LeaseID> LeaseDependencyManager::HandleObjectsLocal(
+    const std::vector<ray::ObjectID> &object_ids) {
+  // Add the objects to the table of locally available objects.
+  for (const auto &object_id : object_ids) {
+    auto inserted = local_objects_.insert(object_id);
+    RAY_CHECK(inserted.second) << "Local object was already local " << object_id;
+  }
+
+  // Aggregate one ready-count update per dependent lease, so a lease waiting
+  // on several objects of the batch is looked up and decremented only once.
+  absl::flat_hash_map<LeaseID, size_t> num_newly_local_deps;
+  for (const auto &object_id : object_ids) {
+    auto object_entry = required_objects_.find(object_id);
+    if (object_entry == required_objects_.end()) {
+      continue;
+    }
     for (const auto &dependent_lease_id : object_entry->second.dependent_leases) {
-      auto it = queued_lease_requests_.find(dependent_lease_id);
-      RAY_CHECK(it != queued_lease_requests_.end());
-      auto &lease_entry = it->second;
-      lease_entry->DecrementMissingDependencies();
-      // If the dependent lease now has all of its arguments ready, it's ready
-      // to run.
-      if (lease_entry->num_missing_dependencies_ == 0) {
-        ready_lease_ids.push_back(dependent_lease_id);
-      }
+      num_newly_local_deps[dependent_lease_id]++;
     }
 
     // Remove the dependency from all workers that called `ray.wait` on the
@@ -349,6 +382,19 @@ std::vector<LeaseID> LeaseDependencyManager::HandleObjectLocal(
     RemoveObjectIfNotNeeded(object_entry);
   }
 
+  // Apply the aggregated ready counts and collect all leases that now have
+  // all of their arguments ready into one batch.
+  std::vector<LeaseID> ready_lease_ids;
+  for (const auto &[dependent_lease_id, num_local] : num_newly_local_deps) {
+    auto it = queued_lease_requests_.find(dependent_lease_id);
+    RAY_CHECK(it != queued_lease_requests_.end());
+    auto &lease_entry = it->second;
+    lease_entry->DecrementMissingDependencies(num_local);
+    if (lease_entry->num_missing_dependencies_ == 0) {
+      ready_lease_ids.push_back(dependent_lease_id);
+    }
+  }
+
   return ready_lease_ids;
 }
 
@@ -45,6 +45,10 @@ class LeaseDependencyManagerInterface {
       const std::vector<rpc::ObjectReference> &required_objects,
       const TaskMetricsKey &lease_key) = 0;
   virtual void RemoveLeaseDependencies(const LeaseID &lease_id) = 0;
+  virtual void PrefetchLeaseDependencies(
+      const LeaseID &lease_id,
+      const std::vector<rpc::ObjectReference> &required_objects) = 0;
+  virtual void CancelPrefetchLeaseDependencies(const LeaseID &lease_id) = 0;
   virtual bool LeaseDependenciesBlocked(const LeaseID &lease_id) const = 0;
   virtual bool CheckObjectLocal(const ObjectID &object_id) const = 0;
   virtual ~LeaseDependencyManagerInterface() = default;
@@ -180,6 +184,26 @@ class LeaseDependencyManager : public LeaseDependencyManagerInterface {
   /// \param required_objects The objects required by the lease.
   void RemoveLeaseDependencies(const LeaseID &lease_id) override;
 
+  /// Speculatively fetch the dependencies of a lease that is still queued for
+  /// scheduling and may never run on this node. The pull is issued at the
+  /// same priority as regular argument fetches, so it is only activated when
+  /// the pull manager has memory headroom, and it does not count towards the
+  /// lease's dependency tracking. The prefetch is subsumed once
+  /// `RequestLeaseDependencies` is called for the lease, and must otherwise be
+  /// cancelled with `CancelPrefetchLeaseDependencies`.
+  ///
+  /// \param lease_id The lease that may require the objects.
+  /// \param required_objects The objects required by the lease.
+  void PrefetchLeaseDependencies(
+      const LeaseID &lease_id,
+      const std::vector<rpc::ObjectReference> &required_objects) override;
+
+  /// Cancel a lease's speculative prefetch, if one is active. Objects are no
+  /// longer fetched if no other lease or worker requires them.
+  ///
+  /// \param lease_id The lease whose prefetch should be cancelled.
+  void CancelPrefetchLeaseDependencies(const LeaseID &lease_id) override;
+
   /// Handle an object becoming locally available.
   ///
   /// \param object_id The object ID of the object to mark as locally
@@ -188,6 +212,17 @@ class LeaseDependencyManager : public LeaseDependencyManagerInterface {
   /// all of their dependencies fulfilled.
   std::vector<LeaseID> HandleObjectLocal(const ray::ObjectID &object_id);
 
+  /// Batch form of HandleObjectLocal. The ready count of each dependent lease
+  /// is updated once per batch with the aggregate number of its dependencies
+  /// that arrived, so a lease waiting on several objects of the batch is
+  /// looked up once, and all newly ready leases are emitted as one batch.
+  ///
+  /// \param object_ids The object IDs of the objects to mark as locally
+  /// available.
+  /// \return A list of lease IDs. This contains all granted leases that now have
+  /// all of their dependencies fulfilled.
+  std::vector<LeaseID> HandleObjectsLocal(const std::vector<ray::ObjectID> &object_ids);
+
   /// Handle an object that is no longer locally available.
   ///
   /// \param object_id The object ID of the object that was previously locally
@@ -272,8 +307,9 @@ class LeaseDependencyManager : public LeaseDependencyManagerInterface {
       num_missing_dependencies_++;
     }
 
-    void DecrementMissingDependencies() {
-      num_missing_dependencies_--;
+    void DecrementMissingDependencies(size_t num_newly_local = 1) {
+      RAY_CHECK_LE(num_newly_local, num_missing_dependencies_);
+      num_missing_dependencies_ -= num_newly_local;
       if (num_missing_dependencies_ == 0) {
         waiting_task_counter_map_.Decrement(task_key_);
       }
@@ -305,6 +341,10 @@ class LeaseDependencyManager : public LeaseDependencyManagerInterface {
   /// dependencies are all local or not.
   absl::flat_hash_map<LeaseID, std::unique_ptr<LeaseDependencies>> queued_lease_requests_;
 
+  /// A map from the ID of a lease whose dependencies are being speculatively
+  /// prefetched to the pull request ID for the prefetch.
+  absl::flat_hash_map<LeaseID, PullRequestId> prefetch_pull_requests_;
+
   // Maps a GetRequest to the PullRequest Id and the set of ObjectIDs.
   // Used to cleanup a finished or cancel an inflight get request.
   // TODO(57911): This can be slimmed down. We do not need to track the ObjectIDs.
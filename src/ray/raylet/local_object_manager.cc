@@ -177,7 +177,11 @@ void LocalObjectManager::SpillObjectUptoMaxThroughput() {
     if (!TryToSpillObjects()) {
       break;
     }
-    can_spill_more = num_active_workers_ < max_active_workers_;
+    // The direct writer throttles on per-directory queue depth; the IO worker
+    // path on the number of spill workers.
+    can_spill_more = direct_spill_writer_ != nullptr
+                         ? direct_spill_writer_->HasCapacity()
+                         : num_active_workers_ < max_active_workers_;
   }
 }
 
@@ -192,26 +196,41 @@ bool LocalObjectManager::TryToSpillObjects() {
   std::vector<ObjectID> objects_to_spill;
   int64_t num_to_spill = 0;
   size_t idx = 0;
-  for (const auto &[object_id, ray_object] : pinned_objects_) {
-    if (is_plasma_object_spillable_(object_id)) {
-      const int64_t object_size = ray_object->GetSize();
-
-      // If the max file size limit is enabled, avoid fusing more objects once we'd exceed
-      // it. Always allow spilling at least one object, even if it's larger than the
-      // limit.
-      if (max_spilling_file_size_bytes_ > 0 && !objects_to_spill.empty() &&
-          bytes_to_spill + object_size > max_spilling_file_size_bytes_) {
-        break;
-      }
+  auto select_objects = [&](bool skip_recently_restored) {
+    bytes_to_spill = 0;
+    objects_to_spill.clear();
+    num_to_spill = 0;
+    idx = 0;
+    for (const auto &[object_id, ray_object] : pinned_objects_) {
+      if (is_plasma_object_spillable_(object_id) &&
+          !(skip_recently_restored && IsObjectRecentlyRestored(object_id))) {
+        const int64_t object_size = ray_object->GetSize();
+
+        // If the max file size limit is enabled, avoid fusing more objects once we'd
+        // exceed it. Always allow spilling at least one object, even if it's larger than
+        // the limit.
+        if (max_spilling_file_size_bytes_ > 0 && !objects_to_spill.empty() &&
+            bytes_to_spill + object_size > max_spilling_file_size_bytes_) {
+          break;
+        }
 
-      bytes_to_spill += object_size;
-      objects_to_spill.push_back(object_id);
-      ++num_to_spill;
-      if (num_to_spill == max_fused_object_count_) {
-        break;
+        bytes_to_spill += object_size;
+        objects_to_spill.push_back(object_id);
+        ++num_to_spill;
+        if (num_to_spill == max_fused_object_count_) {
+          break;
+        }
       }
+      ++idx;
     }
-    ++idx;
+  };
+  const bool restored_backoff_enabled =
+      RayConfig::instance().object_spilling_restored_object_backoff_s() > 0;
+  select_objects(restored_backoff_enabled);
+  if (objects_to_spill.empty() && restored_backoff_enabled) {
+    // Every spillable object was restored within the backoff window. Spill
+    // them anyway rather than making no progress under memory pressure.
+    select_objects(/*skip_recently_restored=*/false);
   }
   if (objects_to_spill.empty()) {
     return false;
@@ -274,6 +293,20 @@ bool LocalObjectManager::TryToSpillObjects() {
   return true;
 }
 
+bool LocalObjectManager::IsObjectRecentlyRestored(const ObjectID &object_id) {
+  auto it = recently_restored_objects_.find(object_id);
+  if (it == recently_restored_objects_.end()) {
+    return false;
+  }
+  const int64_t backoff_ns =
+      RayConfig::instance().object_spilling_restored_object_backoff_s() * 1000000000;
+  if (absl::GetCurrentTimeNanos() - it->second >= backoff_ns) {
+    recently_restored_objects_.erase(it);
+    return false;
+  }
+  return true;
+}
+
 void LocalObjectManager::SpillObjects(const std::vector<ObjectID> &object_ids,
                                       std::function<void(const ray::Status &)> callback) {
   SpillObjectsInternal(object_ids, std::move(callback));
@@ -323,6 +356,18 @@ void LocalObjectManager::SpillObjectsInternal(
     }
     return;
   }
+
+  if (direct_spill_writer_ != nullptr) {
+    SpillObjectsDirect(objects_to_spill, std::move(callback));
+    // Deleting spilled objects can fall behind when there is a lot
+    // of concurrent spilling and object frees. Clear the queue here
+    // if needed.
+    if (spilled_object_pending_delete_.size() >= free_objects_batch_size_) {
+      ProcessSpilledObjectsDeleteQueue(free_objects_batch_size_);
+    }
+    return;
+  }
+
   num_active_workers_ += 1;
   io_worker_pool_.PopSpillWorker([this, objects_to_spill, callback = std::move(callback)](
                                      std::shared_ptr<WorkerInterface> io_worker) mutable {
@@ -396,6 +441,72 @@ void LocalObjectManager::SpillObjectsInternal(
   }
 }
 
+void LocalObjectManager::SpillObjectsDirect(
+    const std::vector<ObjectID> &objects_to_spill,
+    std::function<void(const ray::Status &)> callback) {
+  std::vector<DirectSpillWriter::SpillRequest> requests;
+  std::vector<ObjectID> requested_objects_to_spill;
+  for (const auto &object_id : objects_to_spill) {
+    auto it = objects_pending_spill_.find(object_id);
+    RAY_CHECK(it != objects_pending_spill_.end());
+    auto freed_it = local_objects_.find(object_id);
+    // If the object hasn't already been freed, spill it.
+    if (freed_it == local_objects_.end() || freed_it->second.is_freed_) {
+      num_bytes_pending_spill_ -= it->second->GetSize();
+      objects_pending_spill_.erase(it);
+    } else {
+      RAY_LOG(DEBUG) << "Writing spill file for object " << object_id;
+      requests.push_back(DirectSpillWriter::SpillRequest{
+          object_id, freed_it->second.owner_address_, it->second.get()});
+      requested_objects_to_spill.push_back(object_id);
+    }
+  }
+
+  if (requests.empty()) {
+    if (callback) {
+      callback(Status::OK());
+    }
+    return;
+  }
+
+  // Count the in-flight write against the spill concurrency limit like a
+  // spill worker, so TryToSpillObjects keeps throttling correctly.
+  num_active_workers_ += 1;
+  direct_spill_writer_->SpillObjects(
+      std::move(requests),
+      [this,
+       requested_objects_to_spill = std::move(requested_objects_to_spill),
+       callback = std::move(callback)](const Status &status,
+                                       std::vector<std::string> urls) {
+        num_active_workers_ -= 1;
+        size_t num_objects_spilled = status.ok() ? urls.size() : 0;
+        RAY_CHECK(num_objects_spilled <= requested_objects_to_spill.size());
+        for (size_t i = num_objects_spilled; i != requested_objects_to_spill.size();
+             ++i) {
+          const auto &object_id = requested_objects_to_spill[i];
+          auto it = objects_pending_spill_.find(object_id);
+          RAY_CHECK(it != objects_pending_spill_.end());
+          pinned_objects_size_ += it->second->GetSize();
+          num_bytes_pending_spill_ -= it->second->GetSize();
+          pinned_objects_.emplace(object_id, std::move(it->second));
+          objects_pending_spill_.erase(it);
+        }
+
+        if (!status.ok()) {
+          RAY_LOG(ERROR) << "Failed to write spill file: " << status.ToString();
+        } else {
+          rpc::SpillObjectsReply reply;
+          for (auto &url : urls) {
+            reply.add_spilled_objects_url(std::move(url));
+          }
+          OnObjectSpilled(requested_objects_to_spill, reply);
+        }
+        if (callback) {
+          callback(status);
+        }
+      });
+}
+
 void LocalObjectManager::OnObjectSpilled(const std::vector<ObjectID> &object_ids,
                                          const rpc::SpillObjectsReply &worker_reply) {
   for (size_t i = 0; i < static_cast<size_t>(worker_reply.spilled_objects_url_size());
@@ -416,6 +527,9 @@ void LocalObjectManager::OnObjectSpilled(const std::vector<ObjectID> &object_ids
 
     // Mark that the object is spilled and unpin the pending requests.
     spilled_objects_url_.emplace(object_id, object_url);
+    if (spill_manifest_ != nullptr) {
+      spill_manifest_->AppendSpilled(object_id, object_url);
+    }
     RAY_LOG(DEBUG) << "Unpinning pending spill object " << object_id;
     auto it = objects_pending_spill_.find(object_id);
     RAY_CHECK(it != objects_pending_spill_.end());
@@ -445,6 +559,9 @@ void LocalObjectManager::OnObjectSpilled(const std::vector<ObjectID> &object_ids
         freed_it->second.generator_id_.value_or(ObjectID::Nil()),
         is_external_storage_type_fs_);
   }
+  if (spill_manifest_ != nullptr) {
+    spill_manifest_->Flush();
+  }
 }
 
 std::string LocalObjectManager::GetLocalSpilledObjectURL(const ObjectID &object_id) {
@@ -474,6 +591,37 @@ void LocalObjectManager::AsyncRestoreSpilledObject(
   RAY_CHECK(objects_pending_restore_.emplace(object_id).second)
       << "Object dedupe wasn't done properly. Please report if you see this issue.";
   num_bytes_pending_restore_ += object_size;
+
+  if (store_client_ != nullptr && is_external_storage_type_fs_) {
+    // Ask the store to map the spill file region directly instead of copying the
+    // bytes back through an IO worker. On failure (e.g. the spill file was
+    // deleted), fall through to the IO worker restore path.
+    auto start_time = absl::GetCurrentTimeNanos();
+    auto status = store_client_->RestoreSpilledObject(object_id, object_url);
+    if (status.ok()) {
+      num_bytes_pending_restore_ -= object_size;
+      objects_pending_restore_.erase(object_id);
+      auto now = absl::GetCurrentTimeNanos();
+      RAY_LOG(DEBUG) << "Restored " << object_size << " from the spill file mapping in "
+                     << (now - start_time) / 1e6 << "ms. Object id:" << object_id;
+      restored_bytes_total_ += object_size;
+      restored_objects_total_ += 1;
+      restore_time_total_s_ += (now - std::max(start_time, last_restore_finish_ns_)) / 1e9;
+      last_restore_finish_ns_ = now;
+      if (RayConfig::instance().object_spilling_restored_object_backoff_s() > 0) {
+        recently_restored_objects_[object_id] = now;
+      }
+      if (callback) {
+        callback(status);
+      }
+      return;
+    }
+    RAY_LOG(WARNING) << "Failed to restore object " << object_id
+                     << " from the spill file mapping, falling back to the IO worker "
+                        "restore path: "
+                     << status.ToString();
+  }
+
   io_worker_pool_.PopRestoreWorker([this, object_id, object_size, object_url, callback](
                                        std::shared_ptr<WorkerInterface> io_worker) {
     auto start_time = absl::GetCurrentTimeNanos();
@@ -512,6 +660,9 @@ void LocalObjectManager::AsyncRestoreSpilledObject(
                             << " MiB/s";
             }
             last_restore_finish_ns_ = now;
+            if (RayConfig::instance().object_spilling_restored_object_backoff_s() > 0) {
+              recently_restored_objects_[object_id] = now;
+            }
           }
           if (callback) {
             callback(status);
@@ -558,6 +709,9 @@ void LocalObjectManager::ProcessSpilledObjectsDeleteQueue(uint32_t max_batch_siz
         object_urls_to_delete.emplace_back(object_url);
       }
       spilled_objects_url_.erase(spilled_objects_url_it);
+      if (spill_manifest_ != nullptr) {
+        spill_manifest_->AppendDeleted(object_id);
+      }
 
       // Update current spilled objects metrics
       RAY_CHECK(local_objects_.contains(object_id))
@@ -571,6 +725,9 @@ void LocalObjectManager::ProcessSpilledObjectsDeleteQueue(uint32_t max_batch_siz
     local_objects_.erase(object_id);
     spilled_object_pending_delete_.pop();
   }
+  if (spill_manifest_ != nullptr) {
+    spill_manifest_->Flush();
+  }
   if (!object_urls_to_delete.empty()) {
     DeleteSpilledObjects(std::move(object_urls_to_delete));
   }
@@ -659,6 +816,18 @@ void LocalObjectManager::RecordMetrics() const {
   spill_manager_metrics_.spill_manager_request_total_gauge.Record(restored_objects_total_,
                                                                   {{"Type", "Restored"}});
 
+  if (direct_spill_writer_ != nullptr) {
+    for (const auto &device_stats : direct_spill_writer_->GetDeviceStats()) {
+      if (device_stats.written_bytes_total != 0 &&
+          device_stats.write_time_total_s != 0) {
+        spill_manager_metrics_.spill_manager_throughput_mb_gauge.Record(
+            device_stats.written_bytes_total / 1024 / 1024 /
+                device_stats.write_time_total_s,
+            {{"Type", "DirectWrite"}, {"Device", device_stats.directory}});
+      }
+    }
+  }
+
   object_store_memory_gauge_.Record(spilled_bytes_current_,
                                     {{stats::LocationKey, "SPILLED"}});
 
@@ -22,16 +22,21 @@
 #include <vector>
 
 #include "absl/strings/str_format.h"
+#include "ray/common/file_system_monitor.h"
 #include "ray/common/id.h"
 #include "ray/common/ray_object.h"
 #include "ray/core_worker_rpc_client/core_worker_client_pool.h"
 #include "ray/object_manager/object_directory.h"
+#include "ray/object_manager/plasma/client.h"
 #include "ray/observability/metric_interface.h"
 #include "ray/pubsub/subscriber_interface.h"
+#include "ray/raylet/direct_spill_writer.h"
 #include "ray/raylet/local_object_manager_interface.h"
 #include "ray/raylet/metrics.h"
+#include "ray/raylet/spill_manifest.h"
 #include "ray/raylet/worker_pool.h"
 #include "ray/util/logging.h"
+#include "ray/util/network_util.h"
 #include "ray/util/time.h"
 
 namespace ray {
@@ -62,7 +67,8 @@ class LocalObjectManager : public LocalObjectManagerInterface {
       pubsub::SubscriberInterface *core_worker_subscriber,
       IObjectDirectory *object_directory,
       ray::observability::MetricInterface &object_store_memory_gauge,
-      ray::raylet::SpillManagerMetrics &spill_manager_metrics)
+      ray::raylet::SpillManagerMetrics &spill_manager_metrics,
+      std::shared_ptr<plasma::PlasmaClientInterface> store_client = nullptr)
       : self_node_id_(node_id),
         self_node_address_(std::move(self_node_address)),
         self_node_port_(self_node_port),
@@ -85,7 +91,8 @@ class LocalObjectManager : public LocalObjectManagerInterface {
         core_worker_subscriber_(core_worker_subscriber),
         object_directory_(object_directory),
         object_store_memory_gauge_(object_store_memory_gauge),
-        spill_manager_metrics_(spill_manager_metrics) {
+        spill_manager_metrics_(spill_manager_metrics),
+        store_client_(std::move(store_client)) {
     if (max_spilling_file_size_bytes_ > 0) {
       RAY_CHECK_GE(max_spilling_file_size_bytes_, min_spilling_size_) << absl::StrFormat(
           "Misconfiguration: max_spilling_file_size_bytes (%lld) must be >= "
@@ -107,6 +114,66 @@ class LocalObjectManager : public LocalObjectManagerInterface {
         max_spilling_file_size_bytes_str,
         static_cast<long long>(max_fused_object_count_),
         static_cast<long long>(max_active_workers_));
+
+    if (is_external_storage_type_fs_ &&
+        RayConfig::instance().object_spilling_direct_fs_write()) {
+      auto spilling_paths =
+          ParseSpillingPaths(RayConfig::instance().object_spilling_config());
+      if (!spilling_paths.empty()) {
+        direct_spill_writer_ =
+            std::make_unique<DirectSpillWriter>(std::move(spilling_paths), io_service_);
+        RAY_LOG(INFO) << "Spilling to filesystem storage directly from the plasma "
+                         "mapping, bypassing the IO workers.";
+      }
+    }
+
+    if (is_external_storage_type_fs_ &&
+        RayConfig::instance().object_spilling_manifest_enabled()) {
+      auto spilling_paths =
+          ParseSpillingPaths(RayConfig::instance().object_spilling_config());
+      if (!spilling_paths.empty()) {
+        spill_manifest_ = std::make_unique<SpillManifest>(spilling_paths[0] +
+                                                          "/ray_spill_manifest");
+        // Replay the mapping spilled by a previous raylet on this node so its
+        // objects stay restorable and their files eventually deletable.
+        for (auto &entry : spill_manifest_->RecoverAndOpen()) {
+          auto parsed_url = ParseURL(entry.second);
+          const auto base_url_it = parsed_url->find("url");
+          if (base_url_it == parsed_url->end()) {
+            continue;
+          }
+          url_ref_count_[base_url_it->second] += 1;
+          spilled_objects_url_.emplace(entry.first, std::move(entry.second));
+        }
+      }
+    }
+
+    if (RayConfig::instance().dynamic_config_enabled()) {
+      // Re-read the spill batching threshold when it is tuned at runtime. The
+      // callback runs on the thread applying the override, which is the main
+      // raylet thread that also drives spilling.
+      min_spilling_size_config_callback_id_ =
+          RayConfig::instance().RegisterOnChangeCallback("min_spilling_size", [this]() {
+            const int64_t new_min_spilling_size =
+                RayConfig::instance().min_spilling_size();
+            if (max_spilling_file_size_bytes_ > 0 &&
+                new_min_spilling_size > max_spilling_file_size_bytes_) {
+              RAY_LOG(WARNING) << "Ignoring dynamic min_spilling_size override "
+                               << new_min_spilling_size
+                               << " larger than max_spilling_file_size_bytes "
+                               << max_spilling_file_size_bytes_;
+              return;
+            }
+            min_spilling_size_ = new_min_spilling_size;
+          });
+    }
+  }
+
+  ~LocalObjectManager() {
+    if (min_spilling_size_config_callback_id_ >= 0) {
+      RayConfig::instance().UnregisterOnChangeCallback(
+          min_spilling_size_config_callback_id_);
+    }
   }
 
   /// Pin objects.
@@ -230,6 +297,7 @@ class LocalObjectManager : public LocalObjectManagerInterface {
   FRIEND_TEST(LocalObjectManagerTest,
               TestTryToSpillObjectsNumBytesToSpillHigherThanMinBytesToSpill);
   FRIEND_TEST(LocalObjectManagerTest, TestSpillObjectNotEvictable);
+  FRIEND_TEST(LocalObjectManagerTest, TestTryToSpillObjectsSkipsRecentlyRestored);
   FRIEND_TEST(LocalObjectManagerTest, TestRetryDeleteSpilledObjects);
 
   /// Asynchronously spill objects when space is needed. The callback tries to
@@ -242,10 +310,22 @@ class LocalObjectManager : public LocalObjectManagerInterface {
   /// \return True if it decides to spill more objects. False otherwise.
   bool TryToSpillObjects();
 
+  /// Check whether the object finished restoring from external storage within
+  /// the last object_spilling_restored_object_backoff_s seconds. Expired
+  /// entries are pruned as they are looked up.
+  bool IsObjectRecentlyRestored(const ObjectID &object_id);
+
   /// Internal helper method for spilling objects.
   void SpillObjectsInternal(const std::vector<ObjectID> &objects_ids,
                             std::function<void(const ray::Status &)> callback);
 
+  /// Spill objects by writing them from the plasma shared-memory mapping to
+  /// local disk on the direct spill writer, bypassing the IO workers. Only
+  /// used when object_spilling_direct_fs_write is enabled and the external
+  /// storage is the local filesystem.
+  void SpillObjectsDirect(const std::vector<ObjectID> &objects_to_spill,
+                          std::function<void(const ray::Status &)> callback);
+
   /// Release an object that has been freed by its owner.
   void ReleaseFreedObject(const ObjectID &object_id);
 
@@ -313,6 +393,14 @@ class LocalObjectManager : public LocalObjectManagerInterface {
   /// progress.
   absl::flat_hash_set<ObjectID> objects_pending_restore_;
 
+  /// Objects restored from external storage, mapped to the time (in ns) their
+  /// restore finished. Spilling such an object again right away tends to cause
+  /// spill-restore thrash, so TryToSpillObjects prefers other objects while
+  /// the entry is within the configured backoff window. Entries expire lazily
+  /// on lookup. Only populated when
+  /// object_spilling_restored_object_backoff_s > 0.
+  absl::flat_hash_map<ObjectID, int64_t> recently_restored_objects_;
+
   /// The time that we last sent a FreeObjects request to other nodes for
   /// objects that have gone out of scope in the application.
   uint64_t last_free_objects_at_ms_ = 0;
@@ -350,6 +438,10 @@ class LocalObjectManager : public LocalObjectManagerInterface {
   /// Minimum bytes to spill to a single IO spill worker.
   int64_t min_spilling_size_;
 
+  /// Id of the dynamic config callback that re-reads min_spilling_size_, or
+  /// -1 if dynamic config is disabled.
+  int64_t min_spilling_size_config_callback_id_ = -1;
+
   /// Maximum bytes to include in a single spill request (i.e. fused spill file).
   /// If <= 0, the limit is disabled.
   int64_t max_spilling_file_size_bytes_;
@@ -370,6 +462,20 @@ class LocalObjectManager : public LocalObjectManagerInterface {
   /// directly from the external storage.
   bool is_external_storage_type_fs_;
 
+  /// Writes spill files directly from the plasma mapping; non-null iff
+  /// object_spilling_direct_fs_write is enabled for filesystem storage.
+  std::unique_ptr<DirectSpillWriter> direct_spill_writer_;
+
+  /// Append-only index of spilled_objects_url_, replayed on startup; non-null
+  /// iff object_spilling_manifest_enabled is set for filesystem storage.
+  std::unique_ptr<SpillManifest> spill_manifest_;
+
+  /// Connection to the local plasma store used to restore spilled objects by
+  /// mapping their spill file region; non-null iff object_spilling_mmap_restore
+  /// is enabled for filesystem storage. When a restore through the mapping
+  /// fails, we fall back to the IO worker restore path.
+  std::shared_ptr<plasma::PlasmaClientInterface> store_client_;
+
   /// Maximum number of objects that can be fused into a single file.
   int64_t max_fused_object_count_;
 
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
 #include "gflags/gflags.h"
 #include "nlohmann/json.hpp"
 #include "ray/common/asio/instrumented_io_context.h"
@@ -52,6 +53,7 @@
 #include "ray/stats/tag_defs.h"
 #include "ray/util/cmd_line_utils.h"
 #include "ray/util/event.h"
+#include "ray/util/memory_telemetry.h"
 #include "ray/util/process.h"
 #include "ray/util/raii.h"
 #include "ray/util/stream_redirection.h"
@@ -534,6 +536,25 @@ int main(int argc, char *argv[]) {
     ray::asio::testing::Init();
     ray::rpc::testing::Init();
 
+    if (RayConfig::instance().memory_telemetry_enabled()) {
+      ray::MemoryTelemetry::Instance().Enable(
+          RayConfig::instance().memory_telemetry_sample_period());
+      ray::stats::Gauge memory_telemetry_gauge =
+          ray::GetMemoryTelemetryEstimatedBytesGaugeMetric();
+      auto memory_telemetry_runner = ray::PeriodicalRunner::Create(main_service);
+      memory_telemetry_runner->RunFnPeriodically(
+          [memory_telemetry_runner, memory_telemetry_gauge]() mutable {
+            for (const auto &entry :
+                 ray::MemoryTelemetry::Instance().GetEstimatedLiveBytes()) {
+              memory_telemetry_gauge.Record(
+                  static_cast<double>(entry.bytes),
+                  {{"Tag", ray::MemoryTagName(entry.tag)}});
+            }
+          },
+          RayConfig::instance().memory_telemetry_report_interval_ms(),
+          "MemoryTelemetry.Export");
+    }
+
     const bool pg_enabled = RayConfig::instance().process_group_cleanup_enabled();
     const bool subreaper_enabled =
         RayConfig::instance().kill_child_processes_on_worker_exit_with_raylet_subreaper();
@@ -777,6 +798,13 @@ int main(int argc, char *argv[]) {
           node_manager->MarkObjectsAsFailed(error_type, {ref}, ray::JobID::Nil());
         });
 
+    // Objects added to the plasma store since the last drain, written from the
+    // plasma store thread and drained in one batch on the main service so the
+    // node manager can propagate readiness in bulk.
+    absl::Mutex added_objects_mutex;
+    std::vector<ray::ObjectInfo> added_objects_buffer
+        ABSL_GUARDED_BY(added_objects_mutex);
+
     auto object_store_runner = std::make_unique<ray::ObjectStoreRunner>(
         object_manager_config,
         /*spill_objects_callback=*/
@@ -798,12 +826,32 @@ int main(int argc, char *argv[]) {
         },
         /*add_object_callback=*/
         [&](const ray::ObjectInfo &object_info) {
+          // This callback is called from the plasma store thread. Bursts of
+          // additions are coalesced into one drain per event-loop dispatch so
+          // the node manager handles them as one batch instead of one task
+          // per object.
+          absl::MutexLock lock(&added_objects_mutex);
+          added_objects_buffer.push_back(object_info);
+          if (added_objects_buffer.size() > 1) {
+            // A drain for the buffer is already queued.
+            return;
+          }
           main_service.post(
-              [&object_manager, &node_manager, object_info]() {
-                object_manager->HandleObjectAdded(object_info);
-                node_manager->HandleObjectLocal(object_info);
+              [&object_manager,
+               &node_manager,
+               &added_objects_mutex,
+               &added_objects_buffer]() {
+                std::vector<ray::ObjectInfo> batch;
+                {
+                  absl::MutexLock lock(&added_objects_mutex);
+                  batch.swap(added_objects_buffer);
+                }
+                for (const auto &object_info : batch) {
+                  object_manager->HandleObjectAdded(object_info);
+                }
+                node_manager->HandleObjectsLocal(batch);
               },
-              "ObjectManager.ObjectAdded");
+              "ObjectManager.ObjectsAdded");
         },
         /*delete_object_callback=*/
         [&](const ray::ObjectID &object_id) {
@@ -868,6 +916,18 @@ int main(int argc, char *argv[]) {
         },
         object_manager_rpc_service);
 
+    // When mmap restore is enabled, the local object manager restores spilled
+    // objects through its own connection to the store instead of an IO worker.
+    // The store was already started by the object manager above.
+    std::shared_ptr<plasma::PlasmaClientInterface> restore_store_client;
+    if (RayConfig::instance().object_spilling_mmap_restore() &&
+        RayConfig::instance().is_external_storage_type_fs()) {
+      auto client = std::make_shared<plasma::PlasmaClient>();
+      RAY_CHECK_OK(
+          client->Connect(node_manager_config.store_socket_name, "", /*num_retries=*/300));
+      restore_store_client = std::move(client);
+    }
+
     local_object_manager = std::make_unique<ray::raylet::LocalObjectManager>(
         raylet_node_id,
         node_manager_config.node_manager_address,
@@ -893,7 +953,8 @@ int main(int argc, char *argv[]) {
         /*core_worker_subscriber_=*/core_worker_subscriber.get(),
         object_directory.get(),
         object_store_memory_gauge,
-        spill_manager_metrics);
+        spill_manager_metrics,
+        std::move(restore_store_client));
 
     lease_dependency_manager = std::make_unique<ray::raylet::LeaseDependencyManager>(
         *object_manager, task_by_state_counter);
@@ -998,7 +1059,8 @@ int main(int argc, char *argv[]) {
                                                            *cluster_resource_scheduler,
                                                            get_node_info_func,
                                                            announce_infeasible_lease,
-                                                           *local_lease_manager);
+                                                           *local_lease_manager,
+                                                           *lease_dependency_manager);
 
     auto raylet_client_factory = [&](const ray::NodeID &id) {
       auto node_info = gcs_client->Nodes().GetNodeAddressAndLiveness(id);
@@ -138,9 +138,11 @@ inline ray::stats::Gauge GetSpillManagerRequestTotalGaugeMetric() {
 inline ray::stats::Gauge GetSpillManagerThroughputMBGaugeMetric() {
   return ray::stats::Gauge{
       /*name=*/"spill_manager_throughput_mb",
-      /*description=*/"The throughput of {spill, restore} requests in MB.",
+      /*description=*/
+      "The throughput of {spill, restore} requests in MB, optionally broken "
+      "down per spill device for direct filesystem writes.",
       /*unit=*/"",
-      /*tag_keys=*/{"Type"},
+      /*tag_keys=*/{"Type", "Device"},
   };
 }
 
@@ -18,6 +18,7 @@
 #include <boost/bind/bind.hpp>
 #include <cctype>
 #include <cerrno>
+#include <cmath>
 #include <csignal>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +32,7 @@
 #include <vector>
 
 #include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
 #include "absl/strings/str_replace.h"
 #include "absl/time/clock.h"
 #include "ray/common/asio/asio_util.h"
@@ -57,13 +59,17 @@
 #include "ray/raylet/worker_pool.h"
 #include "ray/raylet_ipc_client/client_connection.h"
 #include "ray/rpc/authentication/authentication_token_loader.h"
+#include "ray/rpc/grpc_client.h"
+#include "ray/stats/contention_metrics.h"
 #include "ray/util/cmd_line_utils.h"
+#include "ray/util/contention_profiler.h"
 #include "ray/util/event.h"
 #include "ray/util/network_util.h"
 #include "ray/util/port_persistence.h"
 #include "ray/util/process.h"
 #include "ray/util/process_utils.h"
 #include "ray/util/string_utils.h"
+#include "ray/util/thread_utils.h"
 #include "ray/util/time.h"
 
 namespace ray::raylet {
@@ -220,6 +226,10 @@ NodeManager::NodeManager(
                                                std::chrono::milliseconds(delay_ms)));
                     }),
       runtime_env_agent_port_(config.runtime_env_agent_port),
+      read_rpc_service_(/*emit_metrics=*/false,
+                        /*running_on_single_thread=*/false,
+                        "node_manager_read_rpc_io_context"),
+      read_rpc_work_(read_rpc_service_.get_executor()),
       node_manager_server_("NodeManager",
                            config.node_manager_port,
                            config.node_manager_address == "127.0.0.1"),
@@ -258,9 +268,32 @@ NodeManager::NodeManager(
       "NodeManager.CheckForUnexpectedWorkerDisconnects");
 
   RAY_CHECK_OK(store_client_->Connect(config.store_socket_name));
-  // Run the node manager rpc server.
+  const int num_read_rpc_threads =
+      RayConfig::instance().node_manager_read_rpc_threads_num();
+  if (num_read_rpc_threads > 0) {
+    read_rpc_threads_.reserve(num_read_rpc_threads);
+    for (int i = 0; i < num_read_rpc_threads; i++) {
+      read_rpc_threads_.emplace_back([this, i] {
+        SetThreadName(absl::StrFormat("rpc.node.mgr.read.%d", i));
+        read_rpc_service_.run();
+      });
+    }
+    // The read lane serves GetResourceLoad from a snapshot to avoid touching
+    // the lease manager off the main thread. Build the first snapshot now and
+    // refresh it at the same cadence as resource reports.
+    RefreshResourceLoadCache();
+    periodical_runner_->RunFnPeriodically([this]() { RefreshResourceLoadCache(); },
+                                          report_resources_period_ms_,
+                                          "NodeManager.RefreshResourceLoadCache");
+  }
+  // Run the node manager rpc server. Read-mostly RPCs are posted to the read
+  // lane when it is enabled, everything else stays on the main event loop.
   node_manager_server_.RegisterService(
-      std::make_unique<rpc::NodeManagerGrpcService>(io_service, *this), false);
+      std::make_unique<rpc::NodeManagerGrpcService>(
+          io_service,
+          num_read_rpc_threads > 0 ? read_rpc_service_ : io_service,
+          *this),
+      false);
   // Pass auth token from the RPC server to the syncer service
   node_manager_server_.RegisterService(std::make_unique<syncer::RaySyncerService>(
       ray_syncer_, ray::rpc::AuthenticationTokenLoader::instance().GetToken()));
@@ -342,6 +375,22 @@ void NodeManager::RegisterGcs() {
     //
     // NodeManager::ConsumeSyncMessage will be called when a sync message containing
     // other Raylets' resource usage is received.
+    if (RayConfig::instance().adaptive_resource_report_period_enabled()) {
+      const int64_t assigned_period_ms =
+          gcs_client_.Nodes().GetRecommendedResourceReportPeriodMs();
+      if (assigned_period_ms > static_cast<int64_t>(report_resources_period_ms_)) {
+        RAY_LOG(INFO) << "Using the GCS-assigned resource report period of "
+                      << assigned_period_ms << " ms instead of the local default of "
+                      << report_resources_period_ms_ << " ms.";
+        // Keep watching the local load at the default cadence so that sharp
+        // changes are broadcast without waiting out the assigned period.
+        periodical_runner_->RunFnPeriodically(
+            [this]() { CheckResourceReportEscalation(); },
+            report_resources_period_ms_,
+            "NodeManager.CheckResourceReportEscalation");
+        report_resources_period_ms_ = assigned_period_ms;
+      }
+    }
     ray_syncer_.Register(
         /* message_type */ syncer::MessageType::RESOURCE_VIEW,
         /* reporter */ &cluster_resource_scheduler_.GetLocalResourceManager(),
@@ -364,7 +413,23 @@ void NodeManager::RegisterGcs() {
         /* pull_from_reporter_interval_ms */ 0);
 
     auto gcs_channel = gcs_client_.GetGcsRpcClient().GetChannel();
-    ray_syncer_.Connect(kGCSNodeID.Binary(), gcs_channel);
+    const auto &aggregator_address = RayConfig::instance().syncer_aggregator_address();
+    if (!aggregator_address.empty()) {
+      // Aggregation-tree mode: sync through the configured aggregator raylet,
+      // which merges and forwards messages between this raylet and the GCS. If
+      // the aggregator becomes unreachable, the syncer re-parents to the GCS.
+      auto aggregator_host_port = ParseAddress(aggregator_address);
+      RAY_CHECK(aggregator_host_port.has_value())
+          << "Invalid syncer_aggregator_address: " << aggregator_address;
+      auto aggregator_channel = rpc::BuildChannel(
+          (*aggregator_host_port)[0], std::stoi((*aggregator_host_port)[1]));
+      ray_syncer_.Connect(syncer::kAggregatorUpstreamNodeID.Binary(),
+                          std::move(aggregator_channel),
+                          kGCSNodeID.Binary(),
+                          gcs_channel);
+    } else {
+      ray_syncer_.Connect(kGCSNodeID.Binary(), gcs_channel);
+    }
     periodical_runner_->RunFnPeriodically(
         [this] { TriggerLocalOrGlobalGCIfNeeded(); },
         RayConfig::instance().raylet_check_gc_period_milliseconds(),
@@ -415,6 +480,22 @@ void NodeManager::RegisterGcs() {
   periodical_runner_->RunFnPeriodically([this] { RecordMetrics(); },
                                         record_metrics_period_ms_,
                                         "NodeManager.deadline_timer.record_metrics");
+  if (RayConfig::instance().lock_contention_profiling_enabled()) {
+    ContentionProfiler::instance().Enable(
+        RayConfig::instance().lock_contention_profiling_sample_every_n());
+  }
+  if (RayConfig::instance().dynamic_config_enabled()) {
+    periodical_runner_->RunFnPeriodically(
+        [this] { PollDynamicConfig(); },
+        RayConfig::instance().dynamic_config_poll_interval_ms(),
+        "NodeManager.deadline_timer.poll_dynamic_config");
+  }
+  if (RayConfig::instance().node_stats_snapshot_enabled()) {
+    periodical_runner_->RunFnPeriodically(
+        [this] { RefreshNodeStatsSnapshot(); },
+        RayConfig::instance().node_stats_snapshot_interval_ms(),
+        "NodeManager.deadline_timer.refresh_node_stats_snapshot");
+  }
   if (RayConfig::instance().free_objects_period_milliseconds() > 0) {
     periodical_runner_->RunFnPeriodically(
         [this] { local_object_manager_.FlushFreeObjects(); },
@@ -1169,6 +1250,9 @@ void NodeManager::ProcessClientMessage(const std::shared_ptr<ClientConnection> &
   case protocol::MessageType::SubscribePlasmaReady: {
     ProcessSubscribePlasmaReady(client, message_data);
   } break;
+  case protocol::MessageType::GetCachedObjectLocationsRequest: {
+    ProcessGetCachedObjectLocationsRequestMessage(client, message_data);
+  } break;
   default:
     RAY_LOG(FATAL) << "Received unexpected message type " << message_type;
   }
@@ -1709,6 +1793,45 @@ void NodeManager::ProcessWaitForActorCallArgsRequestMessage(
                      });
 }
 
+void NodeManager::ProcessGetCachedObjectLocationsRequestMessage(
+    const std::shared_ptr<ClientConnection> &client, const uint8_t *message_data) {
+  auto message =
+      flatbuffers::GetRoot<protocol::GetCachedObjectLocationsRequest>(message_data);
+  auto object_ids = FlatbufferToObjectIds(*message->object_ids());
+
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<protocol::CachedObjectLocation>> locations;
+  for (const auto &object_id : object_ids) {
+    auto cached = object_directory_.GetCachedLocations(object_id);
+    if (!cached.has_value()) {
+      continue;
+    }
+    locations.push_back(
+        protocol::CreateCachedObjectLocation(fbb,
+                                             flatbuf::to_flatbuf(fbb, object_id),
+                                             flatbuf::to_flatbuf(fbb, cached->node_ids),
+                                             cached->object_size,
+                                             fbb.CreateString(cached->spilled_url),
+                                             flatbuf::to_flatbuf(fbb, cached->spilled_node_id),
+                                             cached->pending_creation));
+  }
+  auto reply =
+      protocol::CreateGetCachedObjectLocationsReply(fbb, fbb.CreateVector(locations));
+  fbb.Finish(reply);
+  const auto status = client->WriteMessage(
+      static_cast<int64_t>(protocol::MessageType::GetCachedObjectLocationsReply),
+      fbb.GetSize(),
+      fbb.GetBufferPointer());
+  if (!status.ok()) {
+    // We failed to write to the client, so disconnect the client.
+    std::ostringstream stream;
+    stream << "Failed to write GetCachedObjectLocationsReply to the client. Status "
+           << status;
+    DisconnectClient(
+        client, /*graceful=*/false, rpc::WorkerExitType::SYSTEM_ERROR, stream.str());
+  }
+}
+
 void NodeManager::ProcessPushErrorRequestMessage(const uint8_t *message_data) {
   auto message = flatbuffers::GetRoot<protocol::PushErrorRequest>(message_data);
 
@@ -1724,13 +1847,68 @@ void NodeManager::ProcessPushErrorRequestMessage(const uint8_t *message_data) {
 void NodeManager::HandleGetResourceLoad(rpc::GetResourceLoadRequest request,
                                         rpc::GetResourceLoadReply *reply,
                                         rpc::SendReplyCallback send_reply_callback) {
-  auto resources_data = reply->mutable_resources();
-  resources_data->set_node_id(self_node_id_.Binary());
-  resources_data->set_node_manager_address(initial_config_.node_manager_address);
-  cluster_lease_manager_.FillResourceUsage(*resources_data);
+  if (RayConfig::instance().node_manager_read_rpc_threads_num() > 0) {
+    // Running on a read RPC thread; serve the snapshot the main event loop
+    // refreshes instead of reading the lease manager's queues.
+    absl::MutexLock lock(&resource_load_mutex_);
+    *reply->mutable_resources() = cached_resource_load_;
+  } else {
+    FillResourceLoad(*reply->mutable_resources());
+  }
   send_reply_callback(Status::OK(), nullptr, nullptr);
 }
 
+void NodeManager::FillResourceLoad(rpc::ResourcesData &resources_data) {
+  resources_data.set_node_id(self_node_id_.Binary());
+  resources_data.set_node_manager_address(initial_config_.node_manager_address);
+  cluster_lease_manager_.FillResourceUsage(resources_data);
+}
+
+void NodeManager::RefreshResourceLoadCache() {
+  rpc::ResourcesData resources_data;
+  FillResourceLoad(resources_data);
+  absl::MutexLock lock(&resource_load_mutex_);
+  cached_resource_load_ = std::move(resources_data);
+}
+
+void NodeManager::CheckResourceReportEscalation() {
+  const auto node_resources =
+      cluster_resource_scheduler_.GetLocalResourceManager().ToNodeResources();
+  const auto total = node_resources.total.GetResourceMap();
+  const auto available = node_resources.available.GetResourceMap();
+  const double escalation_fraction =
+      RayConfig::instance().adaptive_resource_report_escalation_fraction();
+
+  bool sharp_change = false;
+  absl::flat_hash_map<std::string, double> availability;
+  availability.reserve(total.size());
+  for (const auto &[name, total_amount] : total) {
+    if (total_amount <= 0) {
+      continue;
+    }
+    auto available_it = available.find(name);
+    const double fraction =
+        available_it == available.end() ? 0.0 : available_it->second / total_amount;
+    availability[name] = fraction;
+    auto baseline_it = escalation_baseline_availability_.find(name);
+    // Resources seen for the first time start out fully available.
+    const double baseline =
+        baseline_it == escalation_baseline_availability_.end() ? 1.0
+                                                               : baseline_it->second;
+    if (std::abs(fraction - baseline) >= escalation_fraction) {
+      sharp_change = true;
+    }
+  }
+  if (!sharp_change) {
+    return;
+  }
+  escalation_baseline_availability_ = std::move(availability);
+  // Broadcast right away instead of waiting out the adaptive report period.
+  // The syncer dedups by version, so this is a no-op if the view already went
+  // out.
+  ray_syncer_.OnDemandBroadcasting(syncer::MessageType::RESOURCE_VIEW);
+}
+
 void NodeManager::HandleCancelLeasesWithResourceShapes(
     rpc::CancelLeasesWithResourceShapesRequest request,
     rpc::CancelLeasesWithResourceShapesReply *reply,
@@ -1905,8 +2083,30 @@ void NodeManager::HandlePrepareBundleResources(
   }
   RAY_LOG(DEBUG) << "Request to prepare resources for bundles: "
                  << GetDebugStringForBundles(bundle_specs);
-  auto prepared = placement_group_resource_manager_.PrepareBundles(bundle_specs);
-  reply->set_success(prepared);
+  // A request may carry bundles of several placement groups. Each placement
+  // group must be prepared atomically on its own, so group the bundles by
+  // placement group id and prepare one group at a time.
+  std::vector<PlacementGroupID> group_order;
+  absl::flat_hash_map<PlacementGroupID,
+                      std::vector<std::shared_ptr<const BundleSpecification>>>
+      bundles_per_group;
+  for (const auto &bundle_spec : bundle_specs) {
+    auto &group_bundles = bundles_per_group[bundle_spec->PlacementGroupId()];
+    if (group_bundles.empty()) {
+      group_order.push_back(bundle_spec->PlacementGroupId());
+    }
+    group_bundles.push_back(bundle_spec);
+  }
+  bool all_prepared = true;
+  for (const auto &placement_group_id : group_order) {
+    bool prepared = placement_group_resource_manager_.PrepareBundles(
+        bundles_per_group[placement_group_id]);
+    all_prepared = all_prepared && prepared;
+    auto *group_result = reply->add_group_results();
+    group_result->set_placement_group_id(placement_group_id.Binary());
+    group_result->set_success(prepared);
+  }
+  reply->set_success(all_prepared);
   send_reply_callback(Status::OK(), nullptr, nullptr);
 }
 
@@ -2406,47 +2606,69 @@ void NodeManager::SpillIfOverPrimaryObjectsThreshold() {
   const float allocated_percentage =
       static_cast<float>(local_object_manager_.GetPrimaryBytes()) /
       object_manager_.GetMemoryCapacity();
-  if (allocated_percentage >= RayConfig::instance().object_spilling_threshold()) {
+  float spill_threshold = RayConfig::instance().object_spilling_threshold();
+  const float queued_pull_threshold =
+      RayConfig::instance().object_spilling_queued_pull_threshold();
+  if (queued_pull_threshold >= 0 && object_manager_.PullManagerHasPullsQueued()) {
+    // Queued pulls will need object store memory as soon as it frees up; start
+    // spilling early to make room for them instead of waiting for the static
+    // threshold.
+    spill_threshold = std::min(spill_threshold, queued_pull_threshold);
+  }
+  if (allocated_percentage >= spill_threshold) {
     RAY_LOG(INFO) << "Triggering object spilling because current usage "
                   << allocated_percentage * 100 << "% is above threshold "
-                  << RayConfig::instance().object_spilling_threshold() * 100 << "%.";
+                  << spill_threshold * 100 << "%.";
     local_object_manager_.SpillObjectUptoMaxThroughput();
   }
 }
 
 void NodeManager::HandleObjectLocal(const ObjectInfo &object_info) {
-  const ObjectID &object_id = object_info.object_id;
-  // Notify the task dependency manager that this object is local.
-  const auto ready_lease_ids = lease_dependency_manager_.HandleObjectLocal(object_id);
-  RAY_LOG(DEBUG).WithField(object_id).WithField(self_node_id_)
-      << "Object local on node, " << ready_lease_ids.size() << " tasks ready";
+  HandleObjectsLocal({object_info});
+}
+
+void NodeManager::HandleObjectsLocal(const std::vector<ObjectInfo> &object_infos) {
+  std::vector<ObjectID> object_ids;
+  object_ids.reserve(object_infos.size());
+  for (const auto &object_info : object_infos) {
+    object_ids.push_back(object_info.object_id);
+  }
+
+  // Notify the lease dependency manager that these objects are local, and
+  // unblock all newly ready leases as one batch.
+  const auto ready_lease_ids = lease_dependency_manager_.HandleObjectsLocal(object_ids);
+  RAY_LOG(DEBUG).WithField(self_node_id_)
+      << object_ids.size() << " objects local on node, " << ready_lease_ids.size()
+      << " tasks ready";
   local_lease_manager_.LeasesUnblocked(ready_lease_ids);
 
-  // Notify the wait manager that this object is local.
-  wait_manager_.HandleObjectLocal(object_id);
+  // Notify the wait manager that these objects are local.
+  wait_manager_.HandleObjectsLocal(object_ids);
 
-  auto waiting_workers = absl::flat_hash_set<std::shared_ptr<WorkerInterface>>();
-  {
-    absl::MutexLock guard(&plasma_object_notification_lock_);
-    auto waiting = this->async_plasma_objects_notification_.extract(object_id);
-    if (!waiting.empty()) {
-      waiting_workers.swap(waiting.mapped());
+  for (const auto &object_id : object_ids) {
+    auto waiting_workers = absl::flat_hash_set<std::shared_ptr<WorkerInterface>>();
+    {
+      absl::MutexLock guard(&plasma_object_notification_lock_);
+      auto waiting = this->async_plasma_objects_notification_.extract(object_id);
+      if (!waiting.empty()) {
+        waiting_workers.swap(waiting.mapped());
+      }
     }
-  }
-  rpc::PlasmaObjectReadyRequest request;
-  request.set_object_id(object_id.Binary());
+    rpc::PlasmaObjectReadyRequest request;
+    request.set_object_id(object_id.Binary());
 
-  for (const auto &worker : waiting_workers) {
-    worker->rpc_client()->PlasmaObjectReady(
-        request, [](Status status, const rpc::PlasmaObjectReadyReply &reply) {
-          if (!status.ok()) {
-            RAY_LOG(INFO) << "Problem with telling worker that plasma object is ready"
-                          << status.ToString();
-          }
-        });
+    for (const auto &worker : waiting_workers) {
+      worker->rpc_client()->PlasmaObjectReady(
+          request, [](Status status, const rpc::PlasmaObjectReadyReply &reply) {
+            if (!status.ok()) {
+              RAY_LOG(INFO) << "Problem with telling worker that plasma object is ready"
+                            << status.ToString();
+            }
+          });
+    }
   }
 
-  // An object was created so we may be over the spill
+  // Objects were created so we may be over the spill
   // threshold now.
   SpillIfOverPrimaryObjectsThreshold();
 }
@@ -2633,6 +2855,15 @@ void NodeManager::HandlePinObjectIDs(rpc::PinObjectIDsRequest request,
   send_reply_callback(Status::OK(), nullptr, nullptr);
 }
 
+void NodeManager::HandleHintObjectLocation(rpc::HintObjectLocationRequest request,
+                                           rpc::HintObjectLocationReply *reply,
+                                           rpc::SendReplyCallback send_reply_callback) {
+  object_directory_.HandleLocationHint(ObjectID::FromBinary(request.object_id()),
+                                       NodeID::FromBinary(request.node_id()),
+                                       request.object_size());
+  send_reply_callback(Status::OK(), nullptr, nullptr);
+}
+
 void NodeManager::HandleGetSystemConfig(rpc::GetSystemConfigRequest request,
                                         rpc::GetSystemConfigReply *reply,
                                         rpc::SendReplyCallback send_reply_callback) {
@@ -2643,6 +2874,20 @@ void NodeManager::HandleGetSystemConfig(rpc::GetSystemConfigRequest request,
 void NodeManager::HandleGetNodeStats(rpc::GetNodeStatsRequest node_stats_request,
                                      rpc::GetNodeStatsReply *reply,
                                      rpc::SendReplyCallback send_reply_callback) {
+  if (RayConfig::instance().node_stats_snapshot_enabled() &&
+      node_stats_snapshot_ != nullptr) {
+    // Serve the periodically refreshed snapshot instead of fanning out to
+    // every worker on the node inline in the handler.
+    reply->CopyFrom(*node_stats_snapshot_);
+    send_reply_callback(Status::OK(), nullptr, nullptr);
+    return;
+  }
+  QueryNodeStats(std::move(node_stats_request), reply, std::move(send_reply_callback));
+}
+
+void NodeManager::QueryNodeStats(rpc::GetNodeStatsRequest node_stats_request,
+                                 rpc::GetNodeStatsReply *reply,
+                                 rpc::SendReplyCallback send_reply_callback) {
   // Report object spilling stats.
   local_object_manager_.FillObjectStoreStats(reply);
   // Report object store stats.
@@ -2684,6 +2929,27 @@ void NodeManager::HandleGetNodeStats(rpc::GetNodeStatsRequest node_stats_request
   }
 }
 
+void NodeManager::RefreshNodeStatsSnapshot() {
+  // Build the next snapshot into a back buffer and publish it only once every
+  // worker has replied, so HandleGetNodeStats never serves a partially
+  // assembled reply. Everything here runs on the main io_service thread, so
+  // the publish is a plain pointer swap.
+  auto pending = std::make_shared<rpc::GetNodeStatsReply>();
+  rpc::GetNodeStatsRequest request;
+  // Include memory info so the snapshot can serve any GetNodeStats request.
+  request.set_include_memory_info(true);
+  auto *pending_ptr = pending.get();
+  QueryNodeStats(std::move(request),
+                 pending_ptr,
+                 [this, pending = std::move(pending)](const Status &status,
+                                                      std::function<void()> success,
+                                                      std::function<void()> failure) {
+                   if (status.ok()) {
+                     node_stats_snapshot_ = pending;
+                   }
+                 });
+}
+
 namespace {
 rpc::ObjectStoreStats AccumulateStoreStats(
     const std::vector<rpc::GetNodeStatsReply> &node_stats) {
@@ -2865,6 +3131,29 @@ void NodeManager::HandleGlobalGC(rpc::GlobalGCRequest request,
   SetShouldGlobalGC();
 }
 
+void NodeManager::PollDynamicConfig() {
+  gcs_client_.InternalKV().AsyncInternalKVGet(
+      kDynamicConfigNamespace,
+      kDynamicConfigOverridesKey,
+      /*timeout_ms=*/-1,
+      [this](Status status, std::optional<std::string> value) {
+        if (!status.ok() || !value.has_value()) {
+          // No overrides published, or the GCS is briefly unreachable; keep
+          // the current config and retry on the next poll.
+          return;
+        }
+        if (*value == last_applied_dynamic_config_) {
+          return;
+        }
+        auto changed = RayConfig::instance().ApplyOverrides(*value);
+        last_applied_dynamic_config_ = std::move(*value);
+        if (!changed.empty()) {
+          RAY_LOG(INFO) << "Applied dynamic config overrides for: "
+                        << absl::StrJoin(changed, ", ");
+        }
+      });
+}
+
 void NodeManager::TriggerLocalOrGlobalGCIfNeeded() {
   // If plasma store is under high pressure, we should try to schedule a global gc.
   const bool plasma_high_pressure = object_manager_.GetUsedMemoryPercentage() >
@@ -2960,6 +3249,13 @@ void NodeManager::Stop() {
   dashboard_agent_manager_.reset();
   runtime_env_agent_manager_.reset();
   acceptor_.close();
+  read_rpc_work_.reset();
+  read_rpc_service_.stop();
+  for (auto &thread : read_rpc_threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
 }
 
 void NodeManager::RecordMetrics() {
@@ -2977,6 +3273,7 @@ void NodeManager::RecordMetrics() {
   last_metrics_recorded_at_ms_ = current_time;
   object_directory_.RecordMetrics(duration_ms);
   lease_dependency_manager_.RecordMetrics();
+  stats::RecordContentionMetrics();
 }
 
 void NodeManager::ConsumeSyncMessage(
@@ -3034,11 +3331,12 @@ std::optional<syncer::RaySyncMessage> NodeManager::CreateSyncMessage(
 // Allows one in-flight call at a time as killing the underlying processes could
 // sometimes take seconds.
 KillWorkersCallback NodeManager::CreateKillWorkersCallback() {
-  return [this](const SystemMemorySnapshot &system_memory_snapshot) {
+  return [this](const SystemMemorySnapshot &system_memory_snapshot,
+                const ProcessesMemorySnapshot &process_memory) {
     io_service_.post(
-        [this, system_memory = system_memory_snapshot]() {
-          ProcessesMemorySnapshot process_memory_snapshot =
-              MemoryMonitorUtils::TakePerProcessMemorySnapshot();
+        [this,
+         system_memory = system_memory_snapshot,
+         process_memory_snapshot = process_memory]() {
           std::vector<std::shared_ptr<WorkerInterface>> workers =
               worker_pool_.GetAllRegisteredWorkers();
           if (workers.empty()) {
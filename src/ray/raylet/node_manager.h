@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -280,6 +281,14 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   /// \param object_info The info about the object that is locally available.
   void HandleObjectLocal(const ObjectInfo &object_info);
 
+  /// Batch form of HandleObjectLocal. Readiness is propagated to the lease
+  /// dependency and wait managers in bulk, so newly ready leases are
+  /// unblocked as one batch instead of once per object.
+  ///
+  /// \param object_infos The infos about the objects that are locally
+  /// available.
+  void HandleObjectsLocal(const std::vector<ObjectInfo> &object_infos);
+
   /// Handle an object that is no longer local. This updates any local
   /// accounting, but does not write to any global accounting in the GCS.
   ///
@@ -312,6 +321,11 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
                           rpc::PinObjectIDsReply *reply,
                           rpc::SendReplyCallback send_reply_callback) override;
 
+  /// Handle a `HintObjectLocation` request.
+  void HandleHintObjectLocation(rpc::HintObjectLocationRequest request,
+                                rpc::HintObjectLocationReply *reply,
+                                rpc::SendReplyCallback send_reply_callback) override;
+
   /// Handle a `ResizeLocalResourceInstances` request.
   void HandleResizeLocalResourceInstances(
       rpc::ResizeLocalResourceInstancesRequest request,
@@ -342,6 +356,36 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
                              rpc::CancelLocalTaskReply *reply,
                              rpc::SendReplyCallback send_reply_callback) override;
 
+  /// Handle a `GetResourceLoad` request. When the read RPC lane is enabled
+  /// (node_manager_read_rpc_threads_num > 0), this runs on a read RPC thread
+  /// and serves the snapshot maintained by RefreshResourceLoadCache().
+  void HandleGetResourceLoad(rpc::GetResourceLoadRequest request,
+                             rpc::GetResourceLoadReply *reply,
+                             rpc::SendReplyCallback send_reply_callback) override;
+
+  /// Refresh the resource load snapshot served by the read RPC lane. Runs
+  /// periodically on the main event loop when the lane is enabled.
+  void RefreshResourceLoadCache();
+
+  /// Handle a `NodeStats` request. When node_stats_snapshot_enabled is set
+  /// and a snapshot is ready, the reply is copied from the snapshot instead
+  /// of being assembled inline; see RefreshNodeStatsSnapshot().
+  void HandleGetNodeStats(rpc::GetNodeStatsRequest request,
+                          rpc::GetNodeStatsReply *reply,
+                          rpc::SendReplyCallback send_reply_callback) override;
+
+  /// Assemble the next node stats snapshot into a back buffer and publish it
+  /// once every worker has replied, so HandleGetNodeStats never serves a
+  /// partially assembled reply. Runs periodically on the main event loop when
+  /// node_stats_snapshot_enabled is set.
+  void RefreshNodeStatsSnapshot();
+
+  /// Broadcast the local resource view out of band when the availability of
+  /// any local resource has shifted sharply since the last broadcast. Runs
+  /// periodically on the main event loop when the GCS assigned this node a
+  /// report period longer than the locally configured one.
+  void CheckResourceReportEscalation();
+
  private:
   FRIEND_TEST(NodeManagerStaticTest, TestHandleReportWorkerBacklog);
 
@@ -592,10 +636,19 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   void ProcessSubscribePlasmaReady(const std::shared_ptr<ClientConnection> &client,
                                    const uint8_t *message_data);
 
-  /// Handle a `GetResourceLoad` request.
-  void HandleGetResourceLoad(rpc::GetResourceLoadRequest request,
-                             rpc::GetResourceLoadReply *reply,
-                             rpc::SendReplyCallback send_reply_callback) override;
+  /// Process client message of GetCachedObjectLocationsRequest. Replies with
+  /// the object directory's cached locations for the requested objects, so
+  /// workers can skip an owner RPC when another worker on this node recently
+  /// looked up the same object.
+  ///
+  /// \param client The client that sent the message.
+  /// \param message_data A pointer to the message data.
+  void ProcessGetCachedObjectLocationsRequestMessage(
+      const std::shared_ptr<ClientConnection> &client, const uint8_t *message_data);
+
+  /// Fill out the current resource load of this node. Must be called on the
+  /// main event loop since it reads the lease manager's queues.
+  void FillResourceLoad(rpc::ResourcesData &resources_data);
 
   /// Handle a `CancelLeasesWithResourceShapes` request.
   void HandleCancelLeasesWithResourceShapes(
@@ -653,10 +706,11 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
                                rpc::IsLocalWorkerDeadReply *reply,
                                rpc::SendReplyCallback send_reply_callback) override;
 
-  /// Handle a `NodeStats` request.
-  void HandleGetNodeStats(rpc::GetNodeStatsRequest request,
-                          rpc::GetNodeStatsReply *reply,
-                          rpc::SendReplyCallback send_reply_callback) override;
+  /// Assemble a `NodeStats` reply by filling the local object store stats and
+  /// fanning out a GetCoreWorkerStats request to every worker on the node.
+  void QueryNodeStats(rpc::GetNodeStatsRequest request,
+                      rpc::GetNodeStatsReply *reply,
+                      rpc::SendReplyCallback send_reply_callback);
 
   /// Handle a `GlobalGC` request.
   void HandleGlobalGC(rpc::GlobalGCRequest request,
@@ -757,6 +811,11 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   /// Will trigger local gc if needed and do a syncer global gc broadcast if needed.
   void TriggerLocalOrGlobalGCIfNeeded();
 
+  /// Poll the GCS internal KV for runtime config overrides and apply any
+  /// changes via RayConfig::ApplyOverrides. Only called when
+  /// RayConfig::dynamic_config_enabled is set.
+  void PollDynamicConfig();
+
   /**
    * @brief Creates the callback used by the memory monitor
    * to select workers to kill via the set killing policy and kill them.
@@ -849,6 +908,10 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   std::shared_ptr<PeriodicalRunner> periodical_runner_;
   /// The period used for the resources report timer.
   uint64_t report_resources_period_ms_;
+  /// Per-resource availability fractions as of the last escalated resource
+  /// broadcast. Used by CheckResourceReportEscalation() to detect sharp load
+  /// changes between GCS-assigned report periods.
+  absl::flat_hash_map<std::string, double> escalation_baseline_availability_;
   /// Incremented each time we encounter a potential resource deadlock condition.
   /// This is reset to zero when the condition is cleared.
   int resource_deadlock_warned_ = 0;
@@ -877,6 +940,28 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   int metrics_export_port_{0};
   int dashboard_agent_listen_port_{0};
 
+  /// Event loop serving read-mostly RPCs (GetResourceLoad, GetSystemConfig)
+  /// in parallel with the main event loop. Threads are only started when
+  /// node_manager_read_rpc_threads_num > 0; otherwise those RPCs stay on
+  /// io_service_ and this context is unused.
+  instrumented_io_context read_rpc_service_;
+
+  /// Keeps read_rpc_service_ alive while it has no queued handlers.
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      read_rpc_work_;
+
+  /// The threads running read_rpc_service_.
+  std::vector<std::thread> read_rpc_threads_;
+
+  /// Guards cached_resource_load_, which read RPC threads serve while the main
+  /// event loop refreshes it.
+  mutable absl::Mutex resource_load_mutex_;
+
+  /// The resource load snapshot served by HandleGetResourceLoad when the read
+  /// RPC lane is enabled. Refreshed by RefreshResourceLoadCache() every
+  /// report_resources_period_ms_.
+  rpc::ResourcesData cached_resource_load_ ABSL_GUARDED_BY(resource_load_mutex_);
+
   /// The RPC server.
   rpc::GrpcServer node_manager_server_;
 
@@ -965,6 +1050,14 @@ class NodeManager : public rpc::NodeManagerServiceHandler,
   /// we issue a GC command so that none of the messages are dropped.
   int64_t gc_command_sync_version_ = 0;
 
+  /// The last runtime config overrides string applied from the GCS internal
+  /// KV, used to skip re-applying an unchanged value on each poll.
+  std::string last_applied_dynamic_config_;
+
+  /// The most recently published node stats snapshot, or nullptr before the
+  /// first refresh completes. Only accessed on the main io_service thread.
+  std::shared_ptr<rpc::GetNodeStatsReply> node_stats_snapshot_;
+
   /// The Policy for selecting the worker to kill when the node runs out of memory.
   std::unique_ptr<WorkerKillingPolicyInterface> worker_killing_policy_;
 
@@ -52,8 +52,9 @@ bool NewPlacementGroupResourceManager::PrepareBundle(
       return true;
     } else {
       // If there was a bundle in prepare state, it already locked resources, we will
-      // return bundle resources so that we can start from the prepare phase again.
-      RAY_CHECK_OK(ReturnBundle(bundle_spec));
+      // roll back the prepared resources so that we can start from the prepare phase
+      // again.
+      RollbackPreparedBundle(bundle_spec);
     }
   }
 
@@ -82,6 +83,10 @@ bool NewPlacementGroupResourceManager::PrepareBundle(
 
 bool NewPlacementGroupResourceManager::PrepareBundles(
     const std::vector<std::shared_ptr<const BundleSpecification>> &bundle_specs) {
+  // Coalesce the per-bundle resource mutations into a single cluster view
+  // update so preparing a multi-bundle group publishes one notification.
+  LocalResourceManager::ScopedResourceUpdateBatch batch(
+      cluster_resource_scheduler_.GetLocalResourceManager());
   std::vector<std::shared_ptr<const BundleSpecification>> prepared_bundles;
   for (const auto &bundle_spec : bundle_specs) {
     if (PrepareBundle(*bundle_spec)) {
@@ -96,7 +101,7 @@ bool NewPlacementGroupResourceManager::PrepareBundles(
     RAY_LOG(DEBUG) << "There are one or more bundles request resource failed, will "
                       "release the requested resources before.";
     for (const auto &bundle : prepared_bundles) {
-      RAY_CHECK_OK(ReturnBundle(*bundle));
+      RollbackPreparedBundle(*bundle);
       // Erase from `bundle_spec_map_`.
       const auto &iter = bundle_spec_map_.find(bundle->BundleId());
       if (iter != bundle_spec_map_.end()) {
@@ -149,11 +154,29 @@ void NewPlacementGroupResourceManager::CommitBundle(
 
 void NewPlacementGroupResourceManager::CommitBundles(
     const std::vector<std::shared_ptr<const BundleSpecification>> &bundle_specs) {
+  // Coalesce the per-resource `AddLocalResourceInstances` calls of all bundles
+  // into a single cluster view update.
+  LocalResourceManager::ScopedResourceUpdateBatch batch(
+      cluster_resource_scheduler_.GetLocalResourceManager());
   for (const auto &bundle_spec : bundle_specs) {
     CommitBundle(*bundle_spec);
   }
 }
 
+void NewPlacementGroupResourceManager::RollbackPreparedBundle(
+    const BundleSpecification &bundle_spec) {
+  auto it = pg_bundles_.find(bundle_spec.BundleId());
+  RAY_CHECK(it != pg_bundles_.end() && it->second->state_ == CommitState::PREPARED)
+      << "Tried to roll back a bundle that is not in the PREPARED state. "
+      << bundle_spec.DebugString();
+  // A prepared bundle only holds the original resource instances it locked;
+  // no formatted placement group resources exist yet and nothing can be using
+  // them, so releasing the original instances fully undoes the preparation.
+  cluster_resource_scheduler_.GetLocalResourceManager().ReleaseWorkerResources(
+      it->second->resources_);
+  pg_bundles_.erase(it);
+}
+
 Status NewPlacementGroupResourceManager::ReturnBundle(
     const BundleSpecification &bundle_spec) {
   auto it = pg_bundles_.find(bundle_spec.BundleId());
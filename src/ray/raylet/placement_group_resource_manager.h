@@ -132,6 +132,15 @@ class NewPlacementGroupResourceManager : public PlacementGroupResourceManager {
   /// \param bundle_spec Specification of a bundle whose resources have been locked
   /// successfully before.
   void CommitBundle(const BundleSpecification &bundle_spec);
+
+  /// Roll back a bundle that is still in the PREPARED state by releasing the
+  /// original resource instances locked in the preparation phase. Unlike
+  /// `ReturnBundle`, this does not need the commit + re-allocate round trip
+  /// since no formatted placement group resources were created yet.
+  ///
+  /// \param bundle_spec Specification of a bundle that was prepared but not
+  /// committed.
+  void RollbackPreparedBundle(const BundleSpecification &bundle_spec);
 };
 
 }  // namespace raylet
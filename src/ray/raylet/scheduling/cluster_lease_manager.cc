@@ -21,7 +21,9 @@
 #include <string>
 #include <utility>
 
+#include "ray/common/ray_config.h"
 #include "ray/util/logging.h"
+#include "ray/util/memory_telemetry.h"
 #include "ray/util/string_utils.h"
 
 namespace ray {
@@ -33,22 +35,32 @@ ClusterLeaseManager::ClusterLeaseManager(
     internal::NodeInfoGetter get_node_info,
     std::function<void(const RayLease &)> announce_infeasible_lease,
     LocalLeaseManagerInterface &local_lease_manager,
+    LeaseDependencyManagerInterface &lease_dependency_manager,
     std::function<int64_t(void)> get_time_ms)
     : self_node_id_(self_node_id),
       cluster_resource_scheduler_(cluster_resource_scheduler),
       get_node_info_(std::move(get_node_info)),
       announce_infeasible_lease_(std::move(announce_infeasible_lease)),
       local_lease_manager_(local_lease_manager),
+      lease_dependency_manager_(lease_dependency_manager),
       scheduler_resource_reporter_(
           leases_to_schedule_, infeasible_leases_, local_lease_manager_),
       internal_stats_(*this, local_lease_manager_),
-      get_time_ms_(std::move(get_time_ms)) {}
+      get_time_ms_(std::move(get_time_ms)) {
+  const auto &record_path = RayConfig::instance().scheduling_decision_record_path();
+  if (!record_path.empty()) {
+    decision_recorder_ =
+        std::make_unique<SchedulingDecisionRecorder>(record_path, self_node_id_.Binary());
+  }
+}
 
 void ClusterLeaseManager::QueueAndScheduleLease(
     RayLease lease,
     bool grant_or_reject,
     bool is_selected_based_on_locality,
     std::vector<internal::ReplyCallback> reply_callbacks) {
+  // Attribute the queued work allocated below to the lease queue subsystem.
+  ScopedMemoryTag memory_tag(MemoryTag::kLeaseQueues);
   RAY_LOG(DEBUG) << "Queuing and scheduling lease "
                  << lease.GetLeaseSpecification().LeaseId();
   const auto scheduling_class = lease.GetLeaseSpecification().GetSchedulingClass();
@@ -56,12 +68,31 @@ void ClusterLeaseManager::QueueAndScheduleLease(
                                                grant_or_reject,
                                                is_selected_based_on_locality,
                                                std::move(reply_callbacks));
+  if (decision_recorder_ != nullptr) {
+    const auto &lease_spec = work->lease_.GetLeaseSpecification();
+    decision_recorder_->RecordLeaseArrival(
+        get_time_ms_(),
+        lease_spec.LeaseId().Binary(),
+        work->PrioritizeLocalNode() ? self_node_id_.Binary()
+                                    : work->lease_.GetPreferredNodeID(),
+        lease_spec.GetRequiredPlacementResources().GetResourceMap());
+  }
   // If the scheduling class is infeasible, just add the work to the infeasible queue
   // directly.
   auto infeasible_leases_iter = infeasible_leases_.find(scheduling_class);
   if (infeasible_leases_iter != infeasible_leases_.end()) {
     infeasible_leases_iter->second.emplace_back(std::move(work));
   } else {
+    if (RayConfig::instance().speculative_lease_arg_prefetch_enabled()) {
+      // Start fetching the lease's arguments while it waits for a scheduling
+      // decision so that they are already local by the time a worker is
+      // granted. The prefetch is cancelled if the lease is spilled to another
+      // node or cancelled, and subsumed by the regular argument fetch if the
+      // lease is queued locally.
+      const auto &lease_spec = work->lease_.GetLeaseSpecification();
+      lease_dependency_manager_.PrefetchLeaseDependencies(
+          lease_spec.LeaseId(), lease_spec.GetDependencies());
+    }
     leases_to_schedule_[scheduling_class].emplace_back(std::move(work));
   }
   ScheduleAndGrantLeases();
@@ -93,6 +124,8 @@ bool ClusterLeaseManager::CancelLeases(
           RAY_LOG(DEBUG) << "Canceling lease "
                          << work->lease_.GetLeaseSpecification().LeaseId()
                          << " from schedule queue.";
+          lease_dependency_manager_.CancelPrefetchLeaseDependencies(
+              work->lease_.GetLeaseSpecification().LeaseId());
           ReplyCancelled(*work, failure_type, scheduling_failure_message);
           leases_cancelled = true;
           return true;
@@ -107,6 +140,9 @@ bool ClusterLeaseManager::CancelLeases(
           RAY_LOG(DEBUG) << "Canceling lease "
                          << work->lease_.GetLeaseSpecification().LeaseId()
                          << " from infeasible queue.";
+          // The lease may have been prefetched while it was still feasible.
+          lease_dependency_manager_.CancelPrefetchLeaseDependencies(
+              work->lease_.GetLeaseSpecification().LeaseId());
           ReplyCancelled(*work, failure_type, scheduling_failure_message);
           leases_cancelled = true;
           return true;
@@ -201,6 +237,10 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
        shapes_it != leases_to_schedule_.end();) {
     auto &work_queue = shapes_it->second;
     bool is_infeasible = false;
+    // The last node granted a lease of this scheduling class in this round,
+    // reused by the batched scheduling fast path below.
+    auto last_node_id = scheduling::NodeID::Nil();
+    std::string last_preferred_node_id;
     for (auto work_it = work_queue.begin(); work_it != work_queue.end();) {
       // Check every lease in lease_to_schedule queue to see
       // whether it can be scheduled. This avoids head-of-line
@@ -209,15 +249,36 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
       // leases from being scheduled.
       const std::shared_ptr<internal::Work> &work = *work_it;
       RayLease lease = work->lease_;
-      RAY_LOG(DEBUG) << "Scheduling pending lease "
-                     << lease.GetLeaseSpecification().LeaseId();
-      auto scheduling_node_id = cluster_resource_scheduler_.GetBestSchedulableNode(
-          lease.GetLeaseSpecification(),
-          /*preferred_node_id*/ work->PrioritizeLocalNode() ? self_node_id_.Binary()
-                                                            : lease.GetPreferredNodeID(),
-          /*exclude_local_node*/ false,
-          /*requires_object_store_memory*/ false,
-          &is_infeasible);
+      const auto &lease_spec = lease.GetLeaseSpecification();
+      RAY_LOG(DEBUG) << "Scheduling pending lease " << lease_spec.LeaseId();
+      const std::string preferred_node_id = work->PrioritizeLocalNode()
+                                                ? self_node_id_.Binary()
+                                                : lease.GetPreferredNodeID();
+      auto scheduling_node_id = scheduling::NodeID::Nil();
+      if (!last_node_id.IsNil() && preferred_node_id == last_preferred_node_id &&
+          cluster_resource_scheduler_.IsSchedulableOnNode(
+              last_node_id,
+              lease_spec.GetRequiredPlacementResources().GetResourceMap(),
+              lease_spec.GetLabelSelector(),
+              /*requires_object_store_memory*/ false)) {
+        // All leases of one scheduling class share the same resource shape,
+        // scheduling strategy, and label selector, so as long as the
+        // previously granted node still has room for one more copy of the
+        // shape we can reuse the decision without rerunning the full
+        // cluster-wide node scan.
+        scheduling_node_id = last_node_id;
+      } else {
+        scheduling_node_id = cluster_resource_scheduler_.GetBestSchedulableNode(
+            lease_spec,
+            preferred_node_id,
+            /*exclude_local_node*/ false,
+            /*requires_object_store_memory*/ false,
+            &is_infeasible);
+      }
+
+      if (decision_recorder_ != nullptr) {
+        RecordSchedulingDecision(*work, scheduling_node_id, is_infeasible);
+      }
 
       // There is no node that has available resources to run the request.
       // Move on to the next shape.
@@ -234,6 +295,8 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
           // This can only happen if the target node doesn't exist or is infeasible.
           // The lease will never be schedulable in either case so we should fail it.
           if (cluster_resource_scheduler_.IsLocalNodeWithRaylet()) {
+            lease_dependency_manager_.CancelPrefetchLeaseDependencies(
+                lease.GetLeaseSpecification().LeaseId());
             ReplyCancelled(
                 *work,
                 rpc::RequestWorkerLeaseReply::SCHEDULING_CANCELLED_UNSCHEDULABLE,
@@ -257,6 +320,24 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
         break;
       }
 
+      const auto strategy_case =
+          lease_spec.GetSchedulingStrategy().scheduling_strategy_case();
+      if (RayConfig::instance().cluster_lease_manager_batched_scheduling() &&
+          (strategy_case == rpc::SchedulingStrategy::SchedulingStrategyCase::
+                                kDefaultSchedulingStrategy ||
+           strategy_case == rpc::SchedulingStrategy::SchedulingStrategyCase::
+                                SCHEDULING_STRATEGY_NOT_SET) &&
+          lease_spec.GetFallbackStrategy().empty() &&
+          !lease_spec.IsActorCreationTask() &&
+          !lease_spec.GetRequiredPlacementResources().IsEmpty()) {
+        // Remember the decision so the next lease of this class can skip the
+        // scan. Restricted to the default strategy with a non-empty shape:
+        // spread/affinity strategies intentionally vary their answer per
+        // lease, and an empty shape would pin every lease to one node since
+        // the availability check above could never fail.
+        last_node_id = scheduling_node_id;
+        last_preferred_node_id = preferred_node_id;
+      }
       NodeID node_id = NodeID::FromBinary(scheduling_node_id.Binary());
       ScheduleOnNode(node_id, work);
       work_it = work_queue.erase(work_it);
@@ -272,6 +353,14 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
         announce_infeasible_lease_(lease);
       }
 
+      if (RayConfig::instance().speculative_lease_arg_prefetch_enabled()) {
+        // Stop prefetching the args of leases with no feasible node; they
+        // would hold on to object store memory with no estimated start time.
+        for (const auto &infeasible_work : shapes_it->second) {
+          lease_dependency_manager_.CancelPrefetchLeaseDependencies(
+              infeasible_work->lease_.GetLeaseSpecification().LeaseId());
+        }
+      }
       infeasible_leases_[shapes_it->first] = std::move(shapes_it->second);
       leases_to_schedule_.erase(shapes_it++);
     } else if (work_queue.empty()) {
@@ -295,6 +384,22 @@ void ClusterLeaseManager::ScheduleAndGrantLeases() {
   local_lease_manager_.ScheduleAndGrantLeases();
 }
 
+void ClusterLeaseManager::RecordSchedulingDecision(
+    const internal::Work &work,
+    const scheduling::NodeID &selected_node_id,
+    bool is_infeasible) {
+  const auto &cluster_resource_manager =
+      cluster_resource_scheduler_.GetClusterResourceManager();
+  decision_recorder_->RecordResourceViewIfChanged(
+      *cluster_resource_manager.GetResourceViewSnapshot());
+  decision_recorder_->RecordDecision(
+      get_time_ms_(),
+      work.lease_.GetLeaseSpecification().LeaseId().Binary(),
+      cluster_resource_manager.GetViewEpoch(),
+      selected_node_id.IsNil() ? std::string() : selected_node_id.Binary(),
+      is_infeasible);
+}
+
 void ClusterLeaseManager::TryScheduleInfeasibleLease() {
   for (auto shapes_it = infeasible_leases_.begin();
        shapes_it != infeasible_leases_.end();) {
@@ -327,6 +432,13 @@ void ClusterLeaseManager::TryScheduleInfeasibleLease() {
       RAY_LOG(DEBUG) << "Infeasible lease of lease id "
                      << lease.GetLeaseSpecification().LeaseId()
                      << " is now feasible. Move the entry back to leases_to_schedule_";
+      if (RayConfig::instance().speculative_lease_arg_prefetch_enabled()) {
+        for (const auto &feasible_work : shapes_it->second) {
+          const auto &lease_spec = feasible_work->lease_.GetLeaseSpecification();
+          lease_dependency_manager_.PrefetchLeaseDependencies(
+              lease_spec.LeaseId(), lease_spec.GetDependencies());
+        }
+      }
       leases_to_schedule_[shapes_it->first] = std::move(shapes_it->second);
       infeasible_leases_.erase(shapes_it++);
     }
@@ -426,6 +538,10 @@ void ClusterLeaseManager::ScheduleOnNode(const NodeID &spillback_to,
     return;
   }
 
+  // The lease runs elsewhere; stop any speculative prefetch of its arguments.
+  lease_dependency_manager_.CancelPrefetchLeaseDependencies(
+      work->lease_.GetLeaseSpecification().LeaseId());
+
   if (work->grant_or_reject_) {
     for (const auto &reply_callback : work->reply_callbacks_) {
       reply_callback.reply_->set_rejected(true);
@@ -20,9 +20,11 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "ray/common/lease/lease.h"
+#include "ray/raylet/lease_dependency_manager.h"
 #include "ray/raylet/scheduling/cluster_lease_manager_interface.h"
 #include "ray/raylet/scheduling/cluster_resource_scheduler.h"
 #include "ray/raylet/scheduling/local_lease_manager_interface.h"
+#include "ray/raylet/scheduling/scheduling_decision_recorder.h"
 #include "ray/raylet/scheduling/scheduler_resource_reporter.h"
 #include "ray/raylet/scheduling/scheduler_stats.h"
 
@@ -47,6 +49,8 @@ class ClusterLeaseManager : public ClusterLeaseManagerInterface {
   /// \param announce_infeasible_lease: Callback that informs the user if a lease
   ///                                  is infeasible.
   /// \param local_lease_manager: Manages local leases.
+  /// \param lease_dependency_manager: Used to speculatively prefetch the
+  ///                                  arguments of queued leases.
   /// \param get_time_ms: A callback which returns the current time in milliseconds.
   ClusterLeaseManager(
       const NodeID &self_node_id,
@@ -54,6 +58,7 @@ class ClusterLeaseManager : public ClusterLeaseManagerInterface {
       internal::NodeInfoGetter get_node_info,
       std::function<void(const RayLease &)> announce_infeasible_lease,
       LocalLeaseManagerInterface &local_lease_manager,
+      LeaseDependencyManagerInterface &lease_dependency_manager,
       std::function<int64_t(void)> get_time_ms = []() {
         return static_cast<int64_t>(absl::GetCurrentTimeNanos() / 1e6);
       });
@@ -201,6 +206,13 @@ class ClusterLeaseManager : public ClusterLeaseManagerInterface {
   bool IsWorkWithResourceShape(const std::shared_ptr<internal::Work> &work,
                                const std::vector<ResourceSet> &target_resource_shapes);
 
+  /// Record the outcome of one scheduling pass for `work` to the decision
+  /// log, emitting the resource view first if its epoch changed. Only called
+  /// when `decision_recorder_` is set.
+  void RecordSchedulingDecision(const internal::Work &work,
+                                const scheduling::NodeID &selected_node_id,
+                                bool is_infeasible);
+
   const NodeID &self_node_id_;
   /// Responsible for resource tracking/view of the cluster.
   ClusterResourceScheduler &cluster_resource_scheduler_;
@@ -212,6 +224,9 @@ class ClusterLeaseManager : public ClusterLeaseManagerInterface {
 
   LocalLeaseManagerInterface &local_lease_manager_;
 
+  /// Used to speculatively prefetch the arguments of queued leases.
+  LeaseDependencyManagerInterface &lease_dependency_manager_;
+
   /// Queue of lease requests that are waiting for resources to become available.
   /// Leases move from scheduled -> dispatch | waiting.
   absl::flat_hash_map<SchedulingClass, std::deque<std::shared_ptr<internal::Work>>>
@@ -228,6 +243,11 @@ class ClusterLeaseManager : public ClusterLeaseManagerInterface {
   /// Returns the current time in milliseconds.
   std::function<int64_t()> get_time_ms_;
 
+  /// Records lease arrivals, resource-view epochs and policy outcomes to a
+  /// binary log for offline replay. Null unless
+  /// `scheduling_decision_record_path` is set.
+  std::unique_ptr<SchedulingDecisionRecorder> decision_recorder_;
+
   friend class SchedulerStats;
   friend class ClusterLeaseManagerTest;
   FRIEND_TEST(ClusterLeaseManagerTest, FeasibleToNonFeasible);
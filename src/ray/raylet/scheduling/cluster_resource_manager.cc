@@ -14,6 +14,7 @@
 
 #include "ray/raylet/scheduling/cluster_resource_manager.h"
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -71,6 +72,8 @@ void ClusterResourceManager::AddOrUpdateNode(scheduling::NodeID node_id,
     // This node exists, so update its resources.
     it->second = Node(node_resources);
   }
+  ReindexNodeTotalResources(node_id);
+  view_epoch_++;
 }
 
 bool ClusterResourceManager::UpdateNode(
@@ -114,7 +117,57 @@ bool ClusterResourceManager::UpdateNode(
 
 bool ClusterResourceManager::RemoveNode(scheduling::NodeID node_id) {
   received_node_resources_.erase(node_id);
-  return nodes_.erase(node_id) != 0;
+  RemoveNodeFromFeasibilityIndex(node_id);
+  if (nodes_.erase(node_id) == 0) {
+    return false;
+  }
+  view_epoch_++;
+  return true;
+}
+
+const absl::flat_hash_set<scheduling::NodeID>
+    *ClusterResourceManager::GetNodesWithTotalResource(
+        scheduling::ResourceID resource_id) const {
+  auto it = nodes_by_total_resource_.find(resource_id);
+  if (it == nodes_by_total_resource_.end()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void ClusterResourceManager::ReindexNodeTotalResources(scheduling::NodeID node_id) {
+  auto it = nodes_.find(node_id);
+  RAY_CHECK(it != nodes_.end());
+  auto new_resource_ids = it->second.GetLocalView().total.ExplicitResourceIds();
+  auto &old_resource_ids = node_indexed_resource_ids_[node_id];
+  for (const auto &resource_id : old_resource_ids) {
+    if (!new_resource_ids.count(resource_id)) {
+      auto bucket_it = nodes_by_total_resource_.find(resource_id);
+      bucket_it->second.erase(node_id);
+      if (bucket_it->second.empty()) {
+        nodes_by_total_resource_.erase(bucket_it);
+      }
+    }
+  }
+  for (const auto &resource_id : new_resource_ids) {
+    nodes_by_total_resource_[resource_id].insert(node_id);
+  }
+  old_resource_ids = std::move(new_resource_ids);
+}
+
+void ClusterResourceManager::RemoveNodeFromFeasibilityIndex(scheduling::NodeID node_id) {
+  auto it = node_indexed_resource_ids_.find(node_id);
+  if (it == node_indexed_resource_ids_.end()) {
+    return;
+  }
+  for (const auto &resource_id : it->second) {
+    auto bucket_it = nodes_by_total_resource_.find(resource_id);
+    bucket_it->second.erase(node_id);
+    if (bucket_it->second.empty()) {
+      nodes_by_total_resource_.erase(bucket_it);
+    }
+  }
+  node_indexed_resource_ids_.erase(it);
 }
 
 bool ClusterResourceManager::SetNodeDraining(const scheduling::NodeID &node_id,
@@ -133,6 +186,7 @@ bool ClusterResourceManager::SetNodeDraining(const scheduling::NodeID &node_id,
     rnr_it->second.is_draining = is_draining;
     rnr_it->second.draining_deadline_timestamp_ms = draining_deadline_timestamp_ms;
   }
+  view_epoch_++;
 
   return true;
 }
@@ -180,6 +234,8 @@ void ClusterResourceManager::UpdateResourceCapacity(scheduling::NodeID node_id,
   }
   local_view->total.Set(resource_id, total);
   local_view->available.Set(resource_id, available);
+  ReindexNodeTotalResources(node_id);
+  view_epoch_++;
 }
 
 bool ClusterResourceManager::DeleteResources(
@@ -194,6 +250,8 @@ bool ClusterResourceManager::DeleteResources(
     local_view->total.Set(resource_id, 0);
     local_view->available.Set(resource_id, 0);
   }
+  ReindexNodeTotalResources(node_id);
+  view_epoch_++;
   return true;
 }
 
@@ -208,6 +266,20 @@ const absl::flat_hash_map<scheduling::NodeID, Node>
   return nodes_;
 }
 
+std::shared_ptr<const ClusterResourceViewSnapshot>
+ClusterResourceManager::GetResourceViewSnapshot() const {
+  auto snapshot = std::atomic_load(&view_snapshot_);
+  if (snapshot != nullptr && snapshot->epoch == view_epoch_) {
+    return snapshot;
+  }
+  auto new_snapshot = std::make_shared<ClusterResourceViewSnapshot>();
+  new_snapshot->epoch = view_epoch_;
+  new_snapshot->nodes = nodes_;
+  std::atomic_store(&view_snapshot_,
+                    std::shared_ptr<const ClusterResourceViewSnapshot>(new_snapshot));
+  return new_snapshot;
+}
+
 bool ClusterResourceManager::SubtractNodeAvailableResources(
     scheduling::NodeID node_id, const ResourceRequest &resource_request) {
   auto it = nodes_.find(node_id);
@@ -219,6 +291,7 @@ bool ClusterResourceManager::SubtractNodeAvailableResources(
 
   resources->available -= resource_request.GetResourceSet();
   resources->available.RemoveNegative();
+  view_epoch_++;
 
   // TODO(swang): We should also subtract object store memory if the task has
   // arguments. Right now we do not modify object_pulls_queued in case of
@@ -269,6 +342,7 @@ bool ClusterResourceManager::AddNodeAvailableResources(scheduling::NodeID node_i
       node_resources->available.Set(resource_id, new_available);
     }
   }
+  view_epoch_++;
   return true;
 }
 
@@ -287,6 +361,7 @@ bool ClusterResourceManager::UpdateNodeNormalTaskResources(
         local_normal_task_resources = normal_task_resources;
         node_resources->latest_resources_normal_task_timestamp =
             resource_data.resources_normal_task_timestamp();
+        view_epoch_++;
         return true;
       }
     }
@@ -325,6 +400,7 @@ void ClusterResourceManager::SetNodeLabels(
     it = nodes_.emplace(node_id, node_resources).first;
   }
   it->second.GetMutableLocalView()->labels = std::move(labels);
+  view_epoch_++;
 }
 
 void ClusterResourceManager::RecordMetrics() const {
@@ -18,11 +18,13 @@
 
 #include <iostream>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "ray/common/bundle_location_index.h"
 #include "ray/common/scheduling/cluster_resource_data.h"
 #include "ray/common/scheduling/fixed_point.h"
@@ -45,6 +47,16 @@ namespace gcs {
 class GcsActorSchedulerTest;
 }  // namespace gcs
 
+/// An immutable, epoch-stamped copy of the cluster resource view. Scheduling
+/// policy evaluation on worker threads can read it without synchronization
+/// while the manager mutates its live view for the next epoch.
+struct ClusterResourceViewSnapshot {
+  /// The value of the view epoch this snapshot was built from.
+  uint64_t epoch = 0;
+  /// Copy of the node resource table at that epoch.
+  absl::flat_hash_map<scheduling::NodeID, Node> nodes;
+};
+
 /// Class manages the resources view of the entire cluster.
 /// This class is not thread safe.
 class ClusterResourceManager {
@@ -54,6 +66,26 @@ class ClusterResourceManager {
   /// Get the resource view of the cluster.
   const absl::flat_hash_map<scheduling::NodeID, Node> &GetResourceView() const;
 
+  /// Get the epoch of the resource view. The epoch is bumped on every
+  /// mutation of the view, so a snapshot is current iff its epoch matches.
+  uint64_t GetViewEpoch() const { return view_epoch_; }
+
+  /// Get an immutable snapshot of the resource view. The snapshot is copied
+  /// lazily: it is rebuilt only when the view has been mutated since the last
+  /// call and published with an atomic store, so snapshots returned earlier
+  /// stay valid and unchanged on other threads. Must be called from the
+  /// thread that mutates this manager.
+  std::shared_ptr<const ClusterResourceViewSnapshot> GetResourceViewSnapshot() const;
+
+  /// Get the set of nodes whose total resources include the given explicit
+  /// resource, or nullptr if no node has it. The index is maintained
+  /// incrementally as node totals change, so scheduling policies can use it
+  /// to skip nodes that cannot possibly be feasible for a request.
+  ///
+  /// \param resource_id ID of the explicit resource to look up.
+  const absl::flat_hash_set<scheduling::NodeID> *GetNodesWithTotalResource(
+      scheduling::ResourceID resource_id) const;
+
   /// Update node resources. This happens when a node resource usage updated.
   ///
   /// \param node_id ID of the node which resources need to be updated.
@@ -183,10 +215,37 @@ class ClusterResourceManager {
   /// If node_id not found, return false; otherwise return true.
   bool GetNodeResources(scheduling::NodeID node_id, NodeResources *ret_resources) const;
 
+  /// Recompute the feasibility index entries of a node. Must be called after
+  /// any mutation of the node's total resources.
+  void ReindexNodeTotalResources(scheduling::NodeID node_id);
+
+  /// Drop all feasibility index entries of a removed node.
+  void RemoveNodeFromFeasibilityIndex(scheduling::NodeID node_id);
+
   /// List of nodes in the clusters and their resources organized as a map.
   /// The key of the map is the node ID.
   absl::flat_hash_map<scheduling::NodeID, Node> nodes_;
 
+  /// Index from an explicit resource ID to the nodes whose total resources
+  /// include that resource. Entries with empty sets are erased. Implicit
+  /// resources are not indexed since every node trivially has them.
+  absl::flat_hash_map<scheduling::ResourceID, absl::flat_hash_set<scheduling::NodeID>>
+      nodes_by_total_resource_;
+
+  /// Reverse map of nodes_by_total_resource_, used to update the index
+  /// incrementally when a node's totals change.
+  absl::flat_hash_map<scheduling::NodeID, std::set<scheduling::ResourceID>>
+      node_indexed_resource_ids_;
+
+  /// Bumped on every mutation of the resource view. See
+  /// `GetResourceViewSnapshot()`.
+  uint64_t view_epoch_ = 0;
+
+  /// The snapshot built for `view_epoch_` by the last
+  /// `GetResourceViewSnapshot()` call, or nullptr if none was built yet.
+  /// Accessed with std::atomic_load/std::atomic_store.
+  mutable std::shared_ptr<const ClusterResourceViewSnapshot> view_snapshot_;
+
   /// Resource message updated
   absl::flat_hash_map<scheduling::NodeID, NodeResources> received_node_resources_;
 
@@ -139,6 +139,43 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
   // blocking where a lease which cannot be granted because
   // there are not enough available resources blocks other
   // leases from being granted.
+
+  // Compute the fairness aggregates once per round and keep them up to date
+  // incrementally as leases are granted or erased below. Recomputing them for
+  // every scheduling class would make a grant round quadratic in the number
+  // of scheduling classes.
+
+  // Calculate the total CPU requests for all leases in the leases_to_grant queue.
+  double total_cpu_requests_ = 0.0;
+
+  // Count the number of scheduling classes that require CPU and sum their total CPU
+  // requests.
+  size_t num_classes_with_cpu = 0;
+  for (const auto &[_, cur_dispatch_queue] : leases_to_grant_) {
+    // Only need to check the first because all tasks with the same scheduling class
+    // have the same CPU resource requirements.
+    RAY_CHECK(!cur_dispatch_queue.empty());
+    const auto &work = cur_dispatch_queue.front();
+    const auto &lease_spec = work->lease_.GetLeaseSpecification();
+    auto cpu_request_ =
+        lease_spec.GetRequiredResources().Get(scheduling::ResourceID::CPU()).Double();
+    if (cpu_request_ > 0) {
+      num_classes_with_cpu++;
+      total_cpu_requests_ += cur_dispatch_queue.size() * cpu_request_;
+    }
+  }
+
+  // Get the total number of granted leases that require CPU.
+  size_t total_cpu_granted_leases = 0;
+  for (const auto &entry : info_by_sched_cls_) {
+    // Only consider CPU requests
+    const auto &cur_sched_cls_desc =
+        SchedulingClassToIds::GetSchedulingClassDescriptor(entry.first);
+    if (cur_sched_cls_desc.resource_set.Get(scheduling::ResourceID::CPU()).Double() > 0) {
+      total_cpu_granted_leases += entry.second.granted_leases.size();
+    }
+  }
+
   for (auto shapes_it = leases_to_grant_.begin(); shapes_it != leases_to_grant_.end();) {
     auto &scheduling_class = shapes_it->first;
     auto &leases_to_grant_queue = shapes_it->second;
@@ -191,50 +228,20 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
     // Currently, fair granting is implemented only for leases that require CPU
     // resources. CPU. For details, see https://github.com/ray-project/ray/pull/44733.
 
-    // Calculate the total CPU requests for all leases in the leases_to_grant queue.
-    double total_cpu_requests_ = 0.0;
-
-    // Count the number of scheduling classes that require CPU and sum their total CPU
-    // requests.
-    size_t num_classes_with_cpu = 0;
-    for (const auto &[_, cur_dispatch_queue] : leases_to_grant_) {
-      // Only need to check the first because all tasks with the same scheduling class
-      // have the same CPU resource requirements.
-      RAY_CHECK(!cur_dispatch_queue.empty());
-      const auto &work = cur_dispatch_queue.front();
-      const auto &lease_spec = work->lease_.GetLeaseSpecification();
-      auto cpu_request_ =
-          lease_spec.GetRequiredResources().Get(scheduling::ResourceID::CPU()).Double();
-      if (cpu_request_ > 0) {
-        num_classes_with_cpu++;
-        total_cpu_requests_ += cur_dispatch_queue.size() * cpu_request_;
-      }
-    }
     const auto &sched_cls_desc =
         SchedulingClassToIds::GetSchedulingClassDescriptor(scheduling_class);
+    const double cls_cpu_request =
+        sched_cls_desc.resource_set.Get(scheduling::ResourceID::CPU()).Double();
     double total_cpus =
         cluster_resource_scheduler_.GetLocalResourceManager().GetNumCpus();
 
     // Compare total CPU requests with the node's total CPU capacity. If the requests
     // exceed the capacity, check if fair granting is needed.
-    if (sched_cls_desc.resource_set.Get(scheduling::ResourceID::CPU()).Double() > 0 &&
-        total_cpu_requests_ > total_cpus) {
+    if (cls_cpu_request > 0 && total_cpu_requests_ > total_cpus) {
       RAY_LOG(DEBUG)
           << "Applying fairness policy. Total CPU requests in leases_to_grant_ ("
           << total_cpu_requests_ << ") exceed total CPUs available (" << total_cpus
           << ").";
-      // Get the total number of granted leases that require CPU.
-      size_t total_cpu_granted_leases = 0;
-      for (auto &entry : info_by_sched_cls_) {
-        // Only consider CPU requests
-        const auto &cur_sched_cls_desc =
-            SchedulingClassToIds::GetSchedulingClassDescriptor(entry.first);
-        if (cur_sched_cls_desc.resource_set.Get(scheduling::ResourceID::CPU()).Double() >
-            0) {
-          total_cpu_granted_leases += entry.second.granted_leases.size();
-        }
-      }
-
       // 1. We have confirmed that this is a scheduling class that requires CPU resources,
       //    hence num_classes_with_cpu >= 1 (cannot be 0) as this scheduling class is in
       //    leases_to_grant_.
@@ -304,6 +311,9 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
           // try to spill to a node that can.
           bool did_spill = TrySpillback(work, is_infeasible);
           if (did_spill) {
+            if (cls_cpu_request > 0) {
+              total_cpu_requests_ -= cls_cpu_request;
+            }
             work_it = leases_to_grant_queue.erase(work_it);
             continue;
           }
@@ -327,6 +337,9 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
           RAY_CHECK(waiting_leases_index_.emplace(lease_id, it).second);
           cluster_resource_scheduler_.GetLocalResourceManager().MaybeMarkFootprintAsBusy(
               WorkFootprint::PULLING_TASK_ARGUMENTS);
+          if (cls_cpu_request > 0) {
+            total_cpu_requests_ -= cls_cpu_request;
+          }
           work_it = leases_to_grant_queue.erase(work_it);
           RAY_LOG(DEBUG) << "Failed to pin arguments for lease " << lease_id;
         } else {
@@ -370,6 +383,9 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
               internal::UnscheduledWorkCause::WAITING_FOR_RESOURCES_AVAILABLE);
           break;
         }
+        if (cls_cpu_request > 0) {
+          total_cpu_requests_ -= cls_cpu_request;
+        }
         work_it = leases_to_grant_queue.erase(work_it);
       } else {
         // Force us to recalculate the next update time the next time a task
@@ -378,10 +394,14 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
         // passed.
         sched_cls_info.next_update_time = std::numeric_limits<int64_t>::max();
         sched_cls_info.granted_leases.insert(lease_id);
+        if (cls_cpu_request > 0) {
+          total_cpu_granted_leases++;
+        }
         // The local node has the available resources to grant the lease, so we should
         // grant it.
         work->allocated_instances_ = allocated_instances;
         work->SetStateWaitingForWorker();
+        num_leases_waiting_for_worker_[scheduling_class]++;
         bool is_detached_actor = spec.IsDetachedActor();
         auto &owner_address = spec.CallerAddress();
         /// TODO(scv119): if a worker is not started, the resources are leaked and
@@ -418,8 +438,21 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
       RAY_LOG(ERROR) << "A lease got granted to a node even though it was infeasible. "
                         "Please report an issue on GitHub.\nLease: "
                      << front_lease.DebugString();
+      // Note: `sched_cls_info` may have been erased from `info_by_sched_cls_`
+      // above, so it has to be looked up again here.
+      auto cancelled_cls_iter = info_by_sched_cls_.find(scheduling_class);
       auto leases_to_grant_queue_iter = leases_to_grant_queue.begin();
       while (leases_to_grant_queue_iter != leases_to_grant_queue.end()) {
+        if (cls_cpu_request > 0) {
+          total_cpu_requests_ -= cls_cpu_request;
+          if (cancelled_cls_iter != info_by_sched_cls_.end() &&
+              cancelled_cls_iter->second.granted_leases.contains(
+                  (*leases_to_grant_queue_iter)
+                      ->lease_.GetLeaseSpecification()
+                      .LeaseId())) {
+            total_cpu_granted_leases--;
+          }
+        }
         CancelLeaseToGrantWithoutReply(*leases_to_grant_queue_iter);
         ReplyCancelled(*leases_to_grant_queue_iter,
                        rpc::RequestWorkerLeaseReply::SCHEDULING_CANCELLED_UNSCHEDULABLE,
@@ -427,8 +460,14 @@ void LocalLeaseManager::GrantScheduledLeasesToWorkers() {
         leases_to_grant_queue_iter =
             leases_to_grant_queue.erase(leases_to_grant_queue_iter);
       }
+      if (cls_cpu_request > 0) {
+        num_classes_with_cpu--;
+      }
       leases_to_grant_.erase(shapes_it++);
     } else if (leases_to_grant_queue.empty()) {
+      if (cls_cpu_request > 0) {
+        num_classes_with_cpu--;
+      }
       leases_to_grant_.erase(shapes_it++);
     } else {
       shapes_it++;
@@ -594,6 +633,9 @@ bool LocalLeaseManager::PoppedWorkerHandler(
           leases_to_grant_.erase(shapes_it);
         }
         RAY_CHECK(erased);
+        if (work_to_erase->allocated_instances_ != nullptr) {
+          DecrementNumLeasesWaitingForWorker(_scheduling_class);
+        }
 
         const auto &_lease = work_to_erase->lease_;
         if (!_lease.GetLeaseSpecification().GetDependencies().empty()) {
@@ -617,6 +659,7 @@ bool LocalLeaseManager::PoppedWorkerHandler(
     cluster_resource_scheduler_.GetLocalResourceManager().ReleaseWorkerResources(
         work->allocated_instances_);
     work->allocated_instances_ = nullptr;
+    DecrementNumLeasesWaitingForWorker(scheduling_class);
     // Release pinned task args.
     ReleaseLeaseArgs(lease_id);
     RemoveFromGrantedLeasesIfExists(lease);
@@ -917,6 +960,10 @@ void LocalLeaseManager::CancelLeaseToGrantWithoutReply(
     // Release pinned lease args.
     ReleaseLeaseArgs(lease_id);
   }
+  if (work->allocated_instances_ != nullptr) {
+    DecrementNumLeasesWaitingForWorker(
+        work->lease_.GetLeaseSpecification().GetSchedulingClass());
+  }
   if (!work->lease_.GetLeaseSpecification().GetDependencies().empty()) {
     lease_dependency_manager_.RemoveLeaseDependencies(
         work->lease_.GetLeaseSpecification().LeaseId());
@@ -925,6 +972,15 @@ void LocalLeaseManager::CancelLeaseToGrantWithoutReply(
   work->SetStateCancelled();
 }
 
+void LocalLeaseManager::DecrementNumLeasesWaitingForWorker(
+    SchedulingClass scheduling_class) {
+  auto it = num_leases_waiting_for_worker_.find(scheduling_class);
+  RAY_CHECK(it != num_leases_waiting_for_worker_.end());
+  if (--it->second == 0) {
+    num_leases_waiting_for_worker_.erase(it);
+  }
+}
+
 const RayLease *LocalLeaseManager::AnyPendingLeasesForResourceAcquisition(
     int *num_pending_actor_creation, int *num_pending_leases) const {
   const RayLease *exemplar = nullptr;
@@ -1033,8 +1089,13 @@ void LocalLeaseManager::Grant(
 
 void LocalLeaseManager::ClearWorkerBacklog(const WorkerID &worker_id) {
   for (auto it = backlog_tracker_.begin(); it != backlog_tracker_.end();) {
-    it->second.erase(worker_id);
+    auto worker_it = it->second.find(worker_id);
+    if (worker_it != it->second.end()) {
+      backlog_size_sum_[it->first] -= worker_it->second;
+      it->second.erase(worker_it);
+    }
     if (it->second.empty()) {
+      backlog_size_sum_.erase(it->first);
       backlog_tracker_.erase(it++);
     } else {
       ++it;
@@ -1046,12 +1107,23 @@ void LocalLeaseManager::SetWorkerBacklog(SchedulingClass scheduling_class,
                                          const WorkerID &worker_id,
                                          int64_t backlog_size) {
   if (backlog_size == 0) {
-    backlog_tracker_[scheduling_class].erase(worker_id);
-    if (backlog_tracker_[scheduling_class].empty()) {
-      backlog_tracker_.erase(scheduling_class);
+    auto it = backlog_tracker_.find(scheduling_class);
+    if (it == backlog_tracker_.end()) {
+      return;
+    }
+    auto worker_it = it->second.find(worker_id);
+    if (worker_it != it->second.end()) {
+      backlog_size_sum_[scheduling_class] -= worker_it->second;
+      it->second.erase(worker_it);
+    }
+    if (it->second.empty()) {
+      backlog_size_sum_.erase(scheduling_class);
+      backlog_tracker_.erase(it);
     }
   } else {
-    backlog_tracker_[scheduling_class][worker_id] = backlog_size;
+    auto &worker_backlog = backlog_tracker_[scheduling_class][worker_id];
+    backlog_size_sum_[scheduling_class] += backlog_size - worker_backlog;
+    worker_backlog = backlog_size;
   }
 }
 
@@ -181,6 +181,16 @@ class LocalLeaseManager : public LocalLeaseManagerInterface {
     return backlog_tracker_;
   }
 
+  const absl::flat_hash_map<SchedulingClass, int64_t> &GetBacklogSizeSum()
+      const override {
+    return backlog_size_sum_;
+  }
+
+  const absl::flat_hash_map<SchedulingClass, size_t> &GetNumLeasesWaitingForWorker()
+      const override {
+    return num_leases_waiting_for_worker_;
+  }
+
   void RecordMetrics() const override;
 
   SchedulerMetrics &GetSchedulerMetrics() const override { return scheduler_metrics_; }
@@ -219,6 +229,12 @@ class LocalLeaseManager : public LocalLeaseManagerInterface {
   /// Cancels a lease in leases_to_grant_. Does not remove it from leases_to_grant_.
   void CancelLeaseToGrantWithoutReply(const std::shared_ptr<internal::Work> &work);
 
+  /// Decrement the `num_leases_waiting_for_worker_` entry of the given
+  /// scheduling class, erasing the entry when it drops to zero. Must be called
+  /// whenever a lease with resources allocated leaves the waiting-for-worker
+  /// state.
+  void DecrementNumLeasesWaitingForWorker(SchedulingClass scheduling_class);
+
   /// Attempts to grant all leases which are ready to run. A lease
   /// will be granted if it is on `leases_to_grant_` and there are still
   /// available resources on the node.
@@ -349,6 +365,17 @@ class LocalLeaseManager : public LocalLeaseManagerInterface {
   absl::flat_hash_map<SchedulingClass, absl::flat_hash_map<WorkerID, int64_t>>
       backlog_tracker_;
 
+  /// Per scheduling class sum of the backlog sizes in `backlog_tracker_`,
+  /// so resource reports don't iterate over all the backlogged workers.
+  /// Entries are erased together with the `backlog_tracker_` entries.
+  absl::flat_hash_map<SchedulingClass, int64_t> backlog_size_sum_;
+
+  /// Per scheduling class count of the leases in `leases_to_grant_` that have
+  /// resources allocated (i.e. are in the WAITING_FOR_WORKER state), so
+  /// resource reports don't iterate over all the queued leases. Entries are
+  /// erased when the count drops to zero.
+  absl::flat_hash_map<SchedulingClass, size_t> num_leases_waiting_for_worker_;
+
   WorkerPoolInterface &worker_pool_;
   absl::flat_hash_map<LeaseID, std::shared_ptr<WorkerInterface>> &leased_workers_;
 
@@ -69,6 +69,19 @@ class LocalLeaseManagerInterface {
                                     absl::flat_hash_map<WorkerID, int64_t>>
       &GetBackLogTracker() const = 0;
 
+  /// Per scheduling class sum of the backlog sizes in `GetBackLogTracker()`.
+  /// Maintained incrementally so that resource reports don't have to iterate
+  /// over all the workers with a backlog.
+  virtual const absl::flat_hash_map<SchedulingClass, int64_t> &GetBacklogSizeSum()
+      const = 0;
+
+  /// Per scheduling class count of the leases in `GetLeasesToGrant()` that
+  /// already have resources allocated and are waiting for a worker. Maintained
+  /// incrementally so that resource reports don't have to iterate over all the
+  /// queued leases.
+  virtual const absl::flat_hash_map<SchedulingClass, size_t>
+      &GetNumLeasesWaitingForWorker() const = 0;
+
   virtual void SetWorkerBacklog(SchedulingClass scheduling_class,
                                 const WorkerID &worker_id,
                                 int64_t backlog_size) = 0;
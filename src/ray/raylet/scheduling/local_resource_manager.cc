@@ -14,6 +14,8 @@
 
 #include "ray/raylet/scheduling/local_resource_manager.h"
 
+#include <google/protobuf/util/message_differencer.h>
+
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <csignal>
@@ -22,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "ray/common/ray_config.h"
 #include "ray/common/scheduling/placement_group_util.h"
 #include "ray/common/scheduling/resource_set.h"
 #include "ray/util/logging.h"
@@ -438,10 +441,31 @@ std::optional<syncer::RaySyncMessage> LocalResourceManager::CreateSyncMessage(
     return std::nullopt;
   }
 
+  const bool suppress_unchanged =
+      RayConfig::instance().syncer_suppress_unchanged_resource_view();
+  if (suppress_unchanged && version_ == last_unchanged_version_) {
+    // The view was already found identical to the last reported one at this
+    // version; don't re-serialize it on every poll.
+    return std::nullopt;
+  }
+
   syncer::RaySyncMessage msg;
   syncer::ResourceViewSyncMessage resource_view_sync_message;
   PopulateResourceViewSyncMessage(resource_view_sync_message);
 
+  if (suppress_unchanged) {
+    if (last_reported_view_.has_value() &&
+        google::protobuf::util::MessageDifferencer::Equivalent(
+            *last_reported_view_, resource_view_sync_message)) {
+      // The version counter moved, but the changes cancelled out and the view
+      // is byte-for-byte what the cluster already has.
+      last_unchanged_version_ = version_;
+      return std::nullopt;
+    }
+    last_reported_view_ = resource_view_sync_message;
+    last_unchanged_version_ = -1;
+  }
+
   msg.set_node_id(local_node_id_.Binary());
   msg.set_version(version_);
   msg.set_message_type(message_type);
@@ -451,7 +475,27 @@ std::optional<syncer::RaySyncMessage> LocalResourceManager::CreateSyncMessage(
   return std::make_optional(std::move(msg));
 }
 
+LocalResourceManager::ScopedResourceUpdateBatch::ScopedResourceUpdateBatch(
+    LocalResourceManager &manager)
+    : manager_(manager) {
+  ++manager_.resource_update_batch_depth_;
+}
+
+LocalResourceManager::ScopedResourceUpdateBatch::~ScopedResourceUpdateBatch() {
+  if (--manager_.resource_update_batch_depth_ == 0 &&
+      manager_.resource_update_batch_pending_) {
+    manager_.resource_update_batch_pending_ = false;
+    manager_.OnResourceOrStateChanged();
+  }
+}
+
 void LocalResourceManager::OnResourceOrStateChanged() {
+  if (resource_update_batch_depth_ > 0) {
+    // A ScopedResourceUpdateBatch is active; defer the notification to the
+    // outermost guard so the whole batch publishes a single view update.
+    resource_update_batch_pending_ = true;
+    return;
+  }
   if (IsLocalNodeDraining() && IsLocalNodeIdle()) {
     RAY_LOG(INFO) << "The node is drained, continue to shut down raylet...";
     rpc::NodeDeathInfo node_death_info = DeathInfoFromDrainRequest();
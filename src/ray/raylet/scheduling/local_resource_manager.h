@@ -178,6 +178,23 @@ class LocalResourceManager : public syncer::ReporterInterface {
   /// Generate node death info from existing drain request.
   rpc::NodeDeathInfo DeathInfoFromDrainRequest();
 
+  /// RAII guard that coalesces subscriber notifications across a batch of
+  /// resource mutations. While at least one guard is alive, resource or state
+  /// changes are recorded but not published; the last guard to be destroyed
+  /// publishes a single notification (and version bump) covering the whole
+  /// batch. Guards may nest.
+  class ScopedResourceUpdateBatch {
+   public:
+    explicit ScopedResourceUpdateBatch(LocalResourceManager &manager);
+    ~ScopedResourceUpdateBatch();
+
+    ScopedResourceUpdateBatch(const ScopedResourceUpdateBatch &) = delete;
+    ScopedResourceUpdateBatch &operator=(const ScopedResourceUpdateBatch &) = delete;
+
+   private:
+    LocalResourceManager &manager_;
+  };
+
  private:
   struct ResourceUsage {
     double avail;
@@ -255,6 +272,23 @@ class LocalResourceManager : public syncer::ReporterInterface {
   // Version of this resource. It will incr by one whenever the state changed.
   int64_t version_ = 0;
 
+  /// Number of live ScopedResourceUpdateBatch guards. While positive,
+  /// OnResourceOrStateChanged only records that a notification is pending.
+  int64_t resource_update_batch_depth_ = 0;
+  /// Whether a change happened while a batch guard was active, so the
+  /// outermost guard needs to publish a notification on destruction.
+  bool resource_update_batch_pending_ = false;
+
+  /// The resource view that was last handed to the syncer, used to suppress
+  /// rebroadcasting identical content when the version counter was bumped by
+  /// changes that cancelled out (e.g. an acquire followed by a release).
+  /// Mutable because CreateSyncMessage is const. Only used when
+  /// RayConfig::syncer_suppress_unchanged_resource_view is set.
+  mutable std::optional<syncer::ResourceViewSyncMessage> last_reported_view_;
+  /// The version that was last found identical to last_reported_view_, to skip
+  /// re-serializing the view on every poll until the version moves again.
+  mutable int64_t last_unchanged_version_ = -1;
+
   /// The draining request this node received.
   std::optional<rpc::DrainRayletRequest> drain_request_;
 
@@ -278,6 +312,7 @@ class LocalResourceManager : public syncer::ReporterInterface {
   FRIEND_TEST(LocalResourceManagerTest, MaybeMarkFootprintAsBusyPreservesIdleTime);
   FRIEND_TEST(LocalResourceManagerTest, MarkFootprintAsBusyResetsIdleTime);
   FRIEND_TEST(LocalResourceManagerTest, NodeWorkersBusyClearsSavedPullingTime);
+  FRIEND_TEST(LocalResourceManagerTest, ScopedResourceUpdateBatchCoalescesNotifications);
 };
 
 }  // end namespace ray
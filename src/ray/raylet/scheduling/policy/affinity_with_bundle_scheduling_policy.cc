@@ -60,27 +60,36 @@ scheduling::NodeID AffinityWithBundleSchedulingPolicy::Schedule(
     }
   } else {
     const PlacementGroupID &pg_id = bundle_id.first;
-    const auto &bundle_locations_opt = bundle_location_index_.GetBundleLocations(pg_id);
-    if (bundle_locations_opt) {
-      // Find a target with gpu nodes avoided (if required).
-      if (options.avoid_gpu_nodes_) {
-        for (const auto &iter : *(bundle_locations_opt.value())) {
-          auto target_node_id = scheduling::NodeID(iter.second.first.Binary());
-          if (IsNodeFeasibleAndAvailable(
-                  target_node_id, resource_request, /*avoid_gpu_nodes=*/true)) {
-            return target_node_id;
-          }
-        }
-      }
-      // Find a target from all nodes.
-      for (const auto &iter : *(bundle_locations_opt.value())) {
-        auto target_node_id = scheduling::NodeID(iter.second.first.Binary());
+    // Iterate the distinct nodes hosting the PG's bundles via the compact index
+    // instead of walking the per-bundle map, which would visit each node once per
+    // bundle placed on it.
+    scheduling::NodeID result = scheduling::NodeID::Nil();
+    // Find a target with gpu nodes avoided (if required).
+    if (options.avoid_gpu_nodes_) {
+      bundle_location_index_.ForEachBundleNode(pg_id, [&](const NodeID &node_id) {
+        auto target_node_id = scheduling::NodeID(node_id.Binary());
         if (IsNodeFeasibleAndAvailable(
-                target_node_id, resource_request, /*avoid_gpu_nodes=*/false)) {
-          return target_node_id;
+                target_node_id, resource_request, /*avoid_gpu_nodes=*/true)) {
+          result = target_node_id;
+          return false;
         }
+        return true;
+      });
+      if (!result.IsNil()) {
+        return result;
       }
     }
+    // Find a target from all nodes.
+    bundle_location_index_.ForEachBundleNode(pg_id, [&](const NodeID &node_id) {
+      auto target_node_id = scheduling::NodeID(node_id.Binary());
+      if (IsNodeFeasibleAndAvailable(
+              target_node_id, resource_request, /*avoid_gpu_nodes=*/false)) {
+        result = target_node_id;
+        return false;
+      }
+      return true;
+    });
+    return result;
   }
   return scheduling::NodeID::Nil();
 }
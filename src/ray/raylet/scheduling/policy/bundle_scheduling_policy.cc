@@ -14,9 +14,31 @@
 
 #include "ray/raylet/scheduling/policy/bundle_scheduling_policy.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "absl/time/clock.h"
+
 namespace ray {
 namespace raylet_scheduling_policy {
 
+namespace {
+
+/// A partial assignment of bundles to nodes explored by the lookahead beam
+/// search of the PACK policy.
+struct BeamState {
+  /// The node selected for each already placed bundle, in request order.
+  std::vector<scheduling::NodeID> assignment;
+  /// The resources consumed on each node by this partial assignment.
+  absl::flat_hash_map<scheduling::NodeID, ResourceRequest> used;
+  /// Fragmentation cost of this partial assignment: one point per distinct
+  /// node used, plus the headroom left by each placement. Lower means fewer,
+  /// fuller nodes.
+  double cost = 0;
+};
+
+}  // namespace
+
 SchedulingResult SortSchedulingResult(const SchedulingResult &result,
                                       const std::vector<int> &sorted_index) {
   if (result.status.IsSuccess()) {
@@ -175,6 +197,16 @@ SchedulingResult BundlePackSchedulingPolicy::Schedule(
     return SchedulingResult::Infeasible();
   }
 
+  if (options.bundle_lookahead_beam_width_ > 0) {
+    auto lookahead_result =
+        ScheduleWithLookahead(sorted_resource_request_list, candidate_nodes, options);
+    if (lookahead_result.status.IsSuccess()) {
+      return SortSchedulingResult(lookahead_result, sorted_index);
+    }
+    RAY_LOG(DEBUG) << "Bundle placement lookahead found no assignment within "
+                      "budget, falling back to greedy placement.";
+  }
+
   std::vector<scheduling::NodeID> result_nodes;
   result_nodes.resize(sorted_resource_request_list.size());
   std::list<std::pair<int, const ResourceRequest *>> required_resources_list_copy;
@@ -234,6 +266,76 @@ SchedulingResult BundlePackSchedulingPolicy::Schedule(
                               sorted_index);
 }
 
+SchedulingResult BundlePackSchedulingPolicy::ScheduleWithLookahead(
+    const std::vector<const ResourceRequest *> &resource_request_list,
+    const absl::flat_hash_map<scheduling::NodeID, const Node *> &candidate_nodes,
+    const SchedulingOptions &options) const {
+  const int64_t deadline_ns =
+      options.bundle_lookahead_time_budget_ms_ > 0
+          ? absl::GetCurrentTimeNanos() +
+                options.bundle_lookahead_time_budget_ms_ * 1000 * 1000
+          : std::numeric_limits<int64_t>::max();
+
+  // Start from the empty assignment and extend every surviving partial
+  // assignment by one bundle per round, keeping the `beam_width` cheapest.
+  std::vector<BeamState> beam(1);
+  for (const auto &resource_request : resource_request_list) {
+    if (absl::GetCurrentTimeNanos() > deadline_ns) {
+      return SchedulingResult::Failed();
+    }
+
+    std::vector<BeamState> extended;
+    for (const auto &state : beam) {
+      for (const auto &[node_id, node] : candidate_nodes) {
+        const auto &node_resources = node->GetLocalView();
+        if (!node_resources.IsFeasible(*resource_request)) {
+          continue;
+        }
+
+        // Add this bundle on top of what the partial assignment has already
+        // placed on the node, and check that the combined demand still fits.
+        auto used_iter = state.used.find(node_id);
+        const bool first_use = used_iter == state.used.end();
+        ResourceRequest combined =
+            first_use ? ResourceRequest() : used_iter->second;
+        for (const auto &resource_id : resource_request->ResourceIds()) {
+          combined.Set(resource_id,
+                       combined.Get(resource_id) + resource_request->Get(resource_id));
+        }
+        combined.SetLabelSelector(resource_request->GetLabelSelector());
+        const double headroom = node_scorer_->Score(combined, node_resources);
+        if (headroom < 0) {
+          continue;
+        }
+
+        BeamState extended_state = state;
+        extended_state.assignment.emplace_back(node_id);
+        extended_state.used[node_id] = std::move(combined);
+        extended_state.cost = state.cost + headroom + (first_use ? 1. : 0.);
+        extended.emplace_back(std::move(extended_state));
+      }
+    }
+    if (extended.empty()) {
+      // Some bundle cannot be placed under any surviving partial assignment.
+      return SchedulingResult::Failed();
+    }
+
+    const size_t beam_width =
+        std::min(extended.size(),
+                 static_cast<size_t>(options.bundle_lookahead_beam_width_));
+    std::partial_sort(extended.begin(),
+                      extended.begin() + beam_width,
+                      extended.end(),
+                      [](const BeamState &a, const BeamState &b) {
+                        return a.cost < b.cost;
+                      });
+    extended.resize(beam_width);
+    beam = std::move(extended);
+  }
+
+  return SchedulingResult::Success(std::move(beam.front().assignment));
+}
+
 //////////////////////  BundleSpreadSchedulingPolicy  ///////////////////////////
 SchedulingResult BundleSpreadSchedulingPolicy::Schedule(
     const std::vector<const ResourceRequest *> &resource_request_list,
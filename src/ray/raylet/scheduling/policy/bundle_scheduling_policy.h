@@ -88,6 +88,27 @@ class BundlePackSchedulingPolicy : public BundleSchedulingPolicy {
   SchedulingResult Schedule(
       const std::vector<const ResourceRequest *> &resource_request_list,
       SchedulingOptions options) override;
+
+ protected:
+  /// Search for an assignment of the whole bundle set with a scored beam
+  /// over candidate per-bundle placements, preferring fewer, fuller nodes.
+  /// Unlike the greedy pass, the search keeps several partial assignments
+  /// alive, so placing one bundle on the node with the most headroom cannot
+  /// strand a later bundle that only fits there.
+  ///
+  /// \param resource_request_list The bundle resource requests, already
+  /// sorted by scheduling priority.
+  /// \param candidate_nodes The candidate nodes available for scheduling.
+  /// \param options The scheduling options carrying the beam width and the
+  /// time budget.
+  /// \return A successful result with one node per request on success;
+  /// a failed result if no assignment was found or the time budget was
+  /// exceeded. The caller is expected to fall back to greedy placement on
+  /// failure.
+  SchedulingResult ScheduleWithLookahead(
+      const std::vector<const ResourceRequest *> &resource_request_list,
+      const absl::flat_hash_map<scheduling::NodeID, const Node *> &candidate_nodes,
+      const SchedulingOptions &options) const;
 };
 
 class BundleSpreadSchedulingPolicy : public BundleSchedulingPolicy {
@@ -36,7 +36,12 @@ class CompositeSchedulingPolicy : public ISchedulingPolicy {
                             ClusterResourceManager &cluster_resource_manager,
                             std::function<bool(scheduling::NodeID)> is_node_available)
       : hybrid_policy_(
-            local_node_id, cluster_resource_manager.GetResourceView(), is_node_available),
+            local_node_id,
+            cluster_resource_manager.GetResourceView(),
+            is_node_available,
+            [&cluster_resource_manager](scheduling::ResourceID resource_id) {
+              return cluster_resource_manager.GetNodesWithTotalResource(resource_id);
+            }),
         random_policy_(
             local_node_id, cluster_resource_manager.GetResourceView(), is_node_available),
         spread_policy_(
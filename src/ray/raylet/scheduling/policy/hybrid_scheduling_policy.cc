@@ -16,6 +16,8 @@
 
 #include <functional>
 
+#include "ray/common/ray_config.h"
+
 namespace ray {
 
 namespace raylet_scheduling_policy {
@@ -117,11 +119,32 @@ scheduling::NodeID HybridSchedulingPolicy::ScheduleImpl(
       preferred_node_id = new_id;
     }
   }
-  for (const auto &pair : nodes_) {
-    const auto &node_id = pair.first;
-    const auto &node_resources = pair.second.GetLocalView();
+  // When the feasibility index is enabled, restrict the scan to the nodes
+  // whose totals include the request's rarest explicit resource. Nodes
+  // outside that bucket lack the resource entirely and can never be
+  // feasible, so skipping them does not change the scheduling decision.
+  const absl::flat_hash_set<scheduling::NodeID> *candidate_nodes = nullptr;
+  if (get_nodes_with_resource_ != nullptr &&
+      RayConfig::instance().scheduler_feasibility_index_enabled()) {
+    for (const auto &resource_id : resource_request.ResourceIds()) {
+      if (resource_id.IsImplicitResource() || resource_request.Get(resource_id) <= 0) {
+        continue;
+      }
+      const auto *bucket = get_nodes_with_resource_(resource_id);
+      if (bucket == nullptr) {
+        // No node in the cluster has this resource at all.
+        return scheduling::NodeID::Nil();
+      }
+      if (candidate_nodes == nullptr || bucket->size() < candidate_nodes->size()) {
+        candidate_nodes = bucket;
+      }
+    }
+  }
+
+  auto process_node = [&](const scheduling::NodeID &node_id,
+                          const NodeResources &node_resources) {
     if (force_spillback && node_id == preferred_node_id) {
-      continue;
+      return;
     }
     if (IsNodeFeasible(node_id, node_filter, node_resources, resource_request)) {
       bool ignore_pull_manager_at_capacity = false;
@@ -150,6 +173,19 @@ scheduling::NodeID HybridSchedulingPolicy::ScheduleImpl(
         feasible_and_unavailable_nodes.push_back({node_id, node_score});
       }
     }
+  };
+
+  if (candidate_nodes != nullptr) {
+    for (const auto &node_id : *candidate_nodes) {
+      auto it = nodes_.find(node_id);
+      if (it != nodes_.end()) {
+        process_node(node_id, it->second.GetLocalView());
+      }
+    }
+  } else {
+    for (const auto &pair : nodes_) {
+      process_node(pair.first, pair.second.GetLocalView());
+    }
   }
 
   size_t num_candidate_nodes =
@@ -16,9 +16,12 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
 #include "absl/random/bit_gen_ref.h"
 #include "absl/random/random.h"
 #include "ray/raylet/scheduling/policy/scheduling_policy.h"
@@ -49,12 +52,21 @@ namespace raylet_scheduling_policy {
 ///
 class HybridSchedulingPolicy : public ISchedulingPolicy {
  public:
+  /// Returns the nodes whose total resources include the given resource, or
+  /// nullptr if no node has it. See
+  /// ClusterResourceManager::GetNodesWithTotalResource.
+  using GetNodesWithResource =
+      std::function<const absl::flat_hash_set<scheduling::NodeID> *(
+          scheduling::ResourceID)>;
+
   HybridSchedulingPolicy(scheduling::NodeID local_node_id,
                          const absl::flat_hash_map<scheduling::NodeID, Node> &nodes,
-                         std::function<bool(scheduling::NodeID)> is_node_alive)
+                         std::function<bool(scheduling::NodeID)> is_node_alive,
+                         GetNodesWithResource get_nodes_with_resource = nullptr)
       : local_node_id_(local_node_id),
         nodes_(nodes),
         is_node_alive_(is_node_alive),
+        get_nodes_with_resource_(std::move(get_nodes_with_resource)),
         bitgen_(),
         bitgenref_(bitgen_) {}
 
@@ -130,6 +142,10 @@ class HybridSchedulingPolicy : public ISchedulingPolicy {
   const absl::flat_hash_map<scheduling::NodeID, Node> &nodes_;
   /// Function Checks if node is alive.
   std::function<bool(scheduling::NodeID)> is_node_alive_;
+  /// Feasibility index used to restrict the per-request node scan when
+  /// scheduler_feasibility_index_enabled is set. May be nullptr, in which
+  /// case every node is scanned.
+  GetNodesWithResource get_nodes_with_resource_;
   /// Random number generator to choose a random node out of the top K.
   mutable absl::BitGen bitgen_;
   /// Using BitGenRef to simplify testing.
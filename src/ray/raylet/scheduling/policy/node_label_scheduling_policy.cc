@@ -14,6 +14,11 @@
 
 #include "ray/raylet/scheduling/policy/node_label_scheduling_policy.h"
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "ray/raylet/scheduling/policy/scheduling_context.h"
 
 namespace ray {
@@ -94,71 +99,80 @@ absl::flat_hash_map<scheduling::NodeID, const Node *>
 NodeLabelSchedulingPolicy::FilterNodesByLabelMatchExpressions(
     const absl::flat_hash_map<scheduling::NodeID, const Node *> &candidate_nodes,
     const rpc::LabelMatchExpressions &expressions) const {
-  auto match_nodes = candidate_nodes;
-  for (const auto &expression : expressions.expressions()) {
-    if (match_nodes.empty()) {
-      return match_nodes;
-    }
-
-    for (auto iter = match_nodes.begin(); iter != match_nodes.end(); iter++) {
-      if (!IsNodeMatchLabelExpression(*(iter->second), expression)) {
-        match_nodes.erase(iter);
-      }
+  // Compile the expressions once, then evaluate the flat predicate program
+  // against each node; the per-node work is a label lookup and a binary search
+  // per predicate.
+  const auto predicates = CompileLabelMatchExpressions(expressions);
+  absl::flat_hash_map<scheduling::NodeID, const Node *> match_nodes;
+  for (const auto &pair : candidate_nodes) {
+    if (IsNodeMatchLabelPredicates(*pair.second, predicates)) {
+      match_nodes.emplace(pair.first, pair.second);
     }
   }
   return match_nodes;
 }
 
-bool NodeLabelSchedulingPolicy::IsNodeMatchLabelExpression(
-    const Node &node, const rpc::LabelMatchExpression &expression) const {
-  const auto &key = expression.key();
-  const auto &match_operator = expression.operator_();
-  if (match_operator.has_label_exists()) {
-    if (IsNodeLabelKeyExists(node, key)) {
-      return true;
-    }
-  } else if (match_operator.has_label_does_not_exist()) {
-    if (!IsNodeLabelKeyExists(node, key)) {
-      return true;
-    }
-  } else if (match_operator.has_label_in()) {
-    absl::flat_hash_set<std::string> values;
-    for (const auto &value : match_operator.label_in().values()) {
-      values.insert(value);
-    }
-    if (IsNodeLabelInValues(node, key, values)) {
-      return true;
-    }
-  } else if (match_operator.has_label_not_in()) {
-    absl::flat_hash_set<std::string> values;
-    for (const auto &value : match_operator.label_not_in().values()) {
-      values.insert(value);
-    }
-    if (!IsNodeLabelInValues(node, key, values)) {
-      return true;
+std::vector<NodeLabelSchedulingPolicy::CompiledLabelPredicate>
+NodeLabelSchedulingPolicy::CompileLabelMatchExpressions(
+    const rpc::LabelMatchExpressions &expressions) const {
+  std::vector<CompiledLabelPredicate> predicates;
+  predicates.reserve(expressions.expressions().size());
+  for (const auto &expression : expressions.expressions()) {
+    CompiledLabelPredicate predicate;
+    predicate.key = expression.key();
+    const auto &match_operator = expression.operator_();
+    if (match_operator.has_label_exists()) {
+      predicate.op = CompiledLabelPredicate::Op::kExists;
+    } else if (match_operator.has_label_does_not_exist()) {
+      predicate.op = CompiledLabelPredicate::Op::kDoesNotExist;
+    } else if (match_operator.has_label_in()) {
+      predicate.op = CompiledLabelPredicate::Op::kIn;
+      predicate.values.assign(match_operator.label_in().values().begin(),
+                              match_operator.label_in().values().end());
+    } else if (match_operator.has_label_not_in()) {
+      predicate.op = CompiledLabelPredicate::Op::kNotIn;
+      predicate.values.assign(match_operator.label_not_in().values().begin(),
+                              match_operator.label_not_in().values().end());
+    } else {
+      RAY_CHECK(false) << "Node label match operator type must be one of `label_in`、"
+                          "`label_not_in`、`label_exists` or `label_does_not_exist`.";
     }
-  } else {
-    RAY_CHECK(false) << "Node label match operator type must be one of `label_in`、"
-                        "`label_not_in`、`label_exists` or `label_does_not_exist`.";
+    std::sort(predicate.values.begin(), predicate.values.end());
+    predicates.push_back(std::move(predicate));
   }
-  return false;
-}
-
-bool NodeLabelSchedulingPolicy::IsNodeLabelKeyExists(const Node &node,
-                                                     const std::string &key) const {
-  return node.GetLocalView().labels.contains(key);
+  return predicates;
 }
 
-bool NodeLabelSchedulingPolicy::IsNodeLabelInValues(
-    const Node &node,
-    const std::string &key,
-    const absl::flat_hash_set<std::string> &values) const {
+bool NodeLabelSchedulingPolicy::IsNodeMatchLabelPredicates(
+    const Node &node, const std::vector<CompiledLabelPredicate> &predicates) const {
   const auto &node_labels = node.GetLocalView().labels;
-  if (!node_labels.contains(key)) {
-    return false;
+  for (const auto &predicate : predicates) {
+    auto label_it = node_labels.find(predicate.key);
+    const bool key_exists = label_it != node_labels.end();
+    bool match = false;
+    switch (predicate.op) {
+    case CompiledLabelPredicate::Op::kExists:
+      match = key_exists;
+      break;
+    case CompiledLabelPredicate::Op::kDoesNotExist:
+      match = !key_exists;
+      break;
+    case CompiledLabelPredicate::Op::kIn:
+      match = key_exists && std::binary_search(predicate.values.begin(),
+                                               predicate.values.end(),
+                                               label_it->second);
+      break;
+    case CompiledLabelPredicate::Op::kNotIn:
+      match = !key_exists || !std::binary_search(predicate.values.begin(),
+                                                 predicate.values.end(),
+                                                 label_it->second);
+      break;
+    }
+    if (!match) {
+      return false;
+    }
   }
-
-  return values.contains(node_labels.at(key));
+  return true;
 }
 
 absl::flat_hash_map<scheduling::NodeID, const Node *>
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "ray/raylet/scheduling/policy/scheduling_policy.h"
@@ -36,14 +37,23 @@ class NodeLabelSchedulingPolicy : public ISchedulingPolicy {
                               SchedulingOptions options) override;
 
  private:
-  bool IsNodeMatchLabelExpression(const Node &node,
-                                  const rpc::LabelMatchExpression &expression) const;
+  /// A label match expression compiled into a flat predicate: the operator is a
+  /// plain enum and the value list is a sorted array probed with binary search.
+  /// Expressions are compiled once per scheduling decision instead of having
+  /// their value lists rebuilt into hash sets once per candidate node.
+  struct CompiledLabelPredicate {
+    enum class Op { kExists, kDoesNotExist, kIn, kNotIn };
+    std::string key;
+    Op op;
+    /// Sorted expression values; empty for the existence operators.
+    std::vector<std::string> values;
+  };
 
-  bool IsNodeLabelKeyExists(const Node &node, const std::string &key) const;
+  std::vector<CompiledLabelPredicate> CompileLabelMatchExpressions(
+      const rpc::LabelMatchExpressions &expressions) const;
 
-  bool IsNodeLabelInValues(const Node &node,
-                           const std::string &key,
-                           const absl::flat_hash_set<std::string> &values) const;
+  bool IsNodeMatchLabelPredicates(
+      const Node &node, const std::vector<CompiledLabelPredicate> &predicates) const;
 
   absl::flat_hash_map<scheduling::NodeID, const Node *> SelectAvailableNodes(
       const absl::flat_hash_map<scheduling::NodeID, const Node *> &candidate_nodes,
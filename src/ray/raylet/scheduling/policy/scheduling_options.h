@@ -125,11 +125,17 @@ struct SchedulingOptions {
 
   // construct option for soft pack scheduling policy.
   static SchedulingOptions BundlePack() {
-    return SchedulingOptions(SchedulingType::BUNDLE_PACK,
-                             /*spread_threshold*/ 0,
-                             /*avoid_local_node*/ false,
-                             /*require_node_available*/ true,
-                             /*avoid_gpu_nodes*/ false);
+    SchedulingOptions scheduling_options =
+        SchedulingOptions(SchedulingType::BUNDLE_PACK,
+                          /*spread_threshold*/ 0,
+                          /*avoid_local_node*/ false,
+                          /*require_node_available*/ true,
+                          /*avoid_gpu_nodes*/ false);
+    scheduling_options.bundle_lookahead_beam_width_ =
+        RayConfig::instance().bundle_scheduling_lookahead_beam_width();
+    scheduling_options.bundle_lookahead_time_budget_ms_ =
+        RayConfig::instance().bundle_scheduling_lookahead_time_budget_ms();
+    return scheduling_options;
   }
 
   // construct option for strict spread scheduling policy.
@@ -175,6 +181,14 @@ struct SchedulingOptions {
   // Otherwise, the bundles can be placed elsewhere.
   // This is only used by PG STRICT_PACK scheduling.
   scheduling::NodeID bundle_strict_pack_soft_target_node_id_ = scheduling::NodeID::Nil();
+  // Width of the beam search over whole-bundle-set placements used by the PG
+  // PACK policy. 0 disables the lookahead and keeps greedy per-bundle
+  // placement.
+  int64_t bundle_lookahead_beam_width_ = 0;
+  // Wall-clock budget for the bundle placement lookahead search; when the
+  // budget is exceeded the policy falls back to greedy placement.
+  // Non-positive values disable the budget.
+  int64_t bundle_lookahead_time_budget_ms_ = 0;
   std::shared_ptr<SchedulingContext> scheduling_context_;
   std::string node_affinity_node_id_;
   bool node_affinity_soft_ = false;
@@ -146,6 +146,67 @@ TEST_F(HybridSchedulingPolicyTest, GetBestNodePrioritizePreferredNode) {
   }
 }
 
+TEST_F(HybridSchedulingPolicyTest, FeasibilityIndexRestrictsScan) {
+  nodes.emplace(local_node, CreateNodeResources(10, 10, 0, 0, 0, 0));
+  nodes.emplace(n1, CreateNodeResources(10, 10, 0, 0, 0, 0));
+  nodes.emplace(n2, CreateNodeResources(10, 10, 0, 0, 4, 4));
+
+  // Build the index the same way ClusterResourceManager maintains it: one
+  // bucket of nodes per explicit total resource.
+  absl::flat_hash_map<scheduling::ResourceID, absl::flat_hash_set<scheduling::NodeID>>
+      index;
+  for (const auto &[node_id, node] : nodes) {
+    for (const auto &resource_id : node.GetLocalView().total.ExplicitResourceIds()) {
+      index[resource_id].insert(node_id);
+    }
+  }
+  int num_lookups = 0;
+  HybridSchedulingPolicy policy{
+      local_node,
+      nodes,
+      [](auto) { return true; },
+      [&index, &num_lookups](scheduling::ResourceID resource_id)
+          -> const absl::flat_hash_set<scheduling::NodeID> * {
+        num_lookups++;
+        auto it = index.find(resource_id);
+        return it == index.end() ? nullptr : &it->second;
+      }};
+
+  RayConfig::instance().scheduler_feasibility_index_enabled() = true;
+  // A GPU request only considers the GPU node's bucket.
+  auto gpu_request = ResourceMapToResourceRequest(
+      {{"GPU", 1}}, /*requires_object_store_memory=*/false);
+  EXPECT_EQ(policy.Schedule(gpu_request,
+                            HybridOptions(0.5,
+                                          /*avoid_local_node=*/false,
+                                          /*require_node_available=*/true,
+                                          /*avoid_gpu_nodes=*/false)),
+            n2);
+  EXPECT_GT(num_lookups, 0);
+
+  // A request naming a resource no node has is infeasible without a scan.
+  auto infeasible_request = ResourceMapToResourceRequest(
+      {{"CUSTOM", 1}}, /*requires_object_store_memory=*/false);
+  EXPECT_TRUE(policy
+                  .Schedule(infeasible_request,
+                            HybridOptions(0.5,
+                                          /*avoid_local_node=*/false,
+                                          /*require_node_available=*/true,
+                                          /*avoid_gpu_nodes=*/false))
+                  .IsNil());
+
+  // The full scan reaches the same decision with the index disabled.
+  RayConfig::instance().scheduler_feasibility_index_enabled() = false;
+  num_lookups = 0;
+  EXPECT_EQ(policy.Schedule(gpu_request,
+                            HybridOptions(0.5,
+                                          /*avoid_local_node=*/false,
+                                          /*require_node_available=*/true,
+                                          /*avoid_gpu_nodes=*/false)),
+            n2);
+  EXPECT_EQ(num_lookups, 0);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -565,6 +565,44 @@ TEST_F(SchedulingPolicyTest, StrictPackBundleSchedulingTest) {
   ASSERT_EQ(to_schedule.selected_nodes[0], local_node);
 }
 
+TEST_F(SchedulingPolicyTest, PackBundleLookaheadSchedulingTest) {
+  /*
+   * Test that the lookahead placement mode of the pack bundle scheduling
+   * policy finds an assignment that greedy per-bundle placement misses.
+   * Greedy places the CPU:4 bundle on the node with the most headroom
+   * (local_node, CPU:6), which strands the second CPU:3 bundle. The
+   * lookahead places CPU:4 on remote_node and both CPU:3 bundles on
+   * local_node.
+   */
+  nodes.emplace(local_node, CreateNodeResources(6, 6, 0, 0, 0, 0));
+  nodes.emplace(remote_node, CreateNodeResources(4, 4, 0, 0, 0, 0));
+  auto cluster_resource_manager = MockClusterResourceManager(nodes);
+
+  ResourceRequest req_3 = ResourceMapToResourceRequest({{"CPU", 3}}, false);
+  ResourceRequest req_4 = ResourceMapToResourceRequest({{"CPU", 4}}, false);
+  std::vector<const ResourceRequest *> req_list = {&req_3, &req_3, &req_4};
+
+  // Greedy placement fails on this cluster.
+  auto pack_op = SchedulingOptions::BundlePack();
+  pack_op.bundle_lookahead_beam_width_ = 0;
+  auto to_schedule = raylet_scheduling_policy::BundlePackSchedulingPolicy(
+                         *cluster_resource_manager, [](auto) { return true; })
+                         .Schedule(req_list, pack_op);
+  ASSERT_TRUE(to_schedule.status.IsFailed());
+
+  // The lookahead finds the only workable assignment.
+  pack_op.bundle_lookahead_beam_width_ = 3;
+  pack_op.bundle_lookahead_time_budget_ms_ = 1000;
+  to_schedule = raylet_scheduling_policy::BundlePackSchedulingPolicy(
+                    *cluster_resource_manager, [](auto) { return true; })
+                    .Schedule(req_list, pack_op);
+  ASSERT_TRUE(to_schedule.status.IsSuccess());
+  ASSERT_EQ(to_schedule.selected_nodes.size(), 3);
+  ASSERT_EQ(to_schedule.selected_nodes[0], local_node);
+  ASSERT_EQ(to_schedule.selected_nodes[1], local_node);
+  ASSERT_EQ(to_schedule.selected_nodes[2], remote_node);
+}
+
 TEST_F(SchedulingPolicyTest, StrictPackBundleLabelSelectorSuccessTest) {
   nodes.emplace(local_node, CreateNodeResourcesWithLabels(10, 10, {{"zone", "us-east"}}));
   nodes.emplace(remote_node,
@@ -16,6 +16,7 @@
 
 #include <google/protobuf/util/json_util.h>
 
+#include <algorithm>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/join.hpp>
@@ -40,20 +41,17 @@ SchedulerResourceReporter::SchedulerResourceReporter(
       leases_to_schedule_(leases_to_schedule),
       leases_to_grant_(local_lease_manager.GetLeasesToGrant()),
       infeasible_leases_(infeasible_leases),
-      backlog_tracker_(local_lease_manager.GetBackLogTracker()) {}
+      backlog_size_sum_(local_lease_manager.GetBacklogSizeSum()),
+      num_leases_waiting_for_worker_(
+          local_lease_manager.GetNumLeasesWaitingForWorker()) {}
 
 int64_t SchedulerResourceReporter::TotalBacklogSize(
     SchedulingClass scheduling_class) const {
-  auto backlog_it = backlog_tracker_.find(scheduling_class);
-  if (backlog_it == backlog_tracker_.end()) {
+  auto backlog_it = backlog_size_sum_.find(scheduling_class);
+  if (backlog_it == backlog_size_sum_.end()) {
     return 0;
   }
-
-  int64_t sum = 0;
-  for (const auto &worker_id_and_backlog_size : backlog_it->second) {
-    sum += worker_id_and_backlog_size.second;
-  }
-  return sum;
+  return backlog_it->second;
 }
 
 void SchedulerResourceReporter::FillResourceUsage(rpc::ResourcesData &data) const {
@@ -137,14 +135,13 @@ void SchedulerResourceReporter::FillResourceUsage(rpc::ResourcesData &data) cons
   fill_resource_usage_helper(
       leases_to_schedule_ | boost::adaptors::transformed(transform_func), false);
   auto leases_to_grant_range =
-      leases_to_grant_ | boost::adaptors::transformed([](const auto &pair) {
+      leases_to_grant_ | boost::adaptors::transformed([this](const auto &pair) {
         auto cnt = pair.second.size();
         // We should only report leases to be granted that do not have resources
         // allocated.
-        for (const auto &lease : pair.second) {
-          if (lease->allocated_instances_) {
-            cnt--;
-          }
+        auto allocated_it = num_leases_waiting_for_worker_.find(pair.first);
+        if (allocated_it != num_leases_waiting_for_worker_.end()) {
+          cnt -= std::min(cnt, allocated_it->second);
         }
         return std::make_pair(pair.first, cnt);
       });
@@ -152,7 +149,7 @@ void SchedulerResourceReporter::FillResourceUsage(rpc::ResourcesData &data) cons
 
   fill_resource_usage_helper(
       infeasible_leases_ | boost::adaptors::transformed(transform_func), true);
-  auto backlog_tracker_range = backlog_tracker_ |
+  auto backlog_tracker_range = backlog_size_sum_ |
                                boost::adaptors::transformed([](const auto &pair) {
                                  return std::make_pair(pair.first, 0);
                                }) |
@@ -62,8 +62,9 @@ class SchedulerResourceReporter {
   const absl::flat_hash_map<SchedulingClass, std::deque<std::shared_ptr<internal::Work>>>
       &infeasible_leases_;
 
-  const absl::flat_hash_map<SchedulingClass, absl::flat_hash_map<WorkerID, int64_t>>
-      &backlog_tracker_;
+  const absl::flat_hash_map<SchedulingClass, int64_t> &backlog_size_sum_;
+
+  const absl::flat_hash_map<SchedulingClass, size_t> &num_leases_waiting_for_worker_;
 };
 
 }  // namespace raylet
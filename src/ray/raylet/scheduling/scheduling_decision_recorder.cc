@@ -0,0 +1,204 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/raylet/scheduling/scheduling_decision_recorder.h"
+
+#include <cstring>
+#include <string>
+
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace raylet {
+
+namespace {
+
+// Identifies scheduling decision logs; bump the version on format changes.
+constexpr char kLogMagic[8] = {'R', 'A', 'Y', 'S', 'C', 'H', 'E', 'D'};
+constexpr uint32_t kLogVersion = 1;
+
+}  // namespace
+
+SchedulingDecisionRecorder::SchedulingDecisionRecorder(
+    const std::string &path, const std::string &local_node_id)
+    : out_(path, std::ios::binary | std::ios::trunc) {
+  if (!out_.is_open()) {
+    RAY_LOG(WARNING) << "Failed to open scheduling decision log " << path
+                     << "; scheduling decisions will not be recorded.";
+    return;
+  }
+  out_.write(kLogMagic, sizeof(kLogMagic));
+  WritePod(kLogVersion);
+  WriteString(local_node_id);
+}
+
+void SchedulingDecisionRecorder::RecordResourceViewIfChanged(
+    const ClusterResourceViewSnapshot &snapshot) {
+  if (!out_.is_open() || static_cast<int64_t>(snapshot.epoch) == last_recorded_epoch_) {
+    return;
+  }
+  last_recorded_epoch_ = static_cast<int64_t>(snapshot.epoch);
+  WritePod(static_cast<uint8_t>(SchedulingDecisionLogEntry::Type::kResourceView));
+  WritePod(snapshot.epoch);
+  WritePod(static_cast<uint32_t>(snapshot.nodes.size()));
+  for (const auto &[node_id, node] : snapshot.nodes) {
+    WriteString(node_id.Binary());
+    const auto &resources = node.GetLocalView();
+    WriteResourceMap(resources.total.GetResourceMap());
+    WriteResourceMap(resources.available.GetResourceMap());
+  }
+}
+
+void SchedulingDecisionRecorder::RecordLeaseArrival(
+    int64_t time_ms,
+    const std::string &lease_id,
+    const std::string &preferred_node_id,
+    const absl::flat_hash_map<std::string, double> &required_resources) {
+  if (!out_.is_open()) {
+    return;
+  }
+  WritePod(static_cast<uint8_t>(SchedulingDecisionLogEntry::Type::kLeaseArrival));
+  WritePod(time_ms);
+  WriteString(lease_id);
+  WriteString(preferred_node_id);
+  WriteResourceMap(required_resources);
+}
+
+void SchedulingDecisionRecorder::RecordDecision(int64_t time_ms,
+                                                const std::string &lease_id,
+                                                uint64_t view_epoch,
+                                                const std::string &selected_node_id,
+                                                bool is_infeasible) {
+  if (!out_.is_open()) {
+    return;
+  }
+  WritePod(static_cast<uint8_t>(SchedulingDecisionLogEntry::Type::kDecision));
+  WritePod(time_ms);
+  WriteString(lease_id);
+  WritePod(view_epoch);
+  WriteString(selected_node_id);
+  WritePod(static_cast<uint8_t>(is_infeasible ? 1 : 0));
+}
+
+void SchedulingDecisionRecorder::Flush() {
+  if (out_.is_open()) {
+    out_.flush();
+  }
+}
+
+void SchedulingDecisionRecorder::WriteString(const std::string &value) {
+  WritePod(static_cast<uint32_t>(value.size()));
+  out_.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void SchedulingDecisionRecorder::WriteResourceMap(
+    const absl::flat_hash_map<std::string, double> &resources) {
+  WritePod(static_cast<uint32_t>(resources.size()));
+  for (const auto &[name, value] : resources) {
+    WriteString(name);
+    WritePod(value);
+  }
+}
+
+SchedulingDecisionLogReader::SchedulingDecisionLogReader(const std::string &path)
+    : in_(path, std::ios::binary) {
+  if (!in_.is_open()) {
+    return;
+  }
+  char magic[sizeof(kLogMagic)];
+  in_.read(magic, sizeof(magic));
+  uint32_t version = 0;
+  if (!in_.good() || std::memcmp(magic, kLogMagic, sizeof(kLogMagic)) != 0 ||
+      !ReadPod(&version) || version != kLogVersion) {
+    RAY_LOG(WARNING) << "File " << path << " is not a scheduling decision log.";
+    return;
+  }
+  valid_ = ReadString(&local_node_id_);
+}
+
+bool SchedulingDecisionLogReader::ReadNext(SchedulingDecisionLogEntry *entry) {
+  if (!valid_) {
+    return false;
+  }
+  uint8_t type = 0;
+  if (!ReadPod(&type)) {
+    return false;
+  }
+  *entry = SchedulingDecisionLogEntry();
+  entry->type = static_cast<SchedulingDecisionLogEntry::Type>(type);
+  switch (entry->type) {
+  case SchedulingDecisionLogEntry::Type::kResourceView: {
+    uint32_t num_nodes = 0;
+    if (!ReadPod(&entry->epoch) || !ReadPod(&num_nodes)) {
+      return false;
+    }
+    entry->nodes.resize(num_nodes);
+    for (auto &node : entry->nodes) {
+      if (!ReadString(&node.node_id) || !ReadResourceMap(&node.total) ||
+          !ReadResourceMap(&node.available)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  case SchedulingDecisionLogEntry::Type::kLeaseArrival:
+    return ReadPod(&entry->time_ms) && ReadString(&entry->lease_id) &&
+           ReadString(&entry->preferred_node_id) &&
+           ReadResourceMap(&entry->required_resources);
+  case SchedulingDecisionLogEntry::Type::kDecision: {
+    uint8_t is_infeasible = 0;
+    if (!ReadPod(&entry->time_ms) || !ReadString(&entry->lease_id) ||
+        !ReadPod(&entry->epoch) || !ReadString(&entry->selected_node_id) ||
+        !ReadPod(&is_infeasible)) {
+      return false;
+    }
+    entry->is_infeasible = is_infeasible != 0;
+    return true;
+  }
+  default:
+    RAY_LOG(WARNING) << "Unknown scheduling decision log record type "
+                     << static_cast<int>(type);
+    return false;
+  }
+}
+
+bool SchedulingDecisionLogReader::ReadString(std::string *value) {
+  uint32_t size = 0;
+  if (!ReadPod(&size)) {
+    return false;
+  }
+  value->resize(size);
+  in_.read(value->data(), size);
+  return in_.good() || (size == 0 && !in_.bad());
+}
+
+bool SchedulingDecisionLogReader::ReadResourceMap(
+    absl::flat_hash_map<std::string, double> *resources) {
+  uint32_t size = 0;
+  if (!ReadPod(&size)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < size; i++) {
+    std::string name;
+    double value = 0;
+    if (!ReadString(&name) || !ReadPod(&value)) {
+      return false;
+    }
+    (*resources)[std::move(name)] = value;
+  }
+  return true;
+}
+
+}  // namespace raylet
+}  // namespace ray
@@ -0,0 +1,154 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "ray/raylet/scheduling/cluster_resource_manager.h"
+
+namespace ray {
+namespace raylet {
+
+/// One decoded record of a scheduling decision log. Which fields are
+/// meaningful depends on `type`.
+struct SchedulingDecisionLogEntry {
+  enum class Type : uint8_t {
+    /// The cluster resource view at a new epoch. Emitted lazily before the
+    /// first decision that observes the epoch, so replay can reconstruct the
+    /// view each decision was made against.
+    kResourceView = 1,
+    /// A lease arriving at the cluster lease manager.
+    kLeaseArrival = 2,
+    /// The outcome of one scheduling pass for a lease.
+    kDecision = 3,
+  };
+
+  struct RecordedNode {
+    std::string node_id;
+    absl::flat_hash_map<std::string, double> total;
+    absl::flat_hash_map<std::string, double> available;
+  };
+
+  Type type;
+
+  /// kResourceView: the view epoch the node table was captured at.
+  /// kDecision: the view epoch the decision was made against.
+  uint64_t epoch = 0;
+  /// kResourceView only.
+  std::vector<RecordedNode> nodes;
+
+  /// kLeaseArrival and kDecision.
+  int64_t time_ms = 0;
+  std::string lease_id;
+
+  /// kLeaseArrival only.
+  std::string preferred_node_id;
+  absl::flat_hash_map<std::string, double> required_resources;
+
+  /// kDecision only. Empty if no node was selected.
+  std::string selected_node_id;
+  bool is_infeasible = false;
+};
+
+/// Appends scheduling events to a compact binary log so production decision
+/// sequences can be replayed offline (see scheduling_decision_replay.cc under
+/// tests/). Enabled by setting `scheduling_decision_record_path`; with the
+/// default empty path nothing is constructed. Not thread safe; must only be
+/// used from the thread driving the cluster lease manager.
+class SchedulingDecisionRecorder {
+ public:
+  /// \param path The file to append the log to. The file is truncated.
+  /// \param local_node_id The binary ID of the recording node, stored in the
+  ///        log header so replay can evaluate locality the same way.
+  SchedulingDecisionRecorder(const std::string &path,
+                             const std::string &local_node_id);
+
+  /// Whether the log file could be opened. When false all record calls are
+  /// no-ops.
+  bool IsOpen() const { return out_.is_open(); }
+
+  /// Record the node resource table if `snapshot.epoch` differs from the last
+  /// recorded epoch. Decisions recorded afterwards reference the epoch.
+  void RecordResourceViewIfChanged(const ClusterResourceViewSnapshot &snapshot);
+
+  /// Record a lease arriving for scheduling.
+  void RecordLeaseArrival(
+      int64_t time_ms,
+      const std::string &lease_id,
+      const std::string &preferred_node_id,
+      const absl::flat_hash_map<std::string, double> &required_resources);
+
+  /// Record the outcome of one scheduling pass for a lease.
+  ///
+  /// \param selected_node_id The chosen node's binary ID, or empty if none.
+  void RecordDecision(int64_t time_ms,
+                      const std::string &lease_id,
+                      uint64_t view_epoch,
+                      const std::string &selected_node_id,
+                      bool is_infeasible);
+
+  /// Flush buffered records to disk.
+  void Flush();
+
+ private:
+  void WriteString(const std::string &value);
+  void WriteResourceMap(const absl::flat_hash_map<std::string, double> &resources);
+
+  template <typename T>
+  void WritePod(const T &value) {
+    out_.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  std::ofstream out_;
+  /// The last epoch written as a kResourceView record, or -1 if none yet.
+  int64_t last_recorded_epoch_ = -1;
+};
+
+/// Sequentially decodes a log written by SchedulingDecisionRecorder.
+class SchedulingDecisionLogReader {
+ public:
+  explicit SchedulingDecisionLogReader(const std::string &path);
+
+  /// Whether the file could be opened and has a valid header.
+  bool IsOpen() const { return valid_; }
+
+  /// The binary node ID of the node that recorded the log.
+  const std::string &GetLocalNodeId() const { return local_node_id_; }
+
+  /// Decode the next record into `entry`.
+  ///
+  /// \return False at end of log or on a decode error.
+  bool ReadNext(SchedulingDecisionLogEntry *entry);
+
+ private:
+  bool ReadString(std::string *value);
+  bool ReadResourceMap(absl::flat_hash_map<std::string, double> *resources);
+
+  template <typename T>
+  bool ReadPod(T *value) {
+    in_.read(reinterpret_cast<char *>(value), sizeof(*value));
+    return in_.good();
+  }
+
+  std::ifstream in_;
+  bool valid_ = false;
+  std::string local_node_id_;
+};
+
+}  // namespace raylet
+}  // namespace ray
@@ -339,6 +339,8 @@ class MockLeaseDependencyManager : public LeaseDependencyManagerInterface {
                                 const std::vector<rpc::ObjectReference> &required_objects,
                                 const TaskMetricsKey &task_key) {
     RAY_CHECK(subscribed_leases.insert(lease_id).second);
+    // The real pull subsumes any speculative prefetch.
+    prefetched_leases.erase(lease_id);
     for (auto &obj_ref : required_objects) {
       if (missing_objects_.find(ObjectRefToId(obj_ref)) != missing_objects_.end()) {
         return false;
@@ -357,9 +359,22 @@ class MockLeaseDependencyManager : public LeaseDependencyManagerInterface {
 
   bool CheckObjectLocal(const ObjectID &object_id) const { return true; }
 
+  void PrefetchLeaseDependencies(
+      const LeaseID &lease_id,
+      const std::vector<rpc::ObjectReference> &required_objects) {
+    if (!required_objects.empty()) {
+      prefetched_leases.insert(lease_id);
+    }
+  }
+
+  void CancelPrefetchLeaseDependencies(const LeaseID &lease_id) {
+    prefetched_leases.erase(lease_id);
+  }
+
   std::unordered_set<ObjectID> &missing_objects_;
   std::unordered_set<LeaseID> subscribed_leases;
   std::unordered_set<LeaseID> blocked_leases;
+  std::unordered_set<LeaseID> prefetched_leases;
 };
 
 class FeatureFlagEnvironment : public ::testing::Environment {
@@ -436,6 +451,7 @@ class ClusterLeaseManagerTest : public ::testing::Test {
             /* announce_infeasible_lease= */
             [this](const RayLease &lease) { announce_infeasible_lease_calls_++; },
             *local_lease_manager_,
+            lease_dependency_manager_,
             /*get_time=*/[this]() { return current_time_ms_; }) {
     RayConfig::instance().initialize("{\"scheduler_top_k_absolute\": 1}");
   }
@@ -479,8 +495,10 @@ class ClusterLeaseManagerTest : public ::testing::Test {
     ASSERT_TRUE(local_lease_manager_->granted_lease_args_.empty());
     ASSERT_TRUE(local_lease_manager_->pinned_lease_arguments_.empty());
     ASSERT_TRUE(local_lease_manager_->info_by_sched_cls_.empty());
+    ASSERT_TRUE(local_lease_manager_->num_leases_waiting_for_worker_.empty());
     ASSERT_EQ(local_lease_manager_->pinned_lease_arguments_bytes_, 0);
     ASSERT_TRUE(lease_dependency_manager_.subscribed_leases.empty());
+    ASSERT_TRUE(lease_dependency_manager_.prefetched_leases.empty());
   }
 
   void AssertPinnedLeaseArgumentsPresent(const RayLease &lease) {
@@ -1185,6 +1203,73 @@ TEST_F(ClusterLeaseManagerTest, TestGrantOrReject) {
   AssertNoLeaks();
 }
 
+TEST_F(ClusterLeaseManagerTest, SpeculativeArgPrefetchTest) {
+  /*
+    With speculative prefetch enabled, a queued lease's arguments are
+    prefetched while it waits for a scheduling decision, subsumed by the
+    regular argument fetch when the lease is queued locally, and cancelled
+    when the lease is spilled to another node.
+  */
+  RayConfig::instance().speculative_lease_arg_prefetch_enabled() = true;
+
+  int num_callbacks = 0;
+  auto callback = [&](Status, std::function<void()>, std::function<void()>) {
+    num_callbacks++;
+  };
+
+  // Lease 1 consumes all local CPUs and is granted a worker. Its argument
+  // fetch goes through the regular path, which subsumes the prefetch.
+  auto lease1 = CreateLease({{ray::kCPU_ResourceLabel, 8}}, 1);
+  rpc::RequestWorkerLeaseReply local_reply;
+  lease_manager_.QueueAndScheduleLease(
+      lease1,
+      false,
+      false,
+      std::vector<internal::ReplyCallback>{
+          internal::ReplyCallback(callback, &local_reply)});
+  std::shared_ptr<MockWorker> worker =
+      std::make_shared<MockWorker>(WorkerID::FromRandom(), 1234);
+  pool_.PushWorker(std::dynamic_pointer_cast<WorkerInterface>(worker));
+  pool_.TriggerCallbacks();
+  ASSERT_EQ(num_callbacks, 1);
+  ASSERT_EQ(leased_workers_.size(), 1);
+  ASSERT_TRUE(lease_dependency_manager_.prefetched_leases.empty());
+
+  // Lease 2 is feasible but no node has available CPUs, so it stays queued
+  // for scheduling. Its arguments are prefetched while it waits.
+  auto lease2 = CreateLease({{ray::kCPU_ResourceLabel, 8}}, 1);
+  rpc::RequestWorkerLeaseReply spillback_reply;
+  lease_manager_.QueueAndScheduleLease(
+      lease2,
+      false,
+      false,
+      std::vector<internal::ReplyCallback>{
+          internal::ReplyCallback(callback, &spillback_reply)});
+  pool_.TriggerCallbacks();
+  ASSERT_EQ(num_callbacks, 1);
+  ASSERT_EQ(lease_dependency_manager_.prefetched_leases.count(
+                lease2.GetLeaseSpecification().LeaseId()),
+            1);
+
+  // A remote node becomes available, so the lease is spilled there and the
+  // prefetch is cancelled.
+  auto remote_node_id = NodeID::FromRandom();
+  AddNode(remote_node_id, 8);
+  lease_manager_.ScheduleAndGrantLeases();
+  pool_.TriggerCallbacks();
+  ASSERT_EQ(num_callbacks, 2);
+  ASSERT_EQ(spillback_reply.retry_at_raylet_address().node_id(), remote_node_id.Binary());
+  ASSERT_TRUE(lease_dependency_manager_.prefetched_leases.empty());
+
+  while (!leased_workers_.empty()) {
+    RayLease finished_lease;
+    local_lease_manager_->CleanupLease(leased_workers_.begin()->second, &finished_lease);
+    leased_workers_.erase(leased_workers_.begin());
+  }
+  RayConfig::instance().speculative_lease_arg_prefetch_enabled() = false;
+  AssertNoLeaks();
+}
+
 TEST_F(ClusterLeaseManagerTest, TestSpillAfterAssigned) {
   /*
     Test the race condition in which a lease is assigned to the local node, but
@@ -1947,6 +2032,8 @@ TEST_F(ClusterLeaseManagerTest, BacklogReportTest) {
     lease_manager_.FillResourceUsage(data);
     auto resource_load_by_shape = data.resource_load_by_shape();
     ASSERT_EQ(resource_load_by_shape.resource_demands().size(), 0);
+    ASSERT_TRUE(local_lease_manager_->backlog_tracker_.empty());
+    ASSERT_TRUE(local_lease_manager_->backlog_size_sum_.empty());
 
     while (!leased_workers_.empty()) {
       RayLease finished_lease;
@@ -2500,6 +2587,58 @@ TEST_F(ClusterLeaseManagerTest, TestSpillWaitingLeases) {
   AssertNoLeaks();
 }
 
+TEST_F(ClusterLeaseManagerTest, BatchedSchedulingSpillsBurst) {
+  /*
+    With batched scheduling enabled, a burst of leases of one scheduling
+    class scheduled in a single round reuses the first placement decision
+    while the node still has room for the shape, and per-lease resource
+    accounting still applies.
+  */
+  RayConfig::instance().cluster_lease_manager_batched_scheduling() = true;
+
+  int num_callbacks = 0;
+  auto callback = [&num_callbacks](
+                      Status, std::function<void()>, std::function<void()>) {
+    num_callbacks++;
+  };
+  // Queue a burst of GPU leases while no GPU node exists so that they all
+  // accumulate before a single scheduling round.
+  std::vector<std::unique_ptr<rpc::RequestWorkerLeaseReply>> replies;
+  for (int i = 0; i < 4; i++) {
+    RayLease lease = CreateLease({{ray::kGPU_ResourceLabel, 1}});
+    replies.push_back(std::make_unique<rpc::RequestWorkerLeaseReply>());
+    lease_manager_.QueueAndScheduleLease(
+        lease,
+        false,
+        false,
+        std::vector<internal::ReplyCallback>{
+            internal::ReplyCallback(callback, replies[i].get())});
+  }
+  pool_.TriggerCallbacks();
+  ASSERT_EQ(num_callbacks, 0);
+  ASSERT_EQ(lease_manager_.GetInfeasibleQueueSize(), 4);
+
+  auto remote_node_id = NodeID::FromRandom();
+  AddNode(remote_node_id, /*num_cpus=*/0, /*num_gpus=*/4);
+  lease_manager_.ScheduleAndGrantLeases();
+  pool_.TriggerCallbacks();
+
+  // The whole burst spilled to the remote node in one round.
+  ASSERT_EQ(num_callbacks, 4);
+  for (int i = 0; i < 4; i++) {
+    ASSERT_EQ(replies[i]->retry_at_raylet_address().node_id(),
+              remote_node_id.Binary());
+  }
+  // Each reused decision still allocated the shape on the remote node.
+  const NodeResources &node_resources =
+      scheduler_->GetClusterResourceManager().GetNodeResources(
+          scheduling::NodeID(remote_node_id.Binary()));
+  ASSERT_EQ(node_resources.available.Get(ResourceID::GPU()), 0);
+
+  RayConfig::instance().cluster_lease_manager_batched_scheduling() = false;
+  AssertNoLeaks();
+}
+
 TEST_F(ClusterLeaseManagerTest, PinnedArgsMemoryTest) {
   /*
     Total memory required by granted lease args stays under the specified
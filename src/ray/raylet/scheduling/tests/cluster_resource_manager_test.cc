@@ -85,6 +85,67 @@ TEST_F(ClusterResourceManagerTest, UpdateNode) {
   ASSERT_TRUE(node_resources.last_resource_update_time.has_value());
 }
 
+TEST_F(ClusterResourceManagerTest, FeasibilityIndexTest) {
+  const auto custom_id = scheduling::ResourceID("CUSTOM");
+
+  // node0 and node2 have CPU in total; node1's total CPU is 0.
+  const auto *cpu_bucket = manager->GetNodesWithTotalResource(ResourceID::CPU());
+  ASSERT_NE(cpu_bucket, nullptr);
+  ASSERT_TRUE(cpu_bucket->contains(node0));
+  ASSERT_FALSE(cpu_bucket->contains(node1));
+  ASSERT_TRUE(cpu_bucket->contains(node2));
+
+  const auto *custom_bucket = manager->GetNodesWithTotalResource(custom_id);
+  ASSERT_NE(custom_bucket, nullptr);
+  ASSERT_EQ(custom_bucket->size(), 2UL);
+
+  // No node has any GPU.
+  ASSERT_EQ(manager->GetNodesWithTotalResource(ResourceID::GPU()), nullptr);
+
+  // Capacity updates are reflected incrementally.
+  manager->UpdateResourceCapacity(node0, ResourceID::GPU(), 4);
+  const auto *gpu_bucket = manager->GetNodesWithTotalResource(ResourceID::GPU());
+  ASSERT_NE(gpu_bucket, nullptr);
+  ASSERT_TRUE(gpu_bucket->contains(node0));
+
+  ASSERT_TRUE(manager->DeleteResources(node0, {ResourceID::GPU()}));
+  ASSERT_EQ(manager->GetNodesWithTotalResource(ResourceID::GPU()), nullptr);
+
+  // Removed nodes drop out of all buckets.
+  ASSERT_TRUE(manager->RemoveNode(node1));
+  custom_bucket = manager->GetNodesWithTotalResource(custom_id);
+  ASSERT_NE(custom_bucket, nullptr);
+  ASSERT_FALSE(custom_bucket->contains(node1));
+}
+
+TEST_F(ClusterResourceManagerTest, ResourceViewSnapshotTest) {
+  auto snapshot = manager->GetResourceViewSnapshot();
+  ASSERT_EQ(snapshot->epoch, manager->GetViewEpoch());
+  ASSERT_EQ(snapshot->nodes.size(), 3UL);
+  // Repeated calls without mutations return the same snapshot.
+  ASSERT_EQ(snapshot, manager->GetResourceViewSnapshot());
+
+  // Mutations bump the epoch; snapshots handed out earlier are unaffected.
+  manager->SubtractNodeAvailableResources(
+      node0,
+      ResourceMapToResourceRequest({{"CPU", 1}},
+                                   /*requires_object_store_memory=*/false));
+  ASSERT_NE(snapshot->epoch, manager->GetViewEpoch());
+  ASSERT_EQ(snapshot->nodes.at(node0).GetLocalView().available.Get(ResourceID::CPU()),
+            1);
+
+  auto new_snapshot = manager->GetResourceViewSnapshot();
+  ASSERT_NE(new_snapshot, snapshot);
+  ASSERT_EQ(new_snapshot->epoch, manager->GetViewEpoch());
+  ASSERT_EQ(
+      new_snapshot->nodes.at(node0).GetLocalView().available.Get(ResourceID::CPU()), 0);
+
+  // Removed nodes disappear from freshly built snapshots only.
+  ASSERT_TRUE(manager->RemoveNode(node1));
+  ASSERT_FALSE(manager->GetResourceViewSnapshot()->nodes.contains(node1));
+  ASSERT_TRUE(new_snapshot->nodes.contains(node1));
+}
+
 TEST_F(ClusterResourceManagerTest, DebugStringTest) {
   // Test max_num_nodes_to_include parameter is working.
   ASSERT_EQ(std::vector<std::string>(absl::StrSplit(manager->DebugString(), "node id:"))
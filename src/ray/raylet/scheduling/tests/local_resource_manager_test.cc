@@ -20,6 +20,7 @@
 #include <string>
 
 #include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
 #include "ray/observability/fake_metric.h"
 
 namespace ray {
@@ -410,6 +411,92 @@ TEST_F(LocalResourceManagerTest, CreateSyncMessageNegativeResourceAvailability)
   ASSERT_EQ(resource_view_sync_messge.resources_available().at("CPU"), 0);
 }
 
+TEST_F(LocalResourceManagerTest, SuppressUnchangedSyncMessage) {
+  // With syncer_suppress_unchanged_resource_view set, a version bump whose
+  // changes cancelled out (acquire followed by release) does not produce a new
+  // sync message, while a real change still does.
+  RayConfig::instance().syncer_suppress_unchanged_resource_view() = true;
+  CreateManagerWithFakeClock();
+
+  auto msg = manager->CreateSyncMessage(-1, syncer::MessageType::RESOURCE_VIEW);
+  ASSERT_TRUE(msg.has_value());
+  const int64_t reported_version = msg->version();
+
+  // Allocate and release one CPU. The version moves, but the reported view is
+  // identical to what the cluster already has.
+  ResourceRequest resource_request =
+      ResourceMapToResourceRequest({{ResourceID::CPU(), 1.0}}, false);
+  auto task_allocation = std::make_shared<TaskResourceInstances>();
+  ASSERT_TRUE(manager->AllocateLocalTaskResources(resource_request, task_allocation));
+  manager->ReleaseWorkerResources(task_allocation);
+  ASSERT_FALSE(
+      manager->CreateSyncMessage(reported_version, syncer::MessageType::RESOURCE_VIEW)
+          .has_value());
+
+  // A change that sticks is reported with the newer version.
+  auto task_allocation1 = std::make_shared<TaskResourceInstances>();
+  ASSERT_TRUE(manager->AllocateLocalTaskResources(resource_request, task_allocation1));
+  auto msg1 =
+      manager->CreateSyncMessage(reported_version, syncer::MessageType::RESOURCE_VIEW);
+  ASSERT_TRUE(msg1.has_value());
+  ASSERT_GT(msg1->version(), reported_version);
+
+  RayConfig::instance().syncer_suppress_unchanged_resource_view() = false;
+}
+
+TEST_F(LocalResourceManagerTest, ScopedResourceUpdateBatchCoalescesNotifications) {
+  int num_notifications = 0;
+  manager = std::make_unique<LocalResourceManager>(
+      local_node_id,
+      CreateNodeResources({{ResourceID::CPU(), 4.0}}),
+      nullptr,
+      nullptr,
+      nullptr,
+      /* resource_change_subscriber */
+      [&num_notifications](const NodeResources &) { num_notifications++; },
+      fake_resource_usage_gauge_);
+
+  // Without a batch guard, every mutation notifies the subscriber.
+  ResourceRequest resource_request =
+      ResourceMapToResourceRequest({{ResourceID::CPU(), 1.0}}, false);
+  auto task_allocation = std::make_shared<TaskResourceInstances>();
+  ASSERT_TRUE(manager->AllocateLocalTaskResources(resource_request, task_allocation));
+  ASSERT_EQ(num_notifications, 1);
+  const int64_t version_before_batch = manager->version_;
+
+  {
+    LocalResourceManager::ScopedResourceUpdateBatch batch(*manager);
+    auto task_allocation1 = std::make_shared<TaskResourceInstances>();
+    auto task_allocation2 = std::make_shared<TaskResourceInstances>();
+    ASSERT_TRUE(manager->AllocateLocalTaskResources(resource_request, task_allocation1));
+    ASSERT_TRUE(manager->AllocateLocalTaskResources(resource_request, task_allocation2));
+    manager->ReleaseWorkerResources(task_allocation1);
+    // Nothing is published while the guard is alive.
+    ASSERT_EQ(num_notifications, 1);
+    ASSERT_EQ(manager->version_, version_before_batch);
+  }
+  // The whole batch published a single notification and version bump.
+  ASSERT_EQ(num_notifications, 2);
+  ASSERT_EQ(manager->version_, version_before_batch + 1);
+
+  // A guard that saw no changes publishes nothing.
+  {
+    LocalResourceManager::ScopedResourceUpdateBatch batch(*manager);
+  }
+  ASSERT_EQ(num_notifications, 2);
+
+  // Nested guards publish once, at the outermost destruction.
+  {
+    LocalResourceManager::ScopedResourceUpdateBatch outer(*manager);
+    {
+      LocalResourceManager::ScopedResourceUpdateBatch inner(*manager);
+      manager->ReleaseWorkerResources(task_allocation);
+    }
+    ASSERT_EQ(num_notifications, 2);
+  }
+  ASSERT_EQ(num_notifications, 3);
+}
+
 TEST_F(LocalResourceManagerTest, PopulateResourceViewSyncMessage) {
   // Prepare node resources with labels.
   NodeResources resources = CreateNodeResources({{ResourceID::CPU(), 2.0}});
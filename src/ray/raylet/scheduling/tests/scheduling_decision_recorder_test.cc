@@ -0,0 +1,115 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/raylet/scheduling/scheduling_decision_recorder.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace ray {
+namespace raylet {
+
+class SchedulingDecisionRecorderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    log_path_ = (std::filesystem::temp_directory_path() /
+                 ("scheduling_decision_log_" +
+                  std::to_string(::testing::UnitTest::GetInstance()->random_seed())))
+                    .string();
+  }
+
+  void TearDown() override { std::filesystem::remove(log_path_); }
+
+  std::string log_path_;
+};
+
+TEST_F(SchedulingDecisionRecorderTest, TestRoundTrip) {
+  ClusterResourceViewSnapshot snapshot;
+  snapshot.epoch = 7;
+  snapshot.nodes.emplace(
+      scheduling::NodeID("node_1"),
+      Node(ResourceMapToNodeResources({{"CPU", 4.0}, {"GPU", 1.0}}, {{"CPU", 2.0}})));
+
+  {
+    SchedulingDecisionRecorder recorder(log_path_, "local_node");
+    ASSERT_TRUE(recorder.IsOpen());
+    recorder.RecordLeaseArrival(
+        /*time_ms=*/100, "lease_1", "preferred_node", {{"CPU", 1.0}});
+    recorder.RecordResourceViewIfChanged(snapshot);
+    // The same epoch must not be written twice.
+    recorder.RecordResourceViewIfChanged(snapshot);
+    recorder.RecordDecision(
+        /*time_ms=*/101, "lease_1", /*view_epoch=*/7, "node_1", /*is_infeasible=*/false);
+    recorder.RecordDecision(
+        /*time_ms=*/102, "lease_2", /*view_epoch=*/7, "", /*is_infeasible=*/true);
+    recorder.Flush();
+  }
+
+  SchedulingDecisionLogReader reader(log_path_);
+  ASSERT_TRUE(reader.IsOpen());
+  ASSERT_EQ(reader.GetLocalNodeId(), "local_node");
+
+  SchedulingDecisionLogEntry entry;
+  ASSERT_TRUE(reader.ReadNext(&entry));
+  ASSERT_EQ(entry.type, SchedulingDecisionLogEntry::Type::kLeaseArrival);
+  ASSERT_EQ(entry.time_ms, 100);
+  ASSERT_EQ(entry.lease_id, "lease_1");
+  ASSERT_EQ(entry.preferred_node_id, "preferred_node");
+  ASSERT_EQ(entry.required_resources.size(), 1);
+  ASSERT_EQ(entry.required_resources.at("CPU"), 1.0);
+
+  ASSERT_TRUE(reader.ReadNext(&entry));
+  ASSERT_EQ(entry.type, SchedulingDecisionLogEntry::Type::kResourceView);
+  ASSERT_EQ(entry.epoch, 7);
+  ASSERT_EQ(entry.nodes.size(), 1);
+  ASSERT_EQ(entry.nodes[0].node_id, "node_1");
+  ASSERT_EQ(entry.nodes[0].total.at("CPU"), 4.0);
+  ASSERT_EQ(entry.nodes[0].total.at("GPU"), 1.0);
+  ASSERT_EQ(entry.nodes[0].available.at("CPU"), 2.0);
+
+  ASSERT_TRUE(reader.ReadNext(&entry));
+  ASSERT_EQ(entry.type, SchedulingDecisionLogEntry::Type::kDecision);
+  ASSERT_EQ(entry.time_ms, 101);
+  ASSERT_EQ(entry.lease_id, "lease_1");
+  ASSERT_EQ(entry.epoch, 7);
+  ASSERT_EQ(entry.selected_node_id, "node_1");
+  ASSERT_FALSE(entry.is_infeasible);
+
+  ASSERT_TRUE(reader.ReadNext(&entry));
+  ASSERT_EQ(entry.type, SchedulingDecisionLogEntry::Type::kDecision);
+  ASSERT_EQ(entry.lease_id, "lease_2");
+  ASSERT_TRUE(entry.selected_node_id.empty());
+  ASSERT_TRUE(entry.is_infeasible);
+
+  // End of log.
+  ASSERT_FALSE(reader.ReadNext(&entry));
+}
+
+TEST_F(SchedulingDecisionRecorderTest, TestInvalidLog) {
+  SchedulingDecisionLogReader missing_reader(log_path_ + ".does_not_exist");
+  ASSERT_FALSE(missing_reader.IsOpen());
+
+  {
+    std::ofstream out(log_path_, std::ios::binary);
+    out << "not a decision log";
+  }
+  SchedulingDecisionLogReader corrupt_reader(log_path_);
+  ASSERT_FALSE(corrupt_reader.IsOpen());
+}
+
+}  // namespace raylet
+}  // namespace ray
@@ -0,0 +1,170 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Offline replay of a scheduling decision log recorded by the cluster lease
+// manager (see `scheduling_decision_record_path`). The tool re-executes the
+// recorded decision stream against the hybrid scheduling policy as configured
+// by the current RayConfig (e.g. RAY_scheduler_spread_threshold,
+// RAY_scheduler_top_k_fraction) and reports how the replayed placements and
+// per-decision policy latency compare to what production decided, so policy
+// changes can be evaluated without a production A/B:
+//
+//   scheduling_decision_replay <decision_log>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "ray/common/scheduling/cluster_resource_data.h"
+#include "ray/raylet/scheduling/policy/hybrid_scheduling_policy.h"
+#include "ray/raylet/scheduling/policy/scheduling_options.h"
+#include "ray/raylet/scheduling/scheduling_decision_recorder.h"
+
+namespace {
+
+struct RecordedArrival {
+  int64_t time_ms = 0;
+  std::string preferred_node_id;
+  absl::flat_hash_map<std::string, double> required_resources;
+};
+
+int64_t Percentile(std::vector<int64_t> &sorted_values, double fraction) {
+  if (sorted_values.empty()) {
+    return 0;
+  }
+  size_t index = static_cast<size_t>(fraction * (sorted_values.size() - 1));
+  return sorted_values[index];
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <decision_log>" << std::endl;
+    return 1;
+  }
+
+  ray::raylet::SchedulingDecisionLogReader reader(argv[1]);
+  if (!reader.IsOpen()) {
+    std::cerr << "Failed to open scheduling decision log " << argv[1] << std::endl;
+    return 1;
+  }
+
+  const auto local_node_id = ray::scheduling::NodeID(reader.GetLocalNodeId());
+  absl::flat_hash_map<ray::scheduling::NodeID, ray::Node> nodes;
+  // All recorded nodes were alive when the view snapshot was taken.
+  ray::raylet_scheduling_policy::HybridSchedulingPolicy policy(
+      local_node_id, nodes, [](ray::scheduling::NodeID) { return true; });
+
+  absl::flat_hash_map<std::string, RecordedArrival> arrivals;
+  int64_t num_decisions = 0;
+  int64_t num_matches = 0;
+  int64_t num_recorded_unscheduled = 0;
+  int64_t num_replayed_unscheduled = 0;
+  int64_t num_missing_arrivals = 0;
+  int64_t first_decision_time_ms = 0;
+  int64_t last_decision_time_ms = 0;
+  std::vector<int64_t> policy_latencies_ns;
+
+  ray::raylet::SchedulingDecisionLogEntry entry;
+  while (reader.ReadNext(&entry)) {
+    switch (entry.type) {
+    case ray::raylet::SchedulingDecisionLogEntry::Type::kResourceView: {
+      nodes.clear();
+      for (const auto &node : entry.nodes) {
+        nodes.emplace(
+            ray::scheduling::NodeID(node.node_id),
+            ray::Node(ray::ResourceMapToNodeResources(node.total, node.available)));
+      }
+      break;
+    }
+    case ray::raylet::SchedulingDecisionLogEntry::Type::kLeaseArrival: {
+      auto &arrival = arrivals[entry.lease_id];
+      arrival.time_ms = entry.time_ms;
+      arrival.preferred_node_id = entry.preferred_node_id;
+      arrival.required_resources = entry.required_resources;
+      break;
+    }
+    case ray::raylet::SchedulingDecisionLogEntry::Type::kDecision: {
+      auto arrival_it = arrivals.find(entry.lease_id);
+      if (arrival_it == arrivals.end()) {
+        // The arrival predates the start of the log.
+        num_missing_arrivals++;
+        break;
+      }
+      const auto &arrival = arrival_it->second;
+      auto resource_request = ray::ResourceMapToResourceRequest(
+          arrival.required_resources, /*requires_object_store_memory=*/false);
+      auto options = ray::raylet_scheduling_policy::SchedulingOptions::Hybrid(
+          /*avoid_local_node=*/false,
+          /*require_node_available=*/true,
+          arrival.preferred_node_id);
+      auto start = std::chrono::steady_clock::now();
+      auto replayed_node_id = policy.Schedule(resource_request, std::move(options));
+      auto end = std::chrono::steady_clock::now();
+      policy_latencies_ns.push_back(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+      if (num_decisions == 0) {
+        first_decision_time_ms = entry.time_ms;
+      }
+      last_decision_time_ms = entry.time_ms;
+      num_decisions++;
+      if (entry.selected_node_id.empty()) {
+        num_recorded_unscheduled++;
+      }
+      if (replayed_node_id.IsNil()) {
+        num_replayed_unscheduled++;
+      }
+      const std::string replayed_binary =
+          replayed_node_id.IsNil() ? std::string() : replayed_node_id.Binary();
+      if (replayed_binary == entry.selected_node_id) {
+        num_matches++;
+      }
+      break;
+    }
+    }
+  }
+
+  if (num_decisions == 0) {
+    std::cerr << "The log contains no replayable decisions." << std::endl;
+    return 1;
+  }
+
+  std::sort(policy_latencies_ns.begin(), policy_latencies_ns.end());
+  int64_t total_latency_ns = 0;
+  for (int64_t latency : policy_latencies_ns) {
+    total_latency_ns += latency;
+  }
+
+  std::cout << "Replayed " << num_decisions << " decisions spanning "
+            << (last_decision_time_ms - first_decision_time_ms) << " ms of recording"
+            << std::endl;
+  std::cout << "  placement matches:     " << num_matches << " ("
+            << (100.0 * static_cast<double>(num_matches) /
+                static_cast<double>(num_decisions))
+            << "%)" << std::endl;
+  std::cout << "  recorded unscheduled:  " << num_recorded_unscheduled << std::endl;
+  std::cout << "  replayed unscheduled:  " << num_replayed_unscheduled << std::endl;
+  std::cout << "  skipped (no arrival):  " << num_missing_arrivals << std::endl;
+  std::cout << "  policy latency ns:     mean "
+            << total_latency_ns / static_cast<int64_t>(policy_latencies_ns.size())
+            << ", p50 " << Percentile(policy_latencies_ns, 0.5) << ", p99 "
+            << Percentile(policy_latencies_ns, 0.99) << std::endl;
+  return 0;
+}
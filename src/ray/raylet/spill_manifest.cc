@@ -0,0 +1,147 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/raylet/spill_manifest.h"
+
+#include <cstdio>
+#include <utility>
+
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace raylet {
+
+namespace {
+
+/// Record layout: [1 byte type][ObjectID::Size() bytes id][4 bytes url length,
+/// little endian][url bytes]. Deleted records carry a zero-length URL.
+constexpr uint8_t kRecordSpilled = 1;
+constexpr uint8_t kRecordDeleted = 2;
+
+void WriteRecord(std::ostream &out,
+                 uint8_t type,
+                 const ObjectID &object_id,
+                 const std::string &object_url) {
+  out.put(static_cast<char>(type));
+  out.write(object_id.Binary().data(), ObjectID::Size());
+  const uint32_t url_size = static_cast<uint32_t>(object_url.size());
+  char size_buf[4];
+  for (int i = 0; i < 4; i++) {
+    size_buf[i] = static_cast<char>((url_size >> (8 * i)) & 0xff);
+  }
+  out.write(size_buf, 4);
+  out.write(object_url.data(), url_size);
+}
+
+}  // namespace
+
+SpillManifest::SpillManifest(std::string path) : path_(std::move(path)) {}
+
+absl::flat_hash_map<ObjectID, std::string> SpillManifest::RecoverAndOpen() {
+  absl::flat_hash_map<ObjectID, std::string> live;
+
+  std::ifstream in(path_, std::ios::binary);
+  if (in.is_open()) {
+    while (true) {
+      char type;
+      if (!in.get(type)) {
+        break;
+      }
+      std::string id_bytes(ObjectID::Size(), '\0');
+      if (!in.read(&id_bytes[0], id_bytes.size())) {
+        // A torn record from a crash mid-append; everything before it is valid.
+        break;
+      }
+      char size_buf[4];
+      if (!in.read(size_buf, 4)) {
+        break;
+      }
+      uint32_t url_size = 0;
+      for (int i = 0; i < 4; i++) {
+        url_size |= static_cast<uint32_t>(static_cast<uint8_t>(size_buf[i])) << (8 * i);
+      }
+      std::string object_url(url_size, '\0');
+      if (url_size > 0 && !in.read(&object_url[0], url_size)) {
+        break;
+      }
+      const auto object_id = ObjectID::FromBinary(id_bytes);
+      if (type == static_cast<char>(kRecordSpilled)) {
+        live[object_id] = std::move(object_url);
+      } else if (type == static_cast<char>(kRecordDeleted)) {
+        live.erase(object_id);
+      } else {
+        RAY_LOG(WARNING) << "Spill manifest " << path_
+                         << " contains an unknown record type "
+                         << static_cast<int>(type) << "; ignoring the rest of the file.";
+        break;
+      }
+    }
+    in.close();
+  }
+
+  // Compact: rewrite only the live entries through a temporary file so a
+  // crash during compaction leaves either the old or the new manifest.
+  const std::string tmp_path = path_ + ".tmp";
+  bool compacted = false;
+  {
+    std::ofstream tmp(tmp_path, std::ios::binary | std::ios::trunc);
+    if (tmp.is_open()) {
+      for (const auto &entry : live) {
+        WriteRecord(tmp, kRecordSpilled, entry.first, entry.second);
+      }
+      tmp.flush();
+      compacted = tmp.good();
+    }
+  }
+  if (compacted && std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    compacted = false;
+  }
+  if (!compacted) {
+    RAY_LOG(WARNING) << "Failed to compact spill manifest at " << path_
+                     << "; appending to the existing file instead.";
+  }
+
+  file_.open(path_, std::ios::binary | std::ios::app);
+  if (!file_.is_open()) {
+    RAY_LOG(WARNING) << "Failed to open spill manifest at " << path_
+                     << "; spilled object URL mappings will not survive a raylet "
+                     << "restart.";
+  } else if (!live.empty()) {
+    RAY_LOG(INFO) << "Recovered " << live.size()
+                  << " spilled object URL entries from " << path_;
+  }
+  return live;
+}
+
+void SpillManifest::AppendSpilled(const ObjectID &object_id,
+                                  const std::string &object_url) {
+  if (file_.is_open()) {
+    WriteRecord(file_, kRecordSpilled, object_id, object_url);
+  }
+}
+
+void SpillManifest::AppendDeleted(const ObjectID &object_id) {
+  if (file_.is_open()) {
+    WriteRecord(file_, kRecordDeleted, object_id, /*object_url=*/"");
+  }
+}
+
+void SpillManifest::Flush() {
+  if (file_.is_open()) {
+    file_.flush();
+  }
+}
+
+}  // namespace raylet
+}  // namespace ray
@@ -0,0 +1,69 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "ray/common/id.h"
+
+namespace ray {
+namespace raylet {
+
+/// An append-only write-ahead index of the spilled-object URL mapping kept by
+/// LocalObjectManager. Every spill batch appends one record per spilled
+/// object and every processed delete appends a tombstone; the buffered
+/// records are flushed to the OS once per batch, so the index survives a
+/// raylet crash without adding an fsync to the spill path. On startup the
+/// manifest is replayed in one pass to rebuild the ObjectID -> spilled URL
+/// map, letting a restarted raylet keep restoring (and eventually deleting)
+/// the objects its predecessor spilled instead of leaking them on disk. The
+/// replayed manifest is compacted down to its live entries before reopening
+/// so it does not grow with the lifetime churn of the node.
+class SpillManifest {
+ public:
+  /// \param path The manifest file path, typically inside the spill directory
+  /// so it lives and dies together with the spill files.
+  explicit SpillManifest(std::string path);
+
+  /// Replay an existing manifest (tolerating a torn final record from a crash
+  /// mid-append), compact it to the surviving entries, and open it for
+  /// appending. Returns the object -> URL entries that were spilled but never
+  /// deleted. If the manifest cannot be opened for appending, the appends
+  /// below become no-ops and a warning is logged.
+  absl::flat_hash_map<ObjectID, std::string> RecoverAndOpen();
+
+  /// Buffer a record that `object_id` was spilled to `object_url`.
+  void AppendSpilled(const ObjectID &object_id, const std::string &object_url);
+
+  /// Buffer a tombstone for `object_id`'s spilled entry.
+  void AppendDeleted(const ObjectID &object_id);
+
+  /// Flush buffered records to the OS. Called once per spill/delete batch.
+  void Flush();
+
+  bool IsOpen() const { return file_.is_open(); }
+
+ private:
+  const std::string path_;
+
+  /// The manifest opened in append mode; closed if RecoverAndOpen failed.
+  std::ofstream file_;
+};
+
+}  // namespace raylet
+}  // namespace ray
@@ -80,6 +80,7 @@ class LeaseDependencyManagerTest : public ::testing::Test {
   void AssertNoLeaks() {
     ASSERT_TRUE(lease_dependency_manager_.required_objects_.empty());
     ASSERT_TRUE(lease_dependency_manager_.queued_lease_requests_.empty());
+    ASSERT_TRUE(lease_dependency_manager_.prefetch_pull_requests_.empty());
     ASSERT_TRUE(lease_dependency_manager_.get_requests_.empty());
     ASSERT_TRUE(lease_dependency_manager_.wait_requests_.empty());
     ASSERT_EQ(lease_dependency_manager_.waiting_leases_counter_.Total(), 0);
@@ -142,6 +143,72 @@ TEST_F(LeaseDependencyManagerTest, TestSimpleLease) {
   AssertNoLeaks();
 }
 
+/// Test that a batch of locally available objects updates each dependent
+/// lease's ready count once and emits all newly ready leases in one batch.
+TEST_F(LeaseDependencyManagerTest, TestHandleObjectsLocalBatch) {
+  // Two leases share one argument; each also has a private argument.
+  auto shared_argument = ObjectID::FromRandom();
+  auto argument1 = ObjectID::FromRandom();
+  auto argument2 = ObjectID::FromRandom();
+  LeaseID lease_id1 = LeaseID::FromRandom();
+  LeaseID lease_id2 = LeaseID::FromRandom();
+  ASSERT_FALSE(lease_dependency_manager_.RequestLeaseDependencies(
+      lease_id1, ObjectIdsToRefs({shared_argument, argument1}), {"foo", false}));
+  ASSERT_FALSE(lease_dependency_manager_.RequestLeaseDependencies(
+      lease_id2, ObjectIdsToRefs({shared_argument, argument2}), {"foo", false}));
+  ASSERT_EQ(NumWaitingTotal(), 2);
+
+  // All arguments arrive as one batch; both leases become ready in one call.
+  auto ready_lease_ids = lease_dependency_manager_.HandleObjectsLocal(
+      {shared_argument, argument1, argument2});
+  ASSERT_EQ(ready_lease_ids.size(), 2);
+  std::unordered_set<LeaseID> ready(ready_lease_ids.begin(), ready_lease_ids.end());
+  ASSERT_TRUE(ready.count(lease_id1) > 0);
+  ASSERT_TRUE(ready.count(lease_id2) > 0);
+  ASSERT_EQ(NumWaitingTotal(), 0);
+
+  lease_dependency_manager_.RemoveLeaseDependencies(lease_id1);
+  lease_dependency_manager_.RemoveLeaseDependencies(lease_id2);
+  AssertNoLeaks();
+}
+
+/// Test speculatively prefetching the dependencies of a lease that is still
+/// queued for scheduling. The prefetch pull is subsumed once the lease's
+/// dependencies are properly requested.
+TEST_F(LeaseDependencyManagerTest, TestPrefetchLeaseDependencies) {
+  ObjectID obj_id = ObjectID::FromRandom();
+  LeaseID lease_id = LeaseID::FromRandom();
+  lease_dependency_manager_.PrefetchLeaseDependencies(lease_id,
+                                                      ObjectIdsToRefs({obj_id}));
+  ASSERT_EQ(object_manager_mock_.active_lease_requests.size(), 1);
+  // Prefetching again for the same lease is a no-op.
+  lease_dependency_manager_.PrefetchLeaseDependencies(lease_id,
+                                                      ObjectIdsToRefs({obj_id}));
+  ASSERT_EQ(object_manager_mock_.active_lease_requests.size(), 1);
+  // The prefetch does not count as a waiting lease.
+  ASSERT_EQ(NumWaitingTotal(), 0);
+
+  // Requesting the dependencies subsumes the prefetch: the speculative pull
+  // is cancelled and only the real pull remains.
+  bool ready = lease_dependency_manager_.RequestLeaseDependencies(
+      lease_id, ObjectIdsToRefs({obj_id}), {"foo", false});
+  ASSERT_FALSE(ready);
+  ASSERT_EQ(object_manager_mock_.active_lease_requests.size(), 1);
+  ASSERT_EQ(NumWaiting("foo"), 1);
+
+  lease_dependency_manager_.HandleObjectLocal(obj_id);
+  lease_dependency_manager_.RemoveLeaseDependencies(lease_id);
+  AssertNoLeaks();
+
+  // A prefetch for a lease that never runs locally is cancelled explicitly.
+  LeaseID spilled_lease_id = LeaseID::FromRandom();
+  lease_dependency_manager_.PrefetchLeaseDependencies(spilled_lease_id,
+                                                      ObjectIdsToRefs({obj_id}));
+  ASSERT_EQ(object_manager_mock_.active_lease_requests.size(), 1);
+  lease_dependency_manager_.CancelPrefetchLeaseDependencies(spilled_lease_id);
+  AssertNoLeaks();
+}
+
 /// Test multiple leases that depend on the same object. The dependency manager
 /// should return all lease IDs as ready once the object is local.
 TEST_F(LeaseDependencyManagerTest, TestMultipleLeases) {
@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/time/clock.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "mock/ray/gcs_client/gcs_client.h"
@@ -685,6 +686,59 @@ TEST_F(LocalObjectManagerTest, TestTryToSpillObjectsZero) {
   ASSERT_EQ(GetCurrentSpilledBytes(), 1 * object_size);
 }
 
+TEST_F(LocalObjectManagerTest, TestTryToSpillObjectsSkipsRecentlyRestored) {
+  ///
+  /// Objects restored within the backoff window are passed over while other
+  /// objects are spillable, but are still spilled once nothing else is.
+  ///
+  RayConfig::instance().object_spilling_restored_object_backoff_s() = 3600;
+  rpc::Address owner_address;
+  owner_address.set_worker_id(WorkerID::FromRandom().Binary());
+
+  std::vector<ObjectID> object_ids;
+  std::vector<std::unique_ptr<RayObject>> objects;
+  int64_t object_size = 1000;
+
+  for (size_t i = 0; i < 3; i++) {
+    ObjectID object_id = ObjectID::FromRandom();
+    object_ids.push_back(object_id);
+    auto data_buffer = std::make_shared<MockObjectBuffer>(object_size, object_id, unpins);
+    auto object = std::make_unique<RayObject>(
+        data_buffer, nullptr, std::vector<rpc::ObjectReference>());
+    objects.push_back(std::move(object));
+  }
+  manager.PinObjectsAndWaitForFree(object_ids, std::move(objects), owner_address);
+  manager.min_spilling_size_ = 0;
+  // Pretend the first object was just restored from external storage.
+  manager.recently_restored_objects_[object_ids[0]] = absl::GetCurrentTimeNanos();
+
+  // Only the two objects outside the backoff window are spilled.
+  ASSERT_TRUE(manager.TryToSpillObjects());
+  ASSERT_TRUE(worker_pool.FlushPopSpillWorkerCallbacks());
+  EXPECT_CALL(worker_pool, PushSpillWorker(_));
+  std::vector<std::string> urls;
+  for (size_t i = 1; i < 3; i++) {
+    urls.push_back(BuildURL("url" + std::to_string(i)));
+  }
+  ASSERT_TRUE(worker_pool.io_worker_client->ReplySpillObjects(urls));
+  ASSERT_TRUE(owner_client->ReplyUpdateObjectLocationBatch());
+  ASSERT_EQ((*unpins)[object_ids[0]], 0);
+  ASSERT_EQ((*unpins)[object_ids[1]], 1);
+  ASSERT_EQ((*unpins)[object_ids[2]], 1);
+  ASSERT_EQ(GetCurrentSpilledCount(), 2);
+
+  // The recently restored object is the only spillable one left. It is
+  // spilled anyway rather than blocking progress under memory pressure.
+  ASSERT_TRUE(manager.TryToSpillObjects());
+  ASSERT_TRUE(worker_pool.FlushPopSpillWorkerCallbacks());
+  EXPECT_CALL(worker_pool, PushSpillWorker(_));
+  ASSERT_TRUE(worker_pool.io_worker_client->ReplySpillObjects({BuildURL("url0")}));
+  ASSERT_TRUE(owner_client->ReplyUpdateObjectLocationBatch());
+  ASSERT_EQ((*unpins)[object_ids[0]], 1);
+  ASSERT_EQ(GetCurrentSpilledCount(), 3);
+  RayConfig::instance().object_spilling_restored_object_backoff_s() = 0;
+}
+
 TEST_F(LocalObjectManagerTest, TestSpillUptoMaxFuseCount) {
   ///
   /// Test objects are only fused up to max_fused_object_count.
@@ -419,7 +419,8 @@ class NodeManagerTest : public ::testing::Test {
         *cluster_resource_scheduler_,
         get_node_info_func,
         [](const ray::RayLease &lease) {},
-        *local_lease_manager_);
+        *local_lease_manager_,
+        *lease_dependency_manager_);
 
     placement_group_resource_manager_ =
         std::make_unique<NewPlacementGroupResourceManager>(*cluster_resource_scheduler_);
@@ -705,6 +706,66 @@ TEST_F(NodeManagerTest, TestPinningAnObjectPendingDeletionFails) {
   EXPECT_FALSE(failed_pin_reply.successes(0));
 }
 
+TEST_F(NodeManagerTest, TestGetResourceLoadServedFromReadLaneCache) {
+  // With the read lane enabled, HandleGetResourceLoad serves the snapshot
+  // refreshed on the main event loop instead of reading the lease manager.
+  RayConfig::instance().node_manager_read_rpc_threads_num() = 1;
+  node_manager_->RefreshResourceLoadCache();
+
+  rpc::GetResourceLoadReply cached_reply;
+  node_manager_->HandleGetResourceLoad(
+      rpc::GetResourceLoadRequest{},
+      &cached_reply,
+      [](Status s, std::function<void()> success, std::function<void()> failure) {});
+  EXPECT_EQ(cached_reply.resources().node_id(), raylet_node_id_.Binary());
+
+  // With the lane disabled the load is computed inline; both paths report the
+  // same node.
+  RayConfig::instance().node_manager_read_rpc_threads_num() = 0;
+  rpc::GetResourceLoadReply direct_reply;
+  node_manager_->HandleGetResourceLoad(
+      rpc::GetResourceLoadRequest{},
+      &direct_reply,
+      [](Status s, std::function<void()> success, std::function<void()> failure) {});
+  EXPECT_EQ(direct_reply.resources().node_id(), raylet_node_id_.Binary());
+}
+
+TEST_F(NodeManagerTest, TestGetNodeStatsServedFromSnapshot) {
+  // With the snapshot enabled, HandleGetNodeStats copies the reply published
+  // by RefreshNodeStatsSnapshot instead of assembling one inline.
+  EXPECT_CALL(mock_worker_pool_, GetAllRegisteredWorkers(_, _))
+      .WillRepeatedly(Return(std::vector<std::shared_ptr<WorkerInterface>>{}));
+  EXPECT_CALL(mock_worker_pool_, GetAllRegisteredDrivers(_, _))
+      .WillRepeatedly(Return(std::vector<std::shared_ptr<WorkerInterface>>{}));
+  RayConfig::instance().node_stats_snapshot_enabled() = true;
+  node_manager_->RefreshNodeStatsSnapshot();
+
+  rpc::GetNodeStatsReply cached_reply;
+  bool replied = false;
+  node_manager_->HandleGetNodeStats(
+      rpc::GetNodeStatsRequest{},
+      &cached_reply,
+      [&replied](
+          Status s, std::function<void()> success, std::function<void()> failure) {
+        replied = s.ok();
+      });
+  EXPECT_TRUE(replied);
+
+  // With the flag disabled the reply is assembled inline; both paths reply
+  // synchronously when there are no workers on the node.
+  RayConfig::instance().node_stats_snapshot_enabled() = false;
+  rpc::GetNodeStatsReply direct_reply;
+  replied = false;
+  node_manager_->HandleGetNodeStats(
+      rpc::GetNodeStatsRequest{},
+      &direct_reply,
+      [&replied](
+          Status s, std::function<void()> success, std::function<void()> failure) {
+        replied = s.ok();
+      });
+  EXPECT_TRUE(replied);
+}
+
 TEST_F(NodeManagerTest, TestConsumeSyncMessage) {
   // Create and wrap a mock resource view sync message.
   syncer::ResourceViewSyncMessage payload;
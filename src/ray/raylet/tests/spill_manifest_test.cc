@@ -0,0 +1,115 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/raylet/spill_manifest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace ray {
+namespace raylet {
+
+class SpillManifestTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    manifest_path_ =
+        (std::filesystem::temp_directory_path() /
+         ("spill_manifest_test_" +
+          ObjectID::FromRandom().Hex()))
+            .string();
+  }
+
+  void TearDown() override { std::filesystem::remove(manifest_path_); }
+
+  std::string manifest_path_;
+};
+
+TEST_F(SpillManifestTest, TestReplayRoundTrip) {
+  auto object_id1 = ObjectID::FromRandom();
+  auto object_id2 = ObjectID::FromRandom();
+  auto object_id3 = ObjectID::FromRandom();
+
+  {
+    SpillManifest manifest(manifest_path_);
+    ASSERT_TRUE(manifest.RecoverAndOpen().empty());
+    ASSERT_TRUE(manifest.IsOpen());
+    manifest.AppendSpilled(object_id1, "/tmp/spill/f1?url=/tmp/spill/f1&offset=0");
+    manifest.AppendSpilled(object_id2, "/tmp/spill/f1?url=/tmp/spill/f1&offset=100");
+    manifest.AppendSpilled(object_id3, "/tmp/spill/f2?url=/tmp/spill/f2&offset=0");
+    manifest.Flush();
+    // Object 2 goes out of scope before the "restart".
+    manifest.AppendDeleted(object_id2);
+    manifest.Flush();
+  }
+
+  SpillManifest reopened(manifest_path_);
+  auto recovered = reopened.RecoverAndOpen();
+  ASSERT_EQ(recovered.size(), 2);
+  ASSERT_EQ(recovered[object_id1], "/tmp/spill/f1?url=/tmp/spill/f1&offset=0");
+  ASSERT_EQ(recovered[object_id3], "/tmp/spill/f2?url=/tmp/spill/f2&offset=0");
+  ASSERT_FALSE(recovered.contains(object_id2));
+}
+
+TEST_F(SpillManifestTest, TestCompaction) {
+  auto object_id = ObjectID::FromRandom();
+  {
+    SpillManifest manifest(manifest_path_);
+    manifest.RecoverAndOpen();
+    // Churn many entries that are deleted again; only one survives.
+    for (int i = 0; i < 100; i++) {
+      auto churned = ObjectID::FromRandom();
+      manifest.AppendSpilled(churned, "/tmp/spill/churn?url=/tmp/spill/churn");
+      manifest.AppendDeleted(churned);
+    }
+    manifest.AppendSpilled(object_id, "/tmp/spill/live?url=/tmp/spill/live");
+    manifest.Flush();
+  }
+  const auto churned_size = std::filesystem::file_size(manifest_path_);
+
+  {
+    SpillManifest reopened(manifest_path_);
+    auto recovered = reopened.RecoverAndOpen();
+    ASSERT_EQ(recovered.size(), 1);
+    ASSERT_EQ(recovered[object_id], "/tmp/spill/live?url=/tmp/spill/live");
+  }
+  // Replay compacts the manifest down to the live entries.
+  ASSERT_LT(std::filesystem::file_size(manifest_path_), churned_size);
+}
+
+TEST_F(SpillManifestTest, TestTornTailTolerated) {
+  auto object_id = ObjectID::FromRandom();
+  {
+    SpillManifest manifest(manifest_path_);
+    manifest.RecoverAndOpen();
+    manifest.AppendSpilled(object_id, "/tmp/spill/f1?url=/tmp/spill/f1");
+    manifest.Flush();
+  }
+  // Simulate a crash mid-append by writing half a record at the end.
+  {
+    std::ofstream out(manifest_path_, std::ios::binary | std::ios::app);
+    out.put(1);
+    out.write("partial", 7);
+  }
+
+  SpillManifest reopened(manifest_path_);
+  auto recovered = reopened.RecoverAndOpen();
+  ASSERT_EQ(recovered.size(), 1);
+  ASSERT_EQ(recovered[object_id], "/tmp/spill/f1?url=/tmp/spill/f1");
+}
+
+}  // namespace raylet
+}  // namespace ray
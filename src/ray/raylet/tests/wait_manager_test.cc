@@ -116,6 +116,46 @@ TEST_F(WaitManagerTest, TestMultiWaits) {
   AssertNoLeaks();
 }
 
+TEST_F(WaitManagerTest, TestBatchObjectsLocal) {
+  ObjectID obj1 = ObjectID::FromRandom();
+  ObjectID obj2 = ObjectID::FromRandom();
+  int num_callbacks = 0;
+  std::vector<ObjectID> ready1;
+  std::vector<ObjectID> remaining1;
+  std::vector<ObjectID> ready2;
+  std::vector<ObjectID> remaining2;
+  // The first wait needs both objects, the second only one of them.
+  wait_manager.Wait(std::vector<ObjectID>{obj1, obj2},
+                    -1,
+                    2,
+                    [&](std::vector<ObjectID> _ready, std::vector<ObjectID> _remaining) {
+                      num_callbacks++;
+                      ready1 = _ready;
+                      remaining1 = _remaining;
+                    });
+  wait_manager.Wait(std::vector<ObjectID>{obj2},
+                    -1,
+                    1,
+                    [&](std::vector<ObjectID> _ready, std::vector<ObjectID> _remaining) {
+                      num_callbacks++;
+                      ready2 = _ready;
+                      remaining2 = _remaining;
+                    });
+  ASSERT_EQ(num_callbacks, 0);
+
+  // One batch satisfies both waits; each wait completes exactly once even
+  // though two of its objects became local in the same batch.
+  wait_manager.HandleObjectsLocal(
+      std::vector<ObjectID>{obj1, obj2, ObjectID::FromRandom()});
+  ASSERT_EQ(num_callbacks, 2);
+  ASSERT_EQ(ready1, (std::vector<ObjectID>{obj1, obj2}));
+  ASSERT_EQ(remaining1, std::vector<ObjectID>{});
+  ASSERT_EQ(ready2, std::vector<ObjectID>{obj2});
+  ASSERT_EQ(remaining2, std::vector<ObjectID>{});
+
+  AssertNoLeaks();
+}
+
 TEST_F(WaitManagerTest, TestWaitTimeout) {
   ObjectID obj1 = ObjectID::FromRandom();
   std::vector<ObjectID> ready;
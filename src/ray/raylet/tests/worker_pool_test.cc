@@ -450,6 +450,11 @@ class WorkerPoolTest : public ::testing::Test {
 
   void AssertNoLeaks() { ASSERT_EQ(worker_pool_->pending_exit_idle_workers_.size(), 0); }
 
+  void SetRuntimeEnvSetupDuration(const std::string &serialized_runtime_env,
+                                  absl::Duration duration) {
+    worker_pool_->runtime_env_setup_durations_[serialized_runtime_env] = duration;
+  }
+
   std::shared_ptr<WorkerInterface> CreateSpillWorker(
       const WorkerID &worker_id, std::unique_ptr<ProcessInterface> proc = nullptr) {
     return worker_pool_->CreateWorker(worker_id,
@@ -703,6 +708,26 @@ TEST_F(WorkerPoolDriverRegisteredTest, TestPrestartingWorkersWithRuntimeEnv) {
   ASSERT_EQ(worker_pool_->NumWorkersStarting(), POOL_SIZE_SOFT_LIMIT);
 }
 
+TEST_F(WorkerPoolDriverRegisteredTest, PrestartProfileRoundTrip) {
+  const std::string profile_path =
+      ::testing::TempDir() + "worker_prestart_profile.json";
+  RayConfig::instance().worker_prestart_profile_path() = profile_path;
+
+  LeaseSpecification lease_spec = ExampleLeaseSpec();
+  lease_spec.GetMutableMessage().mutable_runtime_env_info()->set_serialized_runtime_env(
+      R"({"env_vars": {"FOO": "bar"}})");
+  // Prestarts 2 workers and records the pool composition to the profile file.
+  worker_pool_->PrestartWorkers(lease_spec, 2);
+  ASSERT_EQ(worker_pool_->NumWorkersStarting(), 2);
+  worker_pool_->RecordPrestartProfile();
+
+  // A restarted raylet preforks the recorded counts with the same runtime env.
+  worker_pool_->PrestartWorkersFromProfile();
+  ASSERT_EQ(worker_pool_->NumWorkersStarting(), 4);
+
+  RayConfig::instance().worker_prestart_profile_path() = "";
+}
+
 TEST_F(WorkerPoolDriverRegisteredTest, HandleWorkerPushPop) {
   std::shared_ptr<WorkerInterface> popped_worker;
   const LeaseSpecification lease_spec = ExampleLeaseSpec();
@@ -1708,6 +1733,66 @@ TEST_F(WorkerPoolDriverRegisteredTest, TestWorkerCapping) {
   worker_pool_->ClearProcesses();
 }
 
+TEST_F(WorkerPoolDriverRegisteredTest, TestWorkerCappingPinsExpensiveRuntimeEnvWorkers) {
+  RayConfig::instance().min_idle_workers_per_expensive_runtime_env() = 1;
+  const std::string expensive_env = R"({"conda": "heavy"})";
+  // Pretend the env took a minute to build, well above the threshold.
+  SetRuntimeEnvSetupDuration(expensive_env, absl::Minutes(1));
+
+  // Register enough plain workers to be over the soft limit, then one worker
+  // with the expensive env. Since none of the workers have held a lease, the
+  // last registered worker is at the front of the kill order.
+  rpc::RuntimeEnvInfo runtime_env_info;
+  runtime_env_info.set_serialized_runtime_env(expensive_env);
+  std::vector<std::shared_ptr<WorkerInterface>> workers;
+  int num_workers = POOL_SIZE_SOFT_LIMIT + 2;
+  for (int i = 0; i < num_workers; i++) {
+    const bool is_expensive_env_worker = i == num_workers - 1;
+    PopWorkerStatus status;
+    auto [proc, worker_id] = worker_pool_->StartWorkerProcess(
+        Language::PYTHON,
+        rpc::WorkerType::WORKER,
+        JOB_ID,
+        &status,
+        /*dynamic_options=*/{},
+        /*runtime_env_hash=*/0,
+        /*serialized_runtime_env_context=*/"{}",
+        is_expensive_env_worker ? runtime_env_info : rpc::RuntimeEnvInfo());
+    auto worker =
+        worker_pool_->CreateWorker(worker_id, nullptr, Language::PYTHON, JOB_ID);
+    workers.push_back(worker);
+    RAY_CHECK_OK(worker_pool_->RegisterWorker(worker, proc.GetId(), [](Status, int) {}));
+    worker_pool_->OnWorkerStarted(worker);
+    worker_pool_->PushWorker(worker);
+  }
+  auto expensive_worker = workers.back();
+  ASSERT_EQ(worker_pool_->GetIdleWorkerSize(), num_workers);
+  ASSERT_EQ(worker_pool_->GetIdleWorkers().front().worker, expensive_worker);
+
+  // All workers have been idle for longer than the timeout, but the pinned
+  // reservation keeps the expensive-env worker alive even though it is the
+  // first kill candidate; a plain worker is killed instead.
+  worker_pool_->SetCurrentTimeMs(2000);
+  worker_pool_->TryKillingIdleWorkers();
+  ASSERT_EQ(worker_pool_->GetIdleWorkerSize(), POOL_SIZE_SOFT_LIMIT + 1);
+  for (const auto &worker : workers) {
+    auto mock_rpc_client_it = mock_worker_rpc_clients_.find(worker->WorkerId());
+    if (worker == expensive_worker) {
+      ASSERT_EQ(mock_rpc_client_it->second->exit_count, 0);
+    } else if (mock_rpc_client_it->second->exit_count > 0) {
+      mock_rpc_client_it->second->ExitReplySucceed();
+    }
+  }
+  bool expensive_worker_idle = false;
+  for (const auto &entry : worker_pool_->GetIdleWorkers()) {
+    expensive_worker_idle |= entry.worker == expensive_worker;
+  }
+  ASSERT_TRUE(expensive_worker_idle);
+
+  RayConfig::instance().min_idle_workers_per_expensive_runtime_env() = 0;
+  worker_pool_->ClearProcesses();
+}
+
 TEST_F(WorkerPoolDriverRegisteredTest, TestWorkerCappingWithExitDelay) {
   ///
   /// When there are multiple workers in a worker process, and the worker process's Exit
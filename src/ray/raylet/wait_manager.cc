@@ -101,13 +101,25 @@ void WaitManager::HandleObjectLocal(const ray::ObjectID &object_id) {
   if (object_to_wait_requests_.find(object_id) == object_to_wait_requests_.end()) {
     return;
   }
+  HandleObjectsLocal({object_id});
+}
 
-  std::vector<uint64_t> complete_waits;
-  for (const auto &wait_id : object_to_wait_requests_.at(object_id)) {
-    auto &wait_request = map_find_or_die(wait_requests_, wait_id);
-    wait_request.ready_.emplace(object_id);
-    if (wait_request.ready_.size() >= wait_request.num_required_objects_) {
-      complete_waits.emplace_back(wait_id);
+void WaitManager::HandleObjectsLocal(const std::vector<ray::ObjectID> &object_ids) {
+  // Mark every object ready before completing anything, so a wait covered by
+  // several objects in the batch completes once with all of them accounted
+  // for instead of once per object.
+  absl::flat_hash_set<uint64_t> complete_waits;
+  for (const auto &object_id : object_ids) {
+    auto it = object_to_wait_requests_.find(object_id);
+    if (it == object_to_wait_requests_.end()) {
+      continue;
+    }
+    for (const auto &wait_id : it->second) {
+      auto &wait_request = map_find_or_die(wait_requests_, wait_id);
+      wait_request.ready_.emplace(object_id);
+      if (wait_request.ready_.size() >= wait_request.num_required_objects_) {
+        complete_waits.emplace(wait_id);
+      }
     }
   }
   for (const auto &wait_id : complete_waits) {
@@ -15,10 +15,10 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "ray/common/id.h"
 
 namespace ray {
@@ -58,6 +58,14 @@ class WaitManager {
   /// available.
   void HandleObjectLocal(const ray::ObjectID &object_id);
 
+  /// Batch form of HandleObjectLocal. All objects are marked ready across the
+  /// affected wait requests in one pass over the object-to-waits index, and
+  /// each satisfied wait completes exactly once, even when several objects in
+  /// the batch belong to it.
+  ///
+  /// \param object_ids The object IDs that are locally available.
+  void HandleObjectsLocal(const std::vector<ray::ObjectID> &object_ids);
+
   std::string DebugString() const;
 
  private:
@@ -79,7 +87,7 @@ class WaitManager {
     /// The number of required objects.
     const uint64_t num_required_objects_;
     /// The objects that have been locally available.
-    std::unordered_set<ObjectID> ready_;
+    absl::flat_hash_set<ObjectID> ready_;
   };
 
   /// Completion handler for Wait.
@@ -96,10 +104,12 @@ class WaitManager {
   const std::function<void(std::function<void()>, int64_t delay_ms)> delay_executor_;
 
   /// A set of active wait requests.
-  std::unordered_map<uint64_t, WaitRequest> wait_requests_;
+  absl::flat_hash_map<uint64_t, WaitRequest> wait_requests_;
 
-  /// Map from object to wait requests that are waiting for this object.
-  std::unordered_map<ObjectID, std::unordered_set<uint64_t>> object_to_wait_requests_;
+  /// Inverted index from object to the wait requests waiting for it, so a
+  /// locality event only touches the waits it affects.
+  absl::flat_hash_map<ObjectID, absl::flat_hash_set<uint64_t>>
+      object_to_wait_requests_;
 
   uint64_t next_wait_id_;
 
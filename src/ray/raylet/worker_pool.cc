@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstdio>
 #include <deque>
 #include <fstream>
 #include <iostream>
@@ -28,6 +29,7 @@
 #include <vector>
 
 #include "absl/strings/str_split.h"
+#include "nlohmann/json.hpp"
 #include "ray/common/constants.h"
 #include "ray/common/lease/lease_spec.h"
 #include "ray/common/protobuf_utils.h"
@@ -194,6 +196,14 @@ void WorkerPool::Start() {
     LeaseSpecification lease_spec{std::move(rpc_lease_spec)};
     PrestartWorkersInternal(lease_spec, num_prestart_python_workers);
   }
+
+  if (!RayConfig::instance().worker_prestart_profile_path().empty()) {
+    PrestartWorkersFromProfile();
+    periodical_runner_->RunFnPeriodically(
+        [this] { RecordPrestartProfile(); },
+        RayConfig::instance().worker_prestart_profile_update_interval_ms(),
+        "RayletWorkerPool.deadline_timer.record_prestart_profile");
+  }
 }
 
 // NOTE(kfstorm): The node manager cannot be passed via WorkerPool constructor because the
@@ -254,11 +264,29 @@ const ProcessInterface &WorkerPool::AddWorkerProcess(
                         runtime_env_info,
                         dynamic_options,
                         worker_startup_keep_alive_duration});
+  if (RayConfig::instance().prestage_worker_registration_enabled() && free_ports_) {
+    // Reserve the worker's port now so the registration handshake is a plain
+    // lookup-and-activate. If no port is free we fall back to allocating one
+    // at registration time, which will fail the handshake with the same error
+    // as before.
+    int port = 0;
+    if (GetNextFreePort(&port).ok()) {
+      it->second.prereserved_port = port;
+    }
+  }
   return *it->second.proc;
 }
 
 void WorkerPool::RemoveWorkerProcess(State &state, const WorkerID &worker_id) {
-  state.worker_processes.erase(worker_id);
+  auto it = state.worker_processes.find(worker_id);
+  if (it == state.worker_processes.end()) {
+    return;
+  }
+  if (it->second.prereserved_port.has_value()) {
+    // The process is going away before registration consumed its port.
+    MarkPortAsFree(*it->second.prereserved_port);
+  }
+  state.worker_processes.erase(it);
 }
 
 std::pair<std::vector<std::string>, ProcessEnvironment>
@@ -822,15 +850,22 @@ Status WorkerPool::RegisterWorker(const std::shared_ptr<WorkerInterface> &worker
   }
 #endif
 
+  auto &starting_process_info = it->second;
   // The port that this worker's gRPC server should listen on. 0 if the worker
   // should bind on a random port.
   int port = 0;
-  Status status = GetNextFreePort(&port);
-  if (!status.ok()) {
-    send_reply_callback(status, /*port=*/0);
-    return status;
+  if (starting_process_info.prereserved_port.has_value()) {
+    // The port was reserved when the process was started; just activate the
+    // pre-staged state without scanning the free port list.
+    port = *starting_process_info.prereserved_port;
+    starting_process_info.prereserved_port.reset();
+  } else {
+    Status status = GetNextFreePort(&port);
+    if (!status.ok()) {
+      send_reply_callback(status, /*port=*/0);
+      return status;
+    }
   }
-  auto &starting_process_info = it->second;
   auto end = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
       end - starting_process_info.start_time);
@@ -1132,6 +1167,21 @@ void WorkerPool::PushWorker(const std::shared_ptr<WorkerInterface> &worker) {
     absl::Time keep_alive_until =
         now +
         absl::Milliseconds(RayConfig::instance().idle_worker_killing_time_threshold_ms());
+    const double env_cost_multiplier =
+        RayConfig::instance().idle_worker_env_setup_cost_multiplier();
+    if (env_cost_multiplier > 0) {
+      // Let workers with expensive runtime envs stay idle proportionally
+      // longer since recreating the env on a future lease is expensive.
+      const std::string *serialized_runtime_env =
+          LookupWorkerSerializedRuntimeEnv(*worker);
+      if (serialized_runtime_env != nullptr) {
+        auto duration_it = runtime_env_setup_durations_.find(*serialized_runtime_env);
+        if (duration_it != runtime_env_setup_durations_.end()) {
+          keep_alive_until = std::max(
+              keep_alive_until, now + duration_it->second * env_cost_multiplier);
+        }
+      }
+    }
     if (worker->GetGrantedLeaseTime() == absl::Time()) {
       // Newly registered worker. Respect worker_startup_keep_alive_duration if any.
       auto it = state.worker_processes.find(worker->WorkerId());
@@ -1200,12 +1250,53 @@ void WorkerPool::TryKillingIdleWorkers() {
                  << num_killable_idle_workers
                  << ", num desired workers : " << num_desired_idle_workers;
 
+  // Count the idle workers per runtime env whose measured setup time makes
+  // the env expensive to recreate; a pinned reservation of such workers is
+  // exempt from soft limit enforcement below.
+  const int64_t num_pinned_per_expensive_env =
+      RayConfig::instance().min_idle_workers_per_expensive_runtime_env();
+  absl::flat_hash_map<std::string, int64_t> num_idle_per_expensive_env;
+  if (num_pinned_per_expensive_env > 0) {
+    const absl::Duration expensive_threshold = absl::Milliseconds(
+        RayConfig::instance().expensive_runtime_env_setup_threshold_ms());
+    for (const auto &entry : idle_of_all_languages_) {
+      const std::string *serialized_runtime_env =
+          LookupWorkerSerializedRuntimeEnv(*entry.worker);
+      if (serialized_runtime_env == nullptr ||
+          IsRuntimeEnvEmpty(*serialized_runtime_env)) {
+        continue;
+      }
+      auto duration_it = runtime_env_setup_durations_.find(*serialized_runtime_env);
+      if (duration_it != runtime_env_setup_durations_.end() &&
+          duration_it->second >= expensive_threshold) {
+        num_idle_per_expensive_env[*serialized_runtime_env]++;
+      }
+    }
+  }
+
   // Iterate through the list and try to kill enough workers so that we are at
   // the soft limit.
   auto it = idle_of_all_languages_.begin();
   while (num_killable_idle_workers > num_desired_idle_workers &&
          it != idle_of_all_languages_.end()) {
     if (worker_killable(*it)) {
+      if (num_pinned_per_expensive_env > 0) {
+        const std::string *serialized_runtime_env =
+            LookupWorkerSerializedRuntimeEnv(*it->worker);
+        if (serialized_runtime_env != nullptr) {
+          auto env_it = num_idle_per_expensive_env.find(*serialized_runtime_env);
+          if (env_it != num_idle_per_expensive_env.end()) {
+            if (env_it->second <= num_pinned_per_expensive_env) {
+              // Keep the pinned reservation of workers with this expensive
+              // runtime env alive.
+              num_killable_idle_workers--;
+              it++;
+              continue;
+            }
+            env_it->second--;
+          }
+        }
+      }
       RAY_LOG(DEBUG) << "Number of idle workers " << num_killable_idle_workers
                      << " is larger than the number of desired workers "
                      << num_desired_idle_workers << " killing idle worker with PID "
@@ -1568,6 +1659,95 @@ void WorkerPool::PrestartWorkersInternal(const LeaseSpecification &lease_spec,
   }
 }
 
+void WorkerPool::RecordPrestartProfile() const {
+  // Snapshot the current pool composition: the number of live non-IO worker
+  // processes per language and serialized runtime env.
+  nlohmann::json profile = nlohmann::json::array();
+  for (const auto &[language, state] : states_by_lang_) {
+    absl::flat_hash_map<std::string, int64_t> num_workers_by_runtime_env;
+    for (const auto &entry : state.worker_processes) {
+      if (entry.second.worker_type != rpc::WorkerType::WORKER) {
+        continue;
+      }
+      num_workers_by_runtime_env[entry.second.runtime_env_info
+                                     .serialized_runtime_env()]++;
+    }
+    for (const auto &[serialized_runtime_env, num_workers] :
+         num_workers_by_runtime_env) {
+      nlohmann::json profile_entry;
+      profile_entry["language"] = Language_Name(language);
+      profile_entry["serialized_runtime_env"] = serialized_runtime_env;
+      profile_entry["num_workers"] = num_workers;
+      profile.push_back(std::move(profile_entry));
+    }
+  }
+
+  // Write to a temporary file and rename it into place so that a raylet
+  // restarting mid-write never observes a truncated profile.
+  const std::string &path = RayConfig::instance().worker_prestart_profile_path();
+  const std::string tmp_path = path + ".tmp";
+  std::ofstream file(tmp_path, std::ios::trunc);
+  if (!file) {
+    RAY_LOG(WARNING) << "Failed to open worker prestart profile file " << tmp_path;
+    return;
+  }
+  file << profile.dump();
+  file.close();
+  if (!file || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    RAY_LOG(WARNING) << "Failed to write worker prestart profile file " << path;
+  }
+}
+
+void WorkerPool::PrestartWorkersFromProfile() {
+  const std::string &path = RayConfig::instance().worker_prestart_profile_path();
+  std::ifstream file(path);
+  if (!file) {
+    // First start on this node; no profile has been recorded yet.
+    return;
+  }
+  nlohmann::json profile;
+  try {
+    file >> profile;
+  } catch (const nlohmann::json::exception &e) {
+    RAY_LOG(WARNING) << "Failed to parse worker prestart profile file " << path << ": "
+                     << e.what();
+    return;
+  }
+  if (!profile.is_array()) {
+    RAY_LOG(WARNING) << "Ignoring malformed worker prestart profile file " << path;
+    return;
+  }
+
+  // Don't prefork more workers than the machine has CPUs, mirroring the cap
+  // used by PrestartWorkers.
+  int64_t remaining_budget = get_num_cpus_available_();
+  for (const auto &profile_entry : profile) {
+    if (remaining_budget <= 0) {
+      break;
+    }
+    Language language;
+    if (!profile_entry.is_object() ||
+        !Language_Parse(profile_entry.value("language", ""), &language)) {
+      continue;
+    }
+    const int64_t num_workers = std::min<int64_t>(
+        profile_entry.value("num_workers", int64_t{0}), remaining_budget);
+    if (num_workers <= 0) {
+      continue;
+    }
+    remaining_budget -= num_workers;
+
+    rpc::LeaseSpec rpc_lease_spec;
+    rpc_lease_spec.set_language(language);
+    rpc_lease_spec.mutable_runtime_env_info()->set_serialized_runtime_env(
+        profile_entry.value("serialized_runtime_env", "{}"));
+    LeaseSpecification lease_spec{std::move(rpc_lease_spec)};
+    RAY_LOG(INFO) << "Prestarting " << num_workers << " " << Language_Name(language)
+                  << " worker(s) recorded in the worker prestart profile.";
+    PrestartWorkersInternal(lease_spec, num_workers);
+  }
+}
+
 void WorkerPool::DisconnectWorker(const std::shared_ptr<WorkerInterface> &worker,
                                   rpc::WorkerExitType disconnect_type) {
   MarkPortAsFree(worker->AssignedPort());
@@ -1839,15 +2019,22 @@ void WorkerPool::GetOrCreateRuntimeEnv(const std::string &serialized_runtime_env
                                        const GetOrCreateRuntimeEnvCallback &callback) {
   RAY_LOG(DEBUG) << "GetOrCreateRuntimeEnv for job " << job_id << " with runtime_env "
                  << serialized_runtime_env;
+  const absl::Time setup_start_time = get_time_();
   runtime_env_agent_client_->GetOrCreateRuntimeEnv(
       job_id,
       serialized_runtime_env,
       runtime_env_config,
-      [job_id, serialized_runtime_env, runtime_env_config, callback](
-          bool successful,
-          const std::string &serialized_runtime_env_context,
-          const std::string &setup_error_message) {
+      [this, job_id, serialized_runtime_env, runtime_env_config, callback,
+       setup_start_time](bool successful,
+                         const std::string &serialized_runtime_env_context,
+                         const std::string &setup_error_message) {
         if (successful) {
+          // Remember how long the env took to build so that idle worker
+          // eviction can weigh the cost of recreating it. Keep the longest
+          // observed duration; cached creations return quickly and would
+          // otherwise mask the real setup cost.
+          auto &setup_duration = runtime_env_setup_durations_[serialized_runtime_env];
+          setup_duration = std::max(setup_duration, get_time_() - setup_start_time);
           callback(true, serialized_runtime_env_context, "");
         } else {
           RAY_LOG(WARNING) << "Couldn't create a runtime environment for job " << job_id
@@ -1886,6 +2073,19 @@ const std::vector<std::string> &WorkerPool::LookupWorkerDynamicOptions(
   return kNoDynamicOptions;
 }
 
+const std::string *WorkerPool::LookupWorkerSerializedRuntimeEnv(
+    const WorkerInterface &worker) const {
+  auto lang_it = states_by_lang_.find(worker.GetLanguage());
+  if (lang_it == states_by_lang_.end()) {
+    return nullptr;
+  }
+  auto it = lang_it->second.worker_processes.find(worker.WorkerId());
+  if (it == lang_it->second.worker_processes.end()) {
+    return nullptr;
+  }
+  return &it->second.runtime_env_info.serialized_runtime_env();
+}
+
 const NodeID &WorkerPool::GetNodeID() const { return node_id_; }
 
 }  // namespace raylet
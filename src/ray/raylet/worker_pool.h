@@ -497,6 +497,17 @@ class WorkerPool : public WorkerPoolInterface {
 
   void PrestartWorkersInternal(const LeaseSpecification &lease_spec, int64_t num_needed);
 
+  /// Record the current per-language/runtime-env worker counts to the worker
+  /// prestart profile file so that a restarted raylet can prefork a pool of
+  /// the same shape. Called periodically when
+  /// `worker_prestart_profile_path` is set.
+  void RecordPrestartProfile() const;
+
+  /// Prestart workers according to the counts recorded in the worker prestart
+  /// profile file, if one exists. Called once from `Start()` when
+  /// `worker_prestart_profile_path` is set.
+  void PrestartWorkersFromProfile();
+
   /// Return the current size of the worker pool for the requested language. Counts only
   /// idle workers.
   ///
@@ -620,6 +631,13 @@ class WorkerPool : public WorkerPoolInterface {
   const std::vector<std::string> &LookupWorkerDynamicOptions(
       const WorkerID &worker_id) const;
 
+  /// Look up the serialized runtime env the given worker was started with.
+  ///
+  /// \return A pointer to the serialized runtime env, or nullptr if the worker
+  /// process is no longer tracked.
+  const std::string *LookupWorkerSerializedRuntimeEnv(
+      const WorkerInterface &worker) const;
+
   struct IOWorkerState {
     /// The pool of idle I/O workers.
     std::unordered_set<std::shared_ptr<WorkerInterface>> idle_io_workers;
@@ -648,6 +666,11 @@ class WorkerPool : public WorkerPoolInterface {
     std::vector<std::string> dynamic_options;
     /// The duration to keep the newly created worker alive before it's assigned a lease.
     std::optional<absl::Duration> worker_startup_keep_alive_duration;
+    /// The gRPC port reserved for this worker when the process was started, if
+    /// `prestage_worker_registration_enabled` is set and a port range is
+    /// configured. Consumed by `RegisterWorker`; released back to the free port
+    /// pool if the process is removed before it registers.
+    std::optional<int> prereserved_port;
   };
 
   /// An internal data structure that maintains the pool state per language.
@@ -911,6 +934,11 @@ class WorkerPool : public WorkerPoolInterface {
   absl::flat_hash_map<WorkerID, std::shared_ptr<WorkerInterface>>
       pending_exit_idle_workers_;
 
+  /// The longest observed setup duration per serialized runtime env. Used to
+  /// weight idle worker eviction so workers with expensive runtime envs
+  /// survive idle churn.
+  absl::flat_hash_map<std::string, absl::Duration> runtime_env_setup_durations_;
+
   /// The runner to run function periodically.
   std::shared_ptr<PeriodicalRunner> periodical_runner_;
 
@@ -20,7 +20,9 @@
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/bind/bind.hpp>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -93,9 +95,21 @@ std::shared_ptr<ServerConnection> ServerConnection::Create(local_stream_socket &
   return std::make_shared<ServerConnection>(PrivateTag{}, std::move(socket));
 }
 
+namespace {
+
+/// Cap on the number of drained write buffers pooled per connection; buffers
+/// returned beyond this are freed.
+constexpr size_t kAsyncWriteBufferPoolMaxSize = 64;
+
+/// Size of the wire header preceding every message: cookie, type, length.
+constexpr size_t kMessageHeaderSize = 3 * sizeof(int64_t);
+
+}  // namespace
+
 ServerConnection::ServerConnection(PrivateTag, local_stream_socket &&socket)
     : socket_(std::move(socket)),
-      async_write_max_messages_(1),
+      async_write_max_messages_(static_cast<int>(
+          RayConfig::instance().raylet_ipc_async_write_max_messages())),
       async_write_queue_(),
       async_write_in_flight_(false),
       async_write_broken_pipe_(false) {
@@ -207,7 +221,7 @@ void ServerConnection::WriteMessageAsync(
   async_writes_ += 1;
   bytes_written_ += length;
 
-  auto write_buffer = std::make_unique<AsyncWriteBuffer>();
+  auto write_buffer = AcquireAsyncWriteBuffer();
   write_buffer->write_cookie = RayConfig::instance().ray_cookie();
   write_buffer->write_type = type;
   write_buffer->write_length = length;
@@ -253,8 +267,9 @@ void ServerConnection::DoAsyncWrites() {
   auto call_handlers = [this](const ray::Status &status, int num_msgs) {
     for (int i = 0; i < num_msgs; i++) {
       auto write_buffer = std::move(async_write_queue_.front());
-      write_buffer->handler(status);
       async_write_queue_.pop_front();
+      write_buffer->handler(status);
+      ReleaseAsyncWriteBuffer(std::move(write_buffer));
     }
     // We finished writing, so mark that we're no longer doing an async write.
     async_write_in_flight_ = false;
@@ -332,6 +347,28 @@ void ServerConnection::DoAsyncWrites() {
   }
 }
 
+std::unique_ptr<ServerConnection::AsyncWriteBuffer>
+ServerConnection::AcquireAsyncWriteBuffer() {
+  if (!async_write_buffer_pool_.empty()) {
+    auto write_buffer = std::move(async_write_buffer_pool_.back());
+    async_write_buffer_pool_.pop_back();
+    return write_buffer;
+  }
+  return std::make_unique<AsyncWriteBuffer>();
+}
+
+void ServerConnection::ReleaseAsyncWriteBuffer(
+    std::unique_ptr<AsyncWriteBuffer> write_buffer) {
+  if (async_write_buffer_pool_.size() >= kAsyncWriteBufferPoolMaxSize) {
+    return;
+  }
+  // Keep the message vector's capacity so the next write into this buffer
+  // doesn't reallocate.
+  write_buffer->write_message.clear();
+  write_buffer->handler = nullptr;
+  async_write_buffer_pool_.push_back(std::move(write_buffer));
+}
+
 std::shared_ptr<ClientConnection> ClientConnection::Create(
     MessageHandler message_handler,
     ConnectionErrorHandler connection_error_handler,
@@ -371,6 +408,10 @@ void ClientConnection::Close() {
 }
 
 void ClientConnection::ProcessMessages() {
+  if (RayConfig::instance().raylet_ipc_buffered_reads_enabled()) {
+    ProcessMessagesBuffered();
+    return;
+  }
   // Wait for a message header from the client. The message header includes the
   // protocol version, the message type, and the length of the message.
   std::vector<boost::asio::mutable_buffer> header{
@@ -452,6 +493,114 @@ void ClientConnection::ProcessMessageHeader(const boost::system::error_code &err
   }
 }
 
+void ClientConnection::ProcessMessagesBuffered() {
+  if (closed_) {
+    return;
+  }
+  if (!HasCompleteBufferedMessage()) {
+    ReadIntoBuffer();
+    return;
+  }
+  // Dispatch through the event loop rather than calling the handler inline, so
+  // a buffer full of small messages cannot recurse through
+  // handler -> ProcessMessages -> handler.
+  auto this_ptr = shared_ClientConnection_from_this();
+  auto &io_context = static_cast<instrumented_io_context &>(
+      ServerConnection::socket_.get_executor().context());
+  io_context.post([this, this_ptr]() { DispatchBufferedMessage(); },
+                  "ClientConnection.buffered_read.DispatchBufferedMessage");
+}
+
+bool ClientConnection::HasCompleteBufferedMessage() const {
+  const size_t available = read_buffer_end_ - read_buffer_offset_;
+  if (available < kMessageHeaderSize) {
+    return false;
+  }
+  uint64_t length;
+  std::memcpy(&length,
+              read_buffer_.data() + read_buffer_offset_ + 2 * sizeof(int64_t),
+              sizeof(length));
+  return available - kMessageHeaderSize >= length;
+}
+
+void ClientConnection::DispatchBufferedMessage() {
+  if (closed_) {
+    return;
+  }
+  const uint8_t *header = read_buffer_.data() + read_buffer_offset_;
+  std::memcpy(&read_cookie_, header, sizeof(read_cookie_));
+  std::memcpy(&read_type_, header + sizeof(read_cookie_), sizeof(read_type_));
+  std::memcpy(&read_length_,
+              header + sizeof(read_cookie_) + sizeof(read_type_),
+              sizeof(read_length_));
+  if (!CheckRayCookie()) {
+    RAY_LOG(WARNING) << "Mismatched Ray cookie, closing client connection.";
+    Close();
+    return;
+  }
+  read_buffer_offset_ += kMessageHeaderSize;
+  read_message_.assign(read_buffer_.begin() + read_buffer_offset_,
+                       read_buffer_.begin() + read_buffer_offset_ + read_length_);
+  read_buffer_offset_ += read_length_;
+  ServerConnection::bytes_read_ += read_length_;
+  ProcessMessage(boost::system::error_code());
+}
+
+void ClientConnection::ReadIntoBuffer() {
+  // Compact any partial message to the front of the buffer.
+  if (read_buffer_offset_ > 0) {
+    const size_t remaining = read_buffer_end_ - read_buffer_offset_;
+    std::memmove(
+        read_buffer_.data(), read_buffer_.data() + read_buffer_offset_, remaining);
+    read_buffer_offset_ = 0;
+    read_buffer_end_ = remaining;
+  }
+  // Size the buffer to the configured capacity; a single message larger than
+  // that grows the buffer to fit.
+  size_t capacity = std::max<size_t>(RayConfig::instance().raylet_ipc_read_buffer_size(),
+                                     kMessageHeaderSize);
+  if (read_buffer_end_ >= kMessageHeaderSize) {
+    uint64_t length;
+    std::memcpy(&length, read_buffer_.data() + 2 * sizeof(int64_t), sizeof(length));
+    capacity = std::max(capacity, kMessageHeaderSize + length);
+  }
+  if (read_buffer_.size() < capacity) {
+    read_buffer_.resize(capacity);
+  }
+  auto this_ptr = shared_ClientConnection_from_this();
+  ServerConnection::socket_.async_read_some(
+      boost::asio::buffer(read_buffer_.data() + read_buffer_end_,
+                          read_buffer_.size() - read_buffer_end_),
+      [this, this_ptr](const boost::system::error_code &ec, size_t bytes_read) {
+        if (ec) {
+          // Surface the error through the same path as the unbuffered reads.
+          read_length_ = 0;
+          ProcessMessage(ec);
+          return;
+        }
+        read_buffer_end_ += bytes_read;
+        ProcessMessagesBuffered();
+      });
+}
+
+Status ClientConnection::ReadBuffer(
+    const std::vector<boost::asio::mutable_buffer> &buffer) {
+  for (const auto &b : buffer) {
+    // Serve leading bytes out of the buffered-read buffer, if any.
+    size_t copied = 0;
+    const size_t available = read_buffer_end_ - read_buffer_offset_;
+    if (available > 0) {
+      copied = std::min(available, boost::asio::buffer_size(b));
+      std::memcpy(b.data(), read_buffer_.data() + read_buffer_offset_, copied);
+      read_buffer_offset_ += copied;
+    }
+    if (copied < boost::asio::buffer_size(b)) {
+      RAY_RETURN_NOT_OK(ServerConnection::ReadBuffer({boost::asio::buffer(b + copied)}));
+    }
+  }
+  return Status::OK();
+}
+
 bool ClientConnection::CheckRayCookie() {
   if (read_cookie_ == RayConfig::instance().ray_cookie()) {
     return true;
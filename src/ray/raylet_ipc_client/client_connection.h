@@ -131,15 +131,27 @@ class ServerConnection : public std::enable_shared_from_this<ServerConnection> {
     std::function<void(const ray::Status &)> handler;
   };
 
+  /// Acquire a write buffer for an outgoing message, reusing a pooled buffer
+  /// when one is available.
+  std::unique_ptr<AsyncWriteBuffer> AcquireAsyncWriteBuffer();
+
+  /// Return a drained write buffer to the pool for reuse. Buffers beyond the
+  /// pool cap are simply freed.
+  void ReleaseAsyncWriteBuffer(std::unique_ptr<AsyncWriteBuffer> write_buffer);
+
   /// The socket connection to the server.
   local_stream_socket socket_;
 
-  /// Max number of messages to write out at once.
+  /// Max number of messages to coalesce into a single vectored write.
   const int async_write_max_messages_;
 
   /// List of pending messages to write.
   std::deque<std::unique_ptr<AsyncWriteBuffer>> async_write_queue_;
 
+  /// Drained write buffers kept for reuse, so steady-state async writes don't
+  /// allocate a fresh buffer (and message vector) per message.
+  std::vector<std::unique_ptr<AsyncWriteBuffer>> async_write_buffer_pool_;
+
   /// Whether we are in the middle of an async write.
   bool async_write_in_flight_;
 
@@ -233,6 +245,12 @@ class ClientConnection : public ServerConnection {
   /// ProcessClientMessage handler will be called.
   void ProcessMessages();
 
+  /// Read a buffer from this connection. Bytes already drained into the
+  /// buffered-read buffer are served first, so synchronous reads (e.g. the fd
+  /// passing handshake in the plasma store) stay ordered with respect to
+  /// buffered message reads.
+  Status ReadBuffer(const std::vector<boost::asio::mutable_buffer> &buffer) override;
+
   std::string GetDebugLabel() const { return debug_label_; }
 
  protected:
@@ -266,6 +284,21 @@ class ClientConnection : public ServerConnection {
   /// \return Information of remote endpoint.
   std::string RemoteEndpointInfo();
 
+  /// Buffered read path (raylet_ipc_buffered_reads_enabled): a single
+  /// read_some drains whatever the client has written into read_buffer_ and
+  /// messages are parsed out of it without further syscalls, instead of
+  /// issuing two reads (header, then body) per message.
+  void ProcessMessagesBuffered();
+  /// Whether read_buffer_ holds at least one complete message.
+  bool HasCompleteBufferedMessage() const;
+  /// Extract the next message from read_buffer_ and invoke the message
+  /// handler for it.
+  void DispatchBufferedMessage();
+  /// Start an async read_some into the free tail of read_buffer_, compacting
+  /// any partial message to the front and growing the buffer if the pending
+  /// message is larger than the configured capacity.
+  void ReadIntoBuffer();
+
   /// Whether the client has sent us a registration message yet.
   bool registered_;
   /// Whether the connection has been explicitly closed by the server.
@@ -284,6 +317,11 @@ class ClientConnection : public ServerConnection {
   int64_t read_type_;
   uint64_t read_length_;
   std::vector<uint8_t> read_message_;
+  /// Connection-level read buffer for the buffered read path. Bytes in
+  /// [read_buffer_offset_, read_buffer_end_) are received but not yet parsed.
+  std::vector<uint8_t> read_buffer_;
+  size_t read_buffer_offset_ = 0;
+  size_t read_buffer_end_ = 0;
 };
 
 // Returns `true` for any connections that have disconnected unexpectedly.
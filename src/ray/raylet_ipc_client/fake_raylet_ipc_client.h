@@ -69,6 +69,11 @@ class FakeRayletIpcClient : public RayletIpcClientInterface {
 
   Status CancelGetRequest(int64_t request_id) override { return Status::OK(); }
 
+  StatusOr<absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage>>
+  GetCachedObjectLocations(const std::vector<ObjectID> &object_ids) override {
+    return absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage>();
+  }
+
   Status NotifyWorkerBlocked() override { return Status::OK(); }
 
   Status NotifyWorkerUnblocked() override { return Status::OK(); }
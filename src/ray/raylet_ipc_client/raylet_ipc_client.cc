@@ -220,6 +220,39 @@ Status RayletIpcClient::CancelGetRequest(int64_t request_id) {
   return WriteMessage(MessageType::CancelGetRequest, &fbb);
 }
 
+StatusOr<absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage>>
+RayletIpcClient::GetCachedObjectLocations(const std::vector<ObjectID> &object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = protocol::CreateGetCachedObjectLocationsRequest(
+      fbb, flatbuf::to_flatbuf(fbb, object_ids));
+  fbb.Finish(message);
+  std::vector<uint8_t> reply;
+  RAY_RETURN_NOT_OK(AtomicRequestReply(MessageType::GetCachedObjectLocationsRequest,
+                                       MessageType::GetCachedObjectLocationsReply,
+                                       &reply,
+                                       &fbb));
+  // Parse the flatbuffer object.
+  auto reply_message =
+      flatbuffers::GetRoot<protocol::GetCachedObjectLocationsReply>(reply.data());
+  auto *locations = reply_message->locations();
+  absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage> result;
+  result.reserve(locations->size());
+  for (size_t i = 0; i < locations->size(); i++) {
+    const auto *entry = locations->Get(i);
+    rpc::WorkerObjectLocationsPubMessage info;
+    for (size_t j = 0; j < entry->node_ids()->size(); j++) {
+      info.add_node_ids(entry->node_ids()->Get(j)->str());
+    }
+    info.set_object_size(entry->object_size());
+    info.set_spilled_url(entry->spilled_url()->str());
+    info.set_spilled_node_id(entry->spilled_node_id()->str());
+    info.set_did_spill(!entry->spilled_url()->str().empty());
+    info.set_pending_creation(entry->pending_creation());
+    result.emplace(ObjectID::FromBinary(entry->object_id()->str()), std::move(info));
+  }
+  return result;
+}
+
 Status RayletIpcClient::NotifyWorkerBlocked() {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = protocol::CreateNotifyWorkerBlocked(fbb);
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/buffer.h"
@@ -82,6 +83,9 @@ class RayletIpcClient : public RayletIpcClientInterface {
 
   Status CancelGetRequest(int64_t request_id) override;
 
+  StatusOr<absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage>>
+  GetCachedObjectLocations(const std::vector<ObjectID> &object_ids) override;
+
   /// Notify the raylet that the worker is currently blocked waiting for an object
   /// to be pulled. The raylet will release the resources used by this worker.
   ///
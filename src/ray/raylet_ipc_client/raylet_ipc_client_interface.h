@@ -20,6 +20,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "ray/common/buffer.h"
 #include "ray/common/id.h"
@@ -28,6 +29,7 @@
 #include "ray/flatbuffers/node_manager_generated.h"
 #include "ray/util/process_interface.h"
 #include "src/ray/protobuf/common.pb.h"
+#include "src/ray/protobuf/pubsub.pb.h"
 
 namespace ray {
 
@@ -173,6 +175,19 @@ class RayletIpcClientInterface {
   /// \return Status.
   virtual Status CancelGetRequest(int64_t request_id) = 0;
 
+  /// Look up object locations cached by the local Raylet's object directory.
+  ///
+  /// The cache is populated by the Raylet's location subscriptions and kept
+  /// up to date by the owners' pubsub notifications. Objects without a fresh
+  /// cached entry are omitted from the result; the caller should fall back
+  /// to asking the owner for those.
+  ///
+  /// \param object_ids The objects to look up.
+  /// \return StatusOr containing error status or the cached location info per
+  /// object that was found in the cache.
+  virtual StatusOr<absl::flat_hash_map<ObjectID, rpc::WorkerObjectLocationsPubMessage>>
+  GetCachedObjectLocations(const std::vector<ObjectID> &object_ids) = 0;
+
   /// Notify the raylet that the worker is currently blocked waiting for an object
   /// to be pulled. The raylet will release the resources used by this worker.
   ///
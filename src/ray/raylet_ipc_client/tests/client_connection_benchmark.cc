@@ -0,0 +1,124 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark for async message write throughput over a ClientConnection
+// pair, comparing one-message-per-write against batched vectored writes.
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
+#include "ray/raylet_ipc_client/client_connection.h"
+#include "ray/util/network_util.h"
+
+namespace ray {
+namespace raylet {
+
+namespace {
+
+constexpr size_t kNumMessages = 20000;
+constexpr size_t kMessageSize = 256;
+
+std::pair<local_stream_socket, local_stream_socket> CreateSocketPair(
+    instrumented_io_context &io_service) {
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS) && !defined(_WIN32)
+  boost::asio::local::stream_protocol::socket in(io_service), out(io_service);
+  boost::asio::local::connect_pair(in, out);
+  return std::make_pair(std::move(in), std::move(out));
+#else
+  local_stream_socket in(io_service);
+  local_stream_socket out(io_service);
+  auto endpoint = ParseUrlEndpoint("tcp://127.0.0.1:65437");
+  boost::asio::basic_socket_acceptor<local_stream_protocol> acceptor(io_service,
+                                                                     endpoint);
+  out.connect(endpoint);
+  acceptor.accept(in);
+  return std::make_pair(std::move(in), std::move(out));
+#endif
+}
+
+// Writes kNumMessages messages of kMessageSize bytes from a client connection
+// to a server connection and returns the observed messages/sec.
+double RunWriteThroughput(int64_t async_write_max_messages) {
+  RayConfig::instance().initialize(
+      "{\"raylet_ipc_async_write_max_messages\": " +
+      std::to_string(async_write_max_messages) + "}");
+
+  instrumented_io_context io_service;
+  auto [in, out] = CreateSocketPair(io_service);
+
+  size_t num_received = 0;
+  MessageHandler server_message_handler =
+      [&num_received](std::shared_ptr<ClientConnection> conn,
+                      int64_t message_type,
+                      const std::vector<uint8_t> &message) {
+        num_received += 1;
+        if (num_received < kNumMessages) {
+          conn->ProcessMessages();
+        }
+      };
+  ConnectionErrorHandler check_no_error = [](std::shared_ptr<ClientConnection> conn,
+                                             const boost::system::error_code &error) {
+    RAY_CHECK(false) << "Unexpected connection error: " << error.message();
+  };
+  MessageHandler noop_message_handler = [](std::shared_ptr<ClientConnection> conn,
+                                           int64_t message_type,
+                                           const std::vector<uint8_t> &message) {};
+
+  auto client = ClientConnection::Create(
+      noop_message_handler, check_no_error, std::move(out), "benchmark-client", {});
+  auto server = ClientConnection::Create(
+      server_message_handler, check_no_error, std::move(in), "benchmark-server", {});
+
+  const std::vector<uint8_t> payload(kMessageSize, 0xab);
+  std::function<void(const ray::Status &)> check_ok = [](const ray::Status &status) {
+    RAY_CHECK_OK(status);
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kNumMessages; i++) {
+    client->WriteMessageAsync(0, payload.size(), payload.data(), check_ok);
+  }
+  server->ProcessMessages();
+  io_service.run();
+  const auto end = std::chrono::steady_clock::now();
+
+  RAY_CHECK(num_received == kNumMessages);
+  const double elapsed_secs =
+      std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+  const double throughput = static_cast<double>(kNumMessages) / elapsed_secs;
+  std::cout << "async_write_max_messages=" << async_write_max_messages << ": "
+            << static_cast<int64_t>(throughput) << " messages/sec" << std::endl;
+  return throughput;
+}
+
+}  // namespace
+
+TEST(ClientConnectionBenchmark, UnbatchedWrites) {
+  EXPECT_GT(RunWriteThroughput(1), 0.0);
+}
+
+TEST(ClientConnectionBenchmark, BatchedWrites) {
+  EXPECT_GT(RunWriteThroughput(32), 0.0);
+}
+
+}  // namespace raylet
+}  // namespace ray
@@ -24,6 +24,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "ray/common/asio/instrumented_io_context.h"
+#include "ray/common/ray_config.h"
 #include "ray/util/network_util.h"
 
 namespace ray {
@@ -368,6 +369,138 @@ TEST_F(ClientConnectionTest, CheckForClientDisconnects) {
 }
 #endif
 
+class BufferedClientConnectionTest : public ClientConnectionTest {
+ public:
+  BufferedClientConnectionTest() {
+    RayConfig::instance().initialize(R"({"raylet_ipc_buffered_reads_enabled": true})");
+  }
+
+  ~BufferedClientConnectionTest() override {
+    RayConfig::instance().initialize(R"({"raylet_ipc_buffered_reads_enabled": false})");
+  }
+};
+
+TEST_F(BufferedClientConnectionTest, CoalescedMessagesDeliveredInOrder) {
+  const uint8_t msg1[5] = {1, 2, 3, 4, 5};
+  const uint8_t msg2[5] = {4, 4, 4, 4, 4};
+  const uint8_t msg3[5] = {8, 8, 8, 8, 8};
+  int server_num_messages = 0;
+
+  // The handler re-arms the connection, so a single io_service run drains all
+  // messages already sitting in the read buffer.
+  MessageHandler server_message_handler = [&msg1, &msg2, &msg3, &server_num_messages](
+                                              std::shared_ptr<ClientConnection> client,
+                                              int64_t message_type,
+                                              const std::vector<uint8_t> &message) {
+    if (server_num_messages == 0) {
+      ASSERT_FALSE(std::memcmp(msg1, message.data(), 5));
+    } else if (server_num_messages == 1) {
+      ASSERT_FALSE(std::memcmp(msg2, message.data(), 5));
+    } else {
+      ASSERT_FALSE(std::memcmp(msg3, message.data(), 5));
+    }
+    server_num_messages += 1;
+    if (server_num_messages < 3) {
+      client->ProcessMessages();
+    }
+  };
+
+  auto [client, server] = CreateConnectionPair(std::nullopt, server_message_handler);
+
+  // All three messages are written before the server reads, so they arrive in
+  // one buffer fill.
+  RAY_CHECK_OK(client->WriteMessage(0, 5, msg1));
+  RAY_CHECK_OK(client->WriteMessage(0, 5, msg2));
+  RAY_CHECK_OK(client->WriteMessage(0, 5, msg3));
+
+  server->ProcessMessages();
+  io_service_.run();
+  ASSERT_EQ(server_num_messages, 3);
+}
+
+TEST_F(BufferedClientConnectionTest, MessageLargerThanReadBuffer) {
+  const size_t message_size =
+      static_cast<size_t>(RayConfig::instance().raylet_ipc_read_buffer_size()) + 1024;
+  std::vector<uint8_t> large_message(message_size);
+  for (size_t i = 0; i < message_size; i++) {
+    large_message[i] = static_cast<uint8_t>(i);
+  }
+  int server_num_messages = 0;
+
+  MessageHandler server_message_handler =
+      [&large_message, &server_num_messages](std::shared_ptr<ClientConnection> client,
+                                             int64_t message_type,
+                                             const std::vector<uint8_t> &message) {
+        ASSERT_EQ(message, large_message);
+        server_num_messages += 1;
+      };
+
+  auto [client, server] = CreateConnectionPair(std::nullopt, server_message_handler);
+
+  server->ProcessMessages();
+  RAY_CHECK_OK(client->WriteMessage(0, large_message.size(), large_message.data()));
+  io_service_.run();
+  ASSERT_EQ(server_num_messages, 1);
+}
+
+TEST_F(BufferedClientConnectionTest, BadCookieClosesConnection) {
+  const uint8_t arr[5] = {1, 2, 3, 4, 5};
+  int server_num_messages = 0;
+
+  MessageHandler server_message_handler = [&server_num_messages](
+                                              std::shared_ptr<ClientConnection> client,
+                                              int64_t message_type,
+                                              const std::vector<uint8_t> &message) {
+    server_num_messages += 1;
+  };
+
+  auto [client, server] = CreateConnectionPair(std::nullopt, server_message_handler);
+
+  int64_t type = 0;
+  int64_t length = 5;
+  int64_t write_cookie = 123456;  // incorrect cookie.
+  std::vector<boost::asio::const_buffer> message_buffers;
+  message_buffers.push_back(boost::asio::buffer(&write_cookie, sizeof(write_cookie)));
+  message_buffers.push_back(boost::asio::buffer(&type, sizeof(type)));
+  message_buffers.push_back(boost::asio::buffer(&length, sizeof(length)));
+  message_buffers.push_back(boost::asio::buffer(arr, length));
+  RAY_CHECK_OK(client->WriteBuffer(message_buffers));
+  server->ProcessMessages();
+  io_service_.run();
+  ASSERT_EQ(server_num_messages, 0);
+}
+
+TEST_F(BufferedClientConnectionTest, SyncReadDrainsBufferedBytes) {
+  const uint8_t arr[5] = {1, 2, 3, 4, 5};
+  int server_num_messages = 0;
+
+  MessageHandler server_message_handler = [&arr, &server_num_messages](
+                                              std::shared_ptr<ClientConnection> client,
+                                              int64_t message_type,
+                                              const std::vector<uint8_t> &message) {
+    ASSERT_FALSE(std::memcmp(arr, message.data(), 5));
+    server_num_messages += 1;
+    // The trailing bytes the client wrote after the message may already have
+    // been drained into the read buffer; a synchronous read must still see
+    // them in order.
+    uint8_t trailer[3];
+    RAY_CHECK_OK(client->ReadBuffer({boost::asio::buffer(trailer, sizeof(trailer))}));
+    ASSERT_EQ(trailer[0], 9);
+    ASSERT_EQ(trailer[1], 10);
+    ASSERT_EQ(trailer[2], 11);
+  };
+
+  auto [client, server] = CreateConnectionPair(std::nullopt, server_message_handler);
+
+  RAY_CHECK_OK(client->WriteMessage(0, 5, arr));
+  const uint8_t trailer[3] = {9, 10, 11};
+  RAY_CHECK_OK(client->WriteBuffer({boost::asio::buffer(trailer, sizeof(trailer))}));
+
+  server->ProcessMessages();
+  io_service_.run();
+  ASSERT_EQ(server_num_messages, 1);
+}
+
 class ServerConnectionTest : public ::testing::Test {
  public:
   ServerConnectionTest() : io_service_() {}
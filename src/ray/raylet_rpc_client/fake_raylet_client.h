@@ -38,6 +38,12 @@ class FakeRayletClient : public RayletClientInterface {
                     const ObjectID &generator_id,
                     const ClientCallback<PinObjectIDsReply> &callback) override {}
 
+  void HintObjectLocation(
+      const ObjectID &object_id,
+      const NodeID &location_node_id,
+      uint64_t object_size,
+      const ClientCallback<HintObjectLocationReply> &callback) override {}
+
   void RequestWorkerLease(const LeaseSpec &lease_spec,
                           bool grant_or_reject,
                           const ClientCallback<RequestWorkerLeaseReply> &callback,
@@ -188,6 +194,11 @@ class FakeRayletClient : public RayletClientInterface {
                                    const Status &status = Status::OK()) {
     PrepareBundleResourcesReply reply;
     reply.set_success(success);
+    return GrantPrepareBundleResources(std::move(reply), status);
+  }
+
+  bool GrantPrepareBundleResources(PrepareBundleResourcesReply reply,
+                                   const Status &status = Status::OK()) {
     if (lease_callbacks.size() == 0) {
       return false;
     } else {
@@ -354,6 +354,23 @@ void RayletClient::PinObjectIDs(
                             /*method_timeout_ms*/ -1);
 }
 
+void RayletClient::HintObjectLocation(
+    const ObjectID &object_id,
+    const NodeID &location_node_id,
+    uint64_t object_size,
+    const rpc::ClientCallback<rpc::HintObjectLocationReply> &callback) {
+  rpc::HintObjectLocationRequest request;
+  request.set_object_id(object_id.Binary());
+  request.set_node_id(location_node_id.Binary());
+  request.set_object_size(object_size);
+  INVOKE_RPC_CALL(NodeManagerService,
+                  HintObjectLocation,
+                  request,
+                  callback,
+                  grpc_client_,
+                  /*method_timeout_ms*/ -1);
+}
+
 void RayletClient::ShutdownRaylet(
     const NodeID &node_id,
     bool graceful,
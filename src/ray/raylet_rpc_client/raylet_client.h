@@ -121,6 +121,13 @@ class RayletClient : public RayletClientInterface {
       const ObjectID &generator_id,
       const ray::rpc::ClientCallback<ray::rpc::PinObjectIDsReply> &callback) override;
 
+  void HintObjectLocation(
+      const ObjectID &object_id,
+      const NodeID &location_node_id,
+      uint64_t object_size,
+      const ray::rpc::ClientCallback<ray::rpc::HintObjectLocationReply> &callback)
+      override;
+
   void ShutdownRaylet(
       const NodeID &node_id,
       bool graceful,
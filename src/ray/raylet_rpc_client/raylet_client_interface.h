@@ -51,6 +51,15 @@ class RayletClientInterface {
       const ObjectID &generator_id,
       const rpc::ClientCallback<ray::rpc::PinObjectIDsReply> &callback) = 0;
 
+  /// Hint to a raylet that an object it may be waiting for is now available on
+  /// the given node, ahead of the owner's object location pubsub. Best effort.
+  /// See RayConfig::eager_object_location_hints_enabled.
+  virtual void HintObjectLocation(
+      const ObjectID &object_id,
+      const NodeID &location_node_id,
+      uint64_t object_size,
+      const rpc::ClientCallback<ray::rpc::HintObjectLocationReply> &callback) = 0;
+
   /// Requests a worker from the raylet. The callback will be sent via gRPC.
   /// \param lease_spec Lease that is requested by the owner.
   /// \param grant_or_reject: True if we we should either grant or reject the request
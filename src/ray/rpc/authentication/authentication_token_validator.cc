@@ -14,8 +14,10 @@
 
 #include "ray/rpc/authentication/authentication_token_validator.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "ray/rpc/authentication/authentication_mode.h"
 #include "ray/rpc/authentication/k8s_util.h"
@@ -31,6 +33,45 @@ AuthenticationTokenValidator &AuthenticationTokenValidator::instance() {
   return instance;
 }
 
+bool AuthenticationTokenValidator::CheckK8sTokenCache(
+    const AuthenticationToken &provided_token) const {
+  auto snapshot = std::atomic_load_explicit(&k8s_token_cache_, std::memory_order_acquire);
+  if (snapshot == nullptr) {
+    return false;
+  }
+  auto it = snapshot->find(provided_token.ToHash());
+  if (it == snapshot->end() ||
+      std::chrono::steady_clock::now() >= it->second.expiration) {
+    return false;
+  }
+  // Confirm the hit with a constant-time comparison so a hash collision can
+  // never admit a different token.
+  return it->second.token.Equals(provided_token);
+}
+
+void AuthenticationTokenValidator::AddToK8sTokenCache(
+    const AuthenticationToken &provided_token) {
+  std::lock_guard<std::mutex> lock(k8s_token_cache_write_mutex_);
+  auto old_snapshot =
+      std::atomic_load_explicit(&k8s_token_cache_, std::memory_order_acquire);
+  auto new_snapshot = std::make_shared<K8sTokenCache>();
+  const auto now = std::chrono::steady_clock::now();
+  if (old_snapshot != nullptr) {
+    // Rebuilding the snapshot is the batch revocation pass: entries past
+    // their TTL are dropped here, off the RPC dispatch path.
+    for (const auto &[hash, entry] : *old_snapshot) {
+      if (now < entry.expiration) {
+        new_snapshot->emplace(hash, entry);
+      }
+    }
+  }
+  (*new_snapshot)[provided_token.ToHash()] = {provided_token, now + kCacheTTL};
+  std::atomic_store_explicit(
+      &k8s_token_cache_,
+      std::shared_ptr<const K8sTokenCache>(std::move(new_snapshot)),
+      std::memory_order_release);
+}
+
 bool AuthenticationTokenValidator::ValidateToken(
     const std::shared_ptr<const AuthenticationToken> &expected_token,
     std::string_view provided_metadata) {
@@ -56,19 +97,10 @@ bool AuthenticationTokenValidator::ValidateToken(
       return false;
     }
 
-    // Check cache first.
-    {
-      std::lock_guard<std::mutex> lock(k8s_token_cache_mutex_);
-      auto it = k8s_token_cache_.find(provided_token);
-      if (it != k8s_token_cache_.end()) {
-        if (std::chrono::steady_clock::now() < it->second.expiration) {
-          RAY_LOG(DEBUG) << "K8s token found in cache and is valid.";
-          return it->second.allowed;
-        } else {
-          RAY_LOG(DEBUG) << "K8s token in cache expired, removing from cache.";
-          k8s_token_cache_.erase(it);
-        }
-      }
+    // Check the cache snapshot first; hits take no lock.
+    if (CheckK8sTokenCache(provided_token)) {
+      RAY_LOG(DEBUG) << "K8s token found in cache and is valid.";
+      return true;
     }
 
     bool is_allowed = false;
@@ -80,9 +112,7 @@ bool AuthenticationTokenValidator::ValidateToken(
     // TODO(andrewsykim): cache invalid tokens once k8s::ValidateToken can distinguish
     // between invalid token errors and server errors.
     if (is_allowed) {
-      std::lock_guard<std::mutex> lock(k8s_token_cache_mutex_);
-      k8s_token_cache_[provided_token] = {is_allowed,
-                                          std::chrono::steady_clock::now() + kCacheTTL};
+      AddToK8sTokenCache(provided_token);
       RAY_LOG(DEBUG) << "K8s token validated and saved to cache.";
     }
 
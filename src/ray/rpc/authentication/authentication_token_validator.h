@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <unordered_map>
 
@@ -36,14 +39,31 @@ class AuthenticationTokenValidator {
                      std::string_view provided_metadata);
 
  private:
-  // Cache for K8s tokens.
+  // Cache entry for a K8s token that the API server has validated. The full
+  // token is kept so a cache hit can be confirmed with a constant-time
+  // comparison rather than trusting the hash key alone.
   struct K8sCacheEntry {
-    bool allowed;
+    AuthenticationToken token;
     std::chrono::steady_clock::time_point expiration;
   };
-  std::mutex k8s_token_cache_mutex_;
-  std::unordered_map<AuthenticationToken, K8sCacheEntry, AuthenticationTokenHash>
-      k8s_token_cache_;
+  // Validated tokens keyed by token hash.
+  using K8sTokenCache = std::unordered_map<std::size_t, K8sCacheEntry>;
+
+  /// Look up the provided token in the current cache snapshot. Lock-free; a
+  /// hit means the token was validated and its entry has not expired.
+  bool CheckK8sTokenCache(const AuthenticationToken &provided_token) const;
+
+  /// Add a freshly validated token to the cache by rebuilding the snapshot,
+  /// pruning all expired entries in the same pass.
+  void AddToK8sTokenCache(const AuthenticationToken &provided_token);
+
+  /// Immutable snapshot of validated K8s tokens. The RPC dispatch path reads
+  /// it with an atomic load, so cache hits cost a hash lookup plus one
+  /// constant-time compare and take no lock. Writers rebuild the map under
+  /// k8s_token_cache_write_mutex_ and swap the new snapshot in; expired
+  /// entries are revoked in batch during the rebuild instead of on reads.
+  std::shared_ptr<const K8sTokenCache> k8s_token_cache_;
+  std::mutex k8s_token_cache_write_mutex_;
 };
 
 }  // namespace rpc
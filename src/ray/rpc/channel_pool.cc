@@ -0,0 +1,83 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/rpc/channel_pool.h"
+
+#include <memory>
+#include <string>
+
+#include "ray/common/ray_config.h"
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace rpc {
+
+ChannelPool &ChannelPool::Instance() {
+  static auto *instance = new ChannelPool();
+  return *instance;
+}
+
+std::shared_ptr<grpc::Channel> ChannelPool::GetOrCreateChannel(
+    const std::string &endpoint,
+    const std::function<std::shared_ptr<grpc::Channel>()> &factory) {
+  absl::MutexLock lock(&mu_);
+  auto it = channels_.find(endpoint);
+  if (it != channels_.end()) {
+    return it->second;
+  }
+  const int64_t max_channels =
+      RayConfig::instance().grpc_client_channel_pool_max_channels();
+  if (max_channels > 0 && static_cast<int64_t>(channels_.size()) >= max_channels) {
+    ReapIdleChannelsLocked();
+  }
+  auto channel = factory();
+  if (max_channels > 0 && static_cast<int64_t>(channels_.size()) >= max_channels) {
+    // All cached channels are in use; hand out an unpooled channel rather
+    // than growing beyond the limit.
+    RAY_LOG_EVERY_MS(WARNING, 60 * 1000)
+        << "gRPC channel pool is full (" << channels_.size()
+        << " channels), creating an unpooled channel for " << endpoint;
+    return channel;
+  }
+  channels_[endpoint] = channel;
+  return channel;
+}
+
+void ChannelPool::ReapIdleChannels() {
+  absl::MutexLock lock(&mu_);
+  ReapIdleChannelsLocked();
+}
+
+size_t ChannelPool::Size() const {
+  absl::MutexLock lock(&mu_);
+  return channels_.size();
+}
+
+void ChannelPool::ReapIdleChannelsLocked() {
+  for (auto it = channels_.begin(); it != channels_.end();) {
+    // The pool holds the only reference once every client to the endpoint is
+    // gone, and gRPC moves the channel back to IDLE after
+    // GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS without activity (a never-used channel
+    // starts out IDLE).
+    if (it->second.use_count() == 1 &&
+        it->second->GetState(/*try_to_connect=*/false) == GRPC_CHANNEL_IDLE) {
+      channels_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace rpc
+}  // namespace ray
@@ -0,0 +1,83 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/grpcpp.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace ray {
+namespace rpc {
+
+/// A cache of gRPC channels keyed by endpoint, so that all clients talking to
+/// the same server share one channel (and thus one HTTP/2 connection that
+/// multiplexes their streams) instead of each holding their own. This bounds
+/// file descriptor usage when one process talks to many servers and
+/// repeatedly reconnects to the same ones.
+///
+/// Cached channels are dropped by `ReapIdleChannels` once no client
+/// references them and gRPC has moved the connection back to IDLE, so a
+/// disconnected endpoint does not pin its channel forever. When the cache
+/// holds `grpc_client_channel_pool_max_channels` channels that are all in
+/// use, additional endpoints get unpooled channels.
+///
+/// All methods are thread-safe.
+class ChannelPool {
+ public:
+  /// The process-wide pool.
+  static ChannelPool &Instance();
+
+  ChannelPool() = default;
+  ChannelPool(const ChannelPool &) = delete;
+  ChannelPool &operator=(const ChannelPool &) = delete;
+
+  /// Return the cached channel for `endpoint`, or create one with `factory`
+  /// and cache it. If the cache is full even after reaping idle channels, the
+  /// newly created channel is returned uncached.
+  ///
+  /// \param endpoint A string identifying the server, e.g. "10.0.0.1:10002"
+  /// or "unix:/tmp/sock". Channels are only shared between clients that
+  /// derive the same endpoint string and channel arguments.
+  /// \param factory Creates the channel on a cache miss.
+  std::shared_ptr<grpc::Channel> GetOrCreateChannel(
+      const std::string &endpoint,
+      const std::function<std::shared_ptr<grpc::Channel>()> &factory);
+
+  /// Drop cached channels that no client references and whose connection has
+  /// gone back to IDLE. Called opportunistically, e.g. from
+  /// `RetryableGrpcClient`'s periodic channel status check.
+  void ReapIdleChannels();
+
+  /// The number of cached channels.
+  size_t Size() const;
+
+ private:
+  void ReapIdleChannelsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  mutable absl::Mutex mu_;
+
+  /// The cached channels by endpoint.
+  absl::flat_hash_map<std::string, std::shared_ptr<grpc::Channel>> channels_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace rpc
+}  // namespace ray
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <grpcpp/generic/generic_stub.h>
 #include <grpcpp/grpcpp.h>
 
+#include <algorithm>
 #include <atomic>
 #include <boost/asio.hpp>
 #include <chrono>
@@ -30,6 +32,7 @@
 #include "ray/common/constants.h"
 #include "ray/common/grpc_util.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/rpc/metrics.h"
 #include "ray/rpc/rpc_callback_types.h"
@@ -210,20 +213,25 @@ class ClientCallManager {
   /// \param cluster_id UUID of the destination cluster
   /// \param num_threads The number of threads used for polling for completion events
   /// \param call_timeout_ms Set's the default call timeout for requests on this client
+  /// \param inline_reply_delivery Run reply callbacks directly on the polling
+  /// threads instead of posting them to `main_service`. Only safe when every
+  /// callback issued through this manager is thread-safe and non-blocking.
   ///
   explicit ClientCallManager(instrumented_io_context &main_service,
                              bool record_stats,
                              std::string local_address,
                              const ClusterID &cluster_id = ClusterID::Nil(),
                              int num_threads = 1,
-                             int64_t call_timeout_ms = -1)
+                             int64_t call_timeout_ms = -1,
+                             bool inline_reply_delivery = false)
       : cluster_id_(cluster_id),
         main_service_(main_service),
         num_threads_(num_threads),
         record_stats_(record_stats),
         local_address_(std::move(local_address)),
         shutdown_(false),
-        call_timeout_ms_(call_timeout_ms) {
+        call_timeout_ms_(call_timeout_ms),
+        inline_reply_delivery_(inline_reply_delivery) {
     // Start the polling threads.
     cqs_.reserve(num_threads_);
     for (int i = 0; i < num_threads_; i++) {
@@ -296,6 +304,52 @@ class ClientCallManager {
     return call;
   }
 
+  /// Create a new `ClientCall` for a method not covered by the gRPC-generated
+  /// stub and send the request. Used for request types with a custom
+  /// `grpc::SerializationTraits` specialization, e.g. zero-copy payloads; the
+  /// reply is a regular protobuf message.
+  ///
+  /// \tparam Request Type of the request message.
+  /// \tparam Reply Type of the reply message.
+  ///
+  /// \param[in] channel The gRPC channel of the destination server.
+  /// \param[in] method_name The full gRPC method name, e.g.
+  /// "/ray.rpc.FooService/Bar".
+  /// \param[in] request The request message.
+  /// \param[in] callback The callback function that handles reply.
+  /// \param[in] call_name The name of the gRPC method call.
+  /// \param[in] method_timeout_ms The timeout of the RPC method in ms.
+  /// -1 means it will use the default timeout configured for the handler.
+  ///
+  /// \return A `ClientCall` representing the request that was just sent.
+  template <class Request, class Reply>
+  std::shared_ptr<ClientCall> CreateGenericCall(
+      std::shared_ptr<grpc::Channel> channel,
+      const std::string &method_name,
+      const Request &request,
+      const ClientCallback<Reply> &callback,
+      std::string call_name,
+      int64_t method_timeout_ms = -1) {
+    auto stats_handle = main_service_.stats()->RecordStart(std::move(call_name));
+    if (method_timeout_ms == -1) {
+      method_timeout_ms = call_timeout_ms_;
+    }
+
+    auto call = std::make_shared<ClientCallImpl<Reply>>(
+        callback, cluster_id_, std::move(stats_handle), record_stats_, method_timeout_ms);
+    // The stub is a thin wrapper around the channel, so creating one per call
+    // is cheap.
+    grpc::TemplatedGenericStub<Request, Reply> stub(std::move(channel));
+    call->response_reader_ = stub.PrepareUnaryCall(
+        &call->context_, method_name, request, cqs_[rr_index_++ % num_threads_].get());
+    call->response_reader_->StartCall();
+    // See the lifetime note on the tag in `CreateCall` above.
+    auto tag = new ClientCallTag(call);
+    call->response_reader_->Finish(
+        &call->reply_, &call->status_, static_cast<void *>(tag));
+    return call;
+  }
+
   /// Get the cluster ID.
   const ClusterID &GetClusterId() const { return cluster_id_; }
   void SetClusterId(const ClusterID &cluster_id) { cluster_id_ = cluster_id; }
@@ -311,8 +365,11 @@ class ClientCallManager {
   /// objects.
   void PollEventsFromCompletionQueue(int index) {
     SetThreadName("client.poll" + std::to_string(index));
+    const int64_t batch_size =
+        std::max<int64_t>(1, RayConfig::instance().grpc_client_reply_batch_size());
     void *got_tag = nullptr;
     bool ok = false;
+    std::vector<ClientCallTag *> ready_tags;
     // Keep reading events from the `CompletionQueue` until it's shutdown.
     // NOTE(edoakes): we use AsyncNext here because for some unknown reason,
     // synchronous cq_.Next blocks indefinitely in the case that the process
@@ -331,32 +388,92 @@ class ClientCallManager {
       } else if (status != grpc::CompletionQueue::TIMEOUT) {
         // NOTE: CompletionQueue::TIMEOUT and gRPC deadline exceeded are different.
         // If the client deadline is exceeded, event is obtained at this block.
-        auto tag = static_cast<ClientCallTag *>(got_tag);
-        // Refresh the tag.
+        ready_tags.clear();
+        ProcessCompletionQueueEvent(got_tag, ok, ready_tags);
         got_tag = nullptr;
-        tag->GetCall()->SetReturnStatus();
-        std::shared_ptr<StatsHandle> stats_handle = tag->GetCall()->GetStatsHandle();
-        RAY_CHECK_NE(stats_handle, nullptr);
-        if (ok && !main_service_.stopped() && !shutdown_) {
-          // Post the callback to the main event loop.
-          main_service_.post(
-              [tag]() {
-                tag->GetCall()->OnReplyReceived();
-                // The call is finished, and we can delete this tag now.
-                delete tag;
-              },
-              stats_handle->event_name + ".OnReplyReceived",
-              // Implement the delay of the rpc client call as the
-              // delay of OnReplyReceived().
-              ray::asio::testing::GetDelayUs(stats_handle->event_name));
-          main_service_.stats()->RecordEnd(std::move(stats_handle));
-        } else {
-          delete tag;
+        if (batch_size > 1) {
+          // Drain replies that are already ready without blocking, so their
+          // callbacks can be coalesced into a single io_context post.
+          while (static_cast<int64_t>(ready_tags.size()) < batch_size &&
+                 cqs_[index]->AsyncNext(&got_tag, &ok, gpr_now(GPR_CLOCK_REALTIME)) ==
+                     grpc::CompletionQueue::GOT_EVENT) {
+            ProcessCompletionQueueEvent(got_tag, ok, ready_tags);
+            got_tag = nullptr;
+          }
         }
+        DeliverReadyReplies(ready_tags);
       }
     }
   }
 
+  /// Handle one completion queue event: resolve the call's return status and
+  /// either run its callback inline, append it to `ready_tags` for delivery,
+  /// or drop it if the call can no longer be delivered.
+  void ProcessCompletionQueueEvent(void *got_tag,
+                                   bool ok,
+                                   std::vector<ClientCallTag *> &ready_tags) {
+    auto tag = static_cast<ClientCallTag *>(got_tag);
+    tag->GetCall()->SetReturnStatus();
+    std::shared_ptr<StatsHandle> stats_handle = tag->GetCall()->GetStatsHandle();
+    RAY_CHECK_NE(stats_handle, nullptr);
+    if (!ok || main_service_.stopped() || shutdown_) {
+      delete tag;
+      return;
+    }
+    if (inline_reply_delivery_) {
+      // The owner has declared its callbacks thread-safe; run the callback on
+      // the polling thread and skip the event loop round trip entirely.
+      tag->GetCall()->OnReplyReceived();
+      delete tag;
+      main_service_.stats()->RecordEnd(std::move(stats_handle));
+      return;
+    }
+    ready_tags.push_back(tag);
+  }
+
+  /// Post the callbacks of the drained calls to the main event loop,
+  /// coalescing them into a single post. Callbacks run in arrival order.
+  void DeliverReadyReplies(std::vector<ClientCallTag *> &ready_tags) {
+    if (ready_tags.empty()) {
+      return;
+    }
+    if (ready_tags.size() == 1) {
+      auto tag = ready_tags.front();
+      std::shared_ptr<StatsHandle> stats_handle = tag->GetCall()->GetStatsHandle();
+      // Post the callback to the main event loop.
+      main_service_.post(
+          [tag]() {
+            tag->GetCall()->OnReplyReceived();
+            // The call is finished, and we can delete this tag now.
+            delete tag;
+          },
+          stats_handle->event_name + ".OnReplyReceived",
+          // Implement the delay of the rpc client call as the
+          // delay of OnReplyReceived().
+          ray::asio::testing::GetDelayUs(stats_handle->event_name));
+      main_service_.stats()->RecordEnd(std::move(stats_handle));
+      return;
+    }
+    // Per-call chaos delays don't compose across a batch; apply the first
+    // call's delay to the whole post. Record the queueing stats before the
+    // tags move into the posted closure.
+    const int64_t delay_us = ray::asio::testing::GetDelayUs(
+        ready_tags.front()->GetCall()->GetStatsHandle()->event_name);
+    for (auto *tag : ready_tags) {
+      main_service_.stats()->RecordEnd(tag->GetCall()->GetStatsHandle());
+    }
+    main_service_.post(
+        [tags = std::move(ready_tags)]() {
+          for (auto *tag : tags) {
+            tag->GetCall()->OnReplyReceived();
+            delete tag;
+          }
+        },
+        "ClientCallManager.OnReplyReceivedBatch",
+        delay_us);
+    ready_tags.clear();
+  }
+
   /// UUID of the cluster. Potential race between creating a ClientCall object
   /// and setting the cluster ID.
   ClusterID cluster_id_;
@@ -388,6 +505,10 @@ class ClientCallManager {
 
   // Timeout in ms for calls created.
   int64_t call_timeout_ms_;
+
+  /// Whether reply callbacks run directly on the polling threads instead of
+  /// being posted to the main event loop.
+  const bool inline_reply_delivery_;
 };
 
 }  // namespace rpc
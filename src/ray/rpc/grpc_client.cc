@@ -23,9 +23,10 @@
 namespace ray {
 namespace rpc {
 
-std::shared_ptr<grpc::Channel> BuildChannel(
-    const std::string &address,
-    int port,
+namespace {
+
+/// Fill in the default channel arguments shared by all Ray gRPC channels.
+grpc::ChannelArguments DefaultedChannelArguments(
     std::optional<grpc::ChannelArguments> arguments) {
   // Set up channel arguments with default values if not provided
   if (!arguments.has_value()) {
@@ -38,6 +39,33 @@ std::shared_ptr<grpc::Channel> BuildChannel(
   arguments->SetMaxReceiveMessageSize(::RayConfig::instance().max_grpc_message_size());
   arguments->SetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE,
                     ::RayConfig::instance().grpc_stream_buffer_size());
+  return *std::move(arguments);
+}
+
+/// Create a channel to the given target, with the token auth interceptor
+/// attached when token authentication is enabled.
+std::shared_ptr<grpc::Channel> CreateChannelToTarget(
+    const std::string &target_address,
+    const std::shared_ptr<grpc::ChannelCredentials> &channel_creds,
+    const grpc::ChannelArguments &arguments) {
+  if (GetAuthenticationMode() == AuthenticationMode::TOKEN) {
+    // Create channel with auth interceptor
+    return grpc::experimental::CreateCustomChannelWithInterceptors(
+        target_address, channel_creds, arguments, CreateTokenAuthInterceptorFactories());
+  } else {
+    // Create channel without interceptors
+    return grpc::CreateCustomChannel(target_address, channel_creds, arguments);
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<grpc::Channel> BuildChannel(
+    const std::string &address,
+    int port,
+    std::optional<grpc::ChannelArguments> arguments) {
+  grpc::ChannelArguments channel_arguments =
+      DefaultedChannelArguments(std::move(arguments));
 
   // Step 1: Get transport credentials (TLS or insecure)
   std::shared_ptr<grpc::ChannelCredentials> channel_creds;
@@ -62,14 +90,15 @@ std::shared_ptr<grpc::Channel> BuildChannel(
   // Step 2: Create channel with interceptors if token auth is enabled
   std::string target_address = BuildAddress(address, port);
 
-  if (GetAuthenticationMode() == AuthenticationMode::TOKEN) {
-    // Create channel with auth interceptor
-    return grpc::experimental::CreateCustomChannelWithInterceptors(
-        target_address, channel_creds, *arguments, CreateTokenAuthInterceptorFactories());
-  } else {
-    // Create channel without interceptors
-    return grpc::CreateCustomChannel(target_address, channel_creds, *arguments);
-  }
+  return CreateChannelToTarget(target_address, channel_creds, channel_arguments);
+}
+
+std::shared_ptr<grpc::Channel> BuildUnixSocketChannel(
+    const std::string &socket_path, std::optional<grpc::ChannelArguments> arguments) {
+  grpc::ChannelArguments channel_arguments =
+      DefaultedChannelArguments(std::move(arguments));
+  return CreateChannelToTarget(
+      "unix://" + socket_path, grpc::InsecureChannelCredentials(), channel_arguments);
 }
 
 }  // namespace rpc
@@ -72,6 +72,20 @@ std::shared_ptr<grpc::Channel> BuildChannel(
     int port,
     std::optional<grpc::ChannelArguments> arguments = std::nullopt);
 
+/// Build a gRPC channel over a Unix domain socket.
+///
+/// Used for same-node connections where the server also listens on a local
+/// socket (see GrpcServer::SetUnixSocketPath). The channel uses insecure
+/// credentials since the socket is protected by filesystem permissions;
+/// authentication tokens are still added when RAY_AUTH_MODE=token.
+///
+/// \param socket_path Filesystem path of the server's Unix domain socket
+/// \param arguments Optional channel arguments for customization
+/// \return A shared pointer to the gRPC channel
+std::shared_ptr<grpc::Channel> BuildUnixSocketChannel(
+    const std::string &socket_path,
+    std::optional<grpc::ChannelArguments> arguments = std::nullopt);
+
 template <class GrpcService>
 class GrpcClient {
  public:
@@ -178,6 +192,88 @@ class GrpcClient {
     call_method_invoked_.store(true);
   }
 
+  /// Create a new `ClientCall` for a request type with a custom
+  /// `grpc::SerializationTraits` specialization (e.g. a zero-copy payload)
+  /// and send the request. The wire format must be what the server-side
+  /// method expects; the reply is a regular protobuf message.
+  ///
+  /// \tparam Request Type of the request message.
+  /// \tparam Reply Type of the reply message.
+  ///
+  /// \param[in] method_name The full gRPC method name, e.g.
+  /// "/ray.rpc.FooService/Bar".
+  /// \param[in] request The request message.
+  /// \param[in] callback The callback function that handles reply.
+  /// \param[in] call_name The name of the gRPC method call.
+  /// \param[in] method_timeout_ms The timeout of the RPC method in ms.
+  /// -1 means it will use the default timeout configured for the handler.
+  template <class Request, class Reply>
+  void CallGenericMethod(const std::string &method_name,
+                         const Request &request,
+                         const ClientCallback<Reply> &callback,
+                         std::string call_name = "UNKNOWN_RPC",
+                         int64_t method_timeout_ms = -1) {
+    testing::RpcFailure failure = skip_testing_intra_node_rpc_failure_
+                                      ? testing::RpcFailure::None
+                                      : testing::GetRpcFailure(call_name);
+    if (failure == testing::RpcFailure::Request) {
+      // Simulate the case where the RPC fails before server receives
+      // the request.
+      RAY_LOG(INFO) << "Inject RPC request failure for " << call_name;
+      client_call_manager_.GetMainService().post(
+          [callback]() {
+            callback(Status::RpcError("Unavailable", grpc::StatusCode::UNAVAILABLE),
+                     Reply());
+          },
+          "RpcChaos");
+    } else if (failure == testing::RpcFailure::Response) {
+      // Simulate the case where the RPC fails after server sends
+      // the response.
+      RAY_LOG(INFO) << "Inject RPC response failure for " << call_name;
+      client_call_manager_.CreateGenericCall<Request, Reply>(
+          channel_,
+          method_name,
+          request,
+          [callback](const Status &status, const Reply &) {
+            callback(Status::RpcError("Unavailable", grpc::StatusCode::UNAVAILABLE),
+                     Reply());
+          },
+          std::move(call_name),
+          method_timeout_ms);
+    } else if (failure == testing::RpcFailure::InFlight) {
+      // Simulate the case where the RPC fails after sending the request to the server but
+      // before the reply is sent back.
+      RAY_LOG(INFO) << "Inject RPC response failure while request in flight for "
+                    << call_name;
+      client_call_manager_.CreateGenericCall<Request, Reply>(
+          channel_,
+          method_name,
+          request,
+          [](const Status &, const Reply &) {
+            // The actual reply is dropped.
+          },
+          std::move(call_name),
+          method_timeout_ms);
+      client_call_manager_.GetMainService().post(
+          [callback]() {
+            callback(Status::RpcError("Unavailable", grpc::StatusCode::UNAVAILABLE),
+                     Reply());
+          },
+          "RpcChaos");
+    } else {
+      auto call = client_call_manager_.CreateGenericCall<Request, Reply>(
+          channel_,
+          method_name,
+          request,
+          callback,
+          std::move(call_name),
+          method_timeout_ms);
+      RAY_CHECK(call != nullptr);
+    }
+
+    call_method_invoked_.store(true);
+  }
+
   std::shared_ptr<grpc::Channel> Channel() const { return channel_; }
 
   /// A channel is IDLE when it's first created before making any RPCs
@@ -20,10 +20,15 @@
 
 #include <algorithm>
 #include <boost/asio/detail/socket_holder.hpp>
+#include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
 #include "ray/common/ray_config.h"
 #include "ray/common/status.h"
 #include "ray/rpc/authentication/authentication_token_loader.h"
@@ -31,9 +36,54 @@
 #include "ray/util/network_util.h"
 #include "ray/util/thread_utils.h"
 
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
 namespace ray {
 namespace rpc {
 
+namespace {
+
+/// Number of consecutive 250ms poll timeouts after which a dynamic poller
+/// parks itself again.
+constexpr int kDynamicPollerIdlePolls = 4;
+
+/// Pin the calling polling thread to the CPU set named by the
+/// `grpc_server_poller_cpu_list` config. No-op when the list is empty; only
+/// supported on Linux.
+void MaybePinPollerThread() {
+  const std::string &cpu_list = RayConfig::instance().grpc_server_poller_cpu_list();
+  if (cpu_list.empty()) {
+    return;
+  }
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  bool has_valid_cpu = false;
+  for (const auto &cpu_str : absl::StrSplit(cpu_list, ',', absl::SkipWhitespace())) {
+    int cpu_id = -1;
+    if (absl::SimpleAtoi(cpu_str, &cpu_id) && cpu_id >= 0 && cpu_id < CPU_SETSIZE) {
+      CPU_SET(cpu_id, &cpu_set);
+      has_valid_cpu = true;
+    } else {
+      RAY_LOG(WARNING) << "Ignoring invalid cpu id \"" << cpu_str
+                       << "\" in grpc_server_poller_cpu_list.";
+    }
+  }
+  if (!has_valid_cpu) {
+    return;
+  }
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    RAY_LOG(WARNING) << "Failed to pin gRPC polling thread to cpus " << cpu_list;
+  }
+#else
+  RAY_LOG(WARNING) << "grpc_server_poller_cpu_list is only supported on Linux.";
+#endif
+}
+
+}  // namespace
+
 void GrpcServer::Init() {
   RAY_CHECK(num_threads_ > 0) << "Num of threads in gRPC must be greater than 0";
   cqs_.resize(num_threads_);
@@ -53,12 +103,25 @@ void GrpcServer::Shutdown() {
     for (const auto &cq : cqs_) {
       cq->Shutdown();
     }
+    // Release the parked dynamic pollers so they can observe the queue
+    // shutdown and exit.
+    for (const auto &state : dynamic_poller_states_) {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->shutdown = true;
+      }
+      state->cv.notify_all();
+    }
     for (auto &polling_thread : polling_threads_) {
       polling_thread.join();
     }
     is_shutdown_ = true;
     RAY_LOG(DEBUG) << "gRPC server of " << name_ << " shutdown.";
     server_.reset();
+    if (!unix_socket_path_.empty()) {
+      std::error_code ec;
+      std::filesystem::remove(unix_socket_path_, ec);
+    }
   }
 }
 
@@ -112,6 +175,14 @@ void GrpcServer::Run() {
   } else {
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials(), &port_);
   }
+  if (!unix_socket_path_.empty() && !RayConfig::instance().USE_TLS()) {
+    // A stale socket file left behind by a previous process would fail the
+    // bind below.
+    std::error_code ec;
+    std::filesystem::remove(unix_socket_path_, ec);
+    builder.AddListeningPort("unix://" + unix_socket_path_,
+                             grpc::InsecureServerCredentials());
+  }
   // Register all the services to this server.
   if (grpc_services_.empty() && services_.empty()) {
     RAY_LOG(WARNING) << "No service is found when start grpc server " << name_;
@@ -166,10 +237,27 @@ void GrpcServer::Run() {
       entry->CreateCall();
     }
   }
+  // The wake states must exist before any polling thread starts, since busy
+  // pollers check them to decide whether scaling is enabled.
+  const int64_t dynamic_pollers_per_cq =
+      RayConfig::instance().grpc_server_dynamic_pollers_per_cq();
+  if (dynamic_pollers_per_cq > 0) {
+    dynamic_poller_states_.reserve(num_threads_);
+    for (int i = 0; i < num_threads_; i++) {
+      dynamic_poller_states_.push_back(std::make_unique<DynamicPollerState>());
+    }
+  }
   // Start threads that polls incoming requests.
   for (int i = 0; i < num_threads_; i++) {
     polling_threads_.emplace_back(&GrpcServer::PollEventsFromCompletionQueue, this, i);
   }
+  // Start the extra pollers parked; busy pollers wake them when their queue
+  // falls behind, see `PollOnce`.
+  for (int i = 0; i < num_threads_; i++) {
+    for (int64_t j = 0; j < dynamic_pollers_per_cq; j++) {
+      polling_threads_.emplace_back(&GrpcServer::DynamicPollerMain, this, i);
+    }
+  }
   // Set the server as running.
   is_shutdown_ = false;
 }
@@ -191,69 +279,199 @@ void GrpcServer::RegisterService(std::unique_ptr<GrpcService> &&service,
 
 void GrpcServer::PollEventsFromCompletionQueue(int index) {
   SetThreadName("server.poll" + std::to_string(index));
+  MaybePinPollerThread();
+  int64_t batch_size =
+      std::max<int64_t>(1, RayConfig::instance().grpc_server_request_batch_size());
+  if (!dynamic_poller_states_.empty()) {
+    // Scaling needs a drain cap of at least 2 to tell a backlogged queue
+    // apart from a trickle of single events.
+    batch_size = std::max<int64_t>(batch_size, 2);
+  }
+  const std::string cq_label = std::to_string(index);
+  std::vector<ServerCall *> ready_calls;
+
+  // Keep reading events from the `CompletionQueue` until it's shutdown.
+  while (PollOnce(index, batch_size, cq_label, ready_calls) !=
+         grpc::CompletionQueue::SHUTDOWN) {
+  }
+}
+
+grpc::CompletionQueue::NextStatus GrpcServer::PollOnce(
+    int index,
+    int64_t batch_size,
+    const std::string &cq_label,
+    std::vector<ServerCall *> &ready_calls) {
   void *tag;
   bool ok;
+  auto deadline = gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
+                               gpr_time_from_millis(250, GPR_TIMESPAN));
+  const auto status = cqs_[index]->AsyncNext(&tag, &ok, deadline);
+  if (status != grpc::CompletionQueue::GOT_EVENT) {
+    return status;
+  }
+  ready_calls.clear();
+  ProcessCompletionQueueEvent(tag, ok, ready_calls);
+  int64_t num_drained = 1;
+  if (batch_size > 1) {
+    // Drain events that are already ready without blocking, so that their
+    // handlers can be coalesced into fewer io_context posts.
+    while (num_drained < batch_size &&
+           cqs_[index]->AsyncNext(&tag, &ok, gpr_now(GPR_CLOCK_REALTIME)) ==
+               grpc::CompletionQueue::GOT_EVENT) {
+      ProcessCompletionQueueEvent(tag, ok, ready_calls);
+      num_drained++;
+    }
+  }
+  grpc_server_cq_depth_gauge_.Record(static_cast<double>(num_drained),
+                                     {{"Name", name_}, {"CQ", cq_label}});
+  if (!dynamic_poller_states_.empty() && num_drained == batch_size) {
+    // The drain cap was hit, so the queue is likely deeper than one wakeup
+    // can absorb. Enlist a parked poller; it parks itself again once the
+    // queue stays idle.
+    WakeDynamicPoller(index);
+  }
+  DispatchReadyCalls(ready_calls);
+  return status;
+}
 
-  // Keep reading events from the `CompletionQueue` until it's shutdown.
+void GrpcServer::DynamicPollerMain(int index) {
+  SetThreadName("server.poll.dyn" + std::to_string(index));
+  MaybePinPollerThread();
+  const int64_t batch_size =
+      std::max<int64_t>(2, RayConfig::instance().grpc_server_request_batch_size());
+  const std::string cq_label = std::to_string(index);
+  std::vector<ServerCall *> ready_calls;
+  auto &state = *dynamic_poller_states_[index];
   while (true) {
-    auto deadline = gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
-                                 gpr_time_from_millis(250, GPR_TIMESPAN));
-    auto status = cqs_[index]->AsyncNext(&tag, &ok, deadline);
-    if (status == grpc::CompletionQueue::SHUTDOWN) {
-      // If the completion queue status is SHUTDOWN, meaning the queue has been
-      // drained. We can now exit the loop.
-      break;
-    } else if (status == grpc::CompletionQueue::TIMEOUT) {
-      continue;
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.cv.wait(lock,
+                    [&state] { return state.shutdown || state.wake_requests > 0; });
+      if (state.shutdown) {
+        return;
+      }
+      state.wake_requests -= 1;
     }
-    auto *server_call = static_cast<ServerCall *>(tag);
-    bool delete_call = false;
-    // A new call is needed after the server sends a reply, no matter the reply is
-    // successful or failed.
-    bool need_new_call = false;
-    if (ok) {
-      switch (server_call->GetState()) {
-      case ServerCallState::PENDING:
-        // We've received a new incoming request. Now this call object is used to
-        // track this request.
-        server_call->HandleRequest();
-        break;
-      case ServerCallState::SENDING_REPLY:
-        // GRPC has sent reply successfully, invoking the callback.
-        server_call->OnReplySent();
-        // The rpc call has finished and can be deleted now.
-        delete_call = true;
-        // A new call should be suplied.
-        need_new_call = true;
-        break;
-      default:
-        RAY_LOG(FATAL) << "Shouldn't reach here.";
-        break;
+    // Help drain the queue until it stays idle, then park again.
+    int idle_polls = 0;
+    while (idle_polls < kDynamicPollerIdlePolls) {
+      const auto status = PollOnce(index, batch_size, cq_label, ready_calls);
+      if (status == grpc::CompletionQueue::SHUTDOWN) {
+        return;
       }
-    } else {
-      // `ok == false` will occur in two situations:
+      idle_polls = status == grpc::CompletionQueue::TIMEOUT ? idle_polls + 1 : 0;
+    }
+  }
+}
 
-      // First, server has sent reply to client and failed, the server call's status is
-      // SENDING_REPLY. This can happen, for example, when the client deadline has
-      // exceeded or the client side is dead.
-      if (server_call->GetState() == ServerCallState::SENDING_REPLY) {
-        server_call->OnReplyFailed();
-        // A new call should be suplied.
-        need_new_call = true;
-      }
-      // Second, the server has been shut down, the server call's status is PENDING.
-      // And don't need to do anything other than deleting this call.
-      // See
-      // https://grpc.github.io/grpc/cpp/classgrpc_1_1_completion_queue.html#a86d9810ced694e50f7987ac90b9f8c1a
-      // for more details.
+void GrpcServer::WakeDynamicPoller(int index) {
+  auto &state = *dynamic_poller_states_[index];
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.wake_requests > 0) {
+      // A wakeup is already pending; don't queue more than one so that a
+      // short burst doesn't unpark the whole pool at once.
+      return;
+    }
+    state.wake_requests = 1;
+  }
+  state.cv.notify_one();
+}
+
+void GrpcServer::ProcessCompletionQueueEvent(void *tag,
+                                             bool ok,
+                                             std::vector<ServerCall *> &ready_calls) {
+  auto *server_call = static_cast<ServerCall *>(tag);
+  bool delete_call = false;
+  // A new call is needed after the server sends a reply, no matter the reply is
+  // successful or failed.
+  bool need_new_call = false;
+  if (ok) {
+    switch (server_call->GetState()) {
+    case ServerCallState::PENDING:
+      // We've received a new incoming request. Now this call object is used to
+      // track this request.
+      ready_calls.push_back(server_call);
+      break;
+    case ServerCallState::SENDING_REPLY:
+      // GRPC has sent reply successfully, invoking the callback.
+      server_call->OnReplySent();
+      // The rpc call has finished and can be deleted now.
       delete_call = true;
+      // A new call should be suplied.
+      need_new_call = true;
+      break;
+    default:
+      RAY_LOG(FATAL) << "Shouldn't reach here.";
+      break;
     }
-    if (delete_call) {
-      if (need_new_call && server_call->GetServerCallFactory().GetMaxActiveRPCs() != -1) {
-        // Create a new `ServerCall` to accept the next incoming request.
-        server_call->GetServerCallFactory().CreateCall();
-      }
-      delete server_call;
+  } else {
+    // `ok == false` will occur in two situations:
+
+    // First, server has sent reply to client and failed, the server call's status is
+    // SENDING_REPLY. This can happen, for example, when the client deadline has
+    // exceeded or the client side is dead.
+    if (server_call->GetState() == ServerCallState::SENDING_REPLY) {
+      server_call->OnReplyFailed();
+      // A new call should be suplied.
+      need_new_call = true;
+    }
+    // Second, the server has been shut down, the server call's status is PENDING.
+    // And don't need to do anything other than deleting this call.
+    // See
+    // https://grpc.github.io/grpc/cpp/classgrpc_1_1_completion_queue.html#a86d9810ced694e50f7987ac90b9f8c1a
+    // for more details.
+    delete_call = true;
+  }
+  if (delete_call) {
+    if (need_new_call && server_call->GetServerCallFactory().GetMaxActiveRPCs() != -1) {
+      // Create a new `ServerCall` to accept the next incoming request.
+      server_call->GetServerCallFactory().CreateCall();
+    }
+    delete server_call;
+  }
+}
+
+void GrpcServer::DispatchReadyCalls(std::vector<ServerCall *> &ready_calls) {
+  if (ready_calls.empty()) {
+    return;
+  }
+  if (ready_calls.size() == 1) {
+    ready_calls.front()->HandleRequest();
+    return;
+  }
+  // Group the handler closures by target io_context, preserving arrival
+  // order within each group. The groups are few (one per event loop the
+  // registered services post to), so a linear scan is fine.
+  std::vector<std::pair<instrumented_io_context *, std::vector<std::function<void()>>>>
+      groups;
+  for (auto *ready_call : ready_calls) {
+    auto handle_request_fn = ready_call->PrepareHandleRequest();
+    if (handle_request_fn == nullptr) {
+      // The call was finished inline, e.g. because its io_context stopped.
+      continue;
+    }
+    auto *io_service = &ready_call->GetHandlerIoService();
+    auto it = std::find_if(groups.begin(), groups.end(), [io_service](const auto &group) {
+      return group.first == io_service;
+    });
+    if (it == groups.end()) {
+      groups.emplace_back(io_service, std::vector<std::function<void()>>{});
+      it = std::prev(groups.end());
+    }
+    it->second.emplace_back(std::move(handle_request_fn));
+  }
+  for (auto &[io_service, handlers] : groups) {
+    if (handlers.size() == 1) {
+      io_service->post(std::move(handlers.front()), "GrpcServer.HandleRequestImpl");
+    } else {
+      io_service->post(
+          [handlers = std::move(handlers)]() {
+            for (auto &handle_request_fn : handlers) {
+              handle_request_fn();
+            }
+          },
+          "GrpcServer.HandleRequestBatch");
     }
   }
 }
@@ -17,7 +17,9 @@
 #include <grpcpp/grpcpp.h>
 
 #include <boost/asio.hpp>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
@@ -26,14 +28,20 @@
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/rpc/authentication/authentication_token.h"
 #include "ray/rpc/authentication/authentication_token_loader.h"
+#include "ray/rpc/metrics.h"
 #include "ray/rpc/server_call.h"
 
 namespace ray {
 namespace rpc {
 /// \param MAX_ACTIVE_RPCS Maximum number of RPCs to handle at the same time. -1 means no
 /// limit.
-#define _RPC_SERVICE_HANDLER(                                                      \
-    SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE, RECORD_METRICS)                  \
+#define _RPC_SERVICE_HANDLER_IN_IO_SERVICE(SERVICE,                                \
+                                           HANDLER,                                \
+                                           MAX_ACTIVE_RPCS,                        \
+                                           AUTH_TYPE,                              \
+                                           RECORD_METRICS,                         \
+                                           IO_SERVICE,                             \
+                                           PRIORITY)                               \
   std::unique_ptr<ServerCallFactory> HANDLER##_call_factory(                       \
       new ServerCallFactoryImpl<SERVICE,                                           \
                                 SERVICE##Handler,                                  \
@@ -45,19 +53,55 @@ namespace rpc {
           service_handler_,                                                        \
           &SERVICE##Handler::Handle##HANDLER,                                      \
           cq,                                                                      \
-          main_service_,                                                           \
+          IO_SERVICE,                                                              \
           #SERVICE ".grpc_server." #HANDLER,                                       \
           AUTH_TYPE == ClusterIdAuthType::NO_AUTH ? ClusterID::Nil() : cluster_id, \
           auth_token,                                                              \
           MAX_ACTIVE_RPCS,                                                         \
-          RECORD_METRICS));                                                        \
+          RECORD_METRICS,                                                          \
+          PRIORITY));                                                              \
   server_call_factories->emplace_back(std::move(HANDLER##_call_factory));
 
+#define _RPC_SERVICE_HANDLER(SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE, RECORD_METRICS) \
+  _RPC_SERVICE_HANDLER_IN_IO_SERVICE(SERVICE,                                              \
+                                     HANDLER,                                              \
+                                     MAX_ACTIVE_RPCS,                                      \
+                                     AUTH_TYPE,                                            \
+                                     RECORD_METRICS,                                       \
+                                     main_service_,                                        \
+                                     ServerCallPriority::kHigh)
+
 /// Define a RPC service handler with gRPC server metrics enabled.
 #define RPC_SERVICE_HANDLER(SERVICE, HANDLER, MAX_ACTIVE_RPCS) \
   _RPC_SERVICE_HANDLER(                                        \
       SERVICE, HANDLER, MAX_ACTIVE_RPCS, ClusterIdAuthType::LAZY_AUTH, true)
 
+/// Define a RPC service handler for a low-priority (sheddable) method. Such
+/// calls share the process-wide in-flight budget configured by
+/// `grpc_server_low_priority_max_inflight` and are rejected with
+/// `Status::OutOfResource` once the budget is exhausted, see
+/// `ServerCallPriority`.
+#define RPC_SERVICE_HANDLER_LOW_PRIORITY(SERVICE, HANDLER, MAX_ACTIVE_RPCS) \
+  _RPC_SERVICE_HANDLER_IN_IO_SERVICE(SERVICE,                               \
+                                     HANDLER,                               \
+                                     MAX_ACTIVE_RPCS,                       \
+                                     ClusterIdAuthType::LAZY_AUTH,          \
+                                     true,                                  \
+                                     main_service_,                         \
+                                     ServerCallPriority::kLow)
+
+/// Same as `RPC_SERVICE_HANDLER_LOW_PRIORITY`, with a custom authentication
+/// type.
+#define RPC_SERVICE_HANDLER_CUSTOM_AUTH_LOW_PRIORITY( \
+    SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE)     \
+  _RPC_SERVICE_HANDLER_IN_IO_SERVICE(SERVICE,         \
+                                     HANDLER,         \
+                                     MAX_ACTIVE_RPCS, \
+                                     AUTH_TYPE,       \
+                                     true,            \
+                                     main_service_,   \
+                                     ServerCallPriority::kLow)
+
 /// Define a RPC service handler with gRPC server metrics disabled.
 #define RPC_SERVICE_HANDLER_SERVER_METRICS_DISABLED(SERVICE, HANDLER, MAX_ACTIVE_RPCS) \
   _RPC_SERVICE_HANDLER(                                                                \
@@ -67,6 +111,20 @@ namespace rpc {
 #define RPC_SERVICE_HANDLER_CUSTOM_AUTH(SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE) \
   _RPC_SERVICE_HANDLER(SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE, true)
 
+/// Define a RPC service handler whose requests are posted to a caller-chosen
+/// io_context instead of the service's main event loop. Used to serve
+/// read-mostly RPCs off the main thread; the handler must be thread-safe with
+/// respect to the state it reads.
+#define RPC_SERVICE_HANDLER_CUSTOM_AUTH_IN_IO_SERVICE(        \
+    SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE, IO_SERVICE) \
+  _RPC_SERVICE_HANDLER_IN_IO_SERVICE(SERVICE,                 \
+                                     HANDLER,                 \
+                                     MAX_ACTIVE_RPCS,         \
+                                     AUTH_TYPE,               \
+                                     true,                    \
+                                     IO_SERVICE,              \
+                                     ServerCallPriority::kHigh)
+
 /// Define a RPC service handler with gRPC server metrics disabled.
 #define RPC_SERVICE_HANDLER_CUSTOM_AUTH_SERVER_METRICS_DISABLED( \
     SERVICE, HANDLER, MAX_ACTIVE_RPCS, AUTH_TYPE)                \
@@ -127,6 +185,14 @@ class GrpcServer {
   /// Get the port of this gRPC server.
   int GetPort() const { return port_; }
 
+  /// Additionally listen on a Unix domain socket at the given path, used as a
+  /// fast lane for clients on the same node. Must be called before Run().
+  /// Ignored when TLS is enabled since the socket is protected by filesystem
+  /// permissions rather than certificates.
+  void SetUnixSocketPath(std::string unix_socket_path) {
+    unix_socket_path_ = std::move(unix_socket_path);
+  }
+
   /// Register a grpc service. Multiple services can be registered to the same server.
   ///
   /// \param[in] service A `GrpcService` to register to this server.
@@ -160,6 +226,36 @@ class GrpcServer {
   /// via the `ServerCall` objects.
   void PollEventsFromCompletionQueue(int index);
 
+  /// Poll `cqs_[index]` once: block for up to 250ms for an event, drain up to
+  /// `batch_size` ready events without blocking, and dispatch the resulting
+  /// calls. Returns the status of the initial blocking poll; on SHUTDOWN the
+  /// caller must stop polling this queue.
+  grpc::CompletionQueue::NextStatus PollOnce(int index,
+                                             int64_t batch_size,
+                                             const std::string &cq_label,
+                                             std::vector<ServerCall *> &ready_calls);
+
+  /// Main loop of an extra polling thread for `cqs_[index]`, see
+  /// `grpc_server_dynamic_pollers_per_cq`. The thread is parked until a busy
+  /// poller of the same queue wakes it, helps drain the queue until it has
+  /// stayed idle for a while, then parks itself again.
+  void DynamicPollerMain(int index);
+
+  /// Wake one parked dynamic poller of `cqs_[index]`, if any.
+  void WakeDynamicPoller(int index);
+
+  /// Handle one event taken from the completion queue. Calls that are ready
+  /// for their service handler are appended to `ready_calls` instead of
+  /// being dispatched immediately, so a batch of them can be coalesced.
+  void ProcessCompletionQueueEvent(void *tag,
+                                   bool ok,
+                                   std::vector<ServerCall *> &ready_calls);
+
+  /// Dispatch the service handlers of the given ready calls. Handlers that
+  /// target the same io_context are coalesced into a single post, in
+  /// arrival order.
+  void DispatchReadyCalls(std::vector<ServerCall *> &ready_calls);
+
   /// Name of this server, used for logging and debugging purpose.
   const std::string name_;
 
@@ -170,6 +266,10 @@ class GrpcServer {
   /// interfaces (0.0.0.0)
   const bool listen_to_localhost_only_;
 
+  /// If non-empty, the server also listens on this Unix domain socket. The
+  /// socket file is removed on shutdown.
+  std::string unix_socket_path_;
+
   /// Token representing ID of this cluster.
   ClusterID cluster_id_;
 
@@ -203,6 +303,24 @@ class GrpcServer {
   /// objects.
   std::vector<std::thread> polling_threads_;
 
+  /// Wake state of the parked dynamic pollers of one completion queue.
+  struct DynamicPollerState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    /// Outstanding wake requests from pollers that hit their drain cap.
+    int wake_requests = 0;
+    /// Set on shutdown to release the parked pollers.
+    bool shutdown = false;
+  };
+
+  /// One wake state per completion queue. Empty unless
+  /// `grpc_server_dynamic_pollers_per_cq` is positive; populated before the
+  /// polling threads start and immutable afterwards.
+  std::vector<std::unique_ptr<DynamicPollerState>> dynamic_poller_states_;
+
+  /// Sampled number of completion-queue events drained per polling wakeup.
+  ray::stats::Gauge grpc_server_cq_depth_gauge_{GetGrpcServerCqDepthGaugeMetric()};
+
   /// The interval to send a new gRPC keepalive timeout from server -> client.
   /// gRPC server cannot get the ping response within the time, it triggers
   /// the watchdog timer fired error, which will close the connection.
@@ -68,6 +68,26 @@ inline ray::stats::Count GetGrpcServerReqFailedCounterMetric() {
       /*tag_keys=*/{"Method"});
 }
 
+inline ray::stats::Count GetGrpcServerReqShedCounterMetric() {
+  return ray::stats::Count(
+      /*name=*/"grpc_server_req_shed",
+      /*description=*/
+      "Number of low-priority requests rejected by the grpc server because the "
+      "low-priority in-flight limit was reached.",
+      /*unit=*/"",
+      /*tag_keys=*/{"Method"});
+}
+
+inline ray::stats::Gauge GetGrpcServerCqDepthGaugeMetric() {
+  return ray::stats::Gauge(
+      /*name=*/"grpc_server_cq_depth",
+      /*description=*/
+      "Completion-queue events drained per polling wakeup, a proxy for the "
+      "completion queue depth of a grpc server.",
+      /*unit=*/"",
+      /*tag_keys=*/{"Name", "CQ"});
+}
+
 inline ray::stats::Count GetGrpcClientReqFailedCounterMetric() {
   return ray::stats::Count(
       /*name=*/"grpc_client_req_failed",
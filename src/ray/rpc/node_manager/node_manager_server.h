@@ -35,9 +35,16 @@ class ServerCallFactory;
   RPC_SERVICE_HANDLER_CUSTOM_AUTH(                   \
       NodeManagerService, METHOD, -1, ClusterIdAuthType::NO_AUTH)
 
+/// Read-mostly RPCs that are posted to the read io_context instead of the main
+/// event loop, so they can be served in parallel with it. Handlers registered
+/// here must not touch state that is only safe to read on the main thread.
+#define RAY_NODE_MANAGER_READ_RPC_SERVICE_HANDLER(METHOD) \
+  RPC_SERVICE_HANDLER_CUSTOM_AUTH_IN_IO_SERVICE(          \
+      NodeManagerService, METHOD, -1, ClusterIdAuthType::NO_AUTH, read_io_service_)
+
 /// NOTE: See src/ray/core_worker/core_worker.h on how to add a new grpc handler.
 #define RAY_NODE_MANAGER_RPC_HANDLERS                                  \
-  RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(GetResourceLoad)                \
+  RAY_NODE_MANAGER_READ_RPC_SERVICE_HANDLER(GetResourceLoad)           \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(CancelLeasesWithResourceShapes) \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(NotifyGCSRestart)               \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(RequestWorkerLease)             \
@@ -47,6 +54,7 @@ class ServerCallFactory;
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(ReleaseUnusedActorWorkers)      \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(CancelWorkerLease)              \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(PinObjectIDs)                   \
+  RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(HintObjectLocation)             \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(GetNodeStats)                   \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(GlobalGC)                       \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(FormatGlobalMemoryInfo)         \
@@ -55,7 +63,7 @@ class ServerCallFactory;
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(CancelResourceReserve)          \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(ResizeLocalResourceInstances)   \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(ReleaseUnusedBundles)           \
-  RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(GetSystemConfig)                \
+  RAY_NODE_MANAGER_READ_RPC_SERVICE_HANDLER(GetSystemConfig)           \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(IsLocalWorkerDead)              \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(ShutdownRaylet)                 \
   RAY_NODE_MANAGER_RPC_SERVICE_HANDLER(DrainRaylet)                    \
@@ -155,6 +163,10 @@ class NodeManagerServiceHandler {
                                   PinObjectIDsReply *reply,
                                   SendReplyCallback send_reply_callback) = 0;
 
+  virtual void HandleHintObjectLocation(HintObjectLocationRequest request,
+                                        HintObjectLocationReply *reply,
+                                        SendReplyCallback send_reply_callback) = 0;
+
   virtual void HandleGetNodeStats(GetNodeStatsRequest request,
                                   GetNodeStatsReply *reply,
                                   SendReplyCallback send_reply_callback) = 0;
@@ -214,10 +226,15 @@ class NodeManagerGrpcService : public GrpcService {
   /// Constructor.
   ///
   /// \param[in] io_service See super class.
+  /// \param[in] read_io_service The event loop that read-mostly RPCs are
+  /// posted to. Pass `io_service` to keep everything on the main event loop.
   /// \param[in] handler The service handler that actually handle the requests.
   NodeManagerGrpcService(instrumented_io_context &io_service,
+                         instrumented_io_context &read_io_service,
                          NodeManagerServiceHandler &service_handler)
-      : GrpcService(io_service), service_handler_(service_handler){};
+      : GrpcService(io_service),
+        read_io_service_(read_io_service),
+        service_handler_(service_handler){};
 
  protected:
   grpc::Service &GetGrpcService() override { return service_; }
@@ -234,6 +251,10 @@ class NodeManagerGrpcService : public GrpcService {
   /// The grpc async service object.
   NodeManagerService::AsyncService service_;
 
+  /// The event loop that read-mostly RPCs are posted to. May be the same as
+  /// the main event loop when the read lane is disabled.
+  instrumented_io_context &read_io_service_;
+
   /// The service handler that actually handle the requests.
   NodeManagerServiceHandler &service_handler_;
 };
@@ -17,6 +17,7 @@
 #include <memory>
 #include <utility>
 
+#include "ray/rpc/channel_pool.h"
 #include "ray/util/exponential_backoff.h"
 
 namespace ray::rpc {
@@ -50,6 +51,12 @@ void RetryableGrpcClient::SetupCheckTimer() {
 }
 
 void RetryableGrpcClient::CheckChannelStatus(bool reset_timer) {
+  // Opportunistically drop pooled channels that no client references
+  // anymore. The pool is empty unless the shared channel pool is enabled,
+  // in which case this piggybacks idle-channel reaping on the periodic
+  // channel status checks.
+  ChannelPool::Instance().ReapIdleChannels();
+
   // We need to cleanup all the pending requests which are timeout.
   const auto now = absl::Now();
   while (!pending_requests_.empty()) {
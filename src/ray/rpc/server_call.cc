@@ -37,8 +37,29 @@ std::unique_ptr<boost::asio::thread_pool> &_GetServerCallExecutor() {
   return thread_pool;
 }
 
+/// Number of low-priority server calls currently admitted, across all gRPC
+/// servers of this process.
+std::atomic<int64_t> &LowPriorityCallCount() {
+  static std::atomic<int64_t> count(0);
+  return count;
+}
+
 }  // namespace
 
+bool TryAcquireLowPriorityCallSlot() {
+  auto &count = LowPriorityCallCount();
+  const int64_t limit =
+      ::RayConfig::instance().grpc_server_low_priority_max_inflight();
+  const int64_t previous = count.fetch_add(1);
+  if (limit > 0 && previous >= limit) {
+    count.fetch_sub(1);
+    return false;
+  }
+  return true;
+}
+
+void ReleaseLowPriorityCallSlot() { LowPriorityCallCount().fetch_sub(1); }
+
 boost::asio::thread_pool &GetServerCallExecutor() { return *_GetServerCallExecutor(); }
 
 void DrainServerCallExecutor() { GetServerCallExecutor().join(); }
@@ -18,6 +18,7 @@
 #include <grpcpp/grpcpp.h>
 
 #include <boost/asio.hpp>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -46,6 +47,25 @@ enum class ClusterIdAuthType {
   EMPTY_AUTH,  // Accept only empty cluster ID.
 };
 
+/// Priority class of a `ServerCall`, assigned per RPC method at registration
+/// time. Low-priority calls (e.g. bulk dashboard reads) share a process-wide
+/// in-flight budget and are rejected with `Status::OutOfResource` once the
+/// budget is exhausted, so that high-priority control-plane calls posted to
+/// the same event loop keep their latency under read storms. See
+/// `grpc_server_low_priority_max_inflight`.
+enum class ServerCallPriority {
+  kHigh = 0,
+  kLow = 1,
+};
+
+/// Try to take one slot of the process-wide low-priority in-flight budget.
+/// Returns false if the budget is exhausted and the call should be shed.
+/// Always succeeds when `grpc_server_low_priority_max_inflight` is 0.
+bool TryAcquireLowPriorityCallSlot();
+
+/// Return a slot taken by `TryAcquireLowPriorityCallSlot`.
+void ReleaseLowPriorityCallSlot();
+
 /// Get the thread pool for the gRPC server.
 /// This pool is shared across gRPC servers.
 boost::asio::thread_pool &GetServerCallExecutor();
@@ -115,6 +135,17 @@ class ServerCall {
   /// `GrpcServer` when the request is received.
   virtual void HandleRequest() = 0;
 
+  /// Run the polling-thread part of request handling (authentication and
+  /// bookkeeping) and return the closure that invokes the service handler,
+  /// for the caller to post to the handler io_context. Used by `GrpcServer`
+  /// to coalesce the handlers of several ready calls into one post. Returns
+  /// nullptr if the call was finished inline (e.g. the io_context stopped).
+  virtual std::function<void()> PrepareHandleRequest() = 0;
+
+  /// The io_context the closure returned by `PrepareHandleRequest` must be
+  /// posted to.
+  virtual instrumented_io_context &GetHandlerIoService() = 0;
+
   /// Invoked when sending reply successes.
   virtual void OnReplySent() = 0;
 
@@ -175,6 +206,7 @@ class ServerCallImpl : public ServerCall {
   /// \param[in] record_metrics If true, it records and exports the gRPC server metrics.
   /// \param[in] preprocess_function If not nullptr, it will be called before handling
   /// request.
+  /// \param[in] priority The priority class of this call, see `ServerCallPriority`.
   ServerCallImpl(
       const ServerCallFactory &factory,
       ServiceHandler &service_handler,
@@ -184,7 +216,8 @@ class ServerCallImpl : public ServerCall {
       const ClusterID &cluster_id,
       std::shared_ptr<const AuthenticationToken> auth_token,
       bool record_metrics,
-      std::function<void()> preprocess_function = nullptr)
+      std::function<void()> preprocess_function = nullptr,
+      ServerCallPriority priority = ServerCallPriority::kHigh)
       : state_(ServerCallState::PENDING),
         factory_(factory),
         service_handler_(service_handler),
@@ -195,7 +228,8 @@ class ServerCallImpl : public ServerCall {
         cluster_id_(cluster_id),
         auth_token_(auth_token),
         start_time_(0),
-        record_metrics_(record_metrics) {
+        record_metrics_(record_metrics),
+        priority_(priority) {
     reply_ = google::protobuf::Arena::CreateMessage<Reply>(&arena_);
     // TODO(Yi Cheng) call_name_ sometimes get corrunpted due to memory issues.
     RAY_CHECK(!call_name_.empty()) << "Call name is empty";
@@ -207,6 +241,18 @@ class ServerCallImpl : public ServerCall {
   ServerCallState GetState() const override { return state_; }
 
   void HandleRequest() override {
+    auto handle_request_fn = PrepareHandleRequest();
+    if (handle_request_fn == nullptr) {
+      return;
+    }
+    io_service_.post(std::move(handle_request_fn),
+                     call_name_ + ".HandleRequestImpl",
+                     // Implement the delay of the rpc server call as the
+                     // delay of HandleRequestImpl().
+                     ray::asio::testing::GetDelayUs(call_name_));
+  }
+
+  std::function<void()> PrepareHandleRequest() override {
     stats_handle_ = io_service_.stats()->RecordStart(call_name_);
     bool auth_success = true;
     bool token_auth_failed = false;
@@ -247,30 +293,49 @@ class ServerCallImpl : public ServerCall {
     if (record_metrics_) {
       grpc_server_req_handling_counter_.Record(1.0, {{"Method", call_name_}});
     }
+    if (auth_success && priority_ == ServerCallPriority::kLow) {
+      if (!TryAcquireLowPriorityCallSlot()) {
+        // The low-priority class is at its in-flight limit, which means the
+        // event loop is already backed up with sheddable reads. Reject the
+        // call right away instead of queueing it behind the backlog, so that
+        // high-priority calls posted to the same event loop keep their
+        // latency. The client is expected to back off and retry.
+        if (record_metrics_) {
+          grpc_server_req_shed_counter_.Record(1.0, {{"Method", call_name_}});
+        }
+        if (factory_.GetMaxActiveRPCs() == -1) {
+          // `HandleRequestImpl` will not run for this call, so replenish the
+          // pending `ServerCall` it would have created.
+          factory_.CreateCall();
+        }
+        SendReply(
+            Status::OutOfResource("The server is overloaded and temporarily rejects "
+                                  "low-priority requests. Please retry later."));
+        return nullptr;
+      }
+      holds_low_priority_slot_ = true;
+    }
     if (!io_service_.stopped()) {
-      io_service_.post(
-          [this, auth_success, token_auth_failed, cluster_id_auth_failed] {
-            HandleRequestImpl(auth_success, token_auth_failed, cluster_id_auth_failed);
-          },
-          call_name_ + ".HandleRequestImpl",
-          // Implement the delay of the rpc server call as the
-          // delay of HandleRequestImpl().
-          ray::asio::testing::GetDelayUs(call_name_));
+      return [this, auth_success, token_auth_failed, cluster_id_auth_failed] {
+        HandleRequestImpl(auth_success, token_auth_failed, cluster_id_auth_failed);
+      };
+    }
+    // Handle service for rpc call has stopped, we must handle the call here
+    // to send reply and remove it from cq
+    RAY_LOG(DEBUG) << "Handle service has been closed.";
+    if (auth_success) {
+      SendReply(Status::Invalid("HandleServiceClosed"));
+    } else if (token_auth_failed) {
+      SendReply(Status::Unauthenticated(
+          "InvalidAuthToken: Authentication token is missing or incorrect"));
     } else {
-      // Handle service for rpc call has stopped, we must handle the call here
-      // to send reply and remove it from cq
-      RAY_LOG(DEBUG) << "Handle service has been closed.";
-      if (auth_success) {
-        SendReply(Status::Invalid("HandleServiceClosed"));
-      } else if (token_auth_failed) {
-        SendReply(Status::Unauthenticated(
-            "InvalidAuthToken: Authentication token is missing or incorrect"));
-      } else {
-        SendReply(Status::Unauthenticated("WrongClusterID"));
-      }
+      SendReply(Status::Unauthenticated("WrongClusterID"));
     }
+    return nullptr;
   }
 
+  instrumented_io_context &GetHandlerIoService() override { return io_service_; }
+
   void HandleRequestImpl(bool auth_success,
                          bool token_auth_failed,
                          bool cluster_id_auth_failed) {
@@ -372,6 +437,10 @@ class ServerCallImpl : public ServerCall {
 
   /// Log the duration this query used
   void LogProcessTime() {
+    if (holds_low_priority_slot_) {
+      ReleaseLowPriorityCallSlot();
+      holds_low_priority_slot_ = false;
+    }
     io_service_.stats()->RecordEnd(std::move(stats_handle_));
     auto end_time = absl::GetCurrentTimeNanos();
     if (record_metrics_) {
@@ -452,6 +521,12 @@ class ServerCallImpl : public ServerCall {
   /// If true, the server call will generate gRPC server metrics.
   bool record_metrics_;
 
+  /// The priority class of this call, see `ServerCallPriority`.
+  ServerCallPriority priority_;
+
+  /// Whether this call holds a slot of the low-priority in-flight budget.
+  bool holds_low_priority_slot_ = false;
+
   ray::stats::Histogram grpc_server_req_process_time_ms_histogram_{
       GetGrpcServerReqProcessTimeMsHistogramMetric()};
   ray::stats::Count grpc_server_req_new_counter_{GetGrpcServerReqNewCounterMetric()};
@@ -463,6 +538,7 @@ class ServerCallImpl : public ServerCall {
       GetGrpcServerReqSucceededCounterMetric()};
   ray::stats::Count grpc_server_req_failed_counter_{
       GetGrpcServerReqFailedCounterMetric()};
+  ray::stats::Count grpc_server_req_shed_counter_{GetGrpcServerReqShedCounterMetric()};
 
   template <class T1, class T2, class T3, class T4, ClusterIdAuthType T5>
   friend class ServerCallFactoryImpl;
@@ -512,6 +588,7 @@ class ServerCallFactoryImpl : public ServerCallFactory {
   /// \param[in] max_active_rpcs Maximum request number to handle at the same time. -1
   /// means no limit.
   /// \param[in] record_metrics If true, it records and exports the gRPC server metrics.
+  /// \param[in] priority The priority class of the calls this factory creates.
   ServerCallFactoryImpl(
       AsyncService &service,
       RequestCallFunction<GrpcService, Request, Reply> request_call_function,
@@ -523,7 +600,8 @@ class ServerCallFactoryImpl : public ServerCallFactory {
       const ClusterID &cluster_id,
       std::shared_ptr<const AuthenticationToken> auth_token,
       int64_t max_active_rpcs,
-      bool record_metrics)
+      bool record_metrics,
+      ServerCallPriority priority = ServerCallPriority::kHigh)
       : service_(service),
         request_call_function_(request_call_function),
         service_handler_(service_handler),
@@ -534,7 +612,8 @@ class ServerCallFactoryImpl : public ServerCallFactory {
         cluster_id_(cluster_id),
         auth_token_(auth_token),
         max_active_rpcs_(max_active_rpcs),
-        record_metrics_(record_metrics) {}
+        record_metrics_(record_metrics),
+        priority_(priority) {}
 
   void CreateCall() const override {
     // Create a new `ServerCall`. This object will eventually be deleted by
@@ -547,7 +626,9 @@ class ServerCallFactoryImpl : public ServerCallFactory {
         call_name_,
         cluster_id_,
         auth_token_,
-        record_metrics_);
+        record_metrics_,
+        /*preprocess_function=*/nullptr,
+        priority_);
     /// Request gRPC runtime to starting accepting this kind of request, using the call as
     /// the tag.
     (service_.*request_call_function_)(&call->context_,
@@ -595,6 +676,9 @@ class ServerCallFactoryImpl : public ServerCallFactory {
 
   /// If true, the server call will generate gRPC server metrics.
   bool record_metrics_;
+
+  /// The priority class of the calls this factory creates.
+  ServerCallPriority priority_;
 };
 
 }  // namespace rpc
@@ -0,0 +1,87 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/rpc/channel_pool.h"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ray/common/ray_config.h"
+
+namespace ray {
+namespace rpc {
+
+namespace {
+
+std::shared_ptr<grpc::Channel> MakeChannel(const std::string &endpoint) {
+  // The channel connects lazily, so no server is needed.
+  return grpc::CreateChannel(endpoint, grpc::InsecureChannelCredentials());
+}
+
+}  // namespace
+
+TEST(ChannelPoolTest, TestSameEndpointSharesChannel) {
+  ChannelPool pool;
+  auto factory = []() { return MakeChannel("127.0.0.1:12345"); };
+  auto channel1 = pool.GetOrCreateChannel("127.0.0.1:12345", factory);
+  auto channel2 = pool.GetOrCreateChannel("127.0.0.1:12345", factory);
+  ASSERT_EQ(channel1, channel2);
+  ASSERT_EQ(pool.Size(), 1);
+
+  auto channel3 = pool.GetOrCreateChannel(
+      "127.0.0.1:12346", []() { return MakeChannel("127.0.0.1:12346"); });
+  ASSERT_NE(channel1, channel3);
+  ASSERT_EQ(pool.Size(), 2);
+}
+
+TEST(ChannelPoolTest, TestReapIdleChannels) {
+  ChannelPool pool;
+  auto channel = pool.GetOrCreateChannel(
+      "127.0.0.1:12345", []() { return MakeChannel("127.0.0.1:12345"); });
+  // A referenced channel is not reaped, even though it is IDLE (it never
+  // connected).
+  pool.ReapIdleChannels();
+  ASSERT_EQ(pool.Size(), 1);
+
+  // Once the last client reference is gone, the idle channel is reaped.
+  channel.reset();
+  pool.ReapIdleChannels();
+  ASSERT_EQ(pool.Size(), 0);
+}
+
+TEST(ChannelPoolTest, TestMaxChannelsHandsOutUnpooledChannels) {
+  RayConfig::instance().grpc_client_channel_pool_max_channels() = 1;
+  ChannelPool pool;
+  auto channel1 = pool.GetOrCreateChannel(
+      "127.0.0.1:12345", []() { return MakeChannel("127.0.0.1:12345"); });
+  // The pool is full and channel1 is still referenced, so the second
+  // endpoint gets an unpooled channel every time.
+  auto factory2 = []() { return MakeChannel("127.0.0.1:12346"); };
+  auto channel2 = pool.GetOrCreateChannel("127.0.0.1:12346", factory2);
+  auto channel3 = pool.GetOrCreateChannel("127.0.0.1:12346", factory2);
+  ASSERT_NE(channel2, channel3);
+  ASSERT_EQ(pool.Size(), 1);
+
+  // Dropping channel1 lets the pool reap it and cache the next channel.
+  channel1.reset();
+  auto channel4 = pool.GetOrCreateChannel("127.0.0.1:12346", factory2);
+  auto channel5 = pool.GetOrCreateChannel("127.0.0.1:12346", factory2);
+  ASSERT_EQ(channel4, channel5);
+  ASSERT_EQ(pool.Size(), 1);
+  RayConfig::instance().grpc_client_channel_pool_max_channels() = 0;
+}
+
+}  // namespace rpc
+}  // namespace ray
@@ -12,8 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <string>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -116,6 +120,217 @@ TEST_F(TestGrpcServerClientFixture, TestBasic) {
   }
 }
 
+class TestGrpcServerClientBatchingFixture : public TestGrpcServerClientFixture {
+ public:
+  void SetUp() override {
+    // Must be set before the server starts its polling threads.
+    RayConfig::instance().grpc_server_request_batch_size() = 8;
+    TestGrpcServerClientFixture::SetUp();
+  }
+
+  void TearDown() override {
+    TestGrpcServerClientFixture::TearDown();
+    RayConfig::instance().grpc_server_request_batch_size() = 1;
+  }
+};
+
+TEST_F(TestGrpcServerClientBatchingFixture, TestBatchedRequestsAllReplied) {
+  // Send a burst of requests. With a drain size of 8 the polling thread
+  // coalesces ready handlers into fewer posts; every request must still get
+  // exactly one reply.
+  constexpr int kNumRequests = 100;
+  std::atomic<int> replied(0);
+  PingRequest request;
+  for (int i = 0; i < kNumRequests; i++) {
+    Ping(request, [&replied](const Status &status, const PingReply &reply) {
+      ASSERT_TRUE(status.ok());
+      replied++;
+    });
+  }
+  while (replied < kNumRequests) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+class TestGrpcServerClientReplyBatchingFixture : public TestGrpcServerClientFixture {
+ public:
+  void SetUp() override {
+    // Must be set before the client starts its polling threads.
+    RayConfig::instance().grpc_client_reply_batch_size() = 8;
+    TestGrpcServerClientFixture::SetUp();
+  }
+
+  void TearDown() override {
+    TestGrpcServerClientFixture::TearDown();
+    RayConfig::instance().grpc_client_reply_batch_size() = 1;
+  }
+};
+
+TEST_F(TestGrpcServerClientReplyBatchingFixture, TestBatchedRepliesAllDelivered) {
+  // Send a burst of requests. With a drain size of 8 the client polling
+  // thread coalesces ready reply callbacks into fewer posts; every request
+  // must still get exactly one reply.
+  constexpr int kNumRequests = 100;
+  std::atomic<int> replied(0);
+  PingRequest request;
+  for (int i = 0; i < kNumRequests; i++) {
+    Ping(request, [&replied](const Status &status, const PingReply &reply) {
+      ASSERT_TRUE(status.ok());
+      replied++;
+    });
+  }
+  while (replied < kNumRequests) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+TEST_F(TestGrpcServerClientFixture, TestInlineReplyDelivery) {
+  // Replace the client with one that runs reply callbacks directly on the
+  // polling threads instead of posting them to the client event loop.
+  grpc_client_.reset();
+  client_call_manager_.reset(new ClientCallManager(client_io_service_,
+                                                   false,
+                                                   /*local_address=*/"",
+                                                   ClusterID::Nil(),
+                                                   /*num_threads=*/1,
+                                                   /*call_timeout_ms=*/-1,
+                                                   /*inline_reply_delivery=*/true));
+  grpc_client_.reset(new GrpcClient<TestService>(
+      "127.0.0.1", grpc_server_->GetPort(), *client_call_manager_));
+
+  constexpr int kNumRequests = 10;
+  std::atomic<int> replied(0);
+  PingRequest request;
+  for (int i = 0; i < kNumRequests; i++) {
+    Ping(request, [&replied](const Status &status, const PingReply &reply) {
+      ASSERT_TRUE(status.ok());
+      replied++;
+    });
+  }
+  while (replied < kNumRequests) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+class TestGrpcServerClientDynamicPollerFixture : public TestGrpcServerClientFixture {
+ public:
+  void SetUp() override {
+    // Must be set before the server starts its polling threads.
+    RayConfig::instance().grpc_server_dynamic_pollers_per_cq() = 2;
+    TestGrpcServerClientFixture::SetUp();
+  }
+
+  void TearDown() override {
+    TestGrpcServerClientFixture::TearDown();
+    RayConfig::instance().grpc_server_dynamic_pollers_per_cq() = 0;
+  }
+};
+
+TEST_F(TestGrpcServerClientDynamicPollerFixture, TestBurstWithDynamicPollers) {
+  // Send a burst of requests. The base poller hits its drain cap and wakes
+  // the extra pollers; every request must still get exactly one reply, and
+  // shutdown must join the extra pollers cleanly.
+  constexpr int kNumRequests = 100;
+  std::atomic<int> replied(0);
+  PingRequest request;
+  for (int i = 0; i < kNumRequests; i++) {
+    Ping(request, [&replied](const Status &status, const PingReply &reply) {
+      ASSERT_TRUE(status.ok());
+      replied++;
+    });
+  }
+  while (replied < kNumRequests) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+TEST(GrpcServerLowPriorityTest, TestLowPriorityCallsShedUnderLoad) {
+  RayConfig::instance().grpc_server_low_priority_max_inflight() = 1;
+
+  // Server registering Ping as a low-priority method.
+  TestServiceHandler test_service_handler;
+  instrumented_io_context handler_io_service;
+  std::thread handler_thread([&handler_io_service]() {
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        handler_io_service_work(handler_io_service.get_executor());
+    handler_io_service.run();
+  });
+  GrpcServer grpc_server("test-low-priority", 0, true);
+  grpc_server.RegisterService(std::make_unique<TestGrpcServiceLowPriority>(
+                                  handler_io_service, test_service_handler),
+                              false);
+  grpc_server.Run();
+  while (grpc_server.GetPort() == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  instrumented_io_context client_io_service;
+  std::thread client_thread([&client_io_service]() {
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        client_io_service_work(client_io_service.get_executor());
+    client_io_service.run();
+  });
+  ClientCallManager client_call_manager(client_io_service, false, /*local_address=*/"");
+  auto grpc_client = std::make_unique<GrpcClient<TestService>>(
+      "127.0.0.1", grpc_server.GetPort(), client_call_manager);
+  auto send_ping = [&grpc_client](std::function<void(const Status &)> callback) {
+    PingRequest request;
+    grpc_client->CallMethod<PingRequest, PingReply>(
+        &TestService::Stub::PrepareAsyncPing,
+        request,
+        [callback = std::move(callback)](const Status &status, const PingReply &reply) {
+          callback(status);
+        },
+        "Ping");
+  };
+
+  // The first request takes the single low-priority slot and holds it while
+  // the handler is frozen.
+  test_service_handler.frozen = true;
+  std::atomic<int> ok_replies(0);
+  send_ping([&ok_replies](const Status &status) {
+    EXPECT_TRUE(status.ok()) << status;
+    ok_replies++;
+  });
+  while (test_service_handler.request_count < 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // The second request exceeds the in-flight budget and is rejected right
+  // away, while the first one is still being handled.
+  std::atomic<bool> shed(false);
+  send_ping([&shed](const Status &status) {
+    EXPECT_TRUE(status.IsOutOfResource()) << status;
+    shed = true;
+  });
+  while (!shed) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(test_service_handler.request_count, 1);
+
+  // Once the first request finishes, the slot is released and low-priority
+  // calls are admitted again.
+  test_service_handler.frozen = false;
+  while (ok_replies < 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  send_ping([&ok_replies](const Status &status) {
+    EXPECT_TRUE(status.ok()) << status;
+    ok_replies++;
+  });
+  while (ok_replies < 2) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  grpc_client.reset();
+  client_io_service.stop();
+  client_thread.join();
+  grpc_server.Shutdown();
+  handler_io_service.stop();
+  handler_thread.join();
+  RayConfig::instance().grpc_server_low_priority_max_inflight() = 0;
+}
+
 TEST_F(TestGrpcServerClientFixture, TestBackpressure) {
   // Send a request which won't be replied to.
   PingRequest request;
@@ -251,6 +466,66 @@ TEST_F(TestGrpcServerClientFixture, TestTimeoutMacro) {
   }
 }
 
+TEST(GrpcServerUnixSocketTest, TestPingOverUnixSocket) {
+  auto socket_path =
+      (std::filesystem::temp_directory_path() /
+       ("grpc_uds_test_" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+        ".sock"))
+          .string();
+
+  // Server listening on both a TCP port and the Unix domain socket.
+  TestServiceHandler test_service_handler;
+  instrumented_io_context handler_io_service;
+  std::thread handler_thread([&handler_io_service]() {
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        handler_io_service_work(handler_io_service.get_executor());
+    handler_io_service.run();
+  });
+  GrpcServer grpc_server("test-uds", 0, true);
+  grpc_server.SetUnixSocketPath(socket_path);
+  grpc_server.RegisterService(
+      std::make_unique<TestGrpcService>(handler_io_service, test_service_handler),
+      false);
+  grpc_server.Run();
+  ASSERT_TRUE(std::filesystem::exists(socket_path));
+
+  // Client connecting over the Unix domain socket only.
+  instrumented_io_context client_io_service;
+  std::thread client_thread([&client_io_service]() {
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        client_io_service_work(client_io_service.get_executor());
+    client_io_service.run();
+  });
+  ClientCallManager client_call_manager(client_io_service, false, /*local_address=*/"");
+  auto grpc_client = std::make_unique<GrpcClient<TestService>>(
+      BuildUnixSocketChannel(socket_path), client_call_manager, "127.0.0.1");
+
+  PingRequest request;
+  std::atomic<bool> done(false);
+  grpc_client->CallMethod<PingRequest, PingReply>(
+      &TestService::Stub::PrepareAsyncPing,
+      request,
+      [&done](const Status &status, const PingReply &reply) {
+        EXPECT_TRUE(status.ok()) << status;
+        done = true;
+      },
+      "Ping");
+  while (!done) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(test_service_handler.request_count, 1);
+
+  grpc_client.reset();
+  client_io_service.stop();
+  client_thread.join();
+  grpc_server.Shutdown();
+  handler_io_service.stop();
+  handler_thread.join();
+  // The socket file is removed on shutdown.
+  ASSERT_FALSE(std::filesystem::exists(socket_path));
+}
+
 }  // namespace rpc
 }  // namespace ray
 
@@ -75,6 +75,34 @@ class TestServiceHandler {
   std::atomic<bool> frozen{false};
 };
 
+class TestGrpcServiceLowPriority : public GrpcService {
+ public:
+  /// Same handler as `TestGrpcService`, but registers Ping as a low-priority
+  /// (sheddable) method without a concurrency limit, to exercise low-priority
+  /// load shedding. See `grpc_server_low_priority_max_inflight`.
+  explicit TestGrpcServiceLowPriority(instrumented_io_context &handler_io_service_,
+                                      TestServiceHandler &handler)
+      : GrpcService(handler_io_service_), service_handler_(handler){};
+
+ protected:
+  grpc::Service &GetGrpcService() override { return service_; }
+
+  void InitServerCallFactories(
+      const std::unique_ptr<grpc::ServerCompletionQueue> &cq,
+      std::vector<std::unique_ptr<ServerCallFactory>> *server_call_factories,
+      const ClusterID &cluster_id,
+      std::shared_ptr<const AuthenticationToken> auth_token) override {
+    RPC_SERVICE_HANDLER_CUSTOM_AUTH_LOW_PRIORITY(
+        TestService, Ping, /*max_active_rpcs=*/-1, ClusterIdAuthType::NO_AUTH);
+  }
+
+ private:
+  /// The grpc async service object.
+  TestService::AsyncService service_;
+  /// The service handler that actually handle the requests.
+  TestServiceHandler &service_handler_;
+};
+
 class TestGrpcService : public GrpcService {
  public:
   /// Constructor.
@@ -19,6 +19,7 @@
 fn main() {
     cxx_build::bridges([
         "src/common/status.rs",
+        "src/common/callbacks.rs",
         "src/common/id.rs",
         "src/common/scheduling.rs",
         "src/common/plasma.rs",
@@ -30,6 +31,7 @@ fn main() {
     println!("cargo:rerun-if-changed=src/lib.rs");
     println!("cargo:rerun-if-changed=src/common/mod.rs");
     println!("cargo:rerun-if-changed=src/common/status.rs");
+    println!("cargo:rerun-if-changed=src/common/callbacks.rs");
     println!("cargo:rerun-if-changed=src/common/id.rs");
     println!("cargo:rerun-if-changed=src/common/scheduling.rs");
     println!("cargo:rerun-if-changed=src/common/plasma.rs");
@@ -97,6 +97,144 @@ impl<F: FnOnce(i32)> RustCallback<F> {
     }
 }
 
+/// A single completed async operation recorded in a [`CompletionRing`].
+///
+/// The status is stored inline as a code plus message so that entries can be
+/// pooled and reused without allocating a fresh status object per completion.
+pub struct Completion {
+    /// Caller-assigned identifier of the async operation.
+    pub operation_id: u64,
+    /// Status code of the completed operation (0 = OK). Values match the
+    /// `StatusCode` enum in the status FFI bridge.
+    pub code: i8,
+    /// Error message; empty for OK completions. The String's allocation is
+    /// retained when the entry is recycled through the pool.
+    pub message: String,
+}
+
+/// A batch of completions handed to the consumer in one drain call.
+///
+/// The batch owns its entries; returning it to the originating ring via
+/// [`CompletionRing::recycle`] puts the entry storage back into the pool.
+pub struct CompletionBatch {
+    entries: Vec<Completion>,
+}
+
+impl CompletionBatch {
+    /// Number of completions in the batch.
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Whether the batch is empty.
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Access a completion by index.
+    pub fn get(&self, index: usize) -> &Completion {
+        &self.entries[index]
+    }
+}
+
+/// A bounded ring of completed async operations.
+///
+/// The producer (C++) records one entry per completed operation with `push`;
+/// the consumer drains all accumulated entries in a single call, amortizing
+/// the FFI boundary crossing across the whole batch. Entry storage — including
+/// message String allocations — is pooled: recycling a drained batch returns
+/// its entries for reuse, so a warmed-up ring performs no allocation on the
+/// push path.
+///
+/// The ring is not internally synchronized; callers serialize access the same
+/// way they would around the per-operation callbacks this replaces.
+pub struct CompletionRing {
+    /// Completions accumulated since the last drain.
+    pending: Vec<Completion>,
+    /// Recycled entries available for reuse by `push`.
+    pool: Vec<Completion>,
+    /// Spare entry vector swapped in on drain to avoid reallocating `pending`.
+    spare: Vec<Completion>,
+    /// Maximum number of pending completions.
+    capacity: usize,
+    /// Number of completions rejected because the ring was full.
+    dropped: u64,
+}
+
+impl CompletionRing {
+    /// Create a ring that holds at most `capacity` pending completions.
+    pub fn new(capacity: usize) -> Self {
+        let capacity = capacity.max(1);
+        Self {
+            pending: Vec::with_capacity(capacity),
+            pool: Vec::new(),
+            spare: Vec::with_capacity(capacity),
+            capacity,
+            dropped: 0,
+        }
+    }
+
+    /// Record a completed operation. Returns false (and counts a drop) if the
+    /// ring is full; the producer should drain before retrying.
+    pub fn push(&mut self, operation_id: u64, code: i8, message: &str) -> bool {
+        if self.pending.len() >= self.capacity {
+            self.dropped += 1;
+            return false;
+        }
+        let mut entry = self.pool.pop().unwrap_or_else(|| Completion {
+            operation_id: 0,
+            code: 0,
+            message: String::new(),
+        });
+        entry.operation_id = operation_id;
+        entry.code = code;
+        entry.message.clear();
+        entry.message.push_str(message);
+        self.pending.push(entry);
+        true
+    }
+
+    /// Number of pending completions.
+    pub fn len(&self) -> usize {
+        self.pending.len()
+    }
+
+    /// Whether there are no pending completions.
+    pub fn is_empty(&self) -> bool {
+        self.pending.is_empty()
+    }
+
+    /// Maximum number of pending completions.
+    pub fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    /// Number of completions rejected because the ring was full.
+    pub fn dropped(&self) -> u64 {
+        self.dropped
+    }
+
+    /// Take all pending completions as one batch, leaving the ring empty.
+    pub fn drain(&mut self) -> CompletionBatch {
+        let entries = std::mem::replace(&mut self.pending, std::mem::take(&mut self.spare));
+        CompletionBatch { entries }
+    }
+
+    /// Return a drained batch's entry storage to the pool for reuse.
+    pub fn recycle(&mut self, batch: CompletionBatch) {
+        let mut entries = batch.entries;
+        while let Some(entry) = entries.pop() {
+            if self.pool.len() < self.capacity {
+                self.pool.push(entry);
+            }
+        }
+        // Keep the (now empty) vector as the swap target for the next drain.
+        if self.spare.capacity() < entries.capacity() {
+            self.spare = entries;
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -121,4 +259,53 @@ mod tests {
 
         assert_eq!(result.load(Ordering::SeqCst), 42);
     }
+
+    #[test]
+    fn test_completion_ring_push_and_drain() {
+        let mut ring = CompletionRing::new(8);
+        assert!(ring.is_empty());
+        assert!(ring.push(1, 0, ""));
+        assert!(ring.push(2, 5, "io error"));
+        assert_eq!(ring.len(), 2);
+
+        let batch = ring.drain();
+        assert!(ring.is_empty());
+        assert_eq!(batch.len(), 2);
+        assert_eq!(batch.get(0).operation_id, 1);
+        assert_eq!(batch.get(0).code, 0);
+        assert_eq!(batch.get(1).operation_id, 2);
+        assert_eq!(batch.get(1).code, 5);
+        assert_eq!(batch.get(1).message, "io error");
+    }
+
+    #[test]
+    fn test_completion_ring_full_counts_drops() {
+        let mut ring = CompletionRing::new(2);
+        assert!(ring.push(1, 0, ""));
+        assert!(ring.push(2, 0, ""));
+        assert!(!ring.push(3, 0, ""));
+        assert_eq!(ring.dropped(), 1);
+
+        // Draining makes room again.
+        let batch = ring.drain();
+        ring.recycle(batch);
+        assert!(ring.push(3, 0, ""));
+        assert_eq!(ring.dropped(), 1);
+    }
+
+    #[test]
+    fn test_completion_ring_recycle_reuses_entries() {
+        let mut ring = CompletionRing::new(4);
+        assert!(ring.push(1, 5, "a long-ish error message to allocate"));
+        let batch = ring.drain();
+        ring.recycle(batch);
+
+        // Recycled entries are fully overwritten by the next push.
+        assert!(ring.push(2, 0, ""));
+        let batch = ring.drain();
+        assert_eq!(batch.len(), 1);
+        assert_eq!(batch.get(0).operation_id, 2);
+        assert_eq!(batch.get(0).code, 0);
+        assert_eq!(batch.get(0).message, "");
+    }
 }
@@ -0,0 +1,171 @@
+// Copyright 2017 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! Completion ring FFI bridge for C++ interop.
+//!
+//! This module exposes the batched callback completion ring from
+//! `crate::callbacks` to C++ code. Instead of one boundary crossing per
+//! completed async operation, the C++ producer accumulates completions in the
+//! ring and the consumer drains them all in a single FFI call. Status codes
+//! use the same values as the `StatusCode` enum in the status bridge.
+
+use crate::callbacks::{CompletionBatch, CompletionRing};
+
+/// Wrapper type for CompletionRing that can be used across the FFI boundary.
+pub struct RustCompletionRing {
+    inner: CompletionRing,
+}
+
+/// Wrapper type for CompletionBatch that can be used across the FFI boundary.
+pub struct RustCompletionBatch {
+    inner: CompletionBatch,
+}
+
+#[cxx::bridge(namespace = "ray::ffi")]
+mod ffi {
+    extern "Rust" {
+        type RustCompletionRing;
+        type RustCompletionBatch;
+
+        /// Create a completion ring holding at most `capacity` pending entries.
+        fn completion_ring_new(capacity: usize) -> Box<RustCompletionRing>;
+
+        /// Record a completed operation. Returns false if the ring is full.
+        fn completion_ring_push(
+            ring: &mut RustCompletionRing,
+            operation_id: u64,
+            code: i8,
+            message: &str,
+        ) -> bool;
+
+        /// Number of pending completions.
+        fn completion_ring_len(ring: &RustCompletionRing) -> usize;
+
+        /// Maximum number of pending completions.
+        fn completion_ring_capacity(ring: &RustCompletionRing) -> usize;
+
+        /// Number of completions rejected because the ring was full.
+        fn completion_ring_dropped(ring: &RustCompletionRing) -> u64;
+
+        /// Take all pending completions as one batch, leaving the ring empty.
+        fn completion_ring_drain(ring: &mut RustCompletionRing) -> Box<RustCompletionBatch>;
+
+        /// Return a drained batch's entry storage to the ring's pool.
+        fn completion_ring_recycle(
+            ring: &mut RustCompletionRing,
+            batch: Box<RustCompletionBatch>,
+        );
+
+        /// Number of completions in the batch.
+        fn completion_batch_len(batch: &RustCompletionBatch) -> usize;
+
+        /// Operation id of the completion at `index`.
+        fn completion_batch_operation_id(batch: &RustCompletionBatch, index: usize) -> u64;
+
+        /// Status code of the completion at `index` (0 = OK).
+        fn completion_batch_code(batch: &RustCompletionBatch, index: usize) -> i8;
+
+        /// Error message of the completion at `index`; empty for OK.
+        fn completion_batch_message(batch: &RustCompletionBatch, index: usize) -> &str;
+    }
+}
+
+// FFI function implementations
+
+fn completion_ring_new(capacity: usize) -> Box<RustCompletionRing> {
+    Box::new(RustCompletionRing {
+        inner: CompletionRing::new(capacity),
+    })
+}
+
+fn completion_ring_push(
+    ring: &mut RustCompletionRing,
+    operation_id: u64,
+    code: i8,
+    message: &str,
+) -> bool {
+    ring.inner.push(operation_id, code, message)
+}
+
+fn completion_ring_len(ring: &RustCompletionRing) -> usize {
+    ring.inner.len()
+}
+
+fn completion_ring_capacity(ring: &RustCompletionRing) -> usize {
+    ring.inner.capacity()
+}
+
+fn completion_ring_dropped(ring: &RustCompletionRing) -> u64 {
+    ring.inner.dropped()
+}
+
+fn completion_ring_drain(ring: &mut RustCompletionRing) -> Box<RustCompletionBatch> {
+    Box::new(RustCompletionBatch {
+        inner: ring.inner.drain(),
+    })
+}
+
+fn completion_ring_recycle(ring: &mut RustCompletionRing, batch: Box<RustCompletionBatch>) {
+    ring.inner.recycle(batch.inner);
+}
+
+fn completion_batch_len(batch: &RustCompletionBatch) -> usize {
+    batch.inner.len()
+}
+
+fn completion_batch_operation_id(batch: &RustCompletionBatch, index: usize) -> u64 {
+    batch.inner.get(index).operation_id
+}
+
+fn completion_batch_code(batch: &RustCompletionBatch, index: usize) -> i8 {
+    batch.inner.get(index).code
+}
+
+fn completion_batch_message(batch: &RustCompletionBatch, index: usize) -> &str {
+    &batch.inner.get(index).message
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_completion_ring_roundtrip() {
+        let mut ring = completion_ring_new(4);
+        assert_eq!(completion_ring_capacity(&ring), 4);
+        assert!(completion_ring_push(&mut ring, 7, 0, ""));
+        assert!(completion_ring_push(&mut ring, 8, 22, "object not found"));
+        assert_eq!(completion_ring_len(&ring), 2);
+
+        let batch = completion_ring_drain(&mut ring);
+        assert_eq!(completion_ring_len(&ring), 0);
+        assert_eq!(completion_batch_len(&batch), 2);
+        assert_eq!(completion_batch_operation_id(&batch, 0), 7);
+        assert_eq!(completion_batch_code(&batch, 0), 0);
+        assert_eq!(completion_batch_operation_id(&batch, 1), 8);
+        assert_eq!(completion_batch_code(&batch, 1), 22);
+        assert_eq!(completion_batch_message(&batch, 1), "object not found");
+
+        completion_ring_recycle(&mut ring, batch);
+        assert!(completion_ring_push(&mut ring, 9, 0, ""));
+    }
+
+    #[test]
+    fn test_completion_ring_drop_counter() {
+        let mut ring = completion_ring_new(1);
+        assert!(completion_ring_push(&mut ring, 1, 0, ""));
+        assert!(!completion_ring_push(&mut ring, 2, 0, ""));
+        assert_eq!(completion_ring_dropped(&ring), 1);
+    }
+}
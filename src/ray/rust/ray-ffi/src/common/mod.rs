@@ -17,6 +17,7 @@
 pub mod allocator;
 pub mod asio_chaos;
 pub mod bundle_location_index;
+pub mod callbacks;
 pub mod cgroup;
 pub mod cgroup_manager;
 pub mod cmd_line_utils;
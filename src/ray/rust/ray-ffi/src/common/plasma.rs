@@ -65,6 +65,22 @@ pub struct RustPlasmaResult {
     error_message: String,
 }
 
+/// Borrowed, zero-copy view of a pinned object's memory. Carries the pin
+/// token that keeps the object alive; the address stays valid until the token
+/// is passed back to `object_store_unpin_object`. On failure only the error
+/// fields are meaningful.
+pub struct RustPinnedObjectView {
+    success: bool,
+    error_code: u8,
+    error_message: String,
+    token: u64,
+    /// Address of the data section, as an FFI-stable integer. The C++ side
+    /// casts it back to a byte pointer; metadata follows the data section.
+    address: usize,
+    data_size: usize,
+    metadata_size: usize,
+}
+
 // Plasma error codes (defined outside bridge for internal use)
 const PLASMA_ERROR_NONE: u8 = 0;
 const PLASMA_ERROR_OBJECT_EXISTS: u8 = 1;
@@ -85,6 +101,7 @@ mod ffi {
         type RustPlasmaResult;
         type RustObjectStoreStats;
         type RustLRUCache;
+        type RustPinnedObjectView;
 
         // ObjectStore creation
         fn object_store_new(capacity: usize) -> Box<RustObjectStore>;
@@ -138,6 +155,24 @@ mod ffi {
 
         fn object_store_evict(store: &RustObjectStore, bytes_needed: usize) -> usize;
 
+        // Borrowed-buffer protocol: pin an object and get a zero-copy view of
+        // its memory; unpin with the view's token when done.
+        fn object_store_pin_object(
+            store: &RustObjectStore,
+            object_id_bytes: &[u8],
+        ) -> Box<RustPinnedObjectView>;
+        fn object_store_unpin_object(store: &RustObjectStore, token: u64)
+            -> Box<RustPlasmaResult>;
+
+        // RustPinnedObjectView accessors
+        fn pinned_view_success(view: &RustPinnedObjectView) -> bool;
+        fn pinned_view_error_code(view: &RustPinnedObjectView) -> u8;
+        fn pinned_view_error_message(view: &RustPinnedObjectView) -> &str;
+        fn pinned_view_token(view: &RustPinnedObjectView) -> u64;
+        fn pinned_view_address(view: &RustPinnedObjectView) -> usize;
+        fn pinned_view_data_size(view: &RustPinnedObjectView) -> usize;
+        fn pinned_view_metadata_size(view: &RustPinnedObjectView) -> usize;
+
         // Stats
         fn object_store_get_stats(store: &RustObjectStore) -> Box<RustObjectStoreStats>;
 
@@ -348,6 +383,65 @@ fn object_store_evict(store: &RustObjectStore, bytes_needed: usize) -> usize {
     store.inner.evict(bytes_needed).unwrap_or(0)
 }
 
+fn object_store_pin_object(
+    store: &RustObjectStore,
+    object_id_bytes: &[u8],
+) -> Box<RustPinnedObjectView> {
+    let object_id = bytes_to_object_id(object_id_bytes);
+    match store.inner.pin_object(&object_id) {
+        Ok(view) => Box::new(RustPinnedObjectView {
+            success: true,
+            error_code: PLASMA_ERROR_NONE,
+            error_message: String::new(),
+            token: view.token,
+            address: view.address as usize,
+            data_size: view.data_size,
+            metadata_size: view.metadata_size,
+        }),
+        Err(err) => Box::new(RustPinnedObjectView {
+            success: false,
+            error_code: plasma_error_to_code(&err),
+            error_message: err.to_string(),
+            token: 0,
+            address: 0,
+            data_size: 0,
+            metadata_size: 0,
+        }),
+    }
+}
+
+fn object_store_unpin_object(store: &RustObjectStore, token: u64) -> Box<RustPlasmaResult> {
+    make_result(store.inner.unpin_object(token))
+}
+
+fn pinned_view_success(view: &RustPinnedObjectView) -> bool {
+    view.success
+}
+
+fn pinned_view_error_code(view: &RustPinnedObjectView) -> u8 {
+    view.error_code
+}
+
+fn pinned_view_error_message(view: &RustPinnedObjectView) -> &str {
+    &view.error_message
+}
+
+fn pinned_view_token(view: &RustPinnedObjectView) -> u64 {
+    view.token
+}
+
+fn pinned_view_address(view: &RustPinnedObjectView) -> usize {
+    view.address
+}
+
+fn pinned_view_data_size(view: &RustPinnedObjectView) -> usize {
+    view.data_size
+}
+
+fn pinned_view_metadata_size(view: &RustPinnedObjectView) -> usize {
+    view.metadata_size
+}
+
 fn object_store_get_stats(store: &RustObjectStore) -> Box<RustObjectStoreStats> {
     let stats = store.inner.stats();
     Box::new(RustObjectStoreStats {
@@ -25,7 +25,7 @@ pub use plasma::common::{
     Allocation, LocalObject, ObjectInfo, ObjectSource, ObjectState, PlasmaError,
     PlasmaObjectHeader, PlasmaResult,
 };
-pub use plasma::store::{ObjectRef, ObjectStore, ObjectStoreConfig, ObjectStoreStats};
+pub use plasma::store::{ObjectDataView, ObjectRef, ObjectStore, ObjectStoreConfig, ObjectStoreStats};
 pub use plasma::eviction::{EvictionPolicy, LRUCache};
 pub use plasma::stats::ObjectStatsCollector;
 pub use plasma::lifecycle::ObjectLifecycleManager;
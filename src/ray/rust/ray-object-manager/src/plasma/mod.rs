@@ -31,7 +31,7 @@ pub use common::{
 pub use allocator::{Allocator, AllocatorStats, HeapAllocator, NullAllocator, PlasmaAllocator};
 
 // Re-export types from store
-pub use store::{ObjectRef, ObjectStore, ObjectStoreConfig, ObjectStoreStats};
+pub use store::{ObjectDataView, ObjectRef, ObjectStore, ObjectStoreConfig, ObjectStoreStats};
 
 // Re-export types from eviction
 pub use eviction::{AllocatorView, EvictionPolicy, LRUCache, LRUEvictionPolicy, ObjectStoreView};
@@ -0,0 +1,55 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/stats/contention_metrics.h"
+
+#include "ray/stats/metric.h"
+#include "ray/util/contention_profiler.h"
+
+namespace ray {
+namespace stats {
+
+void RecordContentionMetrics() {
+  auto &profiler = ContentionProfiler::instance();
+  if (!profiler.IsEnabled()) {
+    return;
+  }
+  // Created on first use so processes that never enable the profiler don't
+  // register the views.
+  static auto *lock_wait_time_gauge = new Gauge(
+      /*name=*/"lock_wait_time_ms",
+      /*description=*/
+      "Sampled cumulative time callers spent waiting to acquire profiled "
+      "locks, broken per call site.",
+      /*unit=*/"ms",
+      /*tag_keys=*/{"CallSite"});
+  static auto *lock_wait_samples_gauge = new Gauge(
+      /*name=*/"lock_wait_samples",
+      /*description=*/
+      "Number of sampled acquisitions of profiled locks, broken per call "
+      "site.",
+      /*unit=*/"",
+      /*tag_keys=*/{"CallSite"});
+
+  profiler.FlushThreadLocal();
+  for (const auto &[site_name, site_stats] : profiler.GetStats()) {
+    lock_wait_time_gauge->Record(static_cast<double>(site_stats.total_wait_ns) / 1e6,
+                                 {{"CallSite", site_name}});
+    lock_wait_samples_gauge->Record(static_cast<double>(site_stats.num_samples),
+                                    {{"CallSite", site_name}});
+  }
+}
+
+}  // namespace stats
+}  // namespace ray
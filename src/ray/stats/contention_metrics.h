@@ -0,0 +1,26 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace ray {
+namespace stats {
+
+/// Record the sampled lock wait times collected by ray::ContentionProfiler as
+/// call-site tagged metrics. No-op while the profiler is disabled. Intended
+/// to be called from a periodic metrics-recording loop.
+void RecordContentionMetrics();
+
+}  // namespace stats
+}  // namespace ray
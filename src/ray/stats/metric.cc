@@ -14,7 +14,10 @@
 
 #include "ray/stats/metric.h"
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "opencensus/stats/measure_registry.h"
 
@@ -40,6 +43,60 @@ void RegisterAsView(opencensus::stats::ViewDescriptor view_descriptor,
 }
 
 }  // namespace internal
+
+namespace {
+
+/// Number of buffered observations between flush-interval checks, so the
+/// record hot path doesn't read the clock per observation.
+constexpr int64_t kPreAggregationFlushCheckPeriod = 64;
+
+/// One thread-local pre-aggregation cell: the running sum of all buffered
+/// observations of one additive metric under one tag set.
+struct AdditiveMetricCell {
+  Metric *metric = nullptr;
+  TagsType tags;
+  double sum = 0.0;
+};
+
+/// Per-thread buffer of pre-aggregation cells. The destructor flushes so
+/// exiting threads don't lose buffered observations.
+struct PreAggregationBuffer {
+  absl::flat_hash_map<std::string, AdditiveMetricCell> cells;
+  int64_t records_until_flush_check = kPreAggregationFlushCheckPeriod;
+  std::chrono::steady_clock::time_point last_flush = std::chrono::steady_clock::now();
+
+  ~PreAggregationBuffer() { Flush(); }
+
+  void Flush() {
+    for (auto &[cell_key, cell] : cells) {
+      cell.metric->RecordDirect(cell.sum, std::move(cell.tags));
+    }
+    cells.clear();
+    records_until_flush_check = kPreAggregationFlushCheckPeriod;
+    last_flush = std::chrono::steady_clock::now();
+  }
+};
+
+PreAggregationBuffer &GetPreAggregationBuffer() {
+  static thread_local PreAggregationBuffer buffer;
+  return buffer;
+}
+
+std::string CellKey(const std::string &name, const TagsType &tags) {
+  std::string cell_key = name;
+  for (const auto &tag : tags) {
+    cell_key += '\x1f';
+    cell_key += tag.first.name();
+    cell_key += '\x1f';
+    cell_key += tag.second;
+  }
+  return cell_key;
+}
+
+}  // namespace
+
+void FlushThreadLocalMetrics() { GetPreAggregationBuffer().Flush(); }
+
 ///
 /// Stats Config
 ///
@@ -113,6 +170,40 @@ void Metric::Record(double value, TagsType tags) {
     return;
   }
 
+  // Additive metrics can fold high-rate observations into thread-local cells
+  // and flush on interval instead of paying the recorder's tag
+  // materialization and global lock per observation. Only the OpenTelemetry
+  // backend is value-additive for both Count and Sum, so the opencensus path
+  // always records directly.
+  if (::RayConfig::instance().metric_preaggregation_enabled() && IsAdditive() &&
+      ::RayConfig::instance().enable_open_telemetry()) {
+    RecordPreAggregated(value, std::move(tags));
+    return;
+  }
+
+  RecordDirect(value, std::move(tags));
+}
+
+void Metric::RecordPreAggregated(double value, TagsType tags) {
+  auto &buffer = GetPreAggregationBuffer();
+  auto [it, inserted] = buffer.cells.try_emplace(CellKey(name_, tags));
+  auto &cell = it->second;
+  if (inserted) {
+    cell.metric = this;
+    cell.tags = std::move(tags);
+  }
+  cell.sum += value;
+  if (--buffer.records_until_flush_check <= 0) {
+    buffer.records_until_flush_check = kPreAggregationFlushCheckPeriod;
+    const auto flush_interval = std::chrono::milliseconds(
+        ::RayConfig::instance().metric_preaggregation_flush_interval_ms());
+    if (std::chrono::steady_clock::now() - buffer.last_flush >= flush_interval) {
+      buffer.Flush();
+    }
+  }
+}
+
+void Metric::RecordDirect(double value, TagsType tags) {
   if (::RayConfig::instance().enable_open_telemetry()) {
     // Collect tags from both the metric-specific tags and the global tags.
     absl::flat_hash_map<std::string, std::string> open_telemetry_tags;
@@ -122,10 +122,21 @@ class Metric : public observability::MetricInterface {
 
   /// Record the value for this metric.
   ///
+  /// Additive metrics (Count, Sum) may buffer the observation in a
+  /// thread-local pre-aggregation cell instead of recording it immediately;
+  /// see metric_preaggregation_enabled.
+  ///
   /// \param value The value that we record.
   /// \param tags The tag values that we want to record for this metric record.
   void Record(double value, TagsType tags) override;
 
+  /// Record the value for this metric immediately, bypassing thread-local
+  /// pre-aggregation.
+  ///
+  /// \param value The value that we record.
+  /// \param tags The tag values that we want to record for this metric record.
+  void RecordDirect(double value, TagsType tags);
+
   /// Record the value for this metric.
   ///
   /// \param value The value that we record.
@@ -142,6 +153,16 @@ class Metric : public observability::MetricInterface {
   virtual void RegisterView() = 0;
   virtual void RegisterOpenTelemetryMetric() = 0;
 
+  /// Whether summing buffered observations of this metric preserves its
+  /// semantics. True for Count and Sum, whose OpenTelemetry instruments add
+  /// the recorded value.
+  virtual bool IsAdditive() const { return false; }
+
+ private:
+  /// Fold the observation into the calling thread's pre-aggregation cell for
+  /// this metric and tag set, flushing the thread's cells on interval.
+  void RecordPreAggregated(double value, TagsType tags);
+
  protected:
   std::string name_;
   std::string description_;
@@ -211,6 +232,7 @@ class Count : public Metric {
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
+  bool IsAdditive() const override { return true; }
 
 };  // class Count
 
@@ -229,9 +251,15 @@ class Sum : public Metric {
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
+  bool IsAdditive() const override { return true; }
 
 };  // class Sum
 
+/// Flush any observations buffered in the calling thread's pre-aggregation
+/// cells. Flushing also happens automatically on interval and at thread exit;
+/// this is exposed for shutdown paths and tests.
+void FlushThreadLocalMetrics();
+
 enum StatsType : uint8_t { COUNT, SUM, GAUGE, HISTOGRAM };
 
 namespace internal {
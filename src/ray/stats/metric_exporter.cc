@@ -16,6 +16,8 @@
 
 #include <string_view>
 
+#include "ray/common/ray_config.h"
+
 namespace ray {
 namespace stats {
 
@@ -112,6 +114,83 @@ void OpenCensusProtoExporter::SendData(const rpc::ReportOCMetricsRequest &reques
   RAY_LOG(DEBUG) << "Exporting metrics, metrics: " << request.metrics_size()
                  << ", payload size: " << request.ByteSizeLong();
   absl::MutexLock l(&mu_);
+  if (::RayConfig::instance().metrics_shared_memory_export_enabled() &&
+      EnsureShmWriter()) {
+    // Scalar series go through the shared-memory lane; only what the segment
+    // can't represent is sent over gRPC.
+    rpc::ReportOCMetricsRequest remainder = createRequestProtoPayload();
+    PublishToSharedMemory(request, remainder);
+    if (remainder.metrics_size() > 0) {
+      SendDataViaGrpc(remainder);
+    }
+    return;
+  }
+  SendDataViaGrpc(request);
+}
+
+bool OpenCensusProtoExporter::EnsureShmWriter() {
+  if (!shm_writer_init_attempted_) {
+    shm_writer_init_attempted_ = true;
+    shm_writer_ = ShmMetricsWriter::Create(
+        "/ray_metrics_" + worker_id_.Hex(),
+        static_cast<size_t>(::RayConfig::instance().metrics_shared_memory_max_cells()));
+    if (shm_writer_ == nullptr) {
+      RAY_LOG(WARNING) << "Shared-memory metrics segment unavailable; metrics will be "
+                          "reported over gRPC.";
+    }
+  }
+  return shm_writer_ != nullptr;
+}
+
+void OpenCensusProtoExporter::PublishToSharedMemory(
+    const rpc::ReportOCMetricsRequest &request, rpc::ReportOCMetricsRequest &remainder) {
+  size_t num_unrepresentable_series = 0;
+  for (const auto &metric : request.metrics()) {
+    // Each view has a single aggregation, so the first point decides for the
+    // whole metric: distributions can't be folded into a scalar cell and go
+    // over gRPC unchanged.
+    if (metric.timeseries_size() > 0 && metric.timeseries(0).points_size() > 0 &&
+        metric.timeseries(0).points(0).has_distribution_value()) {
+      *remainder.add_metrics() = metric;
+      continue;
+    }
+    const auto &descriptor = metric.metric_descriptor();
+    for (const auto &timeseries : metric.timeseries()) {
+      if (timeseries.points_size() == 0) {
+        continue;
+      }
+      const auto &point = timeseries.points(timeseries.points_size() - 1);
+      double value = 0;
+      if (point.has_int64_value()) {
+        value = static_cast<double>(point.int64_value());
+      } else {
+        value = point.double_value();
+      }
+      std::string tags;
+      for (int i = 0;
+           i < descriptor.label_keys_size() && i < timeseries.label_values_size();
+           i++) {
+        if (!tags.empty()) {
+          tags.push_back(',');
+        }
+        tags.append(descriptor.label_keys(i).key());
+        tags.push_back('=');
+        tags.append(timeseries.label_values(i).value());
+      }
+      if (!shm_writer_->Publish(descriptor.name(), tags, value)) {
+        num_unrepresentable_series++;
+      }
+    }
+  }
+  if (num_unrepresentable_series > 0) {
+    RAY_LOG_EVERY_N(WARNING, 10000)
+        << "Dropped " << num_unrepresentable_series
+        << " time-series that don't fit the shared-memory metrics segment; consider "
+           "raising metrics_shared_memory_max_cells.";
+  }
+}
+
+void OpenCensusProtoExporter::SendDataViaGrpc(const rpc::ReportOCMetricsRequest &request) {
   if (client_ == nullptr) {
     RAY_LOG_EVERY_N(WARNING, 10000)
         << "Metrics agent client is not connected yet. Dropping metrics.";
@@ -21,6 +21,7 @@
 #include "ray/common/asio/instrumented_io_context.h"
 #include "ray/common/id.h"
 #include "ray/rpc/metrics_agent_client.h"
+#include "ray/stats/shm_metrics_segment.h"
 
 namespace ray {
 namespace stats {
@@ -120,6 +121,22 @@ class OpenCensusProtoExporter final : public opencensus::stats::StatsExporter::H
   void addGlobalTagsToGrpcMetric(opencensus::proto::metrics::v1::Metric &metric);
 
  private:
+  /// Sends the request to the metrics agent over gRPC.
+  void SendDataViaGrpc(const rpc::ReportOCMetricsRequest &request)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// Lazily creates the shared-memory metrics segment on first use. Returns
+  /// false (permanently, once creation has failed) when the segment is
+  /// unavailable and gRPC should be used instead.
+  bool EnsureShmWriter() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  /// Publishes the scalar time-series of the request into the shared-memory
+  /// segment and copies the metrics it can't represent there (distributions,
+  /// series that don't fit a cell) into `remainder` for the gRPC path.
+  void PublishToSharedMemory(const rpc::ReportOCMetricsRequest &request,
+                             rpc::ReportOCMetricsRequest &remainder)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   /// Lock to protect the client
   mutable absl::Mutex mu_;
   /// IO service for async operations
@@ -136,6 +153,12 @@ class OpenCensusProtoExporter final : public opencensus::stats::StatsExporter::H
   /// gRPC max message size set by an agent (usually calculated as 95% of agent's gRPC
   /// max-message size)
   size_t proto_payload_size_threshold_bytes_;
+  /// Shared-memory fast lane to the on-node agent; nullptr until the first
+  /// successful EnsureShmWriter() call.
+  std::unique_ptr<ShmMetricsWriter> shm_writer_ ABSL_GUARDED_BY(&mu_);
+  /// Set once segment creation has been attempted so a failure doesn't retry
+  /// on every report.
+  bool shm_writer_init_attempted_ ABSL_GUARDED_BY(&mu_) = false;
 };
 
 }  // namespace stats
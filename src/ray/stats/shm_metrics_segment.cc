@@ -0,0 +1,251 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/stats/shm_metrics_segment.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ray/util/logging.h"
+
+namespace ray {
+namespace stats {
+
+namespace {
+
+constexpr uint64_t kShmMetricsSegmentMagic = 0x5261794d65747234;  // "RayMetr4"
+constexpr uint32_t kShmMetricsSegmentVersion = 1;
+
+// Segment layout: one header followed by num_cells cells.
+struct ShmMetricsSegmentHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t num_cells;
+  // Bumped (release) after every completed Publish(); readers use this as a
+  // liveness/progress heartbeat.
+  std::atomic<uint64_t> num_publishes;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "seqlocks in shared memory require lock-free 64-bit atomics");
+
+ShmMetricsSegmentHeader *SegmentHeader(void *base) {
+  return static_cast<ShmMetricsSegmentHeader *>(base);
+}
+
+ShmMetricCell *SegmentCells(void *base) {
+  return reinterpret_cast<ShmMetricCell *>(static_cast<char *>(base) +
+                                           sizeof(ShmMetricsSegmentHeader));
+}
+
+size_t SegmentLength(size_t num_cells) {
+  return sizeof(ShmMetricsSegmentHeader) + num_cells * sizeof(ShmMetricCell);
+}
+
+std::string SeriesKey(const std::string &name, const std::string &tags) {
+  std::string key;
+  key.reserve(name.size() + 1 + tags.size());
+  key.append(name);
+  key.push_back('\x1f');
+  key.append(tags);
+  return key;
+}
+
+}  // namespace
+
+ShmMetricsWriter::ShmMetricsWriter(std::string segment_name,
+                                   void *base,
+                                   size_t length,
+                                   size_t num_cells)
+    : segment_name_(std::move(segment_name)),
+      base_(base),
+      length_(length),
+      num_cells_(num_cells) {}
+
+std::unique_ptr<ShmMetricsWriter> ShmMetricsWriter::Create(
+    const std::string &segment_name, size_t num_cells) {
+#ifdef _WIN32
+  RAY_LOG(DEBUG) << "Shared-memory metrics segments are not supported on Windows.";
+  return nullptr;
+#else
+  if (num_cells == 0) {
+    return nullptr;
+  }
+  // Remove any segment left behind by a previous process with the same name
+  // (e.g. after a crash); readers attach by name and must see this writer's
+  // table.
+  shm_unlink(segment_name.c_str());
+  int fd = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    RAY_LOG(WARNING) << "Failed to create shared-memory metrics segment "
+                     << segment_name << ": " << strerror(errno);
+    return nullptr;
+  }
+  const size_t length = SegmentLength(num_cells);
+  if (ftruncate(fd, static_cast<off_t>(length)) != 0) {
+    RAY_LOG(WARNING) << "Failed to size shared-memory metrics segment " << segment_name
+                     << " to " << length << " bytes: " << strerror(errno);
+    close(fd);
+    shm_unlink(segment_name.c_str());
+    return nullptr;
+  }
+  void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    RAY_LOG(WARNING) << "Failed to map shared-memory metrics segment " << segment_name
+                     << ": " << strerror(errno);
+    shm_unlink(segment_name.c_str());
+    return nullptr;
+  }
+  // ftruncate zero-fills, so all cell sequences already read as 0 (unassigned).
+  // Publish the header last so readers never see a valid magic with a
+  // half-initialized header.
+  auto *header = SegmentHeader(base);
+  header->version = kShmMetricsSegmentVersion;
+  header->num_cells = static_cast<uint32_t>(num_cells);
+  header->num_publishes.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kShmMetricsSegmentMagic;
+  return std::unique_ptr<ShmMetricsWriter>(
+      new ShmMetricsWriter(segment_name, base, length, num_cells));
+#endif
+}
+
+ShmMetricsWriter::~ShmMetricsWriter() {
+#ifndef _WIN32
+  munmap(base_, length_);
+  shm_unlink(segment_name_.c_str());
+#endif
+}
+
+bool ShmMetricsWriter::Publish(const std::string &name,
+                               const std::string &tags,
+                               double value) {
+  if (name.size() >= kShmMetricNameCapacity || tags.size() >= kShmMetricTagsCapacity) {
+    return false;
+  }
+  auto [it, inserted] = cell_index_by_key_.try_emplace(SeriesKey(name, tags),
+                                                       cell_index_by_key_.size());
+  if (inserted && it->second >= num_cells_) {
+    cell_index_by_key_.erase(it);
+    return false;
+  }
+  ShmMetricCell &cell = SegmentCells(base_)[it->second];
+  const uint64_t seq = cell.sequence.load(std::memory_order_relaxed);
+  // Seqlock write: mark the cell busy (odd), update the payload, then publish
+  // the new sequence so readers can detect torn reads.
+  cell.sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  if (inserted) {
+    strncpy(cell.name, name.c_str(), kShmMetricNameCapacity);
+    strncpy(cell.tags, tags.c_str(), kShmMetricTagsCapacity);
+  }
+  cell.value = value;
+  cell.sequence.store(seq + 2, std::memory_order_release);
+  SegmentHeader(base_)->num_publishes.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+ShmMetricsReader::ShmMetricsReader(void *base, size_t length, size_t num_cells)
+    : base_(base), length_(length), num_cells_(num_cells) {}
+
+std::unique_ptr<ShmMetricsReader> ShmMetricsReader::Attach(
+    const std::string &segment_name) {
+#ifdef _WIN32
+  return nullptr;
+#else
+  int fd = shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShmMetricsSegmentHeader)) {
+    close(fd);
+    return nullptr;
+  }
+  const size_t length = static_cast<size_t>(st.st_size);
+  void *base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  const auto *header = SegmentHeader(base);
+  if (header->magic != kShmMetricsSegmentMagic ||
+      header->version != kShmMetricsSegmentVersion ||
+      length < SegmentLength(header->num_cells)) {
+    munmap(base, length);
+    return nullptr;
+  }
+  return std::unique_ptr<ShmMetricsReader>(
+      new ShmMetricsReader(base, length, header->num_cells));
+#endif
+}
+
+ShmMetricsReader::~ShmMetricsReader() {
+#ifndef _WIN32
+  munmap(base_, length_);
+#endif
+}
+
+std::vector<ShmMetricsSample> ShmMetricsReader::ReadAll() const {
+  std::vector<ShmMetricsSample> samples;
+  const ShmMetricCell *cells = SegmentCells(base_);
+  for (size_t i = 0; i < num_cells_; i++) {
+    const ShmMetricCell &cell = cells[i];
+    ShmMetricsSample sample;
+    while (true) {
+      const uint64_t seq_before = cell.sequence.load(std::memory_order_acquire);
+      if (seq_before == 0) {
+        // Unassigned cell; cells are assigned in order, so the rest are empty
+        // too.
+        return samples;
+      }
+      if ((seq_before & 1) != 0) {
+        // Writer is mid-update; retry.
+        continue;
+      }
+      char name[kShmMetricNameCapacity];
+      char tags[kShmMetricTagsCapacity];
+      memcpy(name, cell.name, kShmMetricNameCapacity);
+      memcpy(tags, cell.tags, kShmMetricTagsCapacity);
+      const double value = cell.value;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (cell.sequence.load(std::memory_order_relaxed) != seq_before) {
+        continue;
+      }
+      name[kShmMetricNameCapacity - 1] = '\0';
+      tags[kShmMetricTagsCapacity - 1] = '\0';
+      sample.name = name;
+      sample.tags = tags;
+      sample.value = value;
+      break;
+    }
+    samples.push_back(std::move(sample));
+  }
+  return samples;
+}
+
+uint64_t ShmMetricsReader::NumPublishes() const {
+  return SegmentHeader(base_)->num_publishes.load(std::memory_order_acquire);
+}
+
+}  // namespace stats
+}  // namespace ray
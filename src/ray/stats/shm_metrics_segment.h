@@ -0,0 +1,129 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+namespace ray {
+namespace stats {
+
+/// Shared-memory metrics segment.
+///
+/// A per-process POSIX shared-memory region holding a fixed table of metric
+/// cells. Each cell is one pre-aggregated time-series (metric name + tag set)
+/// and is updated in place with a seqlock, so the node agent can scrape the
+/// whole table without any RPC, serialization, or locks: the writer never
+/// blocks on the reader and vice versa.
+///
+/// The segment has a single writer (the owning process) and any number of
+/// readers. Cells are assigned to series on first publish and never recycled;
+/// publishing fails once the table is full, in which case callers should fall
+/// back to the gRPC metrics path.
+
+/// Capacity of the null-terminated metric name stored in a cell.
+inline constexpr size_t kShmMetricNameCapacity = 128;
+/// Capacity of the null-terminated, comma-separated "key=value" tag string
+/// stored in a cell.
+inline constexpr size_t kShmMetricTagsCapacity = 256;
+
+/// One time-series slot in the shared-memory segment. The layout is part of
+/// the segment format; bump kShmMetricsSegmentVersion when changing it.
+struct ShmMetricCell {
+  /// Seqlock sequence number; odd while the writer is updating the cell.
+  std::atomic<uint64_t> sequence;
+  char name[kShmMetricNameCapacity];
+  char tags[kShmMetricTagsCapacity];
+  double value;
+};
+
+/// A consistent snapshot of one cell, as returned to readers.
+struct ShmMetricsSample {
+  std::string name;
+  std::string tags;
+  double value;
+};
+
+/// Single-writer handle to a shared-memory metrics segment. Creates (and on
+/// destruction unlinks) the segment. Not internally synchronized: callers are
+/// expected to serialize Publish() calls, matching the one-exporter-per-process
+/// structure of the metrics pipeline.
+class ShmMetricsWriter {
+ public:
+  /// Creates the segment with the given name (must start with '/') and cell
+  /// count. Returns nullptr if shared memory is unavailable on this platform
+  /// or the segment cannot be created; callers should fall back to gRPC.
+  static std::unique_ptr<ShmMetricsWriter> Create(const std::string &segment_name,
+                                                  size_t num_cells);
+
+  ShmMetricsWriter(const ShmMetricsWriter &) = delete;
+  ShmMetricsWriter &operator=(const ShmMetricsWriter &) = delete;
+
+  ~ShmMetricsWriter();
+
+  /// Publishes one pre-aggregated value for the given series, assigning a cell
+  /// on first use. Returns false if the name or tag string doesn't fit in a
+  /// cell, or if the cell table is full.
+  bool Publish(const std::string &name, const std::string &tags, double value);
+
+  size_t num_cells() const { return num_cells_; }
+
+ private:
+  ShmMetricsWriter(std::string segment_name, void *base, size_t length, size_t num_cells);
+
+  std::string segment_name_;
+  void *base_;
+  size_t length_;
+  size_t num_cells_;
+  /// Cell assigned to each "name\x1ftags" series key.
+  absl::flat_hash_map<std::string, size_t> cell_index_by_key_;
+};
+
+/// Read-only handle to a shared-memory metrics segment owned by another
+/// process. Scrapes the cell table in place with seqlock retries.
+class ShmMetricsReader {
+ public:
+  /// Attaches to an existing segment. Returns nullptr if the segment doesn't
+  /// exist or its header doesn't match this format version.
+  static std::unique_ptr<ShmMetricsReader> Attach(const std::string &segment_name);
+
+  ShmMetricsReader(const ShmMetricsReader &) = delete;
+  ShmMetricsReader &operator=(const ShmMetricsReader &) = delete;
+
+  ~ShmMetricsReader();
+
+  /// Returns a consistent snapshot of every assigned cell.
+  std::vector<ShmMetricsSample> ReadAll() const;
+
+  /// Number of Publish() calls the writer has completed; a stalled value tells
+  /// the reader the writer is gone or idle.
+  uint64_t NumPublishes() const;
+
+ private:
+  ShmMetricsReader(void *base, size_t length, size_t num_cells);
+
+  void *base_;
+  size_t length_;
+  size_t num_cells_;
+};
+
+}  // namespace stats
+}  // namespace ray
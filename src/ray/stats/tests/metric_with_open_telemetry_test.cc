@@ -63,13 +63,18 @@ class MetricTest : public ::testing::Test {
       const std::string &name,
       const absl::flat_hash_map<std::string, std::string> &tags) {
     auto &recorder = OpenTelemetryMetricRecorder::GetInstance();
-    std::lock_guard<std::mutex> lock(recorder.mutex_);
-    auto it = recorder.observations_by_name_.find(name);
-    if (it == recorder.observations_by_name_.end()) {
-      return std::nullopt;  // Not registered
+    OpenTelemetryMetricRecorder::GaugeObservations *observations = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(recorder.mutex_);
+      auto it = recorder.observations_by_name_.find(name);
+      if (it == recorder.observations_by_name_.end()) {
+        return std::nullopt;  // Not registered
+      }
+      observations = it->second.get();
     }
-    auto tag_it = it->second.find(tags);
-    if (tag_it != it->second.end()) {
+    std::lock_guard<std::mutex> lock(observations->mutex);
+    auto tag_it = observations->points.find(tags);
+    if (tag_it != observations->points.end()) {
       return tag_it->second;  // Get the value
     }
     return std::nullopt;
@@ -94,6 +99,21 @@ TEST_F(MetricTest, TestSumMetric) {
       OpenTelemetryMetricRecorder::GetInstance().IsMetricRegistered("metric_sum_test"));
 }
 
+TEST_F(MetricTest, TestPreAggregatedCounterMetric) {
+  // With pre-aggregation enabled, observations are buffered in thread-local
+  // cells and only hit the recorder on flush. As above, counter values can't
+  // be read back through open telemetry, so this checks the buffered path and
+  // the explicit flush don't crash.
+  RayConfig::instance().initialize(R"({"metric_preaggregation_enabled": true})");
+  for (int i = 0; i < 10; i++) {
+    MetricCounterTest.Record(1.0, {{"Tag1"sv, "Value1"}, {"Tag2"sv, "Value2"}});
+  }
+  ray::stats::FlushThreadLocalMetrics();
+  ASSERT_TRUE(OpenTelemetryMetricRecorder::GetInstance().IsMetricRegistered(
+      "metric_counter_test"));
+  RayConfig::instance().initialize(R"({"metric_preaggregation_enabled": false})");
+}
+
 TEST_F(MetricTest, TestHistogramMetric) {
   // We only test that recording is not crashing. The actual value is not checked
   // because open telemetry does not provide a way to retrieve the value of a counter.
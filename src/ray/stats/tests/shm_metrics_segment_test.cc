@@ -0,0 +1,113 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/stats/shm_metrics_segment.h"
+
+#include <unistd.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace ray {
+namespace stats {
+
+namespace {
+
+// Segments are named per test and per process so concurrent test runs on the
+// same machine don't collide.
+std::string TestSegmentName(const std::string &suffix) {
+  return "/ray_metrics_test_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+}  // namespace
+
+TEST(ShmMetricsSegmentTest, TestWriteAndReadBack) {
+  const std::string segment_name = TestSegmentName("round_trip");
+  auto writer = ShmMetricsWriter::Create(segment_name, /*num_cells=*/16);
+  ASSERT_NE(writer, nullptr);
+
+  ASSERT_TRUE(writer->Publish("tasks_finished", "JobId=1", 10.0));
+  ASSERT_TRUE(writer->Publish("tasks_finished", "JobId=2", 20.0));
+  ASSERT_TRUE(writer->Publish("cpu_usage", "", 0.5));
+
+  auto reader = ShmMetricsReader::Attach(segment_name);
+  ASSERT_NE(reader, nullptr);
+  auto samples = reader->ReadAll();
+  ASSERT_EQ(samples.size(), 3);
+  EXPECT_EQ(samples[0].name, "tasks_finished");
+  EXPECT_EQ(samples[0].tags, "JobId=1");
+  EXPECT_EQ(samples[0].value, 10.0);
+  EXPECT_EQ(samples[1].tags, "JobId=2");
+  EXPECT_EQ(samples[2].name, "cpu_usage");
+  EXPECT_EQ(samples[2].tags, "");
+  EXPECT_EQ(samples[2].value, 0.5);
+  EXPECT_EQ(reader->NumPublishes(), 3);
+
+  // Updating an existing series reuses its cell; the reader sees the new value
+  // in place.
+  ASSERT_TRUE(writer->Publish("tasks_finished", "JobId=1", 11.0));
+  samples = reader->ReadAll();
+  ASSERT_EQ(samples.size(), 3);
+  EXPECT_EQ(samples[0].value, 11.0);
+  EXPECT_EQ(reader->NumPublishes(), 4);
+}
+
+TEST(ShmMetricsSegmentTest, TestCellTableFull) {
+  const std::string segment_name = TestSegmentName("full");
+  auto writer = ShmMetricsWriter::Create(segment_name, /*num_cells=*/2);
+  ASSERT_NE(writer, nullptr);
+
+  ASSERT_TRUE(writer->Publish("metric_a", "", 1.0));
+  ASSERT_TRUE(writer->Publish("metric_b", "", 2.0));
+  // A third distinct series doesn't fit; already-assigned series still update.
+  ASSERT_FALSE(writer->Publish("metric_c", "", 3.0));
+  ASSERT_TRUE(writer->Publish("metric_a", "", 4.0));
+
+  auto reader = ShmMetricsReader::Attach(segment_name);
+  ASSERT_NE(reader, nullptr);
+  auto samples = reader->ReadAll();
+  ASSERT_EQ(samples.size(), 2);
+  EXPECT_EQ(samples[0].value, 4.0);
+  EXPECT_EQ(samples[1].value, 2.0);
+}
+
+TEST(ShmMetricsSegmentTest, TestOversizedSeriesRejected) {
+  const std::string segment_name = TestSegmentName("oversized");
+  auto writer = ShmMetricsWriter::Create(segment_name, /*num_cells=*/2);
+  ASSERT_NE(writer, nullptr);
+
+  ASSERT_FALSE(writer->Publish(std::string(kShmMetricNameCapacity, 'a'), "", 1.0));
+  ASSERT_FALSE(writer->Publish("metric", std::string(kShmMetricTagsCapacity, 't'), 1.0));
+  // Rejected series don't consume cells.
+  ASSERT_TRUE(writer->Publish("metric_a", "", 1.0));
+  ASSERT_TRUE(writer->Publish("metric_b", "", 2.0));
+}
+
+TEST(ShmMetricsSegmentTest, TestAttachToMissingSegment) {
+  ASSERT_EQ(ShmMetricsReader::Attach(TestSegmentName("missing")), nullptr);
+}
+
+TEST(ShmMetricsSegmentTest, TestSegmentUnlinkedOnWriterDestruction) {
+  const std::string segment_name = TestSegmentName("unlinked");
+  {
+    auto writer = ShmMetricsWriter::Create(segment_name, /*num_cells=*/2);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(ShmMetricsReader::Attach(segment_name), nullptr);
+  }
+  ASSERT_EQ(ShmMetricsReader::Attach(segment_name), nullptr);
+}
+
+}  // namespace stats
+}  // namespace ray
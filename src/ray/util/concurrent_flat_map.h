@@ -14,16 +14,31 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/span.h"
 #include "ray/util/mutex_protected.h"
 
 namespace ray {
 
-// A flat map that's protected by a single mutex with read/write locks.
+// A flat map protected by read/write locks, optionally sharded by key hash so
+// that a long read of one shard (e.g. a full clone) doesn't block writes to the
+// others.
+//
+// With the default single shard every operation locks the whole map, as before.
+// With multiple shards, per-key operations lock only the owning shard, and
+// whole-map operations (ReadVisitAll, GetMapClone) as well as multi-key
+// operations lock one shard at a time; they are consistent per shard but are
+// not an atomic snapshot of the full map, and visit keys in shard order rather
+// than argument order.
 //
 // Use when expecting one of the following:
 // - mininal thread contention
@@ -33,20 +48,28 @@ namespace ray {
 template <typename KeyType, typename ValueType>
 class ConcurrentFlatMap {
  public:
-  template <typename... Args>
-  explicit ConcurrentFlatMap(Args &&...args) : map_(std::forward(args)...) {}
+  explicit ConcurrentFlatMap(size_t num_shards) {
+    num_shards = std::max<size_t>(num_shards, 1);
+    shards_.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; i++) {
+      shards_.push_back(std::make_unique<MutexProtected<Map>>());
+    }
+  }
 
-  ConcurrentFlatMap() = default;
+  ConcurrentFlatMap() : ConcurrentFlatMap(1) {}
 
   void Reserve(size_t size) {
-    auto write_lock = map_.LockForWrite();
-    write_lock.Get().reserve(size);
+    const size_t size_per_shard = size / shards_.size() + 1;
+    for (auto &shard : shards_) {
+      auto write_lock = shard->LockForWrite();
+      write_lock.Get().reserve(size_per_shard);
+    }
   }
 
   template <typename KeyLike>
   std::optional<ValueType> Get(const KeyLike &key) const {
     std::optional<ValueType> result;
-    auto read_lock = map_.LockForRead();
+    auto read_lock = GetShard(key).LockForRead();
     const auto &map = read_lock.Get();
     const auto it = map.find(key);
     if (it != map.end()) {
@@ -60,12 +83,18 @@ class ConcurrentFlatMap {
   // followed by InsertOrAssign.
   template <typename KeyLike, typename Visitor>
   void WriteVisit(absl::Span<KeyLike> keys, const Visitor &visitor) {
-    auto write_lock = map_.LockForWrite();
-    auto &map = write_lock.Get();
-    for (const auto &key : keys) {
-      auto it = map.find(key);
-      if (it != map.end()) {
-        visitor(it->first, it->second);
+    const auto keys_by_shard = GroupKeysByShard(keys);
+    for (size_t i = 0; i < shards_.size(); i++) {
+      if (keys_by_shard[i].empty()) {
+        continue;
+      }
+      auto write_lock = shards_[i]->LockForWrite();
+      auto &map = write_lock.Get();
+      for (const auto *key : keys_by_shard[i]) {
+        auto it = map.find(*key);
+        if (it != map.end()) {
+          visitor(it->first, it->second);
+        }
       }
     }
   }
@@ -75,12 +104,18 @@ class ConcurrentFlatMap {
   // out.
   template <typename KeyLike, typename Visitor>
   void ReadVisit(absl::Span<KeyLike> keys, const Visitor &visitor) const {
-    auto read_lock = map_.LockForRead();
-    const auto &map = read_lock.Get();
-    for (const auto &key : keys) {
-      auto it = map.find(key);
-      if (it != map.end()) {
-        visitor(it->first, it->second);
+    const auto keys_by_shard = GroupKeysByShard(keys);
+    for (size_t i = 0; i < shards_.size(); i++) {
+      if (keys_by_shard[i].empty()) {
+        continue;
+      }
+      auto read_lock = shards_[i]->LockForRead();
+      const auto &map = read_lock.Get();
+      for (const auto *key : keys_by_shard[i]) {
+        auto it = map.find(*key);
+        if (it != map.end()) {
+          visitor(it->first, it->second);
+        }
       }
     }
   }
@@ -89,16 +124,17 @@ class ConcurrentFlatMap {
   // Calls under read lock so should not be heavy, otherwise prefer GetMapClone to copy.
   template <typename Visitor>
   void ReadVisitAll(const Visitor &visitor) const {
-    auto read_lock = map_.LockForRead();
-    const auto &map = read_lock.Get();
-    for (const auto &[key, value] : map) {
-      visitor(key, value);
+    for (const auto &shard : shards_) {
+      auto read_lock = shard->LockForRead();
+      for (const auto &[key, value] : read_lock.Get()) {
+        visitor(key, value);
+      }
     }
   }
 
   template <typename KeyLike>
   bool Contains(const KeyLike &key) const {
-    auto read_lock = map_.LockForRead();
+    auto read_lock = GetShard(key).LockForRead();
     return read_lock.Get().contains(key);
   }
 
@@ -108,7 +144,7 @@ class ConcurrentFlatMap {
   template <typename KeyLike, typename... Args>
   bool InsertOrAssign(KeyLike &&key, Args &&...args) {
     auto value = ValueType(std::forward<Args>(args)...);
-    auto write_lock = map_.LockForWrite();
+    auto write_lock = GetShard(key).LockForWrite();
     auto [_, new_inserted] =
         write_lock.Get().insert_or_assign(std::forward<KeyLike>(key), std::move(value));
     return new_inserted;
@@ -119,7 +155,7 @@ class ConcurrentFlatMap {
   template <typename KeyLike, typename... Args>
   bool Emplace(KeyLike &&key, Args &&...args) {
     auto value = ValueType(std::forward<Args>(args)...);
-    auto write_lock = map_.LockForWrite();
+    auto write_lock = GetShard(key).LockForWrite();
     const auto [_, inserted] =
         write_lock.Get().emplace(std::forward<KeyLike>(key), std::move(value));
     return inserted;
@@ -128,30 +164,512 @@ class ConcurrentFlatMap {
   // Returns a bool identifying whether the key was found and erased.
   template <typename KeyLike>
   bool Erase(const KeyLike &key) {
-    auto write_lock = map_.LockForWrite();
+    auto write_lock = GetShard(key).LockForWrite();
     return write_lock.Get().erase(key) > 0;
   }
 
   // Returns the number of keys erased.
   template <typename KeyLike>
   int64_t EraseKeys(absl::Span<KeyLike> keys) {
-    auto write_lock = map_.LockForWrite();
-    auto &map = write_lock.Get();
+    const auto keys_by_shard = GroupKeysByShard(keys);
+    int64_t num_erased = 0;
+    for (size_t i = 0; i < shards_.size(); i++) {
+      if (keys_by_shard[i].empty()) {
+        continue;
+      }
+      auto write_lock = shards_[i]->LockForWrite();
+      auto &map = write_lock.Get();
+      for (const auto *key : keys_by_shard[i]) {
+        num_erased += map.erase(*key);
+      }
+    }
+    return num_erased;
+  }
+
+  // Returns a copy of the underlying flat_hash_map(s), merged. With multiple
+  // shards each shard is copied under its own read lock, one at a time.
+  absl::flat_hash_map<KeyType, ValueType> GetMapClone() const {
+    absl::flat_hash_map<KeyType, ValueType> result;
+    for (const auto &shard : shards_) {
+      auto read_lock = shard->LockForRead();
+      const auto &map = read_lock.Get();
+      result.insert(map.begin(), map.end());
+    }
+    return result;
+  }
+
+ private:
+  using Map = absl::flat_hash_map<KeyType, ValueType>;
+
+  // Uses the map's own (heterogeneous) hasher so that a KeyLike lands in the
+  // same shard as the KeyType it compares equal to.
+  template <typename KeyLike>
+  size_t GetShardIndex(const KeyLike &key) const {
+    return typename Map::hasher{}(key) % shards_.size();
+  }
+
+  template <typename KeyLike>
+  const MutexProtected<Map> &GetShard(const KeyLike &key) const {
+    return *shards_[GetShardIndex(key)];
+  }
+
+  template <typename KeyLike>
+  MutexProtected<Map> &GetShard(const KeyLike &key) {
+    return *shards_[GetShardIndex(key)];
+  }
+
+  // Groups pointers into `keys` by owning shard, preserving relative order
+  // within each shard.
+  template <typename KeyLike>
+  std::vector<std::vector<const KeyLike *>> GroupKeysByShard(
+      absl::Span<KeyLike> keys) const {
+    std::vector<std::vector<const KeyLike *>> keys_by_shard(shards_.size());
+    for (const auto &key : keys) {
+      keys_by_shard[GetShardIndex(key)].push_back(&key);
+    }
+    return keys_by_shard;
+  }
+
+  // unique_ptr because MutexProtected is neither copyable nor movable.
+  std::vector<std::unique_ptr<MutexProtected<Map>>> shards_;
+};
+
+namespace internal {
+
+// Epoch-based memory reclamation shared by all LockFreeConcurrentFlatMap
+// instances. Readers announce the global epoch they entered under; retired
+// objects are held in per-epoch limbo lists and only freed once the global
+// epoch has advanced far enough that no reader can still hold a reference.
+// The epoch can only advance when every active reader has caught up to it, so
+// a reader that entered before an object was retired always blocks its
+// reclamation.
+class EpochManager {
+ public:
+  static EpochManager &Instance() {
+    static auto *instance = new EpochManager();
+    return *instance;
+  }
+
+  // RAII guard marking the calling thread as an active reader. While any
+  // guard is alive on a thread, no object retired after the guard was created
+  // will be freed. Guards may nest.
+  class ReadGuard {
+   public:
+    ReadGuard() : slot_(LocalSlot()) {
+      if (slot_->nesting_depth++ == 0) {
+        auto &global_epoch = Instance().global_epoch_;
+        // Publish the epoch we are reading under. The announcement must be a
+        // seq_cst exchange, not a release store: release ordering alone lets
+        // the caller's chain loads run before the announcement is visible to
+        // a writer scanning slots in TryAdvanceEpoch, which could then
+        // advance past this reader and free a node it is about to follow.
+        // The re-read closes the second window: if this thread stalls between
+        // reading the epoch and announcing it, the epoch it announces may
+        // already have been retired, so loop until the announced epoch
+        // matches the current one.
+        uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+        while (true) {
+          slot_->epoch.exchange(epoch, std::memory_order_seq_cst);
+          const uint64_t current = global_epoch.load(std::memory_order_seq_cst);
+          if (current == epoch) {
+            break;
+          }
+          epoch = current;
+        }
+      }
+    }
+
+    ReadGuard(const ReadGuard &) = delete;
+    ReadGuard &operator=(const ReadGuard &) = delete;
+
+    ~ReadGuard() {
+      if (--slot_->nesting_depth == 0) {
+        slot_->epoch.store(kIdleEpoch, std::memory_order_release);
+      }
+    }
+
+   private:
+    struct ThreadSlot;
+
+    // Returns this thread's registered slot, claiming one on first use. Slots
+    // are pooled and returned on thread exit, so their count is bounded by the
+    // maximum number of concurrently live threads.
+    static ThreadSlot *LocalSlot() {
+      thread_local SlotHandle handle;
+      return handle.slot;
+    }
+
+    struct ThreadSlot {
+      std::atomic<uint64_t> epoch{kIdleEpoch};
+      // Only accessed by the owning thread.
+      int32_t nesting_depth = 0;
+    };
+
+    struct SlotHandle {
+      SlotHandle() : slot(Instance().ClaimSlot()) {}
+      ~SlotHandle() { Instance().ReleaseSlot(slot); }
+      ThreadSlot *slot;
+    };
+
+    ThreadSlot *slot_;
+
+    friend class EpochManager;
+  };
+
+  // Hand `object` over for deferred deletion via `deleter`. The object must
+  // already be unreachable for new readers.
+  void Retire(void *object, void (*deleter)(void *)) {
+    absl::MutexLock lock(&mutex_);
+    const uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+    auto &limbo = limbo_lists_[epoch % kNumLimboLists];
+    limbo.push_back(RetiredObject{object, deleter});
+    if (limbo.size() >= kRetireThreshold) {
+      TryAdvanceEpoch();
+    }
+  }
+
+ private:
+  static constexpr uint64_t kIdleEpoch = 0;
+  // Three lists rotate so that a list is only reused (and its contents freed)
+  // after two full epoch advances, by which point no reader from the retiring
+  // epoch can remain active.
+  static constexpr size_t kNumLimboLists = 3;
+  static constexpr size_t kRetireThreshold = 64;
+
+  struct RetiredObject {
+    void *object;
+    void (*deleter)(void *);
+  };
+
+  EpochManager() = default;
+
+  ReadGuard::ThreadSlot *ClaimSlot() {
+    absl::MutexLock lock(&mutex_);
+    if (!free_slots_.empty()) {
+      auto *slot = free_slots_.back();
+      free_slots_.pop_back();
+      return slot;
+    }
+    slots_.push_back(std::make_unique<ReadGuard::ThreadSlot>());
+    return slots_.back().get();
+  }
+
+  void ReleaseSlot(ReadGuard::ThreadSlot *slot) {
+    slot->epoch.store(kIdleEpoch, std::memory_order_release);
+    absl::MutexLock lock(&mutex_);
+    free_slots_.push_back(slot);
+  }
+
+  // Advance the global epoch and free the list from two epochs ago, if no
+  // active reader is still behind the current epoch.
+  void TryAdvanceEpoch() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    const uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+    // seq_cst pairs with the announcement in ReadGuard: either this scan sees
+    // a reader's announcement, or the reader's re-read of global_epoch_ sees
+    // the advance below and the reader re-announces.
+    for (const auto &slot : slots_) {
+      const uint64_t observed = slot->epoch.load(std::memory_order_seq_cst);
+      if (observed != kIdleEpoch && observed != epoch) {
+        return;
+      }
+    }
+    global_epoch_.store(epoch + 1, std::memory_order_seq_cst);
+    auto &reusable = limbo_lists_[(epoch + 1) % kNumLimboLists];
+    for (const auto &retired : reusable) {
+      retired.deleter(retired.object);
+    }
+    reusable.clear();
+  }
+
+  // Starts above kIdleEpoch so an idle slot is never mistaken for an active
+  // reader of the current epoch.
+  std::atomic<uint64_t> global_epoch_{1};
+
+  absl::Mutex mutex_;
+  std::vector<std::unique_ptr<ReadGuard::ThreadSlot>> slots_ ABSL_GUARDED_BY(mutex_);
+  std::vector<ReadGuard::ThreadSlot *> free_slots_ ABSL_GUARDED_BY(mutex_);
+  std::vector<RetiredObject> limbo_lists_[kNumLimboLists] ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal
+
+// A concurrent map with the same template interface as `ConcurrentFlatMap`,
+// but with lock-free reads: lookups never take a lock and are never blocked by
+// writers. Writers take a per-bucket mutex, so two writes only contend when
+// they hash to the same bucket.
+//
+// The table is a fixed array of hash buckets holding immutable chain nodes.
+// Updates replace a node rather than mutating it in place, and replaced or
+// erased nodes are reclaimed through epoch-based reclamation
+// (internal::EpochManager), so readers can traverse chains without
+// synchronizing with writers.
+//
+// Caveats compared to ConcurrentFlatMap:
+// - The bucket count is fixed at construction (chains grow beyond the expected
+//   size; performance degrades gracefully rather than rehashing).
+// - Visitors receive values by const reference and cannot mutate them in
+//   place; WriteVisit installs the visited copy as a replacement entry.
+// - Memory for erased entries is freed lazily, once no reader can hold it.
+//
+// Use when expecting heavy read/write mixes where reader latency matters;
+// for read-mostly maps the simpler ConcurrentFlatMap performs comparably.
+template <typename KeyType, typename ValueType>
+class LockFreeConcurrentFlatMap {
+ public:
+  // `expected_size` sizes the fixed bucket array (rounded up to a power of
+  // two); the map stays correct, just slower, beyond it.
+  explicit LockFreeConcurrentFlatMap(size_t expected_size) {
+    size_t num_buckets = 16;
+    while (num_buckets < expected_size) {
+      num_buckets *= 2;
+    }
+    buckets_ = std::vector<Bucket>(num_buckets);
+    bucket_mask_ = num_buckets - 1;
+  }
+
+  LockFreeConcurrentFlatMap() : LockFreeConcurrentFlatMap(1024) {}
+
+  LockFreeConcurrentFlatMap(const LockFreeConcurrentFlatMap &) = delete;
+  LockFreeConcurrentFlatMap &operator=(const LockFreeConcurrentFlatMap &) = delete;
+
+  ~LockFreeConcurrentFlatMap() {
+    // By contract no other thread accesses the map during destruction, so the
+    // chains can be freed directly without going through reclamation.
+    for (auto &bucket : buckets_) {
+      Node *node = bucket.head.load(std::memory_order_relaxed);
+      while (node != nullptr) {
+        Node *next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+      }
+    }
+  }
+
+  // The bucket array is fixed at construction; kept for interface parity with
+  // ConcurrentFlatMap.
+  void Reserve(size_t /*size*/) {}
+
+  template <typename KeyLike>
+  std::optional<ValueType> Get(const KeyLike &key) const {
+    internal::EpochManager::ReadGuard guard;
+    const Node *node = FindNode(key);
+    if (node == nullptr) {
+      return std::nullopt;
+    }
+    return node->value;
+  }
+
+  // Calls visitor on all of the keys in the span. The visitor sees a const
+  // reference and its (possibly modified) copy replaces the entry, so it runs
+  // once per found key under that key's bucket lock.
+  template <typename KeyLike, typename Visitor>
+  void WriteVisit(absl::Span<KeyLike> keys, const Visitor &visitor) {
+    for (const auto &key : keys) {
+      Bucket &bucket = GetBucket(key);
+      absl::MutexLock lock(&bucket.write_mutex);
+      Node *node = FindNodeInBucket(bucket, key);
+      if (node == nullptr) {
+        continue;
+      }
+      auto *replacement = new Node(node->hash, node->key, node->value);
+      visitor(replacement->key, replacement->value);
+      ReplaceNode(bucket, node, replacement);
+    }
+  }
+
+  // Calls visitor on all of the keys in the span, without locking.
+  template <typename KeyLike, typename Visitor>
+  void ReadVisit(absl::Span<KeyLike> keys, const Visitor &visitor) const {
+    internal::EpochManager::ReadGuard guard;
+    for (const auto &key : keys) {
+      const Node *node = FindNode(key);
+      if (node != nullptr) {
+        visitor(node->key, node->value);
+      }
+    }
+  }
+
+  // Applies visitor to all entries in the map, without locking. Entries
+  // inserted or erased concurrently may or may not be visited.
+  template <typename Visitor>
+  void ReadVisitAll(const Visitor &visitor) const {
+    internal::EpochManager::ReadGuard guard;
+    for (const auto &bucket : buckets_) {
+      const Node *node = bucket.head.load(std::memory_order_acquire);
+      while (node != nullptr) {
+        visitor(node->key, node->value);
+        node = node->next.load(std::memory_order_acquire);
+      }
+    }
+  }
+
+  template <typename KeyLike>
+  bool Contains(const KeyLike &key) const {
+    internal::EpochManager::ReadGuard guard;
+    return FindNode(key) != nullptr;
+  }
+
+  // Will insert the key value pair if the key does not exist.
+  // Will replace the value if the key already exists.
+  // Returns true if insertion happened, false if assignment happened.
+  template <typename KeyLike, typename... Args>
+  bool InsertOrAssign(KeyLike &&key, Args &&...args) {
+    auto value = ValueType(std::forward<Args>(args)...);
+    const size_t hash = Hasher{}(key);
+    Bucket &bucket = buckets_[hash & bucket_mask_];
+    absl::MutexLock lock(&bucket.write_mutex);
+    Node *node = FindNodeInBucket(bucket, key);
+    if (node != nullptr) {
+      // Replace the node instead of assigning in place; concurrent readers
+      // may still be reading the old value.
+      ReplaceNode(bucket, node, new Node(hash, node->key, std::move(value)));
+      return false;
+    }
+    PushNode(bucket,
+             new Node(hash, KeyType(std::forward<KeyLike>(key)), std::move(value)));
+    return true;
+  }
+
+  // Returns a bool for whether the key/value was emplaced.
+  // Note: This will not overwrite an existing key.
+  template <typename KeyLike, typename... Args>
+  bool Emplace(KeyLike &&key, Args &&...args) {
+    auto value = ValueType(std::forward<Args>(args)...);
+    const size_t hash = Hasher{}(key);
+    Bucket &bucket = buckets_[hash & bucket_mask_];
+    absl::MutexLock lock(&bucket.write_mutex);
+    if (FindNodeInBucket(bucket, key) != nullptr) {
+      return false;
+    }
+    PushNode(bucket,
+             new Node(hash, KeyType(std::forward<KeyLike>(key)), std::move(value)));
+    return true;
+  }
+
+  // Returns a bool identifying whether the key was found and erased.
+  template <typename KeyLike>
+  bool Erase(const KeyLike &key) {
+    Bucket &bucket = GetBucket(key);
+    absl::MutexLock lock(&bucket.write_mutex);
+    Node *node = FindNodeInBucket(bucket, key);
+    if (node == nullptr) {
+      return false;
+    }
+    UnlinkNode(bucket, node);
+    return true;
+  }
+
+  // Returns the number of keys erased.
+  template <typename KeyLike>
+  int64_t EraseKeys(absl::Span<KeyLike> keys) {
     int64_t num_erased = 0;
     for (const auto &key : keys) {
-      num_erased += map.erase(key);
+      num_erased += Erase(key) ? 1 : 0;
     }
     return num_erased;
   }
 
-  // Returns a copy of the underlying flat_hash_map.
+  // Returns a copy of the map's contents as a flat_hash_map. Taken without
+  // locking; entries mutated concurrently may reflect either version.
   absl::flat_hash_map<KeyType, ValueType> GetMapClone() const {
-    auto read_lock = map_.LockForRead();
-    return read_lock.Get();
+    absl::flat_hash_map<KeyType, ValueType> result;
+    ReadVisitAll([&result](const KeyType &key, const ValueType &value) {
+      result.emplace(key, value);
+    });
+    return result;
   }
 
  private:
-  MutexProtected<absl::flat_hash_map<KeyType, ValueType>> map_;
+  using Hasher = typename absl::flat_hash_map<KeyType, ValueType>::hasher;
+  using KeyEqual = typename absl::flat_hash_map<KeyType, ValueType>::key_equal;
+
+  struct Node {
+    template <typename K, typename V>
+    Node(size_t hash_, K &&key_, V &&value_)
+        : hash(hash_), key(std::forward<K>(key_)), value(std::forward<V>(value_)) {}
+
+    const size_t hash;
+    const KeyType key;
+    // Never mutated after the node is published; updates replace the node.
+    ValueType value;
+    std::atomic<Node *> next{nullptr};
+  };
+
+  struct Bucket {
+    std::atomic<Node *> head{nullptr};
+    absl::Mutex write_mutex;
+  };
+
+  static void DeleteNode(void *node) { delete static_cast<Node *>(node); }
+
+  template <typename KeyLike>
+  Bucket &GetBucket(const KeyLike &key) {
+    return buckets_[Hasher{}(key) & bucket_mask_];
+  }
+
+  // Lock-free chain walk; the caller must hold a ReadGuard (or the bucket
+  // lock, which also keeps the chain stable).
+  template <typename KeyLike>
+  Node *FindNode(const KeyLike &key) const {
+    const size_t hash = Hasher{}(key);
+    Node *node = buckets_[hash & bucket_mask_].head.load(std::memory_order_acquire);
+    while (node != nullptr) {
+      if (node->hash == hash && KeyEqual{}(node->key, key)) {
+        return node;
+      }
+      node = node->next.load(std::memory_order_acquire);
+    }
+    return nullptr;
+  }
+
+  template <typename KeyLike>
+  Node *FindNodeInBucket(Bucket &bucket, const KeyLike &key) const {
+    const size_t hash = Hasher{}(key);
+    Node *node = bucket.head.load(std::memory_order_acquire);
+    while (node != nullptr) {
+      if (node->hash == hash && KeyEqual{}(node->key, key)) {
+        return node;
+      }
+      node = node->next.load(std::memory_order_acquire);
+    }
+    return nullptr;
+  }
+
+  // The following chain mutations require the bucket lock; the release stores
+  // publish fully-constructed nodes to lock-free readers.
+  void PushNode(Bucket &bucket, Node *node) {
+    node->next.store(bucket.head.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+    bucket.head.store(node, std::memory_order_release);
+  }
+
+  void ReplaceNode(Bucket &bucket, Node *old_node, Node *new_node) {
+    new_node->next.store(old_node->next.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+    FindLink(bucket, old_node)->store(new_node, std::memory_order_release);
+    internal::EpochManager::Instance().Retire(old_node, &DeleteNode);
+  }
+
+  void UnlinkNode(Bucket &bucket, Node *node) {
+    Node *next = node->next.load(std::memory_order_relaxed);
+    FindLink(bucket, node)->store(next, std::memory_order_release);
+    internal::EpochManager::Instance().Retire(node, &DeleteNode);
+  }
+
+  // Returns the link (head pointer or predecessor's next pointer) that points
+  // at `node`. The node is known to be in the bucket's chain.
+  std::atomic<Node *> *FindLink(Bucket &bucket, Node *node) {
+    std::atomic<Node *> *link = &bucket.head;
+    Node *current = link->load(std::memory_order_relaxed);
+    while (current != node) {
+      link = &current->next;
+      current = link->load(std::memory_order_relaxed);
+    }
+    return link;
+  }
+
+  std::vector<Bucket> buckets_;
+  size_t bucket_mask_ = 0;
 };
 
 }  // namespace ray
@@ -0,0 +1,130 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/util/contention_profiler.h"
+
+#include <algorithm>
+
+namespace ray {
+
+namespace {
+
+/// Number of buffered samples after which a thread folds its buffer into the
+/// global table.
+constexpr int64_t kFlushSampleCount = 64;
+
+/// Per-thread sample buffer. The destructor flushes any remaining samples so
+/// short-lived threads don't lose them.
+struct ThreadLocalBuffer {
+  absl::flat_hash_map<const char *, ContentionSiteStats> site_stats;
+  int64_t pending_samples = 0;
+
+  ~ThreadLocalBuffer() {
+    if (!site_stats.empty()) {
+      ContentionProfiler::instance().MergeThreadSamples(site_stats);
+    }
+  }
+};
+
+ThreadLocalBuffer &GetThreadLocalBuffer() {
+  static thread_local ThreadLocalBuffer buffer;
+  return buffer;
+}
+
+}  // namespace
+
+ContentionProfiler &ContentionProfiler::instance() {
+  // Leaked so thread-exit flushes can run during process shutdown.
+  static auto *instance = new ContentionProfiler();
+  return *instance;
+}
+
+void ContentionProfiler::Enable(int64_t sample_every_n) {
+  sample_every_n_.store(std::max<int64_t>(sample_every_n, 1),
+                        std::memory_order_relaxed);
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void ContentionProfiler::Disable() {
+  enabled_.store(false, std::memory_order_relaxed);
+}
+
+void ContentionProfiler::RecordWait(const char *site_name, int64_t wait_ns) {
+  auto &buffer = GetThreadLocalBuffer();
+  auto &stats = buffer.site_stats[site_name];
+  stats.num_samples += 1;
+  stats.total_wait_ns += wait_ns;
+  stats.max_wait_ns = std::max(stats.max_wait_ns, wait_ns);
+  buffer.pending_samples += 1;
+  if (buffer.pending_samples >= kFlushSampleCount) {
+    FlushThreadLocal();
+  }
+}
+
+void ContentionProfiler::MergeThreadSamples(
+    const absl::flat_hash_map<const char *, ContentionSiteStats> &samples) {
+  absl::MutexLock lock(&mutex_);
+  for (const auto &[site_name, stats] : samples) {
+    auto &global_stats = site_stats_[site_name];
+    global_stats.num_samples += stats.num_samples;
+    global_stats.total_wait_ns += stats.total_wait_ns;
+    global_stats.max_wait_ns = std::max(global_stats.max_wait_ns, stats.max_wait_ns);
+  }
+}
+
+void ContentionProfiler::FlushThreadLocal() {
+  auto &buffer = GetThreadLocalBuffer();
+  if (buffer.site_stats.empty()) {
+    return;
+  }
+  MergeThreadSamples(buffer.site_stats);
+  buffer.site_stats.clear();
+  buffer.pending_samples = 0;
+}
+
+std::vector<std::pair<std::string, ContentionSiteStats>> ContentionProfiler::GetStats()
+    const {
+  std::vector<std::pair<std::string, ContentionSiteStats>> result;
+  {
+    absl::MutexLock lock(&mutex_);
+    result.reserve(site_stats_.size());
+    for (const auto &[site_name, stats] : site_stats_) {
+      result.emplace_back(site_name, stats);
+    }
+  }
+  std::sort(result.begin(), result.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.second.total_wait_ns > rhs.second.total_wait_ns;
+  });
+  return result;
+}
+
+void ContentionProfiler::Reset() {
+  absl::MutexLock lock(&mutex_);
+  site_stats_.clear();
+}
+
+bool ProfiledMutex::ShouldSample() {
+  auto &profiler = ContentionProfiler::instance();
+  if (!profiler.IsEnabled()) {
+    return false;
+  }
+  static thread_local int64_t acquisitions_until_sample = 0;
+  if (--acquisitions_until_sample > 0) {
+    return false;
+  }
+  acquisitions_until_sample = profiler.SampleEveryN();
+  return true;
+}
+
+}  // namespace ray
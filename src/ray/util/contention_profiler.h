@@ -0,0 +1,142 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace ray {
+
+/// Aggregated wait-time statistics for one profiled lock call site.
+struct ContentionSiteStats {
+  int64_t num_samples = 0;
+  int64_t total_wait_ns = 0;
+  int64_t max_wait_ns = 0;
+};
+
+/// An opt-in, sampled profiler for lock wait times.
+///
+/// While disabled (the default) a profiled acquisition costs one relaxed
+/// atomic load on top of the plain lock. When enabled, every Nth acquisition
+/// per thread is timed and recorded into a per-thread buffer; buffers are
+/// folded into the global table periodically (and at thread exit), so the
+/// lock hot path never takes the profiler's own mutex. Snapshots therefore
+/// lag the most recent samples slightly, which is fine for ranking hotspots.
+class ContentionProfiler {
+ public:
+  static ContentionProfiler &instance();
+
+  /// Start sampling every `sample_every_n`-th profiled acquisition per thread.
+  void Enable(int64_t sample_every_n);
+
+  void Disable();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  int64_t SampleEveryN() const {
+    return sample_every_n_.load(std::memory_order_relaxed);
+  }
+
+  /// Record one sampled wait at `site_name` into the calling thread's buffer.
+  /// `site_name` must be a string literal (sites are keyed by pointer).
+  void RecordWait(const char *site_name, int64_t wait_ns);
+
+  /// Fold the calling thread's buffered samples into the global table now.
+  void FlushThreadLocal();
+
+  /// Merge a batch of per-thread samples into the global table. Called from
+  /// the thread-local buffer on flush and at thread exit.
+  void MergeThreadSamples(
+      const absl::flat_hash_map<const char *, ContentionSiteStats> &samples);
+
+  /// Snapshot of all flushed sites, sorted by total wait time descending.
+  std::vector<std::pair<std::string, ContentionSiteStats>> GetStats() const;
+
+  /// Drop all samples flushed into the global table so far.
+  void Reset();
+
+ private:
+  ContentionProfiler() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<int64_t> sample_every_n_{128};
+
+  mutable absl::Mutex mutex_;
+  absl::flat_hash_map<const char *, ContentionSiteStats> site_stats_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+/// An absl::Mutex wrapper that samples how long callers wait to acquire it,
+/// attributed to the call-site name given at construction.
+class ProfiledMutex {
+ public:
+  /// \param site_name A string literal naming this lock, e.g.
+  /// "WorkerPool.state_mutex".
+  explicit ProfiledMutex(const char *site_name) : site_name_(site_name) {}
+
+  ProfiledMutex(const ProfiledMutex &) = delete;
+  ProfiledMutex &operator=(const ProfiledMutex &) = delete;
+
+  void Lock() {
+    if (!ShouldSample()) {
+      mutex_.Lock();
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    mutex_.Lock();
+    RecordSampledWait(start);
+  }
+
+  void Unlock() { mutex_.Unlock(); }
+
+  void ReaderLock() {
+    if (!ShouldSample()) {
+      mutex_.ReaderLock();
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    mutex_.ReaderLock();
+    RecordSampledWait(start);
+  }
+
+  void ReaderUnlock() { mutex_.ReaderUnlock(); }
+
+  /// The wrapped mutex, for assertions and condition waits.
+  absl::Mutex &RawMutex() { return mutex_; }
+
+ private:
+  /// Returns true for every Nth profiled acquisition on this thread while the
+  /// profiler is enabled.
+  static bool ShouldSample();
+
+  void RecordSampledWait(std::chrono::steady_clock::time_point start) {
+    const auto wait_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+    ContentionProfiler::instance().RecordWait(site_name_, wait_ns);
+  }
+
+  absl::Mutex mutex_;
+  const char *site_name_;
+};
+
+}  // namespace ray
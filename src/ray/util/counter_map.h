@@ -14,11 +14,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <list>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
 #include "absl/synchronization/mutex.h"
 #include "ray/util/logging.h"
 #include "ray/util/mutex_protected.h"
@@ -60,6 +64,15 @@ class CounterMap {
     pending_changes_.clear();
   }
 
+  /// Take the set of keys with buffered change callbacks, clearing it. This
+  /// lets a thread-safe wrapper snapshot the pending keys under its lock and
+  /// run the callbacks outside of it.
+  absl::flat_hash_set<K> TakePendingChanges() {
+    absl::flat_hash_set<K> pending = std::move(pending_changes_);
+    pending_changes_.clear();
+    return pending;
+  }
+
   /// Increment the specified key by `val`, default to 1.
   void Increment(const K &key, int64_t val = 1) {
     // If value is 0, it is no-op and only registers the callback.
@@ -154,12 +167,26 @@ class CounterMapThreadSafe {
 
   void SetOnChangeCallback(std::function<void(const K &)> on_change) {
     auto write_locked = counter_map_.LockForWrite();
+    on_change_ = on_change;
     write_locked.Get().SetOnChangeCallback(std::move(on_change));
   }
 
   void FlushOnChangeCallbacks() {
-    auto write_locked = counter_map_.LockForWrite();
-    write_locked.Get().FlushOnChangeCallbacks();
+    // Snapshot the pending keys under the lock and run the callbacks outside
+    // of it, so a slow metric flush never blocks the write path and the
+    // callbacks may safely call back into this counter.
+    absl::flat_hash_set<K> pending;
+    std::function<void(const K &)> on_change;
+    {
+      auto write_locked = counter_map_.LockForWrite();
+      pending = write_locked.Get().TakePendingChanges();
+      on_change = on_change_;
+    }
+    if (on_change != nullptr) {
+      for (const auto &key : pending) {
+        on_change(key);
+      }
+    }
   }
 
   void Increment(const K &key, int64_t val = 1) {
@@ -197,9 +224,13 @@ class CounterMapThreadSafe {
     return read_locked.Get().NumPendingCallbacks();
   }
 
+  /// Run the callback over a snapshot of the entries, taken under the lock
+  /// but iterated outside of it.
   void ForEachEntry(std::function<void(const K &, int64_t)> callback) const {
-    const auto read_locked = counter_map_.LockForRead();
-    read_locked.Get().ForEachEntry(std::move(callback));
+    auto snapshot = GetAll();
+    for (const auto &entry : snapshot) {
+      callback(entry.first, entry.second);
+    }
   }
 
   absl::flat_hash_map<K, int64_t> GetAll() const {
@@ -209,4 +240,138 @@ class CounterMapThreadSafe {
 
  private:
   ray::MutexProtected<CounterMap<K>> counter_map_;
+  /// A copy of the on change callback, written under the write lock, so that
+  /// FlushOnChangeCallbacks can invoke it after releasing the lock.
+  std::function<void(const K &)> on_change_;
+};
+
+/// \class CounterMapSharded
+/// A thread-safe CounterMap for high-cardinality, high-churn counters. Keys
+/// are hashed across independently locked shards, so writers touching
+/// different keys mostly take different locks instead of contending on one
+/// mutex. Aggregate reads (`Size`, `Total`, `GetAll`, `ForEachEntry`) merge
+/// the shards on demand, and callback flush and iteration are snapshot-based:
+/// shard locks are only held while copying, never while user callbacks run.
+template <typename K>
+class CounterMapSharded {
+ public:
+  explicit CounterMapSharded(size_t num_shards = 8) {
+    shards_.reserve(std::max<size_t>(1, num_shards));
+    for (size_t i = 0; i < std::max<size_t>(1, num_shards); ++i) {
+      shards_.push_back(std::make_unique<ray::MutexProtected<CounterMap<K>>>());
+    }
+  }
+
+  CounterMapSharded(const CounterMapSharded &other) = delete;
+
+  CounterMapSharded &operator=(const CounterMapSharded &other) = delete;
+
+  void SetOnChangeCallback(std::function<void(const K &)> on_change) {
+    for (auto &shard : shards_) {
+      auto write_locked = shard->LockForWrite();
+      write_locked.Get().SetOnChangeCallback(on_change);
+    }
+    auto write_locked = on_change_.LockForWrite();
+    write_locked.Get() = std::move(on_change);
+  }
+
+  /// Flush any pending on change callbacks. The pending keys are drained from
+  /// each shard under its lock, then the callbacks run with no lock held.
+  void FlushOnChangeCallbacks() {
+    absl::flat_hash_set<K> pending;
+    for (auto &shard : shards_) {
+      auto write_locked = shard->LockForWrite();
+      pending.merge(write_locked.Get().TakePendingChanges());
+    }
+    std::function<void(const K &)> on_change;
+    {
+      const auto read_locked = on_change_.LockForRead();
+      on_change = read_locked.Get();
+    }
+    if (on_change != nullptr) {
+      for (const auto &key : pending) {
+        on_change(key);
+      }
+    }
+  }
+
+  void Increment(const K &key, int64_t val = 1) {
+    auto write_locked = ShardFor(key).LockForWrite();
+    write_locked.Get().Increment(key, val);
+  }
+
+  void Decrement(const K &key, int64_t val = 1) {
+    auto write_locked = ShardFor(key).LockForWrite();
+    write_locked.Get().Decrement(key, val);
+  }
+
+  int64_t Get(const K &key) const {
+    const auto read_locked = ShardFor(key).LockForRead();
+    return read_locked.Get().Get(key);
+  }
+
+  /// Decrement `old_key` and increment `new_key`. The two updates take their
+  /// shard locks one after the other, so aggregate reads may observe the
+  /// intermediate state, just as they can with the unsharded wrapper.
+  void Swap(const K &old_key, const K &new_key, int64_t val = 1) {
+    if (old_key != new_key) {
+      Decrement(old_key, val);
+      Increment(new_key, val);
+    }
+  }
+
+  size_t Size() const {
+    size_t size = 0;
+    for (const auto &shard : shards_) {
+      const auto read_locked = shard->LockForRead();
+      size += read_locked.Get().Size();
+    }
+    return size;
+  }
+
+  size_t Total() const {
+    size_t total = 0;
+    for (const auto &shard : shards_) {
+      const auto read_locked = shard->LockForRead();
+      total += read_locked.Get().Total();
+    }
+    return total;
+  }
+
+  size_t NumPendingCallbacks() const {
+    size_t num_pending = 0;
+    for (const auto &shard : shards_) {
+      const auto read_locked = shard->LockForRead();
+      num_pending += read_locked.Get().NumPendingCallbacks();
+    }
+    return num_pending;
+  }
+
+  /// Run the callback over a snapshot of the entries, taken shard by shard
+  /// under each shard's lock but iterated with no lock held.
+  void ForEachEntry(std::function<void(const K &, int64_t)> callback) const {
+    auto snapshot = GetAll();
+    for (const auto &entry : snapshot) {
+      callback(entry.first, entry.second);
+    }
+  }
+
+  absl::flat_hash_map<K, int64_t> GetAll() const {
+    absl::flat_hash_map<K, int64_t> all;
+    for (const auto &shard : shards_) {
+      const auto read_locked = shard->LockForRead();
+      auto shard_counters = read_locked.Get().GetAll();
+      all.insert(shard_counters.begin(), shard_counters.end());
+    }
+    return all;
+  }
+
+ private:
+  ray::MutexProtected<CounterMap<K>> &ShardFor(const K &key) const {
+    return *shards_[absl::HashOf(key) % shards_.size()];
+  }
+
+  /// The shards are heap-allocated because MutexProtected is not movable.
+  std::vector<std::unique_ptr<ray::MutexProtected<CounterMap<K>>>> shards_;
+  ray::MutexProtected<std::function<void(const K &)>> on_change_;
 };
@@ -47,6 +47,7 @@
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_format.h"
 #include "ray/util/thread_utils.h"
+#include "spdlog/async.h"
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
@@ -64,6 +65,8 @@ RayLogLevel RayLog::severity_threshold_ = RayLogLevel::INFO;
 std::string RayLog::app_name_ = "";        // NOLINT
 std::string RayLog::component_name_ = "";  // NOLINT
 bool RayLog::log_format_json_ = false;
+bool RayLog::log_async_ = false;
+size_t RayLog::log_async_buffer_size_ = 8192;
 std::string RayLog::log_format_pattern_ = kLogFormatTextPattern;  // NOLINT
 
 std::string RayLog::logger_name_ = "ray_log_sink";  // NOLINT
@@ -319,6 +322,23 @@ void RayLog::InitLogFormat() {
   }
 }
 
+void RayLog::InitLogAsync() {
+  // Default is synchronous logging.
+  log_async_ = false;
+
+  if (const char *var_value = std::getenv("RAY_BACKEND_LOG_ASYNC");
+      var_value != nullptr) {
+    log_async_ = std::string_view{var_value} == std::string_view{"1"};
+  }
+  if (const char *var_value = std::getenv("RAY_BACKEND_LOG_ASYNC_BUFFER_SIZE");
+      var_value != nullptr) {
+    size_t buffer_size = 0;
+    if (absl::SimpleAtoi(var_value, &buffer_size) && buffer_size > 0) {
+      log_async_buffer_size_ = buffer_size;
+    }
+  }
+}
+
 /*static*/ size_t RayLog::GetRayLogRotationMaxBytesOrDefault() {
 #if defined(__APPLE__) || defined(__linux__)
   if (const char *ray_rotation_max_bytes = std::getenv("RAY_ROTATION_MAX_BYTES");
@@ -353,6 +373,7 @@ void RayLog::InitLogFormat() {
                                     size_t log_rotation_file_num) {
   InitSeverityThreshold(severity_threshold);
   InitLogFormat();
+  InitLogAsync();
 
   app_name_ = app_name;
   log_rotation_max_size_ = log_rotation_max_size;
@@ -418,9 +439,26 @@ void RayLog::InitLogFormat() {
   }
 
   // Set the combined logger.
-  auto logger = std::make_shared<spdlog::logger>(RayLog::GetLoggerName(),
-                                                 std::make_move_iterator(sinks.begin()),
-                                                 std::make_move_iterator(sinks.end()));
+  std::shared_ptr<spdlog::logger> logger;
+  if (log_async_) {
+    // Route messages through a bounded queue drained by a dedicated thread so
+    // a slow or bursty sink never stalls the calling thread. When the queue
+    // fills, the oldest queued messages are dropped in preference to blocking
+    // the hot path.
+    spdlog::init_thread_pool(log_async_buffer_size_, /*thread_count=*/1);
+    logger =
+        std::make_shared<spdlog::async_logger>(RayLog::GetLoggerName(),
+                                               std::make_move_iterator(sinks.begin()),
+                                               std::make_move_iterator(sinks.end()),
+                                               spdlog::thread_pool(),
+                                               spdlog::async_overflow_policy::overrun_oldest);
+    // Errors are rare enough to flush eagerly even in async mode.
+    logger->flush_on(spdlog::level::err);
+  } else {
+    logger = std::make_shared<spdlog::logger>(RayLog::GetLoggerName(),
+                                              std::make_move_iterator(sinks.begin()),
+                                              std::make_move_iterator(sinks.end()));
+  }
   logger->set_level(level);
   // Set the pattern of all sinks.
   logger->set_pattern(log_format_pattern_);
@@ -591,7 +629,13 @@ RayLog::~RayLog() {
                 msg_osstream_.str(),
                 context_osstream_.str());
   }
-  logger->flush();
+  // In async mode the message was only queued; skip the per-message flush and
+  // let the drain thread write it out. FATAL still drains the queue (flush on
+  // an async logger blocks until the queue is processed) so the message and
+  // everything logged before it reach the sinks before the process exits.
+  if (!log_async_ || IsFatal()) {
+    logger->flush();
+  }
 
   if (severity_ == RayLogLevel::FATAL) {
     std::_Exit(EXIT_FAILURE);
@@ -392,6 +392,7 @@ class RayLog {
 
   static void InitSeverityThreshold(RayLogLevel severity_threshold);
   static void InitLogFormat();
+  static void InitLogAsync();
 
   /// True if log messages should be logged and false if they should be ignored.
   bool is_enabled_;
@@ -421,6 +422,13 @@ class RayLog {
   static bool is_failure_signal_handler_installed_;
   /// Whether emit json logs.
   static bool log_format_json_;
+  /// Whether log messages are handed to a bounded queue drained by a
+  /// dedicated thread instead of being formatted and written on the calling
+  /// thread. FATAL logs always flush synchronously before aborting.
+  static bool log_async_;
+  /// Capacity of the async log queue in messages. When the queue is full the
+  /// oldest queued messages are overrun rather than blocking the caller.
+  static size_t log_async_buffer_size_;
   // Log format pattern.
   static std::string log_format_pattern_;
   // Log rotation file size limitation.
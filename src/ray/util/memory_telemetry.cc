@@ -0,0 +1,130 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/util/memory_telemetry.h"
+
+#include <functional>
+
+namespace ray {
+
+namespace {
+
+// Thread-local tag and sampling state. Plain PODs so accessing them from the
+// allocation hooks never allocates.
+thread_local MemoryTag current_tag = MemoryTag::kUntagged;
+thread_local int64_t allocs_until_sample = 0;
+// Recursion guard: recording a sample allocates (side table insert), which
+// re-enters the operator new hook on the same thread.
+thread_local bool in_hook = false;
+
+struct HookGuard {
+  HookGuard() { in_hook = true; }
+  ~HookGuard() { in_hook = false; }
+};
+
+}  // namespace
+
+const char *MemoryTagName(MemoryTag tag) {
+  switch (tag) {
+  case MemoryTag::kUntagged:
+    return "Untagged";
+  case MemoryTag::kObjectPulls:
+    return "ObjectPulls";
+  case MemoryTag::kLeaseQueues:
+    return "LeaseQueues";
+  case MemoryTag::kPubsub:
+    return "Pubsub";
+  case MemoryTag::kGcsTables:
+    return "GcsTables";
+  case MemoryTag::kNumTags:
+    break;
+  }
+  return "Unknown";
+}
+
+ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag) : previous_(current_tag) {
+  current_tag = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() { current_tag = previous_; }
+
+MemoryTelemetry &MemoryTelemetry::Instance() {
+  // Leaked so the hooks can still consult it during static destruction.
+  static MemoryTelemetry *instance = new MemoryTelemetry();
+  return *instance;
+}
+
+void MemoryTelemetry::Enable(int64_t sample_period) {
+  sample_period_ = sample_period > 0 ? sample_period : 1;
+  enabled_.store(true, std::memory_order_release);
+}
+
+void MemoryTelemetry::OnAlloc(void *ptr, size_t size) {
+  if (!IsEnabled() || ptr == nullptr || in_hook) {
+    return;
+  }
+  if (--allocs_until_sample > 0) {
+    return;
+  }
+  allocs_until_sample = sample_period_;
+  HookGuard guard;
+
+  const MemoryTag tag = current_tag;
+  const int64_t attributed_bytes = static_cast<int64_t>(size) * sample_period_;
+  live_bytes_[static_cast<size_t>(tag)].fetch_add(attributed_bytes,
+                                                  std::memory_order_relaxed);
+  outstanding_samples_.fetch_add(1, std::memory_order_relaxed);
+  auto &shard = ShardFor(ptr);
+  absl::MutexLock lock(&shard.mu);
+  shard.samples[ptr] = Sample{tag, attributed_bytes};
+}
+
+void MemoryTelemetry::OnFree(void *ptr) {
+  if (ptr == nullptr || in_hook ||
+      outstanding_samples_.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  HookGuard guard;
+  auto &shard = ShardFor(ptr);
+  Sample sample;
+  {
+    absl::MutexLock lock(&shard.mu);
+    auto it = shard.samples.find(ptr);
+    if (it == shard.samples.end()) {
+      return;
+    }
+    sample = it->second;
+    shard.samples.erase(it);
+  }
+  live_bytes_[static_cast<size_t>(sample.tag)].fetch_sub(sample.attributed_bytes,
+                                                         std::memory_order_relaxed);
+  outstanding_samples_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::vector<MemoryTelemetry::TaggedBytes> MemoryTelemetry::GetEstimatedLiveBytes()
+    const {
+  std::vector<TaggedBytes> result;
+  result.reserve(kNumTags);
+  for (size_t i = 0; i < kNumTags; i++) {
+    result.push_back(TaggedBytes{static_cast<MemoryTag>(i),
+                                 live_bytes_[i].load(std::memory_order_relaxed)});
+  }
+  return result;
+}
+
+MemoryTelemetry::Shard &MemoryTelemetry::ShardFor(void *ptr) {
+  return shards_[std::hash<void *>()(ptr) % kNumShards];
+}
+
+}  // namespace ray
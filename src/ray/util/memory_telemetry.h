@@ -0,0 +1,125 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace ray {
+
+/// Coarse subsystem tags for heap allocation attribution. Allocations made
+/// while no ScopedMemoryTag is active are attributed to kUntagged.
+enum class MemoryTag : uint8_t {
+  kUntagged = 0,
+  kObjectPulls,
+  kLeaseQueues,
+  kPubsub,
+  kGcsTables,
+  kNumTags,  // Sentinel; keep last.
+};
+
+/// Human readable name of a tag, used as a metric label value.
+const char *MemoryTagName(MemoryTag tag);
+
+/// Sets the calling thread's current memory tag for the lifetime of the scope,
+/// restoring the previous tag on destruction. Scopes nest.
+class ScopedMemoryTag {
+ public:
+  explicit ScopedMemoryTag(MemoryTag tag);
+  ~ScopedMemoryTag();
+
+  ScopedMemoryTag(const ScopedMemoryTag &) = delete;
+  ScopedMemoryTag &operator=(const ScopedMemoryTag &) = delete;
+
+ private:
+  MemoryTag previous_;
+};
+
+/// Process-wide sampled heap attribution, in the style of jemalloc's profiling:
+/// every Nth allocation on each thread is recorded against the thread's current
+/// MemoryTag, remembered in a sharded side table so the matching free can be
+/// attributed to the same tag, and scaled by the sampling period to estimate
+/// live bytes per subsystem. The global operator new/delete hooks that feed
+/// this live in memory_telemetry_hooks.cc and are linked only into binaries
+/// that opt in (raylet, gcs_server).
+///
+/// Disabled (the default) the hooks cost one relaxed atomic load per
+/// allocation; enabled, unsampled allocations additionally bump a thread-local
+/// counter and frees probe one shard of the side table.
+class MemoryTelemetry {
+ public:
+  static MemoryTelemetry &Instance();
+
+  /// Start sampling. Must be called before allocations of interest; typically
+  /// from main() after parsing config.
+  ///
+  /// \param sample_period Record every `sample_period`-th allocation per thread.
+  void Enable(int64_t sample_period);
+
+  bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /// Called by the operator new hook for every allocation.
+  void OnAlloc(void *ptr, size_t size);
+
+  /// Called by the operator delete hook for every deallocation.
+  void OnFree(void *ptr);
+
+  struct TaggedBytes {
+    MemoryTag tag;
+    /// Estimated live bytes attributed to the tag (sampled size scaled by the
+    /// sampling period).
+    int64_t bytes;
+  };
+
+  /// Snapshot of the estimated live bytes per tag.
+  std::vector<TaggedBytes> GetEstimatedLiveBytes() const;
+
+ private:
+  MemoryTelemetry() = default;
+
+  static constexpr size_t kNumShards = 64;
+  static constexpr size_t kNumTags = static_cast<size_t>(MemoryTag::kNumTags);
+
+  struct Sample {
+    MemoryTag tag;
+    int64_t attributed_bytes;
+  };
+
+  struct Shard {
+    absl::Mutex mu;
+    absl::flat_hash_map<void *, Sample> samples ABSL_GUARDED_BY(mu);
+  };
+
+  Shard &ShardFor(void *ptr);
+
+  std::atomic<bool> enabled_{false};
+  int64_t sample_period_ = 0;
+  /// Estimated live bytes per tag; sampled sizes scaled by sample_period_.
+  std::array<std::atomic<int64_t>, kNumTags> live_bytes_{};
+  /// Number of sampled allocations not yet freed. Lets OnFree skip the side
+  /// table probe entirely once sampling is off and all samples have drained.
+  std::atomic<int64_t> outstanding_samples_{0};
+  std::array<Shard, kNumShards> shards_;
+};
+
+}  // namespace ray
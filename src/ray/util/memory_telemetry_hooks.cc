@@ -0,0 +1,178 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Global operator new/delete replacements feeding MemoryTelemetry. This
+// translation unit is a separate, alwayslink build target that only binaries
+// opting into allocation attribution (raylet, gcs_server) link against; test
+// binaries and libraries are unaffected. When telemetry is disabled (the
+// default) each hook costs one relaxed atomic load on top of malloc/free.
+
+#include <cstdlib>
+#include <new>
+
+#include "ray/util/memory_telemetry.h"
+
+// Replacing the global allocation functions relies on posix_memalign and the
+// platform linker preferring these definitions; on Windows the binary keeps the
+// default allocator and telemetry simply reports zeros.
+#ifndef _WIN32
+
+namespace {
+
+void *AllocOrHandleFailure(size_t size) {
+  void *ptr = std::malloc(size);
+  while (ptr == nullptr) {
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+    ptr = std::malloc(size);
+  }
+  return ptr;
+}
+
+void *AlignedAllocOrHandleFailure(size_t size, std::align_val_t alignment) {
+  void *ptr = nullptr;
+  while (posix_memalign(&ptr, static_cast<size_t>(alignment), size) != 0) {
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+  return ptr;
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  void *ptr = AllocOrHandleFailure(size);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new[](size_t size) {
+  void *ptr = AllocOrHandleFailure(size);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  void *ptr = std::malloc(size);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  void *ptr = std::malloc(size);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+  void *ptr = AlignedAllocOrHandleFailure(size, alignment);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+  void *ptr = AlignedAllocOrHandleFailure(size, alignment);
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new(size_t size,
+                   std::align_val_t alignment,
+                   const std::nothrow_t &) noexcept {
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, static_cast<size_t>(alignment), size) != 0) {
+    return nullptr;
+  }
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void *operator new[](size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, static_cast<size_t>(alignment), size) != 0) {
+    return nullptr;
+  }
+  ray::MemoryTelemetry::Instance().OnAlloc(ptr, size);
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+  ray::MemoryTelemetry::Instance().OnFree(ptr);
+  std::free(ptr);
+}
+
+#endif  // !defined(_WIN32)
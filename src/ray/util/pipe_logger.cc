@@ -12,11 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* Turns on splice() definition */
+#endif
+
 #include "ray/util/pipe_logger.h"
 
 #include <fcntl.h>
 
 #include <condition_variable>
+#include <cstdio>
 #include <cstring>
 #include <deque>
 #include <future>
@@ -37,6 +42,7 @@
 #include "ray/util/spdlog_fd_sink.h"
 #include "ray/util/spdlog_newliner_sink.h"
 #include "ray/util/thread_utils.h"
+#include "spdlog/details/file_helper.h"
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
@@ -215,6 +221,110 @@ RedirectionFileHandle OpenFileForRedirection(const std::string &file_path) {
 
   return RedirectionFileHandle{fd, std::move(logger), std::move(close_fn)};
 }
+
+#if defined(__linux__)
+// Mirror spdlog's rotating sink naming: insert the index before the extension,
+// i.e. mylog.txt -> mylog.1.txt. Index 0 is the live file.
+std::string RotatedLogFileName(const std::string &file_path, size_t index) {
+  if (index == 0) {
+    return file_path;
+  }
+  const auto [basename, ext] =
+      spdlog::details::file_helper::split_by_extension(file_path);
+  return absl::StrFormat("%s.%d%s", basename, index, ext);
+}
+
+// Shift mylog.txt -> mylog.1.txt -> ... -> mylog.<max_file_count>.txt, dropping
+// the oldest file, the same way spdlog's rotating sink does.
+void RotateLogFiles(const std::string &file_path, size_t max_file_count) {
+  for (size_t idx = max_file_count; idx > 0; --idx) {
+    const std::string src = RotatedLogFileName(file_path, idx - 1);
+    const std::string dst = RotatedLogFileName(file_path, idx);
+    // A missing source simply means fewer rotations have happened so far.
+    std::rename(src.c_str(), dst.c_str());
+  }
+}
+
+// Start a single thread which forwards bytes from the pipe straight into the
+// log file with splice(2), so log pumping moves no bytes through userspace.
+// Rotation is handled by tracking the number of bytes spliced and shifting the
+// files once the live file exceeds the rotation size; since bytes are never
+// inspected, files rotate at chunk rather than line granularity.
+void StartSpliceDump(int read_fd,
+                     StreamRedirectionOption stream_redirect_opt,
+                     std::function<void()> on_close_completion) {
+  std::thread([read_fd,
+               stream_redirect_opt = std::move(stream_redirect_opt),
+               on_close_completion = std::move(on_close_completion)]() {
+    SetThreadName("PipeSpliceThd");
+
+    // O_APPEND is incompatible with splice(2), so position the file offset at
+    // the end explicitly.
+    const auto open_log_file = [&stream_redirect_opt]() {
+      const int fd = open(stream_redirect_opt.file_path.c_str(),
+                          O_WRONLY | O_CREAT,
+                          S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+      RAY_CHECK_NE(fd, -1) << "Fails to open log file "
+                           << stream_redirect_opt.file_path << ": " << strerror(errno);
+      return fd;
+    };
+    int file_fd = open_log_file();
+    off_t file_size = lseek(file_fd, 0, SEEK_END);
+
+    const size_t chunk_size = RayConfig::instance().pipe_logger_read_buf_size();
+    while (true) {
+      const ssize_t bytes_moved =
+          splice(read_fd, nullptr, file_fd, nullptr, chunk_size, SPLICE_F_MOVE);
+      if (bytes_moved == 0) {
+        // The write end has been closed; all content has been forwarded.
+        break;
+      }
+      if (bytes_moved < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        RAY_LOG(ERROR) << "Fails to splice into log file "
+                       << stream_redirect_opt.file_path << ": " << strerror(errno);
+        break;
+      }
+      file_size += bytes_moved;
+      if (stream_redirect_opt.rotation_max_size != 0 &&
+          static_cast<size_t>(file_size) >= stream_redirect_opt.rotation_max_size) {
+        RAY_CHECK_OK(Close(file_fd));
+        RotateLogFiles(stream_redirect_opt.file_path,
+                       stream_redirect_opt.rotation_max_file_count);
+        file_fd = open_log_file();
+        file_size = 0;
+      }
+    }
+
+    RAY_CHECK_OK(Close(file_fd));
+    RAY_CHECK_OK(Close(read_fd));
+    on_close_completion();
+  }).detach();
+}
+
+// Zero-copy counterpart of the pipe-stream path for the no-transform case:
+// rotation requested, but no tee and thus no per-line processing needed.
+RedirectionFileHandle CreateSpliceRedirectionHandle(
+    const StreamRedirectionOption &stream_redirect_opt) {
+  auto promise = std::make_shared<std::promise<void>>();
+  int pipefd[2] = {0};
+  RAY_CHECK_EQ(pipe(pipefd), 0);
+  const int read_fd = pipefd[0];
+  const int write_fd = pipefd[1];
+
+  StartSpliceDump(
+      read_fd, stream_redirect_opt, [promise]() { promise->set_value(); });
+
+  auto close_fn = [write_fd, promise]() {
+    RAY_CHECK_OK(Close(write_fd));
+    // Block until all pipe content has been spliced into the file.
+    promise->get_future().get();
+  };
+  return RedirectionFileHandle{write_fd, /*logger=*/nullptr, std::move(close_fn)};
+}
+#endif  // defined(__linux__)
 }  // namespace
 
 RedirectionFileHandle CreateRedirectionFileHandle(
@@ -225,6 +335,15 @@ RedirectionFileHandle CreateRedirectionFileHandle(
     return OpenFileForRedirection(stream_redirect_opt.file_path);
   }
 
+#if defined(__linux__)
+  // Rotation without tee needs no per-line processing, so bytes can be moved
+  // from the pipe into the file without ever entering userspace.
+  if (RayConfig::instance().pipe_logger_splice_enabled() &&
+      !stream_redirect_opt.tee_to_stdout && !stream_redirect_opt.tee_to_stderr) {
+    return CreateSpliceRedirectionHandle(stream_redirect_opt);
+  }
+#endif
+
   // Case-2: redirection with rotation, or tee is involved.
   //
   // Used to synchronize on asynchronous stream logging.
@@ -77,7 +77,13 @@ class RedirectionFileHandle {
   // TODO(hjiang): Current method only flushes whatever we send to logger, but not those
   // in the pipe; a better approach is flush pipe, send FLUSH indicator and block wait
   // until logger sync over.
-  void Flush() { logger_->flush(); }
+  void Flush() {
+    // The splice-based redirection path writes to the file directly and has no
+    // logger to flush.
+    if (logger_ != nullptr) {
+      logger_->flush();
+    }
+  }
 
   int GetWriteFd() const { return write_fd_; }
 
@@ -27,6 +27,7 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
+#include <spawn.h>
 #include <stddef.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -47,6 +48,7 @@
 #include <vector>
 
 #include "absl/strings/str_format.h"
+#include "ray/common/ray_config.h"
 #include "ray/util/cmd_line_utils.h"
 #include "ray/util/filesystem.h"
 #include "ray/util/logging.h"
@@ -169,6 +171,96 @@ Process &Process::operator=(Process &&other) {
   return *this;
 }
 
+#if !defined(_WIN32)
+namespace {
+
+/// posix_spawn-based fast path for Spawnvpe. Unlike fork(), posix_spawn does
+/// not duplicate the parent's page tables (glibc implements it with vfork
+/// semantics), so launching a worker from a multi-GB raylet costs microseconds
+/// instead of tens of milliseconds. Only used for non-decoupled processes;
+/// decoupling requires the double-fork dance in the fork path.
+std::pair<pid_t, intptr_t> SpawnvpePosixSpawn(
+    const char *argv[],
+    std::error_code &ec,
+    char **envp,
+    bool pipe_to_stdin,
+    const AddProcessToCgroupHook &add_to_cgroup,
+    bool new_process_group) {
+  // Lifetime-tracking pipe: the child inherits the write end across exec and
+  // the parent keeps the read end, which closes when the child terminates.
+  int pipefds[2];
+  if (pipe(pipefds) == -1) {
+    ec = std::error_code(errno, std::system_category());
+    return std::pair<pid_t, intptr_t>(-1, -1);
+  }
+  // parent_lifetime_pipe is dup2'd onto the child's stdin so the child can
+  // detect the parent's death; the parent keeps the write end open for its
+  // own lifetime.
+  int parent_lifetime_pipe[2] = {-1, -1};
+  if (pipe_to_stdin && pipe(parent_lifetime_pipe) == -1) {
+    ec = std::error_code(errno, std::system_category());
+    close(pipefds[0]);
+    close(pipefds[1]);
+    return std::pair<pid_t, intptr_t>(-1, -1);
+  }
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  // The parent keeps the read end of the lifetime pipe; the child must not.
+  posix_spawn_file_actions_addclose(&actions, pipefds[0]);
+  if (pipe_to_stdin) {
+    posix_spawn_file_actions_adddup2(&actions, parent_lifetime_pipe[0], STDIN_FILENO);
+    posix_spawn_file_actions_addclose(&actions, parent_lifetime_pipe[0]);
+    posix_spawn_file_actions_addclose(&actions, parent_lifetime_pipe[1]);
+  }
+
+  posix_spawnattr_t attr;
+  posix_spawnattr_init(&attr);
+  // Reset the SIGCHLD handler, mirroring the fork path.
+  short flags = POSIX_SPAWN_SETSIGDEF;
+  sigset_t sigdefault;
+  sigemptyset(&sigdefault);
+  sigaddset(&sigdefault, SIGCHLD);
+  posix_spawnattr_setsigdefault(&attr, &sigdefault);
+  if (new_process_group) {
+    flags |= POSIX_SPAWN_SETPGROUP;
+    posix_spawnattr_setpgroup(&attr, 0);
+  }
+  posix_spawnattr_setflags(&attr, flags);
+
+  pid_t pid = -1;
+  int err = posix_spawnp(
+      &pid, argv[0], &actions, &attr, const_cast<char *const *>(argv), envp);
+  posix_spawn_file_actions_destroy(&actions);
+  posix_spawnattr_destroy(&attr);
+
+  // Parent-side ends: the child owns the write end of the lifetime pipe and
+  // the read end of the parent lifetime pipe.
+  close(pipefds[1]);
+  if (pipe_to_stdin) {
+    close(parent_lifetime_pipe[0]);
+  }
+  if (err != 0) {
+    close(pipefds[0]);
+    if (pipe_to_stdin) {
+      close(parent_lifetime_pipe[1]);
+    }
+    ec = std::error_code(err, std::system_category());
+    return std::pair<pid_t, intptr_t>(-1, -1);
+  }
+  SetFdCloseOnExec(pipefds[0]);
+  if (pipe_to_stdin) {
+    SetFdCloseOnExec(parent_lifetime_pipe[1]);
+  }
+  // The fork path enters the cgroup from the child before exec; here the
+  // parent does it right after the spawn, before the caller learns the pid.
+  add_to_cgroup(std::to_string(pid));
+  return std::pair<pid_t, intptr_t>(pid, pipefds[0]);
+}
+
+}  // namespace
+#endif  // !defined(_WIN32)
+
 std::pair<pid_t, intptr_t> Process::Spawnvpe(const char *argv[],
                                              std::error_code &ec,
                                              bool decouple,
@@ -240,6 +332,11 @@ std::pair<pid_t, intptr_t> Process::Spawnvpe(const char *argv[],
   new_env_ptrs.push_back(static_cast<char *>(NULL));
   char **envp = &new_env_ptrs[0];
 
+  if (!decouple && ::RayConfig::instance().process_posix_spawn_enabled()) {
+    return SpawnvpePosixSpawn(
+        argv, ec, envp, pipe_to_stdin, add_to_cgroup, new_process_group);
+  }
+
   // TODO(mehrdadn): Use clone() on Linux or posix_spawnp() on Mac to avoid duplicating
   // file descriptors into the child process, as that can be problematic.
   int pipefds[2];  // Create pipe to get PID & track lifetime
@@ -17,6 +17,10 @@
 // avoid copy at get operation, meanwhile also useful to maintain memory validity at any
 // time.
 //
+// The LRU list is intrusive: each entry embeds its own prev/next links and all entries
+// live in a slab arena with a free list, so steady-state Put/Get/Delete perform no
+// per-entry node allocations and the entries stay contiguous-ish in memory.
+//
 // Example usage:
 // SharedLruCache<std::string, std::string> cache{cap};
 // // Put a key-value pair into cache.
@@ -26,18 +30,26 @@
 // auto val = cache.Get("key");
 // // Check and consume `val`.
 //
-// TODO(hjiang):
-// For thread-safe cache, add a sharded container wrapper to reduce lock contention.
+// An optional TTL could be attached to the cache, after which entries are treated as
+// missing at lookup:
+// SharedLruCache<std::string, std::string> cache{cap, std::chrono::seconds(30)};
+//
+// For thread-safe usage under contention, `ShardedSharedLruCache` splits the key space
+// over independently-locked shards.
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
-#include <list>
+#include <deque>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "ray/util/logging.h"
@@ -55,6 +67,12 @@ class SharedLruCache final {
   // in the cache.
   explicit SharedLruCache(size_t max_entries) : max_entries_(max_entries) {}
 
+  // Same as above, additionally attaching a time-to-live to every entry; entries older
+  // than `ttl` (counted from their latest `Put`) are treated as missing at lookup.
+  // A `ttl` of 0 means entries never expire.
+  SharedLruCache(size_t max_entries, std::chrono::milliseconds ttl)
+      : max_entries_(max_entries), ttl_(ttl) {}
+
   SharedLruCache(const SharedLruCache &) = delete;
   SharedLruCache &operator=(const SharedLruCache &) = delete;
 
@@ -66,22 +84,29 @@ class SharedLruCache final {
     RAY_CHECK(value != nullptr);
     auto iter = cache_.find(key);
     if (iter != cache_.end()) {
-      lru_list_.splice(lru_list_.begin(), lru_list_, iter->second.lru_iterator);
-      iter->second.value = std::move(value);
+      Node &node = nodes_[iter->second];
+      node.value = std::move(value);
+      node.insertion_time = std::chrono::steady_clock::now();
+      MoveToFront(iter->second);
       return;
     }
 
-    lru_list_.emplace_front(key);
-    Entry new_entry{std::move(value), lru_list_.begin()};
-    cache_[std::cref(lru_list_.front())] = std::move(new_entry);
-
-    if (max_entries_ > 0 && lru_list_.size() > max_entries_) {
-      const auto &stale_key = lru_list_.back();
-      cache_.erase(stale_key);
-      lru_list_.pop_back();
+    const NodeIndex new_index = AllocateNode();
+    Node &new_node = nodes_[new_index];
+    new_node.key.emplace(std::move(key));
+    new_node.value = std::move(value);
+    new_node.insertion_time = std::chrono::steady_clock::now();
+    PushFront(new_index);
+    cache_[std::cref(*new_node.key)] = new_index;
+
+    if (max_entries_ > 0 && cache_.size() > max_entries_) {
+      const NodeIndex stale_index = tail_;
+      Unlink(stale_index);
+      cache_.erase(*nodes_[stale_index].key);
+      FreeNode(stale_index);
     }
 
-    RAY_CHECK_EQ(lru_list_.size(), cache_.size());
+    RAY_CHECK_EQ(cache_.size(), nodes_.size() - free_indices_.size());
   }
 
   // Delete the entry with key `key`. Return true if the entry was found for
@@ -93,39 +118,66 @@ class SharedLruCache final {
     if (it == cache_.end()) {
       return false;
     }
-    lru_list_.erase(it->second.lru_iterator);
+    const NodeIndex index = it->second;
     cache_.erase(it);
+    Unlink(index);
+    FreeNode(index);
     return true;
   }
 
-  // Look up the entry with key `key`. Return std::nullopt if key doesn't exist.
-  // If found, return a copy for the value.
+  // Look up the entry with key `key`. Return nullptr if key doesn't exist, or the
+  // entry has outlived the cache's TTL. If found, return a copy for the value.
   template <typename KeyLike>
   std::shared_ptr<Val> Get(KeyLike &&key) {
     const auto cache_iter = cache_.find(key);
     if (cache_iter == cache_.end()) {
       return nullptr;
     }
-    lru_list_.splice(lru_list_.begin(), lru_list_, cache_iter->second.lru_iterator);
-    return cache_iter->second.value;
+    const NodeIndex index = cache_iter->second;
+    if (IsExpired(nodes_[index])) {
+      cache_.erase(cache_iter);
+      Unlink(index);
+      FreeNode(index);
+      return nullptr;
+    }
+    MoveToFront(index);
+    return nodes_[index].value;
   }
 
   // Clear the cache.
   void Clear() {
     cache_.clear();
-    lru_list_.clear();
+    nodes_.clear();
+    free_indices_.clear();
+    head_ = kNilIndex;
+    tail_ = kNilIndex;
   }
 
   // Accessors for cache parameters.
   size_t max_entries() const { return max_entries_; }
 
  private:
-  struct Entry {
+  // Entries are referenced by their index into the node arena; indices stay stable
+  // across insertions and deletions, which lets both the hash map and the LRU links
+  // refer to nodes without per-entry heap allocations.
+  using NodeIndex = size_t;
+  static constexpr NodeIndex kNilIndex = std::numeric_limits<size_t>::max();
+
+  struct Node {
+    // The entry's key; the hash map references it to avoid storing the key twice.
+    // Wrapped in an optional so free arena slots don't require the key type to be
+    // default-constructible.
+    std::optional<Key> key;
+
     // The entry's value.
     std::shared_ptr<Val> value;
 
-    // A list iterator pointing to the entry's position in the LRU list.
-    typename std::list<Key>::iterator lru_iterator;
+    // When the entry was (last) inserted; used by the TTL check.
+    std::chrono::steady_clock::time_point insertion_time;
+
+    // Intrusive LRU links, as arena indices.
+    NodeIndex prev = kNilIndex;
+    NodeIndex next = kNilIndex;
   };
 
   // TODO(hjiang): These two internal type alias has been consolidated into stable header
@@ -135,18 +187,95 @@ class SharedLruCache final {
 
   using KeyConstRef = std::reference_wrapper<const Key>;
   using EntryMap =
-      absl::flat_hash_map<KeyConstRef, Entry, RefHash<KeyHash>, RefEq<KeyEqual>>;
+      absl::flat_hash_map<KeyConstRef, NodeIndex, RefHash<KeyHash>, RefEq<KeyEqual>>;
+
+  // Take a node off the free list, or grow the arena by one slot.
+  NodeIndex AllocateNode() {
+    if (!free_indices_.empty()) {
+      const NodeIndex index = free_indices_.back();
+      free_indices_.pop_back();
+      return index;
+    }
+    nodes_.emplace_back();
+    return nodes_.size() - 1;
+  }
+
+  // Return a node's slot to the free list for reuse; the node must already be
+  // unlinked from the LRU list and erased from the hash map.
+  void FreeNode(NodeIndex index) {
+    Node &node = nodes_[index];
+    node.key.reset();
+    node.value = nullptr;
+    free_indices_.push_back(index);
+  }
+
+  // Detach the node from the LRU list.
+  void Unlink(NodeIndex index) {
+    Node &node = nodes_[index];
+    if (node.prev != kNilIndex) {
+      nodes_[node.prev].next = node.next;
+    } else {
+      head_ = node.next;
+    }
+    if (node.next != kNilIndex) {
+      nodes_[node.next].prev = node.prev;
+    } else {
+      tail_ = node.prev;
+    }
+    node.prev = kNilIndex;
+    node.next = kNilIndex;
+  }
+
+  // Attach an unlinked node at the most-recently-used end of the LRU list.
+  void PushFront(NodeIndex index) {
+    Node &node = nodes_[index];
+    node.prev = kNilIndex;
+    node.next = head_;
+    if (head_ != kNilIndex) {
+      nodes_[head_].prev = index;
+    }
+    head_ = index;
+    if (tail_ == kNilIndex) {
+      tail_ = index;
+    }
+  }
+
+  void MoveToFront(NodeIndex index) {
+    if (head_ == index) {
+      return;
+    }
+    Unlink(index);
+    PushFront(index);
+  }
+
+  bool IsExpired(const Node &node) const {
+    if (ttl_.count() == 0) {
+      return false;
+    }
+    return std::chrono::steady_clock::now() - node.insertion_time >= ttl_;
+  }
 
   // The maximum number of entries in the cache. A value of 0 means there is no
   // limit on entry count.
   const size_t max_entries_;
 
-  // Stores key-value pairs.
+  // Time-to-live for entries. A value of 0 means entries never expire.
+  const std::chrono::milliseconds ttl_{0};
+
+  // Maps keys (by reference into the node arena) to node indices.
   EntryMap cache_;
 
-  // The LRU list of entries. The front of the list identifies the most
-  // recently accessed entry.
-  std::list<Key> lru_list_;
+  // Slab arena holding all nodes; a deque keeps node addresses stable so the hash
+  // map's key references remain valid as the arena grows.
+  std::deque<Node> nodes_;
+
+  // Indices of arena slots freed by deletion and eviction, available for reuse.
+  std::vector<NodeIndex> free_indices_;
+
+  // Intrusive LRU list endpoints. The head identifies the most recently accessed
+  // entry, the tail the least recently accessed one.
+  NodeIndex head_ = kNilIndex;
+  NodeIndex tail_ = kNilIndex;
 };
 
 // Same interfaces as `SharedLruCache`, but all cached values are
@@ -165,6 +294,11 @@ class ThreadSafeSharedLruCache final {
   // in the cache.
   explicit ThreadSafeSharedLruCache(size_t max_entries) : cache_(max_entries) {}
 
+  // Same as above, additionally attaching a time-to-live to every entry.
+  // A `ttl` of 0 means entries never expire.
+  ThreadSafeSharedLruCache(size_t max_entries, std::chrono::milliseconds ttl)
+      : cache_(max_entries, ttl) {}
+
   ThreadSafeSharedLruCache(const ThreadSafeSharedLruCache &) = delete;
   ThreadSafeSharedLruCache &operator=(const ThreadSafeSharedLruCache &) = delete;
 
@@ -286,4 +420,100 @@ class ThreadSafeSharedLruCache final {
 template <typename K, typename V>
 using ThreadSafeSharedLruConstCache = ThreadSafeSharedLruCache<K, const V>;
 
+// Same interface and functionality as `ThreadSafeSharedLruCache`, but the key space is
+// partitioned over independently-locked shards to reduce lock contention. The overall
+// entry capacity is split evenly across shards, so eviction is approximate: a hot shard
+// may evict while a cold shard still has room.
+template <typename Key, typename Val>
+class ShardedSharedLruCache final {
+ public:
+  using key_type = Key;
+  using mapped_type = Val;
+
+  // A `max_entries` of 0 means that there is no limit on the number of entries
+  // in the cache. `num_shards` must be positive.
+  ShardedSharedLruCache(size_t max_entries, size_t num_shards)
+      : ShardedSharedLruCache(max_entries, num_shards, std::chrono::milliseconds{0}) {}
+
+  // Same as above, additionally attaching a time-to-live to every entry.
+  // A `ttl` of 0 means entries never expire.
+  ShardedSharedLruCache(size_t max_entries,
+                        size_t num_shards,
+                        std::chrono::milliseconds ttl) {
+    RAY_CHECK_GT(num_shards, 0UL);
+    // Round the per-shard capacity up so the shards together hold at least
+    // `max_entries` entries.
+    const size_t per_shard_entries =
+        max_entries == 0 ? 0 : (max_entries + num_shards - 1) / num_shards;
+    shards_.reserve(num_shards);
+    for (size_t idx = 0; idx < num_shards; ++idx) {
+      shards_.emplace_back(
+          std::make_unique<ThreadSafeSharedLruCache<Key, Val>>(per_shard_entries, ttl));
+    }
+  }
+
+  ShardedSharedLruCache(const ShardedSharedLruCache &) = delete;
+  ShardedSharedLruCache &operator=(const ShardedSharedLruCache &) = delete;
+
+  ~ShardedSharedLruCache() = default;
+
+  // Insert `value` with key `key`. This will replace any previous entry with
+  // the same key.
+  void Put(Key key, std::shared_ptr<Val> value) {
+    auto &shard = Shard(key);
+    shard.Put(std::move(key), std::move(value));
+  }
+
+  // Delete the entry with key `key`. Return true if the entry was found for
+  // `key`, false if the entry was not found. In both cases, there is no entry
+  // with key `key` existed after the call.
+  template <typename KeyLike>
+  bool Delete(KeyLike &&key) {
+    auto &shard = Shard(key);
+    return shard.Delete(std::forward<KeyLike>(key));
+  }
+
+  // Look up the entry with key `key`. Return nullptr if key doesn't exist.
+  // If found, return a copy for the value.
+  template <typename KeyLike>
+  std::shared_ptr<Val> Get(KeyLike &&key) {
+    auto &shard = Shard(key);
+    return shard.Get(std::forward<KeyLike>(key));
+  }
+
+  // Get or creation for cached key-value pairs; creation is deduplicated within a
+  // shard, see `ThreadSafeSharedLruCache::GetOrCreate`.
+  template <typename KeyLike>
+  std::shared_ptr<Val> GetOrCreate(
+      KeyLike &&key, std::function<std::shared_ptr<Val>(const Key &)> factory) {
+    auto &shard = Shard(key);
+    return shard.GetOrCreate(std::forward<KeyLike>(key), std::move(factory));
+  }
+
+  // Clear the cache.
+  void Clear() {
+    for (auto &shard : shards_) {
+      shard->Clear();
+    }
+  }
+
+  // Accessors for cache parameters.
+  size_t num_shards() const { return shards_.size(); }
+
+ private:
+  using KeyHash = absl::container_internal::hash_default_hash<Key>;
+
+  template <typename KeyLike>
+  ThreadSafeSharedLruCache<Key, Val> &Shard(const KeyLike &key) {
+    return *shards_[KeyHash{}(key) % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<ThreadSafeSharedLruCache<Key, Val>>> shards_;
+};
+
+// Same interfaces as `ShardedSharedLruCache`, but all cached values are
+// `const`-specified to avoid concurrent updates.
+template <typename K, typename V>
+using ShardedSharedLruConstCache = ShardedSharedLruCache<K, const V>;
+
 }  // namespace ray::utils::container
@@ -0,0 +1,109 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Microbenchmark comparing ConcurrentFlatMap (sharded reader-writer locks)
+// against LockFreeConcurrentFlatMap (lock-free reads, per-bucket write locks)
+// under mixed read/write workloads. Runs as a regular gtest and prints
+// throughput numbers; it makes no timing assertions so it stays stable in CI.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "ray/util/concurrent_flat_map.h"
+
+namespace ray {
+
+namespace {
+
+constexpr int kNumThreads = 8;
+constexpr int kNumKeys = 1024;
+constexpr int kOpsPerThread = 100000;
+
+// Runs `kNumThreads` threads over `map`, each performing `kOpsPerThread`
+// operations of which `write_percent` are InsertOrAssign/Erase and the rest
+// are Get. Returns the aggregate throughput in operations per second.
+template <typename MapType>
+double RunMixedWorkload(MapType &map, int write_percent) {
+  for (int i = 0; i < kNumKeys; i++) {
+    map.InsertOrAssign(absl::StrCat("key", i), absl::StrCat("value", i));
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  const auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&map, write_percent, t] {
+      // Cheap deterministic per-thread sequence; no shared RNG state to avoid
+      // benchmarking the RNG's contention instead of the map's.
+      uint64_t state = 88172645463325252ULL + t;
+      for (int i = 0; i < kOpsPerThread; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const std::string key = absl::StrCat("key", state % kNumKeys);
+        if (static_cast<int>(state % 100) < write_percent) {
+          if (state % 16 == 0) {
+            map.Erase(key);
+          } else {
+            map.InsertOrAssign(key, absl::StrCat("value", i));
+          }
+        } else {
+          auto val = map.Get(key);
+          (void)val;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  return static_cast<double>(kNumThreads) * kOpsPerThread * 1e6 /
+         static_cast<double>(elapsed);
+}
+
+void RunComparison(int write_percent) {
+  ConcurrentFlatMap<std::string, std::string> single_shard_map;
+  ConcurrentFlatMap<std::string, std::string> sharded_map(kNumThreads);
+  LockFreeConcurrentFlatMap<std::string, std::string> lock_free_map(kNumKeys);
+
+  const double single_shard_ops = RunMixedWorkload(single_shard_map, write_percent);
+  const double sharded_ops = RunMixedWorkload(sharded_map, write_percent);
+  const double lock_free_ops = RunMixedWorkload(lock_free_map, write_percent);
+
+  std::cout << "Mixed workload, " << write_percent << "% writes, " << kNumThreads
+            << " threads (ops/sec):\n"
+            << "  ConcurrentFlatMap (1 shard):   " << static_cast<int64_t>(single_shard_ops)
+            << "\n"
+            << "  ConcurrentFlatMap (" << kNumThreads
+            << " shards):  " << static_cast<int64_t>(sharded_ops) << "\n"
+            << "  LockFreeConcurrentFlatMap:     " << static_cast<int64_t>(lock_free_ops)
+            << std::endl;
+}
+
+}  // namespace
+
+TEST(ConcurrentFlatMapBenchmark, ReadMostlyWorkload) { RunComparison(/*write_percent=*/10); }
+
+TEST(ConcurrentFlatMapBenchmark, BalancedWorkload) { RunComparison(/*write_percent=*/50); }
+
+}  // namespace ray
@@ -17,6 +17,12 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 
 namespace ray {
 
@@ -83,4 +89,133 @@ TEST(ConcurrentFlatMap, TestConcurrentFlatMapVisitors) {
                 [](int key, int value) { EXPECT_EQ(value, 10); });
 }
 
+TEST(ConcurrentFlatMap, TestConcurrentFlatMapSharded) {
+  ConcurrentFlatMap<std::string, std::string> map(8);
+  map.Reserve(100);
+
+  std::vector<std::string> keys;
+  for (int i = 0; i < 100; i++) {
+    keys.push_back(absl::StrCat("key", i));
+    EXPECT_TRUE(map.InsertOrAssign(keys.back(), absl::StrCat("value", i)));
+  }
+
+  // Per-key lookups must land in the same shard as the insert, including
+  // through heterogeneous keys.
+  EXPECT_EQ(map.Get("key42"), "value42");
+  EXPECT_TRUE(map.Contains(std::string_view("key42")));
+  EXPECT_FALSE(map.Contains("missing"));
+
+  // Whole-map operations see all shards.
+  auto clone = map.GetMapClone();
+  EXPECT_EQ(clone.size(), 100);
+  EXPECT_EQ(clone.at("key7"), "value7");
+  int num_visited = 0;
+  map.ReadVisitAll([&num_visited](const std::string &key, const std::string &value) {
+    ++num_visited;
+  });
+  EXPECT_EQ(num_visited, 100);
+
+  // Multi-key operations cover keys across shards.
+  int num_read = 0;
+  map.ReadVisit(absl::MakeConstSpan(keys),
+                [&num_read](const std::string &key, const std::string &value) {
+                  ++num_read;
+                });
+  EXPECT_EQ(num_read, 100);
+  EXPECT_EQ(map.EraseKeys(absl::MakeConstSpan(keys)), 100);
+  EXPECT_EQ(map.GetMapClone().size(), 0);
+}
+
+TEST(LockFreeConcurrentFlatMap, TestBasic) {
+  LockFreeConcurrentFlatMap<std::string, std::string> map;
+
+  // simple emplace and get
+  map.Emplace("key", "value");
+  EXPECT_EQ(map.Get("key"), "value");
+
+  // make sure we don't replace value
+  map.Emplace("key", "wrong value");
+  EXPECT_EQ(map.Get("key"), "value");
+
+  // make sure we can replace value
+  // replacing returns false
+  EXPECT_FALSE(map.InsertOrAssign("key", "correct value"));
+  EXPECT_EQ(map.Get("key"), "correct value");
+  // inserting returns true
+  EXPECT_TRUE(map.InsertOrAssign("new key", "value"));
+
+  // can clone
+  auto value = map.GetMapClone().at("key");
+  EXPECT_EQ(value, "correct value");
+
+  // make sure erase and contains works
+  EXPECT_TRUE(map.Contains("key"));
+  EXPECT_TRUE(map.Erase("key"));
+  EXPECT_FALSE(map.Contains("key"));
+  EXPECT_FALSE(map.Erase("key"));
+
+  // test erase keys
+  map.Emplace("key1", "value1");
+  map.Emplace("key2", "value2");
+  map.EraseKeys(absl::MakeConstSpan({"key1", "key2"}));
+  EXPECT_FALSE(map.Contains("key1") || map.Contains("key2"));
+}
+
+TEST(LockFreeConcurrentFlatMap, TestVisitors) {
+  LockFreeConcurrentFlatMap<int, int> map;
+  map.Emplace(1, 1);
+  map.Emplace(2, 2);
+  map.Emplace(3, 3);
+
+  int num_read = 0;
+  map.ReadVisit(absl::MakeConstSpan({1, 2}), [&num_read](int key, int val) {
+    EXPECT_EQ(key, val);
+    ++num_read;
+  });
+  EXPECT_EQ(num_read, 2);
+
+  int num_iters = 0;
+  map.ReadVisitAll([&num_iters](int key, int val) {
+    EXPECT_EQ(key, val);
+    ++num_iters;
+  });
+  EXPECT_EQ(num_iters, 3);
+
+  map.WriteVisit(absl::MakeConstSpan({1, 2}), [](int key, int &value) { value = 10; });
+  map.ReadVisit(absl::MakeConstSpan({1, 2}),
+                [](int key, int value) { EXPECT_EQ(value, 10); });
+}
+
+TEST(LockFreeConcurrentFlatMap, TestConcurrentReadersAndWriters) {
+  LockFreeConcurrentFlatMap<std::string, std::string> map(/*expected_size=*/256);
+  constexpr int kNumThreads = 4;
+  constexpr int kNumIterations = 10000;
+  constexpr int kNumKeys = 100;
+
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&map, t] {
+      for (int i = 0; i < kNumIterations; i++) {
+        const std::string key = absl::StrCat("key", i % kNumKeys);
+        if (t % 2 == 0) {
+          map.InsertOrAssign(key, absl::StrCat("value", i));
+          if (i % 3 == 0) {
+            map.Erase(key);
+          }
+        } else {
+          auto val = map.Get(key);
+          if (val.has_value()) {
+            // Readers must only ever observe fully-constructed values.
+            EXPECT_TRUE(absl::StartsWith(*val, "value"));
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
 }  // namespace ray
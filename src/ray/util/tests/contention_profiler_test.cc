@@ -0,0 +1,114 @@
+// Copyright 2025 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/util/contention_profiler.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ray/util/mutex_protected.h"
+
+namespace ray {
+
+TEST(ContentionProfilerTest, DisabledRecordsNothing) {
+  auto &profiler = ContentionProfiler::instance();
+  profiler.Disable();
+  profiler.Reset();
+
+  ProfiledMutex mutex("test.disabled_site");
+  mutex.Lock();
+  mutex.Unlock();
+  profiler.FlushThreadLocal();
+
+  for (const auto &[site_name, site_stats] : profiler.GetStats()) {
+    EXPECT_NE(site_name, "test.disabled_site");
+  }
+}
+
+TEST(ContentionProfilerTest, SamplesWaitsPerCallSite) {
+  auto &profiler = ContentionProfiler::instance();
+  profiler.Reset();
+  profiler.Enable(/*sample_every_n=*/1);
+
+  ProfiledMutex mutex("test.sampled_site");
+  std::thread contender([&mutex]() {
+    for (int i = 0; i < 100; i++) {
+      mutex.Lock();
+      mutex.Unlock();
+    }
+    ContentionProfiler::instance().FlushThreadLocal();
+  });
+  for (int i = 0; i < 100; i++) {
+    mutex.Lock();
+    mutex.Unlock();
+  }
+  contender.join();
+  profiler.FlushThreadLocal();
+
+  bool found = false;
+  for (const auto &[site_name, site_stats] : profiler.GetStats()) {
+    if (site_name == "test.sampled_site") {
+      found = true;
+      EXPECT_EQ(site_stats.num_samples, 200);
+      EXPECT_GE(site_stats.total_wait_ns, 0);
+      EXPECT_GE(site_stats.max_wait_ns, 0);
+    }
+  }
+  EXPECT_TRUE(found);
+
+  profiler.Disable();
+  profiler.Reset();
+}
+
+TEST(ContentionProfilerTest, ReaderLocksAreSampled) {
+  auto &profiler = ContentionProfiler::instance();
+  profiler.Reset();
+  profiler.Enable(/*sample_every_n=*/1);
+
+  ProfiledMutex mutex("test.reader_site");
+  for (int i = 0; i < 10; i++) {
+    mutex.ReaderLock();
+    mutex.ReaderUnlock();
+  }
+  profiler.FlushThreadLocal();
+
+  bool found = false;
+  for (const auto &[site_name, site_stats] : profiler.GetStats()) {
+    if (site_name == "test.reader_site") {
+      found = true;
+      EXPECT_EQ(site_stats.num_samples, 10);
+    }
+  }
+  EXPECT_TRUE(found);
+
+  profiler.Disable();
+  profiler.Reset();
+}
+
+TEST(ProfiledMutexProtectedTest, ReadAndWrite) {
+  ProfiledMutexProtected<std::vector<int>> protected_values("test.protected_site");
+  {
+    auto locked = protected_values.LockForWrite();
+    locked.Get().push_back(42);
+  }
+  {
+    auto locked = protected_values.LockForRead();
+    ASSERT_EQ(locked.Get().size(), 1UL);
+    EXPECT_EQ(locked.Get()[0], 42);
+  }
+}
+
+}  // namespace ray
@@ -15,6 +15,8 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "ray/util/counter_map.h"
 
@@ -131,6 +133,81 @@ TEST_F(CounterMapTest, TestIterate) {
   EXPECT_EQ(num_keys, 2);
 }
 
+TEST_F(CounterMapTest, TestShardedBasic) {
+  auto c = CounterMapSharded<std::string>(/*num_shards=*/4);
+  c.Increment("k1");
+  c.Increment("k1");
+  c.Increment("k2");
+  EXPECT_EQ(c.Get("k1"), 2);
+  EXPECT_EQ(c.Get("k2"), 1);
+  EXPECT_EQ(c.Get("k3"), 0);
+  EXPECT_EQ(c.Total(), 3);
+  EXPECT_EQ(c.Size(), 2);
+
+  c.Decrement("k1");
+  c.Decrement("k2");
+  EXPECT_EQ(c.Get("k1"), 1);
+  EXPECT_EQ(c.Get("k2"), 0);
+  EXPECT_EQ(c.Total(), 1);
+  EXPECT_EQ(c.Size(), 1);
+
+  c.Swap("k1", "k2");
+  EXPECT_EQ(c.Get("k1"), 0);
+  EXPECT_EQ(c.Get("k2"), 1);
+  EXPECT_EQ(c.Total(), 1);
+  EXPECT_EQ(c.Size(), 1);
+
+  auto all = c.GetAll();
+  EXPECT_EQ(all.size(), 1);
+  EXPECT_EQ(all["k2"], 1);
+}
+
+TEST_F(CounterMapTest, TestShardedCallback) {
+  auto c = CounterMapSharded<std::string>(/*num_shards=*/4);
+  int num_calls = 0;
+  c.SetOnChangeCallback([&](const std::string &key) mutable {
+    num_calls += 1;
+    // The flush runs without holding any shard lock, so the callback can
+    // read back through the counter.
+    EXPECT_GE(c.Get(key), 0);
+  });
+
+  c.Increment("k1");
+  c.Increment("k2");
+  c.Increment("k3");
+  EXPECT_EQ(c.NumPendingCallbacks(), 3);
+  c.FlushOnChangeCallbacks();
+  EXPECT_EQ(c.NumPendingCallbacks(), 0);
+  EXPECT_EQ(num_calls, 3);
+}
+
+TEST_F(CounterMapTest, TestShardedConcurrentIncrement) {
+  auto c = CounterMapSharded<std::string>(/*num_shards=*/8);
+  const int num_threads = 4;
+  const int num_keys = 16;
+  const int increments_per_key = 100;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&c]() {
+      for (int i = 0; i < increments_per_key; ++i) {
+        for (int k = 0; k < num_keys; ++k) {
+          c.Increment("k" + std::to_string(k));
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(c.Size(), num_keys);
+  EXPECT_EQ(c.Total(), num_threads * num_keys * increments_per_key);
+  for (int k = 0; k < num_keys; ++k) {
+    EXPECT_EQ(c.Get("k" + std::to_string(k)), num_threads * increments_per_key);
+  }
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
@@ -245,6 +245,26 @@ TEST(PrintLogTest, TestJSONLogging) {
 
 #endif /* GTEST_HAS_STREAM_REDIRECTION */
 
+TEST(PrintLogTest, TestAsyncLogging) {
+  SetEnv("RAY_BACKEND_LOG_ASYNC", "1");
+  const std::string log_dir = ray::GetUserTempDir();
+  const std::string log_filepath =
+      GetLogFilepathFromDirectory(log_dir, /*app_name=*/"async_logging_test");
+  RayLog::StartRayLog("async_logging_test", RayLogLevel::INFO, log_filepath);
+  for (int i = 0; i < 100; i++) {
+    RAY_LOG(INFO) << "async log line " << i;
+  }
+  // Shutdown drains the async queue before we read the file back.
+  RayLog::ShutDownRayLog();
+
+  std::ifstream log_file(log_filepath);
+  std::string content((std::istreambuf_iterator<char>(log_file)),
+                      std::istreambuf_iterator<char>());
+  EXPECT_NE(content.find("async log line 0"), std::string::npos);
+  EXPECT_NE(content.find("async log line 99"), std::string::npos);
+  UnsetEnv("RAY_BACKEND_LOG_ASYNC");
+}
+
 TEST(PrintLogTest, LogTestWithInit) {
   // Test empty app name.
   const std::string log_dir = ray::GetUserTempDir();
@@ -0,0 +1,104 @@
+// Copyright 2026 The Ray Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ray/util/memory_telemetry.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace ray {
+
+namespace {
+
+// MemoryTelemetry is a process-wide leaked singleton, so tests assert on
+// deltas rather than absolute values.
+int64_t LiveBytesFor(MemoryTag tag) {
+  for (const auto &entry : MemoryTelemetry::Instance().GetEstimatedLiveBytes()) {
+    if (entry.tag == tag) {
+      return entry.bytes;
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
+TEST(MemoryTelemetryTest, AttributesSampledAllocationsToCurrentTag) {
+  auto &telemetry = MemoryTelemetry::Instance();
+  telemetry.Enable(/*sample_period=*/1);
+
+  const int64_t tagged_before = LiveBytesFor(MemoryTag::kObjectPulls);
+  char buf;
+  {
+    ScopedMemoryTag tag(MemoryTag::kObjectPulls);
+    telemetry.OnAlloc(&buf, 128);
+  }
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kObjectPulls), tagged_before + 128);
+
+  // Freeing the sampled pointer returns the attributed bytes, even though the
+  // scope has already ended.
+  telemetry.OnFree(&buf);
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kObjectPulls), tagged_before);
+}
+
+TEST(MemoryTelemetryTest, NestedScopesRestoreThePreviousTag) {
+  auto &telemetry = MemoryTelemetry::Instance();
+  telemetry.Enable(/*sample_period=*/1);
+
+  const int64_t pubsub_before = LiveBytesFor(MemoryTag::kPubsub);
+  const int64_t gcs_before = LiveBytesFor(MemoryTag::kGcsTables);
+  char inner_buf;
+  char outer_buf;
+  {
+    ScopedMemoryTag outer(MemoryTag::kPubsub);
+    {
+      ScopedMemoryTag inner(MemoryTag::kGcsTables);
+      telemetry.OnAlloc(&inner_buf, 64);
+    }
+    telemetry.OnAlloc(&outer_buf, 32);
+  }
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kGcsTables), gcs_before + 64);
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kPubsub), pubsub_before + 32);
+
+  telemetry.OnFree(&inner_buf);
+  telemetry.OnFree(&outer_buf);
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kGcsTables), gcs_before);
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kPubsub), pubsub_before);
+}
+
+TEST(MemoryTelemetryTest, ScalesSampledSizesByTheSamplePeriod) {
+  auto &telemetry = MemoryTelemetry::Instance();
+  constexpr int64_t kPeriod = 5;
+  telemetry.Enable(kPeriod);
+
+  // With equal-size allocations, any window of `kPeriod` consecutive
+  // allocations contains exactly one sample regardless of the thread's
+  // sampling phase, and that sample is scaled up by the period.
+  const int64_t untagged_before = LiveBytesFor(MemoryTag::kUntagged);
+  char bufs[kPeriod];
+  for (auto &buf : bufs) {
+    telemetry.OnAlloc(&buf, 16);
+  }
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kUntagged), untagged_before + 16 * kPeriod);
+
+  // Frees of unsampled pointers are no-ops; only the sampled one gives back
+  // its attributed bytes.
+  for (auto &buf : bufs) {
+    telemetry.OnFree(&buf);
+  }
+  EXPECT_EQ(LiveBytesFor(MemoryTag::kUntagged), untagged_before);
+}
+
+}  // namespace ray
@@ -25,6 +25,7 @@
 
 #include "absl/strings/str_format.h"
 #include "ray/common/id.h"
+#include "ray/common/ray_config.h"
 #include "ray/common/tests/testing.h"
 #include "ray/util/filesystem.h"
 #include "ray/util/scoped_env_setter.h"
@@ -131,6 +132,57 @@ TEST_P(PipeLoggerTest, RotatedRedirectionWithTee) {
   EXPECT_EQ(*actual_content2, kLogLine1);
 }
 
+#if defined(__linux__)
+TEST(PipeLoggerSpliceTest, SpliceRedirectionWithRotation) {
+  RayConfig::instance().pipe_logger_splice_enabled() = true;
+  ScopedTemporaryDirectory scoped_directory;
+  const auto uuid = RandomID();
+  const auto test_file_path = scoped_directory.GetDirectory() / uuid;
+  const auto rotated_file_path =
+      scoped_directory.GetDirectory() / absl::StrFormat("%s.1", uuid);
+
+  StreamRedirectionOption stream_redirection_opt{};
+  stream_redirection_opt.file_path = test_file_path.string();
+  stream_redirection_opt.rotation_max_size = 5;
+  stream_redirection_opt.rotation_max_file_count = 2;
+
+  auto stream_redirection_handle = CreateRedirectionFileHandle(stream_redirection_opt);
+  stream_redirection_handle.CompleteWrite(kLogLine1.data(), kLogLine1.length());
+  stream_redirection_handle.Close();
+
+  // kLogLine1 exceeds the rotation size, so it has been rotated out and the
+  // live file reopened empty.
+  const auto rotated_content = ReadEntireFile(rotated_file_path.string());
+  RAY_ASSERT_OK(rotated_content);
+  EXPECT_EQ(*rotated_content, kLogLine1);
+  const auto live_content = ReadEntireFile(test_file_path.string());
+  RAY_ASSERT_OK(live_content);
+  EXPECT_TRUE(live_content->empty());
+  RayConfig::instance().pipe_logger_splice_enabled() = false;
+}
+
+TEST(PipeLoggerSpliceTest, SpliceRedirectionForwardsAllContent) {
+  RayConfig::instance().pipe_logger_splice_enabled() = true;
+  ScopedTemporaryDirectory scoped_directory;
+  const auto test_file_path = scoped_directory.GetDirectory() / RandomID();
+
+  StreamRedirectionOption stream_redirection_opt{};
+  stream_redirection_opt.file_path = test_file_path.string();
+  stream_redirection_opt.rotation_max_size = 1024 * 1024;
+  stream_redirection_opt.rotation_max_file_count = 2;
+
+  auto stream_redirection_handle = CreateRedirectionFileHandle(stream_redirection_opt);
+  stream_redirection_handle.CompleteWrite(kLogLine1.data(), kLogLine1.length());
+  stream_redirection_handle.CompleteWrite(kLogLine2.data(), kLogLine2.length());
+  stream_redirection_handle.Close();
+
+  const auto actual_content = ReadEntireFile(test_file_path.string());
+  RAY_ASSERT_OK(actual_content);
+  EXPECT_EQ(*actual_content, absl::StrFormat("%s%s", kLogLine1, kLogLine2));
+  RayConfig::instance().pipe_logger_splice_enabled() = false;
+}
+#endif  // defined(__linux__)
+
 // Testing scenario: log to stdout and file; check whether these two sinks generate
 // expected output.
 TEST_P(PipeLoggerTest, CompatibilityTest) {
@@ -23,6 +23,7 @@
 #include <thread>
 #include <vector>
 
+#include "ray/common/ray_config.h"
 #include "ray/util/logging.h"
 #include "ray/util/process_utils.h"
 
@@ -78,6 +79,27 @@ TEST(UtilTest, GetAllProcsWithPpid) {
 #endif
 }
 
+#if !defined(_WIN32)
+TEST(UtilTest, PosixSpawnFastPathLaunchesProcess) {
+  RayConfig::instance().process_posix_spawn_enabled() = true;
+
+  std::error_code ec;
+  const char *argv[] = {"bash", "-c", "exit 0", nullptr};
+  Process p(argv, ec, /*decouple=*/false);
+  ASSERT_FALSE(ec) << ec.message();
+  ASSERT_TRUE(p.IsValid());
+  EXPECT_EQ(p.Wait(), 0);
+
+  // A missing binary surfaces through the error code instead of a child that
+  // exits after a failed exec.
+  const char *bad_argv[] = {"ray-no-such-binary", nullptr};
+  Process bad(bad_argv, ec, /*decouple=*/false);
+  EXPECT_TRUE(static_cast<bool>(ec));
+
+  RayConfig::instance().process_posix_spawn_enabled() = false;
+}
+#endif
+
 TEST(UtilTest, CompareProcessObjects) {
   // Test the std::equal_to<Process> specialization with actual Process objects
   Process null1, null2;
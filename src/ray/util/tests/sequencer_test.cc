@@ -17,6 +17,7 @@
 #include <chrono>
 #include <deque>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "ray/util/logging.h"
@@ -47,6 +48,72 @@ TEST(SequencerTest, ExecuteOrderedTest) {
   }
 }
 
+TEST(SequencerTest, BatchDrainOrderedTest) {
+  // Batch draining changes how many lock hops deep queues take, not the
+  // execution order.
+  Sequencer<int> sequencer(/*max_concurrency_per_key=*/1, /*max_batch_size=*/4);
+  std::deque<int> queue;
+  std::vector<SequencerDoneCallback> held_callbacks;
+  int key = 1;
+  int size = 9;
+
+  // The first operation holds its done callback so the rest pile up behind it.
+  sequencer.Post(key, [&held_callbacks](SequencerDoneCallback done_callback) {
+    held_callbacks.push_back(done_callback);
+  });
+  for (int index = 0; index < size; ++index) {
+    sequencer.Post(key, [index, &queue](SequencerDoneCallback done_callback) {
+      queue.push_back(index);
+      done_callback();
+    });
+  }
+  ASSERT_TRUE(queue.empty());
+
+  auto stats = sequencer.GetStats();
+  ASSERT_EQ(stats.num_keys, 1);
+  ASSERT_EQ(stats.total_pending, static_cast<size_t>(size));
+  ASSERT_EQ(stats.total_in_flight, 1);
+  ASSERT_EQ(stats.max_queue_depth, static_cast<size_t>(size));
+
+  // Completing the first operation drains the rest in batches of 4, in order.
+  held_callbacks.front()();
+  ASSERT_EQ(queue.size(), static_cast<size_t>(size));
+  for (int index = 0; index < size; ++index) {
+    ASSERT_EQ(queue.front(), index);
+    queue.pop_front();
+  }
+  ASSERT_EQ(sequencer.GetStats().num_keys, 0);
+}
+
+TEST(SequencerTest, BoundedPerKeyConcurrencyTest) {
+  Sequencer<int> sequencer(/*max_concurrency_per_key=*/3);
+  std::vector<SequencerDoneCallback> held_callbacks;
+  int started = 0;
+  int key = 1;
+
+  for (int index = 0; index < 5; ++index) {
+    sequencer.Post(key, [&](SequencerDoneCallback done_callback) {
+      ++started;
+      held_callbacks.push_back(done_callback);
+    });
+  }
+  // Only 3 operations of the key may be in flight at once.
+  ASSERT_EQ(started, 3);
+  ASSERT_EQ(sequencer.GetStats().total_in_flight, 3);
+  ASSERT_EQ(sequencer.GetStats().total_pending, 2);
+
+  // Each completion frees a slot for one queued operation.
+  held_callbacks[0]();
+  ASSERT_EQ(started, 4);
+  held_callbacks[1]();
+  ASSERT_EQ(started, 5);
+
+  for (size_t index = 2; index < held_callbacks.size(); ++index) {
+    held_callbacks[index]();
+  }
+  ASSERT_EQ(sequencer.GetStats().num_keys, 0);
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {
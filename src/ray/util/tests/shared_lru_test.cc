@@ -120,6 +120,57 @@ TEST(SharedLruCache, FactoryTest) {
   ASSERT_EQ(*cached_val, key);
 }
 
+TEST(SharedLruCache, EvictionOrderTest) {
+  SharedLruCache<int, int> cache{3};
+  cache.Put(1, std::make_shared<int>(1));
+  cache.Put(2, std::make_shared<int>(2));
+  cache.Put(3, std::make_shared<int>(3));
+
+  // Touch key 1 so key 2 becomes the least recently used entry.
+  EXPECT_NE(cache.Get(1), nullptr);
+  cache.Put(4, std::make_shared<int>(4));
+
+  EXPECT_EQ(cache.Get(2), nullptr);
+  EXPECT_NE(cache.Get(1), nullptr);
+  EXPECT_NE(cache.Get(3), nullptr);
+  EXPECT_NE(cache.Get(4), nullptr);
+}
+
+TEST(SharedLruCache, TtlTest) {
+  SharedLruCache<std::string, std::string> cache{kTestCacheSz,
+                                                 std::chrono::milliseconds(100)};
+  cache.Put("key", std::make_shared<std::string>("val"));
+  auto val = cache.Get("key");
+  ASSERT_NE(val, nullptr);
+  EXPECT_EQ(*val, "val");
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_EQ(cache.Get("key"), nullptr);
+
+  // Re-insertion refreshes the entry's TTL.
+  cache.Put("key", std::make_shared<std::string>("val"));
+  EXPECT_NE(cache.Get("key"), nullptr);
+}
+
+TEST(ShardedSharedLruCache, PutAndGet) {
+  ShardedSharedLruCache<int, int> cache{/*max_entries=*/0, /*num_shards=*/4};
+
+  constexpr int kEntryNum = 100;
+  for (int idx = 0; idx < kEntryNum; ++idx) {
+    cache.Put(idx, std::make_shared<int>(idx));
+  }
+  for (int idx = 0; idx < kEntryNum; ++idx) {
+    auto val = cache.Get(idx);
+    ASSERT_NE(val, nullptr);
+    ASSERT_EQ(*val, idx);
+  }
+
+  EXPECT_TRUE(cache.Delete(0));
+  EXPECT_EQ(cache.Get(0), nullptr);
+  cache.Clear();
+  EXPECT_EQ(cache.Get(1), nullptr);
+}
+
 TEST(SharedLruConstCache, TypeAliasAssertion) {
   static_assert(
       std::is_same_v<SharedLruConstCache<int, int>, SharedLruCache<int, const int>>);